@@ -3,6 +3,10 @@
 
 #include <concepts>
 #include <cstddef>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <optional>
 #include <span>
 #include <string_view>
 #include <type_traits>
@@ -18,11 +22,55 @@
 
 namespace cowel::ast {
 
+/// @brief An immutable sequence of AST nodes which is shared between copies.
+///
+/// Copying a node which holds `Shared_Nodes` does not copy the children,
+/// but merely shares them with the original.
+/// This makes copying an AST node `O(1)`,
+/// and transformations of the AST (such as macro instantiation)
+/// only need to create the nodes along the path that they rewrite.
+template <typename T>
+struct Shared_Nodes {
+private:
+    // Null for empty sequences, so that the common case of directives with no arguments
+    // or content requires no allocation.
+    std::shared_ptr<const std::pmr::vector<T>> m_nodes;
+
+public:
+    [[nodiscard]]
+    Shared_Nodes() noexcept
+        = default;
+
+    /// @brief Takes ownership of `nodes`.
+    /// The shared storage is allocated using the memory resource of `nodes`.
+    [[nodiscard]]
+    explicit Shared_Nodes(std::pmr::vector<T>&& nodes);
+
+    [[nodiscard]]
+    std::span<const T> get() const noexcept;
+
+    /// @brief Returns the address of the shared storage, or null if there are no nodes.
+    /// Copies have the same identity as the original.
+    [[nodiscard]]
+    const void* identity() const noexcept
+    {
+        return m_nodes.get();
+    }
+
+    /// @brief Returns the memory resource that the shared storage was allocated from,
+    /// or null if there are no nodes.
+    [[nodiscard]]
+    std::pmr::memory_resource* get_memory_resource() const noexcept
+    {
+        return m_nodes ? m_nodes->get_allocator().resource() : nullptr;
+    }
+};
+
 struct Argument final {
 private:
     File_Source_Span8 m_source_span;
     std::u8string_view m_source;
-    std::pmr::vector<Content> m_content;
+    Shared_Nodes<Content> m_content;
     File_Source_Span8 m_name_span;
     std::u8string_view m_name;
 
@@ -82,21 +130,35 @@ public:
     }
 
     [[nodiscard]]
-    std::pmr::vector<Content>& get_content() &;
-    [[nodiscard]]
-    std::span<const Content> get_content() const&;
+    std::span<const Content> get_content() const;
+    /// @brief Returns the shared storage of the content,
+    /// which identifies it for the purpose of memoization.
     [[nodiscard]]
-    std::pmr::vector<Content>&& get_content() &&;
+    const Shared_Nodes<Content>& get_content_nodes() const
+    {
+        return m_content;
+    }
 };
 
+/// @brief A directive, such as `\\b{text}`.
+///
+/// Directives are stored out-of-line, and copies share the same storage.
+/// This keeps `Content` small,
+/// which matters because most content consists of `Text` rather than directives.
 struct Directive final {
 private:
-    File_Source_Span8 m_source_span;
-    std::u8string_view m_source;
-    std::u8string_view m_name;
+    struct Data {
+        File_Source_Span8 source_span;
+        std::u8string_view source;
+        std::u8string_view name;
 
-    std::pmr::vector<Argument> m_arguments;
-    std::pmr::vector<Content> m_content;
+        Shared_Nodes<Argument> arguments;
+        Shared_Nodes<Content> content;
+        /// @brief The memory resource that this data was allocated from.
+        std::pmr::memory_resource* memory;
+    };
+
+    std::shared_ptr<const Data> m_data;
 
 public:
     [[nodiscard]]
@@ -108,6 +170,12 @@ public:
         std::pmr::vector<Content>&& block
     );
 
+    /// @brief Constructs a directive which is equal to `other`,
+    /// except that the content is replaced with `block`.
+    /// The arguments are shared with `other`, not copied.
+    [[nodiscard]]
+    Directive(const Directive& other, std::pmr::vector<Content>&& block);
+
     Directive(Directive&&) noexcept;
     Directive(const Directive&);
 
@@ -119,56 +187,110 @@ public:
     [[nodiscard]]
     File_Source_Span8 get_source_span() const
     {
-        return m_source_span;
+        return m_data->source_span;
     }
 
     [[nodiscard]]
     std::u8string_view get_source() const
     {
-        return m_source;
+        return m_data->source;
     }
 
     [[nodiscard]]
     File_Source_Span8 get_name_span() const
     {
-        return m_source_span.with_length(m_name.length());
+        return m_data->source_span.with_length(m_data->name.length());
     }
 
     [[nodiscard]]
     std::u8string_view get_name() const
     {
-        return m_name;
+        return m_data->name;
     }
 
-    [[nodiscard]]
-    std::pmr::vector<Argument>& get_arguments();
     [[nodiscard]]
     std::span<const Argument> get_arguments() const;
     [[nodiscard]]
-    std::pmr::vector<Content>& get_content();
-    [[nodiscard]]
     std::span<Content const> get_content() const;
+    /// @brief Returns the shared storage of the content,
+    /// which identifies it for the purpose of memoization.
+    [[nodiscard]]
+    const Shared_Nodes<Content>& get_content_nodes() const
+    {
+        return m_data->content;
+    }
+
+    /// @brief Returns the address of the shared storage of this directive.
+    /// Copies have the same identity as the original.
+    [[nodiscard]]
+    const void* identity() const noexcept
+    {
+        return m_data.get();
+    }
+
+    /// @brief Returns the memory resource that the shared storage was allocated from,
+    /// which determines how long the identity remains valid.
+    [[nodiscard]]
+    std::pmr::memory_resource* get_memory_resource() const noexcept
+    {
+        return m_data->memory;
+    }
 };
 
 struct Text final {
 private:
-    File_Source_Span8 m_source_span;
-    std::u8string_view m_source;
+    // The members of the source span are stored individually
+    // so that the flags can be packed into the length.
+    Source_Position m_position;
+    std::u8string_view m_file_name;
+    const char8_t* m_source;
+    std::size_t m_length : std::numeric_limits<std::size_t>::digits - 2;
+    std::size_t m_needs_html_escaping : 1;
+    std::size_t m_contains_blank_line : 1;
 
 public:
+    /// @brief The greatest supported length of text.
+    static constexpr std::size_t max_length = std::numeric_limits<std::size_t>::max() >> 2;
+
+    /// @brief Constructs text spanning `source_span`, with the given `source`.
+    /// `needs_html_escaping` can be `false` only if `source` contains none of `&`, `<`, `>`.
+    /// `contains_blank_line` can be `false` only if `find_blank_line_sequence(source)` is empty.
     [[nodiscard]]
-    Text(const File_Source_Span8& source_span, std::u8string_view source);
+    Text(
+        const File_Source_Span8& source_span,
+        std::u8string_view source,
+        bool needs_html_escaping = true,
+        bool contains_blank_line = true
+    );
 
     [[nodiscard]]
     File_Source_Span8 get_source_span() const
     {
-        return m_source_span;
+        return { m_position, m_length, m_file_name };
     }
 
     [[nodiscard]]
     std::u8string_view get_source() const
     {
-        return m_source;
+        return { m_source, m_length };
+    }
+
+    /// @brief Returns `true` if the source may contain characters that need to be escaped
+    /// when written as HTML text.
+    /// If `false`, the source can be written to HTML as is.
+    [[nodiscard]]
+    bool needs_html_escaping() const
+    {
+        return m_needs_html_escaping != 0;
+    }
+
+    /// @brief Returns `true` if the source may contain a blank line.
+    /// If `false`, the text cannot separate paragraphs,
+    /// and there is no need to search it for blank lines.
+    [[nodiscard]]
+    bool contains_blank_line() const
+    {
+        return m_contains_blank_line != 0;
     }
 };
 
@@ -176,7 +298,8 @@ public:
 struct Escaped final {
 private:
     File_Source_Span8 m_source_span;
-    std::u8string_view m_source;
+    // The length of the source is that of the source span.
+    const char8_t* m_source;
 
 public:
     [[nodiscard]]
@@ -194,14 +317,14 @@ public:
     [[nodiscard]]
     std::u8string_view get_source() const
     {
-        return m_source;
+        return { m_source, m_source_span.length };
     }
 
     /// @brief Returns the escaped character.
     [[nodiscard]]
     char8_t get_char() const
     {
-        COWEL_DEBUG_ASSERT(m_source.size() >= 2);
+        COWEL_DEBUG_ASSERT(m_source_span.length >= 2);
         return m_source[1];
     }
 
@@ -217,39 +340,99 @@ enum struct Generated_Type : bool { plaintext, html };
 
 struct Generated final {
 private:
-    std::pmr::vector<char8_t> m_data;
+    /// @brief The user-written content that generated content replaces.
+    struct Origin {
+        File_Source_Span8 source_span;
+        std::u8string_view source;
+    };
+
+    // Points either into m_owned, or into a buffer that outlives this node.
+    std::u8string_view m_data;
+    // Stored out-of-line so that the data does not move when the node is moved,
+    // and so that copies share the data.
+    std::shared_ptr<const std::pmr::vector<char8_t>> m_owned;
     Generated_Type m_type;
     Directive_Display m_display;
+    // Stored out-of-line because most generated content has no origin.
+    std::shared_ptr<const Origin> m_origin;
 
 public:
+    /// @brief Constructs generated content which owns `data`.
     [[nodiscard]]
     explicit Generated(
         std::pmr::vector<char8_t>&& data,
         Generated_Type type,
         Directive_Display display
     )
-        : m_data { std::move(data) }
+        : m_type { type }
+        , m_display { display }
+    {
+        if (!data.empty()) {
+            const std::pmr::polymorphic_allocator<> alloc { data.get_allocator().resource() };
+            m_owned = std::allocate_shared<const std::pmr::vector<char8_t>>(alloc, std::move(data));
+            m_data = { m_owned->data(), m_owned->size() };
+        }
+    }
+
+    /// @brief Constructs generated content which refers to `data` without owning it.
+    /// This allows many nodes to share one large buffer,
+    /// but the buffer has to outlive this node and all of its copies.
+    [[nodiscard]]
+    explicit Generated(std::u8string_view data, Generated_Type type, Directive_Display display)
+        : m_data { data }
         , m_type { type }
         , m_display { display }
     {
     }
 
+    /// @brief Constructs generated content which replaces some user-written content,
+    /// such as a directive whose output was computed ahead of time.
+    /// `source_span` and `source` are those of the replaced content,
+    /// so that diagnostics and literal processing still refer to the original source.
     [[nodiscard]]
-    constexpr Generated_Type get_type() const
+    explicit Generated(
+        std::pmr::vector<char8_t>&& data,
+        Generated_Type type,
+        Directive_Display display,
+        const File_Source_Span8& source_span,
+        std::u8string_view source
+    )
+        : Generated { std::move(data), type, display }
     {
-        return m_type;
+        // The allocator of a moved-from vector is unchanged.
+        const std::pmr::polymorphic_allocator<> alloc { data.get_allocator().resource() };
+        m_origin = std::allocate_shared<const Origin>(alloc, Origin { source_span, source });
     }
 
+    /// @brief Returns the source span of the content that this replaces,
+    /// or `std::nullopt` if this content was not produced from any particular source.
     [[nodiscard]]
-    constexpr Directive_Display get_display() const
+    std::optional<File_Source_Span8> get_source_span() const
     {
-        return m_display;
+        if (!m_origin) {
+            return {};
+        }
+        return m_origin->source_span;
     }
 
+    /// @brief Returns the source code of the content that this replaces,
+    /// or an empty string if there is none.
     [[nodiscard]]
-    constexpr std::span<char8_t> as_span()
+    std::u8string_view get_source() const
     {
-        return m_data;
+        return m_origin ? m_origin->source : std::u8string_view {};
+    }
+
+    [[nodiscard]]
+    constexpr Generated_Type get_type() const
+    {
+        return m_type;
+    }
+
+    [[nodiscard]]
+    constexpr Directive_Display get_display() const
+    {
+        return m_display;
     }
 
     [[nodiscard]]
@@ -261,7 +444,7 @@ public:
     [[nodiscard]]
     constexpr std::u8string_view as_string() const
     {
-        return { m_data.data(), m_data.size() };
+        return m_data;
     }
 
     [[nodiscard]]
@@ -289,6 +472,9 @@ struct Content : Content_Variant {
     using Content_Variant::variant;
 };
 
+// Directives are stored out-of-line so that they do not dominate the size of content.
+static_assert(sizeof(Directive) <= sizeof(Text));
+
 static_assert(std::is_move_constructible_v<Content>);
 static_assert(std::is_move_constructible_v<Content>);
 static_assert(std::is_copy_assignable_v<Content>);
@@ -309,35 +495,36 @@ inline Directive& Directive::operator=(const Directive&) = default;
 inline Directive::~Directive() = default;
 // NOLINTEND(readability-redundant-inline-specifier)
 
-inline std::pmr::vector<Content>& Argument::get_content() &
-{
-    return m_content;
-}
-inline std::span<const Content> Argument::get_content() const&
-{
-    return m_content;
-}
-inline std::pmr::vector<Content>&& Argument::get_content() &&
+template <typename T>
+Shared_Nodes<T>::Shared_Nodes(std::pmr::vector<T>&& nodes)
 {
-    return std::move(m_content);
+    if (!nodes.empty()) {
+        const std::pmr::polymorphic_allocator<> alloc { nodes.get_allocator().resource() };
+        m_nodes = std::allocate_shared<const std::pmr::vector<T>>(alloc, std::move(nodes));
+    }
 }
 
-inline std::pmr::vector<Argument>& Directive::get_arguments()
+template <typename T>
+std::span<const T> Shared_Nodes<T>::get() const noexcept
 {
-    return m_arguments;
+    if (!m_nodes) {
+        return {};
+    }
+    return *m_nodes;
 }
-inline std::span<const Argument> Directive::get_arguments() const
+
+inline std::span<const Content> Argument::get_content() const
 {
-    return m_arguments;
+    return m_content.get();
 }
 
-inline std::pmr::vector<Content>& Directive::get_content()
+inline std::span<const Argument> Directive::get_arguments() const
 {
-    return m_content;
+    return m_data->arguments.get();
 }
 inline std::span<Content const> Directive::get_content() const
 {
-    return m_content;
+    return m_data->content.get();
 }
 
 [[nodiscard]]
@@ -349,7 +536,7 @@ inline File_Source_Span8 get_source_span(const Content& node, std::u8string_view
                 return v.get_source_span();
             }
             else {
-                return { {}, fallback_file };
+                return v.get_source_span().value_or(File_Source_Span8 { {}, fallback_file });
             }
         },
         node
@@ -360,14 +547,7 @@ inline File_Source_Span8 get_source_span(const Content& node, std::u8string_view
 inline std::u8string_view get_source(const Content& node)
 {
     return visit(
-        []<typename T>(const T& v) -> std::u8string_view {
-            if constexpr (user_written<T>) {
-                return v.get_source();
-            }
-            else {
-                return {};
-            }
-        },
+        []<typename T>(const T& v) -> std::u8string_view { return v.get_source(); },
         node
     );
 }
@@ -418,7 +598,8 @@ struct Visitor_Impl {
     virtual void visit(Escaped_Type& text) = 0;
 };
 
-using Visitor = Visitor_Impl<false>;
+// AST nodes are immutable because they share their children,
+// so only a constant visitor is provided.
 using Const_Visitor = Visitor_Impl<true>;
 
 } // namespace cowel::ast
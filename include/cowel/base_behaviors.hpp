@@ -12,8 +12,11 @@ namespace cowel {
 
 struct Pure_HTML_Behavior : Directive_Behavior {
 
-    constexpr Pure_HTML_Behavior(Directive_Display display)
-        : Directive_Behavior { Directive_Category::pure_html, display }
+    constexpr Pure_HTML_Behavior(
+        Directive_Display display,
+        Directive_Purity purity = Directive_Purity::impure
+    )
+        : Directive_Behavior { Directive_Category::pure_html, display, purity }
     {
     }
 
@@ -24,8 +27,11 @@ struct Pure_HTML_Behavior : Directive_Behavior {
 
 struct Pure_Plaintext_Behavior : Directive_Behavior {
 
-    constexpr Pure_Plaintext_Behavior(Directive_Display display)
-        : Directive_Behavior { Directive_Category::pure_plaintext, display }
+    constexpr Pure_Plaintext_Behavior(
+        Directive_Display display,
+        Directive_Purity purity = Directive_Purity::impure
+    )
+        : Directive_Behavior { Directive_Category::pure_plaintext, display, purity }
     {
     }
 
@@ -92,13 +98,13 @@ struct Do_Nothing_Behavior : Directive_Behavior {
 
 struct Parametric_Behavior : Directive_Behavior {
 protected:
-    const std::span<const std::u8string_view> m_parameters;
+    const Parameter_Schema& m_parameters;
 
 public:
     constexpr Parametric_Behavior(
         Directive_Category c,
         Directive_Display d,
-        std::span<const std::u8string_view> parameters
+        const Parameter_Schema& parameters
     )
         : Directive_Behavior { c, d }
         , m_parameters { parameters }
@@ -109,14 +115,14 @@ public:
     generate_plaintext(std::pmr::vector<char8_t>& out, const ast::Directive& d, Context& context)
         const override
     {
-        Argument_Matcher args { m_parameters, context.get_transient_memory() };
+        Argument_Matcher args { m_parameters };
         args.match(d.get_arguments());
         generate_plaintext(out, d, args, context);
     }
 
     void generate_html(HTML_Writer& out, const ast::Directive& d, Context& context) const override
     {
-        Argument_Matcher args { m_parameters, context.get_transient_memory() };
+        Argument_Matcher args { m_parameters };
         args.match(d.get_arguments());
         generate_html(out, d, args, context);
     }
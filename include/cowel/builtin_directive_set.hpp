@@ -37,7 +37,8 @@ struct Error_Behavior : Do_Nothing_Behavior {
 struct [[nodiscard]]
 HTML_Entity_Behavior final : Directive_Behavior {
     constexpr HTML_Entity_Behavior()
-        : Directive_Behavior { Directive_Category::pure_plaintext, Directive_Display::in_line }
+        : Directive_Behavior { Directive_Category::pure_plaintext, Directive_Display::in_line,
+                               Directive_Purity::pure }
     {
     }
 
@@ -51,7 +52,8 @@ HTML_Entity_Behavior final : Directive_Behavior {
 struct [[nodiscard]] Code_Point_Behavior : Directive_Behavior {
 
     constexpr explicit Code_Point_Behavior()
-        : Directive_Behavior { Directive_Category::pure_plaintext, Directive_Display::in_line }
+        : Directive_Behavior { Directive_Category::pure_plaintext, Directive_Display::in_line,
+                               Directive_Purity::pure }
     {
     }
 
@@ -82,7 +84,7 @@ struct [[nodiscard]]
 Code_Point_Digits_Behavior final : Pure_Plaintext_Behavior {
 
     constexpr Code_Point_Digits_Behavior()
-        : Pure_Plaintext_Behavior { Directive_Display::in_line }
+        : Pure_Plaintext_Behavior { Directive_Display::in_line, Directive_Purity::pure }
     {
     }
 
@@ -97,7 +99,8 @@ inline constexpr std::u8string_view lorem_ipsum = u8"Lorem ipsum dolor sit amet,
 
 struct Lorem_Ipsum_Behavior final : Directive_Behavior {
     constexpr Lorem_Ipsum_Behavior()
-        : Directive_Behavior { Directive_Category::pure_plaintext, Directive_Display::in_line }
+        : Directive_Behavior { Directive_Category::pure_plaintext, Directive_Display::in_line,
+                               Directive_Purity::pure }
     {
     }
 
@@ -130,6 +133,7 @@ private:
         suffix_parameter,
     };
     // clang-format on
+    static constexpr Parameter_Schema schema { parameters };
 
     const std::u8string_view m_tag_name;
     const To_HTML_Mode m_to_html_mode;
@@ -140,7 +144,7 @@ public:
         Directive_Display d,
         To_HTML_Mode mode
     )
-        : Parametric_Behavior { Directive_Category::pure_html, d, parameters }
+        : Parametric_Behavior { Directive_Category::pure_html, d, schema }
         , m_tag_name { tag_name }
         , m_to_html_mode { mode }
     {
@@ -163,11 +167,12 @@ struct [[nodiscard]] Highlight_Behavior : Parametric_Behavior {
 private:
     static constexpr std::u8string_view name_parameter = u8"name";
     static constexpr std::u8string_view parameters[] { name_parameter };
+    static constexpr Parameter_Schema schema { parameters };
 
 public:
     constexpr explicit Highlight_Behavior()
         : Parametric_Behavior { Directive_Category::pure_html, Directive_Display::in_line,
-                                parameters }
+                                schema }
     {
     }
 
@@ -186,7 +191,7 @@ public:
 struct Literally_Behavior : Pure_Plaintext_Behavior {
 
     constexpr explicit Literally_Behavior(Directive_Display display)
-        : Pure_Plaintext_Behavior { display }
+        : Pure_Plaintext_Behavior { display, Directive_Purity::pure }
     {
     }
 
@@ -198,7 +203,7 @@ struct Literally_Behavior : Pure_Plaintext_Behavior {
 struct Unprocessed_Behavior : Pure_Plaintext_Behavior {
 
     constexpr explicit Unprocessed_Behavior(Directive_Display display)
-        : Pure_Plaintext_Behavior { display }
+        : Pure_Plaintext_Behavior { display, Directive_Purity::pure }
     {
     }
 
@@ -210,7 +215,7 @@ struct Unprocessed_Behavior : Pure_Plaintext_Behavior {
 struct HTML_Literal_Behavior : Pure_HTML_Behavior {
 
     constexpr explicit HTML_Literal_Behavior(Directive_Display display)
-        : Pure_HTML_Behavior { display }
+        : Pure_HTML_Behavior { display, Directive_Purity::pure }
     {
     }
 
@@ -232,7 +237,7 @@ private:
 
 public:
     constexpr explicit HTML_Raw_Text_Behavior(std::u8string_view tag_name)
-        : Pure_HTML_Behavior { Directive_Display::block }
+        : Pure_HTML_Behavior { Directive_Display::block, Directive_Purity::pure }
         , m_tag_name { tag_name }
     {
         COWEL_ASSERT(tag_name == u8"style" || tag_name == u8"script");
@@ -244,9 +249,10 @@ public:
 struct Variable_Behavior : Parametric_Behavior {
     static constexpr std::u8string_view var_parameter = u8"var";
     static constexpr std::u8string_view parameters[] { var_parameter };
+    static constexpr Parameter_Schema schema { parameters };
 
     constexpr Variable_Behavior(Directive_Category c, Directive_Display d)
-        : Parametric_Behavior { c, d, parameters }
+        : Parametric_Behavior { c, d, schema }
     {
     }
 
@@ -301,13 +307,17 @@ private:
 
 public:
     constexpr explicit Expression_Behavior(Expression_Type type)
-        : Pure_Plaintext_Behavior { Directive_Display::in_line }
+        : Pure_Plaintext_Behavior { Directive_Display::in_line, Directive_Purity::pure }
         , m_type { type }
     {
     }
 
     void generate_plaintext(std::pmr::vector<char8_t>& out, const ast::Directive&, Context& context)
         const final;
+
+    [[nodiscard]]
+    Integer_Evaluation evaluate_integer(long long& out, const ast::Directive&, Context& context)
+        const final;
 };
 
 struct Get_Variable_Behavior final : Variable_Behavior {
@@ -317,6 +327,10 @@ struct Get_Variable_Behavior final : Variable_Behavior {
     {
     }
 
+    [[nodiscard]]
+    Integer_Evaluation evaluate_integer(long long& out, const ast::Directive&, Context& context)
+        const final;
+
     void generate_var_plaintext(
         std::pmr::vector<char8_t>& out,
         const ast::Directive&,
@@ -386,7 +400,7 @@ public:
         Directive_Display display,
         To_HTML_Mode to_html_mode
     )
-        : Directive_Behavior { category, display }
+        : Directive_Behavior { category, display, Directive_Purity::pure }
         , m_to_html_mode { to_html_mode }
     {
     }
@@ -401,7 +415,7 @@ public:
 struct Plaintext_Wrapper_Behavior : Pure_Plaintext_Behavior {
 
     constexpr explicit Plaintext_Wrapper_Behavior(Directive_Display display)
-        : Pure_Plaintext_Behavior(display)
+        : Pure_Plaintext_Behavior(display, Directive_Purity::pure)
     {
     }
 
@@ -413,7 +427,7 @@ struct Plaintext_Wrapper_Behavior : Pure_Plaintext_Behavior {
 struct Trim_Behavior : Directive_Behavior {
 
     constexpr explicit Trim_Behavior(Directive_Category category, Directive_Display display)
-        : Directive_Behavior { category, display }
+        : Directive_Behavior { category, display, Directive_Purity::pure }
     {
     }
 
@@ -427,7 +441,7 @@ struct Trim_Behavior : Directive_Behavior {
 struct Passthrough_Behavior : Directive_Behavior {
 
     constexpr Passthrough_Behavior(Directive_Category category, Directive_Display display)
-        : Directive_Behavior { category, display }
+        : Directive_Behavior { category, display, Directive_Purity::pure }
     {
         COWEL_ASSERT(
             category == Directive_Category::formatting || category == Directive_Category::pure_html
@@ -458,7 +472,7 @@ public:
         Directive_Category category,
         Directive_Display display
     )
-        : Directive_Behavior { category, display }
+        : Directive_Behavior { category, display, Directive_Purity::pure }
         , m_tag_name { tag_name }
         , m_class_name { class_name }
     {
@@ -482,7 +496,7 @@ private:
 
 public:
     constexpr Self_Closing_Behavior(std::u8string_view tag_name, Directive_Display display)
-        : Pure_HTML_Behavior { display }
+        : Pure_HTML_Behavior { display, Directive_Purity::pure }
         , m_tag_name { tag_name }
     {
     }
@@ -547,7 +561,7 @@ private:
 
 public:
     constexpr explicit Special_Block_Behavior(std::u8string_view name, bool emit_intro = true)
-        : Pure_HTML_Behavior { Directive_Display::block }
+        : Pure_HTML_Behavior { Directive_Display::block, Directive_Purity::pure }
         , m_name { name }
         , m_emit_intro { emit_intro }
     {
@@ -704,9 +718,17 @@ struct Macro_Define_Behavior final : Meta_Behavior {
     void evaluate(const ast::Directive& d, Context& context) const final;
 };
 
+/// @brief Behavior for directives which instantiate a macro defined via `\\macro`.
+///
+/// If the macro expands to the same content regardless of its arguments and content,
+/// and if the expansion consists only of pure directives (see `Directive_Behavior::is_pure`),
+/// the generated HTML is memoized in the `Macro_Template`,
+/// and subsequent instantiations emit the memoized HTML directly.
 struct Macro_Instantiate_Behavior final : Instantiated_Behavior {
 
     void instantiate(std::pmr::vector<ast::Content>&, const ast::Directive&, Context&) const final;
+
+    void generate_html(HTML_Writer& out, const ast::Directive&, Context&) const final;
 };
 
 struct [[nodiscard]]
@@ -0,0 +1,66 @@
+#ifndef COWEL_COMPRESSION_HPP
+#define COWEL_COMPRESSION_HPP
+
+#include <memory>
+#include <memory_resource>
+#include <string_view>
+
+#include "cowel/util/assert.hpp"
+
+#include "cowel/fwd.hpp"
+#include "cowel/services.hpp"
+
+namespace cowel {
+
+enum struct Compression : Default_Underlying {
+    /// @brief The gzip format, produced using zlib.
+    gzip,
+    /// @brief The Zstandard format, produced using libzstd.
+    zstd,
+};
+
+/// @brief Returns the file extension that is conventionally appended to the name of
+/// files compressed with `compression`, including the leading `.`.
+[[nodiscard]]
+constexpr std::u8string_view compression_file_extension(Compression compression)
+{
+    switch (compression) {
+    case Compression::gzip: return u8".gz";
+    case Compression::zstd: return u8".zst";
+    }
+    COWEL_ASSERT_UNREACHABLE(u8"Invalid compression.");
+}
+
+/// @brief Returns `true` if support for `compression` was enabled at build time.
+/// See the `COWEL_GZIP` and `COWEL_ZSTD` CMake options.
+[[nodiscard]]
+bool is_compression_supported(Compression compression) noexcept;
+
+/// @brief An `Output_Sink` which compresses the text written to it,
+/// and writes the compressed bytes to another sink as they become available.
+/// Since generation writes to sinks while the document is assembled,
+/// compression takes place during generation rather than in a separate pass.
+struct Compressing_Output_Sink : Output_Sink {
+    virtual ~Compressing_Output_Sink() = default;
+
+    /// @brief Compresses any remaining input and ends the compressed stream.
+    /// No more text should be written afterwards.
+    /// @returns `true` if compression succeeded, both in this call and in any previous writes.
+    [[nodiscard]]
+    virtual bool finish() = 0;
+};
+
+/// @brief Creates a sink which compresses text using `compression` and writes the result to `out`.
+/// @param memory The memory used for buffering output.
+/// @returns The sink, or null if `compression` is not supported (see `is_compression_supported`)
+/// or if the compressor could not be initialized.
+[[nodiscard]]
+std::unique_ptr<Compressing_Output_Sink> make_compressing_output_sink(
+    Compression compression,
+    Output_Sink& out,
+    std::pmr::memory_resource* memory
+);
+
+} // namespace cowel
+
+#endif
@@ -1,13 +1,18 @@
 #ifndef COWEL_CONTEXT_HPP
 #define COWEL_CONTEXT_HPP
 
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
 #include <memory_resource>
 #include <string>
 #include <string_view>
 #include <unordered_map>
 #include <utility>
+#include <variant>
 #include <vector>
 
+#include "cowel/util/arena.hpp"
 #include "cowel/util/assert.hpp"
 #include "cowel/util/transparent_comparison.hpp"
 #include "cowel/util/typo.hpp"
@@ -15,6 +20,9 @@
 #include "cowel/diagnostic.hpp"
 #include "cowel/document_sections.hpp"
 #include "cowel/fwd.hpp"
+#include "cowel/macro_profile.hpp"
+#include "cowel/macro_template.hpp"
+#include "cowel/plaintext_memo.hpp"
 #include "cowel/services.hpp"
 
 namespace cowel {
@@ -48,26 +56,102 @@ public:
     using string_type = std::pmr::u8string;
     using string_view_type = std::u8string_view;
 
+    /// @brief The value of a variable.
+    /// Integers (such as the results of `\\Cadd`) are stored as such,
+    /// so that they can be used in further arithmetic without being converted to and from text.
+    using Variable_Value = std::variant<string_type, long long>;
     using Variable_Map = std::pmr::unordered_map<
         string_type,
-        string_type,
+        Variable_Value,
         Transparent_String_View_Hash8,
         Transparent_String_View_Equals8>;
     using Macro_Map = std::pmr::unordered_map<
         std::pmr::u8string,
-        const ast::Directive*,
+        Macro_Template,
         Transparent_String_View_Hash8,
         Transparent_String_View_Equals8>;
+    using Plaintext_Memo_Map = std::pmr::
+        unordered_map<Plaintext_Memo_Key, Plaintext_Memo_Entry, Plaintext_Memo_Key_Hash>;
+    /// @brief Maps the identity of a directive (see `ast::Directive::identity`)
+    /// onto the result of `is_pure_directive`.
+    using Purity_Memo_Map = std::pmr::unordered_map<const void*, bool>;
     using ID_Map = std::pmr::unordered_map<
         std::pmr::u8string,
         Referred,
         Transparent_String_View_Hash8,
         Transparent_String_View_Equals8>;
 
+    /// @brief Tracks the expansion of a macro (or other instantiated directive),
+    /// including the processing of the expanded content.
+    /// Upon destruction, the macro nesting depth is decremented,
+    /// and if a `Macro_Profile` is set, the elapsed time is recorded.
+    struct [[nodiscard]] Scoped_Macro_Expansion {
+    private:
+        friend Context;
+
+        Context& self;
+        Macro_Statistics* statistics;
+        std::chrono::steady_clock::time_point start;
+
+        Scoped_Macro_Expansion(Context& self, Macro_Statistics* statistics)
+            : self { self }
+            , statistics { statistics }
+            , start { statistics ? std::chrono::steady_clock::now()
+                                 : std::chrono::steady_clock::time_point {} }
+        {
+        }
+
+    public:
+        Scoped_Macro_Expansion(const Scoped_Macro_Expansion&) = delete;
+        Scoped_Macro_Expansion& operator=(const Scoped_Macro_Expansion&) = delete;
+
+        ~Scoped_Macro_Expansion()
+        {
+            --self.m_macro_depth;
+            if (statistics) {
+                statistics->time += std::chrono::steady_clock::now() - start;
+            }
+        }
+    };
+
+    /// @brief While alive, `get_transient_memory()` returns an arena,
+    /// and all memory allocated from it is released at once when the scope ends.
+    /// See `enter_transient_arena_scoped`.
+    struct [[nodiscard]] Scoped_Transient_Arena {
+    private:
+        friend Context;
+
+        Context& self;
+        bool active;
+        Arena_Memory_Resource::Marker marker;
+
+        Scoped_Transient_Arena(Context& self, bool active)
+            : self { self }
+            , active { active }
+            , marker { self.m_transient_arena.mark() }
+        {
+        }
+
+    public:
+        Scoped_Transient_Arena(const Scoped_Transient_Arena&) = delete;
+        Scoped_Transient_Arena& operator=(const Scoped_Transient_Arena&) = delete;
+
+        ~Scoped_Transient_Arena()
+        {
+            if (active) {
+                self.m_in_transient_arena = false;
+                self.m_transient_arena.rewind(marker);
+            }
+        }
+    };
+
 private:
     /// @brief Additional memory used during processing.
     std::pmr::memory_resource* m_memory;
     std::pmr::memory_resource* m_transient_memory;
+    /// @brief Used as transient memory within a `Scoped_Transient_Arena`.
+    Arena_Memory_Resource m_transient_arena { m_transient_memory };
+    bool m_in_transient_arena = false;
     /// @brief JSON source code of the syntax highlighting theme.
     string_view_type m_highlight_theme_source;
     /// @brief A list of (non-null) name resolvers.
@@ -80,6 +164,10 @@ private:
     /// to information about the reference.
     ID_Map m_id_references { m_transient_memory };
     Macro_Map m_macros { m_transient_memory };
+    std::size_t m_macro_generation = 0;
+    Plaintext_Memo_Map m_plaintext_memo { m_transient_memory };
+    Plaintext_Memo_Statistics m_plaintext_memo_statistics;
+    Purity_Memo_Map m_purity_memo { m_transient_memory };
     Directive_Behavior* m_error_behavior;
 
     File_Loader& m_file_loader;
@@ -89,6 +177,15 @@ private:
 
     Document_Sections m_sections { m_memory };
     Variable_Map m_variables { m_memory };
+    std::size_t m_emitted_diagnostics = 0;
+
+    Macro_Budget m_macro_budget;
+    Macro_Profile* m_macro_profile = nullptr;
+    Memory_Profile* m_memory_profile = nullptr;
+    Output_Sink* m_output_sink = nullptr;
+    std::size_t m_macro_depth = 0;
+    std::size_t m_macro_expanded_nodes = 0;
+    bool m_macro_budget_exceeded = false;
 
 public:
     /// @brief Constructs a new context.
@@ -185,13 +282,13 @@ public:
     }
 
     [[nodiscard]]
-    string_type* get_variable(string_view_type key)
+    Variable_Value* get_variable(string_view_type key)
     {
         const auto it = m_variables.find(key);
         return it == m_variables.end() ? nullptr : &it->second;
     }
     [[nodiscard]]
-    const string_type* get_variable(string_view_type key) const
+    const Variable_Value* get_variable(string_view_type key) const
     {
         const auto it = m_variables.find(key);
         return it == m_variables.end() ? nullptr : &it->second;
@@ -209,6 +306,17 @@ public:
         return m_sections;
     }
 
+    /// @brief Returns `true` if `memory` is the transient memory or the transient arena
+    /// (see `get_transient_memory`).
+    /// Memory obtained from these may be released and reused during generation,
+    /// whereas any other memory (such as the memory of the document's AST)
+    /// outlives this object.
+    [[nodiscard]]
+    bool is_transient_memory(const std::pmr::memory_resource* memory) const noexcept
+    {
+        return memory == m_transient_memory || memory == &m_transient_arena;
+    }
+
     /// @brief Returns a memory resource that the `Context` has been constructed with.
     /// This may possibly persist beyond the destruction of the context.
     ///
@@ -223,10 +331,38 @@ public:
     /// @brief Returns a memory resource that is destroyed with this object.
     /// Note that contexts are destroyed after each pass, so this should only be used for
     /// temporary memory.
+    ///
+    /// Within a `Scoped_Transient_Arena`, this returns an arena instead,
+    /// so the memory must not be used beyond the end of the current directive.
     [[nodiscard]]
-    std::pmr::memory_resource* get_transient_memory() const
+    std::pmr::memory_resource* get_transient_memory()
     {
-        return m_transient_memory;
+        return m_in_transient_arena ? &m_transient_arena : m_transient_memory;
+    }
+
+    /// @brief Returns `true` if there is a `Scoped_Transient_Arena`.
+    [[nodiscard]]
+    bool is_in_transient_arena() const
+    {
+        return m_in_transient_arena;
+    }
+
+    /// @brief If `enable` is `true`, returns a `Scoped_Transient_Arena`,
+    /// and `get_transient_memory()` returns an arena until the end of the scope,
+    /// at which point all of its memory is released at once.
+    /// This is only valid if no memory allocated within the scope outlives it,
+    /// i.e. if processing has no side effects on the context.
+    ///
+    /// Arena scopes do not nest: if there already is one, this has no effect.
+    /// That way, containers created in an outer scope which grow within an inner scope
+    /// never end up holding memory that is released by the inner scope.
+    Scoped_Transient_Arena enter_transient_arena_scoped(bool enable = true)
+    {
+        const bool activate = enable && !m_in_transient_arena;
+        if (activate) {
+            m_in_transient_arena = true;
+        }
+        return Scoped_Transient_Arena { *this, activate };
     }
 
     [[nodiscard]]
@@ -259,9 +395,18 @@ public:
     void emit(const Diagnostic& diagnostic)
     {
         COWEL_ASSERT(emits(diagnostic.severity));
+        ++m_emitted_diagnostics;
         m_logger(diagnostic);
     }
 
+    /// @brief Returns the total amount of diagnostics that have been emitted so far.
+    /// This can be used to determine whether some operation emitted any diagnostics.
+    [[nodiscard]]
+    std::size_t get_emitted_diagnostic_count() const
+    {
+        return m_emitted_diagnostics;
+    }
+
     void emit(
         Severity severity,
         string_view_type id,
@@ -418,6 +563,9 @@ public:
     void add_resolver(const Name_Resolver& resolver)
     {
         m_name_resolvers.push_back(&resolver);
+        // Memoized plaintext and purity may depend on the resolution of names.
+        m_plaintext_memo.clear();
+        m_purity_memo.clear();
     }
 
     /// @brief Finds a directive behavior using `name_resolvers` in reverse order.
@@ -445,18 +593,172 @@ public:
     }
 
     [[nodiscard]]
-    const ast::Directive* find_macro(std::u8string_view id) const
+    const Macro_Budget& get_macro_budget() const
+    {
+        return m_macro_budget;
+    }
+
+    void set_macro_budget(const Macro_Budget& budget)
+    {
+        m_macro_budget = budget;
+    }
+
+    /// @brief Returns the profile in which statistics about macro expansions are collected,
+    /// or null if macro expansions are not profiled.
+    [[nodiscard]]
+    Macro_Profile* get_macro_profile() const
+    {
+        return m_macro_profile;
+    }
+
+    void set_macro_profile(Macro_Profile* profile)
+    {
+        m_macro_profile = profile;
+    }
+
+    /// @brief Returns the profile in which memory usage is broken down by phase,
+    /// or null if memory usage is not profiled.
+    [[nodiscard]]
+    Memory_Profile* get_memory_profile() const
+    {
+        return m_memory_profile;
+    }
+
+    void set_memory_profile(Memory_Profile* profile)
+    {
+        m_memory_profile = profile;
+    }
+
+    /// @brief Returns the sink to which the finished document is written,
+    /// or null if the document is written to the `HTML_Writer` passed to the root behavior.
+    [[nodiscard]]
+    Output_Sink* get_output_sink() const
+    {
+        return m_output_sink;
+    }
+
+    void set_output_sink(Output_Sink* sink)
+    {
+        m_output_sink = sink;
+    }
+
+    /// @brief Returns the current nesting depth of macro expansions.
+    [[nodiscard]]
+    std::size_t get_macro_depth() const
+    {
+        return m_macro_depth;
+    }
+
+    /// @brief Returns the total amount of nodes produced by macro expansions so far.
+    [[nodiscard]]
+    std::size_t get_macro_expanded_nodes() const
+    {
+        return m_macro_expanded_nodes;
+    }
+
+    /// @brief Returns `true` if the `Macro_Budget` has been exceeded at some point.
+    /// This is used to diagnose exceeding the budget only once.
+    [[nodiscard]]
+    bool is_macro_budget_exceeded() const
+    {
+        return m_macro_budget_exceeded;
+    }
+
+    void set_macro_budget_exceeded()
+    {
+        m_macro_budget_exceeded = true;
+    }
+
+    /// @brief Increments the macro nesting depth, counts an expansion of the macro
+    /// named `name` and returns a `Scoped_Macro_Expansion` which,
+    /// upon destruction, decrements the depth again.
+    /// This should be kept alive while the expanded content is being processed.
+    Scoped_Macro_Expansion enter_macro_scoped(string_view_type name)
+    {
+        ++m_macro_depth;
+        Macro_Statistics* statistics = nullptr;
+        if (m_macro_profile) {
+            statistics = &(*m_macro_profile)[name];
+            ++statistics->expansions;
+            statistics->max_depth = std::max(statistics->max_depth, m_macro_depth);
+        }
+        return Scoped_Macro_Expansion { *this, statistics };
+    }
+
+    /// @brief Records that the expansion of the macro named `name` produced `nodes` nodes.
+    void add_macro_expanded_nodes(string_view_type name, std::size_t nodes)
+    {
+        m_macro_expanded_nodes += nodes;
+        if (m_macro_profile) {
+            (*m_macro_profile)[name].expanded_nodes += nodes;
+        }
+    }
+
+    [[nodiscard]]
+    Macro_Template* find_macro(std::u8string_view id)
     {
         const auto it = m_macros.find(id);
-        return it == m_macros.end() ? nullptr : it->second;
+        return it == m_macros.end() ? nullptr : &it->second;
     }
 
     [[nodiscard]]
-    bool emplace_macro(std::pmr::u8string&& id, const ast::Directive* definition_directive)
+    const Macro_Template* find_macro(std::u8string_view id) const
     {
-        const auto [it, success] = m_macros.try_emplace(std::move(id), definition_directive);
+        const auto it = m_macros.find(id);
+        return it == m_macros.end() ? nullptr : &it->second;
+    }
+
+    [[nodiscard]]
+    bool emplace_macro(std::pmr::u8string&& id, Macro_Template&& definition)
+    {
+        const auto [it, success] = m_macros.try_emplace(std::move(id), std::move(definition));
+        if (success) {
+            // A new macro can change how names within other macros are resolved,
+            // so any memoized HTML, plaintext, or purity may no longer be correct.
+            // Rather than resetting the memo of every macro (which would take quadratic time
+            // for a document that defines many macros),
+            // the memoized HTML of macros is invalidated by starting a new generation.
+            ++m_macro_generation;
+            m_plaintext_memo.clear();
+            m_purity_memo.clear();
+        }
         return success;
     }
+
+    /// @brief Returns a number which is incremented whenever a macro is defined.
+    /// See `Macro_Template::memo_generation`.
+    [[nodiscard]]
+    std::size_t get_macro_generation() const noexcept
+    {
+        return m_macro_generation;
+    }
+
+    /// @brief Returns the memoized plaintext of pure content.
+    /// See `to_plaintext_memoized`.
+    [[nodiscard]]
+    Plaintext_Memo_Map& get_plaintext_memo()
+    {
+        return m_plaintext_memo;
+    }
+
+    /// @brief Returns the memoized purity of directives.
+    /// See `is_pure_directive`.
+    [[nodiscard]]
+    Purity_Memo_Map& get_purity_memo()
+    {
+        return m_purity_memo;
+    }
+
+    [[nodiscard]]
+    Plaintext_Memo_Statistics& get_plaintext_memo_statistics()
+    {
+        return m_plaintext_memo_statistics;
+    }
+    [[nodiscard]]
+    const Plaintext_Memo_Statistics& get_plaintext_memo_statistics() const
+    {
+        return m_plaintext_memo_statistics;
+    }
 };
 
 } // namespace cowel
@@ -73,6 +73,11 @@ inline constexpr std::u8string_view section_ref_not_found = u8"section-ref.not-f
 /// a reference to a section forms a circular dependency.
 inline constexpr std::u8string_view section_ref_circular = u8"section-ref.circular";
 
+/// @brief In `\there` or `\here`,
+/// the name of a section is reserved for sections that are created internally,
+/// such as the fragments that hold the content of headings.
+inline constexpr std::u8string_view section_reserved = u8"section.reserved";
+
 /// @brief When loading a syntax highlighting theme,
 /// conversion from JSON to to CSS failed.
 inline constexpr std::u8string_view theme_conversion = u8"theme.conversion";
@@ -292,6 +297,16 @@ inline constexpr std::u8string_view pattern_no_directive = u8"macro:pattern.no-d
 /// the same macro was defined multiple times.
 inline constexpr std::u8string_view redefinition = u8"macro:redefinition";
 
+/// @brief When instantiating a macro,
+/// the maximum nesting depth of macro expansions was exceeded.
+/// This typically happens when a macro (indirectly) instantiates itself.
+inline constexpr std::u8string_view budget_depth = u8"macro:budget.depth";
+
+/// @brief When instantiating a macro,
+/// the maximum total amount of nodes produced by macro expansions was exceeded.
+/// This typically happens when macros expand exponentially.
+inline constexpr std::u8string_view budget_nodes = u8"macro:budget.nodes";
+
 } // namespace macro
 
 } // namespace diagnostic
@@ -1,11 +1,11 @@
 #ifndef COWEL_DIRECTIVE_ARGUMENTS_HPP
 #define COWEL_DIRECTIVE_ARGUMENTS_HPP
 
+#include <array>
 #include <cstddef>
-#include <memory_resource>
+#include <cstdint>
 #include <span>
 #include <string_view>
-#include <vector>
 
 #include "cowel/util/assert.hpp"
 
@@ -33,6 +33,90 @@ enum struct Parameter_Match_Mode : Default_Underlying {
     only_named,
 };
 
+/// @brief A precompiled set of parameter names for some directive.
+///
+/// The schema is meant to be constructed at compile time, typically as a `static constexpr`
+/// variable alongside the parameter names.
+/// During construction, a seed is searched for which makes a simple string hash
+/// collision-free over the given names,
+/// so that looking up a parameter by name costs one hash computation and one comparison.
+struct Parameter_Schema {
+    /// @brief The greatest amount of parameters that a schema can hold.
+    static constexpr std::size_t max_parameters = 16;
+    /// @brief The amount of slots in the hash table.
+    /// This must be a power of two, and should be considerably greater than `max_parameters`,
+    /// so that a collision-free seed can be found quickly.
+    static constexpr std::size_t table_size = 64;
+
+private:
+    static constexpr std::uint32_t max_seed = 1 << 16;
+
+    std::span<const std::u8string_view> m_parameters;
+    std::uint32_t m_seed = 0;
+    std::array<signed char, table_size> m_table {};
+
+public:
+    constexpr explicit Parameter_Schema(std::span<const std::u8string_view> parameters)
+        : m_parameters { parameters }
+    {
+        COWEL_ASSERT(parameters.size() <= max_parameters);
+        for (; m_seed < max_seed; ++m_seed) {
+            if (try_build_table()) {
+                return;
+            }
+        }
+        COWEL_ASSERT_UNREACHABLE(u8"No collision-free seed for parameter names.");
+    }
+
+    /// @brief Returns the index of the parameter with the given `name`,
+    /// or `-1` if there is no such parameter.
+    [[nodiscard]]
+    constexpr int index_of(std::u8string_view name) const noexcept
+    {
+        const signed char index = m_table[slot_of(name, m_seed)];
+        return index >= 0 && m_parameters[std::size_t(index)] == name ? int(index) : -1;
+    }
+
+    [[nodiscard]]
+    constexpr std::span<const std::u8string_view> parameters() const noexcept
+    {
+        return m_parameters;
+    }
+
+    [[nodiscard]]
+    constexpr std::size_t size() const noexcept
+    {
+        return m_parameters.size();
+    }
+
+private:
+    [[nodiscard]]
+    static constexpr std::size_t slot_of(std::u8string_view name, std::uint32_t seed) noexcept
+    {
+        // FNV-1a, with the seed mixed into the offset basis.
+        std::uint32_t hash = 2166136261u ^ seed;
+        for (const char8_t c : name) {
+            hash ^= std::uint32_t(c);
+            hash *= 16777619u;
+        }
+        return std::size_t(hash ^ (hash >> 16)) & (table_size - 1);
+    }
+
+    [[nodiscard]]
+    constexpr bool try_build_table() noexcept
+    {
+        m_table.fill(-1);
+        for (std::size_t i = 0; i < m_parameters.size(); ++i) {
+            signed char& entry = m_table[slot_of(m_parameters[i], m_seed)];
+            if (entry >= 0) {
+                return false;
+            }
+            entry = static_cast<signed char>(i);
+        }
+        return true;
+    }
+};
+
 /// @brief Matches a list of parameters to a list of arguments for some directive.
 ///
 /// First, any named arguments are matched to parameters with that name.
@@ -40,34 +124,33 @@ enum struct Parameter_Match_Mode : Default_Underlying {
 /// remaining parameters.
 /// @param out_indices for each parameter, stores the index of the matched argument, or `-1`
 /// if none could be matched
-/// @param out_status for each argument, the resulting status after matching
-/// @param parameters a span of parameter names
+/// @param parameters the parameter schema
 /// @param arguments a span of arguments, which could be named or unnamed
 /// @param mode the mode
 void match_parameters_and_arguments(
     std::span<int> out_indices,
-    std::span<Argument_Status> out_status,
-    std::span<const std::u8string_view> parameters,
+    const Parameter_Schema& parameters,
     std::span<const ast::Argument> arguments,
     Parameter_Match_Mode mode = Parameter_Match_Mode::normal
 );
 
 /// @brief Makes parameter/argument matching convenient for a fixed sequence of arguments.
+///
+/// The matcher never allocates:
+/// the matched index of each parameter is stored in a fixed-size array,
+/// and the status of each argument is derived from those indices on demand.
 struct [[nodiscard]] Argument_Matcher {
 private:
-    std::pmr::vector<Argument_Status> m_statuses;
-    std::pmr::vector<int> m_indices;
-    std::span<const std::u8string_view> m_parameters;
+    const Parameter_Schema* m_schema;
+    std::span<const ast::Argument> m_arguments;
+    Parameter_Match_Mode m_mode = Parameter_Match_Mode::normal;
+    std::array<int, Parameter_Schema::max_parameters> m_indices;
 
 public:
-    Argument_Matcher(
-        std::span<const std::u8string_view> parameters,
-        std::pmr::memory_resource* memory
-    )
-        : m_statuses { memory }
-        , m_indices { parameters.size(), memory }
-        , m_parameters { parameters }
+    explicit Argument_Matcher(const Parameter_Schema& parameters)
+        : m_schema { &parameters }
     {
+        m_indices.fill(-1);
     }
 
     /// @brief Matches a sequence of arguments using `match_parameters_and_arguments`.
@@ -77,22 +160,22 @@ public:
         Parameter_Match_Mode mode = Parameter_Match_Mode::normal
     )
     {
-        m_statuses.resize(arguments.size());
-        match_parameters_and_arguments(m_indices, m_statuses, m_parameters, arguments, mode);
+        m_arguments = arguments;
+        m_mode = mode;
+        match_parameters_and_arguments(parameter_indices_mut(), *m_schema, arguments, mode);
     }
 
     /// @brief Returns the matched argument index for the parameter with the given name,
     /// or `-1` if no argument matches.
-    /// The parameter name shall be one of the `parameters` passed into the constructor.
+    /// The parameter name shall be one of the `parameters` in the schema.
     [[nodiscard]]
     int get_argument_index(std::u8string_view parameter_name) const
     {
-        for (std::size_t i = 0; i < m_parameters.size(); ++i) {
-            if (m_parameters[i] == parameter_name) {
-                return m_indices[i];
-            }
+        const int parameter_index = m_schema->index_of(parameter_name);
+        if (parameter_index < 0) {
+            COWEL_ASSERT_UNREACHABLE(u8"Invalid parameter name");
         }
-        COWEL_ASSERT_UNREACHABLE(u8"Invalid parameter name");
+        return m_indices[std::size_t(parameter_index)];
     }
 
     /// @brief Returns the indices of the argument for each parameter,
@@ -101,15 +184,43 @@ public:
     [[nodiscard]]
     std::span<const int> parameter_indices() const
     {
-        return m_indices;
+        return { m_indices.data(), m_schema->size() };
     }
 
-    /// @brief Returns the argument statuses.
+    /// @brief Returns the amount of arguments that were matched.
     /// Shall only be used after calling `match`.
     [[nodiscard]]
-    std::span<const Argument_Status> argument_statuses() const
+    std::size_t argument_count() const
+    {
+        return m_arguments.size();
+    }
+
+    /// @brief Returns the status of the argument at the given index.
+    /// Shall only be used after calling `match`.
+    [[nodiscard]]
+    Argument_Status argument_status(std::size_t index) const
+    {
+        COWEL_ASSERT(index < m_arguments.size());
+        for (const int i : parameter_indices()) {
+            if (i == int(index)) {
+                return Argument_Status::ok;
+            }
+        }
+        // Named arguments are matched first, so if a named argument matches a parameter name
+        // but was not matched, the parameter must have been taken by an earlier argument.
+        const ast::Argument& arg = m_arguments[index];
+        if (m_mode != Parameter_Match_Mode::only_positional && arg.has_name()
+            && m_schema->index_of(arg.get_name()) >= 0) {
+            return Argument_Status::duplicate_named;
+        }
+        return Argument_Status::unmatched;
+    }
+
+private:
+    [[nodiscard]]
+    std::span<int> parameter_indices_mut()
     {
-        return m_statuses;
+        return { m_indices.data(), m_schema->size() };
     }
 };
 
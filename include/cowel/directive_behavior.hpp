@@ -55,14 +55,38 @@ enum struct Directive_Display : Default_Underlying {
     macro,
 };
 
+/// @brief The result of `Directive_Behavior::evaluate_integer`.
+enum struct Integer_Evaluation : Default_Underlying {
+    /// @brief The directive cannot be evaluated to an integer directly,
+    /// so plaintext should be generated and parsed instead.
+    unsupported,
+    /// @brief The directive was evaluated to an integer.
+    ok,
+    /// @brief Evaluation failed, and the failure has already been diagnosed.
+    error,
+};
+
+/// @brief Whether a directive is pure.
+/// See `Directive_Behavior::is_pure`.
+enum struct Directive_Purity : Default_Underlying {
+    impure,
+    pure,
+};
+
 /// @brief Implements behavior that one or multiple directives should have.
 struct Directive_Behavior {
     const Directive_Category category;
     const Directive_Display display;
+    const Directive_Purity purity;
 
-    constexpr Directive_Behavior(Directive_Category c, Directive_Display d)
+    constexpr Directive_Behavior(
+        Directive_Category c,
+        Directive_Display d,
+        Directive_Purity p = Directive_Purity::impure
+    )
         : category { c }
         , display { d }
+        , purity { p }
     {
     }
 
@@ -77,6 +101,35 @@ struct Directive_Behavior {
         COWEL_ASSERT_UNREACHABLE(u8"Instantiation unimplemented.");
     }
 
+    /// @brief Returns `true` if the generated plaintext and HTML depend only on the arguments
+    /// and content of the directive, and if generation has no side effects on the `Context`
+    /// (other than possibly emitting diagnostics).
+    /// For example, `\b` and `\U` are pure, but `\h1` (which registers an id)
+    /// and `\Vget` (which depends on variables) are not.
+    ///
+    /// Note that the content of the directive may contain other, impure directives.
+    [[nodiscard]]
+    constexpr bool is_pure() const noexcept
+    {
+        return purity == Directive_Purity::pure;
+    }
+
+    /// @brief Evaluates the directive to an integer without generating plaintext.
+    /// This lets directives such as `\\Cadd` and `\\Vget` exchange integers directly,
+    /// rather than formatting and parsing them.
+    ///
+    /// If `ok` is returned, `out` is the integer whose decimal representation
+    /// would have been produced by `generate_plaintext`.
+    /// If `unsupported` is returned, evaluation has had no side effects
+    /// (other than possibly emitting diagnostics),
+    /// and the caller should fall back onto `generate_plaintext`.
+    [[nodiscard]]
+    virtual Integer_Evaluation
+    evaluate_integer([[maybe_unused]] long long& out, const ast::Directive&, Context&) const
+    {
+        return Integer_Evaluation::unsupported;
+    }
+
     [[nodiscard]]
     std::pmr::vector<char8_t> generate_plaintext(const ast::Directive& d, Context& context) const
     {
@@ -64,6 +64,39 @@ To_Plaintext_Status to_plaintext(
     To_Plaintext_Mode mode = To_Plaintext_Mode::normal
 );
 
+/// @brief Returns `true` if `d` is pure, and if all directives within its arguments
+/// and content are pure.
+/// For directives that are not in transient memory (see `Context::is_transient_memory`),
+/// the result is memoized,
+/// so that nested directives are not inspected again for each enclosing directive.
+/// See `is_pure_content`.
+[[nodiscard]]
+bool is_pure_directive(const ast::Directive& d, Context& context);
+
+/// @brief Returns `true` if all directives within `content` are pure,
+/// meaning that they generate the same output every time,
+/// and that generating output has no side effects.
+/// See `Directive_Behavior::is_pure`.
+[[nodiscard]]
+bool is_pure_content(std::span<const ast::Content> content, Context& context);
+
+/// @brief Like `to_plaintext(out, content.get(), context, mode)`,
+/// but if `content` is pure (see `is_pure_content`),
+/// the result is memoized in the context,
+/// so that converting the same content (or a copy of the node holding it) again
+/// only appends the previous result.
+///
+/// Results are not memoized if the conversion emitted diagnostics,
+/// so that these diagnostics are emitted each time.
+/// Content in transient memory (see `Context::is_transient_memory`) is never memoized,
+/// and at most `plaintext_memo_max_entries` results are memoized.
+To_Plaintext_Status to_plaintext_memoized(
+    std::pmr::vector<char8_t>& out,
+    const ast::Shared_Nodes<ast::Content>& content,
+    Context& context,
+    To_Plaintext_Mode mode = To_Plaintext_Mode::normal
+);
+
 /// @brief Like `to_plaintext`,
 /// but ignores directives other than `pure_plaintext` and `formatting`, and
 /// also appends the source code index of the piece of content that is responsible for each
@@ -204,6 +237,29 @@ bool argument_to_plaintext(
     Context& context
 );
 
+/// @brief Appends `content` to `out`,
+/// but replaces every pure plaintext directive whose arguments and content consist only of
+/// text and escape sequences (such as `\\U{41}` or `\\Cadd{1}{2}`)
+/// with an `ast::Generated` holding its output.
+/// The generated content retains the source span and source of the directive it replaces.
+///
+/// Directives are only folded if `Directive_Behavior::is_pure()` is `true`,
+/// if generating them emits no diagnostics,
+/// and if their HTML output is the same as their escaped plaintext output.
+/// Folding also takes place within the content of formatting directives,
+/// but not within that of other directives,
+/// which may not process their content as ordinary content (e.g. `\\literally`).
+/// Directives whose names are defined as macros anywhere in `content` are never folded.
+/// If `content` contains `\\import` directives, nothing is folded,
+/// since the imported documents may define macros with any name.
+///
+/// The generated content is allocated using the memory resource of `out`.
+void fold_constants(
+    std::pmr::vector<ast::Content>& out,
+    std::span<const ast::Content> content,
+    Context& context
+);
+
 /// @brief If there is an error behavior in the `context`,
 /// uses that behavior's `generate_plaintext` on the directive.
 void try_generate_error_plaintext(
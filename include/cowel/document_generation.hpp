@@ -8,12 +8,17 @@
 
 #include "cowel/ast.hpp"
 #include "cowel/fwd.hpp"
+#include "cowel/macro_profile.hpp"
+#include "cowel/memory_profile.hpp"
+#include "cowel/plaintext_memo.hpp"
 #include "cowel/services.hpp"
 #include "cowel/simple_bibliography.hpp"
 
 namespace cowel {
 
 struct Generation_Options {
+    /// @brief The vector to which the generated document is appended,
+    /// unless `output_sink` is not null.
     std::pmr::vector<char8_t>& output;
 
     Content_Behavior& root_behavior;
@@ -33,9 +38,42 @@ struct Generation_Options {
     Syntax_Highlighter& highlighter = no_support_syntax_highlighter;
     Bibliography& bibliography = simple_bibliography;
 
+    /// @brief Limits on macro expansion.
+    /// When exceeded, an error is emitted, and no further macros are expanded.
+    Macro_Budget macro_budget {};
+    /// @brief If not null, statistics about macro expansions are collected in this profile.
+    Macro_Profile* macro_profile = nullptr;
+    /// @brief If `true`, pure plaintext directives with literal arguments and content
+    /// are replaced with their output prior to generation.
+    /// See `fold_constants`.
+    bool fold_constants = false;
+    /// @brief If not null, receives statistics about the memoization of plaintext
+    /// (see `to_plaintext_memoized`) once generation is complete.
+    Plaintext_Memo_Statistics* plaintext_memo_statistics = nullptr;
+    /// @brief If not null, the `generation` and `reference_resolution` phases are entered
+    /// in this profile as generation progresses.
+    /// The profile is left in the last phase entered.
+    Memory_Profile* memory_profile = nullptr;
+    /// @brief If not null, the generated document is written to this sink instead of `output`.
+    /// Note that this does not stream generation itself:
+    /// since any section can still be appended to until generation is complete,
+    /// all sections are generated in memory first.
+    /// Only when references between sections are resolved
+    /// is the text between them passed to the sink directly,
+    /// which saves assembling the resolved document as one additional copy.
+    Output_Sink* output_sink = nullptr;
+    /// @brief If `true`, the generated HTML is minified.
+    /// That is, whitespace outside of tags is collapsed and comments are removed,
+    /// except where whitespace is significant, such as within `pre` elements.
+    /// See `HTML_Minifier`.
+    bool minify = false;
+
     /// @brief A source of memory to be used throughout generation,
     /// emitting diagnostics, etc.
     std::pmr::memory_resource* memory;
+    /// @brief If not null, a source of memory which does not persist beyond generation.
+    /// Otherwise, a pool resource on top of `memory` is used.
+    std::pmr::memory_resource* transient_memory = nullptr;
 };
 
 void generate_document(const Generation_Options& options);
@@ -12,6 +12,7 @@
 #include "cowel/util/assert.hpp"
 #include "cowel/util/chars.hpp"
 #include "cowel/util/html_writer.hpp"
+#include "cowel/util/to_chars.hpp"
 #include "cowel/util/transparent_comparison.hpp"
 #include "cowel/util/unicode.hpp"
 
@@ -25,13 +26,70 @@ using Suppress_Unused_Include_Transparent_Less = Basic_Transparent_String_View_L
 
 } // namespace detail
 
+/// @brief Appends a "section reference" to `out`.
+/// This works by mapping the length onto a code point within the
+/// Supplementary Private Use Area-A block,
+/// and encoding that as UTF-8.
+/// The given name is then appended as is.
+/// @returns `name.size() <= 65635`.
+/// A name beyond that size cannot be encoded as a section reference.
+inline bool reference_section(std::pmr::vector<char8_t>& out, std::u8string_view name)
+{
+    constexpr std::size_t max_length = supplementary_pua_a_max - supplementary_pua_a_min;
+    if (name.size() > max_length) {
+        return false;
+    }
+
+    const utf8::Code_Units_And_Length units_and_length
+        = utf8::encode8_unchecked(supplementary_pua_a_min + char32_t(name.size()));
+    out.insert(out.end(), units_and_length.begin(), units_and_length.end());
+    out.insert(out.end(), name.begin(), name.end());
+    return true;
+}
+
+inline bool reference_section(HTML_Writer& out, std::u8string_view name)
+{
+    return reference_section(out.get_output(), name);
+}
+
+/// @brief A reference to another section,
+/// recorded at the point within the text of a section where it was written.
+struct Section_Reference {
+    /// @brief The offset within the text of the referencing section
+    /// where the referenced section is to be inserted.
+    std::size_t offset;
+    /// @brief The referenced section.
+    /// This points into `Document_Sections`, whose entries are stable,
+    /// so the name of the section is not copied for every reference.
+    const std::pair<const std::pmr::u8string, Document_Section>* target;
+};
+
+struct Document_Section {
+    /// @brief The output characters of the section.
+    std::pmr::vector<char8_t> text;
+    /// @brief The references to other sections that were written into `text`,
+    /// in ascending order of `offset`.
+    std::pmr::vector<Section_Reference> references;
+    /// @brief `true` if the section has only been referenced so far,
+    /// but has not been created (e.g. using `make` or `go_to`).
+    /// References to such a section are invalid when the document is assembled.
+    bool referenced_only = false;
+
+    [[nodiscard]]
+    explicit Document_Section(std::pmr::memory_resource* memory)
+        : text { memory }
+        , references { memory }
+    {
+    }
+};
+
 struct Document_Sections {
 public:
     // The choice of std::map over std::unordered_map is deliberate:
     // We require iterator and reference stability in some cases,
     // and std::unordered_map can invalidate iterators and references on rehashing.
-    using map_type = std::pmr::
-        map<std::pmr::u8string, std::pmr::vector<char8_t>, Transparent_String_View_Less8>;
+    using map_type
+        = std::pmr::map<std::pmr::u8string, Document_Section, Transparent_String_View_Less8>;
     using entry_type = map_type::value_type;
 
     struct [[nodiscard]] Scoped_Section {
@@ -57,9 +115,16 @@ public:
         }
     };
 
+    /// @brief The prefix of the names of sections created by `make_fragment`.
+    /// Users cannot write to or reference sections with this prefix (see `\there`).
+    static constexpr std::u8string_view fragment_prefix = u8"std.fragment.";
+
 private:
     map_type m_sections;
-    entry_type* m_current = &*m_sections.emplace().first;
+    entry_type* m_current
+        = &*m_sections.emplace(std::pmr::u8string {}, Document_Section { get_memory() }).first;
+    std::size_t m_encoded_references = 0;
+    std::size_t m_fragment_count = 0;
 
 public:
     [[nodiscard]]
@@ -83,7 +148,9 @@ public:
     entry_type* find(std::u8string_view section)
     {
         const auto existing_iter = m_sections.find(section);
-        return existing_iter != m_sections.end() ? &*existing_iter : nullptr;
+        return existing_iter != m_sections.end() && !existing_iter->second.referenced_only
+            ? &*existing_iter
+            : nullptr;
     }
 
     /// @brief Returns a pointer to the section named `section` if one exists;
@@ -94,7 +161,9 @@ public:
     const entry_type* find(std::u8string_view section) const
     {
         const auto existing_iter = m_sections.find(section);
-        return existing_iter != m_sections.end() ? &*existing_iter : nullptr;
+        return existing_iter != m_sections.end() && !existing_iter->second.referenced_only
+            ? &*existing_iter
+            : nullptr;
     }
 
     /// @brief Creates a new section named `section` if one doesn't exist yet.
@@ -103,11 +172,13 @@ public:
     /// Allocates a new key string if the section doesn't exist yet.
     entry_type& make(std::u8string_view section)
     {
-        if (entry_type* const existing = find(section)) {
-            return *existing;
+        if (const auto existing_iter = m_sections.find(section);
+            existing_iter != m_sections.end()) {
+            existing_iter->second.referenced_only = false;
+            return *existing_iter;
         }
         const auto [iter, success] = m_sections.emplace(
-            std::pmr::u8string { section, get_memory() }, std::pmr::vector<char8_t> { get_memory() }
+            std::pmr::u8string { section, get_memory() }, Document_Section { get_memory() }
         );
         COWEL_ASSERT(success);
         return *iter;
@@ -118,11 +189,13 @@ public:
     /// doesn't allocate a new string for the key name.
     entry_type& make(std::pmr::u8string&& section)
     {
-        if (entry_type* const existing = find(section)) {
-            return *existing;
+        if (const auto existing_iter = m_sections.find(section);
+            existing_iter != m_sections.end()) {
+            existing_iter->second.referenced_only = false;
+            return *existing_iter;
         }
         const auto [iter, success]
-            = m_sections.emplace(std::move(section), std::pmr::vector<char8_t> { get_memory() });
+            = m_sections.emplace(std::move(section), Document_Section { get_memory() });
         COWEL_ASSERT(success);
         return *iter;
     }
@@ -135,12 +208,33 @@ public:
     [[nodiscard]]
     entry_type* try_go_to(std::u8string_view section)
     {
-        const auto existing_iter = m_sections.find(section);
-        entry_type* const result = existing_iter != m_sections.end() ? &*existing_iter : nullptr;
+        entry_type* const result = find(section);
         m_current = result;
         return result;
     }
 
+    /// @brief Creates a new section with a unique name (a "fragment"),
+    /// and returns a reference to it.
+    ///
+    /// Fragments hold content which is generated once,
+    /// but which appears in multiple places within the document.
+    /// Rather than copying the content, each of those places can `reference` the fragment,
+    /// and the content is only copied when the final document is assembled.
+    entry_type& make_fragment()
+    {
+        // Names that are already taken are skipped,
+        // so that existing sections are never mixed up with fragments.
+        while (true) {
+            std::pmr::u8string name { fragment_prefix, get_memory() };
+            name += to_characters8(m_fragment_count++).as_string();
+            const auto [iter, success]
+                = m_sections.try_emplace(std::move(name), Document_Section { get_memory() });
+            if (success) {
+                return *iter;
+            }
+        }
+    }
+
     /// @brief Sets the current section to an existing one or a newly created one named `section`,
     /// and returns a reference to that section.
     ///
@@ -208,14 +302,14 @@ public:
     [[nodiscard]]
     std::pmr::vector<char8_t>& current_text() noexcept
     {
-        return current().second;
+        return current().second.text;
     }
 
     /// @brief Returns the output characters of the current section.
     [[nodiscard]]
     const std::pmr::vector<char8_t>& current_text() const noexcept
     {
-        return current().second;
+        return current().second.text;
     }
 
     /// @brief Equivalent to `HTML_Writer { current_text() }`.
@@ -224,33 +318,61 @@ public:
     {
         return HTML_Writer { current_text() };
     }
-};
 
-/// @brief Appends a "section reference" to `out`.
-/// This works by mapping the length onto a code point within the
-/// Supplementary Private Use Area-A block,
-/// and encoding that as UTF-8.
-/// The given name is then appended as is.
-/// @returns `name.size() <= 65635`.
-/// A name beyond that size cannot be encoded as a section reference.
-inline bool reference_section(std::pmr::vector<char8_t>& out, std::u8string_view name)
-{
-    constexpr std::size_t max_length = supplementary_pua_a_max - supplementary_pua_a_min;
-    if (name.size() > max_length) {
-        return false;
+    /// @brief Writes a reference to the section named `name` to `out`,
+    /// which is replaced with the contents of that section in the final document.
+    ///
+    /// If `out` writes to the current section,
+    /// the reference is only recorded in the section's `references`,
+    /// and no text is written.
+    /// If no section named `name` exists yet, an empty one is created which is marked as
+    /// `Document_Section::referenced_only` until it is created using `make` or `go_to`.
+    /// Otherwise, `out` may be a temporary buffer whose contents are later copied elsewhere,
+    /// so the reference has to be encoded within the text (see `reference_section`).
+    /// @returns `false` if the reference had to be encoded, but `name` was too long.
+    bool reference(HTML_Writer& out, std::u8string_view name)
+    {
+        Document_Section& section = current().second;
+        if (&out.get_output() == &section.text) {
+            section.references.push_back({ .offset = section.text.size(),
+                                           .target = &make_referenced(name) });
+            return true;
+        }
+        ++m_encoded_references;
+        return reference_section(out, name);
     }
 
-    const utf8::Code_Units_And_Length units_and_length
-        = utf8::encode8_unchecked(supplementary_pua_a_min + char32_t(name.size()));
-    out.insert(out.end(), units_and_length.begin(), units_and_length.end());
-    out.insert(out.end(), name.begin(), name.end());
-    return true;
-}
+    /// @brief Returns `true` if any section reference has been encoded within text
+    /// rather than recorded in `Document_Section::references`,
+    /// meaning that text needs to be searched for encoded references when the document
+    /// is assembled.
+    /// Note that this applies to the whole document:
+    /// a single encoded reference means that the text of every section is searched,
+    /// including the text of sections which only contain recorded references.
+    [[nodiscard]]
+    bool has_encoded_references() const noexcept
+    {
+        return m_encoded_references != 0;
+    }
 
-inline bool reference_section(HTML_Writer& out, std::u8string_view name)
-{
-    return reference_section(out.get_output(), name);
-}
+private:
+    /// @brief Returns the section named `section`,
+    /// or creates one which is marked as `Document_Section::referenced_only`.
+    entry_type& make_referenced(std::u8string_view section)
+    {
+        if (const auto existing_iter = m_sections.find(section);
+            existing_iter != m_sections.end()) {
+            return *existing_iter;
+        }
+        Document_Section placeholder { get_memory() };
+        placeholder.referenced_only = true;
+        const auto [iter, success] = m_sections.emplace(
+            std::pmr::u8string { section, get_memory() }, std::move(placeholder)
+        );
+        COWEL_ASSERT(success);
+        return *iter;
+    }
+};
 
 } // namespace cowel
 
@@ -62,25 +62,47 @@ struct Basic_Transparent_String_View_Hash;
 template <typename>
 struct Basic_Transparent_String_View_Less;
 enum struct Diagnostic_Highlight : Default_Underlying;
+struct Compressing_Output_Sink;
+enum struct Compression : Default_Underlying;
 struct Content_Behavior;
 struct Context;
+struct Counting_Memory_Resource;
 struct Diagnostic;
 struct Bibliography;
 struct Document_Info;
+struct Document_Section;
 struct Document_Sections;
 struct Directive_Behavior;
 struct Directive_Content_Behavior;
 enum struct Directive_Category : Default_Underlying;
 enum struct Directive_Display : Default_Underlying;
+enum struct Directive_Purity : Default_Underlying;
 struct Error_Tag;
 struct Generation_Options;
 enum struct HLJS_Scope : Default_Underlying;
+struct HTML_Minifier;
 struct HTML_Writer;
 struct Ignorant_Logger;
+enum struct Integer_Evaluation : Default_Underlying;
 enum struct IO_Error_Code : Default_Underlying;
 struct Logger;
+struct Macro_Budget;
+enum struct Macro_Memo_State : Default_Underlying;
+struct Macro_Profile;
+struct Macro_Statistics;
+enum struct Macro_Substitution : Default_Underlying;
+struct Macro_Template;
+enum struct Memory_Phase : Default_Underlying;
+struct Memory_Profile;
+struct Memory_Statistics;
+struct Plaintext_Memo_Entry;
+struct Plaintext_Memo_Key;
+struct Plaintext_Memo_Key_Hash;
+struct Plaintext_Memo_Statistics;
 struct Name_Resolver;
+struct Output_Sink;
 struct Simple_Bibliography;
+struct Vector_Output_Sink;
 struct No_Support_Syntax_Highlighter;
 template <typename, typename>
 struct Result;
@@ -92,6 +114,9 @@ struct Success_Tag;
 struct Syntax_Highlighter;
 enum struct Syntax_Highlight_Error : Default_Underlying;
 enum struct To_HTML_Mode : Default_Underlying;
+enum struct To_Plaintext_Mode : Default_Underlying;
+enum struct To_Plaintext_Status : Default_Underlying;
+enum struct URL_Encoded_Set : Default_Underlying;
 
 namespace ast {
 
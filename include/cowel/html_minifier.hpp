@@ -0,0 +1,114 @@
+#ifndef COWEL_HTML_MINIFIER_HPP
+#define COWEL_HTML_MINIFIER_HPP
+
+#include <cstddef>
+#include <memory_resource>
+#include <string_view>
+#include <vector>
+
+#include "cowel/services.hpp"
+
+#include "cowel/fwd.hpp"
+
+namespace cowel {
+
+/// @brief An `Output_Sink` which minifies the HTML written to it
+/// and passes the result on to another sink.
+///
+/// Specifically, outside of tags:
+/// - every run of whitespace is collapsed into a single newline character
+///   if the run contains one, or into a single space otherwise, and
+/// - comments are removed.
+///
+/// Whitespace is preserved within `pre`, `textarea`, and `code-block` elements,
+/// and the contents of `script` and `style` elements are left untouched.
+/// Attribute quotes are not affected because `HTML_Writer` already omits them where possible.
+///
+/// Since the HTML can be split into pieces at any point,
+/// the minifier is a state machine which processes one code unit at a time.
+/// The output is buffered, and `flush` needs to be called once all HTML has been written.
+struct HTML_Minifier final : Output_Sink {
+private:
+    enum struct State : Default_Underlying {
+        /// @brief Within text content.
+        text,
+        /// @brief After `<`, possibly at the start of a comment.
+        markup_start,
+        /// @brief Within the name of a tag.
+        tag_name,
+        /// @brief Within a tag, after its name.
+        tag,
+        /// @brief Within a quoted attribute value.
+        tag_quoted,
+        /// @brief Within a comment.
+        comment,
+        /// @brief Within the contents of `script` or `style`.
+        raw_text,
+    };
+
+    static constexpr std::size_t max_tag_name_length = 16;
+    static constexpr std::size_t default_buffer_size = std::size_t(1) << 16;
+
+    Output_Sink& m_out;
+    std::pmr::vector<char8_t> m_buffer;
+    std::size_t m_buffer_size;
+
+    State m_state = State::text;
+    char8_t m_quote = 0;
+    char8_t m_pending_whitespace = 0;
+    /// @brief The amount of code units matched so far of `<!--` in `markup_start`,
+    /// of `-->` in `comment`, or of the end tag in `raw_text`.
+    std::size_t m_matched = 0;
+    /// @brief The nesting depth of elements in which whitespace is preserved.
+    std::size_t m_preserve_depth = 0;
+    bool m_closing_tag = false;
+    std::size_t m_tag_name_length = 0;
+    char8_t m_tag_name[max_tag_name_length] {};
+    std::u8string_view m_raw_text_end;
+
+public:
+    [[nodiscard]]
+    explicit HTML_Minifier(
+        Output_Sink& out,
+        std::pmr::memory_resource* memory,
+        std::size_t buffer_size = default_buffer_size
+    )
+        : m_out { out }
+        , m_buffer { memory }
+        , m_buffer_size { buffer_size }
+    {
+        m_buffer.reserve(buffer_size);
+    }
+
+    void operator()(std::u8string_view text) final;
+
+    /// @brief Passes all buffered output on to the underlying sink.
+    /// Whitespace at the end of the HTML written so far is written as well,
+    /// so this should only be called once all HTML has been written.
+    void flush();
+
+private:
+    void consume(char8_t c);
+
+    void end_tag();
+
+    [[nodiscard]]
+    std::u8string_view tag_name() const noexcept
+    {
+        return { m_tag_name, m_tag_name_length };
+    }
+
+    void emit(char8_t c)
+    {
+        m_buffer.push_back(c);
+    }
+
+    void emit(std::u8string_view text)
+    {
+        m_buffer.insert(m_buffer.end(), text.begin(), text.end());
+    }
+};
+
+} // namespace cowel
+
+#endif
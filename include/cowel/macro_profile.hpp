@@ -0,0 +1,81 @@
+#ifndef COWEL_MACRO_PROFILE_HPP
+#define COWEL_MACRO_PROFILE_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "cowel/util/transparent_comparison.hpp"
+
+#include "cowel/fwd.hpp"
+
+namespace cowel {
+
+/// @brief Limits on macro expansion which protect against runaway macros.
+/// For example, `\\macro[\\m]{\\m}` expands infinitely,
+/// and a chain of macros that each instantiate the next one twice expands exponentially.
+struct Macro_Budget {
+    /// @brief The maximum nesting depth of macro expansions.
+    std::size_t max_depth = 256;
+    /// @brief The maximum total amount of nodes (top-level content in each expansion)
+    /// that may be produced by all macro expansions combined.
+    std::size_t max_expanded_nodes = std::size_t(1) << 24;
+};
+
+/// @brief Statistics about the expansions of a single macro.
+struct Macro_Statistics {
+    /// @brief The amount of times that the macro has been expanded.
+    std::size_t expansions = 0;
+    /// @brief The total amount of top-level nodes produced by all expansions.
+    std::size_t expanded_nodes = 0;
+    /// @brief The greatest overall macro nesting depth at which the macro was expanded,
+    /// where a depth of `1` means that the macro was used outside of any other macro.
+    std::size_t max_depth = 0;
+    /// @brief The total time spent expanding the macro and generating output from the expansion.
+    /// This is inclusive, i.e. time spent in nested macros is also included.
+    std::chrono::nanoseconds time {};
+};
+
+/// @brief Collects `Macro_Statistics` for each macro (or other instantiated directive) by name.
+struct Macro_Profile {
+    using map_type = std::pmr::unordered_map<
+        std::pmr::u8string,
+        Macro_Statistics,
+        Transparent_String_View_Hash8,
+        Transparent_String_View_Equals8>;
+
+    map_type entries;
+
+    [[nodiscard]]
+    explicit Macro_Profile(std::pmr::memory_resource* memory)
+        : entries { memory }
+    {
+    }
+
+    /// @brief Returns the statistics for the macro named `name`,
+    /// creating zero-initialized statistics if none exist yet.
+    [[nodiscard]]
+    Macro_Statistics& operator[](std::u8string_view name)
+    {
+        if (const auto it = entries.find(name); it != entries.end()) {
+            return it->second;
+        }
+        std::pmr::u8string owned_name { name, entries.get_allocator().resource() };
+        return entries.emplace(std::move(owned_name), Macro_Statistics {}).first->second;
+    }
+};
+
+/// @brief Appends the contents of `profile` to `out` as a JSON object
+/// where each key is the name of a macro, and each value is an object containing
+/// `expansions`, `expanded_nodes`, `max_depth`, and `time_ns`.
+/// Macros are ordered by name.
+void write_macro_profile_json(std::pmr::vector<char8_t>& out, const Macro_Profile& profile);
+
+} // namespace cowel
+
+#endif
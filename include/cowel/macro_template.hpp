@@ -0,0 +1,67 @@
+#ifndef COWEL_MACRO_TEMPLATE_HPP
+#define COWEL_MACRO_TEMPLATE_HPP
+
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+#include "cowel/ast.hpp"
+#include "cowel/fwd.hpp"
+
+namespace cowel {
+
+/// @brief Describes how a directive within a macro definition is handled during instantiation.
+enum struct Macro_Substitution : Default_Underlying {
+    /// @brief The directive contains no `\put` and is copied unchanged.
+    copy,
+    /// @brief The directive is a `\put` and is replaced with the content passed to the macro.
+    put,
+    /// @brief The directive contains a `\put` somewhere within its arguments or content,
+    /// so it is rebuilt with substituted arguments and content.
+    rebuild,
+};
+
+/// @brief The state of memoization for the HTML generated by a macro.
+enum struct Macro_Memo_State : Default_Underlying {
+    /// @brief It has not yet been determined whether the macro can be memoized.
+    unknown,
+    /// @brief The macro cannot be memoized because its expansion depends on the content
+    /// passed to it, because its definition contains impure directives,
+    /// or because generating HTML emitted diagnostics.
+    impossible,
+    /// @brief The generated HTML is stored in `Macro_Template::memo_html`.
+    cached,
+};
+
+/// @brief A macro definition which has been compiled once at the point of definition,
+/// so that instantiating it only requires a single linear pass over the definition.
+struct Macro_Template {
+    /// @brief The `\macro` directive which defined the macro.
+    /// This is a copy which shares storage with the original directive,
+    /// so the definition remains valid even if the original does not,
+    /// such as when it was part of an imported document.
+    ast::Directive definition;
+    /// @brief The substitutions for the directives in the definition,
+    /// in the order in which they are visited during instantiation.
+    ///
+    /// That is, directives appear in pre-order,
+    /// with the arguments of a directive visited before its content.
+    /// Only directives within a directive marked as `rebuild`
+    /// (or at the top level of the definition) are visited,
+    /// so there are no entries for the insides of directives that are copied,
+    /// or of `\put` directives.
+    std::pmr::vector<Macro_Substitution> substitutions;
+    /// @brief The memoization state for the generated HTML.
+    /// This is only valid if `memo_generation` equals `Context::get_macro_generation()`;
+    /// otherwise, the state is `unknown`.
+    Macro_Memo_State memo_state = Macro_Memo_State::unknown;
+    /// @brief The value of `Context::get_macro_generation()` when `memo_state` was determined.
+    std::size_t memo_generation = 0;
+    /// @brief If `memo_state` is `cached`,
+    /// the HTML which is generated by every instantiation of this macro.
+    std::pmr::vector<char8_t> memo_html;
+};
+
+} // namespace cowel
+
+#endif
@@ -0,0 +1,103 @@
+#ifndef COWEL_MEMORY_PROFILE_HPP
+#define COWEL_MEMORY_PROFILE_HPP
+
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "cowel/util/counting_memory_resource.hpp"
+
+#include "cowel/fwd.hpp"
+
+namespace cowel {
+
+/// @brief A phase of processing a document, used for breaking down memory usage.
+enum struct Memory_Phase : Default_Underlying {
+    /// @brief Loading the input files.
+    load,
+    /// @brief Parsing the document into `AST_Instruction`s.
+    parse,
+    /// @brief Building the AST from the instructions.
+    build_ast,
+    /// @brief Generating HTML sections from the AST.
+    generation,
+    /// @brief Resolving references between sections into the final output.
+    reference_resolution,
+    /// @brief Writing the output.
+    /// When the output is streamed, most of it is already written during `reference_resolution`.
+    output,
+};
+
+inline constexpr std::size_t memory_phase_count = std::size_t(Memory_Phase::output) + 1;
+
+[[nodiscard]]
+std::u8string_view memory_phase_name(Memory_Phase phase);
+
+/// @brief Collects `Memory_Statistics` of one or more `Counting_Memory_Resource`s,
+/// broken down by `Memory_Phase`.
+///
+/// Within each phase, `allocated_bytes` and `allocations` are the amounts during that phase,
+/// `peak_bytes` is the peak during that phase,
+/// and `live_bytes` is the amount of live bytes at the end of the phase.
+struct Memory_Profile {
+    struct Tracked_Resource {
+        std::u8string_view name;
+        Counting_Memory_Resource* resource;
+        Memory_Statistics phase_start {};
+        std::array<Memory_Statistics, memory_phase_count> phases {};
+    };
+
+private:
+    std::pmr::vector<Tracked_Resource> m_resources;
+    std::optional<Memory_Phase> m_phase;
+
+public:
+    [[nodiscard]]
+    explicit Memory_Profile(std::pmr::memory_resource* memory)
+        : m_resources { memory }
+    {
+    }
+
+    /// @brief Tracks `resource` under the given `name` in all subsequent phases.
+    /// `name` is not copied, and should only consist of ASCII alphanumeric characters and `_`.
+    void add_resource(std::u8string_view name, Counting_Memory_Resource& resource);
+
+    /// @brief Ends the current phase, if any, and begins `phase`.
+    /// If `phase` was already entered before, the statistics of both periods are combined.
+    void enter_phase(Memory_Phase phase);
+
+    /// @brief Ends the current phase, if any.
+    void end_phase();
+
+    /// @brief Returns the current phase, if any.
+    [[nodiscard]]
+    std::optional<Memory_Phase> get_phase() const noexcept
+    {
+        return m_phase;
+    }
+
+    [[nodiscard]]
+    std::span<const Tracked_Resource> get_resources() const noexcept
+    {
+        return m_resources;
+    }
+};
+
+/// @brief Appends the contents of `profile` to `out` as a JSON object
+/// where each key is the name of a phase, and each value is an object
+/// where each key is the name of a resource,
+/// and each value is an object containing
+/// `allocated_bytes`, `allocations`, `peak_bytes`, and `live_bytes`.
+void write_memory_profile_json(std::pmr::vector<char8_t>& out, const Memory_Profile& profile);
+
+/// @brief Appends the contents of `profile` to `out` as a human-readable table
+/// with one row per phase and resource.
+void write_memory_profile_text(std::pmr::vector<char8_t>& out, const Memory_Profile& profile);
+
+} // namespace cowel
+
+#endif
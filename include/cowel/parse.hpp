@@ -86,6 +86,15 @@ std::u8string_view ast_instruction_type_name(AST_Instruction_Type type);
 struct AST_Instruction {
     AST_Instruction_Type type;
     std::size_t n = 0;
+    /// @brief For `text` only,
+    /// `true` if the text contains characters that need to be escaped in HTML
+    /// (`&`, `<`, or `>`).
+    /// Most text does not, and can be written to HTML without being examined again.
+    bool needs_html_escaping = false;
+    /// @brief For `text` only,
+    /// `true` if the text contains a blank line (see `find_blank_line_sequence`).
+    /// Only such text can separate paragraphs.
+    bool contains_blank_line = false;
 
     friend std::strong_ordering operator<=>(const AST_Instruction&, const AST_Instruction&)
         = default;
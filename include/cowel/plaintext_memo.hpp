@@ -0,0 +1,53 @@
+#ifndef COWEL_PLAINTEXT_MEMO_HPP
+#define COWEL_PLAINTEXT_MEMO_HPP
+
+#include <cstddef>
+#include <functional>
+#include <memory_resource>
+#include <vector>
+
+#include "cowel/fwd.hpp"
+
+namespace cowel {
+
+/// @brief Identifies content whose plaintext is memoized by `to_plaintext_memoized`.
+/// Content is identified by the address of its shared storage (see `ast::Shared_Nodes`),
+/// not by value.
+struct Plaintext_Memo_Key {
+    const void* content;
+    To_Plaintext_Mode mode;
+
+    [[nodiscard]]
+    friend bool operator==(const Plaintext_Memo_Key&, const Plaintext_Memo_Key&)
+        = default;
+};
+
+struct Plaintext_Memo_Key_Hash {
+    [[nodiscard]]
+    std::size_t operator()(const Plaintext_Memo_Key& key) const noexcept
+    {
+        return std::hash<const void*> {}(key.content) ^ std::size_t(key.mode);
+    }
+};
+
+/// @brief The result of `to_plaintext` for pure content,
+/// which was converted without emitting diagnostics.
+struct Plaintext_Memo_Entry {
+    To_Plaintext_Status status {};
+    std::pmr::vector<char8_t> plaintext;
+};
+
+/// @brief The maximum amount of entries in the memo of `to_plaintext_memoized`.
+/// Content is converted without memoization once this amount is reached.
+inline constexpr std::size_t plaintext_memo_max_entries = 4096;
+
+/// @brief Counts how often `to_plaintext_memoized` was used,
+/// and how many conversions to plaintext were avoided thanks to memoization.
+struct Plaintext_Memo_Statistics {
+    std::size_t lookups = 0;
+    std::size_t hits = 0;
+};
+
+} // namespace cowel
+
+#endif
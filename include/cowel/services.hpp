@@ -1,6 +1,8 @@
 #ifndef COWEL_SERVICES_HPP
 #define COWEL_SERVICES_HPP
 
+#include <algorithm>
+#include <cstddef>
 #include <memory_resource>
 #include <optional>
 #include <span>
@@ -221,6 +223,60 @@ struct Ignorant_Logger final : Logger {
 
 inline constinit Ignorant_Logger ignorant_logger { Severity::none };
 
+/// @brief Receives the generated document piece by piece.
+/// This allows the document to be written to its destination while it is being assembled,
+/// without first concatenating all of its pieces in memory.
+struct Output_Sink {
+    /// @brief Writes `text` to the destination, after all text previously written.
+    /// `text` is only valid for the duration of the call.
+    virtual void operator()(std::u8string_view text) = 0;
+
+    /// @brief Writes the given pieces of text to the destination, in order.
+    /// This is equivalent to calling `operator()` for each piece,
+    /// but sinks may override it to write all pieces at once,
+    /// such as with vectored I/O.
+    virtual void write_vectored(std::span<const std::u8string_view> pieces)
+    {
+        for (const std::u8string_view piece : pieces) {
+            (*this)(piece);
+        }
+    }
+};
+
+/// @brief An `Output_Sink` which appends all text to a vector.
+struct Vector_Output_Sink final : Output_Sink {
+private:
+    std::pmr::vector<char8_t>& m_out;
+
+public:
+    [[nodiscard]]
+    explicit Vector_Output_Sink(std::pmr::vector<char8_t>& out)
+        : m_out { out }
+    {
+    }
+
+    void operator()(std::u8string_view text) final
+    {
+        m_out.insert(m_out.end(), text.begin(), text.end());
+    }
+
+    void write_vectored(std::span<const std::u8string_view> pieces) final
+    {
+        std::size_t total_size = m_out.size();
+        for (const std::u8string_view piece : pieces) {
+            total_size += piece.size();
+        }
+        // Growing to exactly the required size would defeat geometric growth
+        // when this function is called repeatedly.
+        if (total_size > m_out.capacity()) {
+            m_out.reserve(std::max(total_size, m_out.capacity() * 2));
+        }
+        for (const std::u8string_view piece : pieces) {
+            m_out.insert(m_out.end(), piece.begin(), piece.end());
+        }
+    }
+};
+
 } // namespace cowel
 
 #endif
@@ -0,0 +1,96 @@
+#ifndef COWEL_ARENA_HPP
+#define COWEL_ARENA_HPP
+
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+namespace cowel {
+
+/// @brief A stack-like memory resource which obtains large blocks of memory from an upstream
+/// resource and hands out memory from these blocks by bumping a pointer.
+///
+/// Individual deallocations are no-ops, except for the most recent allocation,
+/// which is given back.
+/// Instead, memory is released in bulk by `rewind`ing to a previous `mark()`,
+/// which is `O(1)`.
+/// Blocks are kept after rewinding, so that subsequent allocations can reuse them.
+/// New blocks grow geometrically up to `max_block_size`.
+///
+/// Unlike `std::pmr::monotonic_buffer_resource`, this allows memory use to remain bounded
+/// when the arena is used for many short-lived, stack-like scopes.
+struct Arena_Memory_Resource final : std::pmr::memory_resource {
+    /// @brief A position within the arena, obtained using `mark()`.
+    struct Marker {
+        std::size_t block;
+        std::size_t offset;
+    };
+
+    static constexpr std::size_t default_block_size = 64 * 1024;
+    /// @brief The size beyond which blocks do not grow,
+    /// unless a single allocation requires a larger block.
+    static constexpr std::size_t max_block_size = 16 * 1024 * 1024;
+
+private:
+    struct Block {
+        std::byte* data;
+        std::size_t size;
+    };
+
+    std::pmr::memory_resource* m_upstream;
+    std::pmr::vector<Block> m_blocks;
+    std::size_t m_block_size;
+    std::size_t m_current_block = 0;
+    std::size_t m_offset = 0;
+
+public:
+    [[nodiscard]]
+    explicit Arena_Memory_Resource(
+        std::pmr::memory_resource* upstream = std::pmr::get_default_resource(),
+        std::size_t block_size = default_block_size
+    );
+
+    Arena_Memory_Resource(const Arena_Memory_Resource&) = delete;
+    Arena_Memory_Resource& operator=(const Arena_Memory_Resource&) = delete;
+
+    ~Arena_Memory_Resource() override;
+
+    /// @brief Returns the current position within the arena.
+    [[nodiscard]]
+    Marker mark() const noexcept
+    {
+        return { m_current_block, m_offset };
+    }
+
+    /// @brief Releases all memory that was allocated since `marker` was obtained.
+    /// Any allocations made after the `marker` was obtained must no longer be in use.
+    void rewind(Marker marker) noexcept;
+
+    /// @brief Equivalent to `rewind(Marker {})`.
+    void reset() noexcept
+    {
+        rewind({});
+    }
+
+    /// @brief Returns all blocks to the upstream resource.
+    void release() noexcept;
+
+    [[nodiscard]]
+    std::pmr::memory_resource* upstream_resource() const noexcept
+    {
+        return m_upstream;
+    }
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+    [[nodiscard]]
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+} // namespace cowel
+
+#endif
@@ -0,0 +1,95 @@
+#ifndef COWEL_COUNTING_MEMORY_RESOURCE_HPP
+#define COWEL_COUNTING_MEMORY_RESOURCE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <memory_resource>
+
+#include "cowel/util/assert.hpp"
+
+namespace cowel {
+
+/// @brief Statistics about the memory obtained from a `Counting_Memory_Resource`.
+struct Memory_Statistics {
+    /// @brief The total amount of bytes allocated, ignoring any deallocations.
+    std::size_t allocated_bytes = 0;
+    /// @brief The total amount of allocations.
+    std::size_t allocations = 0;
+    /// @brief The amount of bytes which are currently allocated.
+    std::size_t live_bytes = 0;
+    /// @brief The greatest value that `live_bytes` has had.
+    std::size_t peak_bytes = 0;
+
+    [[nodiscard]]
+    friend bool operator==(const Memory_Statistics&, const Memory_Statistics&)
+        = default;
+};
+
+/// @brief A memory resource which forwards all requests to an upstream resource,
+/// and keeps track of `Memory_Statistics` in the process.
+/// Like `std::pmr::unsynchronized_pool_resource`, this is not thread-safe.
+struct Counting_Memory_Resource final : std::pmr::memory_resource {
+private:
+    std::pmr::memory_resource* m_upstream;
+    Memory_Statistics m_statistics;
+
+public:
+    [[nodiscard]]
+    explicit Counting_Memory_Resource(
+        std::pmr::memory_resource* upstream = std::pmr::get_default_resource()
+    )
+        : m_upstream { upstream }
+    {
+        COWEL_ASSERT(upstream != nullptr);
+    }
+
+    Counting_Memory_Resource(const Counting_Memory_Resource&) = delete;
+    Counting_Memory_Resource& operator=(const Counting_Memory_Resource&) = delete;
+
+    [[nodiscard]]
+    const Memory_Statistics& get_statistics() const noexcept
+    {
+        return m_statistics;
+    }
+
+    /// @brief Sets the peak amount of bytes to the amount of live bytes,
+    /// so that the peak within a subsequent period of time can be determined.
+    void reset_peak() noexcept
+    {
+        m_statistics.peak_bytes = m_statistics.live_bytes;
+    }
+
+    [[nodiscard]]
+    std::pmr::memory_resource* upstream_resource() const noexcept
+    {
+        return m_upstream;
+    }
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) final
+    {
+        void* const result = m_upstream->allocate(bytes, alignment);
+        m_statistics.allocated_bytes += bytes;
+        ++m_statistics.allocations;
+        m_statistics.live_bytes += bytes;
+        m_statistics.peak_bytes = std::max(m_statistics.peak_bytes, m_statistics.live_bytes);
+        return result;
+    }
+
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) final
+    {
+        COWEL_DEBUG_ASSERT(bytes <= m_statistics.live_bytes);
+        m_statistics.live_bytes -= bytes;
+        m_upstream->deallocate(p, bytes, alignment);
+    }
+
+    [[nodiscard]]
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept final
+    {
+        return this == &other;
+    }
+};
+
+} // namespace cowel
+
+#endif
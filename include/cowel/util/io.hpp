@@ -129,6 +129,14 @@ Result<void, IO_Error_Code> file_to_bytes(std::vector<Byte, Alloc>& out, std::u8
     );
 }
 
+/// @brief Writes the given pieces of text to `file`, in order.
+/// On POSIX systems, any data buffered in `file` is flushed first,
+/// and the pieces are then written using `writev`,
+/// so that they don't need to be copied into a contiguous buffer.
+[[nodiscard]]
+Result<void, IO_Error_Code>
+write_to_file(std::FILE* file, std::span<const std::u8string_view> pieces);
+
 [[nodiscard]]
 Result<void, IO_Error_Code> load_utf8_file(std::pmr::vector<char8_t>& out, std::u8string_view path);
 
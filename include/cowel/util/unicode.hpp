@@ -1,6 +1,11 @@
 #ifndef COWEL_UNICODE_HPP
 #define COWEL_UNICODE_HPP
 
+#include <cstddef>
+#include <memory_resource>
+#include <string_view>
+#include <vector>
+
 #include "ulight/impl/unicode.hpp"
 
 namespace cowel::utf8 {
@@ -23,6 +28,24 @@ using ulight::utf8::is_valid;
 using ulight::utf8::sequence_length;
 using ulight::utf8::Unicode_Error;
 
+/// @brief Returns the amount of UTF-8 code units needed to encode `text`.
+/// The behavior is undefined if `text` contains any code points which are not scalar values.
+[[nodiscard]]
+std::size_t encoded_length8(std::u32string_view text) noexcept;
+
+/// @brief Encodes `text` as UTF-8 into `out`.
+/// Unlike encoding one code point at a time,
+/// blocks of ASCII characters are transcoded at once.
+/// The behavior is undefined if `text` contains any code points which are not scalar values.
+/// @param out Storage for at least `encoded_length8(text)` code units.
+/// @returns A pointer past the last code unit written.
+char8_t* encode8_unchecked(std::u32string_view text, char8_t* out) noexcept;
+
+/// @brief Appends `text` to `out`, encoded as UTF-8.
+/// The space needed is computed upfront, so `out` grows at most once.
+/// The behavior is undefined if `text` contains any code points which are not scalar values.
+void append_encoded8(std::pmr::vector<char8_t>& out, std::u32string_view text);
+
 } // namespace cowel::utf8
 
 #endif
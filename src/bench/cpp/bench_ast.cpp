@@ -0,0 +1,129 @@
+#include <cstddef>
+#include <cstdio>
+#include <memory_resource>
+#include <span>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+#include "cowel/util/counting_memory_resource.hpp"
+#include "cowel/util/io.hpp"
+
+#include "cowel/ast.hpp"
+#include "cowel/parse.hpp"
+
+#include "benchmark.hpp"
+
+namespace cowel {
+namespace {
+
+// Real documents, relative to the repository root.
+constexpr std::u8string_view document_paths[] {
+    u8"docs/index.cow",
+    u8"docs/intro/directives.cow",
+    u8"docs/intro/syntax.cow",
+    u8"docs/directives/code.cow",
+    u8"docs/directives/formatting.cow",
+    u8"docs/directives/lists-tables-headings.cow",
+    u8"docs/directives/macros.cow",
+};
+
+struct Document {
+    std::u8string_view path;
+    std::pmr::vector<char8_t> source;
+};
+
+[[nodiscard]]
+const std::vector<Document>& get_documents()
+{
+    static const std::vector<Document> result = [] {
+        std::vector<Document> documents;
+        for (const std::u8string_view path : document_paths) {
+            Result<std::pmr::vector<char8_t>, IO_Error_Code> source
+                = load_utf8_file(path, std::pmr::new_delete_resource());
+            if (!source) {
+                std::fprintf(
+                    stderr, "Failed to load %.*s\n", int(path.size()),
+                    reinterpret_cast<const char*>(path.data())
+                );
+                continue;
+            }
+            documents.push_back({ path, std::move(*source) });
+        }
+        return documents;
+    }();
+    return result;
+}
+
+[[nodiscard]]
+std::size_t count_nodes(std::span<const ast::Content> content)
+{
+    std::size_t result = content.size();
+    for (const ast::Content& c : content) {
+        if (const auto* const d = std::get_if<ast::Directive>(&c)) {
+            for (const ast::Argument& arg : d->get_arguments()) {
+                result += count_nodes(arg.get_content());
+            }
+            result += count_nodes(d->get_content());
+        }
+    }
+    return result;
+}
+
+void build_all(std::pmr::memory_resource* memory)
+{
+    for (const Document& document : get_documents()) {
+        const std::u8string_view source { document.source.data(), document.source.size() };
+        const std::pmr::vector<ast::Content> content
+            = parse_and_build(source, document.path, memory);
+        bench::do_not_optimize(content);
+    }
+}
+
+/// @brief Prints the sizes of AST nodes,
+/// and the amount of memory used by the AST of each document.
+void print_memory_report()
+{
+    std::printf(
+        "sizeof: Content %zu, Directive %zu, Text %zu, Escaped %zu, Generated %zu, "
+        "Argument %zu\n",
+        sizeof(ast::Content), sizeof(ast::Directive), sizeof(ast::Text), sizeof(ast::Escaped),
+        sizeof(ast::Generated), sizeof(ast::Argument)
+    );
+    for (const Document& document : get_documents()) {
+        const std::u8string_view source { document.source.data(), document.source.size() };
+        Counting_Memory_Resource memory { std::pmr::new_delete_resource() };
+        const std::pmr::vector<ast::Content> content
+            = parse_and_build(source, document.path, &memory);
+        const Memory_Statistics& statistics = memory.get_statistics();
+        const std::size_t nodes = count_nodes(content);
+        std::printf(
+            "%-48.*s %10zu bytes source %10zu nodes %10zu bytes live %10zu bytes peak\n",
+            int(document.path.size()), reinterpret_cast<const char*>(document.path.data()),
+            source.size(), nodes, statistics.live_bytes, statistics.peak_bytes
+        );
+    }
+}
+
+COWEL_BENCHMARK(ast_build_docs)
+{
+    for (std::size_t i = 0; i < iterations; ++i) {
+        std::pmr::unsynchronized_pool_resource memory;
+        build_all(&memory);
+    }
+}
+
+COWEL_BENCHMARK(ast_memory_docs)
+{
+    static const bool reported = (print_memory_report(), true);
+    bench::do_not_optimize(reported);
+
+    for (std::size_t i = 0; i < iterations; ++i) {
+        Counting_Memory_Resource memory { std::pmr::new_delete_resource() };
+        build_all(&memory);
+        bench::do_not_optimize(memory.get_statistics());
+    }
+}
+
+} // namespace
+} // namespace cowel
@@ -0,0 +1,105 @@
+#include <cstddef>
+#include <string_view>
+
+#include "ulight/impl/platform.h"
+
+ULIGHT_DIAGNOSTIC_PUSH()
+ULIGHT_DIAGNOSTIC_IGNORED("-Wsign-conversion")
+ULIGHT_DIAGNOSTIC_IGNORED("-Wshorten-64-to-32")
+#include "cowel/cedilla/name_to_cp.hpp"
+ULIGHT_DIAGNOSTIC_POP()
+
+#include "cowel/util/code_point_names.hpp"
+#include "cowel/util/strings.hpp"
+
+#include "benchmark.hpp"
+
+namespace cowel {
+namespace {
+
+// A mix of names as they would typically appear in \N directives.
+constexpr std::u8string_view names[] {
+    u8"LATIN SMALL LETTER A",
+    u8"latin capital letter z",
+    u8"NO-BREAK SPACE",
+    u8"ZERO WIDTH SPACE",
+    u8"ZERO WIDTH NON-JOINER",
+    u8"EM DASH",
+    u8"EN DASH",
+    u8"HORIZONTAL ELLIPSIS",
+    u8"LEFT DOUBLE QUOTATION MARK",
+    u8"RIGHT DOUBLE QUOTATION MARK",
+    u8"BULLET",
+    u8"SECTION SIGN",
+    u8"PILCROW SIGN",
+    u8"GREEK SMALL LETTER ALPHA",
+    u8"GREEK CAPITAL LETTER OMEGA",
+    u8"CYRILLIC SMALL LETTER ZHE",
+    u8"HEBREW LETTER ALEF",
+    u8"ARABIC LETTER ALEF",
+    u8"DEVANAGARI LETTER KA",
+    u8"RIGHTWARDS ARROW",
+    u8"LONG RIGHTWARDS DOUBLE ARROW",
+    u8"FOR ALL",
+    u8"THERE EXISTS",
+    u8"ELEMENT OF",
+    u8"N-ARY SUMMATION",
+    u8"INFINITY",
+    u8"NOT EQUAL TO",
+    u8"REPLACEMENT CHARACTER",
+    u8"SNOWMAN",
+    u8"PILE OF POO",
+    u8"GRINNING FACE WITH SMILING EYES",
+    u8"MATHEMATICAL BOLD CAPITAL A",
+};
+
+// Names which are not the names of any code point.
+constexpr std::u8string_view missing_names[] {
+    u8"LATIN SMALL LETTER",
+    u8"LATIN SMALL LETTER QQQ",
+    u8"EMDASH SIGN",
+    u8"SNOW MAN WITH HAT",
+    u8"RIGHTWARDS ARROWS",
+    u8"GREEK SMALL LETTER ALPHAS",
+    u8"NOT A CHARACTER NAME",
+    u8"X",
+};
+
+COWEL_BENCHMARK(code_point_by_name_hits)
+{
+    for (std::size_t i = 0; i < iterations; ++i) {
+        for (const std::u8string_view name : names) {
+            bench::do_not_optimize(code_point_by_name(name));
+        }
+    }
+}
+
+COWEL_BENCHMARK(code_point_by_name_misses)
+{
+    for (std::size_t i = 0; i < iterations; ++i) {
+        for (const std::u8string_view name : missing_names) {
+            bench::do_not_optimize(code_point_by_name(name));
+        }
+    }
+}
+
+COWEL_BENCHMARK(cedilla_cp_from_name_hits)
+{
+    for (std::size_t i = 0; i < iterations; ++i) {
+        for (const std::u8string_view name : names) {
+            bench::do_not_optimize(uni::cp_from_name(as_string_view(name)));
+        }
+    }
+}
+
+COWEL_BENCHMARK(cedilla_cp_from_name_misses)
+{
+    for (std::size_t i = 0; i < iterations; ++i) {
+        for (const std::u8string_view name : missing_names) {
+            bench::do_not_optimize(uni::cp_from_name(as_string_view(name)));
+        }
+    }
+}
+
+} // namespace
+} // namespace cowel
@@ -0,0 +1,81 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "cowel/util/html_entities.hpp"
+
+#include "benchmark.hpp"
+
+namespace cowel {
+namespace {
+
+/// @brief Returns `count` deterministic pseudo-random names
+/// which are not the names of any character reference.
+[[nodiscard]]
+std::vector<std::u8string> make_missing_names(std::size_t count)
+{
+    std::vector<std::u8string> result;
+    std::uint32_t state = 12345;
+    const auto next = [&] {
+        state = state * 1103515245u + 12345u;
+        return state >> 16;
+    };
+    while (result.size() < count) {
+        std::u8string name(2 + next() % 12, u8'\0');
+        for (char8_t& c : name) {
+            const auto letter = char8_t(next() % 26);
+            c = next() % 2 == 0 ? char8_t(u8'a' + letter) : char8_t(u8'A' + letter);
+        }
+        if (!std::ranges::binary_search(html_character_names, std::u8string_view { name })) {
+            result.push_back(std::move(name));
+        }
+    }
+    return result;
+}
+
+COWEL_BENCHMARK(html_entities_hash_all_names)
+{
+    for (std::size_t i = 0; i < iterations; ++i) {
+        for (const std::u8string_view name : html_character_names) {
+            bench::do_not_optimize(code_points_by_character_reference_name(name));
+        }
+    }
+}
+
+COWEL_BENCHMARK(html_entities_binary_search_all_names)
+{
+    for (std::size_t i = 0; i < iterations; ++i) {
+        for (const std::u8string_view name : html_character_names) {
+            bench::do_not_optimize(std::ranges::lower_bound(html_character_names, name));
+        }
+    }
+}
+
+COWEL_BENCHMARK(html_entities_hash_random_misses)
+{
+    static const std::vector<std::u8string> names = make_missing_names(html_character_names.size());
+    for (std::size_t i = 0; i < iterations; ++i) {
+        for (const std::u8string& name : names) {
+            bench::do_not_optimize(code_points_by_character_reference_name(name));
+        }
+    }
+}
+
+COWEL_BENCHMARK(html_entities_binary_search_random_misses)
+{
+    static const std::vector<std::u8string> names = make_missing_names(html_character_names.size());
+    for (std::size_t i = 0; i < iterations; ++i) {
+        for (const std::u8string& name : names) {
+            bench::do_not_optimize(
+                std::ranges::lower_bound(html_character_names, std::u8string_view { name })
+            );
+        }
+    }
+}
+
+} // namespace
+} // namespace cowel
@@ -0,0 +1,115 @@
+#include <algorithm>
+#include <cstddef>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "cowel/util/html_writer.hpp"
+
+#include "benchmark.hpp"
+
+namespace cowel {
+namespace {
+
+/// @brief Returns text which resembles prose, with a `<`, `>`, or `&` every `period` characters.
+[[nodiscard]]
+std::u8string make_text(std::size_t length, std::size_t period)
+{
+    constexpr std::u8string_view words = u8"The quick brown fox jumps over the lazy dog. ";
+    constexpr std::u8string_view special = u8"<>&";
+    std::u8string result;
+    result.reserve(length);
+    for (std::size_t i = 0; result.size() < length; ++i) {
+        result.push_back(
+            period != 0 && i % period == period - 1 ? special[i / period % special.size()]
+                                                    : words[i % words.size()]
+        );
+    }
+    return result;
+}
+
+/// @brief The previous implementation of `append_html_escaped`, for comparison.
+void append_html_escaped_naive(
+    std::pmr::vector<char8_t>& out,
+    std::u8string_view text,
+    std::u8string_view charset
+)
+{
+    while (!text.empty()) {
+        const std::size_t pos = text.find_first_of(charset);
+        const auto snippet = text.substr(0, std::min(text.length(), pos));
+        append(out, snippet);
+        if (pos == std::u8string_view::npos) {
+            break;
+        }
+        switch (text[pos]) {
+        case u8'&': append(out, u8"&amp;"); break;
+        case u8'<': append(out, u8"&lt;"); break;
+        case u8'>': append(out, u8"&gt;"); break;
+        case u8'\'': append(out, u8"&apos;"); break;
+        case u8'"': append(out, u8"&quot;"); break;
+        default: break;
+        }
+        text = text.substr(pos + 1);
+    }
+}
+
+template <auto escape>
+void run_escape(std::size_t iterations, std::u8string_view text, std::u8string_view charset)
+{
+    std::pmr::vector<char8_t> out;
+    out.reserve(text.size() * 2);
+    for (std::size_t i = 0; i < iterations; ++i) {
+        out.clear();
+        escape(out, text, charset);
+        bench::do_not_optimize(out.data());
+    }
+}
+
+const std::u8string clean_text = make_text(64 * 1024, 0);
+const std::u8string sparse_text = make_text(64 * 1024, 200);
+const std::u8string dense_text = make_text(64 * 1024, 8);
+
+COWEL_BENCHMARK(html_escape_clean_text)
+{
+    run_escape<append_html_escaped>(iterations, clean_text, u8"&<>");
+}
+
+COWEL_BENCHMARK(html_escape_clean_text_naive)
+{
+    run_escape<append_html_escaped_naive>(iterations, clean_text, u8"&<>");
+}
+
+COWEL_BENCHMARK(html_escape_sparse_text)
+{
+    run_escape<append_html_escaped>(iterations, sparse_text, u8"&<>");
+}
+
+COWEL_BENCHMARK(html_escape_sparse_text_naive)
+{
+    run_escape<append_html_escaped_naive>(iterations, sparse_text, u8"&<>");
+}
+
+COWEL_BENCHMARK(html_escape_dense_text)
+{
+    run_escape<append_html_escaped>(iterations, dense_text, u8"&<>");
+}
+
+COWEL_BENCHMARK(html_escape_dense_text_naive)
+{
+    run_escape<append_html_escaped_naive>(iterations, dense_text, u8"&<>");
+}
+
+COWEL_BENCHMARK(html_escape_attribute)
+{
+    run_escape<append_html_escaped>(iterations, clean_text, u8"\"'");
+}
+
+COWEL_BENCHMARK(html_escape_attribute_naive)
+{
+    run_escape<append_html_escaped_naive>(iterations, clean_text, u8"\"'");
+}
+
+} // namespace
+} // namespace cowel
@@ -0,0 +1,93 @@
+#include <cstddef>
+#include <iterator>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "cowel/util/url_encode.hpp"
+
+#include "benchmark.hpp"
+
+namespace cowel {
+namespace {
+
+/// @brief Returns `count` links resembling those in a bibliography, concatenated.
+[[nodiscard]]
+std::u8string make_links(std::size_t count)
+{
+    constexpr std::u8string_view links[] {
+        u8"https://wg21.link/p2996r13",
+        u8"https://github.com/cplusplus/papers/issues/1668",
+        u8"https://www.open-std.org/jtc1/sc22/wg21/docs/papers/2025/p3491r2.html",
+        u8"https://en.cppreference.com/w/cpp/language/template_parameters#Default_arguments",
+        u8"https://eel.is/c++draft/temp.arg.general#nt:template-argument-list",
+    };
+    std::u8string result;
+    for (std::size_t i = 0; i < count; ++i) {
+        result += links[i % std::size(links)];
+    }
+    return result;
+}
+
+/// @brief Returns text which needs no encoding at all.
+[[nodiscard]]
+std::u8string make_clean(std::size_t length)
+{
+    constexpr std::u8string_view path = u8"/cplusplus/papers/issues/1668/wg21/p2996r13";
+    std::u8string result;
+    while (result.size() < length) {
+        result += path;
+    }
+    return result;
+}
+
+template <auto encode>
+void run_encode(std::size_t iterations, std::u8string_view text)
+{
+    std::pmr::vector<char8_t> out;
+    out.reserve(text.size() * 3);
+    for (std::size_t i = 0; i < iterations; ++i) {
+        out.clear();
+        encode(out, text);
+        bench::do_not_optimize(out.data());
+    }
+}
+
+void append_url_encoded_always(std::pmr::vector<char8_t>& out, std::u8string_view text)
+{
+    append_url_encoded(out, text);
+}
+
+void append_url_encoded_naive(std::pmr::vector<char8_t>& out, std::u8string_view text)
+{
+    url_encode_ascii_if(std::back_inserter(out), text, [](char8_t c) {
+        return is_url_always_encoded(c);
+    });
+}
+
+const std::u8string links = make_links(1000);
+const std::u8string clean_text = make_clean(64 * 1024);
+
+COWEL_BENCHMARK(url_encode_links)
+{
+    run_encode<append_url_encoded_always>(iterations, links);
+}
+
+COWEL_BENCHMARK(url_encode_links_naive)
+{
+    run_encode<append_url_encoded_naive>(iterations, links);
+}
+
+COWEL_BENCHMARK(url_encode_clean_text)
+{
+    run_encode<append_url_encoded_always>(iterations, clean_text);
+}
+
+COWEL_BENCHMARK(url_encode_clean_text_naive)
+{
+    run_encode<append_url_encoded_naive>(iterations, clean_text);
+}
+
+} // namespace
+} // namespace cowel
@@ -0,0 +1,57 @@
+#ifndef COWEL_BENCHMARK_HPP
+#define COWEL_BENCHMARK_HPP
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+namespace cowel::bench {
+
+/// @brief A function which runs the benchmarked code `iterations` times.
+using Benchmark_Function = void(std::size_t iterations);
+
+struct Benchmark {
+    std::string_view name;
+    Benchmark_Function* function;
+};
+
+/// @brief Returns all benchmarks registered using `COWEL_BENCHMARK`.
+[[nodiscard]]
+std::vector<Benchmark>& registered_benchmarks();
+
+struct Benchmark_Registration {
+    Benchmark_Registration(std::string_view name, Benchmark_Function* function)
+    {
+        registered_benchmarks().push_back({ name, function });
+    }
+};
+
+namespace detail {
+
+inline const volatile void* volatile sink;
+
+} // namespace detail
+
+/// @brief Prevents the compiler from optimizing away the computation of `value`.
+template <typename T>
+inline void do_not_optimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    detail::sink = &value;
+#endif
+}
+
+} // namespace cowel::bench
+
+/// @brief Defines a benchmark function with the given `name`,
+/// which takes a `std::size_t iterations` parameter,
+/// and registers it so that it is run by the `cowel-bench` executable.
+/// This shall be used in an unnamed namespace.
+#define COWEL_BENCHMARK(name)                                                                      \
+    void name(std::size_t iterations);                                                             \
+    const ::cowel::bench::Benchmark_Registration name##_registration { #name, name };              \
+    void name(std::size_t iterations)
+
+#endif
@@ -0,0 +1,73 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <string_view>
+#include <vector>
+
+#include "benchmark.hpp"
+
+namespace cowel::bench {
+
+std::vector<Benchmark>& registered_benchmarks()
+{
+    static std::vector<Benchmark> result;
+    return result;
+}
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr auto min_duration = std::chrono::milliseconds(200);
+
+[[nodiscard]]
+Clock::duration time(Benchmark_Function* function, std::size_t iterations)
+{
+    const Clock::time_point start = Clock::now();
+    function(iterations);
+    return Clock::now() - start;
+}
+
+void run(const Benchmark& benchmark)
+{
+    // Double the iteration count until the benchmark runs for long enough
+    // to produce a meaningful measurement.
+    std::size_t iterations = 1;
+    Clock::duration duration = time(benchmark.function, iterations);
+    while (duration < min_duration) {
+        iterations *= 2;
+        duration = time(benchmark.function, iterations);
+    }
+    const double nanoseconds = std::chrono::duration<double, std::nano>(duration).count();
+    std::printf(
+        "%-48.*s %14.2f ns/iteration %12zu iterations\n", int(benchmark.name.size()),
+        benchmark.name.data(), nanoseconds / double(iterations), iterations
+    );
+}
+
+} // namespace
+} // namespace cowel::bench
+
+int main(int argc, char** argv)
+{
+    using namespace cowel::bench;
+
+    // If arguments are provided, only the benchmarks whose name contains any of them are run.
+    const auto is_selected = [&](std::string_view name) -> bool {
+        if (argc <= 1) {
+            return true;
+        }
+        for (int i = 1; i < argc; ++i) {
+            if (name.find(argv[i]) != std::string_view::npos) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    for (const Benchmark& benchmark : registered_benchmarks()) {
+        if (is_selected(benchmark.name)) {
+            run(benchmark);
+        }
+    }
+}
@@ -11,39 +11,25 @@ namespace cowel {
 
 void match_parameters_and_arguments(
     std::span<int> out_indices,
-    std::span<Argument_Status> out_status,
-    std::span<const std::u8string_view> parameters,
+    const Parameter_Schema& parameters,
     std::span<const ast::Argument> arguments,
     Parameter_Match_Mode mode
 )
 {
     COWEL_ASSERT(out_indices.size() == parameters.size());
-    COWEL_ASSERT(out_status.size() == arguments.size());
 
     for (int& i : out_indices) {
         i = -1;
     }
-    for (Argument_Status& s : out_status) {
-        s = Argument_Status::unmatched;
-    }
 
     if (mode != Parameter_Match_Mode::only_positional) {
         for (std::size_t arg_index = 0; arg_index < arguments.size(); ++arg_index) {
             if (!arguments[arg_index].has_name()) {
                 continue;
             }
-            const std::u8string_view arg_name = arguments[arg_index].get_name();
-            for (std::size_t i = 0; i < parameters.size(); ++i) {
-                if (arg_name == parameters[i]) {
-                    if (out_indices[i] == -1) {
-                        out_indices[i] = int(arg_index);
-                        out_status[arg_index] = Argument_Status::ok;
-                    }
-                    else {
-                        out_status[arg_index] = Argument_Status::duplicate_named;
-                    }
-                    break;
-                }
+            const int i = parameters.index_of(arguments[arg_index].get_name());
+            if (i >= 0 && out_indices[std::size_t(i)] == -1) {
+                out_indices[std::size_t(i)] = int(arg_index);
             }
         }
     }
@@ -56,7 +42,6 @@ void match_parameters_and_arguments(
             for (std::size_t i = 0; i < parameters.size(); ++i) {
                 if (out_indices[i] == -1) {
                     out_indices[i] = int(arg_index);
-                    out_status[arg_index] = Argument_Status::ok;
                 }
                 break;
             }
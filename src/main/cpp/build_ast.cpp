@@ -13,6 +13,7 @@
 #include "cowel/ast.hpp"
 #include "cowel/fwd.hpp"
 #include "cowel/parse.hpp"
+#include "cowel/parse_utils.hpp"
 
 namespace cowel {
 
@@ -57,29 +58,61 @@ Directive::Directive(
     std::pmr::vector<Argument>&& args,
     std::pmr::vector<Content>&& block
 )
-    : m_source_span { source_span }
-    , m_source { source }
-    , m_name { name }
-    , m_arguments { std::move(args) }
-    , m_content { std::move(block) }
 {
-    COWEL_ASSERT(m_source_span.length == m_source.length());
+    COWEL_ASSERT(source_span.length == source.length());
     COWEL_ASSERT(!name.empty());
     COWEL_ASSERT(!name.starts_with(u8'\\'));
     COWEL_ASSERT(name.length() <= source_span.length);
+
+    const std::pmr::polymorphic_allocator<> alloc { block.get_allocator().resource() };
+    m_data = std::allocate_shared<const Data>(
+        alloc, Data { .source_span = source_span,
+                      .source = source,
+                      .name = name,
+                      .arguments = Shared_Nodes<Argument> { std::move(args) },
+                      .content = Shared_Nodes<Content> { std::move(block) },
+                      .memory = alloc.resource() }
+    );
 }
 
-Text::Text(const File_Source_Span8& source_span, std::u8string_view source)
-    : m_source_span { source_span }
-    , m_source { source }
+Directive::Directive(const Directive& other, std::pmr::vector<Content>&& block)
+{
+    const std::pmr::polymorphic_allocator<> alloc { block.get_allocator().resource() };
+    m_data = std::allocate_shared<const Data>(
+        alloc, Data { .source_span = other.m_data->source_span,
+                      .source = other.m_data->source,
+                      .name = other.m_data->name,
+                      .arguments = other.m_data->arguments,
+                      .content = Shared_Nodes<Content> { std::move(block) },
+                      .memory = alloc.resource() }
+    );
+}
+
+Text::Text(
+    const File_Source_Span8& source_span,
+    std::u8string_view source,
+    bool needs_html_escaping,
+    bool contains_blank_line
+)
+    : m_position { source_span } // NOLINT(cppcoreguidelines-slicing)
+    , m_file_name { source_span.file_name }
+    , m_source { source.data() }
+    , m_length { source_span.length & max_length }
+    , m_needs_html_escaping { needs_html_escaping }
+    , m_contains_blank_line { contains_blank_line }
 {
     COWEL_ASSERT(!source_span.empty());
     COWEL_ASSERT(source.length() == source_span.length);
+    COWEL_ASSERT(source_span.length <= max_length);
+    COWEL_DEBUG_ASSERT(needs_html_escaping || !source.contains(u8'&'));
+    COWEL_DEBUG_ASSERT(needs_html_escaping || !source.contains(u8'<'));
+    COWEL_DEBUG_ASSERT(needs_html_escaping || !source.contains(u8'>'));
+    COWEL_DEBUG_ASSERT(contains_blank_line || !find_blank_line_sequence(source));
 }
 
 Escaped::Escaped(const File_Source_Span8& source_span, std::u8string_view source)
     : m_source_span { source_span }
-    , m_source { source }
+    , m_source { source.data() }
 {
     COWEL_ASSERT(source_span.length == 2);
     COWEL_ASSERT(source.length() == 2);
@@ -227,7 +260,9 @@ private:
         COWEL_ASSERT(instruction.type == AST_Instruction_Type::text);
 
         const File_Source_Span8 span { m_pos, instruction.n, m_file };
-        ast::Text result { span, extract(span) };
+        ast::Text result {
+            span, extract(span), instruction.needs_html_escaping, instruction.contains_blank_line
+        };
         advance_by(instruction.n);
         return result;
     }
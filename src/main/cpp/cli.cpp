@@ -1,20 +1,31 @@
+#include <cstddef>
 #include <cstdio>
 #include <filesystem>
 #include <map>
+#include <memory>
 #include <memory_resource>
+#include <optional>
+#include <span>
 #include <string_view>
 #include <vector>
 
 #include "cowel/util/annotated_string.hpp"
 #include "cowel/util/ansi.hpp"
+#include "cowel/util/counting_memory_resource.hpp"
+#include "cowel/util/from_chars.hpp"
+#include "cowel/util/io.hpp"
 #include "cowel/util/strings.hpp"
 
 #include "cowel/builtin_directive_set.hpp"
+#include "cowel/compression.hpp"
 #include "cowel/diagnostic.hpp"
 #include "cowel/document_content_behavior.hpp"
 #include "cowel/document_generation.hpp"
+#include "cowel/macro_profile.hpp"
+#include "cowel/memory_profile.hpp"
 #include "cowel/parse.hpp"
 #include "cowel/print.hpp"
+#include "cowel/services.hpp"
 #include "cowel/ulight_highlighter.hpp"
 
 namespace cowel {
@@ -159,6 +170,179 @@ struct Stderr_Logger final : Logger {
     }
 };
 
+/// @brief Writes the document to a file as it is generated.
+struct File_Output_Sink final : Output_Sink {
+    std::FILE* file;
+    bool any_errors = false;
+
+    [[nodiscard]]
+    explicit File_Output_Sink(std::FILE* file)
+        : file { file }
+    {
+    }
+
+    void operator()(std::u8string_view text) final
+    {
+        any_errors |= std::fwrite(text.data(), 1, text.size(), file) != text.size();
+    }
+
+    void write_vectored(std::span<const std::u8string_view> pieces) final
+    {
+        any_errors |= !write_to_file(file, pieces);
+    }
+};
+
+/// @brief Forwards the document to multiple sinks,
+/// such as the uncompressed output file and its compressed copies.
+struct Multi_Output_Sink final : Output_Sink {
+    std::span<Output_Sink* const> sinks;
+
+    [[nodiscard]]
+    explicit Multi_Output_Sink(std::span<Output_Sink* const> sinks)
+        : sinks { sinks }
+    {
+    }
+
+    void operator()(std::u8string_view text) final
+    {
+        for (Output_Sink* const sink : sinks) {
+            (*sink)(text);
+        }
+    }
+
+    void write_vectored(std::span<const std::u8string_view> pieces) final
+    {
+        for (Output_Sink* const sink : sinks) {
+            sink->write_vectored(pieces);
+        }
+    }
+};
+
+/// @brief A compressed copy of the output file,
+/// written next to it with the extension of the compression appended.
+struct Compressed_Output {
+    std::pmr::string path;
+    Unique_File file;
+    File_Output_Sink file_sink;
+    std::unique_ptr<Compressing_Output_Sink> sink;
+
+    [[nodiscard]]
+    Compressed_Output(std::pmr::string&& path, Unique_File&& file)
+        : path { std::move(path) }
+        , file { std::move(file) }
+        , file_sink { this->file.get() }
+    {
+    }
+
+    Compressed_Output(const Compressed_Output&) = delete;
+    Compressed_Output& operator=(const Compressed_Output&) = delete;
+};
+
+struct Command_Line_Options {
+    std::string_view macro_profile_path;
+    std::string_view memory_profile_path;
+    Macro_Budget macro_budget;
+    bool fold_constants = false;
+    bool memory_statistics = false;
+    bool minify = false;
+    bool gzip = false;
+    bool zstd = false;
+};
+
+/// @brief Parses the options following the input and output file.
+/// @returns `true` if all options were valid.
+[[nodiscard]]
+bool parse_options(Command_Line_Options& out, std::span<const char* const> args)
+{
+    const auto parse_size = [](std::size_t& out, std::string_view value) {
+        const std::optional<std::size_t> result = from_chars<std::size_t>(value);
+        if (!result) {
+            return false;
+        }
+        out = *result;
+        return true;
+    };
+
+    for (const std::string_view arg : args) {
+        constexpr std::string_view macro_profile = "--macro-profile=";
+        constexpr std::string_view macro_max_depth = "--macro-max-depth=";
+        constexpr std::string_view macro_max_nodes = "--macro-max-nodes=";
+        constexpr std::string_view memory_profile = "--memory-profile=";
+
+        if (arg == "--fold-constants") {
+            out.fold_constants = true;
+        }
+        else if (arg == "--memory-statistics") {
+            out.memory_statistics = true;
+        }
+        else if (arg == "--minify") {
+            out.minify = true;
+        }
+        else if (arg == "--gzip") {
+            out.gzip = true;
+        }
+        else if (arg == "--zstd") {
+            out.zstd = true;
+        }
+        else if (arg.starts_with(memory_profile)) {
+            out.memory_profile_path = arg.substr(memory_profile.size());
+        }
+        else if (arg.starts_with(macro_profile)) {
+            out.macro_profile_path = arg.substr(macro_profile.size());
+        }
+        else if (arg.starts_with(macro_max_depth)) {
+            if (!parse_size(out.macro_budget.max_depth, arg.substr(macro_max_depth.size()))) {
+                return false;
+            }
+        }
+        else if (arg.starts_with(macro_max_nodes)) {
+            if (!parse_size(
+                    out.macro_budget.max_expanded_nodes, arg.substr(macro_max_nodes.size())
+                )) {
+                return false;
+            }
+        }
+        else {
+            return false;
+        }
+    }
+    return true;
+}
+
+void print_file_error(
+    std::string_view path,
+    std::u8string_view message,
+    std::pmr::memory_resource* memory
+)
+{
+    Diagnostic_String error { memory };
+    print_location_of_file(error, as_u8string_view(path));
+    error.append(u8' ');
+    error.append(message);
+    print_code_string_stderr(error);
+}
+
+[[nodiscard]]
+bool write_file(
+    std::string_view path,
+    std::span<const char8_t> data,
+    std::pmr::memory_resource* memory
+)
+{
+    auto file = fopen_unique(path.data(), "wb");
+    if (!file) {
+        print_file_error(path, u8"Failed to open file.", memory);
+        return false;
+    }
+    bool any_errors = std::fwrite(data.data(), 1, data.size(), file.get()) != data.size();
+    any_errors |= std::fclose(file.release()) != 0;
+    if (any_errors) {
+        print_file_error(path, u8"Failed to write file.", memory);
+        return false;
+    }
+    return true;
+}
+
 int main(int argc, const char* const* argv)
 {
     if (argc < 1) {
@@ -168,11 +352,23 @@ int main(int argc, const char* const* argv)
 
     std::pmr::unsynchronized_pool_resource memory;
 
-    if (argc < 3) {
+    Command_Line_Options cli_options;
+    if (argc < 3
+        || !parse_options(cli_options, std::span { argv + 3, std::size_t(argc - 3) })) {
         Basic_Annotated_String<char8_t, Diagnostic_Highlight> error { &memory };
         error.append(u8"Usage: ");
         error.append(program_name);
-        error.append(u8" IN_FILE.cowel OUT_FILE.html\n");
+        error.append(u8" IN_FILE.cowel OUT_FILE.html [OPTIONS...]\n");
+        error.append(u8"Options:\n");
+        error.append(u8"  --fold-constants           precompute constant directives\n");
+        error.append(u8"  --gzip                     also write OUT_FILE.html.gz\n");
+        error.append(u8"  --macro-profile=FILE.json  write macro expansion statistics to a file\n");
+        error.append(u8"  --macro-max-depth=N        limit the nesting depth of macros\n");
+        error.append(u8"  --macro-max-nodes=N        limit the total nodes produced by macros\n");
+        error.append(u8"  --memory-profile=FILE.json write memory usage per phase to a file\n");
+        error.append(u8"  --memory-statistics        print memory usage per phase\n");
+        error.append(u8"  --minify                   collapse whitespace and remove comments\n");
+        error.append(u8"  --zstd                     also write OUT_FILE.html.zst\n");
         print_code_string_stderr(error);
         return EXIT_FAILURE;
     }
@@ -182,11 +378,36 @@ int main(int argc, const char* const* argv)
     auto in_path_directory = std::filesystem::path { in_path }.parent_path();
 
     const std::string_view out_path = argv[2];
-    const std::u8string_view out_path_u8 = as_u8string_view(out_path);
     constexpr std::u8string_view theme_path = u8"ulight/themes/wg21.json";
 
+    // When memory usage is profiled, the persistent memory, the transient memory,
+    // and the memory of loaded files are counted separately.
+    const bool profile_memory
+        = cli_options.memory_statistics || !cli_options.memory_profile_path.empty();
+    Counting_Memory_Resource persistent_counter { &memory };
+    Counting_Memory_Resource file_counter { &memory };
+    std::pmr::unsynchronized_pool_resource transient_pool { &memory };
+    Counting_Memory_Resource transient_counter { &transient_pool };
+    std::pmr::memory_resource* persistent_memory = &memory;
+    std::pmr::memory_resource* file_memory = &memory;
+
+    Memory_Profile memory_profile { &memory };
+    const auto enter_phase = [&](Memory_Phase phase) {
+        if (profile_memory) {
+            memory_profile.enter_phase(phase);
+        }
+    };
+    if (profile_memory) {
+        persistent_memory = &persistent_counter;
+        file_memory = &file_counter;
+        memory_profile.add_resource(u8"persistent", persistent_counter);
+        memory_profile.add_resource(u8"transient", transient_counter);
+        memory_profile.add_resource(u8"files", file_counter);
+    }
+
+    enter_phase(Memory_Phase::load);
     const Result<std::pmr::vector<char8_t>, IO_Error_Code> in_text
-        = load_utf8_file(in_path_u8, &memory);
+        = load_utf8_file(in_path_u8, file_memory);
     if (!in_text) {
         Diagnostic_String error { &memory };
         print_io_error(error, in_path_u8, in_text.error());
@@ -195,7 +416,7 @@ int main(int argc, const char* const* argv)
     }
 
     const Result<std::pmr::vector<char8_t>, IO_Error_Code> theme_json
-        = load_utf8_file(theme_path, &memory);
+        = load_utf8_file(theme_path, file_memory);
     if (!theme_json) {
         Diagnostic_String error { &memory };
         print_io_error(error, in_path_u8, in_text.error());
@@ -203,23 +424,72 @@ int main(int argc, const char* const* argv)
         return EXIT_FAILURE;
     }
 
-    std::pmr::vector<char8_t> out_text { &memory };
+    std::pmr::vector<char8_t> out_text { persistent_memory };
     const std::u8string_view in_source { in_text->data(), in_text->size() };
     const std::u8string_view theme_source { theme_json->data(), theme_json->size() };
 
     Builtin_Directive_Set builtin_directives {};
     Document_Content_Behavior behavior { builtin_directives.get_macro_behavior() };
-    Relative_File_Loader file_loader { std::move(in_path_directory), &memory };
+    Relative_File_Loader file_loader { std::move(in_path_directory), file_memory };
     Stderr_Logger logger { file_loader, &memory };
     static constinit Ulight_Syntax_Highlighter highlighter;
+    Macro_Profile macro_profile { &memory };
 
-    const std::pmr::vector<ast::Content> root_content = parse_and_build(
-        in_source, in_path_u8, &memory,
+    enter_phase(Memory_Phase::parse);
+    std::pmr::vector<AST_Instruction> instructions { persistent_memory };
+    parse(instructions, in_source);
+
+    enter_phase(Memory_Phase::build_ast);
+    const std::pmr::vector<ast::Content> root_content = build_ast(
+        in_source, in_path_u8, instructions, persistent_memory,
         [&](std::u8string_view id, File_Source_Span8 pos, std::u8string_view message) {
             logger(Diagnostic { Severity::error, id, pos, { &message, 1 } });
         }
     );
 
+    // The sections of the document are generated in memory,
+    // but the document is written to the output file while references between sections
+    // are being resolved, rather than being assembled as another copy first.
+    Unique_File out_file = fopen_unique(out_path.data(), "wb");
+    if (!out_file) {
+        print_file_error(out_path, u8"Failed to open file.", &memory);
+        return EXIT_FAILURE;
+    }
+    File_Output_Sink output_sink { out_file.get() };
+
+    // Compressed copies are produced from the same stream of output,
+    // so compression is interleaved with writing rather than being a separate pass.
+    std::optional<Compressed_Output> compressed_outputs[2];
+    Output_Sink* sinks[std::size(compressed_outputs) + 1] { &output_sink };
+    std::size_t sink_count = 1;
+    const auto add_compressed_output = [&](Compression compression) -> bool {
+        std::pmr::string path { out_path, &memory };
+        path += as_string_view(compression_file_extension(compression));
+        if (!is_compression_supported(compression)) {
+            print_file_error(path, u8"Compression is not supported by this build.", &memory);
+            return false;
+        }
+        Unique_File file = fopen_unique(path.c_str(), "wb");
+        if (!file) {
+            print_file_error(path, u8"Failed to open file.", &memory);
+            return false;
+        }
+        Compressed_Output& output
+            = compressed_outputs[sink_count - 1].emplace(std::move(path), std::move(file));
+        output.sink = make_compressing_output_sink(compression, output.file_sink, &memory);
+        if (!output.sink) {
+            print_file_error(output.path, u8"Failed to initialize compression.", &memory);
+            return false;
+        }
+        sinks[sink_count++] = output.sink.get();
+        return true;
+    };
+    if ((cli_options.gzip && !add_compressed_output(Compression::gzip))
+        || (cli_options.zstd && !add_compressed_output(Compression::zstd))) {
+        return EXIT_FAILURE;
+    }
+    Multi_Output_Sink multi_sink { std::span { sinks, sink_count } };
+
     const Generation_Options options { .output = out_text,
                                        .root_behavior = behavior,
                                        .root_content = root_content,
@@ -228,19 +498,67 @@ int main(int argc, const char* const* argv)
                                        .file_loader = file_loader,
                                        .logger = logger,
                                        .highlighter = highlighter,
-                                       .memory = &memory };
+                                       .macro_budget = cli_options.macro_budget,
+                                       .macro_profile = cli_options.macro_profile_path.empty()
+                                           ? nullptr
+                                           : &macro_profile,
+                                       .fold_constants = cli_options.fold_constants,
+                                       .memory_profile = profile_memory ? &memory_profile
+                                                                        : nullptr,
+                                       .output_sink = &multi_sink,
+                                       .minify = cli_options.minify,
+                                       .memory = persistent_memory,
+                                       .transient_memory = profile_memory ? &transient_counter
+                                                                          : nullptr };
     generate_document(options);
 
-    const auto out_file = fopen_unique(out_path.data(), "wb");
-    if (!out_file) {
-        Diagnostic_String error { &memory };
-        print_location_of_file(error, out_path_u8);
-        error.append(u8" Failed to open file.");
-        print_code_string_stderr(error);
+    enter_phase(Memory_Phase::output);
+    COWEL_ASSERT(out_text.empty());
+    output_sink.any_errors |= std::fclose(out_file.release()) != 0;
+    if (output_sink.any_errors) {
+        print_file_error(out_path, u8"Failed to write file.", &memory);
         return EXIT_FAILURE;
     }
+    for (std::optional<Compressed_Output>& output : compressed_outputs) {
+        if (!output) {
+            continue;
+        }
+        const bool compressed = output->sink->finish();
+        output->file_sink.any_errors |= std::fclose(output->file.release()) != 0;
+        if (!compressed) {
+            print_file_error(output->path, u8"Failed to compress output.", &memory);
+            return EXIT_FAILURE;
+        }
+        if (output->file_sink.any_errors) {
+            print_file_error(output->path, u8"Failed to write file.", &memory);
+            return EXIT_FAILURE;
+        }
+    }
+    memory_profile.end_phase();
+
+    if (!cli_options.macro_profile_path.empty()) {
+        std::pmr::vector<char8_t> profile_json { &memory };
+        write_macro_profile_json(profile_json, macro_profile);
+        if (!write_file(cli_options.macro_profile_path, profile_json, &memory)) {
+            return EXIT_FAILURE;
+        }
+    }
 
-    std::fwrite(out_text.data(), 1, out_text.size(), out_file.get());
+    if (!cli_options.memory_profile_path.empty()) {
+        std::pmr::vector<char8_t> profile_json { &memory };
+        write_memory_profile_json(profile_json, memory_profile);
+        if (!write_file(cli_options.memory_profile_path, profile_json, &memory)) {
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (cli_options.memory_statistics) {
+        std::pmr::vector<char8_t> table { &memory };
+        write_memory_profile_text(table, memory_profile);
+        Diagnostic_String out { &memory };
+        out.append(as_u8string_view(table));
+        print_code_string_stderr(out);
+    }
 
     return logger.any_errors ? EXIT_FAILURE : EXIT_SUCCESS;
 }
@@ -0,0 +1,237 @@
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <string_view>
+#include <vector>
+
+#ifdef COWEL_GZIP
+#include <zlib.h>
+#endif
+#ifdef COWEL_ZSTD
+#include <zstd.h>
+#endif
+
+#include "cowel/compression.hpp"
+#include "cowel/services.hpp"
+
+namespace cowel {
+namespace {
+
+/// @brief The size of the buffer that compressed output is collected in
+/// before being passed on to the underlying sink.
+constexpr std::size_t compressed_buffer_size = std::size_t(1) << 16;
+
+#ifdef COWEL_GZIP
+struct Gzip_Output_Sink final : Compressing_Output_Sink {
+private:
+    // The window bits are increased by 16 to obtain a gzip header and trailer
+    // instead of a zlib wrapper.
+    static constexpr int window_bits = 15 + 16;
+    static constexpr int memory_level = 8;
+    // Generation is usually fast enough that a higher level would make compression
+    // the most expensive part of producing the document.
+    static constexpr int compression_level = Z_DEFAULT_COMPRESSION;
+
+    Output_Sink& m_out;
+    std::pmr::vector<unsigned char> m_buffer;
+    z_stream m_stream {};
+    bool m_initialized = false;
+    bool m_failed = false;
+
+public:
+    [[nodiscard]]
+    Gzip_Output_Sink(Output_Sink& out, std::pmr::memory_resource* memory)
+        : m_out { out }
+        , m_buffer(compressed_buffer_size, memory)
+    {
+        m_initialized = deflateInit2(
+                            &m_stream, compression_level, Z_DEFLATED, window_bits, memory_level,
+                            Z_DEFAULT_STRATEGY
+                        )
+            == Z_OK;
+    }
+
+    Gzip_Output_Sink(const Gzip_Output_Sink&) = delete;
+    Gzip_Output_Sink& operator=(const Gzip_Output_Sink&) = delete;
+
+    ~Gzip_Output_Sink() final
+    {
+        if (m_initialized) {
+            deflateEnd(&m_stream);
+        }
+    }
+
+    [[nodiscard]]
+    bool is_initialized() const noexcept
+    {
+        return m_initialized;
+    }
+
+    void operator()(std::u8string_view text) final
+    {
+        // The input size is limited to uInt, which may be narrower than std::size_t.
+        constexpr std::size_t max_input = std::numeric_limits<uInt>::max();
+        while (!text.empty()) {
+            const std::u8string_view input = text.substr(0, max_input);
+            // zlib takes the input as a pointer to non-const, but does not modify it.
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+            m_stream.next_in = reinterpret_cast<Bytef*>(const_cast<char8_t*>(input.data()));
+            m_stream.avail_in = uInt(input.size());
+            deflate_all(Z_NO_FLUSH);
+            text.remove_prefix(input.size());
+        }
+    }
+
+    [[nodiscard]]
+    bool finish() final
+    {
+        m_stream.next_in = nullptr;
+        m_stream.avail_in = 0;
+        deflate_all(Z_FINISH);
+        return !m_failed;
+    }
+
+private:
+    void deflate_all(int flush)
+    {
+        while (!m_failed) {
+            m_stream.next_out = m_buffer.data();
+            m_stream.avail_out = uInt(m_buffer.size());
+            const int result = deflate(&m_stream, flush);
+            if (result == Z_STREAM_ERROR) {
+                m_failed = true;
+                return;
+            }
+            const std::size_t produced = m_buffer.size() - m_stream.avail_out;
+            if (produced != 0) {
+                m_out({ reinterpret_cast<const char8_t*>(m_buffer.data()), produced });
+            }
+            const bool done = flush == Z_FINISH ? result == Z_STREAM_END
+                                                : m_stream.avail_in == 0 && m_stream.avail_out != 0;
+            if (done) {
+                return;
+            }
+        }
+    }
+};
+#endif
+
+#ifdef COWEL_ZSTD
+struct Zstd_Output_Sink final : Compressing_Output_Sink {
+private:
+    // See Gzip_Output_Sink::compression_level.
+    static constexpr int compression_level = ZSTD_CLEVEL_DEFAULT;
+
+    Output_Sink& m_out;
+    std::pmr::vector<char8_t> m_buffer;
+    ZSTD_CCtx* m_context;
+    bool m_failed = false;
+
+public:
+    [[nodiscard]]
+    Zstd_Output_Sink(Output_Sink& out, std::pmr::memory_resource* memory)
+        : m_out { out }
+        , m_buffer(compressed_buffer_size, memory)
+        , m_context { ZSTD_createCCtx() }
+    {
+        if (m_context) {
+            m_failed = ZSTD_isError(
+                ZSTD_CCtx_setParameter(m_context, ZSTD_c_compressionLevel, compression_level)
+            );
+        }
+    }
+
+    Zstd_Output_Sink(const Zstd_Output_Sink&) = delete;
+    Zstd_Output_Sink& operator=(const Zstd_Output_Sink&) = delete;
+
+    ~Zstd_Output_Sink() final
+    {
+        ZSTD_freeCCtx(m_context);
+    }
+
+    [[nodiscard]]
+    bool is_initialized() const noexcept
+    {
+        return m_context != nullptr;
+    }
+
+    void operator()(std::u8string_view text) final
+    {
+        compress_all(text, ZSTD_e_continue);
+    }
+
+    [[nodiscard]]
+    bool finish() final
+    {
+        compress_all({}, ZSTD_e_end);
+        return !m_failed;
+    }
+
+private:
+    void compress_all(std::u8string_view text, ZSTD_EndDirective directive)
+    {
+        ZSTD_inBuffer input { text.data(), text.size(), 0 };
+        while (!m_failed) {
+            ZSTD_outBuffer output { m_buffer.data(), m_buffer.size(), 0 };
+            const std::size_t remaining
+                = ZSTD_compressStream2(m_context, &output, &input, directive);
+            if (ZSTD_isError(remaining)) {
+                m_failed = true;
+                return;
+            }
+            if (output.pos != 0) {
+                m_out({ m_buffer.data(), output.pos });
+            }
+            // When ending the frame, the return value is the amount of bytes left to flush.
+            // Otherwise, we are done once all input has been consumed.
+            const bool done = directive == ZSTD_e_end ? remaining == 0 : input.pos == input.size;
+            if (done) {
+                return;
+            }
+        }
+    }
+};
+#endif
+
+} // namespace
+
+bool is_compression_supported(Compression compression) noexcept
+{
+    switch (compression) {
+#ifdef COWEL_GZIP
+    case Compression::gzip: return true;
+#endif
+#ifdef COWEL_ZSTD
+    case Compression::zstd: return true;
+#endif
+    default: return false;
+    }
+}
+
+std::unique_ptr<Compressing_Output_Sink> make_compressing_output_sink(
+    [[maybe_unused]] Compression compression,
+    [[maybe_unused]] Output_Sink& out,
+    [[maybe_unused]] std::pmr::memory_resource* memory
+)
+{
+#ifdef COWEL_GZIP
+    if (compression == Compression::gzip) {
+        auto result = std::make_unique<Gzip_Output_Sink>(out, memory);
+        if (result->is_initialized()) {
+            return result;
+        }
+    }
+#endif
+#ifdef COWEL_ZSTD
+    if (compression == Compression::zstd) {
+        auto result = std::make_unique<Zstd_Output_Sink>(out, memory);
+        if (result->is_initialized()) {
+            return result;
+        }
+    }
+#endif
+    return nullptr;
+}
+
+} // namespace cowel
@@ -1,4 +1,6 @@
+#include <algorithm>
 #include <cstddef>
+#include <memory_resource>
 #include <ranges>
 #include <span>
 #include <string_view>
@@ -21,6 +23,7 @@
 #include "cowel/directive_arguments.hpp"
 #include "cowel/directive_behavior.hpp"
 #include "cowel/directive_processing.hpp"
+#include "cowel/plaintext_memo.hpp"
 #include "cowel/services.hpp"
 
 namespace cowel {
@@ -135,11 +138,19 @@ void to_plaintext_trimmed(
             append(out, text.get_source());
         }
 
-        void operator()(const ast::Generated&) const
+        void operator()(const ast::Generated& generated) const
         {
-            COWEL_ASSERT_UNREACHABLE(
-                u8"There should be no generated content in a plaintext context."
-            );
+            // Generated content can only be encountered here when constant folding has replaced
+            // pure plaintext directives, and such directives never produce HTML.
+            COWEL_ASSERT(generated.get_type() == ast::Generated_Type::plaintext);
+            std::u8string_view str = generated.as_string();
+            if (i == 0) {
+                str = trim_ascii_blank_left(str);
+            }
+            if (i + 1 == content.size()) {
+                str = trim_ascii_blank_right(str);
+            }
+            append(out, str);
         }
 
         void operator()(const ast::Escaped& e) const
@@ -203,6 +214,9 @@ To_Plaintext_Status to_plaintext(
         return To_Plaintext_Status::error;
     }
 
+    const auto arena_scope = context.enter_transient_arena_scoped(
+        !context.is_in_transient_arena() && is_pure_directive(d, context)
+    );
     switch (behavior->category) {
     case Directive_Category::pure_plaintext: {
         behavior->generate_plaintext(out, d, context);
@@ -248,6 +262,119 @@ To_Plaintext_Status to_plaintext(
     return result;
 }
 
+namespace {
+
+[[nodiscard]]
+bool compute_is_pure_directive(const ast::Directive& d, Context& context)
+{
+    const Directive_Behavior* const behavior = context.find_directive(d);
+    if (!behavior) {
+        return false;
+    }
+    switch (behavior->category) {
+    case Directive_Category::pure_plaintext:
+    case Directive_Category::pure_html:
+    case Directive_Category::formatting: break;
+    case Directive_Category::meta:
+    case Directive_Category::macro: return false;
+    }
+    if (!behavior->is_pure()) {
+        return false;
+    }
+    for (const ast::Argument& arg : d.get_arguments()) {
+        if (!is_pure_content(arg.get_content(), context)) {
+            return false;
+        }
+    }
+    return is_pure_content(d.get_content(), context);
+}
+
+} // namespace
+
+bool is_pure_directive(const ast::Directive& d, Context& context)
+{
+    // Directives in transient memory (e.g. those produced by macro instantiation)
+    // may be destroyed during generation, and another directive could then have the same
+    // identity, so only directives that outlive the memo (i.e. those of the document)
+    // are memoized.
+    if (context.is_transient_memory(d.get_memory_resource())) {
+        return compute_is_pure_directive(d, context);
+    }
+    // Memoization ensures that purity is computed once per directive,
+    // rather than once for every enclosing directive.
+    if (const auto it = context.get_purity_memo().find(d.identity());
+        it != context.get_purity_memo().end()) {
+        return it->second;
+    }
+    const bool result = compute_is_pure_directive(d, context);
+    context.get_purity_memo().emplace(d.identity(), result);
+    return result;
+}
+
+bool is_pure_content(std::span<const ast::Content> content, Context& context)
+{
+    for (const ast::Content& c : content) {
+        const auto* const d = std::get_if<ast::Directive>(&c);
+        if (d && !is_pure_directive(*d, context)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+To_Plaintext_Status to_plaintext_memoized(
+    std::pmr::vector<char8_t>& out,
+    const ast::Shared_Nodes<ast::Content>& content,
+    Context& context,
+    To_Plaintext_Mode mode
+)
+{
+    const std::span<const ast::Content> nodes = content.get();
+    // Without directives, conversion is a mere copy, and memoization would not help.
+    const bool has_directives = std::ranges::any_of(nodes, [](const ast::Content& c) {
+        return std::holds_alternative<ast::Directive>(c);
+    });
+    if (!has_directives) {
+        return to_plaintext(out, nodes, context, mode);
+    }
+
+    // Content in transient memory (e.g. the content of an instantiated macro,
+    // possibly within the transient arena) may be destroyed during generation,
+    // and other content could then have the same identity.
+    // It is also rarely converted more than once, so it is not memoized.
+    if (context.is_transient_memory(content.get_memory_resource())) {
+        return to_plaintext(out, nodes, context, mode);
+    }
+
+    Plaintext_Memo_Statistics& statistics = context.get_plaintext_memo_statistics();
+    ++statistics.lookups;
+
+    auto& memo = context.get_plaintext_memo();
+    const Plaintext_Memo_Key key { .content = content.identity(), .mode = mode };
+    if (const auto it = memo.find(key); it != memo.end()) {
+        ++statistics.hits;
+        append(out, as_u8string_view(it->second.plaintext));
+        return it->second.status;
+    }
+    if (memo.size() >= plaintext_memo_max_entries || !is_pure_content(nodes, context)) {
+        return to_plaintext(out, nodes, context, mode);
+    }
+
+    // The entry outlives any Scoped_Transient_Arena, so it must not use the arena.
+    Plaintext_Memo_Entry entry { .plaintext
+                                 = std::pmr::vector<char8_t>(memo.get_allocator().resource()) };
+    const std::size_t initial_diagnostics = context.get_emitted_diagnostic_count();
+    entry.status = to_plaintext(entry.plaintext, nodes, context, mode);
+    append(out, as_u8string_view(entry.plaintext));
+
+    const To_Plaintext_Status result = entry.status;
+    // Diagnostics would not be emitted again if the memoized result was used.
+    if (context.get_emitted_diagnostic_count() == initial_diagnostics) {
+        memo.emplace(key, std::move(entry));
+    }
+    return result;
+}
+
 void to_plaintext_mapped_for_highlighting(
     std::pmr::vector<char8_t>& out,
     std::pmr::vector<std::size_t>& out_mapping,
@@ -258,7 +385,12 @@ void to_plaintext_mapped_for_highlighting(
     std::visit(
         [&]<typename T>(const T& x) {
             if constexpr (std::is_same_v<T, ast::Generated>) {
-                COWEL_ASSERT_UNREACHABLE(u8"Generated content during syntax highlighting?!");
+                // Like pure plaintext directives (see below),
+                // constant-folded content maps all of its characters to the start of its source.
+                COWEL_ASSERT(x.get_source_span());
+                COWEL_ASSERT(x.get_type() == ast::Generated_Type::plaintext);
+                append(out, x.as_string());
+                out_mapping.insert(out_mapping.end(), x.size(), x.get_source_span()->begin);
             }
             else {
                 to_plaintext_mapped_for_highlighting(out, out_mapping, x, context);
@@ -335,6 +467,7 @@ void to_plaintext_mapped_for_highlighting(
     // are not actually within the source highlighting block.
     // However, that's not really a problem; subsequent functionality can deal with that.
     case Directive_Category::macro: {
+        const auto scope = context.enter_macro_scoped(d.get_name());
         const std::pmr::vector<ast::Content> instance = behavior->instantiate(d, context);
         to_plaintext_mapped_for_highlighting(out, out_mapping, instance, context);
         break;
@@ -382,7 +515,14 @@ void to_html(HTML_Writer& out, const ast::Content& c, Context& context)
 void to_html(HTML_Writer& out, const ast::Text& text, [[maybe_unused]] Context& context)
 {
     const std::u8string_view output = text.get_source();
-    out.write_inner_text(output);
+    // The parser has already determined whether any escaping is necessary,
+    // so most text can be copied without being examined again.
+    if (text.needs_html_escaping()) {
+        out.write_inner_text(output);
+    }
+    else {
+        out.write_inner_html(output);
+    }
 }
 
 void to_html(HTML_Writer& out, const ast::Escaped& escaped, [[maybe_unused]] Context& context)
@@ -406,6 +546,11 @@ void to_html(HTML_Writer& out, const ast::Generated& content, Context&)
 void to_html(HTML_Writer& out, const ast::Directive& directive, Context& context)
 {
     if (Directive_Behavior* const behavior = context.find_directive(directive)) {
+        // Pure directives cannot leave anything behind in the context,
+        // so all transient memory they use can be released at once when they are done.
+        const auto arena_scope = context.enter_transient_arena_scoped(
+            !context.is_in_transient_arena() && is_pure_directive(directive, context)
+        );
         behavior->generate_html(out, directive, context);
         return;
     }
@@ -497,6 +642,7 @@ public:
     {
         if (Directive_Behavior* const behavior = m_context.find_directive(d)) {
             if (behavior->category == Directive_Category::macro) {
+                const auto scope = m_context.enter_macro_scoped(d.get_name());
                 const std::pmr::vector<ast::Content> instance = behavior->instantiate(d, m_context);
                 for (const auto& content : instance) {
                     std::visit(*this, content);
@@ -535,6 +681,22 @@ public:
         if (text.empty()) {
             return;
         }
+        const auto write_text = [&](std::u8string_view str) {
+            if (t.needs_html_escaping()) {
+                m_out.write_inner_text(str);
+            }
+            else {
+                m_out.write_inner_html(str);
+            }
+        };
+
+        // Most text contains no blank lines, which the parser has already determined.
+        // Trimming cannot introduce blank lines, so such text is simply inline content.
+        if (!t.contains_blank_line()) {
+            transition(Directive_Display::in_line);
+            write_text(text);
+            return;
+        }
 
         // We need to consider the special case of a single leading `\n`.
         // This is technically a blank line when it appears at the start of a string,
@@ -545,7 +707,7 @@ public:
         // but isn't a blank line within the context of the document.
         if (const Blank_Line blank = find_blank_line_sequence(text);
             blank.begin == 0 && blank.length == 1) {
-            m_out.write_inner_text(text[0]);
+            write_text(text.substr(0, 1));
             text.remove_prefix(1);
         }
 
@@ -554,7 +716,7 @@ public:
             if (!blank) {
                 COWEL_ASSERT(blank.begin == 0);
                 transition(Directive_Display::in_line);
-                m_out.write_inner_text(text);
+                write_text(text);
                 break;
             }
 
@@ -563,12 +725,12 @@ public:
             // which we need write first.
             if (blank.begin != 0) {
                 transition(Directive_Display::in_line);
-                m_out.write_inner_text(text.substr(0, blank.begin));
+                write_text(text.substr(0, blank.begin));
                 text.remove_prefix(blank.begin);
                 COWEL_ASSERT(text.length() >= blank.length);
             }
             transition(Directive_Display::block);
-            m_out.write_inner_text(text.substr(0, blank.length));
+            write_text(text.substr(0, blank.length));
             text.remove_prefix(blank.length);
         }
     }
@@ -617,6 +779,9 @@ private:
     void on_non_macro_directive(Directive_Behavior& b, const ast::Directive& d)
     {
         transition(b.display);
+        const auto arena_scope = m_context.enter_transient_arena_scoped(
+            !m_context.is_in_transient_arena() && is_pure_directive(d, m_context)
+        );
         b.generate_html(m_out, d, m_context);
     }
 };
@@ -674,9 +839,11 @@ void to_html_literally(HTML_Writer& out, std::span<const ast::Content> content,
         if (const auto* const t = get_if<ast::Text>(&c)) {
             out.write_inner_html(t->get_source());
         }
-        if (const auto* const _ = get_if<ast::Generated>(&c)) {
-            COWEL_ASSERT_UNREACHABLE(u8"Attempting to generate literal HTML from Behaved_Content");
-            return;
+        if (const auto* const g = get_if<ast::Generated>(&c)) {
+            // Only constant-folded content can be encountered here,
+            // and literal processing uses the source of what was folded.
+            COWEL_ASSERT(g->get_source_span());
+            out.write_inner_text(g->get_source());
         }
         if (const auto* const d = get_if<ast::Directive>(&c)) {
             out.write_inner_text(d->get_source());
@@ -691,15 +858,19 @@ constexpr std::u8string_view highlighting_tag = u8"h-";
 /// @brief Returns an `ast::Generated` element
 /// containing a highlighting element or simply the given text,
 /// depending on whether `span` is null.
+/// The HTML is first written to `buffer`, which is cleared beforehand,
+/// and then copied into memory obtained from `snippet_memory`,
+/// which the resulting element refers to without owning it.
 [[nodiscard]]
 ast::Generated make_generated_highlight(
     std::u8string_view inner_text,
     const Highlight_Span* span,
-    std::pmr::memory_resource* memory
+    std::pmr::vector<char8_t>& buffer,
+    std::pmr::memory_resource* snippet_memory
 )
 {
-    std::pmr::vector<char8_t> span_data { memory };
-    HTML_Writer span_writer { span_data };
+    buffer.clear();
+    HTML_Writer span_writer { buffer };
 
     if (span) {
         const std::u8string_view id
@@ -714,8 +885,11 @@ ast::Generated make_generated_highlight(
         span_writer.close_tag(highlighting_tag);
     }
 
-    return ast::Generated { std::move(span_data), ast::Generated_Type::html,
-                            Directive_Display::in_line };
+    auto* const snippet
+        = static_cast<char8_t*>(snippet_memory->allocate(buffer.size(), alignof(char8_t)));
+    std::ranges::copy(buffer, snippet);
+    return ast::Generated { std::u8string_view { snippet, buffer.size() },
+                            ast::Generated_Type::html, Directive_Display::in_line };
 }
 
 std::pmr::vector<ast::Content> copy_highlighted(
@@ -723,6 +897,7 @@ std::pmr::vector<ast::Content> copy_highlighted(
     std::u8string_view highlighted_text,
     std::span<const std::size_t> to_source_index,
     std::span<const Highlight_Span*> to_highlight_span,
+    std::pmr::memory_resource* snippet_memory,
     Context& context
 );
 
@@ -732,6 +907,8 @@ struct [[nodiscard]] Highlighted_AST_Copier {
     const std::u8string_view source;
     const std::span<const std::size_t> to_document_index;
     const std::span<const Highlight_Span*> to_highlight;
+    std::pmr::memory_resource* const snippet_memory;
+    std::pmr::vector<char8_t>& snippet_buffer;
     Context& context;
 
     std::size_t index = 0;
@@ -746,9 +923,11 @@ struct [[nodiscard]] Highlighted_AST_Copier {
         append_highlighted_text_in(t.get_source_span());
     }
 
-    void operator()(const ast::Generated&)
+    void operator()(const ast::Generated& g)
     {
-        COWEL_ASSERT_UNREACHABLE(u8"Generated content during highlighting?");
+        // Constant-folded content is treated like the pure plaintext directive it replaces.
+        COWEL_ASSERT(g.get_source_span());
+        append_highlighted_text_in(*g.get_source_span());
     }
 
     void operator()(const ast::Directive& directive)
@@ -786,11 +965,13 @@ struct [[nodiscard]] Highlighted_AST_Copier {
             // Therefore, we apply AST copying recursively within the directive,
             // and synthesize a new formatting directive.
 
-            std::pmr::vector<ast::Content> inner_content;
+            std::pmr::vector<ast::Content> inner_content { context.get_transient_memory() };
             Highlighted_AST_Copier inner_copier { .out = inner_content,
                                                   .source = source,
                                                   .to_document_index = to_document_index,
                                                   .to_highlight = to_highlight,
+                                                  .snippet_memory = snippet_memory,
+                                                  .snippet_buffer = snippet_buffer,
                                                   .context = context,
                                                   .index = index };
             for (const auto& c : directive.get_content()) {
@@ -799,16 +980,12 @@ struct [[nodiscard]] Highlighted_AST_Copier {
             COWEL_ASSERT(inner_copier.index >= index);
             index = inner_copier.index;
 
-            std::pmr::vector<ast::Argument> copied_arguments { directive.get_arguments().begin(),
-                                                               directive.get_arguments().end(),
-                                                               context.get_transient_memory() };
-
-            out.push_back(ast::Directive { directive.get_source_span(), directive.get_source(),
-                                           directive.get_name(), std::move(copied_arguments),
-                                           std::move(inner_content) });
+            // The arguments are shared with the original directive rather than copied.
+            out.push_back(ast::Directive { directive, std::move(inner_content) });
             return;
         }
         case Directive_Category::macro: {
+            const auto scope = context.enter_macro_scoped(directive.get_name());
             const std::pmr::vector<ast::Content> instance
                 = behavior->instantiate(directive, context);
             for (const auto& content : instance) {
@@ -848,7 +1025,7 @@ private:
             };
             out.push_back(make_generated_highlight(
                 source.substr(snippet_begin, index - snippet_begin), current_span,
-                context.get_transient_memory()
+                snippet_buffer, snippet_memory
             ));
         }
     }
@@ -863,6 +1040,8 @@ private:
 /// @param to_highlight_span A mapping of each code unit in `highlighted_source`
 /// to a pointer to the highlighting span,
 /// or to a null pointer if that part of `highlighted_source` is not highlighted.
+/// @param snippet_memory The memory in which the HTML of highlighted snippets is stored.
+/// The returned content refers to this memory, so it has to outlive the returned content.
 /// @param context The context.
 /// @returns A new vector of `ast::Content`,
 /// where text and escape sequences are replaced with `Behaved_Content`
@@ -874,6 +1053,7 @@ std::pmr::vector<ast::Content> copy_highlighted(
     std::u8string_view highlighted_text,
     std::span<const std::size_t> to_source_index,
     std::span<const Highlight_Span*> to_highlight_span,
+    std::pmr::memory_resource* snippet_memory,
     Context& context
 )
 {
@@ -883,10 +1063,13 @@ std::pmr::vector<ast::Content> copy_highlighted(
     std::pmr::vector<ast::Content> result { context.get_transient_memory() };
     result.reserve(content.size());
 
+    std::pmr::vector<char8_t> snippet_buffer { context.get_transient_memory() };
     Highlighted_AST_Copier copier { .out = result,
                                     .source = highlighted_text,
                                     .to_document_index = to_source_index,
                                     .to_highlight = to_highlight_span,
+                                    .snippet_memory = snippet_memory,
+                                    .snippet_buffer = snippet_buffer,
                                     .context = context };
 
     for (const auto& c : content) {
@@ -940,8 +1123,12 @@ Result<void, Syntax_Highlight_Error> to_html_syntax_highlighted(
         }
     }
 
+    // The HTML of all highlighted snippets is appended to one buffer
+    // rather than being allocated separately for each snippet.
+    std::pmr::monotonic_buffer_resource snippet_memory { context.get_transient_memory() };
     const std::pmr::vector<ast::Content> highlighted_content = copy_highlighted(
-        content, plaintext_str, plaintext_to_document_index, plaintext_to_span, context
+        content, plaintext_str, plaintext_to_document_index, plaintext_to_span, &snippet_memory,
+        context
     );
     to_html(out, highlighted_content, context, mode);
     return {};
@@ -1038,10 +1225,167 @@ bool argument_to_plaintext(
     }
     const ast::Argument& arg = d.get_arguments()[std::size_t(i)];
     // TODO: warn when pure HTML argument was used as variable name
-    to_plaintext(out, arg.get_content(), context);
+    to_plaintext_memoized(out, arg.get_content_nodes(), context);
     return true;
 }
 
+namespace {
+
+[[nodiscard]]
+bool is_macro_definition(const ast::Directive& d)
+{
+    return d.get_name() == u8"macro" || d.get_name() == u8"-macro";
+}
+
+[[nodiscard]]
+bool is_import(const ast::Directive& d)
+{
+    return d.get_name() == u8"import" || d.get_name() == u8"-import";
+}
+
+/// @brief Appends the names of all macros defined anywhere in `content` to `out`.
+/// @returns `false` if `content` imports other documents,
+/// in which case macros with any name may be defined, and `out` is incomplete.
+[[nodiscard]]
+bool collect_macro_names(
+    std::pmr::vector<std::u8string_view>& out,
+    std::span<const ast::Content> content
+)
+{
+    for (const ast::Content& c : content) {
+        const auto* const d = std::get_if<ast::Directive>(&c);
+        if (!d) {
+            continue;
+        }
+        if (is_import(*d)) {
+            return false;
+        }
+        for (const ast::Argument& arg : d->get_arguments()) {
+            const std::span<const ast::Content> arg_content = arg.get_content();
+            if (is_macro_definition(*d) && arg_content.size() == 1) {
+                if (const auto* const pattern = std::get_if<ast::Directive>(&arg_content[0])) {
+                    out.push_back(pattern->get_name());
+                }
+            }
+            if (!collect_macro_names(out, arg_content)) {
+                return false;
+            }
+        }
+        if (!collect_macro_names(out, d->get_content())) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// @brief Returns `true` if `content` consists only of text and escape sequences.
+[[nodiscard]]
+bool is_literal_content(std::span<const ast::Content> content)
+{
+    return std::ranges::all_of(content, [](const ast::Content& c) {
+        return std::holds_alternative<ast::Text>(c) || std::holds_alternative<ast::Escaped>(c);
+    });
+}
+
+struct Constant_Folder {
+    Context& context;
+    std::span<const std::u8string_view> macro_names;
+
+    void fold(std::pmr::vector<ast::Content>& out, std::span<const ast::Content> content)
+    {
+        for (const ast::Content& c : content) {
+            const auto* const d = std::get_if<ast::Directive>(&c);
+            if (!d || std::ranges::find(macro_names, d->get_name()) != macro_names.end()) {
+                out.push_back(c);
+                continue;
+            }
+            const Directive_Behavior* const behavior = context.find_directive(*d);
+            if (!behavior) {
+                out.push_back(c);
+                continue;
+            }
+            if (behavior->category == Directive_Category::formatting) {
+                std::pmr::vector<ast::Content> inner { out.get_allocator() };
+                fold(inner, d->get_content());
+                out.push_back(ast::Directive { *d, std::move(inner) });
+                continue;
+            }
+            if (!try_fold(out, *d, *behavior)) {
+                out.push_back(c);
+            }
+        }
+    }
+
+    [[nodiscard]]
+    bool try_fold(
+        std::pmr::vector<ast::Content>& out,
+        const ast::Directive& d,
+        const Directive_Behavior& behavior
+    )
+    {
+        if (behavior.category != Directive_Category::pure_plaintext || !behavior.is_pure()
+            || !is_literal_content(d.get_content())) {
+            return false;
+        }
+        for (const ast::Argument& arg : d.get_arguments()) {
+            if (!is_literal_content(arg.get_content())) {
+                return false;
+            }
+        }
+
+        const std::size_t initial_diagnostics = context.get_emitted_diagnostic_count();
+        std::pmr::vector<char8_t> plaintext { out.get_allocator() };
+        behavior.generate_plaintext(plaintext, d, context);
+        const std::u8string_view plaintext_string { plaintext.data(), plaintext.size() };
+        // Blank output is not folded because blank generated content would be subject to
+        // trimming, unlike the directive it replaces.
+        if (context.get_emitted_diagnostic_count() != initial_diagnostics
+            || is_ascii_blank(plaintext_string)) {
+            return false;
+        }
+
+        // Some pure plaintext directives generate HTML that is not simply their escaped plaintext.
+        // For example, \c generates character references rather than the referenced characters.
+        std::pmr::vector<char8_t> html { context.get_transient_memory() };
+        HTML_Writer html_writer { html };
+        behavior.generate_html(html_writer, d, context);
+        std::pmr::vector<char8_t> expected_html { context.get_transient_memory() };
+        HTML_Writer expected_html_writer { expected_html };
+        expected_html_writer.write_inner_text(plaintext_string);
+        if (context.get_emitted_diagnostic_count() != initial_diagnostics
+            || !std::ranges::equal(html, expected_html)) {
+            return false;
+        }
+
+        out.push_back(ast::Generated { std::move(plaintext), ast::Generated_Type::plaintext,
+                                       behavior.display, d.get_source_span(), d.get_source() });
+        return true;
+    }
+};
+
+} // namespace
+
+void fold_constants(
+    std::pmr::vector<ast::Content>& out,
+    std::span<const ast::Content> content,
+    Context& context
+)
+{
+    // Macros take precedence over builtin directives,
+    // so a directive whose name is also the name of a macro
+    // may end up being something other than what we resolve it to now.
+    // Since the names of macros defined in imported documents are not known
+    // until those documents are processed, we cannot fold anything in that case.
+    std::pmr::vector<std::u8string_view> macro_names { context.get_transient_memory() };
+    if (!collect_macro_names(macro_names, content)) {
+        out.insert(out.end(), content.begin(), content.end());
+        return;
+    }
+
+    Constant_Folder folder { .context = context, .macro_names = macro_names };
+    folder.fold(out, content);
+}
+
 void try_generate_error_plaintext(
     std::pmr::vector<char8_t>& out,
     const ast::Directive& d,
@@ -16,15 +16,11 @@ namespace {
 
 constexpr std::u8string_view bib_item_id_prefix = u8"bib-item-";
 
-constexpr auto is_url_always_encoded_lambda = [](char8_t c) { return is_url_always_encoded(c); };
-
 void write_bibliography_entry(HTML_Writer& out, const Document_Info& info)
 {
     const auto open_link_tag = [&](std::u8string_view url, bool link_class = false) {
         out.write_inner_html(u8"<a href=\"");
-        url_encode_ascii_if(
-            std::back_inserter(out.get_output()), url, is_url_always_encoded_lambda
-        );
+        append_url_encoded(out.get_output(), url);
         out.write_inner_html(u8'"');
         if (link_class) {
             out.write_inner_html(u8" class=bib-link");
@@ -121,7 +117,8 @@ void Bibliography_Add_Behavior::evaluate(const ast::Directive& d, Context& conte
             return result;
         }();
     // clang-format on
-    Argument_Matcher args { parameters, context.get_transient_memory() };
+    static constexpr Parameter_Schema schema { parameters };
+    Argument_Matcher args { schema };
     args.match(d.get_arguments());
 
     Stored_Document_Info result { .text
@@ -202,10 +199,7 @@ void Bibliography_Add_Behavior::evaluate(const ast::Directive& d, Context& conte
             // then we want references to bibliography entries (e.g. "[N5008]")
             // to use that link.
             section_out.write_inner_html(u8"<a href=\"");
-            url_encode_ascii_if(
-                std::back_inserter(section_out.get_output()), result.info.link,
-                is_url_always_encoded_lambda
-            );
+            append_url_encoded(section_out.get_output(), result.info.link);
             section_out.write_inner_html(u8"\">");
         }
         else {
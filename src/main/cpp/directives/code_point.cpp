@@ -34,7 +34,7 @@ bool get_yes_no_argument(
     }
     const ast::Argument& arg = d.get_arguments()[std::size_t(index)];
     std::pmr::vector<char8_t> data { context.get_transient_memory() };
-    to_plaintext(data, arg.get_content(), context);
+    to_plaintext_memoized(data, arg.get_content_nodes(), context);
     const auto string = as_u8string_view(data);
     if (string == u8"yes") {
         return true;
@@ -231,6 +231,7 @@ void Code_Point_Digits_Behavior::generate_plaintext(
 ) const
 {
     static constexpr std::u8string_view parameters[] { u8"zfill", u8"base", u8"lower" };
+    static constexpr Parameter_Schema schema { parameters };
 
     constexpr std::size_t default_zfill = 0;
     constexpr std::size_t min_zfill = 0;
@@ -240,7 +241,7 @@ void Code_Point_Digits_Behavior::generate_plaintext(
     constexpr std::size_t min_base = 2;
     constexpr std::size_t max_base = 16;
 
-    Argument_Matcher args { parameters, context.get_transient_memory() };
+    Argument_Matcher args { schema };
     args.match(d.get_arguments());
 
     const std::size_t zfill = get_integer_argument(
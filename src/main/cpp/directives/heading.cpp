@@ -51,13 +51,13 @@ void sanitize_id(std::pmr::vector<char8_t>& id)
 
 bool synthesize_id(
     std::pmr::vector<char8_t>& out,
-    std::span<const ast::Content> content,
+    const ast::Shared_Nodes<ast::Content>& content,
     Context& context
 )
 {
     // TODO: diagnostic on bad status
     const To_Plaintext_Status status
-        = to_plaintext(out, content, context, To_Plaintext_Mode::no_side_effects);
+        = to_plaintext_memoized(out, content, context, To_Plaintext_Mode::no_side_effects);
     if (status == To_Plaintext_Status::error) {
         return false;
     }
@@ -77,12 +77,13 @@ void Heading_Behavior::generate_html(HTML_Writer& out, const ast::Directive& d,
     const
 {
     static constexpr std::u8string_view parameters[] { u8"id", u8"listed" };
+    static constexpr Parameter_Schema schema { parameters };
 
     const auto level_char = char8_t(int(u8'0') + m_level);
     const char8_t tag_name_data[2] { u8'h', level_char };
     const std::u8string_view tag_name { tag_name_data, sizeof(tag_name_data) };
 
-    Argument_Matcher args { parameters, context.get_transient_memory() };
+    Argument_Matcher args { schema };
     args.match(d.get_arguments(), Parameter_Match_Mode::only_named);
 
     // Determine whether the heading should be listed in the table of contents.
@@ -119,7 +120,7 @@ void Heading_Behavior::generate_html(HTML_Writer& out, const ast::Directive& d,
     // 1. Obtain or synthesize the id.
     Attribute_Writer attributes = out.open_tag_with_attributes(tag_name);
     if (const int id_index = args.get_argument_index(u8"id"); id_index < 0) {
-        if (synthesize_id(id_data, d.get_content(), context) && !id_data.empty()) {
+        if (synthesize_id(id_data, d.get_content_nodes(), context) && !id_data.empty()) {
             attributes.write_id(as_u8string_view(id_data));
             has_id = true;
         }
@@ -138,10 +139,18 @@ void Heading_Behavior::generate_html(HTML_Writer& out, const ast::Directive& d,
     attributes.end();
 
     // 2. Generate user content in the heading.
-    std::pmr::vector<char8_t> heading_html { context.get_transient_memory() };
-    HTML_Writer heading_html_writer { heading_html };
-    to_html(heading_html_writer, d.get_content(), context);
-    const auto heading_html_string = as_u8string_view(heading_html);
+    //    The content appears in the heading itself, in the id preview,
+    //    and in the table of contents,
+    //    so it is generated once into a fragment which is referenced from all these places.
+    Document_Sections& sections = context.get_sections();
+    const Document_Sections::entry_type& heading_fragment = sections.make_fragment();
+    {
+        const auto scope = sections.go_to_scoped(heading_fragment.first);
+        HTML_Writer heading_html_writer = sections.current_html();
+        to_html(heading_html_writer, d.get_content(), context);
+    }
+    const std::u8string_view heading_fragment_name = heading_fragment.first;
+    const auto heading_html_string = as_u8string_view(heading_fragment.second.text);
 
     // 3. Check for id duplication.
     const bool has_valid_id = [&] {
@@ -184,13 +193,12 @@ void Heading_Behavior::generate_html(HTML_Writer& out, const ast::Directive& d,
         write_numbers(out);
         out.write_inner_html(u8". ");
     }
-    out.write_inner_html(heading_html_string);
+    sections.reference(out, heading_fragment_name);
     out.close_tag(tag_name);
 
     // 6. Also write an ID preview in case the heading is referenced via \ref[#id]
 
     if (has_valid_id) {
-        Document_Sections& sections = context.get_sections();
         std::pmr::u8string section_name { context.get_transient_memory() };
         section_name += section_name::id_preview;
         section_name += u8'.';
@@ -207,12 +215,11 @@ void Heading_Behavior::generate_html(HTML_Writer& out, const ast::Directive& d,
         else {
             id_preview_out.write_inner_html(u8' ');
         }
-        id_preview_out.write_inner_html(heading_html_string);
+        sections.reference(id_preview_out, heading_fragment_name);
     }
 
     // 7. If necessary, also output the heading into the table of contents.
     if (is_listed) {
-        Document_Sections& sections = context.get_sections();
         const auto scope = sections.go_to_scoped(section_name::table_of_contents);
         HTML_Writer toc_writer = sections.current_html();
 
@@ -233,7 +240,7 @@ void Heading_Behavior::generate_html(HTML_Writer& out, const ast::Directive& d,
         }
 
         toc_writer.open_tag(tag_name);
-        toc_writer.write_inner_html(heading_html_string);
+        sections.reference(toc_writer, heading_fragment_name);
         toc_writer.close_tag(tag_name);
 
         if (has_valid_id) {
@@ -253,7 +260,8 @@ void generate_sectioned(
 )
 {
     static constexpr std::u8string_view parameters[] { u8"section" };
-    Argument_Matcher args { parameters, context.get_persistent_memory() };
+    static constexpr Parameter_Schema schema { parameters };
+    Argument_Matcher args { schema };
     args.match(d.get_arguments());
 
     const int arg_index = args.get_argument_index(u8"section");
@@ -270,6 +278,17 @@ void generate_sectioned(
         context.try_error(no_section_diagnostic, d.get_source_span(), u8"No section was provided.");
         return;
     }
+    // Writing to or referencing a fragment would make user content appear within
+    // the content of headings, or the content of headings appear elsewhere.
+    if (section_string.starts_with(Document_Sections::fragment_prefix)) {
+        const std::u8string_view message[] {
+            u8"The section name \"",
+            section_string,
+            u8"\" is reserved.",
+        };
+        context.try_error(diagnostic::section_reserved, arg.get_source_span(), message);
+        return;
+    }
 
     action(section_string);
 }
@@ -288,7 +307,7 @@ void There_Behavior::evaluate(const ast::Directive& d, Context& context) const
 void Here_Behavior::generate_html(HTML_Writer& out, const ast::Directive& d, Context& context) const
 {
     generate_sectioned(d, context, diagnostic::there::no_section, [&](std::u8string_view section) {
-        reference_section(out, section);
+        context.get_sections().reference(out, section);
     });
 }
 
@@ -301,7 +320,7 @@ void Make_Section_Behavior::generate_html(HTML_Writer& out, const ast::Directive
     out.open_tag_with_attributes(u8"div") //
         .write_class(m_class_name)
         .end();
-    reference_section(out, m_section_name);
+    context.get_sections().reference(out, m_section_name);
     out.close_tag(u8"div");
 }
 
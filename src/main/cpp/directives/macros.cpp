@@ -1,10 +1,24 @@
+#include <algorithm>
+#include <cstddef>
+#include <memory_resource>
+#include <span>
 #include <string_view>
+#include <utility>
 #include <vector>
 
+#include "cowel/util/assert.hpp"
+#include "cowel/util/html_writer.hpp"
+#include "cowel/util/strings.hpp"
+#include "cowel/util/to_chars.hpp"
+
 #include "cowel/ast.hpp"
 #include "cowel/builtin_directive_set.hpp"
 #include "cowel/context.hpp"
+#include "cowel/diagnostic.hpp"
+#include "cowel/directive_behavior.hpp"
 #include "cowel/directive_processing.hpp"
+#include "cowel/macro_profile.hpp"
+#include "cowel/macro_template.hpp"
 
 namespace cowel {
 
@@ -14,6 +28,7 @@ void Instantiated_Behavior::generate_plaintext(
     Context& context
 ) const
 {
+    const auto scope = context.enter_macro_scoped(d.get_name());
     std::pmr::vector<ast::Content> instantiation { context.get_transient_memory() };
     instantiate(instantiation, d, context);
     to_plaintext(out, instantiation, context);
@@ -25,15 +40,160 @@ void Instantiated_Behavior::generate_html(
     Context& context
 ) const
 {
+    const auto scope = context.enter_macro_scoped(d.get_name());
     std::pmr::vector<ast::Content> instantiation { context.get_transient_memory() };
     instantiate(instantiation, d, context);
     to_html(out, instantiation, context);
 }
 
+namespace {
+
+/// @brief Appends the substitutions for `content` to `out`.
+/// @returns `true` if `content` contains a `\put` directive anywhere.
+bool compile_macro_content(
+    std::pmr::vector<Macro_Substitution>& out,
+    std::span<const ast::Content> content
+)
+{
+    bool any_put = false;
+    for (const ast::Content& c : content) {
+        const auto* const d = std::get_if<ast::Directive>(&c);
+        if (!d) {
+            // Anything other than directives (text, etc.) are unaffected by macro substitution.
+            continue;
+        }
+        if (d->get_name() == u8"put") {
+            out.push_back(Macro_Substitution::put);
+            any_put = true;
+            continue;
+        }
+
+        const std::size_t index = out.size();
+        out.push_back(Macro_Substitution::rebuild);
+        bool directive_has_put = false;
+        for (const ast::Argument& arg : d->get_arguments()) {
+            directive_has_put |= compile_macro_content(out, arg.get_content());
+        }
+        directive_has_put |= compile_macro_content(out, d->get_content());
+
+        if (directive_has_put) {
+            any_put = true;
+        }
+        else {
+            // Nothing within the directive needs substitution,
+            // so the whole directive is copied and its insides are never visited.
+            out.resize(index);
+            out.push_back(Macro_Substitution::copy);
+        }
+    }
+    return any_put;
+}
+
+/// @brief Returns `true` if every instantiation of `macro` produces the same HTML,
+/// and producing that HTML has no side effects.
+[[nodiscard]]
+bool is_memoizable(const Macro_Template& macro, Context& context)
+{
+    // A macro without \put expands to the same content, regardless of how it is used.
+    return std::ranges::find(macro.substitutions, Macro_Substitution::put)
+        == macro.substitutions.end()
+        && is_pure_content(macro.definition.get_content(), context);
+}
+
+[[nodiscard]]
+Macro_Template compile_macro(const ast::Directive& definition, std::pmr::memory_resource* memory)
+{
+    Macro_Template result { .definition = definition,
+                            .substitutions = std::pmr::vector<Macro_Substitution> { memory },
+                            .memo_state = Macro_Memo_State::unknown,
+                            .memo_html = std::pmr::vector<char8_t> { memory } };
+    compile_macro_content(result.substitutions, definition.get_content());
+    return result;
+}
+
+/// @brief Appends the instantiation of `content` to `out`,
+/// consuming one substitution for each directive that is visited.
+void instantiate_macro_content(
+    std::pmr::vector<ast::Content>& out,
+    std::span<const ast::Content> content,
+    std::span<const Macro_Substitution>& substitutions,
+    std::span<const ast::Content> put_content
+)
+{
+    for (const ast::Content& c : content) {
+        const auto* const d = std::get_if<ast::Directive>(&c);
+        if (!d) {
+            out.push_back(c);
+            continue;
+        }
+        COWEL_ASSERT(!substitutions.empty());
+        const Macro_Substitution substitution = substitutions.front();
+        substitutions = substitutions.subspan(1);
+
+        switch (substitution) {
+        case Macro_Substitution::copy: {
+            out.push_back(c);
+            break;
+        }
+        case Macro_Substitution::put: {
+            // Substituted content is never visited again,
+            // otherwise we would risk expanding a \put directive that was passed to the macro,
+            // rather than being in the macro definition,
+            // and \put is only supposed to have special meaning within the macro definition.
+            out.insert(out.end(), put_content.begin(), put_content.end());
+            break;
+        }
+        case Macro_Substitution::rebuild: {
+            std::pmr::memory_resource* const memory = out.get_allocator().resource();
+            std::pmr::vector<ast::Argument> arguments { memory };
+            arguments.reserve(d->get_arguments().size());
+            for (const ast::Argument& arg : d->get_arguments()) {
+                std::pmr::vector<ast::Content> arg_content { memory };
+                instantiate_macro_content(
+                    arg_content, arg.get_content(), substitutions, put_content
+                );
+                if (arg.has_name()) {
+                    arguments.emplace_back(
+                        arg.get_source_span(), arg.get_source(), arg.get_name_span(),
+                        arg.get_name(), std::move(arg_content)
+                    );
+                }
+                else {
+                    arguments.emplace_back(
+                        arg.get_source_span(), arg.get_source(), std::move(arg_content)
+                    );
+                }
+            }
+            std::pmr::vector<ast::Content> directive_content { memory };
+            instantiate_macro_content(
+                directive_content, d->get_content(), substitutions, put_content
+            );
+            out.push_back(ast::Directive { d->get_source_span(), d->get_source(), d->get_name(),
+                                           std::move(arguments), std::move(directive_content) });
+            break;
+        }
+        }
+    }
+}
+
+void instantiate_macro(
+    std::pmr::vector<ast::Content>& out,
+    const Macro_Template& macro,
+    std::span<const ast::Content> put_content
+)
+{
+    std::span<const Macro_Substitution> substitutions = macro.substitutions;
+    instantiate_macro_content(out, macro.definition.get_content(), substitutions, put_content);
+    COWEL_ASSERT(substitutions.empty());
+}
+
+} // namespace
+
 void Macro_Define_Behavior::evaluate(const ast::Directive& d, Context& context) const
 {
-    static const std::u8string_view parameters[] { u8"pattern" };
-    Argument_Matcher args { parameters, context.get_transient_memory() };
+    static constexpr std::u8string_view parameters[] { u8"pattern" };
+    static constexpr Parameter_Schema schema { parameters };
+    Argument_Matcher args { schema };
     args.match(d.get_arguments());
 
     const int pattern_index = args.get_argument_index(u8"pattern");
@@ -61,7 +221,9 @@ void Macro_Define_Behavior::evaluate(const ast::Directive& d, Context& context)
     const std::u8string_view pattern_name = pattern_directive.get_name();
     std::pmr::u8string owned_name { pattern_name, context.get_transient_memory() };
 
-    const bool success = context.emplace_macro(std::move(owned_name), &d);
+    const bool success = context.emplace_macro(
+        std::move(owned_name), compile_macro(d, context.get_transient_memory())
+    );
     if (!success) {
         const std::u8string_view message[] {
             u8"Redefinition of macro \"",
@@ -72,76 +234,106 @@ void Macro_Define_Behavior::evaluate(const ast::Directive& d, Context& context)
     }
 }
 
-namespace {
-
-void substitute_in_macro(
-    std::pmr::vector<ast::Content>& content,
-    std::span<const ast::Argument> put_arguments,
-    std::span<const ast::Content> put_content,
+void Macro_Instantiate_Behavior::instantiate(
+    std::pmr::vector<ast::Content>& out,
+    const ast::Directive& d,
     Context& context
-)
+) const
 {
-    for (auto it = content.begin(); it != content.end();) {
-        auto* const d = std::get_if<ast::Directive>(&*it);
-        if (!d) {
-            // Anything other than directives (text, etc.) are unaffected by macro substitution.
-            ++it;
-            continue;
-        }
-
-        // Before anything else, we have to replace the contents and the arguments of directives.
-        // This comes even before the use evaluation of \put and \arg
-        // in order to facilitate nesting, like \arg[\arg[0]].
-        for (auto& arg : d->get_arguments()) {
-            substitute_in_macro(arg.get_content(), put_arguments, put_content, context);
-        }
-        substitute_in_macro(d->get_content(), put_arguments, put_content, context);
+    const Macro_Template* const macro = context.find_macro(d.get_name());
+    // We always find a macro
+    // because the name lookup for this directive utilizes `find_macro`,
+    // so we're effectively calling it twice with the same input.
+    COWEL_ASSERT(macro);
 
-        if (d->get_name() == u8"put") {
-            // TODO: there's probably a way to do this faster, in a single step,
-            //       but I couldn't find anything obvious in std::vector's interface.
-            it = content.erase(it);
-            it = content.insert(it, put_content.begin(), put_content.end());
-            // We must skip over substituted content,
-            // otherwise we risk expanding a \put directive that was passed to the macro,
-            // rather than being in the macro definition,
-            // and \put is only supposed to have special meaning within the macro definition.
-            it += std::ptrdiff_t(put_content.size());
-        }
-        else {
-            ++it;
-        }
+    const Macro_Budget& budget = context.get_macro_budget();
+    if (context.is_macro_budget_exceeded()) {
+        // Once the budget is exceeded, no more macros are expanded.
+        // Otherwise, we would emit a diagnostic for every single expansion in a
+        // runaway macro, and we wouldn't stop runaway macros that fan out.
+        return;
+    }
+    if (context.get_macro_depth() > budget.max_depth) {
+        context.set_macro_budget_exceeded();
+        const auto max_depth_chars = to_characters8(budget.max_depth);
+        const std::u8string_view message[] {
+            u8"Instantiating the macro \"",
+            d.get_name(),
+            u8"\" exceeds the maximum macro nesting depth of ",
+            max_depth_chars.as_string(),
+            u8". Is the macro (indirectly) instantiating itself?",
+        };
+        context.try_error(diagnostic::macro::budget_depth, d.get_source_span(), message);
+        return;
     }
-}
 
-void instantiate_macro(
-    std::pmr::vector<ast::Content>& out,
-    const ast::Directive& definition,
-    std::span<const ast::Argument> put_arguments,
-    std::span<const ast::Content> put_content,
-    Context& context
-)
-{
-    const std::span<const ast::Content> content = definition.get_content();
-    out.insert(out.end(), content.begin(), content.end());
-    substitute_in_macro(out, put_arguments, put_content, context);
-}
+    const std::size_t initial_size = out.size();
+    instantiate_macro(out, *macro, d.get_content());
+    const std::size_t nodes = out.size() - initial_size;
+    context.add_macro_expanded_nodes(d.get_name(), nodes);
 
-} // namespace
+    if (context.get_macro_expanded_nodes() > budget.max_expanded_nodes) {
+        context.set_macro_budget_exceeded();
+        out.erase(out.begin() + std::ptrdiff_t(initial_size), out.end());
+        const auto max_nodes_chars = to_characters8(budget.max_expanded_nodes);
+        const std::u8string_view message[] {
+            u8"Instantiating the macro \"",
+            d.get_name(),
+            u8"\" exceeds the maximum total of ",
+            max_nodes_chars.as_string(),
+            u8" nodes produced by macro expansions. Is the macro expanding exponentially?",
+        };
+        context.try_error(diagnostic::macro::budget_nodes, d.get_source_span(), message);
+    }
+}
 
-void Macro_Instantiate_Behavior::instantiate(
-    std::pmr::vector<ast::Content>& out,
+void Macro_Instantiate_Behavior::generate_html(
+    HTML_Writer& out,
     const ast::Directive& d,
     Context& context
 ) const
 {
-    const ast::Directive* const definition = context.find_macro(d.get_name());
-    // We always find a macro
-    // because the name lookup for this directive utilizes `find_macro`,
-    // so we're effectively calling it twice with the same input.
-    COWEL_ASSERT(definition);
+    Macro_Template* const macro = context.find_macro(d.get_name());
+    COWEL_ASSERT(macro);
 
-    instantiate_macro(out, *definition, d.get_arguments(), d.get_content(), context);
+    if (macro->memo_generation != context.get_macro_generation()) {
+        macro->memo_state = Macro_Memo_State::unknown;
+        macro->memo_html.clear();
+        macro->memo_generation = context.get_macro_generation();
+    }
+    switch (macro->memo_state) {
+    case Macro_Memo_State::cached: {
+        const auto scope = context.enter_macro_scoped(d.get_name());
+        out.write_inner_html(as_u8string_view(macro->memo_html));
+        return;
+    }
+    case Macro_Memo_State::impossible: {
+        Instantiated_Behavior::generate_html(out, d, context);
+        return;
+    }
+    case Macro_Memo_State::unknown: break;
+    }
+
+    if (!is_memoizable(*macro, context)) {
+        macro->memo_state = Macro_Memo_State::impossible;
+        Instantiated_Behavior::generate_html(out, d, context);
+        return;
+    }
+
+    std::pmr::vector<char8_t> html { context.get_transient_memory() };
+    HTML_Writer html_writer { html };
+    const std::size_t diagnostics_before = context.get_emitted_diagnostic_count();
+    Instantiated_Behavior::generate_html(html_writer, d, context);
+    out.write_inner_html(as_u8string_view(html));
+
+    // Diagnostics are a side effect that would be lost if we used the memoized HTML,
+    // so we only memoize if generation was completely clean.
+    if (context.get_emitted_diagnostic_count() != diagnostics_before) {
+        macro->memo_state = Macro_Memo_State::impossible;
+        return;
+    }
+    macro->memo_state = Macro_Memo_State::cached;
+    macro->memo_html = std::move(html);
 }
 
 } // namespace cowel
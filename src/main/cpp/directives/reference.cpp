@@ -100,12 +100,13 @@ Reference_Classification classify_reference(std::u8string_view ref)
 
 void Ref_Behavior::generate_html(HTML_Writer& out, const ast::Directive& d, Context& context) const
 {
-    static const std::u8string_view parameters[] { u8"to" };
-    Argument_Matcher args { parameters, context.get_transient_memory() };
+    static constexpr std::u8string_view parameters[] { u8"to" };
+    static constexpr Parameter_Schema schema { parameters };
+    Argument_Matcher args { schema };
     args.match(d.get_arguments());
 
-    for (std::size_t i = 0; i < args.argument_statuses().size(); ++i) {
-        if (args.argument_statuses()[i] == Argument_Status::unmatched) {
+    for (std::size_t i = 0; i < args.argument_count(); ++i) {
+        if (args.argument_status(i) == Argument_Status::unmatched) {
             context.try_warning(
                 diagnostic::ignored_args, d.get_arguments()[i].get_source_span(),
                 u8"This argument was ignored."
@@ -141,7 +142,7 @@ void Ref_Behavior::generate_html(HTML_Writer& out, const ast::Directive& d, Cont
         section_name += section_name::bibliography;
         section_name += u8'.';
         section_name += target_string;
-        reference_section(out, section_name);
+        context.get_sections().reference(out, section_name);
         if (d.get_content().empty()) {
             out.write_inner_html(u8'[');
             out.write_inner_text(target_string);
@@ -160,7 +161,7 @@ void Ref_Behavior::generate_html(HTML_Writer& out, const ast::Directive& d, Cont
             section_name += section_name::id_preview;
             section_name += u8'.';
             section_name += target_string.substr(1);
-            reference_section(out, section_name);
+            context.get_sections().reference(out, section_name);
         }
         else {
             to_html(out, d.get_content(), context);
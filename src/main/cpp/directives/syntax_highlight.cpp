@@ -24,7 +24,8 @@ std::u8string_view argument_to_plaintext_or(
     if (index < 0) {
         return fallback;
     }
-    to_plaintext(out, directive.get_arguments()[std::size_t(index)].get_content(), context);
+    const ast::Argument& arg = directive.get_arguments()[std::size_t(index)];
+    to_plaintext_memoized(out, arg.get_content_nodes(), context);
     return { out.data(), out.size() };
 }
 
@@ -131,7 +132,7 @@ bool get_yes_no_argument(
     }
     const ast::Argument& arg = d.get_arguments()[std::size_t(index)];
     std::pmr::vector<char8_t> data { context.get_transient_memory() };
-    to_plaintext(data, arg.get_content(), context);
+    to_plaintext_memoized(data, arg.get_content_nodes(), context);
     const auto string = as_u8string_view(data);
     if (string == u8"yes") {
         return true;
@@ -1,4 +1,10 @@
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <string>
 #include <string_view>
+#include <utility>
+#include <variant>
 #include <vector>
 
 #include "cowel/util/from_chars.hpp"
@@ -29,6 +35,49 @@ long long operate(Expression_Type type, long long x, long long y)
     COWEL_ASSERT_UNREACHABLE(u8"Invalid expression type.");
 }
 
+/// @brief Converts `arg` to an integer.
+/// If the argument consists of a single directive that can be evaluated to an integer directly,
+/// this is done without generating and parsing plaintext.
+/// @param text Receives the plaintext of the argument if it was generated.
+/// @returns `true` on success, `false` if an error was diagnosed.
+[[nodiscard]]
+bool argument_to_integer(
+    long long& out,
+    std::pmr::vector<char8_t>& text,
+    const ast::Argument& arg,
+    Context& context
+)
+{
+    const std::span<const ast::Content> content = arg.get_content();
+    if (content.size() == 1) {
+        if (const auto* const d = std::get_if<ast::Directive>(&content[0])) {
+            if (const Directive_Behavior* const behavior = context.find_directive(*d)) {
+                switch (behavior->evaluate_integer(out, *d, context)) {
+                case Integer_Evaluation::ok: return true;
+                case Integer_Evaluation::error: return false;
+                case Integer_Evaluation::unsupported: break;
+                }
+            }
+        }
+    }
+
+    to_plaintext(text, content, context);
+    const auto arg_string = as_u8string_view(text);
+
+    const std::optional x = from_chars<long long>(arg_string);
+    if (!x) {
+        const std::u8string_view message[] {
+            u8"Unable to perform operation because \"",
+            arg_string,
+            u8"\" is not a valid integer.",
+        };
+        context.try_error(diagnostic::arithmetic_parse, arg.get_source_span(), message);
+        return false;
+    }
+    out = *x;
+    return true;
+}
+
 } // namespace
 
 void Expression_Behavior::generate_plaintext(
@@ -36,38 +85,45 @@ void Expression_Behavior::generate_plaintext(
     const ast::Directive& d,
     Context& context
 ) const
+{
+    long long result = 0;
+    if (evaluate_integer(result, d, context) != Integer_Evaluation::ok) {
+        try_generate_error_plaintext(out, d, context);
+        return;
+    }
+    const Characters8 result_chars = to_characters8(result);
+    append(out, result_chars.as_string());
+}
+
+Integer_Evaluation
+Expression_Behavior::evaluate_integer(long long& out, const ast::Directive& d, Context& context)
+    const
 {
     long long result = expression_type_neutral_element(m_type);
     for (const ast::Argument& arg : d.get_arguments()) {
+        long long x = 0;
         std::pmr::vector<char8_t> arg_text { context.get_transient_memory() };
-        to_plaintext(arg_text, arg.get_content(), context);
-        const auto arg_string = as_u8string_view(arg_text);
-
-        const std::optional x = from_chars<long long>(arg_string);
-        if (!x) {
-            const std::u8string_view message[] {
-                u8"Unable to perform operation because \"",
-                arg_string,
-                u8"\" is not a valid integer.",
-            };
-            context.try_error(diagnostic::arithmetic_parse, arg.get_source_span(), message);
-            try_generate_error_plaintext(out, d, context);
-            return;
+        if (!argument_to_integer(x, arg_text, arg, context)) {
+            return Integer_Evaluation::error;
         }
-        if (m_type == Expression_Type::divide && *x == 0) {
+        if (m_type == Expression_Type::divide && x == 0) {
+            // If the argument was evaluated directly, its plaintext would have been
+            // the formatted integer.
+            if (arg_text.empty()) {
+                append(arg_text, to_characters8(x).as_string());
+            }
             const std::u8string_view message[] {
                 u8"The dividend \"",
-                arg_string,
+                as_u8string_view(arg_text),
                 u8"\" evaluated to zero, and a division by zero would occur.",
             };
             context.try_error(diagnostic::arithmetic_div_by_zero, arg.get_source_span(), message);
-            try_generate_error_plaintext(out, d, context);
-            return;
+            return Integer_Evaluation::error;
         }
-        result = operate(m_type, result, *x);
+        result = operate(m_type, result, x);
     }
-    const Characters8 result_chars = to_characters8(result);
-    append(out, result_chars.as_string());
+    out = result;
+    return Integer_Evaluation::ok;
 }
 
 void Variable_Behavior::generate_plaintext(
@@ -103,9 +159,13 @@ void Get_Variable_Behavior::generate_var_plaintext(
     Context& context
 ) const
 {
-    const auto it = context.get_variables().find(var);
-    if (it != context.get_variables().end()) {
-        out.insert(out.end(), it->second.begin(), it->second.end());
+    if (const Context::Variable_Value* const value = context.get_variable(var)) {
+        if (const auto* const integer = std::get_if<long long>(value)) {
+            append(out, to_characters8(*integer).as_string());
+        }
+        else {
+            append(out, std::get<std::pmr::u8string>(*value));
+        }
     }
 }
 
@@ -116,11 +176,80 @@ void Get_Variable_Behavior::generate_var_html(
     Context& context
 ) const
 {
-    if (const std::pmr::u8string* const value = context.get_variable(var)) {
-        out.write_inner_html(*value);
+    if (const Context::Variable_Value* const value = context.get_variable(var)) {
+        if (const auto* const integer = std::get_if<long long>(value)) {
+            out.write_inner_html(to_characters8(*integer).as_string());
+        }
+        else {
+            out.write_inner_html(std::get<std::pmr::u8string>(*value));
+        }
+    }
+}
+
+Integer_Evaluation
+Get_Variable_Behavior::evaluate_integer(long long& out, const ast::Directive& d, Context& context)
+    const
+{
+    Argument_Matcher args { m_parameters };
+    args.match(d.get_arguments());
+    const int i = args.get_argument_index(var_parameter);
+    if (i < 0) {
+        return Integer_Evaluation::unsupported;
     }
+    // The variable name is computed without side effects
+    // because we may need to fall back onto plaintext generation,
+    // which computes it again.
+    std::pmr::vector<char8_t> var { context.get_transient_memory() };
+    const To_Plaintext_Status status = to_plaintext(
+        var, d.get_arguments()[std::size_t(i)].get_content(), context,
+        To_Plaintext_Mode::no_side_effects
+    );
+    if (status != To_Plaintext_Status::ok) {
+        return Integer_Evaluation::unsupported;
+    }
+    const Context::Variable_Value* const value = context.get_variable(as_u8string_view(var));
+    if (!value || !std::holds_alternative<long long>(*value)) {
+        return Integer_Evaluation::unsupported;
+    }
+    out = std::get<long long>(*value);
+    return Integer_Evaluation::ok;
 }
 
+namespace {
+
+/// @brief Computes the value that `\\Vset` assigns.
+/// If the content is a single directive that can be evaluated to an integer directly
+/// (e.g. `\\Cadd`), the integer is stored as such.
+[[nodiscard]]
+Context::Variable_Value content_to_variable_value(const ast::Directive& d, Context& context)
+{
+    const std::span<const ast::Content> content = d.get_content();
+    if (content.size() == 1) {
+        if (const auto* const e = std::get_if<ast::Directive>(&content[0])) {
+            if (const Directive_Behavior* const behavior = context.find_directive(*e)) {
+                long long integer = 0;
+                switch (behavior->evaluate_integer(integer, *e, context)) {
+                case Integer_Evaluation::ok: return integer;
+                case Integer_Evaluation::error: {
+                    std::pmr::vector<char8_t> error_text { context.get_transient_memory() };
+                    try_generate_error_plaintext(error_text, *e, context);
+                    return std::pmr::u8string { error_text.data(), error_text.size(),
+                                                context.get_persistent_memory() };
+                }
+                case Integer_Evaluation::unsupported: break;
+                }
+            }
+        }
+    }
+
+    std::pmr::vector<char8_t> body_string { context.get_transient_memory() };
+    to_plaintext(body_string, content, context);
+    return std::pmr::u8string { body_string.data(), body_string.size(),
+                                context.get_persistent_memory() };
+}
+
+} // namespace
+
 void process(
     Variable_Operation op,
     const ast::Directive& d,
@@ -128,13 +257,10 @@ void process(
     Context& context
 )
 {
-    std::pmr::vector<char8_t> body_string { context.get_transient_memory() };
-    to_plaintext(body_string, d.get_content(), context);
+    Context::Variable_Value value = content_to_variable_value(d, context);
 
     const auto it = context.get_variables().find(var);
     if (op == Variable_Operation::set) {
-        std::pmr::u8string value { body_string.data(), body_string.size(),
-                                   context.get_persistent_memory() };
         if (it == context.get_variables().end()) {
             std::pmr::u8string key // NOLINT(misc-const-correctness)
                 { var.data(), var.size(), context.get_persistent_memory() };
@@ -33,7 +33,8 @@ void WG21_Head_Behavior::generate_html(HTML_Writer& out, const ast::Directive& d
     const
 {
     static constexpr std::u8string_view parameters[] { u8"title" };
-    Argument_Matcher args { parameters, context.get_transient_memory() };
+    static constexpr Parameter_Schema schema { parameters };
+    Argument_Matcher args { schema };
     args.match(d.get_arguments());
 
     out.open_tag_with_attributes(u8"div") //
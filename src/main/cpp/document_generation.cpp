@@ -1,10 +1,16 @@
+#include <array>
+#include <cstddef>
 #include <memory_resource>
+#include <optional>
+#include <span>
 #include <unordered_set>
+#include <vector>
 
 #include "cowel/theme_to_css.hpp"
 #include "cowel/util/assert.hpp"
 #include "cowel/util/html_writer.hpp"
 #include "cowel/util/io.hpp"
+#include "cowel/util/strings.hpp"
 
 #include "cowel/builtin_directive_set.hpp"
 #include "cowel/content_behavior.hpp"
@@ -14,6 +20,9 @@
 #include "cowel/document_content_behavior.hpp"
 #include "cowel/document_generation.hpp"
 #include "cowel/document_sections.hpp"
+#include "cowel/html_minifier.hpp"
+#include "cowel/memory_profile.hpp"
+#include "cowel/services.hpp"
 
 namespace cowel {
 
@@ -21,9 +30,27 @@ void generate_document(const Generation_Options& options)
 {
     COWEL_ASSERT(options.memory != nullptr);
 
-    std::pmr::unsynchronized_pool_resource transient_memory { options.memory };
+    if (options.memory_profile) {
+        options.memory_profile->enter_phase(Memory_Phase::generation);
+    }
+
+    std::pmr::unsynchronized_pool_resource transient_pool { options.memory };
+    std::pmr::memory_resource* const transient_memory
+        = options.transient_memory ? options.transient_memory : &transient_pool;
+
+    // When minifying, all output passes through the minifier on its way to the destination.
+    Vector_Output_Sink vector_sink { options.output };
+    std::optional<HTML_Minifier> minifier;
+    if (options.minify) {
+        Output_Sink& destination = options.output_sink ? *options.output_sink : vector_sink;
+        minifier.emplace(destination, transient_memory);
+    }
+    Output_Sink* const sink = minifier ? &*minifier : options.output_sink;
 
-    HTML_Writer writer { options.output };
+    // If there is a sink, root behaviors which don't write to it themselves
+    // write to this buffer instead, which is passed on to the sink afterwards.
+    std::pmr::vector<char8_t> direct_output { transient_memory };
+    HTML_Writer writer { sink ? direct_output : options.output };
 
     Context context { options.highlight_theme_source, //
                       options.error_behavior, //
@@ -32,10 +59,44 @@ void generate_document(const Generation_Options& options)
                       options.highlighter, //
                       options.bibliography, //
                       options.memory, //
-                      &transient_memory };
+                      transient_memory };
     context.add_resolver(options.builtin_behavior);
+    context.set_macro_budget(options.macro_budget);
+    context.set_macro_profile(options.macro_profile);
+    context.set_memory_profile(options.memory_profile);
+    context.set_output_sink(sink);
+
+    std::pmr::vector<ast::Content> folded_content { transient_memory };
+    std::span<const ast::Content> root_content = options.root_content;
+    if (options.fold_constants) {
+        // Folding takes place in a separate context which accepts but discards all diagnostics.
+        // That way, directives which emit diagnostics are not folded,
+        // and are diagnosed only once during generation.
+        Ignorant_Logger folding_logger { Severity::min };
+        Context folding_context { options.highlight_theme_source, //
+                                  options.error_behavior, //
+                                  options.file_loader,
+                                  folding_logger, //
+                                  options.highlighter, //
+                                  options.bibliography, //
+                                  transient_memory, //
+                                  transient_memory };
+        folding_context.add_resolver(options.builtin_behavior);
+        fold_constants(folded_content, root_content, folding_context);
+        root_content = folded_content;
+    }
+
+    options.root_behavior.generate_html(writer, root_content, context);
+    if (sink && !direct_output.empty()) {
+        (*sink)(as_u8string_view(direct_output));
+    }
+    if (minifier) {
+        minifier->flush();
+    }
 
-    options.root_behavior.generate_html(writer, options.root_content, context);
+    if (options.plaintext_memo_statistics) {
+        *options.plaintext_memo_statistics = context.get_plaintext_memo_statistics();
+    }
 
     context.get_bibliography().clear();
 }
@@ -55,10 +116,14 @@ file_to_inner_html(HTML_Writer& out, std::u8string_view path, Context& context)
     return {};
 }
 
-// See also `reference_section`.
-// The point of all this is that references to other sections are encoded using a section name,
-// which is encoded using a Supplementary Private Use Area A code point
-// storing the section name length, followed by the section name code units.
+// See also `Document_Sections::reference`.
+// References written directly into a section are recorded alongside the section text,
+// so the section can be assembled by splicing in the referenced sections at the recorded offsets.
+// However, references written into temporary buffers (whose contents are later copied
+// into sections) cannot be recorded that way.
+// Those are encoded using a Supplementary Private Use Area A code point
+// storing the section name length, followed by the section name code units,
+// and only if any such reference exists do we need to search the text for them.
 
 constexpr char8_t supplementary_pua_a_first_code_unit
     = utf8::encode8_unchecked(supplementary_pua_a_min).code_units[0];
@@ -68,22 +133,85 @@ constexpr char8_t supplementary_pua_a_first_code_unit_masked
 
 static_assert(supplementary_pua_a_first_code_unit_masked == 0b1111'0000);
 
+/// @brief Collects pieces of section text and passes them to an `Output_Sink` in batches,
+/// so that sinks can write many pieces at once.
+/// This relies on section text remaining valid and unchanged until the pieces are flushed.
+struct Batched_Output {
+    static constexpr std::size_t capacity = 64;
+
+    Output_Sink& sink;
+    std::array<std::u8string_view, capacity> pieces {};
+    std::size_t size = 0;
+
+    void operator()(std::u8string_view piece)
+    {
+        if (size == capacity) {
+            flush();
+        }
+        pieces[size++] = piece;
+    }
+
+    void flush()
+    {
+        if (size != 0) {
+            sink.write_vectored(std::span { pieces.data(), size });
+            size = 0;
+        }
+    }
+};
+
 struct Reference_Resolver {
-    std::pmr::vector<char8_t>& out;
+    Batched_Output& out;
     std::pmr::unordered_set<const void*>& visited;
     Context& context;
+    std::u8string_view file;
+    /// @brief If `true`, the text of sections is searched for encoded section references.
+    bool search_text;
+
+    /// @brief Writes the text of `section` to `out`,
+    /// with all references resolved recursively.
+    bool operator()(const Document_Sections::entry_type& section);
 
-    bool operator()(std::u8string_view text, std::u8string_view file);
+private:
+    bool write_text(std::u8string_view text);
+
+    bool write_referenced(std::u8string_view section_name);
+    bool write_referenced(const Document_Sections::entry_type& section);
+
+    bool error_not_found(std::u8string_view section_name);
 };
 
-bool Reference_Resolver::operator()(std::u8string_view text, std::u8string_view file)
+bool Reference_Resolver::operator()(const Document_Sections::entry_type& section)
 {
+    const auto text = as_u8string_view(section.second.text);
+
+    bool success = true;
+    std::size_t written = 0;
+    for (const Section_Reference& reference : section.second.references) {
+        COWEL_DEBUG_ASSERT(reference.offset >= written);
+        success &= write_text(text.substr(written, reference.offset - written));
+        success &= write_referenced(*reference.target);
+        written = reference.offset;
+    }
+    success &= write_text(text.substr(written));
+    return success;
+}
+
+bool Reference_Resolver::write_text(std::u8string_view text)
+{
+    if (!search_text) {
+        if (!text.empty()) {
+            out(text);
+        }
+        return true;
+    }
+
     bool success = true;
 
     std::size_t plain_length = 0;
     const auto flush = [&] {
         if (plain_length != 0) {
-            out.insert(out.end(), text.data(), text.data() + plain_length);
+            out(text.substr(0, plain_length));
             text.remove_prefix(plain_length);
             plain_length = 0;
         }
@@ -110,42 +238,53 @@ bool Reference_Resolver::operator()(std::u8string_view text, std::u8string_view
         const auto reference_length = std::size_t(code_point - supplementary_pua_a_min);
         COWEL_ASSERT(4 + reference_length <= text.length());
         const std::u8string_view section_name = text.substr(4, reference_length);
-
-        bool section_success = true;
-        const Document_Sections::entry_type* const entry
-            = context.get_sections().find(section_name);
-        if (!entry) {
-            const std::u8string_view message[] {
-                u8"Invalid reference to section \"",
-                section_name,
-                u8"\".",
-            };
-            context.try_error(diagnostic::section_ref_not_found, { {}, file }, message);
-            section_success = false;
-        }
-        else if (const auto [_, insert_success] = visited.insert(entry); !insert_success) {
-            const std::u8string_view message[] {
-                u8"Circular dependency in reference to section \"",
-                section_name,
-                u8"\".",
-            };
-            context.try_error(diagnostic::section_ref_circular, { {}, file }, message);
-            section_success = false;
-        }
         text.remove_prefix(4 + reference_length);
-        if (section_success) {
-            const std::u8string_view referenced_text { entry->second.data(), entry->second.size() };
-            (*this)(referenced_text, file);
-        }
-        else {
-            success = section_success;
-        }
-        visited.erase(entry);
+        success &= write_referenced(section_name);
     }
     flush();
     return success;
 }
 
+bool Reference_Resolver::error_not_found(std::u8string_view section_name)
+{
+    const std::u8string_view message[] {
+        u8"Invalid reference to section \"",
+        section_name,
+        u8"\".",
+    };
+    context.try_error(diagnostic::section_ref_not_found, { {}, file }, message);
+    return false;
+}
+
+bool Reference_Resolver::write_referenced(std::u8string_view section_name)
+{
+    const Document_Sections::entry_type* const entry = context.get_sections().find(section_name);
+    if (!entry) {
+        return error_not_found(section_name);
+    }
+    return write_referenced(*entry);
+}
+
+bool Reference_Resolver::write_referenced(const Document_Sections::entry_type& section)
+{
+    const std::u8string_view section_name = section.first;
+    if (section.second.referenced_only) {
+        return error_not_found(section_name);
+    }
+    if (const auto [_, insert_success] = visited.insert(&section); !insert_success) {
+        const std::u8string_view message[] {
+            u8"Circular dependency in reference to section \"",
+            section_name,
+            u8"\".",
+        };
+        context.try_error(diagnostic::section_ref_circular, { {}, file }, message);
+        return false;
+    }
+    const bool success = (*this)(section);
+    visited.erase(&section);
+    return success;
+}
+
 } // namespace
 
 void Head_Body_Content_Behavior::generate_html(
@@ -156,8 +295,7 @@ void Head_Body_Content_Behavior::generate_html(
 {
     Document_Sections& sections = context.get_sections();
 
-    const Document_Sections::entry_type* html_section = nullptr;
-    auto& html_text = [&] -> std::pmr::vector<char8_t>& {
+    const Document_Sections::entry_type& html_section = [&] -> Document_Sections::entry_type& {
         const auto scope = sections.go_to_scoped(section_name::document_html);
 
         HTML_Writer current_out = sections.current_html();
@@ -172,17 +310,15 @@ void Head_Body_Content_Behavior::generate_html(
         current_out.write_preamble();
         open_and_close(u8"html", [&] {
             open_and_close(u8"head", [&] {
-                reference_section(current_out, section_name::document_head);
+                sections.reference(current_out, section_name::document_head);
             });
             open_and_close(u8"body", [&] {
-                reference_section(current_out, section_name::document_body);
+                sections.reference(current_out, section_name::document_body);
             });
         });
 
-        html_section = &sections.current();
-        return sections.current_text();
+        return sections.current();
     }();
-    const std::u8string_view html_string { html_text.data(), html_text.size() };
 
     {
         const auto scope = sections.go_to_scoped(section_name::document_head);
@@ -195,13 +331,28 @@ void Head_Body_Content_Behavior::generate_html(
         generate_body(current_out, content, context);
     }
 
+    if (Memory_Profile* const profile = context.get_memory_profile()) {
+        profile->enter_phase(Memory_Phase::reference_resolution);
+    }
+
     std::pmr::unordered_set<const void*> visited(context.get_transient_memory());
-    visited.insert(html_section);
+    visited.insert(&html_section);
 
     if (!content.empty()) {
         // TODO: this way of obtaining the file is kinda unclean ...
         const std::u8string_view file = ast::get_source_span(content.front(), u8"").file_name;
-        Reference_Resolver { out.get_output(), visited, context }(html_string, file);
+        // Generation is complete at this point, so no section changes anymore,
+        // and the text between references can be written to the sink as is.
+        Vector_Output_Sink vector_sink { out.get_output() };
+        Output_Sink* const sink = context.get_output_sink();
+        Batched_Output batched_out { .sink = sink ? *sink : vector_sink };
+        Reference_Resolver resolver { .out = batched_out,
+                                      .visited = visited,
+                                      .context = context,
+                                      .file = file,
+                                      .search_text = sections.has_encoded_references() };
+        resolver(html_section);
+        batched_out.flush();
     }
 }
 
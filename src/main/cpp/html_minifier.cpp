@@ -0,0 +1,216 @@
+#include <cstddef>
+#include <string_view>
+
+#include "cowel/util/assert.hpp"
+#include "cowel/util/chars.hpp"
+#include "cowel/util/strings.hpp"
+
+#include "cowel/html_minifier.hpp"
+
+namespace cowel {
+namespace {
+
+constexpr std::u8string_view comment_start = u8"<!--";
+
+/// @brief Returns `true` if `c` can appear in the name of any tag the minifier cares about.
+/// This is deliberately narrower than `is_html_tag_name_character`.
+[[nodiscard]]
+constexpr bool is_tag_name_character(char8_t c) noexcept
+{
+    return is_ascii_alphanumeric(c) || c == u8'-';
+}
+
+/// @brief Returns `true` if whitespace within elements named `name` is significant.
+[[nodiscard]]
+constexpr bool is_whitespace_preserving(std::u8string_view name) noexcept
+{
+    return name == u8"pre" || name == u8"textarea" || name == u8"code-block";
+}
+
+/// @brief Returns the end tag prefix for elements named `name`
+/// whose contents are raw text,
+/// or an empty string if their contents are not raw text.
+[[nodiscard]]
+constexpr std::u8string_view raw_text_end(std::u8string_view name) noexcept
+{
+    return name == u8"script" ? u8"</script"
+        : name == u8"style"   ? u8"</style"
+                              : u8"";
+}
+
+} // namespace
+
+void HTML_Minifier::operator()(std::u8string_view text)
+{
+    for (const char8_t c : text) {
+        consume(c);
+    }
+    if (m_buffer.size() >= m_buffer_size) {
+        m_out(as_u8string_view(m_buffer));
+        m_buffer.clear();
+    }
+}
+
+void HTML_Minifier::flush()
+{
+    if (m_state == State::markup_start) {
+        emit(comment_start.substr(0, m_matched));
+        m_state = State::tag;
+    }
+    if (m_pending_whitespace != 0) {
+        emit(m_pending_whitespace);
+        m_pending_whitespace = 0;
+    }
+    if (!m_buffer.empty()) {
+        m_out(as_u8string_view(m_buffer));
+        m_buffer.clear();
+    }
+}
+
+void HTML_Minifier::consume(char8_t c)
+{
+    switch (m_state) {
+    case State::text: {
+        if (c == u8'<') {
+            m_state = State::markup_start;
+            m_matched = 1;
+        }
+        else if (m_preserve_depth != 0) {
+            emit(c);
+        }
+        else if (is_html_whitespace(c)) {
+            if (c == u8'\n' || m_pending_whitespace == 0) {
+                m_pending_whitespace = c == u8'\n' ? u8'\n' : u8' ';
+            }
+        }
+        else {
+            if (m_pending_whitespace != 0) {
+                emit(m_pending_whitespace);
+                m_pending_whitespace = 0;
+            }
+            emit(c);
+        }
+        return;
+    }
+
+    case State::markup_start: {
+        if (c == comment_start[m_matched]) {
+            if (++m_matched == comment_start.length()) {
+                m_state = State::comment;
+                m_matched = 0;
+            }
+            return;
+        }
+        // Not a comment after all, so everything held back so far has to be written.
+        if (m_pending_whitespace != 0) {
+            emit(m_pending_whitespace);
+            m_pending_whitespace = 0;
+        }
+        emit(comment_start.substr(0, m_matched));
+        m_closing_tag = false;
+        m_tag_name_length = 0;
+        // Something like <!DOCTYPE html> has no name that we care about.
+        m_state = m_matched == 1 ? State::tag_name : State::tag;
+        m_matched = 0;
+        consume(c);
+        return;
+    }
+
+    case State::tag_name: {
+        if (c == u8'/' && m_tag_name_length == 0 && !m_closing_tag) {
+            m_closing_tag = true;
+            emit(c);
+            return;
+        }
+        if (is_tag_name_character(c)) {
+            // Longer names are truncated, which is fine because they are longer than
+            // any name we need to recognize, so they still don't match.
+            if (m_tag_name_length < max_tag_name_length) {
+                m_tag_name[m_tag_name_length++] = to_ascii_lower(c);
+            }
+            emit(c);
+            return;
+        }
+        m_state = State::tag;
+        consume(c);
+        return;
+    }
+
+    case State::tag: {
+        emit(c);
+        if (c == u8'"' || c == u8'\'') {
+            m_state = State::tag_quoted;
+            m_quote = c;
+        }
+        else if (c == u8'>') {
+            end_tag();
+        }
+        return;
+    }
+
+    case State::tag_quoted: {
+        emit(c);
+        if (c == m_quote) {
+            m_state = State::tag;
+        }
+        return;
+    }
+
+    case State::comment: {
+        if (c == u8'-') {
+            m_matched = m_matched < 2 ? m_matched + 1 : 2;
+        }
+        else if (c == u8'>' && m_matched == 2) {
+            m_state = State::text;
+            m_matched = 0;
+        }
+        else {
+            m_matched = 0;
+        }
+        return;
+    }
+
+    case State::raw_text: {
+        emit(c);
+        const char8_t lower = to_ascii_lower(c);
+        if (lower == m_raw_text_end[m_matched]) {
+            if (++m_matched == m_raw_text_end.length()) {
+                // We have just written something like </script,
+                // so the rest is handled like any other end tag.
+                m_state = State::tag;
+                m_closing_tag = true;
+                m_tag_name_length = 0;
+                m_matched = 0;
+            }
+        }
+        else {
+            m_matched = lower == m_raw_text_end[0] ? 1 : 0;
+        }
+        return;
+    }
+    }
+    COWEL_ASSERT_UNREACHABLE(u8"Invalid minifier state.");
+}
+
+void HTML_Minifier::end_tag()
+{
+    const std::u8string_view name = tag_name();
+    m_state = State::text;
+    if (m_closing_tag) {
+        if (m_preserve_depth != 0 && is_whitespace_preserving(name)) {
+            --m_preserve_depth;
+        }
+        return;
+    }
+    if (is_whitespace_preserving(name)) {
+        ++m_preserve_depth;
+        return;
+    }
+    if (const std::u8string_view end = raw_text_end(name); !end.empty()) {
+        m_state = State::raw_text;
+        m_raw_text_end = end;
+        m_matched = 0;
+    }
+}
+
+} // namespace cowel
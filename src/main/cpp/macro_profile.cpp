@@ -0,0 +1,51 @@
+#include <algorithm>
+#include <cstddef>
+#include <memory_resource>
+#include <string_view>
+#include <vector>
+
+#include "cowel/util/html_writer.hpp"
+#include "cowel/util/to_chars.hpp"
+
+#include "cowel/macro_profile.hpp"
+
+namespace cowel {
+
+void write_macro_profile_json(std::pmr::vector<char8_t>& out, const Macro_Profile& profile)
+{
+    std::pmr::memory_resource* const memory = out.get_allocator().resource();
+    std::pmr::vector<const Macro_Profile::map_type::value_type*> sorted { memory };
+    sorted.reserve(profile.entries.size());
+    for (const auto& entry : profile.entries) {
+        sorted.push_back(&entry);
+    }
+    std::ranges::sort(sorted, [](const auto* x, const auto* y) { return x->first < y->first; });
+
+    const auto append_member = [&](std::u8string_view key, auto value, bool last = false) {
+        append(out, u8"    \"");
+        append(out, key);
+        append(out, u8"\": ");
+        append(out, to_characters8(value));
+        append(out, last ? u8"\n" : u8",\n");
+    };
+
+    append(out, u8"{");
+    bool first = true;
+    for (const auto* const entry : sorted) {
+        const auto& [name, statistics] = *entry;
+        append(out, first ? u8"\n  \"" : u8",\n  \"");
+        first = false;
+        // Directive names only consist of ASCII alphanumeric characters, '-', and '_',
+        // so they never need to be escaped within JSON strings.
+        append(out, name);
+        append(out, u8"\": {\n");
+        append_member(u8"expansions", statistics.expansions);
+        append_member(u8"expanded_nodes", statistics.expanded_nodes);
+        append_member(u8"max_depth", statistics.max_depth);
+        append_member(u8"time_ns", statistics.time.count(), true);
+        append(out, u8"  }");
+    }
+    append(out, first ? u8"}\n" : u8"\n}\n");
+}
+
+} // namespace cowel
@@ -0,0 +1,156 @@
+#include <algorithm>
+#include <cstddef>
+#include <memory_resource>
+#include <string_view>
+#include <vector>
+
+#include "cowel/util/assert.hpp"
+#include "cowel/util/counting_memory_resource.hpp"
+#include "cowel/util/html_writer.hpp"
+#include "cowel/util/to_chars.hpp"
+
+#include "cowel/fwd.hpp"
+#include "cowel/memory_profile.hpp"
+
+namespace cowel {
+
+std::u8string_view memory_phase_name(Memory_Phase phase)
+{
+    using enum Memory_Phase;
+    switch (phase) {
+        COWEL_ENUM_STRING_CASE8(load);
+        COWEL_ENUM_STRING_CASE8(parse);
+        COWEL_ENUM_STRING_CASE8(build_ast);
+        COWEL_ENUM_STRING_CASE8(generation);
+        COWEL_ENUM_STRING_CASE8(reference_resolution);
+        COWEL_ENUM_STRING_CASE8(output);
+    }
+    COWEL_ASSERT_UNREACHABLE(u8"Invalid phase.");
+}
+
+void Memory_Profile::add_resource(std::u8string_view name, Counting_Memory_Resource& resource)
+{
+    m_resources.push_back({ .name = name, .resource = &resource });
+    if (m_phase) {
+        m_resources.back().phase_start = resource.get_statistics();
+        resource.reset_peak();
+    }
+}
+
+void Memory_Profile::enter_phase(Memory_Phase phase)
+{
+    end_phase();
+    m_phase = phase;
+    for (Tracked_Resource& tracked : m_resources) {
+        // Resetting the peak is harmless because the peak of each phase is recorded separately,
+        // and the overall peak is the greatest peak of all phases.
+        tracked.resource->reset_peak();
+        tracked.phase_start = tracked.resource->get_statistics();
+    }
+}
+
+void Memory_Profile::end_phase()
+{
+    if (!m_phase) {
+        return;
+    }
+    const auto index = std::size_t(*m_phase);
+    for (Tracked_Resource& tracked : m_resources) {
+        const Memory_Statistics& now = tracked.resource->get_statistics();
+        Memory_Statistics& result = tracked.phases[index];
+        result.allocated_bytes += now.allocated_bytes - tracked.phase_start.allocated_bytes;
+        result.allocations += now.allocations - tracked.phase_start.allocations;
+        result.peak_bytes = std::max(result.peak_bytes, now.peak_bytes);
+        result.live_bytes = now.live_bytes;
+    }
+    m_phase = {};
+}
+
+namespace {
+
+void append_statistics_json(std::pmr::vector<char8_t>& out, const Memory_Statistics& statistics)
+{
+    const auto append_member = [&](std::u8string_view key, std::size_t value, bool last = false) {
+        append(out, u8"      \"");
+        append(out, key);
+        append(out, u8"\": ");
+        append(out, to_characters8(value));
+        append(out, last ? u8"\n" : u8",\n");
+    };
+    append(out, u8"{\n");
+    append_member(u8"allocated_bytes", statistics.allocated_bytes);
+    append_member(u8"allocations", statistics.allocations);
+    append_member(u8"peak_bytes", statistics.peak_bytes);
+    append_member(u8"live_bytes", statistics.live_bytes, true);
+    append(out, u8"    }");
+}
+
+void append_padded(std::pmr::vector<char8_t>& out, std::u8string_view text, std::size_t width)
+{
+    if (text.length() < width) {
+        out.insert(out.end(), width - text.length(), u8' ');
+    }
+    append(out, text);
+}
+
+} // namespace
+
+void write_memory_profile_json(std::pmr::vector<char8_t>& out, const Memory_Profile& profile)
+{
+    append(out, u8"{");
+    for (std::size_t i = 0; i < memory_phase_count; ++i) {
+        append(out, i == 0 ? u8"\n  \"" : u8",\n  \"");
+        // Neither phase names nor resource names need to be escaped within JSON strings.
+        append(out, memory_phase_name(Memory_Phase(i)));
+        append(out, u8"\": {");
+        bool first = true;
+        for (const Memory_Profile::Tracked_Resource& tracked : profile.get_resources()) {
+            append(out, first ? u8"\n    \"" : u8",\n    \"");
+            first = false;
+            append(out, tracked.name);
+            append(out, u8"\": ");
+            append_statistics_json(out, tracked.phases[i]);
+        }
+        append(out, first ? u8"}" : u8"\n  }");
+    }
+    append(out, u8"\n}\n");
+}
+
+void write_memory_profile_text(std::pmr::vector<char8_t>& out, const Memory_Profile& profile)
+{
+    constexpr std::size_t name_width = 22;
+    constexpr std::size_t number_width = 14;
+
+    const auto append_name = [&](std::u8string_view name) {
+        append(out, name);
+        const std::size_t padding = name.length() < name_width ? name_width - name.length() : 1;
+        out.insert(out.end(), padding, u8' ');
+    };
+    const auto append_number = [&](std::size_t value) {
+        const auto chars = to_characters8(value);
+        append_padded(out, chars.as_string(), number_width);
+    };
+
+    append_name(u8"phase");
+    append_name(u8"resource");
+    for (const std::u8string_view column :
+         { u8"allocated", u8"allocations", u8"peak", u8"live" }) {
+        append_padded(out, column, number_width);
+    }
+    out.push_back(u8'\n');
+
+    for (std::size_t i = 0; i < memory_phase_count; ++i) {
+        for (const Memory_Profile::Tracked_Resource& tracked : profile.get_resources()) {
+            const Memory_Statistics& statistics = tracked.phases[i];
+            append_name(memory_phase_name(Memory_Phase(i)));
+            append_name(tracked.name);
+            append_number(statistics.allocated_bytes);
+            append_number(statistics.allocations);
+            append_number(statistics.peak_bytes);
+            append_number(statistics.live_bytes);
+            out.push_back(u8'\n');
+        }
+    }
+}
+
+} // namespace cowel
@@ -212,9 +212,23 @@ private:
         }
 
         const std::size_t initial_pos = m_pos;
+        bool needs_html_escaping = false;
+        bool contains_blank_line = false;
+        // Whether the current line of text consists only of whitespace so far.
+        bool is_line_blank = true;
 
         for (; !eof(); ++m_pos) {
             const char8_t c = m_source[m_pos];
+            // None of these characters terminate text,
+            // so it is fine to record them before examining c any further.
+            needs_html_escaping |= (c == u8'&') | (c == u8'<') | (c == u8'>');
+            if (c == u8'\n') {
+                contains_blank_line |= is_line_blank;
+                is_line_blank = true;
+            }
+            else if (!is_html_whitespace(c)) {
+                is_line_blank = false;
+            }
             if (c == u8'\\') {
                 const std::u8string_view remainder { m_source.substr(m_pos + 1) };
 
@@ -274,7 +288,10 @@ private:
             return false;
         }
 
-        m_out.push_back({ AST_Instruction_Type::text, m_pos - initial_pos });
+        m_out.push_back({ .type = AST_Instruction_Type::text,
+                          .n = m_pos - initial_pos,
+                          .needs_html_escaping = needs_html_escaping,
+                          .contains_blank_line = contains_blank_line });
         return true;
     }
 
@@ -43,10 +43,16 @@ Blank_Line find_blank_line_sequence // NOLINT(bugprone-exception-escape)
             continue;
         }
         case State::not_blank: {
-            if (str[i] == u8'\n') {
-                state = State::maybe_blank;
-                blank_begin = i + 1;
+            // Most lines are not blank, so we skip to the next line right away
+            // instead of examining every character.
+            // This is usually implemented with memchr, which processes many characters at once.
+            const std::size_t newline = str.find(u8'\n', i);
+            if (newline == std::u8string_view::npos) {
+                return {};
             }
+            i = newline;
+            state = State::maybe_blank;
+            blank_begin = i + 1;
             continue;
         }
         case State::blank: {
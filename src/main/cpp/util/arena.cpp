@@ -0,0 +1,112 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+
+#include "cowel/util/arena.hpp"
+#include "cowel/util/assert.hpp"
+
+namespace cowel {
+
+Arena_Memory_Resource::Arena_Memory_Resource(
+    std::pmr::memory_resource* upstream,
+    std::size_t block_size
+)
+    : m_upstream { upstream }
+    , m_blocks { upstream }
+    , m_block_size { block_size }
+{
+    COWEL_ASSERT(upstream != nullptr);
+    COWEL_ASSERT(block_size != 0);
+}
+
+Arena_Memory_Resource::~Arena_Memory_Resource()
+{
+    release();
+}
+
+void Arena_Memory_Resource::rewind(Marker marker) noexcept
+{
+    COWEL_DEBUG_ASSERT(
+        marker.block < m_current_block
+        || (marker.block == m_current_block && marker.offset <= m_offset)
+    );
+    m_current_block = marker.block;
+    m_offset = marker.offset;
+}
+
+void Arena_Memory_Resource::release() noexcept
+{
+    for (const Block& block : m_blocks) {
+        m_upstream->deallocate(block.data, block.size, alignof(std::max_align_t));
+    }
+    m_blocks.clear();
+    m_current_block = 0;
+    m_offset = 0;
+}
+
+void* Arena_Memory_Resource::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+    const auto try_allocate_in = [&](std::size_t block_index, std::size_t offset) -> void* {
+        const Block& block = m_blocks[block_index];
+        const auto address = std::uintptr_t(block.data) + offset;
+        const auto padding = std::size_t(-address % alignment);
+        const std::size_t aligned = offset + padding;
+        if (aligned > block.size || block.size - aligned < bytes) {
+            return nullptr;
+        }
+        m_current_block = block_index;
+        m_offset = aligned + bytes;
+        return block.data + aligned;
+    };
+
+    if (m_current_block < m_blocks.size()) {
+        if (void* const result = try_allocate_in(m_current_block, m_offset)) {
+            return result;
+        }
+        // Blocks after the current one are left over from before a rewind,
+        // and can be reused if they are large enough.
+        // No marker refers to them, so the first one that fits is moved right after the
+        // current block, and the others remain available for subsequent allocations.
+        const auto next = m_blocks.begin() + std::ptrdiff_t(m_current_block + 1);
+        const auto fitting = std::ranges::find_if(next, m_blocks.end(), [&](const Block& b) {
+            return b.size >= bytes + alignment;
+        });
+        if (fitting != m_blocks.end()) {
+            std::rotate(next, fitting, fitting + 1);
+            void* const result = try_allocate_in(m_current_block + 1, 0);
+            COWEL_ASSERT(result);
+            return result;
+        }
+    }
+
+    // Blocks grow geometrically so that the amount of upstream allocations remains small,
+    // but not beyond max_block_size, so that a long document does not obtain
+    // ever larger blocks of which only a fraction is used.
+    const std::size_t min_size = bytes + alignment;
+    const std::size_t size = std::max(m_block_size, min_size);
+    m_block_size = std::min(std::max(m_block_size, size) * 2, max_block_size);
+
+    void* const data = m_upstream->allocate(size, alignof(std::max_align_t));
+    const Block block { static_cast<std::byte*>(data), size };
+    const std::size_t index = m_blocks.empty() ? 0 : m_current_block + 1;
+    m_blocks.insert(m_blocks.begin() + std::ptrdiff_t(index), block);
+
+    void* const result = try_allocate_in(index, 0);
+    COWEL_ASSERT(result);
+    return result;
+}
+
+void Arena_Memory_Resource::do_deallocate(void* p, std::size_t bytes, std::size_t)
+{
+    // Only the most recent allocation can be given back.
+    // Everything else is released when rewinding.
+    if (m_current_block < m_blocks.size()) {
+        std::byte* const top = m_blocks[m_current_block].data + m_offset;
+        if (static_cast<std::byte*>(p) + bytes == top) {
+            m_offset -= bytes;
+        }
+    }
+}
+
+} // namespace cowel
@@ -1,3 +1,7 @@
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <span>
 #include <string_view>
 
 #include "ulight/impl/platform.h"
@@ -8,15 +12,134 @@ ULIGHT_DIAGNOSTIC_IGNORED("-Wshorten-64-to-32")
 #include "cowel/cedilla/name_to_cp.hpp"
 ULIGHT_DIAGNOSTIC_POP()
 
+#include "cowel/util/chars.hpp"
 #include "cowel/util/code_point_names.hpp"
 #include "cowel/util/strings.hpp"
 
 namespace cowel {
 
+#ifdef COWEL_CODE_POINT_NAMES_HASH
+namespace {
+
+/// @brief A slot in the minimal perfect hash table over code point names.
+/// See `generate_code_point_names_cpp.py` for details on how the table is built.
+struct Code_Point_Name_Slot {
+    /// @brief The code point in the lower 21 bits, and the length of the name above.
+    std::uint32_t code_point_and_length;
+    /// @brief The hash of the name, used to verify that the name actually matches.
+    std::uint32_t fingerprint;
+};
+
+#include "code_point_names_autogenerated.cpp" // NOLINT
+
+[[nodiscard]]
+constexpr std::uint32_t fnv1a(std::u8string_view name, std::uint32_t seed) noexcept
+{
+    std::uint32_t hash = 2166136261u ^ seed;
+    for (const char8_t c : name) {
+        hash ^= std::uint32_t(c);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/// @brief Returns `true` if `name` is algorithmically derived from the code point,
+/// like `HANGUL SYLLABLE GA` or `CJK UNIFIED IDEOGRAPH-4E00`.
+/// Such names are not stored in the hash table.
+[[nodiscard]]
+bool is_derived_name(std::string_view name) noexcept
+{
+    if (name.starts_with("HANGUL SYLLABLE ")) {
+        return true;
+    }
+    for (const auto& item : uni::details::generated_name_data_table) {
+        if (name.starts_with(item.prefix)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/// @brief Converts `name` into the form in which names are stored in the hash table,
+/// following the loose matching rules of UAX #44 (UAX44-LM2):
+/// letters are converted to upper case,
+/// and spaces as well as medial hyphens are removed.
+/// @returns The normalized name, or an empty string if it would exceed the length of any name
+/// in the table, or if `name` ends in characters that are removed.
+[[nodiscard]]
+std::u8string_view normalize_name(
+    std::span<char8_t, code_point_name_max_length> buffer,
+    std::u8string_view name
+) noexcept
+{
+    std::size_t length = 0;
+    bool had_space = true;
+    bool last_removed = false;
+    for (const char8_t c : name) {
+        last_removed = c == u8' ' || (c == u8'-' && !had_space);
+        had_space = c == u8' ';
+        if (last_removed) {
+            continue;
+        }
+        if (length == buffer.size()) {
+            return {};
+        }
+        buffer[length++] = to_ascii_upper(c);
+    }
+    if (last_removed) {
+        return {};
+    }
+    return { buffer.data(), length };
+}
+
+[[nodiscard]]
+char32_t code_point_by_normalized_name(std::u8string_view name) noexcept
+{
+    const std::uint32_t hash = fnv1a(name, 0);
+    const std::uint16_t displacement
+        = code_point_name_displacements[hash % std::size(code_point_name_displacements)];
+    const std::size_t slot_index
+        = fnv1a(name, displacement) % std::size(code_point_name_slots);
+    const Code_Point_Name_Slot& slot = code_point_name_slots[slot_index];
+
+    if (slot.fingerprint != hash || (slot.code_point_and_length >> 21) != name.length()) {
+        return char32_t(-1);
+    }
+    return char32_t(slot.code_point_and_length & 0x1f'ffff);
+}
+
+} // namespace
+
+char32_t code_point_by_name(std::u8string_view name) noexcept
+{
+    const std::string_view name_chars = as_string_view(name);
+    if (is_derived_name(name_chars)) {
+        const char32_t result = uni::cp_from_name(name_chars);
+        return result > 0x10'FFFF ? char32_t(-1) : result;
+    }
+
+    char8_t buffer[code_point_name_max_length];
+    const std::u8string_view normalized = normalize_name(buffer, name);
+    if (normalized.empty()) {
+        return char32_t(-1);
+    }
+    const char32_t result = code_point_by_normalized_name(normalized);
+    // HANGUL JUNGSEONG O-E is the only name which is ambiguous under loose matching;
+    // see uni::cp_from_name.
+    if (result == 0x116c && name_chars.find("O-E") != std::string_view::npos) {
+        return 0x1180;
+    }
+    return result;
+}
+
+#else
+
 char32_t code_point_by_name(std::u8string_view name) noexcept
 {
     const char32_t result = uni::cp_from_name(as_string_view(name));
     return result > 0x10'FFFF ? char32_t(-1) : result;
 }
 
+#endif
+
 } // namespace cowel
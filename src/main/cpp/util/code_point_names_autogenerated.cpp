@@ -0,0 +1,8736 @@
+// NOLINTBEGIN
+// clang-format off
+constexpr std::size_t code_point_name_max_length = 74;
+constexpr std::uint16_t code_point_name_displacements[8310] {
+1,8,17,13,26,5,7,1,46,0,60,18,6,2,3,3,1,23,176,28,
+2,9,0,38,39,47,4,1,3,18,77,2,8,9,97,5,90,91,5,8,
+32,138,36,3,3,14,18,1,86,47,76,13,8,108,5,11,40,31,5,6,
+47,10,74,191,259,46,1,8,36,19,4,3,58,7,85,79,104,49,74,82,
+3,16,75,18,5,2,5,28,62,8,2,21,0,87,1,64,34,45,0,231,
+10,331,11,14,6,1,11,2,5,8,1,31,17,63,16,8,4,21,12,100,
+1,2,15,65,9,3,59,4,77,17,3,32,8,1,4,174,110,28,1,90,
+38,5,50,13,107,44,0,111,85,52,1,2,90,21,5,1,254,83,3,5,
+1,111,2,74,29,2,97,40,3,10,10,7,138,32,72,1,2,3,3,45,
+10,8,298,34,34,12,50,71,30,78,1,18,110,6,4,0,2,63,70,91,
+2,24,42,34,36,7,402,178,115,36,78,61,53,3,4,33,75,9,46,22,
+251,36,1,9,24,4,5,145,4,138,25,26,2,2,67,4,25,16,7,157,
+11,2,37,4,44,112,2,23,7,112,8,151,34,38,1,427,4,1,2,3,
+39,3,10,15,103,137,217,197,406,1,4,112,0,11,87,43,108,273,15,61,
+10,25,42,6,2,30,25,4,45,96,8,133,155,31,51,3,32,14,9,407,
+88,4,18,16,2,66,26,25,62,1,12,2,1,13,59,5,82,30,1,2,
+12,17,99,54,76,2,330,5,66,9,1,1,2,1,1,1,5,11,31,152,
+3,1,15,1,30,166,1,7,5,12,49,13,4,43,2,5,27,64,2,12,
+3,1,5,1,63,1,144,106,84,67,5,75,0,47,3,13,27,3,30,32,
+12,1,5,1,6,377,129,101,10,167,4,2,19,1,14,189,1,131,8,11,
+4,35,217,9,5,2,0,16,16,0,1,6,2,13,2,1,3,2,71,370,
+1,230,75,125,1,155,6,2,1,88,121,22,6,2,9,217,43,2,9,9,
+23,139,20,33,18,2,20,16,1,1,8,11,22,97,5,34,55,1,2,309,
+15,139,20,6,217,76,4,0,42,140,40,13,13,4,2,1,15,22,1,2,
+4,16,9,34,17,0,4,9,4,78,21,124,6,15,2,50,1,1,12,2,
+19,107,3,93,6,5,7,17,17,33,1,36,15,195,18,45,41,96,0,5,
+8,3,23,10,7,4,124,0,129,22,13,360,81,3,41,125,5,34,27,193,
+5,18,2,111,109,4,7,240,6,10,36,4,41,1,16,9,7,5,86,610,
+1,49,17,143,35,155,0,211,170,2,10,20,51,137,140,45,0,180,69,1,
+74,210,2,42,31,413,45,59,45,1,125,78,2,5,23,25,18,9,16,81,
+12,90,19,44,51,1,52,219,14,86,67,9,98,8,4,78,8,3,141,7,
+6,35,12,5,29,40,53,26,135,39,6,182,72,1,104,81,216,42,2,0,
+46,167,109,81,96,389,40,12,5,1,13,78,6,9,95,15,111,107,3,43,
+5,1,7,162,1,7,13,4,8,4,15,18,119,3,77,7,20,11,381,125,
+2,123,3,15,37,25,2,105,8,192,1,14,19,95,94,109,6,125,14,8,
+12,172,2,10,2,74,101,73,95,35,73,20,15,6,13,20,135,46,6,10,
+7,149,217,1,66,86,4,77,33,59,57,2,3,3,1,43,142,6,8,62,
+358,20,2,46,3,46,86,4,87,16,107,21,3,17,14,41,99,11,100,105,
+18,54,426,214,32,2,43,2,2,1,43,4,1,2,3,11,311,3,32,39,
+472,72,0,64,18,138,7,25,2,23,25,28,18,110,155,9,31,51,23,4,
+1,6,1,1,15,551,1,542,45,26,7,25,13,7,26,2,2,48,66,0,
+1,3,21,22,27,37,11,3,5,96,34,27,1,19,1,4,1,52,19,6,
+1,400,73,28,143,90,9,110,26,10,3,1,23,76,15,10,18,110,195,291,
+3,1,25,183,50,98,18,24,39,97,2,6,2,140,1,9,2,54,102,96,
+2,135,23,160,105,543,16,4,20,46,23,60,7,2,18,1,6,6,80,1,
+1,9,277,6,8,62,74,1,166,36,71,176,42,15,53,1,140,367,30,1,
+20,7,1,8,27,35,364,1,8,56,1,7,4,30,1,5,6,229,2,193,
+1,242,38,134,2,134,26,1,51,55,111,12,79,41,8,47,3,39,31,14,
+22,57,2,16,0,358,4,1,17,78,101,1,38,21,21,4,147,15,111,7,
+18,4,91,56,10,2,303,6,1,6,32,71,32,214,2,14,3,6,0,5,
+70,228,1,19,8,2,39,11,115,25,377,84,64,0,54,1,1,68,39,466,
+1,57,61,14,4,26,5,5,194,71,1,9,1,174,8,4,1,27,4,19,
+10,44,23,83,47,46,1,6,2,50,7,46,218,59,1,26,8,24,372,2,
+0,0,38,2,1,53,1,6,12,95,2,8,27,39,69,3,95,3,16,39,
+8,2,23,55,55,131,7,76,69,1,94,1,109,5,12,1,30,31,1,70,
+13,103,2,32,42,3,57,134,238,68,164,1,388,72,1,2,58,1,400,1,
+7,1,25,5,13,4,26,11,126,4,122,3,1,7,21,10,9,66,17,1,
+5,219,112,2,596,4,23,1,1,10,52,10,2,121,28,22,17,2,3,24,
+21,7,222,23,11,4,13,63,15,7,42,439,62,32,4,49,15,144,59,13,
+1,56,122,2,84,11,1,102,4,20,35,4,64,2,7,1,64,73,5,2,
+109,54,113,6,84,2,5,105,4,73,2,17,8,124,4,19,30,11,5,1,
+30,12,307,31,21,1,14,2,52,22,285,7,1,3,7,5,71,141,6,71,
+62,200,496,1,8,6,2,6,54,25,362,97,16,1,125,103,7,125,41,18,
+69,48,3,18,188,3,1,7,107,2,18,2,323,1,1,25,16,6,14,7,
+2,10,19,10,4,28,1,30,208,40,1,60,5,43,2,24,14,4,144,0,
+24,3,57,116,20,433,13,12,1,9,2,40,42,107,38,14,38,11,1,1,
+27,9,35,3,64,1,4,16,1,20,1,188,16,172,8,4,30,3,9,235,
+6,51,2,1,42,60,25,33,41,5,12,290,7,48,38,6,16,1,15,26,
+0,9,70,4,5,46,44,12,203,2,4,42,7,23,76,1,85,53,15,6,
+57,7,1,15,59,12,9,12,87,0,4,104,12,372,52,65,159,122,49,1,
+7,1,71,72,69,11,288,40,86,1,13,43,80,1,1,19,5,69,130,8,
+4,0,11,2,2,70,78,230,1,61,64,19,3,23,283,8,72,15,2,3,
+37,35,282,60,36,1,73,1,31,7,163,0,37,6,24,50,54,8,3,22,
+148,267,92,5,1,10,1,3,25,66,11,575,18,1,100,1,1,1,2,288,
+21,4,2,3,118,68,144,31,38,77,2,110,8,171,22,29,6,147,119,2,
+36,35,318,1,4,15,9,101,81,5,46,139,30,2,3,19,73,167,16,11,
+40,70,3,16,1,884,0,1,88,5,76,1,48,12,25,1,86,2,65,170,
+22,1,18,8,2,22,7,1,18,8,2,19,10,34,3,1,406,33,0,51,
+134,5,1,0,119,250,1,17,2,95,11,11,3,15,238,21,226,1,26,110,
+131,1,45,5,9,2,1,35,19,86,2,38,1,4,6,190,6,27,4,5,
+213,1,6,28,33,12,6,54,1,27,33,1,4,143,90,11,160,16,265,6,
+12,193,30,78,4,37,37,5,1,1,1,80,1,83,18,51,22,32,2,49,
+47,55,9,41,44,36,1,97,39,3,28,68,17,10,1,69,1,1,206,36,
+5,59,7,1,4,4,95,208,7,354,163,55,134,4,6,20,27,16,9,15,
+36,31,15,89,1,2,55,183,60,4,11,25,69,103,106,3,0,54,129,5,
+1,3,35,4,448,20,17,98,1,165,147,53,21,47,3,389,1,200,48,3,
+5,55,231,75,102,3,10,5,5,2,241,2,1,46,166,114,23,1,40,370,
+22,8,8,13,3,142,34,20,26,17,4,1,119,111,88,0,2,9,61,0,
+143,7,28,178,12,119,6,8,4,68,161,0,110,0,184,261,32,3,46,26,
+1,113,71,169,1,1,1,19,3,54,245,168,3,1,32,1,10,41,232,261,
+13,26,9,23,9,19,56,38,2,106,1,4,4,27,0,12,4,1,14,18,
+4,9,19,109,13,1,174,67,58,157,181,13,151,44,193,195,47,48,10,1,
+26,25,110,10,14,4,24,64,29,1,2,153,89,7,10,34,14,14,1,202,
+26,9,28,2,32,108,31,19,184,167,17,1,7,44,0,124,2,24,14,23,
+5,40,128,10,35,10,137,0,24,54,119,3,18,179,2,65,1,154,106,7,
+1,41,6,2,56,283,8,15,279,322,28,67,1,6,19,23,94,303,34,106,
+0,16,54,1,6,3,4,3,16,8,34,5,6,0,2,94,5,4,18,11,
+17,1,4,10,5,91,3,2,39,6,1,27,40,201,61,13,11,45,116,7,
+2,81,8,11,17,279,116,139,26,78,31,4,3,38,36,8,474,153,109,227,
+6,4,10,143,2,4,5,1,447,16,200,54,48,8,292,12,201,354,19,2,
+10,134,153,9,62,1,7,28,9,146,68,209,2,38,3,10,15,74,64,62,
+250,6,23,18,6,38,87,225,529,717,38,47,3,107,109,0,29,3,18,5,
+1,5,1,33,52,17,1,1,30,64,9,28,19,309,105,51,30,124,140,19,
+1,5,25,162,7,17,10,225,233,2,1,53,4,1,8,1,335,9,7,4,
+3,502,178,3,8,19,80,0,19,22,58,8,1,358,319,1,96,50,3,6,
+18,28,30,103,192,160,130,1,84,66,124,15,132,19,1,11,1,3,15,42,
+1,438,5,54,64,4,227,0,129,65,1,3,3,3,4,43,12,4,50,38,
+4,0,7,30,4,77,2,12,132,42,2,1,45,7,8,28,3,30,45,7,
+31,39,24,44,0,121,365,3,83,7,25,4,5,17,270,1,248,25,162,93,
+16,41,41,503,64,385,258,215,4,101,40,345,7,109,2,327,11,4,2,247,
+8,344,86,16,129,5,83,38,190,7,56,122,39,31,6,1,50,12,12,2,
+144,109,14,17,27,108,99,88,35,36,8,5,13,331,85,20,157,1,77,5,
+66,20,1,3,280,78,13,47,68,1,183,2,8,23,91,368,170,202,151,1,
+96,10,443,184,134,447,245,19,14,7,96,29,19,41,1,36,6,63,6,21,
+2,99,5,50,14,162,119,22,55,1,4,87,74,15,143,289,1,2,24,550,
+95,2,61,67,2,373,40,80,3,4,424,20,29,1,31,20,12,48,5,78,
+2,215,88,4,0,17,1,10,26,78,147,451,30,1,446,63,201,629,92,138,
+66,31,0,192,184,1,3,4,237,36,1,246,3,184,27,49,2,7,44,777,
+3,92,10,7,150,37,3,86,33,3,29,4,44,1,510,67,98,22,5,1,
+266,1,3,42,208,1,1,200,24,4,12,15,35,4,0,89,1,374,153,4,
+43,313,3,192,23,10,5,562,9,50,31,132,338,33,407,129,14,18,9,94,
+68,305,496,82,56,2,12,12,21,11,424,4,1,1,8,2,15,3,12,117,
+35,5,6,9,4,4,3,2,1,270,8,56,72,6,497,64,238,238,4,3,
+3,15,3,91,71,9,11,2,4,173,89,4,0,303,17,9,2,14,53,14,
+24,290,34,372,35,1,21,36,282,15,3,17,332,15,4,268,12,38,28,1,
+13,69,1,19,30,0,168,4,124,2,107,8,65,88,154,54,27,91,217,3,
+19,31,115,3,34,32,129,45,14,3,206,77,47,110,11,0,135,468,39,1,
+325,34,71,8,52,2,213,62,25,97,2,1,0,40,126,122,1,56,6,43,
+1,16,122,72,2,120,126,14,71,245,102,1,173,8,5,13,218,2,443,23,
+4,104,234,8,67,4,569,1,342,1,1,49,56,341,19,39,20,9,2,115,
+35,465,12,443,11,52,42,12,12,9,158,22,253,104,5,2,97,1,17,1,
+145,1,22,53,48,18,8,37,1,266,1,1,173,51,277,4,13,30,1,8,
+4,81,1,5,34,2,137,330,32,20,20,40,137,36,62,205,1,4,26,49,
+20,10,1,7,488,111,13,1,415,5,10,1,241,22,47,3,91,3,89,25,
+2,243,305,35,0,15,816,17,20,3,64,54,167,150,3,285,407,623,10,137,
+32,4,1,540,8,1,661,8,14,35,6,21,1,5,1,211,36,5,2,36,
+37,93,6,87,88,4,319,18,144,33,195,30,14,31,25,208,174,221,101,83,
+1,129,3,78,316,1,12,1,143,92,0,179,30,153,6,1,156,3,5,105,
+20,2,29,35,479,45,1,122,11,62,38,38,218,101,10,1,121,10,20,155,
+2,11,9,7,32,155,0,38,3,81,6,8,25,482,44,3,207,1,62,23,
+14,2,3,89,26,198,218,231,62,2,4,1,255,67,349,24,8,98,47,1,
+15,4,157,44,42,387,12,559,49,270,3,2,1,42,71,3,2,5,132,2,
+15,4,1,4,39,26,50,1,26,16,1,9,32,2,178,3,6,295,7,118,
+88,5,9,211,13,15,253,495,2,137,18,51,37,25,0,6,114,13,51,0,
+79,116,7,142,40,18,1,4,6,177,2,49,1,319,92,102,1,201,157,95,
+99,13,7,151,1,1,28,72,145,85,15,2,19,108,1,37,9,285,19,212,
+15,22,22,38,16,132,5,18,53,859,8,233,25,287,1,24,129,99,32,705,
+65,139,2,0,102,149,90,12,141,129,767,556,187,1,32,104,11,3,175,64,
+4,34,0,28,401,43,4,36,76,1,16,114,11,28,8,3,3,81,383,2,
+0,176,26,104,186,290,9,401,23,1,107,38,291,5,3,7,3,11,16,212,
+3,5,145,39,19,50,262,119,11,0,23,334,4,5,107,231,11,25,10,98,
+283,151,418,418,2,29,3,20,134,1,41,4,66,93,2,206,1,7,1,316,
+118,58,14,142,18,20,56,111,14,558,7,16,4,376,44,4,1,4,10,25,
+33,34,29,54,1,78,1,19,79,1,19,147,195,20,8,25,573,463,3,89,
+42,5,248,5,643,43,240,4,39,3,3,70,6,12,68,2,2,4,5,725,
+60,31,2,1,528,32,1,2,343,84,137,20,200,2,131,297,1,281,1,365,
+125,27,6,398,7,321,1,12,47,1,2,21,59,1,560,204,2,1,441,4,
+58,87,233,16,634,108,7,24,44,61,0,545,517,8,232,1011,4,6,129,1,
+112,24,16,25,68,6,73,1,92,4,2,46,441,1,35,388,8,3,4,105,
+45,13,2,40,10,16,4,2,0,5,15,375,649,44,11,1,26,162,1,3,
+17,63,85,103,12,216,7,172,179,4,586,49,186,28,399,242,593,4,87,50,
+8,11,5,5,19,20,1,5,52,20,63,4,45,16,2,817,112,2,92,212,
+23,1,390,8,2,10,4,46,41,90,100,7,138,12,36,2,76,35,3,8,
+2,12,78,17,3,131,4,14,106,34,4,21,21,6,4,193,437,57,1,95,
+45,1,9,4,20,59,385,20,16,3,1,32,30,0,318,14,72,141,4,166,
+9,160,40,742,41,2,128,8,20,181,159,214,3,0,386,225,358,23,109,7,
+126,193,198,29,65,24,21,18,91,7,2,83,45,41,96,24,22,4,107,87,
+113,6,7,354,2,64,0,1,66,94,80,5,3,35,69,174,57,5,67,1,
+178,2,574,3,3,75,93,54,60,5,14,19,1,5,2,3,1,22,40,37,
+159,34,9,64,140,2,418,1,14,31,1,510,12,61,3,198,2,1,146,260,
+95,5,82,11,35,11,281,1,39,25,2,62,23,162,20,20,18,78,138,6,
+14,15,118,38,206,6,110,411,2,639,217,174,101,6,1,603,501,134,5,344,
+1,15,35,176,15,269,538,217,16,72,55,8,56,332,1,2,82,13,8,1,
+336,346,135,82,131,25,247,127,99,2,4,86,40,6,56,5,1,286,33,0,
+324,131,125,81,2,6,489,236,259,128,132,5,28,122,287,15,113,7,762,36,
+1,242,62,17,45,270,56,24,101,9,13,47,122,424,33,205,309,155,29,14,
+4,1334,4,48,1,581,220,54,142,169,1,157,5,41,277,2,119,3,43,72,
+37,38,9,13,192,1,7,46,34,21,25,19,335,61,41,13,42,53,10,7,
+8,104,184,28,41,26,120,96,12,55,17,2,71,237,7,435,2,63,4,26,
+82,338,12,63,61,1,73,0,37,198,6,118,66,1,1,19,2,71,26,219,
+143,44,136,8,77,638,4,30,104,2,1,24,1,1,188,2,2,42,4,745,
+198,89,42,17,1,101,7,29,111,7,9,9,12,6,2,14,203,83,572,50,
+3,97,63,20,25,5,33,174,210,226,0,4,573,30,91,4,214,97,236,30,
+72,9,7,132,15,145,3,1,20,1,43,2,77,25,23,16,68,21,275,216,
+31,52,15,204,73,61,173,3,15,3,103,298,11,338,0,11,10,50,29,10,
+2,180,45,134,57,1,63,7,7,6,10,424,9,37,62,21,27,22,44,3,
+1,31,700,2,618,3,1,8,55,1,6,5,62,234,183,31,3,269,199,12,
+1,6,128,65,30,105,2,105,5,37,3,2,209,228,16,27,1,26,121,16,
+15,14,171,1,22,14,33,71,170,130,329,3,113,27,58,92,100,3,151,13,
+9,98,14,980,112,25,24,19,121,443,39,0,2,3,68,278,0,406,15,17,
+3,46,36,3,33,462,2,132,179,841,5,31,27,13,34,95,58,4,14,27,
+5,12,23,9,29,9,65,188,493,286,4,2,14,47,23,96,483,2,2,1,
+1,615,0,113,647,200,81,34,58,1,43,12,1,7,6,43,17,35,4,8,
+589,29,29,381,34,36,18,3,93,180,13,18,207,14,195,94,92,84,235,52,
+6,0,274,13,13,76,625,30,2,5,150,10,3,26,687,101,103,2,68,128,
+169,50,56,21,7,1,25,26,69,56,6,11,46,177,433,2,32,23,33,5,
+175,12,13,200,428,1,10,200,3,87,38,8,4,1,1,1,339,67,1,21,
+59,16,200,371,28,164,57,1,150,97,9,2,69,32,3,308,2,12,8,1270,
+17,75,447,207,348,10,1685,350,744,12,8,250,1,396,27,2,16,6,98,7,
+1,48,10,19,35,1,27,5,62,1,147,1,35,48,2,156,551,1,860,63,
+30,208,197,73,71,35,26,107,66,243,1,1,3,93,145,38,7,1,11,7,
+1,48,43,23,53,30,1,346,12,1,61,9,75,18,58,33,4,2,317,1,
+18,5,134,195,639,258,145,160,0,11,4,17,25,34,19,4,19,28,3,32,
+229,47,413,361,6,424,0,29,295,156,6,5,8,12,236,7,20,1,619,1,
+294,231,62,112,1,84,96,2,134,141,10,11,11,90,194,324,1439,66,7,152,
+132,480,185,1,1,342,4,118,10,577,4,1,32,14,756,11,57,48,126,7,
+348,13,151,183,11,1,55,93,76,56,278,4,1389,144,246,2,10,27,539,105,
+2,711,197,54,718,37,7,261,403,248,1246,452,870,19,56,1,39,2,5,89,
+2,6,271,27,1,68,1,125,6,5,1,85,26,16,1,538,78,5,68,139,
+89,240,5,1,1,118,2,645,9,17,116,5,747,234,28,92,1,4,108,631,
+61,6,33,1,229,257,1,54,153,91,187,29,140,3,3,32,62,30,0,384,
+25,123,2,361,10,1,203,37,599,309,3,7,1,43,125,26,18,2,13,11,
+141,1,46,209,2,38,5,181,85,28,3,1,1178,8,33,26,1,160,21,6,
+15,33,14,6,155,1,28,88,109,169,10,6,65,607,150,1,141,1,58,423,
+14,56,15,1,15,104,24,4,26,81,1,180,38,43,20,584,17,3,456,10,
+10,205,92,194,68,183,115,146,234,73,33,15,2067,29,63,135,137,15,44,115,
+73,38,9,243,1,112,10,1,344,7,6,11,41,572,197,39,76,154,155,14,
+736,29,57,2,4,2,163,773,1,10,64,2,4,0,85,59,54,23,1,6,
+12,245,1,146,470,59,118,109,208,27,6,301,17,121,72,14,351,289,120,43,
+4,240,1,56,6,92,22,991,1,25,13,0,12,9,13,152,1,134,20,41,
+12,65,16,14,276,15,13,97,78,86,1,180,1274,1,33,14,0,334,31,492,
+15,3,11,189,158,222,2,4,9,704,4,1,27,16,163,1,20,51,3,111,
+2,48,19,60,1,1,53,36,171,192,10,363,258,50,10,183,14,1,5,106,
+37,158,143,278,11,428,286,200,161,54,171,111,13,1,1,22,5,22,39,65,
+352,19,51,1170,286,129,14,250,26,820,6,361,59,6,353,22,29,97,105,446,
+21,6,53,120,164,77,10,459,124,380,1,18,7,482,56,9,2,1101,16,2,
+127,9,164,183,246,1,426,394,8,719,104,802,2,79,6,12,4,108,5,94,
+64,239,123,34,8,22,51,1,6,22,414,108,113,6,3,49,46,271,33,137,
+7,4,91,3,3,2,41,17,43,100,9,1,22,42,73,190,560,17,67,49,
+57,167,184,1,956,3,1,2,6,36,96,10,2451,648,8,23,3,121,347,84,
+1,1,418,190,57,14,1,9,191,2,8,2,145,2,1,23,99,1,41,63,
+80,201,217,990,0,74,342,19,86,6,103,2,8,5,6,1,1,333,417,288,
+24,298,9,45,193,138,4,8,739,8,48,166,56,62,1,7,2,135,9,227,
+2,5,0,151,2,214,192,8,3,3,149,121,13,241,7,2,2424,454,13,239,
+18,22,148,3,144,31,86,3,86,176,98,5,1,10,18,609,153,27,175,0,
+239,84,1,139,35,23,1,6,310,31,15,14,253,172,1,481,181,505,4,285,
+224,6,972,166,13,30,185,158,2,48,16,191,207,175,34,36,227,679,17,1,
+269,31,167,234,2,22,17,0,2,671,193,34,188,1602,26,1,157,5,11,5,
+17,2,3,1,17,406,37,12,74,231,69,642,813,19,35,297,33,37,388,135,
+12,698,1,2,45,31,109,45,575,19,37,310,18,1,248,539,27,1279,27,3,
+122,11,45,355,9,2,81,70,340,18,3,65,161,1,13,397,0,0,96,1,
+20,2001,1,31,4,84,67,170,1,25,139,55,3,453,1618,872,1,7,55,1,
+445,7,1,85,802,0,10,57,142,47,1,85,3,138,105,200,1,4,12,3,
+3,519,384,110,119,129,7,2,230,5,7,9,99,3,2,115,44,4,356,148,
+28,65,170,158,1,5,430,638,66,132,1368,106,2,1366,1,68,36,1,5,9,
+866,477,235,1,19,396,133,52,3,25,22,1201,716,9,12,2,706,3,29,20,
+365,17,15,1,3,7,127,1,8,27,639,18,400,3,1,652,37,5,18,86,
+45,1,114,260,8,17,40,460,1,41,39,1,524,468,15,100,11,36,350,4,
+214,4,80,53,2,81,23,201,11,155,579,16,49,0,30,68,46,15,3,78,
+107,52,75,92,83,334,42,20,724,389,0,3,7,0,94,1,180,3,1,618,
+83,3,33,19,5,62,14,142,27,11,5,61,169,439,11,14,54,2,76,2,
+554,168,7,97,1,65,36,267,29,14,114,73,6,1,64,305,208,449,26,1,
+11,285,172,3,10,6,1,575,36,16,171,909,1,121,5,1126,1015,437,75,6,
+38,7,33,8,17,67,56,106,32,466,358,5,1,1,22,179,16,26,10,5,
+63,43,19,190,27,87,1402,25,2,2,1420,51,1,59,18,39,8,13,55,2,
+513,298,1,37,40,23,66,26,554,28,2,665,6,8,80,96,144,82,418,78,
+12,49,65,33,49,0,19,57,9,7,42,37,136,154,8,6,1,2,8,7,
+17,21,48,162,104,61,5,422,242,90,1,528,0,8,283,58,46,97,51,25,
+947,20,39,121,3,88,2,609,1137,11,517,244,646,52,8,0,6,19,131,1,
+78,97,211,1,503,96,31,11,13,26,24,134,296,6,2,1,193,38,161,20,
+5,245,10,44,328,198,285,11,9,5,21,17,10,4,262,29,343,1,270,23,
+89,104,6,403,317,416,361,33,44,537,189,87,9,19,42,121,30,15,9,522,
+350,167,24,256,117,637,28,108,3,90,5,1,162,232,17,2,4,230,12,32,
+55,826,77,1890,12,19,1,2,176,5,14,0,289,165,936,75,4,5,209,453,
+22,1,245,425,119,2,85,665,14,1215,23,37,34,256,1,694,352,5,25,9,
+352,1145,9,81,1,303,11,2,47,734,2,103,3,803,11,9,38,40,159,1,
+3146,541,13,3,56,15,19,273,40,14,61,16,15,548,313,16,51,108,8,1121,
+1,1,422,2,6,93,163,86,1036,27,0,145,161,2,22,408,12,8,581,129,
+156,263,7,1075,5,39,1,4,21,146,2,65,73,1,751,9,306,6,315,2,
+127,3,257,542,443,8,6,328,41,22,406,98,821,9,9,51,22,46,77,388,
+106,11,180,140,73,93,4,146,874,47,9,630,5,17,766,1,325,1,198,387,
+10,334,337,420,35,429,613,86,42,0,158,4,50,287,208,54,5,198,8,454,
+26,50,332,1,797,1,8,36,9,208,19,1,94,50,2,614,237,10,95,16,
+12,0,1713,1,7,7,23,1315,101,99,37,37,219,693,70,110,1048,121,5,1841,
+187,25,3,119,820,568,85,356,2,0,2,35,20,735,4,36,8,7,17,53,
+3,109,1056,525,51,111,214,76,5,57,6,96,14,5,28,117,178,6,1,24,
+34,63,266,208,191,75,34,55,141,49,3,40,14,58,61,36,240,1,74,90,
+16,2,41,32,384,108,1159,14,0,22,36,33,1,0,305,0,1,39,1814,21,
+21,21,12,11,54,9,28,24,68,1167,62,477,57,195,8,72,13,13,21,358,
+18,18,309,118,241,95,320,1,47,781,13,491,44,1338,1714,45,75,1,16,0,
+47,2,3,7,1,751,6,104,369,13,67,749,81,0,14,389,28,107,10,407,
+1,1,1696,8,30,92,93,4176,32,135,644,0,11,6,140,12,149,9,2,205,
+210,751,0,41,1,1,37,384,1,1544,1185,113,5,13,1,9,24,20,2,9,
+49,3,2,50,320,3,22,15,9,820,329,1294,2424,0,90,11,105,47,8,1,
+127,2,1,10,363,2,60,749,1,186,98,28,6,107,7,7,463,235,38,32,
+20,1774,506,1,204,714,68,415,36,2394,340,6,321,3,19,703,22,8,24,648,
+3,86,2177,4,9,6,10,1539,24,1229,23,7,460,46,2,16,171,130,352,146,
+3,2,9,71,6,309,92,16,1090,2,49,865,11,692,50,398,3,3,293,3,
+27,8,366,555,69,41,384,1,952,8,3,7,338,180,19,4,15,133,1,27,
+38,12,2,246,3,2,17,46,25,2,1,621,5,28,3,517,680,273,969,164,
+71,64,9,11,41,29,28,262,639,17,413,1,2,22,0,36,33,38,371,533,
+758,5,1,59,93,54,55,2,1,6,318,853,33,78,8,7,235,130,22,952,
+63,58,64,1,166,6,8,6,18,2,2842,11,27,649,302,129,84,8,483,59,
+173,69,274,279,369,3,45,11,41,22,115,64,1,10,358,346,5059,10,6,187,
+104,471,1,293,349,5,144,44,348,15,1742,596,4,81,176,361,486,52,170,452,
+847,250,13,467,4,18,103,0,5,1,92,123,37,124,1667,24,218,1,30,235,
+119,11,24,1,18,133,21,18,799,930,9,1,0,1,1,12,1,359,130,3,
+366,69,1,261,396,8,73,1114,330,40,2,9,15,744,1,96,1,129,278,45,
+73,1,63,847,12,505,42,1,271,1,123,30,6,336,18,58,35,21,205,309,
+19,108,117,114,2,14,36,51,100,25,1,2384,38,131,71,865,57,34,173,28,
+35,229,12,0,59,446,9,273,43,3,4,48,7,1347,153,16,94,67,404,41,
+70,1301,65,344,323,274,43,88,1,66,171,621,50,316,684,367,85,126,399,5,
+33,210,203,47,11,5,178,692,586,1,195,277,28,282,797,868,2,867,703,228,
+531,1,347,112,184,198,1689,27,863,592,15,1,32,1,1137,1693,124,36,184,1,
+5,384,584,1,1134,590,184,29,1,248,233,16,5,15,21,63,8,156,36,43,
+3,207,596,21,40,17,248,205,74,4,1,56,463,6,172,67,125,2,4,13,
+5,1432,30,55,50,7,5,25,840,45,29,2220,1,29,169,1,2075,10,61,187,
+1,121,24,18,6,1,23,57,9,1,14,20,321,541,24,208,1199,149,111,2,
+4,3,10,90,263,568,8,428,5,50,61,432,9,314,84,24,198,92,7,5,
+448,1,4,38,4058,42,99,83,132,3,85,113,164,121,3,292,114,329,64,220,
+793,317,89,39,232,612,109,1,110,9,1,2,845,561,29,191,388,314,2008,15,
+10,95,7,113,1,3,14,4,21,1,334,25,39,323,163,168,16,11,72,141,
+747,1420,177,5,46,11,899,161,194,6,7,190,188,164,233,83,297,473,972,30,
+555,2,350,183,1243,5,347,5,8,1517,2,725,2,9,2480,624,14,342,73,177,
+4,58,5,84,601,213,4,8,1768,1638,2521,20,1444,631,26,360,914,37,351,3,
+34,38,1046,4,101,355,6,331,95,157,1172,1136,11,38,7,3,986,102,365,417,
+7,82,919,143,95,35,6,212,1,87,1512,740,24,1,37,1,41,1482,3,131,
+293,1294,4,12,0,1,41,24,158,1227,324,1024,42,180,6,394,32,1279,6,178,
+897,764,28,1,6,6,35,495,987,160,1,771,1664,333,1499,416,1,127,13,48,
+43,18,747,664,5,73,1202,465,86,1,4,241,472,101,3,9,2,74,59,1659,
+361,126,68,18,1785,136,53,74,433,42,7,8,135,1102,5,11,3,57,14,14,
+20,404,374,157,2,6,573,37,146,72,48,97,3,20,26,820,1,27,360,84,
+329,79,235,526,35,207,23,156,31,38,33,2,313,37,12,29,882,3,185,4,
+1,1507,48,52,1,49,667,432,4,6,1443,85,3,9,20,18,2,15,121,23,
+48,124,7,159,20,79,1850,142,1007,721,26,9,263,1,864,52,2,576,2096,30,
+115,50,441,915,30,16,10,1665,517,24,65,2187,207,78,629,1,6,294,46,1003,
+20,291,627,14,19,295,0,50,48,191,13,601,102,465,492,756,11,3172,56,1,
+240,3,7,134,49,900,307,29,51,229,232,155,0,45,431,213,182,16,32,39,
+218,51,88,35,26,172,188,2426,534,29,177,284,84,27,143,99,475,160,13,618,
+5,103,45,181,99,1040,1470,123,490,17,19,467,167,53,1568,17,31,1,4862,281,
+220,40,29,1,20,649,47,437,30,267,37,54,3,286,221,358,21,898,973,8,
+42,1,73,1188,81,73,719,7,50,5,103,276,118,37,155,10,34,139,379,3,
+1,37,667,109,168,402,124,1290,12,286,1685,3,1,2,64,1550,455,538,167,2225,
+43,276,135,17,478,4,175,196,70,22,194,25,52,13,157,1953,201,22,219,1444,
+1,2,3,1072,211,90,3,492,132,37,33,515,1137,1652,563,68,68,11,1,0,
+2353,15,67,193,19,20,1393,262,69,364,709,14,180,423,305,404,1,85,377,135,
+370,3,235,50,95,9,15,70,30,1,5,60,9,3,263,5,20,159,177,1671,
+2,297,4,192,238,178,25,1390,5,1,4,78,603,246,32,999,2,248,0,226,
+241,153,2241,39,666,23,11,6,375,989,53,129,991,63,12,71,627,3,433,141,
+1066,253,85,0,30,233,111,12,2504,847,13,89,793,280,70,28,28,671,2,296,
+6,26,1032,38,1296,397,108,2129,60,988,369,14,81,299,6,232,439,664,114,4,
+68,21,1752,239,20,142,697,10,35,52,429,75,7,834,2,3760,56,7,477,24,
+1,2605,253,1,2,32,8,73,659,335,769,103,0,19,275,102,12,16,1374,5,
+47,1,66,1,305,39,1543,14,441,390,9,3,203,60,139,2144,572,191,5,722,
+28,24,51,40,1,97,1329,682,673,208,158,10,79,19,936,921,164,15,125,11,
+1,69,197,0,14,0,80,6,940,360,213,2,1324,432,1514,0,16,2088,206,33,
+10,14,0,107,62,63,25,0,698,359,2,2,18,16,63,445,19,516,1523,233,
+11,3,2,62,154,583,4,210,173,62,0,1,14,25,25,388,5,1018,729,369,
+695,146,1,1790,0,1770,22,296,131,118,1,66,70,324,193,9,9,277,2502,564,
+170,24,453,4,319,0,88,4,120,88,14,981,70,359,2,21,4,2486,79,1,
+1151,6,10,70,663,347,318,7,118,60,115,7,3516,327,13,1,1,4,451,231,
+1,33,53,83,35,87,966,7,51,1415,127,171,1,483,187,117,345,37,40,35,
+1,1845,32,112,192,10,865,759,46,28,32,128,26,58,346,2,1182,24,98,98,
+81,277,56,627,244,2345,2,217,361,1923,2333,4,132,1755,201,8,19,13,3353,1112,
+558,326,2146,2,61,97,85,131,14,170,1,849,59,630,1162,1,653,154,226,4,
+652,22,34,1843,48,449,6,5,7,1,3898,83,733,190,22,1705,14,71,295,31,
+10,253,2,1083,716,129,4,3,467,15,82,7,491,100,173,7,962,13,1589,130,
+235,226,0,10,564,3766,130,2,4731,182,218,24,3,289,453,40,105,178,84,57,
+19,597,389,58,260,111,1512,249,17,1186,29,366,1789,267,42,18,409,3,111,583,
+84,227,164,1,1,91,112,1,4148,257,15,6,4,139,1,1750,75,0,450,1230,
+465,15,1,1,2160,265,19,1,450,1274,5,155,70,10,1467,130,190,1530,102,55,
+5,1,577,122,1,1339,1680,34,240,616,7,1448,111,575,34,1151,1128,506,81,3563,
+2,514,102,39,14,24,10,1722,766,77,4,1844,1170,123,2,201,80,466,826,84,
+132,57,0,436,1,1,14,66,280,444,2,739,3739,231,424,79,10,24,2,9,
+3614,372,11,22,441,501,192,117,138,4,2,732,113,158,7,333,595,24,1333,1709,
+95,1,2233,9,140,918,49,80,286,3,2,26,1,2514,1586,7,268,62,961,80,
+32,497,2,614,4,36,2,163,23,298,130,339,10,1,16,186,455,25,305,709,
+145,1,28,1049,4,640,26,650,58,2,2028,20,1054,350,1,96,8,3,12,27,
+558,13,289,69,2624,15,755,293,153,1,424,119,2866,163,223,378,2,247,5,629,
+476,3,17,4,1617,2,285,1800,1349,4901,935,890,3,1979,336,955,129,13,179,159,
+5,26,781,11,47,334,251,828,57,58,66,39,242,879,9,487,656,240,3656,22,
+133,762,6,40,589,26,54,185,5,49,384,170,135,129,1755,943,803,41,11,2,
+29,162,68,9,573,58,2046,1654,92,17,92,39,2374,9,171,106,3343,307,2,10,
+1463,2,59,156,2,32,939,66,59,1217,4,30,13,173,1,534,1,8,44,104,
+2400,220,380,26,987,3740,1,3,38,6,2,4,15,1,33,9,1669,695,6,44,
+1281,957,368,377,2634,1877,14,127,73,10,483,19,0,6,3,3470,407,1636,498,100,
+534,132,26,715,16,528,1332,395,1244,126,194,20,2,5,156,28,2,5644,386,47,
+394,1,224,8,2,278,3,1657,940,114,2,499,5,801,37,1329,181,421,1295,933,
+10,49,124,143,120,1079,120,25,965,19,7751,584,263,24,12,0,43,2539,3105,1517,
+5,64,186,13,8,190,546,23,1088,14,162,2678,18,36,1531,1560,1490,3,254,1678,
+1267,18,11,11,3,1,4,14,24,124,659,236,6,41,44,3,74,2911,106,40,
+514,1115,92,2555,676,251,367,1666,75,7,4,1,467,2,1391,1938,142,23,220,11,
+1,181,105,199,710,911,107,848,25,425,3707,2156,612,317,892,201,5949,3,686,0,
+0,595,152,8,168,867,142,1420,46,2,15,655,1,151,2079,938,497,2209,1,172,
+487,86,2252,365,84,341,153,34,1,476,549,109,23,8,10,196,4,352,1,13,
+152,388,527,534,935,206,4,1359,35,4,69,269,548,492,35,764,500,59,416,216,
+8,176,265,258,1,488,0,8,3,16,579,71,395,2387,2,171,11,1,151,1139,
+21,19,1250,28,40,1,1,477,295,13,53,30,383,114,2,1,5,116,538,40,
+4,656,4,708,87,500,24,974,1167,234,1136,25,1338,22,575,806,1092,88,0,369,
+75,383,1,4,315,9,19,2233,15635,526,659,1810,1727,66,4,114,1658,152,540,667,
+2,1,406,1482,0,1,105,14,2,5,112,540,4462,1101,2,69,53,9,129,9,
+2,2,7,122,1468,70,109,10,872,589,25,134,45,247,3955,720,4973,930,473,109,
+2253,4362,2078,136,988,832,666,32,2,1849,109,10,23,48,903,261,87,295,24,2096,
+3592,259,91,2,45,150,3,235,166,71,277,1062,1,392,125,15,659,430,1338,2136,
+730,172,71,74,2,4,3,169,81,21,589,702,4540,86,667,481,2636,867,387,75,
+911,856,1419,789,7,0,14,94,26,1264,43,41,60,0,1124,30,2145,11,1061,347,
+4092,179,32,1,244,2491,369,2100,238,78,6,14,0,206,116,435,712,1778,835,359,
+397,23,4,469,23,473,1205,6,52,1,309,525,23,14,16,335,87,31,11,1430,
+38,2401,335,8476,3671,107,2,511,101,943,9,3142,15,11,1191,100,77,23,4,1936,
+76,2025,7,17,409,8,56,284,901,1168,249,41,73,9,2,98,75,114,1923,15,
+1,168,213,36,4,1,3,1184,136,27,10,14,408,6,33,6204,97,1,148,569,
+335,1787,38,2,1175,1,41,115,2,156,8052,410,891,1,30,759,122,145,15,1423,
+4788,446,30,563,1280,20,2,552,146,526,0,1362,24,11,582,776,22,71,2045,17,
+26,2,248,247,7,287,1,27,3870,2936,52,1544,12,25,3132,1267,1,39,7,1,
+2258,2368,39,347,22,5,362,57,249,10,579,68,512,12137,5,2141,236,1,1,5176,
+176,43,117,143,90,3001,488,42,3568,108,363,1635,22,139,790,3090,2,1023,38,4131,
+562,2840,737,166,6245,4911,387,4,471,577,92,1012,32,5,6135,36,161,490,3,555,
+1319,83,2118,8,466,4548,59,19,1377,906,220,464,5534,119,25,177,2,30,1392,408,
+4,1086,2075,2,120,249,739,1,1066,77,25,109,4,618,149,22,1379,12,1290,1423,
+7,39,2,12,507,9667,2808,53,5,385,3897,288,5,504,128,2166,4946,121,47,9,
+11,754,12,6703,8424,299,921,81,1630,6264,4502,39,3,1529,638,1,2754,16,5,1,
+96,68,35,694,435,1,0,8,9,1156,9188,14,37,6903,42,2981,657,3501,20,135,
+3,37,7,6110,34,13,336,86,0,7144,82,1652,38,11,15,19,1809,548,15,4872,
+324,297,432,101,4,12719,31,390,269,7,91,70,1522,5,159,406,2,64,680,51,
+243,6885,4285,2865,6244,5,154,179,19779,248,11,18,28,169,30194,2,106,54,19,2212,
+6370,28,1,1,4085,355,88,1129,4,12,
+};
+constexpr Code_Point_Name_Slot code_point_name_slots[33243] {
+{0x034024b7,0x4b65e769},{0x044032c2,0xccb8c10a},{0x02a02886,0x39b03d65},{0x04610b3f,0x8ab6454b},
+{0x02a02892,0xadaae3d3},{0x01e0a902,0xe019fad7},{0x03a00681,0x718e9686},{0x04202ab0,0x38247c3f},
+{0x01c01952,0x60c8784c},{0x02200786,0xc399d080},{0x02a11937,0x4daf335c},{0x012026ce,0xd09829eb},
+{0x01e0a6d4,0xf25000ca},{0x03202eec,0x46bc1394},{0x07a02b80,0xcdb99b22},{0x03801ab8,0xc590d6be},
+{0x02616a2c,0x9a568d72},{0x02201361,0x9bb2cdae},{0x0480a72e,0x8cdba557},{0x03a1ee54,0xb93510cf},
+{0x01a1f4fd,0x9a212bd5},{0x02a0a9a8,0x13d4f158},{0x0361d510,0x0ebc4e47},{0x03210cd3,0x5b9a78f2},
+{0x03e18b2b,0xa5d55c58},{0x02a1086b,0x01835769},{0x03a12427,0xea4f7b01},{0x03e18cc4,0x748783f0},
+{0x02801457,0x0c801a38},{0x02c13296,0xf8b77239},{0x01c0a520,0xdc104ade},{0x02211045,0xcc2efc0c},
+{0x02602a6c,0x8ef8a597},{0x02c108ff,0x36fc06f6},{0x02418855,0xec6b5c9f},{0x02801095,0x846d2995},
+{0x03e02cd4,0xc63ecfb1},{0x03010a50,0xc4ea2827},{0x02e13148,0x5a2d0643},{0x0180a45f,0x3e727940},
+{0x036018f0,0x88f0650d},{0x024188f0,0x131dab1c},{0x0241897d,0x2f90334e},{0x04a1d656,0x3f1b140e},
+{0x01a0a209,0xa3515697},{0x02c1ec82,0xa9bb641d},{0x016007e1,0x9b59fead},{0x0381054f,0x30306000},
+{0x01e00b47,0xd2d3976e},{0x03a1e14f,0x16a9fbd9},{0x0220a9d4,0x42bc73ad},{0x024188e7,0x0c0c56f6},
+{0x01c0a125,0x7c9823e3},{0x01800b0f,0x5cee075c},{0x02a1ee01,0xdd6c6c18},{0x02a1d6c1,0xcfe4cdb8},
+{0x02418857,0xf26b6611},{0x0381d48e,0xb92005f0},{0x0360024d,0xb02e3526},{0x0361e850,0x68a018fd},
+{0x03a1d5a0,0x4d7ba800},{0x03a1230f,0x6736e366},{0x028104b1,0x74f049d8},{0x03e1206b,0x638675a8},
+{0x0160a621,0x5fc88070},{0x026124d6,0x14adcfd5},{0x03202ed0,0x640dcfee},{0x038004b4,0x88c623be},
+{0x0201223f,0xcf2137bd},{0x02402b27,0x0fb26637},{0x02e1041e,0x93225575},{0x02411942,0x5de3e43b},
+{0x0280a817,0xbcae2f5b},{0x04a02dff,0x27c8ce76},{0x03e18b1b,0xffd2186f},{0x0260ff1d,0x492c7998},
+{0x02418acb,0xd9193643},{0x048033e8,0xa1b03c37},{0x02e118cb,0x8c7b7b63},{0x0180214e,0xe662f764},
+{0x03a0027e,0x46f9800b},{0x0381200c,0x03faf2aa},{0x0381232c,0x4cce005d},{0x01c16f1b,0x825cd4f4},
+{0x01e106cc,0xadbaa6a9},{0x026110e5,0x9876e872},{0x04e0fbdd,0x8fb95d21},{0x0260246a,0x9bb5dd9b},
+{0x01c022ce,0x119599f0},{0x04201ace,0xc7939fd2},{0x02e14469,0x208f06e3},{0x01e0a09c,0xdfafcebc},
+{0x0421d23f,0xc368dca6},{0x03a1d5a5,0x547bb305},{0x01401ffe,0x9343d557},{0x03a120c8,0x56fe9f0e},
+{0x01e11a7b,0xf831b053},{0x0520fc61,0x100013ae},{0x0201103a,0x26b5be79},{0x03200f9a,0xa7cb2204},
+{0x04210147,0x432332c0},{0x01e0a2d4,0x3ca90727},{0x02c132d5,0x4a47aaf2},{0x030120b1,0xeabe4dc1},
+{0x01a11735,0x832e9369},{0x0121f43c,0xefb6f2f2},{0x02804dde,0xd682456c},{0x02003056,0xa0402aa3},
+{0x02c16f32,0x90edccff},{0x028e019e,0x0663641a},{0x0380fe2b,0x840bc1b8},{0x03e18ba4,0x0ee85389},
+{0x0240248e,0xf7cb3d2e},{0x02c02c85,0xa257f573},{0x02601359,0xc4e35f29},{0x01e01728,0xa6875df8},
+{0x02c02b12,0x2acc7e17},{0x02c00887,0xdc610f25},{0x01a16f14,0x94315112},{0x01e1128c,0x616cc946},
+{0x01c11068,0x60374f13},{0x02e1690c,0x993c0db4},{0x04a03358,0x44259d63},{0x02a032b7,0x3ad6b834},
+{0x01c0a08b,0x1e9d2bea},{0x03a0024c,0x2a22453b},{0x02e01b2a,0xe3dd44e4},{0x01a0a1d3,0x45958da6},
+{0x02a0ab9f,0x4129a45c},{0x01e10717,0x846caae1},{0x03c02998,0xb2b579a9},{0x0221032d,0x50885418},
+{0x03a1ed21,0x7ac1f917},{0x03216b77,0x44a2deef},{0x01e10660,0xb8302d73},{0x03e01c98,0x596ad5ee},
+{0x03010a84,0x8411e5ed},{0x03612435,0x15a31091},{0x02c10448,0xb5075ba8},{0x0201122d,0x5dfb22e4},
+{0x03400d77,0x694c523b},{0x028021d7,0xd4fc154d},{0x0440fdf8,0x1d6d7867},{0x02c01db2,0xcc1183ea},
+{0x02412217,0x6d3a6c0d},{0x0401d9f6,0xb95d432f},{0x01c16f54,0xb8f31ec4},{0x0501f970,0x7ee999bc},
+{0x0141f5fc,0xece8601e},{0x02418ab2,0xc297acf9},{0x01c0aabc,0x3a1a1d58},{0x01a0331f,0x67e19ccc},
+{0x0320a9cd,0xeb29fb4e},{0x02c13383,0x2ac0652b},{0x01c1f1ad,0xe0132780},{0x01c017e9,0x1fa2d1e7},
+{0x0320a6f0,0x373a5826},{0x04201de2,0x90326ea6},{0x01e0a5f6,0x46fc7b2c},{0x03e1d57d,0x77f51927},
+{0x02c00d7d,0x1f3e0d13},{0x03202487,0x80b70061},{0x04a0a68a,0x03eb6889},{0x02418a4b,0x3f477212},
+{0x0261e940,0x9dbc516b},{0x030025e8,0x0885b3d8},{0x03402dfa,0x4496c906},{0x024188c8,0x1b132a58},
+{0x02202d4e,0x1c0a9dae},{0x0260aa9e,0xf7f44b7e},{0x02c1308d,0xa9289746},{0x032124ba,0x4d95329c},
+{0x03400115,0xbb4dc8c7},{0x03e02bbb,0x9f948ddb},{0x02011830,0x078a6986},{0x01c0ff1a,0xee07b21b},
+{0x02011069,0xe74e0ba9},{0x01e0310e,0x7ef9f7b9},{0x00c1fa9f,0x714851dd},{0x01c02383,0x395c70af},
+{0x022032f3,0x532a8c0b},{0x0300ab51,0xad751aa0},{0x03410554,0x51f1f483},{0x02602037,0x3932cc92},
+{0x0540259b,0xf0929466},{0x028104bc,0x70d6aba6},{0x01e009a8,0xc33915ac},{0x02210819,0xc5d1b914},
+{0x02011111,0x403c318a},{0x038015be,0x0db817e1},{0x02e13237,0x69723e3a},{0x0381d6f8,0xf2db07ef},
+{0x03e18c3e,0x669d9163},{0x0340fedb,0x9ae080dd},{0x03c10b7b,0xd3077956},{0x0361e127,0x40e708ae},
+{0x02e145ed,0xebf992fc},{0x02e11fe4,0x2465e521},{0x048032c0,0xfef7ff3b},{0x0520ab59,0x5411ccaa},
+{0x034015ef,0x07509f78},{0x04000209,0xe178ffbf},{0x00e02003,0xc3b33a13},{0x02c021a2,0x1f89beaa},
+{0x03802b64,0x073c0f26},{0x02800de6,0x8a8d466d},{0x03c1d558,0xe1255280},{0x01e0a855,0x68314ad8},
+{0x02a0149e,0xd76c8d64},{0x02802102,0x47da82b5},{0x0340ff4f,0x06e0dd42},{0x0401d09f,0xb06639ec},
+{0x01c016aa,0x296a104d},{0x03a0fa87,0x234cb032},{0x02e10d1a,0xbb3e3523},{0x04c0ab68,0x647b2d7d},
+{0x02201b02,0x13482f68},{0x0360fb74,0xf1eb96bf},{0x04e1d64d,0x15e1c6da},{0x01e16ac9,0x97c335da},
+{0x02c0031e,0x49575a11},{0x02e10c3a,0x46570e6e},{0x024188c0,0x12fe483a},{0x0401cf66,0x51c8883c},
+{0x0460a73b,0xea155da0},{0x02410adb,0xbe96ee4b},{0x0281da89,0xe6bed9b9},{0x02200a33,0xb10edc7a},
+{0x02418ae3,0x610d4068},{0x02201165,0xd1965810},{0x02e10412,0x1bebf19d},{0x01e0a92f,0x2dfeb5a2},
+{0x03c1d244,0x72bde4a7},{0x02c1d86c,0xe8627383},{0x032002ba,0x39df7888},{0x02401266,0xdef9f883},
+{0x0320ff3e,0x02add020},{0x03201b61,0x09690162},{0x01a0a3f3,0xb9f2a666},{0x02418ad9,0x6b1e9947},
+{0x01c00b66,0x701382a0},{0x03201894,0xf165dcd7},{0x01403337,0xa3444237},{0x0220182a,0x70394e2e},
+{0x02e0057f,0xbc258553},{0x0340fed7,0xbb2fb907},{0x04000883,0xae73cc84},{0x02011498,0x3c035fec},
+{0x02e02fcb,0x62745101},{0x02c1f093,0x917d962f},{0x04e00da5,0x15decb7e},{0x03412509,0x55c2a99f},
+{0x03e18b18,0x19d2415d},{0x02011a62,0xd652e2e9},{0x0361f7ce,0xfb6a2b03},{0x02011a7f,0xe924e2b9},
+{0x022e005c,0xde56fa92},{0x0240267e,0xaaf5f168},{0x0360323b,0xf01eb295},{0x00e02223,0x42ea8799},
+{0x02e14508,0x87a4e231},{0x03e18c3f,0x679d92f6},{0x02c13102,0xdb16ad0f},{0x0180a4f6,0x37c2afb7},
+{0x02200a1f,0x88883a5a},{0x02e14490,0x120d8a31},{0x026012fd,0x9e29229f},{0x0280039e,0xa8beb2b6},
+{0x02c13193,0x0b2ea765},{0x03410cc8,0x06026bdb},{0x01e0079c,0xbda00b62},{0x02201031,0x9e83061f},
+{0x01c0a022,0xf3f662d5},{0x0361d504,0x02bc3b63},{0x0441d8d0,0x5bddf544},{0x0381d1a1,0xa5f98c6e},
+{0x028e007a,0x8bc249e8},{0x02c13155,0xc0c3a210},{0x022032e0,0x5723d692},{0x0361d507,0x05bc401c},
+{0x01c0a15f,0x3b61e99c},{0x02a10017,0xc42cea52},{0x01c0a056,0xb6ff00d6},{0x02402d5e,0x26a7b29c},
+{0x0261f5b3,0xceccb84b},{0x0261b044,0xbfeac61e},{0x01e01024,0x4454ae4e},{0x01e16f55,0xabb90b5f},
+{0x03c120dc,0x09253a52},{0x03a1d689,0xca58693e},{0x0201bc17,0x84de9aa5},{0x01e1f0e0,0xf687c74f},
+{0x01e03317,0x3423978e},{0x02a02a2a,0x80c5399a},{0x03e18b43,0x96c63a31},{0x02201b99,0x80e742c1},
+{0x03800102,0xf32c1bb0},{0x03402091,0x14cc05f0},{0x02a0157e,0x2ab6e980},{0x02a169ce,0x4304080c},
+{0x01e16ae7,0xe660f37f},{0x0261b0dd,0x039cbf44},{0x0280aa89,0x296fec3b},{0x024009be,0x5551e939},
+{0x03e02673,0xd3ce69ba},{0x03e0011d,0xed8b413f},{0x010033bb,0x6fa8229d},{0x0140221a,0xf7b31b92},
+{0x0301203a,0xc2a9f0b7},{0x0441d18b,0x4f90e90d},{0x024119a4,0xa00bd170},{0x01e005ab,0xb2eedfaa},
+{0x02010612,0xb12dcb97},{0x0280337d,0x8cf26837},{0x0281d2ee,0x15accc5d},{0x02e00417,0x8c2c3ec1},
+{0x02a023aa,0xcc10568f},{0x03e018aa,0xf09c7e3b},{0x028002c9,0x834aa73e},{0x0201224f,0x500ce818},
+{0x01a0a3fc,0x5e8869c3},{0x01e11216,0x1d428d92},{0x0100339d,0x79a17696},{0x02610869,0xac497d9c},
+{0x0600fbeb,0x0f06f2da},{0x026029df,0xd02926dd},{0x03c024a1,0xfe012bbe},{0x02c132e9,0x5a4346f4},
+{0x01a0aab5,0x3b3b2a5d},{0x0621d8ad,0x46a5b449},{0x03a004c8,0xaf8665db},{0x0460022d,0x385c2fac},
+{0x02418a67,0x53ac18f4},{0x01e1118e,0xd91a5521},{0x0381da5a,0xb8224cf5},{0x02a0199a,0x81431b2c},
+{0x01e0a05d,0xdf49704b},{0x028112e2,0xa11b49a9},{0x01c01a4b,0xcafe994e},{0x06a0fe3b,0xfa08fc09},
+{0x03a1daae,0xc89fe0dd},{0x036009f4,0xba0e2287},{0x02c131a7,0x58585b55},{0x02401202,0xf8e0898b},
+{0x04201e74,0x277fd095},{0x03002146,0xa2103e55},{0x03210854,0xe7ad60a4},{0x0320a688,0x83197a87},
+{0x0320188a,0x071df73c},{0x04a0fc57,0x50b6187d},{0x02210052,0x9fcf4218},{0x00a1f687,0x89d3c54a},
+{0x01c102bd,0xb4cfebd6},{0x038018cd,0xcc78d870},{0x03801126,0x69f3cda2},{0x0240216b,0x63957dbd},
+{0x02a00e0a,0x44608f27},{0x01816a49,0xf58e2ef1},{0x02a10012,0x37e7343d},{0x02e02879,0xa9a08faf},
+{0x02e1451e,0x8db3f62d},{0x0201bc10,0x81c4fe06},{0x02e1cf21,0x7e90743d},{0x02200a36,0xc2ddb57f},
+{0x02602b0b,0xec39c7c9},{0x01c0a3b7,0x5f148d25},{0x01e10692,0x483a0a7f},{0x02e145a8,0x7736ea11},
+{0x01a1f19f,0xe6920aa6},{0x01e022c4,0xe72274e7},{0x03c0a719,0xb33d3bd8},{0x01a0a274,0x9e9ffe48},
+{0x0221fb2c,0x162a40e3},{0x01c01c15,0x581a0c46},{0x024122b9,0xed870c86},{0x01e114a3,0x9f6de807},
+{0x01c0a922,0xea3d870d},{0x0120200a,0x22ae1ce9},{0x02e01bfc,0xfed1a2cf},{0x030120d8,0xff21a965},
+{0x02600819,0x8241e294},{0x0241d11e,0xa5ffbf4e},{0x01a1f45a,0xf9b38e2a},{0x0380150f,0x7581f923},
+{0x0260314c,0x3a16f77d},{0x02c13128,0x5d0f2af0},{0x020122ac,0x97fc8f9a},{0x03011371,0xf948d81a},
+{0x02a1f651,0x021186a7},{0x01e11eea,0x0ac2ab72},{0x02602b00,0xc3eb237f},{0x030100c7,0xb29bf4e5},
+{0x02202d62,0x100a8aca},{0x03801d10,0x97a7b12d},{0x01a0196d,0x0dca193c},{0x0321e7f8,0x61c49aa2},
+{0x04a02770,0xefeef15e},{0x03e00db0,0x3061f582},{0x01c1101a,0x966b723b},{0x01e01c21,0x2ce4f7ea},
+{0x0241b010,0xc9f4c8b3},{0x02e10429,0xa197c0d9},{0x02418928,0x21247ceb},{0x02410380,0xb86e8115},
+{0x02e10416,0xa379ec45},{0x03404dfe,0x59fd1a8f},{0x02611c30,0xfd7922cd},{0x02a01098,0xcdefdf10},
+{0x02c032a5,0x9ded2cb5},{0x028110d6,0xaee24677},{0x02602d83,0x4fd6f531},{0x024189d0,0x2cc5ef14},
+{0x0240a8fe,0x2489573d},{0x0061f989,0xe9efca05},{0x0180a17f,0xaa4efe02},{0x0480fcb6,0xbb49e8f7},
+{0x038014cc,0x05a0b4b6},{0x05a0fd8f,0xdc898e74},{0x0240aac2,0xb76a1177},{0x034011c5,0x68d76c7d},
+{0x04001cbd,0x1f1fa3ef},{0x0481d923,0x87069c46},{0x0200100f,0xccd7bacf},{0x0241105c,0x59392266},
+{0x01a00b93,0x4f34f1ca},{0x04402b9f,0xbc94cd39},{0x02410a24,0xe1db2a13},{0x028e0078,0x8dc24d0e},
+{0x01c11442,0x9a2b1f37},{0x00e02613,0xed239ce1},{0x04a1014b,0xc07418ff},{0x01e1111d,0x5bbdc170},
+{0x0261f55f,0x5f9ee928},{0x02003081,0x4429d380},{0x03611fc3,0xca5e3a19},{0x0361d69d,0x3c06eaa9},
+{0x02e1442a,0x186ea6a0},{0x01a00b8a,0x58f45a32},{0x024011a6,0xbad3ab57},{0x01a0a3df,0xf438b33c},
+{0x02003064,0xa862c97d},{0x02811d20,0x097a1e5f},{0x0200263d,0x3098b9ea},{0x03a10f13,0x3b71f2f0},
+{0x01a0a1d9,0x8db41412},{0x03800146,0x142a8314},{0x02400732,0xc7960984},{0x0401d53e,0x46897a75},
+{0x0280ab13,0x9fc0fca0},{0x02e13365,0x126ee359},{0x03a02b89,0xb56b44c4},{0x04810cad,0xea2b00b4},
+{0x02e144d2,0x2023668a},{0x01e0a3b1,0xe59e3390},{0x0141f14e,0xcdf38f40},{0x01a03354,0xc30814ee},
+{0x040004e2,0x38b7c595},{0x02016f5f,0x88ab139f},{0x03c111cf,0xa968909a},{0x03e18bac,0x9fe7a4cc},
+{0x02e14615,0x760127ff},{0x044027ea,0xbaf1e360},{0x01c16a7e,0xe4c5f547},{0x03012534,0xccc7c5b4},
+{0x03c1f22d,0x109c8c4c},{0x01c00e53,0x07cc50cc},{0x03201541,0x97f24a9c},{0x0461cf1d,0x5b4ae9fe},
+{0x02c1d42f,0xeb98024d},{0x01602033,0x920f2f87},{0x02e1340b,0xa2de4e21},{0x02c131f8,0xf87a69c2},
+{0x02401219,0x18ed87de},{0x01e11223,0xd2f2373c},{0x03e18ca6,0x068ce6f4},{0x02e11a12,0x482f7c2f},
+{0x01a02248,0x2cb11674},{0x036025db,0x9edfa7da},{0x0400201f,0x5b78d1cc},{0x01811626,0x740e48f4},
+{0x03801664,0x0434d28d},{0x01c0a07b,0xcf75a01d},{0x01800040,0xf0dacf56},{0x01a0a2da,0xe8777a8e},
+{0x01c0a1fe,0x57957b2e},{0x03c1d477,0xe222e852},{0x02e1342b,0x2ad6a164},{0x02200068,0x19574e60},
+{0x00e02235,0xc1549d7b},{0x02c13180,0xb632e4c7},{0x02a102e8,0x16685c66},{0x02e13428,0x21d69339},
+{0x034118b0,0xa24bf5d3},{0x028119b8,0x003ebe5c},{0x02010604,0x1a32ee10},{0x0201fb15,0x2d2593b4},
+{0x0481f4f2,0x57e307e9},{0x0401d54c,0x34895e1f},{0x03a027c8,0xa5c646cf},{0x028e01b9,0x04d7fba9},
+{0x0701d983,0xfb2b2acf},{0x03000f92,0x0ea174bd},{0x01e00c3c,0x21a14639},{0x032023a9,0x07457123},
+{0x0521243e,0x356e5533},{0x0261f002,0x5c4e33c4},{0x02e14608,0x7cfef46d},{0x0201062b,0x21262d22},
+{0x02011a9a,0xfb93f6c7},{0x020122a9,0x79fc6060},{0x02211130,0x0ee1b7a0},{0x04c0fc48,0x5e6be89d},
+{0x04e02b4b,0x30d43525},{0x0181f382,0x4bc041f8},{0x02200a1d,0x96d2596c},{0x03410a76,0xab0fe0e2},
+{0x02200f28,0x2f8182fe},{0x01e1105b,0xdb2b5542},{0x03801f77,0x3fdb1104},{0x0380a8bb,0x7bc01616},
+{0x0400d7e4,0x0b3840ff},{0x03a0a69a,0xbc6d5262},{0x02c10c00,0x4792f4c8},{0x03201452,0x17230ad2},
+{0x0401ed26,0x2cafe8b8},{0x024188c6,0x08fe387c},{0x01a10930,0xb0bf83b5},{0x016007df,0x3f5d3f70},
+{0x02c00594,0x40c26e34},{0x0200a869,0xfe7e6f78},{0x026e0116,0x189726d3},{0x028e0070,0x85c24076},
+{0x02c1335f,0xe0c0f7a4},{0x02e130af,0x2b7b76da},{0x02411a97,0x7c86d2ad},{0x02e133d3,0x97fe73f0},
+{0x0401e880,0xc5c64bf5},{0x03010f46,0xf4bb914a},{0x0561f82e,0x1149be19},{0x01e16ab6,0xbfab856f},
+{0x0320232a,0x42553006},{0x03c01f7c,0x9cb5e548},{0x01c1f105,0xad1248f5},{0x00a1f9d1,0x4842fdaf},
+{0x02201c58,0xe6841c3c},{0x0401f111,0x28301acf},{0x03202b97,0x08d2f832},{0x02a0145f,0xc49a07ab},
+{0x0401ee7b,0x921f1234},{0x01c0212c,0xce875dd8},{0x0420295a,0xf61b2fbf},{0x02a16a0f,0xe72a588e},
+{0x0521d855,0xcff16a7d},{0x030144f9,0x9abb3efc},{0x0180210a,0x166f36ba},{0x01c01c1d,0x4c20b527},
+{0x018e003b,0x1a4cd534},{0x03a01f31,0x45e751c5},{0x02601287,0x673030a4},{0x0280a8d3,0xbd0bfec4},
+{0x03e18c77,0x8893398d},{0x0620fc98,0x52320133},{0x0461d89c,0x6fa72697},{0x02e04dea,0x01e2af3d},
+{0x02e16818,0x536e407c},{0x0321d342,0x24855fdc},{0x0521d7a0,0x8e5fa5db},{0x0381687b,0x4722dfd8},
+{0x01e11feb,0x7c994393},{0x040124ad,0xd8a92c33},{0x02e14549,0x8495d2ee},{0x02a00942,0xe164ad33},
+{0x0440026d,0xdbde66a4},{0x0340feb6,0x18ad2730},{0x022032ee,0x0b0d989f},{0x03e1f599,0x2b26899b},
+{0x02c0abaf,0xaf4aca0f},{0x026112e5,0x9f126a36},{0x0261e942,0xb17b4693},{0x01e1071c,0x7a6c9b23},
+{0x028e0175,0x776d1059},{0x02a00254,0xd12a3fad},{0x01e00636,0x8c984d22},{0x0441df18,0x13652c91},
+{0x0320feac,0x6842c6a6},{0x0240a733,0xd98711fe},{0x02c131b3,0xd1f79624},{0x028e0178,0x746d0ba0},
+{0x02001b87,0x1a5cab74},{0x030169b9,0x33fbcaad},{0x02010363,0x8a343baf},{0x01a02704,0x4df456dd},
+{0x02602d8c,0xba439230},{0x01c16f59,0xaef30f06},{0x01e16f79,0xb3b917f7},{0x0300188b,0x3f80cbd2},
+{0x024008d7,0x378094bc},{0x0321f0c9,0x0cc7e1a3},{0x02e1445d,0x9c8bf880},{0x03c1d47a,0xe122e6bf},
+{0x02a1698c,0xf9bda791},{0x01a11204,0x9f415746},{0x01e1111a,0x68ed59ec},{0x0301f7be,0x6765971f},
+{0x01e01689,0x0ef10275},{0x04e01ea5,0x129a227e},{0x01e0aa32,0xf9eb04e6},{0x02c13166,0x41be5cf5},
+{0x03c1f23a,0xf2817dc3},{0x04c120a4,0x8a1417e1},{0x02a01a58,0x48f25ac6},{0x0520fc95,0x1b327ce0},
+{0x0681fa1d,0x2904be3f},{0x026100b3,0x554cb015},{0x02600e41,0x06c640cd},{0x042021c4,0xdc5cd926},
+{0x03203178,0x43be9f5f},{0x02002104,0x2c33c7e8},{0x01c0a485,0x092f966b},{0x03a004c6,0xcaa807f8},
+{0x036107b8,0x9502ddb0},{0x02010476,0x4a30f709},{0x0240061f,0x5811ecb4},{0x02400d18,0x018e46a6},
+{0x0341cf46,0xe423dafd},{0x026169f9,0x4f4d3501},{0x03c10173,0x90786421},{0x0521d074,0xc987ed91},
+{0x03801b43,0xaa367821},{0x01c0064b,0xec6fae2e},{0x02a0014a,0xfd806201},{0x02418947,0x31812bea},
+{0x03014575,0xe0fd461e},{0x02601931,0xb992f117},{0x0321e130,0x03b0849f},{0x03800114,0xf03e7c2c},
+{0x01e0a67f,0x60ab883b},{0x0361d68b,0x2e06d49f},{0x03e124d4,0x573583dd},{0x02a0aa6c,0xca73e9e6},
+{0x01a0a2c5,0xc6468edd},{0x02011119,0x4e59dec6},{0x02e130bc,0x1270c223},{0x02a0284a,0xaaa8a083},
+{0x02210829,0xb5d9eea9},{0x01e01a36,0xddbe8b6a},{0x03210cd6,0x569a7113},{0x02c1313e,0x681e46cb},
+{0x040006a2,0x6bec305b},{0x01e1070d,0xf2650946},{0x01c1f918,0xabfcf11a},{0x02e00536,0x6aafe187},
+{0x044004a3,0x59b8fbb5},{0x0381d1a0,0xa6f98e01},{0x0460fd35,0x6a1ed42a},{0x02c13006,0x881d2c2e},
+{0x03a1daac,0xc29fd76b},{0x02c132d4,0x4547a313},{0x04402a14,0x133effa8},{0x02211904,0xe8dcf181},
+{0x02e118c4,0x40768691},{0x03401b68,0x52a0504d},{0x0420fd1c,0x9b558a91},{0x01e11296,0x95670af4},
+{0x02c00453,0x7f7b6d85},{0x02012146,0x9184a06b},{0x02c168fc,0x31db5c43},{0x01a016a3,0xe06467f9},
+{0x04c0fd46,0x68c5a9ad},{0x04a032cb,0x49eb57d0},{0x02a12101,0x1abe0941},{0x03200257,0x1a70fedb},
+{0x02c132c9,0x6b98825f},{0x01e1f6c2,0x749def04},{0x02a1f0d1,0x12358778},{0x01e01707,0x241ed753},
+{0x02010621,0xa52b7a1c},{0x0261d1bb,0x5ebb9c54},{0x01c01702,0x867285c3},{0x01e1f5fd,0xa8e7c3d7},
+{0x02e0247b,0x3db1afd5},{0x028001c7,0x8a4e5b2d},{0x03010d38,0xdd13c4e3},{0x028112e8,0x8d07a275},
+{0x0361e85d,0x186ad8e7},{0x01a0a0f1,0xae13bfd8},{0x02000688,0x383e818c},{0x04010a57,0xe975c877},
+{0x03200f79,0xd0fdebe7},{0x0401211c,0xdc95db16},{0x02601215,0xf375ae87},{0x020013a8,0x8bf38639},
+{0x024025d9,0x74148f20},{0x03800504,0xf0b6090f},{0x0321bc88,0x75fead8b},{0x02418809,0xf47cb258},
+{0x0161f3a1,0x634469a7},{0x02e000a1,0xf29c2a4c},{0x02010746,0x7b7ebf87},{0x02c01c3b,0x1de698a8},
+{0x026019e1,0x476f414f},{0x04401d8f,0x43a2f6d5},{0x00c1f9e4,0x40353857},{0x01a0a4eb,0xc4120300},
+{0x02600045,0x7515337a},{0x052026de,0x5f706522},{0x04802a50,0xa042c51c},{0x02802b31,0x8c9b8137},
+{0x02c018e7,0xe3b5a2ea},{0x02200af1,0xbf4fc8d6},{0x0301d7cf,0x69426955},{0x0480fca4,0x12fdc715},
+{0x02411fd7,0x44530358},{0x02e14466,0x238f0b9c},{0x01a0a13f,0x0fa6104e},{0x01e112a4,0x49621622},
+{0x02401276,0x1f25e9e1},{0x02418a08,0xac2e85c3},{0x020121b2,0xb07e9112},{0x0401e00e,0x169589eb},
+{0x01203391,0xee96fe15},{0x01616a53,0x0729eaf0},{0x03800229,0x2d165087},{0x0181e295,0x5aa3b835},
+{0x01a0178c,0x2af811db},{0x02802bb1,0x07a0d918},{0x02c10a3a,0x9ad3dea9},{0x0220a94a,0x4e780014},
+{0x0581df19,0xc369633e},{0x02a01670,0x01aa9b0d},{0x02a01bfe,0xa80fda30},{0x02012016,0x1e9841bf},
+{0x0441cf07,0xa4b4d8ae},{0x02a022b1,0x1e46161e},{0x02e13286,0x9cfc9a62},{0x03c01e27,0xdab1ade9},
+{0x03401149,0x3554d4b7},{0x02601226,0x49f73f6a},{0x0201fb25,0x3025986d},{0x0321f01f,0xbe7c741c},
+{0x01a11614,0x4af4f160},{0x024188a3,0xfbd9532c},{0x03016e77,0xa73d33e9},{0x022112bc,0x0460c171},
+{0x03410a7e,0x9df48656},{0x04602b9e,0xef65672b},{0x03e18c0f,0x59a438b1},{0x0280097e,0x519b4ccc},
+{0x0340fee4,0xdf87afcf},{0x05c1d7bb,0x7b4f73f8},{0x042032c6,0x3db0b219},{0x030016d0,0x0978fae4},
+{0x02e028dc,0xda78cb31},{0x03210c25,0xcb6efadc},{0x01c1f44b,0xd65ab12b},{0x028e0076,0x87c2439c},
+{0x02a1ee0b,0xe0439e69},{0x016007d6,0x8b623442},{0x0281211d,0x182dee6f},{0x032118b4,0xcddb732b},
+{0x01a116c2,0x69d9f6f7},{0x02801aa1,0x5173d382},{0x05e0ab58,0x5d87d104},{0x02e14580,0x6b416489},
+{0x0361d5d3,0xdf9cb248},{0x038122ce,0x39bedc31},{0x032121d6,0x4465af34},{0x02a1f580,0x88048172},
+{0x024119a0,0x940bbe8c},{0x0440ab5a,0x036d5d39},{0x016007d9,0x3b753e0a},{0x0441245c,0x4fc24c8c},
+{0x032002ab,0x9e990c63},{0x04001d70,0xb84e2c1b},{0x0381f720,0x6631109a},{0x02001824,0x4a7e7c4a},
+{0x02011159,0xeeaf1330},{0x036027ff,0x35b37aea},{0x0380ff2e,0x4becd2b8},{0x03a01e89,0x7ca194f9},
+{0x02e0247a,0xa865737f},{0x042008b7,0x41e542f2},{0x020103a3,0x62cc639f},{0x03e027ca,0x7b2dca38},
+{0x03016af1,0xdd557b5c},{0x01c0a59a,0xc4cbe513},{0x05a1d83b,0xefabc235},{0x03400e11,0x63d803f2},
+{0x02c01fed,0x910c4cdb},{0x02e0201e,0x903d7ae4},{0x01c01800,0x91cc4474},{0x01c00eae,0x24efcb28},
+{0x01c0a0e6,0x24b2bb2b},{0x0341d4b0,0xc57c8739},{0x02c11488,0x92936f25},{0x04801b6d,0xcb3e575a},
+{0x0180a193,0x9e4eeb1e},{0x032009c4,0xf70c5334},{0x0321687f,0xdbc4d809},{0x0561d7be,0xfb2db04b},
+{0x0520fdac,0xaa2908b9},{0x03c0259a,0xba58a3c6},{0x0121f6e5,0xcf3af630},{0x02c1da78,0xcf20f6d2},
+{0x03e00df2,0xc7fcb7cc},{0x03c0ff6c,0xe706c4b3},{0x0141f356,0xf24db919},{0x0240079b,0x149b649b},
+{0x01202125,0x3cc10a9c},{0x022114d7,0x3b75da42},{0x02401772,0x015d4baf},{0x0141f9f6,0x386b1f1b},
+{0x0400a64a,0xe8503d21},{0x01e027c7,0x3faeb01b},{0x03c01c7f,0xd6111246},{0x0300289f,0x08756a59},
+{0x0360233f,0x31839a07},{0x01a0a1da,0xae12d959},{0x02e1445c,0xa38c0385},{0x02811176,0x451f26e3},
+{0x01e10b10,0xe93701a1},{0x0280ab74,0xb1eeea8b},{0x028169b4,0xb1fb50e5},{0x028e01a6,0x705bbc33},
+{0x034014eb,0x5a4744d0},{0x0321d201,0x5d73c954},{0x02003008,0x1a8de24d},{0x01e10767,0x79ff15ae},
+{0x02a0ab81,0xf535f8ab},{0x0060264c,0xba45587f},{0x01603329,0xb40dfe5e},{0x0201128b,0x937ecdb3},
+{0x05801ed8,0x708c66cb},{0x02e00420,0xbf46d287},{0x04602536,0x34b0b12b},{0x03a1056f,0x62c3cc91},
+{0x02e0288f,0x8592fffc},{0x01c0a169,0xa21dd704},{0x01a16f17,0x61a734f3},{0x02812f93,0xaafc44de},
+{0x00802a1d,0x74b902f9},{0x0340051f,0x5aa04108},{0x02000630,0x2266ac18},{0x0260aaa9,0xa472ac40},
+{0x03e18bdf,0xeadb4eea},{0x02802881,0x138dc641},{0x01e00f66,0x29a3198e},{0x03410c2e,0xdab48201},
+{0x03c01dcd,0x8d956a0f},{0x00a0003a,0xf3c31bdc},{0x02611c53,0x14e68765},{0x03e18ccb,0x4a8741d2},
+{0x02001764,0x40d93310},{0x03e01485,0xb39d6bad},{0x03e004c3,0x8344ee37},{0x0261b05f,0xbf20850a},
+{0x02402a6e,0x14bb8eb8},{0x02c1d13a,0x4a882738},{0x02c11d3a,0xd187edcb},{0x02210115,0xdbddea60},
+{0x03410531,0x84233730},{0x01e0a37e,0x742fff15},{0x03e18bda,0xe5db470b},{0x0241896e,0xa48adb4f},
+{0x0261b087,0x77f42151},{0x0340a784,0xd8e72e70},{0x02411c55,0x86017bb7},{0x04c01fb3,0x6c559e8c},
+{0x022122b7,0x33c065bc},{0x02e14592,0x753269bd},{0x03e1bc75,0x14c6428d},{0x0161f5e1,0xd08e6448},
+{0x01e11a5c,0x245d8235},{0x0260134b,0xd402e3d0},{0x022110be,0x755b797b},{0x034109cd,0xecd93365},
+{0x02802dc4,0x081d0634},{0x024011a4,0xcad50481},{0x02c1f08a,0xd6c97f74},{0x01e16a96,0x0e9d0f3e},
+{0x03e18b07,0x0acfeb29},{0x0261087c,0xf80cd415},{0x0200a98f,0x6a85c578},{0x03a1d099,0xc9dcb10d},
+{0x0280a738,0x7c5693e8},{0x0180a4e9,0x9ee21287},{0x04010a53,0xafb0d6d8},{0x02c130c6,0x3c32790b},
+{0x022115b2,0xd3fefc86},{0x0260121c,0xb914e911},{0x0360fedd,0x459c4a74},{0x01c1f42a,0x80baa9d6},
+{0x03c10f84,0x8431d3b1},{0x01c0064d,0x16defc36},{0x020103b3,0xbeb11df6},{0x01c0a154,0x3b6ae3f8},
+{0x038014f7,0x942ec101},{0x0460fca0,0x2ce4d866},{0x02c13072,0x9c96a317},{0x01c11722,0xda716647},
+{0x024189ba,0x1ac15590},{0x05201ffc,0xb114ceec},{0x028e0191,0x7f6050fe},{0x01c0064c,0x771564b6},
+{0x0301f04a,0xee371908},{0x04412529,0x02043a4c},{0x0220116c,0xd7aff968},{0x03603174,0x81a09ecd},
+{0x03c01f29,0x855c9bc7},{0x0321aff1,0x9f342d67},{0x042021f8,0x9c105a0b},{0x02418aa9,0x499ac015},
+{0x0221103b,0x201a6590},{0x02418945,0x238115e0},{0x02816a31,0xd3cda6db},{0x0721d9f0,0x115835a8},
+{0x02a0a9a1,0x9efa130a},{0x028e01d5,0x90d08948},{0x024106a9,0x8be6b5a6},{0x03000fb6,0xc682ee51},
+{0x01c0a3a5,0x0ea6717a},{0x02c04df7,0x4fbb5962},{0x020121b3,0xc47eb08e},{0x02411a52,0x4175c4e9},
+{0x01c00659,0x266a5613},{0x02203036,0x10058cc5},{0x03a0fa9b,0xe64a1194},{0x01a02e9c,0x100d333d},
+{0x0341e86e,0x499462b0},{0x0301d45e,0xb7ca1b63},{0x03402de4,0x7157865d},{0x020121b0,0xae7e8dec},
+{0x0280ab0d,0xd0c892a7},{0x02e14500,0x84a29ee1},{0x00a1f6d3,0xb695c49a},{0x026100a3,0xcc475b3c},
+{0x03e1218a,0x4b8721af},{0x02011444,0xbd7a2e22},{0x03012491,0xe1ea44d5},{0x024120f4,0x7ea2887e},
+{0x03c0233d,0x26f8551e},{0x03802f16,0x4cfc51ae},{0x0400a795,0xaa5f46da},{0x02c132f8,0x5d458a44},
+{0x032002a6,0x35ec0cf6},{0x02e16e71,0x57d440f9},{0x0381ee97,0xb1bf2b78},{0x0300a730,0x00b8bdea},
+{0x01c10e82,0x4c5a5a6e},{0x02c13142,0x3fc09866},{0x03a0153c,0x8cf5380e},{0x04802cee,0xd3e9aa22},
+{0x0201bc11,0x64cae08d},{0x02202598,0x590acb0e},{0x024023f9,0x58855aae},{0x020013d1,0x9c253c35},
+{0x022022be,0xa7423da0},{0x02202e1e,0x4806fd81},{0x0300a9de,0x9b7c853f},{0x03c1d844,0x9ddcaf00},
+{0x03e18bad,0x9ee7a339},{0x01e02331,0x47b3f0ad},{0x028169fa,0xace127ad},{0x0420fbe2,0x322c88ca},
+{0x03e1d583,0x71f50fb5},{0x02400c56,0xf7122ef6},{0x04802b15,0xac25f40b},{0x022023f8,0x6314a5e3},
+{0x01a1029c,0xfaee087f},{0x02a1e94b,0x3d425416},{0x02810a1b,0xb4960993},{0x03e0fe2f,0xc726eb7f},
+{0x02816a1c,0x35943d94},{0x01603302,0xdd01f419},{0x03002ec6,0x29b74366},{0x01c0a384,0x9b7586ba},
+{0x034016d8,0xfcf3269b},{0x03801fe4,0xe854c408},{0x01a00b8f,0x491b5072},{0x02e1217f,0x832277bc},
+{0x01800651,0x5c78adb8},{0x01e16f87,0xebd78533},{0x030120cc,0x707ffd66},{0x0280aa84,0x4f64e9ff},
+{0x030028db,0x4fa752b7},{0x01c102cf,0xc4f29748},{0x0300287b,0x44a502cf},{0x022002dd,0x9889ce7a},
+{0x028021e3,0xbd60826e},{0x01e1f108,0xb80892aa},{0x0320a72d,0xcf2d137d},{0x03201df6,0x23711c95},
+{0x0200a949,0x8edd5609},{0x01a102a9,0xc1f0b0cb},{0x02e14518,0x07b0e4a4},{0x03e01e1b,0xcfb46274},
+{0x03a1e107,0x78275fab},{0x0241f565,0xa6e6e937},{0x03c12420,0x212b6d13},{0x01c0a522,0xceea7eed},
+{0x03c1bc74,0x9a3d5f05},{0x02010f51,0xf1f8c6f7},{0x0260a895,0xaacc97cb},{0x02e00572,0x9a3b11cb},
+{0x02c1306f,0x159e1d57},{0x07a1d9e8,0x2b21dd39},{0x01c006ad,0xb95cda36},{0x0301f66a,0xef9fc8f2},
+{0x01811736,0x5882f8ef},{0x0361f7d2,0xca59f588},{0x04e1d02c,0x51a74db9},{0x03610f50,0x7f12ca47},
+{0x01616a51,0xe75916c5},{0x02200d08,0x322a87fa},{0x0120333f,0x26201fc3},{0x02c131d3,0x58fce7d7},
+{0x04e1d641,0x01e1a75e},{0x0081f98c,0x85a3a295},{0x03c0a972,0x97f5ff9c},{0x0381d163,0xa7f32f50},
+{0x02e131ea,0x92408be7},{0x0220a981,0x0bca035a},{0x02201173,0xcb964e9e},{0x03a12483,0x66ee8aa5},
+{0x03e18c80,0x7b90e67f},{0x02210303,0x844142d9},{0x030118cd,0xf4f592c3},{0x03403228,0x00bea598},
+{0x02816b00,0x4efff4dd},{0x020030ba,0x5cb20bde},{0x0180a49c,0xdb9437bd},{0x01e005e0,0x3c21fd57},
+{0x02e168a8,0x16a7882b},{0x0241897e,0x309034e1},{0x04c01e4f,0x7dbb9ee7},{0x02c130ad,0xae2addbc},
+{0x0540fe15,0x0ddb1170},{0x02e14642,0x69bf1ff7},{0x01c102ca,0xe4df41f0},{0x0580a65c,0x267c73b6},
+{0x03402ab8,0x90876a28},{0x0381ee2b,0x6608229b},{0x0301d12f,0xcc9bd016},{0x02201830,0x6c0e66db},
+{0x02a16970,0x08ca4432},{0x0440ab37,0xc900edd8},{0x04a1da04,0x053c4d6a},{0x05a0fe48,0xf7fce873},
+{0x0380ff3a,0x5fecf234},{0x03016e7e,0xb71cf96e},{0x03c00fc2,0xcc615a08},{0x03e18ccd,0x44873860},
+{0x0360fb86,0x71d9108f},{0x03c003ce,0xbd86be84},{0x03e18bf6,0x9ae0e128},{0x02211a55,0x1b980d98},
+{0x0461da71,0x711587f3},{0x01c1143e,0x65e8f6b7},{0x04c1d813,0x8822be60},{0x0541cf79,0xbd0a89cf},
+{0x0421e024,0x9e773242},{0x01c0a516,0xbfeee82a},{0x0541d927,0x095bf556},{0x0421d635,0x46b1e9b6},
+{0x01c0fe54,0x8b8e5a41},{0x02616b19,0xa6829ed6},{0x02002afe,0x72567e79},{0x05c0a744,0xdcf91616},
+{0x02ce0058,0x773c75cf},{0x028168ce,0xf7827ccf},{0x02c13335,0x4bb712b9},{0x0121f336,0x665887e0},
+{0x02c1315a,0x3abc1359},{0x02418af4,0x680f8a04},{0x0181f3de,0x469dc0e3},{0x02616a24,0xde188fbf},
+{0x03a02939,0x6ea80c1e},{0x04001ca7,0x3cbf0f7f},{0x0340a66e,0x3bb3baf6},{0x0381240a,0x6ef87a51},
+{0x02011333,0xbe3facb5},{0x01e0103a,0xa7cd906c},{0x02418a85,0xc5a47da5},{0x0240134a,0xfd032219},
+{0x01a1f4ac,0xa5015e4a},{0x01c00b18,0x335a4dad},{0x01a11811,0xd63e4e8d},{0x0301d453,0xacca0a12},
+{0x0240117a,0x4ead1d8d},{0x03600293,0xa8625e07},{0x04a0fcd2,0xaa189be1},{0x0621fa43,0xc9fe1fd3},
+{0x02c03135,0x1d3d6cce},{0x02c10119,0x09daf23d},{0x04011662,0x25c59947},{0x028018b2,0x67978661},
+{0x02202a4f,0x8b97ea4e},{0x03c02c6c,0x900bdbf7},{0x02a104f3,0x0418f86c},{0x03400d72,0x74852d19},
+{0x02c1328b,0x79ab7159},{0x04a01dad,0x6d59f8ba},{0x02c132a6,0x5759ffcc},{0x03e02779,0xf4abb742},
+{0x04001ca2,0xb2c802cc},{0x024188f9,0x8e1a9b26},{0x01e00bfa,0xa6888c5c},{0x03e18c20,0x7f9ff755},
+{0x02001970,0xac0a313c},{0x02e01bc4,0xaae14885},{0x01c00b16,0xcd903fc9},{0x0200a6be,0x59843dd6},
+{0x042003ca,0x16ec995d},{0x02802c9d,0xd61dba5b},{0x026100d3,0x09957680},{0x0360fb83,0x8eba9325},
+{0x02e14403,0xac7889f8},{0x01a116a8,0xe1e6e4e2},{0x01e01928,0xdf8bd229},{0x0441f15a,0xe44f4ffd},
+{0x032016f6,0x79b59cad},{0x0201f4e1,0xa3ddd3f5},{0x036118bb,0x14153fa9},{0x03002a03,0x225a09bb},
+{0x02410751,0xfa674152},{0x02a1d348,0xff82885c},{0x03e00226,0xf52cb296},{0x02a168b1,0xfeae1e15},
+{0x02a03063,0xf5392666},{0x02c131f4,0x047cbb3d},{0x02e145fa,0xeffbd7df},{0x01c0a42d,0xbec83696},
+{0x01a11620,0x877674fd},{0x02e16e61,0x67d45a29},{0x03401da3,0x15517957},{0x01e00784,0x2202dc6a},
+{0x01e01a2f,0xd9d81d04},{0x01816f16,0x3561c128},{0x02601102,0xa0900de5},{0x02a10024,0xcaa1d599},
+{0x02a0ab9e,0x4529aaa8},{0x03c1d4dd,0x24e95df3},{0x01c01c42,0xedd6903d},{0x02c1f5db,0x12ed8df1},
+{0x02401278,0x10fc85d0},{0x02200a6f,0xdfc929dc},{0x05001e4e,0x81ede298},{0x03810877,0x3a5c2742},
+{0x02c1328f,0xfdb77a18},{0x02a0185f,0x781f2fb8},{0x028e016c,0x726ac9e3},{0x02801b00,0xf843e6cf},
+{0x024112ca,0x4c3223d8},{0x0301d12a,0x5a7fc4e4},{0x05212443,0x7b31485a},{0x03810ca7,0x5b4a1f2a},
+{0x02e1f53b,0x38fcd4e6},{0x0361ee8b,0xe7db532c},{0x03612503,0xa0077dbb},{0x022005e6,0xfde4023d},
+{0x02e14585,0x7834ad0d},{0x02e13169,0xe6a6fa8a},{0x0361e871,0x9af0c4e5},{0x01c0a15c,0x3779e836},
+{0x02000f4c,0xe3a652b1},{0x0161160c,0x06b6f8d7},{0x0240ff15,0x5719badd},{0x0401d542,0x4a8980c1},
+{0x02a0056e,0xb3aa9355},{0x02a16941,0x222c7000},{0x028029cb,0x9eac1386},{0x02201b96,0xa8d0286a},
+{0x01c0a424,0xc6f3cfcc},{0x0201f61e,0x2c16bde0},{0x02610438,0x364e0b70},{0x02a01dfa,0x18e1e548},
+{0x022026c1,0x5549f4e3},{0x0381d878,0x9e543318},{0x02e13025,0x07aaf31c},{0x0561f810,0x4eebff0d},
+{0x02801379,0xc03bf327},{0x02e13127,0xe8062724},{0x024189f9,0x3133d450},{0x03401653,0xe36e7be0},
+{0x02602820,0xc91c5542},{0x04a02520,0x0d690c2d},{0x02c10101,0x95de1d6a},{0x02000e93,0x727bcfe6},
+{0x03202c51,0x03ab9306},{0x038014e7,0xcff1d48c},{0x01c0a456,0x528920ed},{0x02c105b6,0x7893a45c},
+{0x048121ba,0xb39bf56a},{0x02c0033e,0x2b766673},{0x020025aa,0x2d845a54},{0x02e1453a,0x06aea47a},
+{0x0381f4ea,0x2689c1bb},{0x020121ac,0x657e1b01},{0x052033f5,0x14047c78},{0x03e00da1,0xd31227bf},
+{0x0141faab,0x5685c1aa},{0x01802720,0x7f64f452},{0x030120bd,0x495e068c},{0x03e18c9c,0x048dec93},
+{0x0580fd6a,0x969fa797},{0x02612231,0xf007f5be},{0x0580fd9d,0x0a9af36c},{0x01a0a526,0xd32c98cc},
+{0x03a02253,0xdf9ce0dc},{0x01c1e2c2,0x9f642cee},{0x0480fd10,0x2257f01d},{0x01a10e68,0xe52e7b17},
+{0x030168a5,0x733a08ec},{0x02e103d5,0xe128e921},{0x02a1f653,0xd64a7b5d},{0x0261b01a,0x5c63c71d},
+{0x0621d9e6,0x71be9dab},{0x02418877,0x8fe33684},{0x01800e56,0x06d1ba14},{0x02e1ee1b,0x18a47192},
+{0x02011297,0xda247eea},{0x03a00232,0x318d9e30},{0x03010c37,0xecd09316},{0x02601a86,0x70b905f0},
+{0x04a01b7c,0xf2a718a8},{0x02e017af,0xac6bf537},{0x0320ff09,0xf13a573a},{0x05201ed0,0x24d77e99},
+{0x0421d5e3,0x4436b984},{0x030010ba,0x97ecc581},{0x03600181,0xea6711cc},{0x03a1d684,0xc558615f},
+{0x01c0a51e,0xa6ccebb2},{0x01c006c8,0x6724008f},{0x024189e2,0xa2deadbc},{0x0320a8c5,0xe29ba691},
+{0x03400fb9,0xd5a68e43},{0x020111a3,0xe058f6c6},{0x020013ba,0xf8033ac7},{0x02c1216b,0x941e921e},
+{0x04a0252d,0x14ab65be},{0x01c1e2ce,0x9b3ad89b},{0x0260a8d4,0xa15881b0},{0x03c0fe27,0xaf118381},
+{0x02c1d1c0,0x9efdc477},{0x0160260c,0x3261b2e7},{0x02203147,0xbe118b12},{0x02a0043c,0x1de2ecfd},
+{0x0280123c,0xb824481d},{0x038001e3,0xb8fb79bc},{0x024026d9,0xff2e2bab},{0x02402e49,0xf1f38aa4},
+{0x03e1d570,0x64f4fb3e},{0x03401617,0xab314df9},{0x02a0033c,0x50e4e179},{0x02c1327a,0x73a92950},
+{0x0561d797,0xe549c090},{0x02e01c24,0x0b61fe11},{0x03c1d475,0xf42304a8},{0x0141f44c,0xc775f4d3},
+{0x02610322,0xf66a616f},{0x0480fcd6,0x5efbd497},{0x04e1d93d,0x64ccb4e3},{0x02602aad,0x623b0971},
+{0x01c0a08a,0xd0802f0c},{0x02a16a13,0x0d17ff6b},{0x0421d638,0x45b1e823},{0x03c1f1ef,0xb924546d},
+{0x014031c0,0x6139799f},{0x03401612,0xef5689de},{0x0261f9d5,0x10111147},{0x01a0a051,0x0db96f10},
+{0x01c0a306,0x94862c66},{0x01a0a463,0x533482df},{0x02e003f4,0x4661e77f},{0x03216897,0x1af174fd},
+{0x01e1e2dd,0xbb45e05b},{0x0180a006,0x3e479839},{0x02c133a4,0x26bbe1b1},{0x0381f86c,0x5b9cb637},
+{0x00a1f40d,0x5a3c1bfb},{0x01e106fb,0x319f9ff8},{0x02211173,0x7290df4a},{0x01e0a089,0x8dca813c},
+{0x03a0faa2,0x25707b6c},{0x02c03031,0x8e878918},{0x01a0a025,0x2ff94d48},{0x02c1fa27,0xdbfe577f},
+{0x02c02cef,0x2f25c163},{0x02e12186,0xeda8c0f1},{0x03200901,0x37a8bf05},{0x0400029d,0x0a2d37e9},
+{0x0381d107,0x72e3748f},{0x01e1227a,0x8fdfa4d7},{0x0381078b,0x4666eecb},{0x0181162e,0x3802b18d},
+{0x022013e3,0xda08da03},{0x01c0a0ab,0x67e223bd},{0x020030c0,0x34e7e6e0},{0x02e1f316,0x35076b45},
+{0x0300206a,0xf93cc8d0},{0x03c0ffb4,0x391451d6},{0x02c130f2,0x1cd29a3a},{0x01e020b0,0x4425fda6},
+{0x01a0a0fd,0xf24a44de},{0x0261b06a,0x26ef8bf6},{0x02c13292,0x04b7851d},{0x01e1109d,0x2b43759e},
+{0x02a11fee,0x3495ebdc},{0x01c0200b,0xc4713ab5},{0x0261b11b,0xf51b9c0d},{0x02202d33,0x120a8df0},
+{0x02402f54,0x1b399fcc},{0x02e1215c,0x9912a955},{0x02602d34,0x114e28a0},{0x01800ed0,0x4cdd9d0e},
+{0x01a02abd,0xb57d3b56},{0x038014fd,0x8a2eb143},{0x024019e3,0xd906b665},{0x0360fb98,0xd8d19b72},
+{0x02e144c9,0x08fe717c},{0x0261b08d,0x79f42477},{0x03c1ed24,0xade1c255},{0x024106aa,0xa8fb9b74},
+{0x028e0071,0x86c24209},{0x01403352,0x86a9eaf2},{0x02a1fb84,0x03cdc0c8},{0x0240aa8a,0x749ae847},
+{0x0401d7de,0x8785f13b},{0x0121f367,0xeea5bf9f},{0x02c0070f,0x301e797d},{0x01c1213f,0x933611c7},
+{0x0141f94f,0x2bba8d33},{0x03e0319d,0xa84c356b},{0x03a0fa88,0x264cb4eb},{0x03402186,0x8574d7ff},
+{0x01c1148d,0x87714a51},{0x03a1d031,0x5560dcf4},{0x0301f264,0x21fb9938},{0x02001369,0x81c12377},
+{0x05602935,0x21540fb5},{0x02401bb0,0xb2dfbfe2},{0x03016881,0x210f7c37},{0x01e0268a,0xe34454a5},
+{0x02a02c83,0x3cda1198},{0x01e0a3a9,0xedf635f0},{0x01c1f44a,0xf5a250c6},{0x046006d3,0xb4d25b12},
+{0x03e18c59,0x06987d15},{0x0541d93e,0x416a4492},{0x01c10938,0x1660b81e},{0x03e02677,0x8e93e676},
+{0x02811da6,0x53b84d59},{0x0241885f,0xea691ae2},{0x03c002c6,0x07831178},{0x01e00ce7,0x7f4f81fc},
+{0x01c0a85f,0x8a59beb4},{0x00c0270f,0xf7550c84},{0x0381d4fb,0xdacfb6ce},{0x03210a78,0x1970c78b},
+{0x01a0a533,0x2ae7fed0},{0x028101ef,0xc1e9ae22},{0x0241086e,0x4099a4f5},{0x024106a6,0x589451f1},
+{0x04a033e2,0x51a937b5},{0x03a01e45,0xacc76caa},{0x0601d8ac,0xf84cf660},{0x02a1ee03,0x780ee52e},
+{0x03a12426,0xec1f7cf1},{0x02016f63,0xff54e89b},{0x04a02738,0x2d6237ad},{0x01811703,0x0ff78f4d},
+{0x02601212,0xe7759ba3},{0x0280aa97,0xc74bacc6},{0x02a02868,0x1519c88b},{0x05201eaa,0x24e7185d},
+{0x01e11ee4,0x5aafa1aa},{0x02c13149,0x4bc0ab4a},{0x0501cf69,0xba4bc88f},{0x0400ab5f,0x4134f3a8},
+{0x02001770,0x390ac344},{0x01a0a6e6,0x6947ec25},{0x0241894b,0x31836a81},{0x0340017e,0x22dc4865},
+{0x0300089f,0x28b589c0},{0x02e12245,0x2ab8dcd9},{0x05c1f81d,0x9d62a7e6},{0x0401238a,0xd179cfc6},
+{0x03c1ed1f,0xa6bd4129},{0x02000c3f,0xce477ab2},{0x02402f39,0xeadaed8c},{0x0240aa9c,0x14bf2200},
+{0x03601418,0xef248910},{0x01c0332b,0xc89e623b},{0x02a12fce,0x9a2195b1},{0x02a119bb,0x708ffb72},
+{0x02e14613,0x7c013171},{0x03400503,0x3152f288},{0x020110b7,0xc578a612},{0x04e1df13,0xca117828},
+{0x0381099a,0x99ed5107},{0x02601192,0x067b65e4},{0x04803237,0x11b3edf6},{0x01a0a1f3,0x721d0841},
+{0x02a10021,0x39488ed3},{0x0641fb42,0x38cd136d},{0x0280210d,0x4cda8a94},{0x03a12421,0x4e4d75b1},
+{0x03c1e147,0x85637e41},{0x02418865,0xf9e85a90},{0x04c0ab4a,0x2e101f30},{0x03a01e61,0xebcebd39},
+{0x0321f92e,0x0320b862},{0x01a00b28,0x87d13b84},{0x02a1100e,0x07636637},{0x02c1302d,0xf21345b0},
+{0x03212050,0xb4428d58},{0x02e00478,0xc61fce1c},{0x0341e7fc,0x66665e24},{0x0721d991,0x8cbdc0df},
+{0x02418838,0xeb873189},{0x06e01f9a,0x20c4ca3f},{0x028e018f,0x7d604dd8},{0x02e1322e,0xcb6eb5c8},
+{0x05602b8e,0x314e6d16},{0x02e02d0f,0x796e722f},{0x02c10424,0x85c08aac},{0x0221f7e7,0x7da9f73d},
+{0x02a16971,0xb3898cd2},{0x02a16920,0x80c75ead},{0x030115b4,0xd9fbf16e},{0x0220a99b,0x9f679283},
+{0x018025c6,0x8a6f2030},{0x01e03119,0x96fa1d81},{0x0381d19f,0xa3f98948},{0x02601222,0x43f735f8},
+{0x04201de3,0x7ced396f},{0x03a0012e,0x16b338dd},{0x05200284,0x5b916dc2},{0x0461d1e7,0xc3159254},
+{0x01c0a2bc,0xa429b188},{0x0321231e,0x01ab8cc3},{0x04a1d021,0x28131b5b},{0x02c02beb,0x51769d77},
+{0x04e1fa07,0x1e8071a7},{0x01e1070c,0xf16507b3},{0x0260107e,0x53953619},{0x03c02a8e,0x112f5d93},
+{0x01e104a6,0xd8ba503c},{0x040000cf,0x853b9e13},{0x03c1d4dc,0x25e95f86},{0x02810f21,0x08d1507c},
+{0x0101f96a,0x6e34c804},{0x0281d110,0x7434048b},{0x03a12422,0xf7aa1021},{0x02c1f086,0xd2c97928},
+{0x03a0076c,0xaba29ff4},{0x030028be,0xeee35182},{0x02e109b7,0x59d98a4f},{0x028e0196,0x846058dd},
+{0x024031af,0xf0cf9cb6},{0x0640fc01,0x751d993e},{0x0521d83f,0xac4f5255},{0x01c10e8a,0x806e3402},
+{0x02c00152,0x00a7fb52},{0x032008bf,0x24257e09},{0x0121f499,0xd728794b},{0x03410cf0,0xdd56d312},
+{0x04e1d7c1,0xe47e10dd},{0x02210823,0xdddc6c38},{0x02601557,0xf283d543},{0x0221fbf6,0xa1bff648},
+{0x0181f9f4,0x42ae4266},{0x04202750,0x676e3b6b},{0x01e0172c,0x6e6234f7},{0x04a1d071,0x3da64030},
+{0x03e0a796,0x21a50b37},{0x020009a3,0x47eed9d0},{0x02811935,0xe6c882b1},{0x0241899a,0x30c833f7},
+{0x02c03143,0x649892d5},{0x02201945,0x8ea68929},{0x026032a6,0x686b1214},{0x02c132c4,0xf69b9bc7},
+{0x04212460,0xd2dfb36b},{0x03200d5c,0x6d3cefd9},{0x03e1220f,0x035bee03},{0x01e03110,0x7df9f626},
+{0x0301f041,0x52ce5645},{0x01e116b6,0xd3a8d6dd},{0x0260140b,0xf08c20e2},{0x03e18c9a,0x068defb9},
+{0x02011c75,0x3937cfbf},{0x01c16ac1,0xe62cdeba},{0x0801d1cd,0x969a5d88},{0x0360ab4d,0x2d79f75d},
+{0x024112f9,0xa0e5d732},{0x0341f144,0x00011207},{0x03e18b4c,0xc6c685c1},{0x02202f4a,0xe225b799},
+{0x02c10178,0xb225dc11},{0x0261b0ee,0xa1b8e21c},{0x0540fdbb,0x98a55310},{0x03e025b9,0x941ab92d},
+{0x02ce0049,0x663c5b0c},{0x01c0a240,0x6b49c54e},{0x0241885c,0xe7691629},{0x0241892a,0x1f2479c5},
+{0x02e14457,0xa2763ba3},{0x01a0a596,0x0fe595b8},{0x0401da64,0xa00ccb8e},{0x0260004c,0x6e152875},
+{0x0561cfb4,0x526a4b39},{0x02211ad3,0x06dde0c0},{0x04c0fd0a,0x9d021527},{0x0181f320,0x75b010f8},
+{0x024007a3,0xd78e9b86},{0x03a0fabd,0xb56d8c85},{0x02202fc7,0xbd4b5bcf},{0x0880fbfa,0xdd648c3c},
+{0x01810e65,0xe9f2b965},{0x0640fc97,0x7aecc3c9},{0x00c1f955,0x03ae6e32},{0x0421d62a,0x43b1e4fd},
+{0x02010801,0x5c544e0c},{0x030010c5,0x9728949b},{0x0521cf0d,0x1ad10685},{0x03a0a655,0x746aaa5f},
+{0x03010574,0x56757894},{0x0380d7d3,0xe93913d3},{0x02410f35,0xe7e13797},{0x03a01e5b,0x5ce82526},
+{0x03002c86,0xb5c793fd},{0x028019b4,0x55bd0fc1},{0x03410cdf,0xbb6b23e1},{0x0421d626,0x37b1d219},
+{0x0320fb2e,0xabd5271c},{0x01c0a25c,0x3a3fe136},{0x036006f1,0x373ad676},{0x01e106d4,0xb2bced1f},
+{0x0400fd45,0xef5c1117},{0x03a1234c,0x67db19fd},{0x0161f9c0,0x8ef8a1e4},{0x01c10ea9,0x67765b6c},
+{0x03002d46,0x6281eb40},{0x01a0a43d,0xa756e660},{0x0201062c,0x22262eb5},{0x01a1f1a3,0x21d07bcf},
+{0x0340320c,0xf91b1281},{0x0240a803,0x0dabbcbd},{0x03e18b83,0x1ebc82ed},{0x018007e2,0x21d47bd5},
+{0x032122d0,0xafa25310},{0x0281144f,0x87905c25},{0x0321f744,0xa30d1b60},{0x02e133fc,0x97e4f895},
+{0x0260140e,0x0caedf38},{0x0101f438,0xab0a2d5e},{0x01e0a844,0x941a36cd},{0x01002328,0x5cbe8e74},
+{0x0181f45f,0xf33c4472},{0x02616a2f,0xfc120334},{0x028019f0,0x14a8b47c},{0x02c1d143,0xb743ef85},
+{0x0261b0c0,0x21733597},{0x03210cd9,0x589a7439},{0x0401d546,0x4e89870d},{0x02c0ab8f,0xc60c5fb5},
+{0x01c0a35e,0x116497b8},{0x03c10150,0xc8aa69a7},{0x01c0a35a,0x1b5a1a1a},{0x0241894a,0x2e8365c8},
+{0x02c01c3d,0x6fe1d166},{0x02c10ac4,0xbd216388},{0x0241f0ed,0xd3702f49},{0x02812fc5,0x28f6fb0a},
+{0x02402f8c,0x4d7a0ec4},{0x0081f6f7,0xba9ef7fb},{0x02a10005,0x56516de8},{0x05800772,0x38e1fb6f},
+{0x02a16b35,0x00a12e1d},{0x03002c49,0xdc151f7f},{0x020102c8,0xb7f90dde},{0x038015bd,0x0fb81b07},
+{0x01a1f6ac,0xdae56fe5},{0x020031ba,0x8fa5b49d},{0x03601420,0xa81f3515},{0x0621fb3d,0x40ee99f0},
+{0x02418ae7,0x650d46b4},{0x01c0a142,0xe34d813f},{0x02202204,0x6478a3e8},{0x03602510,0x690f8965},
+{0x01a0a190,0x84637b3a},{0x01602114,0x082b9ee0},{0x0201bc3f,0x61c28d0f},{0x020030df,0x68d2726d},
+{0x0320fec4,0x91b98a40},{0x01c0a23a,0x1b0a3308},{0x0481d75b,0x3dabedb6},{0x01a0a0ed,0xe20e0186},
+{0x0201f539,0x22c14bec},{0x04000699,0x9a2efd3d},{0x01c0a332,0xcd5a19a8},{0x020112a8,0x61f97fa8},
+{0x0160060b,0x613d2120},{0x01a1f6e9,0xeb7d828a},{0x03200236,0xc0604116},{0x0460047c,0x6743cd01},
+{0x03a1e145,0x4188b4dc},{0x032027fb,0xfe4ccaab},{0x03c1f229,0x88a1c662},{0x020019de,0xaa01cb3e},
+{0x0161f35f,0x4d70140c},{0x02c0042d,0xdd1153ef},{0x01e0a3be,0xbbe6e78d},{0x0481e8d3,0x628a5a05},
+{0x02a16e87,0x60185dd7},{0x0400323d,0x6058765f},{0x02a0ab25,0x8fd810a9},{0x01e0a24d,0xc337f5f3},
+{0x02e0a65e,0x6329bf9f},{0x026021c8,0x677b878c},{0x02a168d6,0x0bb275a9},{0x04402a34,0xb8a79809},
+{0x034100c5,0x6f81e4b3},{0x0440113f,0x7503003d},{0x02c130be,0xac2ada96},{0x02600931,0xaf898fb6},
+{0x02a1690b,0x89430a7b},{0x02e1f858,0x17b14927},{0x046027e7,0x850cd89f},{0x02011ad7,0xc60a08fc},
+{0x02e1042c,0xa797ca4b},{0x0121f390,0xcfb02569},{0x01c0a3b0,0x483b7860},{0x02c020f0,0x231d056e},
+{0x0421da4c,0xd57c8317},{0x02602594,0x28f41ed9},{0x03e18b8b,0xadbbd10a},{0x03c029fc,0xfc98c8e2},
+{0x024189d2,0x2ec5f23a},{0x0381d133,0x5052572c},{0x02e14540,0x7a938499},{0x03a12418,0x6f4da9a4},
+{0x0280a8fb,0xf905a06d},{0x020030e8,0x22b3ef27},{0x0301d4c5,0x39a11b57},{0x02e14517,0x0ab0e95d},
+{0x02e0210f,0xdf2d4167},{0x01602e3b,0xeb863fad},{0x00e02bd9,0x605afbc0},{0x02201b9a,0x88b5b28d},
+{0x02600d8b,0xce01e3cd},{0x0180a497,0x53d2c901},{0x0261f4af,0xed7e18fc},{0x0301689c,0x63123215},
+{0x02602266,0xcf687936},{0x02e13288,0x9afc973c},{0x0361ee95,0xe3c4051f},{0x01e11630,0x0d02d9f0},
+{0x0361249a,0x3ddae8a5},{0x04202558,0x3cba2bb8},{0x02e1ed03,0x8b8123a1},{0x02401a2a,0x7fc9fc3b},
+{0x02e124a5,0xfdfb3213},{0x03c10b68,0xbfcbb104},{0x0381d4eb,0xcacf9d9e},{0x03e1d5f6,0x7205c106},
+{0x02c02d10,0x7460b13e},{0x01a0a1eb,0x6e0df76b},{0x03c1d56b,0xfe258027},{0x03e18c96,0x778ea19c},
+{0x05a1d8e8,0x7b9e418e},{0x0421d5e5,0x4636bcaa},{0x02a0aa79,0xa90c642b},{0x02810e7d,0xb655bbb5},
+{0x02201bb1,0xc5f10ec4},{0x01e16f1c,0xf2c99de7},{0x0401d544,0x4c8983e7},{0x02816a26,0xea4bd764},
+{0x0221238c,0x8ed9ad19},{0x0480081a,0x668670af},{0x02418804,0x7d7fc89a},{0x01e0a37a,0xd7927719},
+{0x0341f008,0xac854390},{0x02418a4a,0x424776cb},{0x02c132fe,0x58458265},{0x01c02abc,0x35a41975},
+{0x01c02ec7,0x603c1eb4},{0x04c0fbaa,0xbea1d529},{0x0421d002,0xed5ba9a8},{0x02418987,0x3192750b},
+{0x0440fefc,0xa47109fe},{0x00c02239,0xfb407aaa},{0x03e18bd4,0x18db9754},{0x0300ff1e,0xbbb45734},
+{0x038016d3,0x6a9b2c62},{0x0200aa41,0xedc5a08d},{0x04002b9d,0x432fb14e},{0x03211c93,0x6f1430a0},
+{0x01c00ec4,0xf18a1c0f},{0x02202e45,0x63840bf3},{0x0280a80f,0xa8380185},{0x02a0abc6,0x66e4d153},
+{0x02c00629,0xc8792e08},{0x0341d44d,0x2db2b0d7},{0x03411a07,0x2e880474},{0x0221f7e3,0xae08bcbe},
+{0x03202c4b,0x07fcd90f},{0x02a0a8c3,0x53964d4b},{0x03a10b79,0x427ef3fc},{0x02e1fb96,0xa258bc03},
+{0x032018d9,0x0b3e3559},{0x058008a4,0x67e73ea4},{0x02411c25,0x13d73007},{0x01a10939,0x9abf6113},
+{0x02e01db6,0x0ee0746f},{0x03202def,0x0e7db4c3},{0x04a1d663,0x3a1b0c2f},{0x0361d5be,0xce9c9785},
+{0x020005b0,0xe2e96ab7},{0x0361d701,0x84566ffa},{0x01811688,0x6350a2e3},{0x02c13252,0x85adc2d4},
+{0x02000683,0xdb717041},{0x01c02eaf,0xd0a86900},{0x0321210d,0x288a0eba},{0x04a1d893,0x74f6eca4},
+{0x01e11057,0xd0d76ff1},{0x02418833,0xee873642},{0x026115c5,0x8e29dbf5},{0x02002489,0x8e3dc7b9},
+{0x02201b93,0x74d5e6bc},{0x02c1bc65,0x2328c30e},{0x0201f3ea,0x23f7f871},{0x028e0160,0x8871a84a},
+{0x024118e1,0xc2f9a50b},{0x03000481,0x34060024},{0x03c1d4e7,0x3ae98095},{0x0360fee7,0xa74781c7},
+{0x03a02cba,0xc19df22e},{0x0361e894,0xc31e2d60},{0x016025a0,0x3268f1c3},{0x03e1d57e,0x76f51794},
+{0x01811627,0x3c2c05e0},{0x01c0a421,0xf5e50f3f},{0x02010636,0x1e23e9d2},{0x02611a96,0x0e40c6e7},
+{0x0201d300,0x6a1e8f64},{0x02a16827,0xb2c6ce4a},{0x02803294,0xb7591eed},{0x03a0fb81,0x0fc9a52a},
+{0x02202ad5,0x1c46ab0a},{0x02a101d9,0xdba07fbf},{0x0461d612,0xd2a2d4f2},{0x02a116b8,0x53710205},
+{0x0480fcc4,0x9ca9d989},{0x01e12055,0x57fd61c3},{0x02616a90,0x0d1cff40},{0x01a0a5a4,0x26e7f884},
+{0x03810787,0xa9b974c2},{0x03e1d603,0x8d05eb87},{0x0361cf29,0x8e984faf},{0x01a0a1f1,0x69f45939},
+{0x02200a6b,0x7ce6394c},{0x0200306f,0x8c1d78e5},{0x04600528,0xc36cec3d},{0x0521f825,0x50833272},
+{0x03e10af6,0xcfa2a4e0},{0x022022dc,0x00892bf1},{0x04a0fc28,0xd854b86e},{0x02201812,0xe66c9e02},
+{0x0180aa06,0xbb809280},{0x04202b76,0xadebb959},{0x0381ecb2,0xdf282ada},{0x02a019f8,0x642fadee},
+{0x01e02192,0x0cab2e19},{0x0501d974,0xc12afea3},{0x03e120e1,0x2d6ba4d4},{0x05010f10,0x8f2d1754},
+{0x0320d7e6,0xf7d17dab},{0x01e106c9,0xbeb882d5},{0x01e0180a,0x5260db1b},{0x0361d69a,0x3f06ef62},
+{0x02a03277,0x4b7d599c},{0x02a1e7e3,0x10a2a0d5},{0x0421d06a,0x597acfae},{0x03216e48,0x71855cb5},
+{0x024189ae,0x9ccd5b29},{0x02e145c7,0x76efe071},{0x0341d158,0x3cd3d44a},{0x03a12065,0x3da31b1b},
+{0x01e10766,0x7aff1741},{0x01a0a600,0x0b2873c6},{0x03e18b41,0x94c6370b},{0x0301d404,0xcd4d1e0d},
+{0x0201fb2a,0x8cbf07a9},{0x01c0a085,0xce802be6},{0x0421eea7,0xd2ab61cd},{0x0381686c,0xd98386a3},
+{0x03600247,0xda631c7f},{0x02e1461c,0x68dc42af},{0x0261b027,0x4b5024a2},{0x03610caf,0x91bfe6be},
+{0x03a0faa9,0x30708cbd},{0x02a02864,0xa896066e},{0x02401fcd,0x1d8d0712},{0x02401693,0x7c89d310},
+{0x02000a08,0xc1ee9fd1},{0x01e122eb,0x77d684b3},{0x016031d7,0x1072c3f4},{0x02a021c7,0x3e749d1c},
+{0x0320a88b,0x8bf85060},{0x02210610,0xea1a6104},{0x01c000b2,0x7bdfe637},{0x0340ff44,0x0de0e847},
+{0x02000f50,0x8b31c875},{0x03a0fad5,0xa07c7600},{0x01e01726,0xaa6f5f5e},{0x022021e7,0xefdb7075},
+{0x024114bb,0x47c0a972},{0x026e0120,0x20a87c8c},{0x0341e88d,0x01aab1a7},{0x0401f11d,0x2c30211b},
+{0x01a0a4e5,0x905167b8},{0x0200265d,0x3759184d},{0x022104e3,0xd2e48554},{0x02418a8e,0x56a19051},
+{0x02e14584,0x7134a208},{0x03c03179,0x802ea835},{0x02e144d9,0x19211cee},{0x02812fec,0x3964f32a},
+{0x0180a02e,0x5e5913ba},{0x0501d976,0x82da694b},{0x0061f441,0xd05f9c7a},{0x0240090a,0xd86aca85},
+{0x02402299,0x21072142},{0x02418a4c,0x404773a5},{0x01c11006,0x565fd488},{0x02a104c7,0x06e61148},
+{0x03000d74,0x0858e24b},{0x0180003c,0x207746ee},{0x02810acf,0x5147d144},{0x03a1d717,0xf3276287},
+{0x03016e76,0xaa2e2e18},{0x01800ed9,0x5abd4cc4},{0x0261b0be,0x237338bd},{0x04a0250b,0xd2d44f83},
+{0x0201206f,0x14e09743},{0x01e00bf7,0xf31ec6c8},{0x0341d801,0x0bd0686f},{0x0260105c,0x882a378d},
+{0x02a0a9b3,0xe4045b22},{0x01a16a48,0x25027ef2},{0x03002df6,0xb8f44c7b},{0x02e00415,0xcc51745a},
+{0x02e12007,0xe57edcfa},{0x04a1d666,0x2f1afade},{0x0241019b,0xa7ed9e22},{0x01a0a528,0xcae0abeb},
+{0x0201f387,0xeaa6bc84},{0x0261f912,0x63ee2330},{0x0280146e,0x8e43d637},{0x03a0042c,0xcf25f859},
+{0x04a02bae,0xfcbeade4},{0x02e13374,0xf17db9f0},{0x04002366,0xcfd143ab},{0x02e16948,0x85e784ab},
+{0x03000fa4,0x1e813a42},{0x01e1120b,0xd3d3176c},{0x02a11d10,0x9fd3f306},{0x0240193a,0xd5c76e5e},
+{0x02801186,0x9f602a73},{0x02c10918,0x2e07a4c7},{0x02c13021,0xff2264b1},{0x01c02660,0x766167b8},
+{0x0361218e,0x7cb58768},{0x01e106ef,0x41c48a01},{0x02c02c9c,0xd930ffa6},{0x02c00423,0xcd113abf},
+{0x03a1e119,0xb3f1a425},{0x02e1123c,0x9b42e9d4},{0x0400ffa2,0xb85bffad},{0x02e14422,0x23800112},
+{0x01801c7b,0x85d491c5},{0x02a00445,0xcdef3b00},{0x028011bd,0x48a85ae9},{0x03c00d3b,0xcea887b6},
+{0x02e1d36a,0xdcc5ab70},{0x02a1da6c,0x4c8f20fa},{0x02c022ff,0xee4915ab},{0x03600224,0xd1f64384},
+{0x0181f94c,0x707fb982},{0x02202490,0x44599af7},{0x01a0a0c4,0xe8789127},{0x02c12159,0x6119c4a7},
+{0x02c13356,0xdcbeb2c1},{0x03010c24,0xfceb1e3b},{0x02c02b3e,0x69f9b843},{0x04e0fcf3,0xc44f4be1},
+{0x0200078c,0x19a73b88},{0x02200d39,0x0628041f},{0x02e1460e,0x7d013304},{0x026118e9,0xc1a33129},
+{0x01a0195b,0x4dac68e8},{0x03811aed,0x6f9b7ab2},{0x03a0feb5,0x294a862b},{0x02001766,0x30f96d8b},
+{0x0201bc13,0x44f1bd9d},{0x01a0a5f9,0x170eeec4},{0x01e0a05a,0xe3497697},{0x01e0a2f8,0x799cad81},
+{0x01e10697,0xc1327a35},{0x0160331c,0x79c32061},{0x04a1d8bd,0x9965ff7c},{0x0300040c,0xc7dc1e1c},
+{0x02c122ee,0x1196f751},{0x02a1000d,0x3c1d1942},{0x02802574,0x9897f40e},{0x026115bd,0x420f5577},
+{0x024188a1,0xf9d95006},{0x01a0a46e,0x9e5c0860},{0x03812409,0x0be62de1},{0x03a1215a,0x124995e4},
+{0x03e1f861,0x04174d11},{0x03411c36,0xc3b3e655},{0x02c13023,0xfb249cfc},{0x0300a977,0xa1f92c8f},
+{0x01e0a420,0x7e973f25},{0x0261b0e6,0xf0bab66f},{0x00e020a9,0xc53b6faa},{0x03610c8c,0x9dbff9a2},
+{0x0141f62a,0x1de65fba},{0x02003089,0x5054c76b},{0x02016a9a,0xbe2748ed},{0x02c1d352,0xaf6dd2f8},
+{0x03612106,0xa63971ec},{0x01e10b04,0x7e1e544a},{0x02a011a8,0xc8cec61e},{0x024010ef,0xf49947fe},
+{0x0240d7c0,0xfc7d89e9},{0x02c13182,0xb432e1a1},{0x02602dd2,0x9af8d586},{0x01c01027,0x471a5457},
+{0x03402b53,0x2125dee4},{0x04002358,0x7ee2cef8},{0x0221f646,0x7be465d1},{0x01a1f328,0xbe22d665},
+{0x0221f7e0,0xdca97116},{0x03e02775,0x52c81ebb},{0x02ce0050,0x7f3c8267},{0x02e1341f,0xb0cf2591},
+{0x02e0216e,0xec9495dc},{0x02c0ab23,0x712bbd5c},{0x01a029e7,0x68260b1b},{0x0401f123,0x162ffe79},
+{0x03201b06,0x40b39dd3},{0x030020de,0xd2559c3a},{0x0321d6b4,0xc84b52cb},{0x02010354,0x7a34227f},
+{0x04c001e1,0xc2404cb6},{0x0180297c,0xf4ca44bc},{0x01a0a047,0x11a17076},{0x01c0aa2a,0x3cc0e2f3},
+{0x06a01fa4,0xb64ad919},{0x01a0a1e8,0x631cf0a4},{0x02418965,0xb388b455},{0x02e118d5,0x838a77c2},
+{0x02c132d7,0x4847a7cc},{0x01a0a6b7,0x471a9701},{0x0360112b,0x85e50671},{0x02418a72,0xc4a8f940},
+{0x020023fe,0x8e9f079d},{0x0260229a,0xbfa02641},{0x04c10cb1,0x471c5ec8},{0x00e02126,0x351fe97c},
+{0x0481f91e,0x31a62447},{0x0301238b,0xfa7f077b},{0x01e10655,0x532d4fdd},{0x0461cf13,0x7ac02ea3},
+{0x0421d5eb,0x3c36acec},{0x05a1d9ad,0x854e7e96},{0x02e1f509,0xdc887c44},{0x016029a2,0xf5af8e5a},
+{0x02c13050,0x39f13814},{0x02210818,0xe1cb2963},{0x0261d2f0,0xfabe8097},{0x036018ea,0x9c68a419},
+{0x02011c86,0xab4ff0d4},{0x01e10691,0x4d3a125e},{0x03c01ce7,0x08b88baf},{0x03416831,0x2dce91ff},
+{0x0301d406,0xcb4d1ae7},{0x024012e8,0xf50b6446},{0x02a02a85,0xb06205d8},{0x02c0316e,0xabb9cf16},
+{0x04a0253c,0xeb847f7e},{0x00a1f4fb,0x18846094},{0x02602b01,0x908102fd},{0x0161e2aa,0x9f5aa8ee},
+{0x0161f5b6,0xe53f8d8e},{0x0321d530,0x1da191dc},{0x02e0313a,0x2229bb55},{0x05a027af,0x75e6ffb9},
+{0x03401619,0xb73160dd},{0x02a1193d,0xf6e20b28},{0x01e11a6f,0x606aac9c},{0x02000f59,0xb31aae1e},
+{0x03e01488,0x8b943259},{0x03610543,0xd87e5a9c},{0x016007e5,0x7f68dd23},{0x0480fcaa,0x35473c05},
+{0x022032e1,0x6b23f60e},{0x0081f3e6,0x272a46d7},{0x032016c5,0x572f3ce5},{0x0261b0a5,0x12508bb8},
+{0x00c1f3bb,0x48b3ce30},{0x0200a911,0x667e84fe},{0x03800344,0xeb29a91e},{0x0301085b,0xd81c67b4},
+{0x024189bf,0x25c166e1},{0x0461d60c,0xd4a2d818},{0x02e02c6d,0xcbdb8dcd},{0x024012ee,0xff0b7404},
+{0x024005c1,0x8dc07c47},{0x02810903,0xfa4f2ffc},{0x04e01f44,0xcecc7290},{0x01e0a91a,0x3aace9ff},
+{0x034001ce,0xf5c71a7e},{0x02e0ab5c,0xf14740cf},{0x03c1f21b,0xf1f107ea},{0x03210534,0x123da31a},
+{0x01c0a139,0xf0582312},{0x030120e4,0xfa856822},{0x01c0a37f,0xe29d05ef},{0x02a003ba,0x0cc5ec41},
+{0x02202f61,0x48595e6d},{0x02000a97,0x7bca2652},{0x0560ff70,0x26d1b7af},{0x03e01c9d,0x79668b20},
+{0x0321d90c,0x75777eda},{0x02a0abd9,0x0ee9daa5},{0x030032a9,0x7024a506},{0x0480295f,0x2429cd57},
+{0x03e004fc,0x60b132bc},{0x0200306d,0x542330eb},{0x0241d325,0x3c32a7ad},{0x0380147b,0x1027f9cb},
+{0x02e0289d,0xed702db9},{0x06a01cd9,0x68cc187c},{0x0381da4f,0x6aa78b8d},{0x0240a800,0x19abcfa1},
+{0x06e1d96d,0xf4e9f7af},{0x02a02846,0x3ab03ef8},{0x030118d1,0xad62a6e0},{0x03212289,0x76f61140},
+{0x02c131b1,0xd0f79491},{0x02a169bd,0xc64ff681},{0x0160205c,0x61fad883},{0x028169db,0xc3ef814b},
+{0x02c01523,0xe418d74e},{0x02e145c5,0x74efdd4b},{0x02c024fd,0x20947d2d},{0x02e145e6,0xe6f74c86},
+{0x03601605,0xdd0f87d0},{0x02210302,0xa45bb8b6},{0x01a0a5f3,0x36e811b4},{0x02418a3f,0x433aac6b},
+{0x04402908,0x7a888de9},{0x02418995,0xafcb3a7b},{0x02818d07,0xebd1559b},{0x03a01e1f,0x745c55c2},
+{0x0261b0da,0xe9bd0fd1},{0x0261b0a4,0x11508a25},{0x0340ff54,0xfde0cf17},{0x0361e867,0xc2a06317},
+{0x0420088c,0xbcebd2fb},{0x03010432,0x60c5ea8f},{0x03401e83,0xe19a3a1f},{0x026119c6,0xf3867cdb},
+{0x02a0284c,0x98917010},{0x03c109bd,0xb7a889b7},{0x0380ffbc,0x54b2944e},{0x01c00c15,0x844c79ad},
+{0x0380162b,0xa8adef06},{0x032111ee,0x7f7f9319},{0x04202763,0xb01b40ac},{0x0340031c,0x9604e2d4},
+{0x0480fc36,0xdbf81227},{0x034001e7,0xe02addc0},{0x02e14400,0xb17891d7},{0x02011838,0x57d87fa2},
+{0x032011aa,0xde1552d4},{0x038024f0,0x58b15259},{0x02602da5,0x63e1a209},{0x03e00da7,0x1708b3a2},
+{0x03e18bc2,0x20eced0d},{0x01e1224c,0x4c16e6c5},{0x03e18be5,0x1dddddca},{0x01e1bc03,0xf1676917},
+{0x02801a47,0x1f5261c4},{0x026103d1,0x46fbdd05},{0x02c00d7b,0x213e1039},{0x03001144,0x7555922f},
+{0x03a1d745,0x3262595a},{0x0601d852,0xb44f5af2},{0x02c10048,0x12e7ddd2},{0x02c130c1,0xb72aebe7},
+{0x0121f482,0x5479ebf9},{0x03000862,0xa2d986c1},{0x02200070,0x31577428},{0x022010ea,0x8787a33b},
+{0x0321d525,0x18a189fd},{0x0321fb77,0x62828dec},{0x054121e4,0x507148ea},{0x03c02a3e,0xf0c2f634},
+{0x016031dc,0xca70172b},{0x022120ee,0xff80fa7d},{0x036015e0,0x44e9ac07},{0x03610eb0,0x6878b891},
+{0x02a10013,0xa1f4875b},{0x03c1ee70,0xd3d7e40a},{0x0341f13d,0xe900edd2},{0x0161f49c,0x00b30dd5},
+{0x02e130e4,0x75e2e7da},{0x01a0a0ce,0x1cf3c806},{0x02c118ec,0x9bde51ed},{0x02c13113,0x6b117f91},
+{0x03202c90,0xa75d6b1f},{0x04602b5c,0x814d8230},{0x02e14541,0x77937fe0},{0x0361ec8c,0x89699fb8},
+{0x03c022eb,0xc739c5b9},{0x02a1f6cc,0xb5d4c2b0},{0x034003c2,0x53a10a01},{0x022005a7,0xd6ce0b63},
+{0x0341f149,0xf50100b6},{0x026100c2,0xd065769c},{0x03210b82,0x2c74a4cb},{0x0461246b,0xcac0472d},
+{0x02c0186d,0x4d4a96a4},{0x02e028f1,0x889a364b},{0x026100a5,0xcf475ff5},{0x01c0a85d,0x76599f38},
+{0x02e124c4,0x4cdf33b9},{0x02e110bf,0x3f200810},{0x0441f173,0x6b45bc8f},{0x02402d5b,0xc6800c0c},
+{0x03014470,0x03d206ca},{0x03801cf3,0xc8901bad},{0x02e14594,0x673253b3},{0x02c131a6,0x51585050},
+{0x01a01903,0xe2ce1330},{0x0501d79d,0x09539acf},{0x0221010e,0xed56f564},{0x0221fa01,0x2ca9dee2},
+{0x020110b5,0xcb78af84},{0x0240fe00,0x6368911e},{0x0201074f,0xd650e15c},{0x0421d62c,0x41b1e1d7},
+{0x01c0a232,0x2b2cde7a},{0x0581d8d6,0x7bc10882},{0x01a1f338,0x97006705},{0x02010330,0xfbddb512},
+{0x02c10d0e,0xd338754e},{0x0580fd83,0xd67c4ba4},{0x01c00e9d,0x1fe532ea},{0x01c0a373,0xf781de1d},
+{0x034027f3,0xaf743bb1},{0x02410fc1,0x6f92fec9},{0x012000b7,0x998e0a0f},{0x02a0fe7b,0xbb191be9},
+{0x0180a414,0x5a83ee75},{0x02e02a3f,0x3a0ca940},{0x02a168a0,0xe625d647},{0x04001d87,0xc9796a68},
+{0x03600249,0xc4fe671e},{0x0341d448,0x22b29f86},{0x02c130df,0x0cd04273},{0x02418909,0xa2187c0b},
+{0x03a122df,0x89ab5da2},{0x0180a30b,0x7e7e16f3},{0x03e18c31,0xfa9ce75f},{0x02411063,0x2018b9f4},
+{0x02e1d6fb,0xd43a66a9},{0x0501d93c,0x8b2c297b},{0x0261ec71,0xc875b1be},{0x02a11c3d,0x9afdd6a0},
+{0x02e144c2,0x0c00b4cc},{0x01c0a397,0x3aba3e76},{0x01e12292,0x4fe55045},{0x01c00be6,0x0fd683df},
+{0x032015af,0xd930e551},{0x0421eeb2,0xa52de5dc},{0x0380017d,0xc9540556},{0x00e022b7,0xb04c94eb},
+{0x0360154a,0xbd31064d},{0x032025bd,0xf2e4e38c},{0x01e0a38c,0x660f9560},{0x02603276,0x0d008664},
+{0x06a01f84,0x7895237a},{0x02601234,0x4fbef04b},{0x0341fb7d,0x4e091e15},{0x02a00334,0x97e10877},
+{0x02c03256,0x0d8a2121},{0x0381e87b,0x71b2bb98},{0x01a0a348,0xd454c8d0},{0x0281044c,0x9cfbd70b},
+{0x0180a28b,0x9a88d063},{0x02e14427,0x2a800c17},{0x05e022f3,0xd675c818},{0x026e0110,0x22973691},
+{0x0301248c,0xcddb89bf},{0x01e11a7c,0x184c2630},{0x0200aa46,0xe4c59262},{0x0321d531,0x1ca19049},
+{0x0380ffba,0x5f4c2568},{0x0240219c,0xed52d7e7},{0x024026e8,0x68540350},{0x01611602,0x04b6f5b1},
+{0x02600a83,0xa9eedd40},{0x02001820,0x567e8f2e},{0x0261b110,0x7720e5e1},{0x0401d543,0x4b898254},
+{0x03c0259e,0x64fa824c},{0x01a0a402,0x4d884f00},{0x020031a4,0xd39953b6},{0x04a1cfb3,0xfea9b76b},
+{0x0261b113,0xf12aa04b},{0x02c16893,0x6fc5dd9c},{0x02002eae,0x025cfb2d},{0x01c11720,0xd27159af},
+{0x03c1d169,0xd3ad87b0},{0x0520fc7e,0x921d89f2},{0x0281222f,0x2080ffc2},{0x026012ac,0xeb5a8c43},
+{0x03010ff6,0xe92746fb},{0x012000a3,0xa9d22ff4},{0x01c116c0,0xcd5fdf31},{0x028e0162,0x82719ed8},
+{0x0480fd33,0xa5ed2b41},{0x02800d83,0xffcbd5b7},{0x02600ac2,0x1c228040},{0x02202399,0xd4c37258},
+{0x034001d0,0x5d49d1b6},{0x03002aa7,0xab077782},{0x0281690d,0xeb46de58},{0x03e025b8,0x03460e33},
+{0x03c011f2,0xcd0ea9c6},{0x02610a1a,0x7ef6e66b},{0x02e133ae,0xb00b5b22},{0x026e0103,0xa59a4361},
+{0x0301d40b,0xc44d0fe2},{0x03216e49,0x5e853ecc},{0x022005a1,0x769c1640},{0x02802ca7,0xba0f55ec},
+{0x06e1d093,0x3c209dce},{0x03616882,0x27f342af},{0x02c0281e,0xa07a48cc},{0x03c00240,0xec27da5e},
+{0x0341d7d5,0xb0cb2578},{0x02000858,0x6fe67f28},{0x0361d5c4,0xd09c9aab},{0x0601f504,0xb946b1c1},
+{0x02801d4f,0x658c7844},{0x03610980,0x247a0c87},{0x02212089,0x3b6e1b1f},{0x01e10512,0x398b35db},
+{0x01016a6e,0xa8b56865},{0x02a0fb22,0xb660d6bf},{0x02e13406,0xa5de52da},{0x024188b6,0x0afbfd0b},
+{0x02812fbf,0x23f6f32b},{0x03811ab1,0xbff8d066},{0x028e01cb,0x96d2d151},{0x02e0a9e9,0x37f00dab},
+{0x02611c45,0x1a369b9e},{0x0180a4e7,0xa2ca13ed},{0x04a02531,0xe6aaa624},{0x0301058d,0x43a378c4},
+{0x02410461,0x83d63a0e},{0x03401d4e,0x145177c4},{0x02418994,0xb0cb3c0e},{0x022104d8,0xcae478bc},
+{0x01e106cb,0xaabaa1f0},{0x03600500,0x5379379f},{0x02e025e2,0x0f818361},{0x03a0fa96,0x324a8938},
+{0x01a0a337,0xbcbe3eea},{0x0321f70d,0xf441416e},{0x01a01794,0x74fd0387},{0x03c1f842,0xd84e6bd7},
+{0x02812fa9,0x94fe60d3},{0x01c1118d,0x22aa4866},{0x02000a94,0x43c550fc},{0x036011ef,0xfeddcd7b},
+{0x01a1f102,0x30617885},{0x01a16f18,0x65d21c46},{0x02a00bf1,0x273f6bb1},{0x02ce0042,0x713c6c5d},
+{0x02800dba,0x95a0b42c},{0x01616a57,0xd91cd693},{0x058008c7,0x239ee5ee},{0x02e1d373,0x106df4af},
+{0x01c1168b,0xac9ef46c},{0x028e018e,0xf667c818},{0x03802341,0x64be2137},{0x02000d07,0x4a36bc17},
+{0x03011c07,0x873f183b},{0x02e1208f,0x3543b3b7},{0x028014ae,0x40a43abf},{0x024022d7,0x6963eb01},
+{0x0421d7ee,0x4c16457d},{0x0260fe68,0x122012c1},{0x0221d1e9,0xf361af8a},{0x04c027ab,0x2ce3bfcc},
+{0x036001ac,0x230ed996},{0x02c1334f,0xcebc5e20},{0x01a1f3c9,0x31a6e03d},{0x0200a992,0x32a38264},
+{0x0561d0a8,0x23bf0294},{0x0221da7e,0x0edb81cd},{0x04c1d808,0x2ded38c8},{0x0300ffc5,0xfddc06aa},
+{0x0300feaa,0x0a372520},{0x020111af,0x10e81667},{0x02c0aa65,0xfb37bcf2},{0x01e115a4,0xe5376510},
+{0x02c1ee16,0x83b9405c},{0x0180a015,0x8a88b733},{0x01c11281,0x07fc76b6},{0x044004df,0xa8ad6cb7},
+{0x0240ffe4,0x09c961f2},{0x01e11314,0xf6b32450},{0x02812fe9,0x2d64e046},{0x0421208e,0xfd17491e},
+{0x03813438,0x1f3b87eb},{0x01e0a60f,0xe0f61042},{0x0180007c,0x9d248231},{0x0180a624,0x142960b0},
+{0x03201137,0x42276bdf},{0x0220059a,0xbb90fc35},{0x028169ea,0x4571e2fe},{0x02e14606,0x76feeafb},
+{0x0281d174,0xd713c225},{0x02610861,0x19777d69},{0x02802298,0xdb023891},{0x0580fcf5,0xae35e456},
+{0x01e02461,0x2dff4a0a},{0x02410647,0xd908a13d},{0x0341f0cd,0xa2292a27},{0x02e02c56,0x54ae5813},
+{0x0141f62f,0x3ea635fd},{0x01e0a442,0x4820e2a4},{0x03212329,0x1e2ff8a4},{0x02402ea0,0x245b91d4},
+{0x02e10f86,0x18533ee9},{0x04202bf7,0x356f9dcf},{0x0241f329,0xf646f718},{0x02402d5d,0x207cc823},
+{0x02216f6d,0x58cda1c8},{0x0221f533,0xf0c40041},{0x03a1d880,0xafb7cbb7},{0x03401579,0x63b8a665},
+{0x02803270,0x2655b2fb},{0x02c00341,0x7d6a7d32},{0x01a0a390,0xf74a0116},{0x0201f7e4,0x469fed84},
+{0x02e1451d,0x8ab3f174},{0x02418a00,0x3e36275e},{0x01a0a33a,0xb2be2f2c},{0x0361ee83,0x7011d1c7},
+{0x02c03246,0x88b88b2a},{0x01a0a2a9,0x977939a2},{0x0360a79e,0x17b4809b},{0x02c13096,0x4325b81d},
+{0x0260206e,0x88ffcaa2},{0x0201227c,0x16101cdb},{0x02202a09,0x9a6c48a5},{0x02600313,0x9ac7c109},
+{0x00c1f9c7,0xef3c0d72},{0x0341d213,0x8146086c},{0x0201fa05,0x9d6d9f5e},{0x02a1f798,0xe85b6f6d},
+{0x026124f0,0xcc39276b},{0x02e14641,0x6abf218a},{0x02c1fb88,0xbbc6698c},{0x024188b0,0xfedb967c},
+{0x03602af0,0x4fbbfaae},{0x04a1d992,0xcd69ef7e},{0x02c1ec81,0xb4feade0},{0x01e00ce8,0xb803f7c2},
+{0x0201bc0f,0x9fd67661},{0x02e02aa2,0xafd1c508},{0x02c1f06d,0x1114fded},{0x0481d070,0xdb1b9862},
+{0x01611600,0xfcb6e919},{0x02411fdc,0xd24f7fe4},{0x0061fad9,0x12a2caf2},{0x028187f1,0xe589d126},
+{0x01a0a623,0x7bdb0bc4},{0x04800202,0x9ecbdcdb},{0x03a1d5ad,0x5c7bbf9d},{0x03c1d7fa,0x8a4f0e35},
+{0x02c13167,0x40be5b62},{0x03c1d4de,0x23e95c60},{0x0200176f,0x2101a320},{0x040000c5,0x31078369},
+{0x03a0fa8e,0x114c93dc},{0x024006e7,0x1e403782},{0x01e11099,0x4dcd2ce6},{0x02600ebd,0xbe85ec77},
+{0x03e01e46,0xdc453d2f},{0x022111b6,0xaac8bf90},{0x02e16886,0x0c506c66},{0x02612327,0x3b756932},
+{0x02e1220c,0x980e4f1a},{0x05a01f3f,0x6cfd6a02},{0x0301444b,0xf24fdbb9},{0x04400290,0x8db7e02a},
+{0x02402fae,0x29feb13a},{0x01c0222c,0x3b3f1af4},{0x02610908,0x8897be78},{0x01a16f49,0x7fb012e9},
+{0x03e1d07a,0xd50a8b70},{0x0121f5b2,0x002c22c1},{0x03e18b1d,0xfdd21549},{0x02810866,0x2edc160f},
+{0x0360a8ed,0xcdac7afa},{0x0280290b,0xe72f30a9},{0x01a1f5f2,0xc4811ade},{0x0221031d,0x6c6170bc},
+{0x02e1463a,0xe5c221c2},{0x0301d40f,0xb84cfcfe},{0x0381d6fe,0x836e6dc1},{0x02e10c01,0x00c2f29b},
+{0x0221bc40,0x42448967},{0x02c002d5,0xab214a19},{0x02216b6c,0x550d175f},{0x0260130f,0x4ccbdd55},
+{0x0520278c,0x59bcb8f4},{0x01e0101f,0x18522a73},{0x02c1333c,0x50b71a98},{0x0480fc10,0x6db42d20},
+{0x02418811,0xec7ca5c0},{0x01a0a484,0x01f87b6b},{0x028029ca,0x545d5ccd},{0x02a1118b,0x3d71cb7c},
+{0x0161fa70,0x87c214d3},{0x03812499,0x97c44b80},{0x0220006b,0x1c575319},{0x03a0faaf,0xd16ff730},
+{0x02001362,0xd60d4e1d},{0x0321d7ce,0xa57b23d9},{0x04010b63,0xdb97da83},{0x016027d8,0xf8b7d3e8},
+{0x0380ff2d,0x4eecd771},{0x026124e8,0xe5c8cf2f},{0x02200d13,0x6c24d31a},{0x0081f32e,0x15a14310},
+{0x03002bff,0x21234bf9},{0x0500275f,0xf046d6c8},{0x03e01b65,0xded1a33e},{0x03400d62,0x4dec5efb},
+{0x02810002,0x29cffe95},{0x02200a98,0x46503a74},{0x02e010ad,0xb18b8b3c},{0x01e111a7,0xa917cafa},
+{0x0200238e,0x82c260fa},{0x04a0292f,0x11ea1ae8},{0x0300287d,0xc5b06bc0},{0x02c1d13b,0x24868afa},
+{0x03e18b26,0x99d54974},{0x01a0a6c2,0x232968df},{0x00c1f429,0xbe8bfc90},{0x0261b02c,0xce46657f},
+{0x03e18bbc,0xc7ea225b},{0x02c13279,0x82a940ed},{0x0221f026,0x5f86632c},{0x0200072a,0xa2af9f86},
+{0x02601b09,0xa6461330},{0x03e017b2,0x013e3b6c},{0x01402add,0xba633440},{0x03001889,0x0f6cf88a},
+{0x04000d78,0xb5c4de3b},{0x02811c5c,0x7e47e655},{0x020013c2,0xec09e3a8},{0x02410fb5,0x3f7f2b81},
+{0x02418937,0x217ed423},{0x03c1d47b,0xde22e206},{0x01a0a224,0xc2f96282},{0x03e13436,0xa81039de},
+{0x02e144e2,0x122111e9},{0x024188ef,0x141dacaf},{0x01e03112,0x8bfa0c30},{0x0221159b,0x7a8b4776},
+{0x0261e909,0x999d721d},{0x02e1449c,0x9d0854d4},{0x00e02423,0xc940b286},{0x04001e3a,0xb4bf0898},
+{0x02200076,0x37577d9a},{0x03e10b48,0xb37dfa6e},{0x03c1d555,0xe4255739},{0x0340215e,0x1a39cfc9},
+{0x01a01750,0x2823a621},{0x02c1fa2a,0x0a861c31},{0x03e18bc7,0x1bece52e},{0x0521f82b,0xf5721bf5},
+{0x0341d4ac,0xc97c8d85},{0x03e022aa,0x5c149ff6},{0x0180aa56,0x5590d35b},{0x03001891,0x4f7a293d},
+{0x02c1316c,0x45be6341},{0x01c16ac2,0x91b06580},{0x02201b9f,0xacb829d0},{0x01002441,0x02115210},
+{0x0201045a,0x42ad926c},{0x02e1233c,0x1f8af9cc},{0x02418ae0,0x681e948e},{0x0141f962,0xc1ab6d88},
+{0x02e02897,0x8b954805},{0x022013cb,0x68aa2c87},{0x0261b031,0xc9465da0},{0x02610a20,0x86c55637},
+{0x0301f059,0x991a411d},{0x02c131df,0x41ff0239},{0x032118ac,0x2bd9c88e},{0x02a16856,0x4efd5c96},
+{0x03c107a2,0x35664ecc},{0x03e01cb1,0x746d3f06},{0x03202551,0x5a4cf2ca},{0x026012e2,0x54eb6b69},
+{0x024003c0,0x422ae9f9},{0x02e12130,0xeaa42f62},{0x03c1244e,0x9a085c5f},{0x0101f45e,0xde3ee997},
+{0x03a0a669,0x8f7a4a88},{0x02a16978,0xbf7bf0ce},{0x02c169cb,0x4e6d915f},{0x01811410,0x2049f6bc},
+{0x02211162,0x1634936f},{0x01c0a58c,0x79bd8255},{0x01a0a5d5,0x31000d28},{0x0180a3dc,0x92807506},
+{0x02e11a2d,0x1fea18b3},{0x02016a9b,0xb5273ac2},{0x01a0a372,0xb54d2fdf},{0x02e024fc,0xb12ca948},
+{0x028021e5,0x7a74cc8d},{0x01e01c44,0xc06f7501},{0x02c0284b,0x18a13b86},{0x02a101f8,0x1b63afbc},
+{0x01e00c6b,0x18d3912a},{0x03c1d7ff,0x56709b65},{0x0361d118,0xd1bb590d},{0x028107a5,0x6f8c8802},
+{0x024189b5,0xa3cd662e},{0x00c1f335,0x7619f7a6},{0x024022a1,0x78fe4ec5},{0x02016f82,0x597cb5b1},
+{0x01e16f94,0x75986808},{0x0260126b,0x43aa8380},{0x02a04dee,0xb7f30f3d},{0x016020b2,0x5e4d7941},
+{0x03e0189a,0xa3c363ce},{0x0261b046,0xbdeac2f8},{0x03001b37,0x4cb1c007},{0x02c028e1,0x4d208bf0},
+{0x0460fce8,0xc8d5734e},{0x024189ed,0x9bdc6420},{0x02418878,0x90e33817},{0x044022ca,0x6d948cc1},
+{0x02e1444c,0x1f732ed3},{0x0380fe9d,0xf59d827b},{0x01e0084f,0xa1a1e817},{0x02201372,0x6e8b7c68},
+{0x028e017a,0x826d21aa},{0x02c1e8ce,0x1ab46a0b},{0x03601db0,0x6c5a1ae9},{0x0400fe13,0x33240c47},
+{0x03600354,0xc687a4cc},{0x03c0ff6f,0xbf26d966},{0x00c02693,0x97f56434},{0x05412449,0xd51dded8},
+{0x02811933,0xf6c89be1},{0x01e003d0,0xea3afa4d},{0x038014dd,0xcbf1ce40},{0x056122bd,0x50586ebc},
+{0x02a00d8f,0x5766efac},{0x02a02dbb,0x67ed9800},{0x0420069e,0xf1a81a02},{0x0280aa7a,0xdb0b2e32},
+{0x03e011cf,0xbbfc4548},{0x01a0a33e,0xc2be485c},{0x02c03140,0xebc8bedc},{0x07201f8b,0x689f6710},
+{0x020032d3,0x31a9976c},{0x02a1b164,0x834342f6},{0x02c0247d,0xcea18e1b},{0x04c023c0,0x8fd79cf9},
+{0x03c004e3,0x1bfddcc8},{0x02c1319b,0xcc882811},{0x0181160e,0x100033fe},{0x0340d7e3,0xf60a488b},
+{0x0401f120,0x19300332},{0x03a02a4a,0xc6765c81},{0x02c0198f,0xce2fd52c},{0x030101fb,0xc8dccb77},
+{0x04c01e08,0xaaa1d615},{0x018007c4,0x220abc00},{0x0201f636,0x51fa780b},{0x02c115c6,0xb7fd9122},
+{0x0361f758,0x6b9c2bc2},{0x022019df,0x08d334b8},{0x01e1111f,0xe001b4f5},{0x03011c9d,0x4aaa8b57},
+{0x01e0a392,0x147d5e3c},{0x01802748,0x03dc1902},{0x0460ab5e,0x6b7cdbae},{0x04a12472,0xef729d64},
+{0x0220078e,0xde601e3c},{0x0241faaa,0xbe548dad},{0x02a02898,0x0c177bc9},{0x0320ff77,0xf46e58ee},
+{0x0200a86b,0x31299238},{0x01a0a1a9,0x9799377e},{0x02616b44,0x3fa872eb},{0x02e1687e,0x965e3df6},
+{0x03400460,0x74ba884b},{0x07001fac,0x452cbc92},{0x022031ab,0x84181b5f},{0x0340207d,0x55c0bf3e},
+{0x05012444,0xf04eb4e3},{0x02203124,0x68fe44a8},{0x01a0a1f7,0x681cf883},{0x02800346,0x58c8cd11},
+{0x03e02905,0xfbfa3353},{0x01e0a84c,0xcc3f5fce},{0x02c00563,0xa1350554},{0x03603218,0xde90f10e},
+{0x02418929,0x1e247832},{0x04600521,0x61eb866c},{0x038015b6,0xed72c0fd},{0x02c028b8,0x8610fdad},
+{0x034109be,0x807591ef},{0x02c0313b,0xf22ac674},{0x0401f128,0x21300fca},{0x02e130dc,0x015cda8e},
+{0x02010b07,0xb8a8bfae},{0x02011a65,0x74da4c9f},{0x05401f5b,0xddaca1a9},{0x03410536,0x4cca1c63},
+{0x0261b119,0xf31b98e7},{0x02e0029e,0x74799537},{0x03e18be6,0x1cdddc37},{0x01c01aa4,0x2a414446},
+{0x03c1ee6a,0x802f9e3f},{0x042021b5,0x9ffb9c3c},{0x01c0a2e7,0xbdda21d6},{0x01403355,0x44d959f5},
+{0x0801d1cc,0x999a6241},{0x02e10122,0x249a725d},{0x01a0a188,0x873c7083},{0x0261d327,0xc636bcc5},
+{0x0260a8a7,0xf2af7d82},{0x0241b008,0x61feb257},{0x02c1f06b,0x0f14fac7},{0x026016ef,0xc2247ae0},
+{0x00c1f99c,0xe1abdfe5},{0x030168d8,0xc479a09d},{0x03c1d1ac,0xdabf0df6},{0x03411a08,0x1287d860},
+{0x0200073e,0xa372852c},{0x02602e18,0xe312039b},{0x02200afa,0x267560af},{0x03600277,0xcfc45c93},
+{0x0381d48a,0xbd200c3c},{0x0280a4fe,0x15d86e31},{0x0300fede,0x5f55609d},{0x02c13061,0x0c9bd095},
+{0x01e0a13c,0xaadfea9b},{0x046001f2,0x53d6f6c6},{0x024188dc,0x0f0e9a46},{0x02a11d16,0x218267df},
+{0x038001cd,0x756907ad},{0x0341e7f4,0xda44ca88},{0x02200f4b,0x8270a725},{0x01a1fb1e,0x2da7c9d3},
+{0x02e1452b,0xf6ac4cb3},{0x0281b0a8,0x51ba4ca6},{0x0260120f,0x745fc920},{0x0300a7d9,0x51e3f0c1},
+{0x02c10d07,0xbf15c390},{0x03c1d6eb,0xd4c492f2},{0x0201045c,0x77b7a108},{0x02c132e4,0xca4ab309},
+{0x02e1d907,0xe79205e5},{0x02a02276,0xff11909b},{0x0101f95e,0xceb94e11},{0x01a16f11,0x482c5c40},
+{0x0421eeb5,0x54bb4d4d},{0x038029b2,0x9403202a},{0x02e02ab3,0x8a9d0757},{0x01c16a86,0xa4ec9ff7},
+{0x03e18c49,0xfa9aa8c8},{0x0521f811,0x0f7d405d},{0x04a1d65a,0x431b1a5a},{0x02001a08,0x4b4aa3f2},
+{0x036006c0,0xa446f5bd},{0x03010c0f,0xf3eb1010},{0x0221bc2b,0x7382139f},{0x01c11fe2,0x06c40de2},
+{0x030024d8,0x4bb6a625},{0x03e1230a,0x61d38daa},{0x0281090e,0x26f20b83},{0x0181f47e,0x4cecac82},
+{0x0241cf81,0xa4b31725},{0x03e18b78,0x0dcdb14b},{0x01a11826,0x9e5c0b79},{0x0481016c,0xad28a497},
+{0x030008cf,0xb308ce04},{0x032108af,0xc622f42b},{0x03211af8,0xf9b41862},{0x034118b2,0x9d287533},
+{0x04602a9f,0x27ca1ea6},{0x0301057d,0x7c4efe71},{0x01c0a293,0x568c2bc3},{0x032018e0,0x92825701},
+{0x0221d331,0xf5316850},{0x02418886,0x90e576ae},{0x02e10585,0x724a2c2b},{0x02c16946,0x0dc4cb14},
+{0x03a014b1,0xeb0050b2},{0x04001cab,0x68fb39c0},{0x0300a968,0x878053ca},{0x036015b1,0x58ea3c9a},
+{0x02e10582,0xc24f2749},{0x01e114a0,0x273d2153},{0x0360fea7,0xb1daf363},{0x03c1f226,0xbbabddb0},
+{0x03000863,0x16ea0f26},{0x01a11418,0xc38765a8},{0x0301f51d,0xbe5c0122},{0x02202bdf,0x3781c5f6},
+{0x02801476,0xf251eb2d},{0x02e13420,0xa9cf1a8c},{0x0240183c,0x8ed39191},{0x0381242c,0xb01952ca},
+{0x07400776,0xaba42b32},{0x0641d984,0xc1a4ac84},{0x03c0a77f,0xf17f7bd5},{0x01e11c74,0xc54800b3},
+{0x0601f81c,0x5ef21c8a},{0x0441aff8,0xcf52504f},{0x030022b9,0x716776a1},{0x02a16849,0xcbe37fd3},
+{0x03810c9a,0x504a0dd9},{0x01a1fad7,0xe30e79f1},{0x024010e4,0xf06f4060},{0x01a0a103,0xc29a5e24},
+{0x01e11c7e,0xad80337c},{0x03e18b79,0x0ccdafb8},{0x04402c7a,0xdfabd113},{0x01e106da,0x37bffd15},
+{0x0341e859,0xc3697f44},{0x03c024a7,0xf4011c00},{0x01e12141,0x431d945f},{0x034119a7,0xc4865006},
+{0x0341f13a,0xe600e919},{0x0281e7eb,0x701ea028},{0x03a1da3d,0x7f1e4f25},{0x02603262,0x016209b8},
+{0x00c1f5dd,0xf2327bed},{0x01e0a923,0xfab95132},{0x022112d7,0x08472fd7},{0x01e0a515,0xaeb6f267},
+{0x02c11fcc,0xbaac01cb},{0x02800b73,0xc872b06c},{0x0161f494,0x8b66891c},{0x02c13048,0x7d189daf},
+{0x0421d7dd,0x31dcd045},{0x03010c13,0xf6eb14c9},{0x01c0a6e9,0xe17b62ad},{0x028110df,0xacb0768d},
+{0x01a16f3c,0xf23ec54f},{0x0261f5df,0x9e8ee901},{0x0361d51c,0xfabc2ecb},{0x0280152f,0xc6e5c957},
+{0x0441d044,0xacbd9dce},{0x0181f6f8,0x28ae3315},{0x02a1002c,0x5a80437d},{0x01c1180d,0xdc354c22},
+{0x02411d97,0x47a349d8},{0x01e106f3,0x299f9360},{0x03200f99,0xb1ea59c3},{0x016031da,0xf5729973},
+{0x030002e8,0xe7ad4a5b},{0x0141f435,0x74547b29},{0x02801513,0x20821ed0},{0x04211300,0x8004d755},
+{0x01a00640,0x1039eb67},{0x0381e905,0x1d3167e5},{0x02c010fe,0x13aac8af},{0x02410311,0xb3ceb980},
+{0x02a1224d,0xc6f96e30},{0x01c03332,0xaf34af82},{0x01c0a3e4,0x2b227d9f},{0x04e1d8d2,0xa13cb339},
+{0x01c0190e,0x35df9323},{0x02a0ab04,0x82161f66},{0x0500a74a,0x43cb8f46},{0x0180a6a7,0x6ad1d14e},
+{0x0461f710,0xd28bdc10},{0x03a1205b,0x51bd7e14},{0x0221115c,0x4fd2cf71},{0x026169ee,0x7548f3a5},
+{0x03e02780,0x2a44a1db},{0x0300a7bf,0xb3475e7c},{0x02611d04,0x56e59b0b},{0x026100ca,0x17a6d5ab},
+{0x02011c73,0x813b407f},{0x03000f8b,0xaa9c6a3c},{0x03c004ae,0x923ed5b9},{0x04a01f04,0x83fc4c47},
+{0x02e01bcc,0xefffe4c1},{0x0620fbf2,0x2a3c1a6b},{0x0341ec84,0x27695eb8},{0x02e14489,0x080d7a73},
+{0x02a16b32,0xd4017ea4},{0x01603341,0x1e6ad9e9},{0x0201bc1f,0x3bd9aa8c},{0x02000719,0x10280d86},
+{0x02e16896,0x385ca193},{0x02a168d0,0x6aa6d68a},{0x01e106c3,0xc4b88c47},{0x02a021d2,0xdcfc9fee},
+{0x0201f7e2,0xe101d3e7},{0x0360fe9f,0x1d9ec8f0},{0x0260ff04,0xdfe85ed3},{0x03402145,0x19fbf930},
+{0x0301008e,0x1631a16a},{0x04202786,0x4196fcf2},{0x01e00caa,0xf50e5030},{0x04402555,0xea275b5a},
+{0x03810c88,0xcfe6b396},{0x0400293d,0xe2aa905b},{0x028e01ea,0x95df9bb1},{0x03800465,0x8a444153},
+{0x0621d817,0xdcda443b},{0x03202de6,0xfe85ea58},{0x03011a18,0x23e0a9e9},{0x02e03206,0xd40a5216},
+{0x028012e7,0xf28ad182},{0x02c1bc25,0x07bc5141},{0x03001d0d,0xf7b8afbf},{0x02401190,0xfab73afd},
+{0x02011168,0xdecf4dab},{0x032002c0,0xc6ccd719},{0x010033db,0x74c87e27},{0x042020d3,0x891311ff},
+{0x02a01480,0xb2e1c7bc},{0x01c0a106,0x9b22b591},{0x0340fb6f,0x0a72ad53},{0x03000516,0xd68c0ed1},
+{0x0260095d,0x8bc9fe60},{0x0440fe33,0x12b1a014},{0x01a02035,0xd2a57eee},{0x020022d8,0xef047df6},
+{0x02c02887,0x198ff3f8},{0x01e0a454,0x50dbd8ea},{0x02e1338f,0xfe54b058},{0x02e1336b,0x186eeccb},
+{0x02003082,0x4e29e33e},{0x02416b70,0xc6f64186},{0x02401baf,0x1c03bb8e},{0x0381d486,0xc1201288},
+{0x05c02bee,0x2573e69a},{0x0580fd8c,0x100bc7c6},{0x02a10041,0xd9750231},{0x01e106c2,0xc6b88f6d},
+{0x02418a79,0xc1a6b5f0},{0x02a0ab9c,0x4929b0f4},{0x02a03039,0x66e1734a},{0x02602a3a,0x32120435},
+{0x020121a5,0xb04cf446},{0x0700fc5d,0x752573e3},{0x02ce004d,0x623c54c0},{0x01e00852,0xb6b590de},
+{0x01e0a932,0xc5560014},{0x01a01906,0xfad8c654},{0x02011a68,0x2a4e17c8},{0x02802727,0x90289a85},
+{0x02400cc7,0x29c2a73b},{0x01c16a83,0xd3ced4e0},{0x024000d7,0xf18f869e},{0x0360140d,0xf3248f5c},
+{0x0521d0cf,0x89d14fc5},{0x0260127f,0x526e44a9},{0x03e1d5f0,0x7805ca78},{0x02a01a93,0x2f75e50a},
+{0x03410ce7,0xe8254797},{0x02802818,0x9a95568b},{0x02e00e12,0x6b397c9e},{0x04c1d9de,0xa1b1c6ef},
+{0x02202759,0x7264cb49},{0x0200263a,0x4f62556c},{0x0720077a,0x36f7ca66},{0x0301d4c2,0x3ca12010},
+{0x04e1d142,0xfbb05237},{0x01e00cde,0x213bb512},{0x02412082,0xa7501d59},{0x0181142e,0x6055946f},
+{0x01e1e2e9,0xcf689219},{0x02e13115,0xb888f3ad},{0x02601525,0x15b7e7bf},{0x03000864,0x82a578fe},
+{0x0300059d,0x917277a3},{0x02802dab,0x9d29ac3c},{0x04a025a3,0x5f289fcc},{0x03a0159b,0x6da45bb8},
+{0x02a1e8cf,0xdd90c7a8},{0x020112b6,0x9dd32004},{0x0340050b,0x93eda7a6},{0x02c00d81,0x306da643},
+{0x010033c9,0x6596c9be},{0x02e14423,0x1e7ff933},{0x0240aae1,0x6cfaf9b6},{0x05003099,0xadc1843c},
+{0x0301d465,0xbeca2668},{0x04001e94,0xeabb15c6},{0x0241087e,0x3abd2aa4},{0x02000d12,0x4836b8f1},
+{0x02c02a46,0x4a806860},{0x0180a4ec,0x46cbc1b0},{0x03801657,0x14db891d},{0x0421d63a,0x53b1fe2d},
+{0x03202ecb,0x0e9ede26},{0x0561fb94,0x618386fe},{0x02c0a768,0x27724a84},{0x02a027c0,0x32f0e6e3},
+{0x0480fc32,0x0f02cd02},{0x02e1445e,0x9d8bfa13},{0x0181e29d,0x46c3ec64},{0x01e00c16,0xdc4da3f9},
+{0x03c1d04a,0xffdea4bc},{0x04e1d648,0xf8e19933},{0x0361d106,0x1eae7252},{0x03410cc3,0x19fbcf92},
+{0x0321da17,0x83fd7431},{0x0480fd25,0x794030e4},{0x01002708,0xdb521dcf},{0x04c1df0e,0x3b53a9ef},
+{0x0441d9a2,0x5ea0eb48},{0x02816885,0x2ebcf836},{0x01e1f69e,0xdc364d7d},{0x03601659,0x7c03b27e},
+{0x056027ae,0xdb185956},{0x0180a489,0x9a6f387d},{0x02a0ab8e,0x3d31ecd5},{0x03c000e4,0xdd156908},
+{0x02418a57,0x57ae5dd7},{0x01e01007,0xe457e8c5},{0x01e03107,0x80f9fadf},{0x01a11007,0x7359dab1},
+{0x05212442,0x7a3146c7},{0x02a0aba3,0x2140cb4b},{0x01e029dd,0xb751db43},{0x05a1f596,0xa77c6995},
+{0x01e0a366,0x1c737a38},{0x05002792,0x28d17834},{0x01e1f3ec,0xe91cc080},{0x04001ece,0x616d6238},
+{0x01c0a2a6,0xb7868e78},{0x01e1f66c,0x6f3c6d73},{0x0621f678,0xf791c8fb},{0x02c13178,0x43cb2c0e},
+{0x0201236e,0x7581cae0},{0x0301d450,0xa9ca0559},{0x0260117e,0xea0129ee},{0x032100e1,0xc967ef98},
+{0x02e11d8c,0x24c134a8},{0x02a10f40,0x6f426f23},{0x02c01053,0x246d5e19},{0x0201fa00,0xf10189d7},
+{0x01c11690,0x02bf00d4},{0x03c02d35,0xc6a8a2dd},{0x02a11d77,0x832367b4},{0x0361d698,0x3106d958},
+{0x042004ed,0x381c851f},{0x0341d6c2,0xb130e17f},{0x0360d7cc,0x4ebe21d8},{0x032016f5,0x16987ec0},
+{0x01a0a18e,0x7c636ea2},{0x02200c47,0xc18fa661},{0x028002b0,0x688c7cfd},{0x03002d57,0xca78019c},
+{0x02418a52,0x3049990c},{0x02602056,0xc4b0756a},{0x02e1459c,0xe339d2ac},{0x0581f606,0xc34c3ca6},
+{0x0521d7b1,0x74fd0b6d},{0x03c00156,0x12cda293},{0x02e003d8,0x1265336f},{0x0521d9d8,0xf0ee7998},
+{0x02201b17,0x33522fa0},{0x02e00fb8,0x04efe554},{0x03a1206a,0x21db4798},{0x026e0106,0xa29a3ea8},
+{0x03210b80,0x11cfb4ad},{0x02200307,0x6a2be551},{0x04c0a74b,0xd67472ed},{0x05002540,0xeef78628},
+{0x03610409,0xdb428e42},{0x0201106e,0xccd63206},{0x02a1001e,0xcc5064b2},{0x03c1ee75,0xd33ac640},
+{0x02c00459,0x29651200},{0x03a01ea1,0xa209d863},{0x02c1319f,0xd0882e5d},{0x03002745,0xaa66890c},
+{0x022112f6,0xd7b25cca},{0x018023b2,0x5599d047},{0x00a1f988,0x0f93d1f2},{0x01c0a195,0x011944b4},
+{0x02e01396,0x38b4bb40},{0x026014aa,0x286e63f6},{0x01e00c1f,0x8668e540},{0x01e0a54b,0x444e0413},
+{0x0400a69f,0x2ea1c07a},{0x02c001c0,0xa14583db},{0x07e01fae,0xfb79b1da},{0x06c1d9c5,0x924859d7},
+{0x03a1e114,0xabc4a7ee},{0x0381d484,0xc7201bfa},{0x0141fad1,0x924a30d4},{0x02800920,0x61f2d490},
+{0x0201f7a3,0x0b5a9eda},{0x03a0fa90,0x384a92aa},{0x0260aa8c,0x97d488d3},{0x01e106d0,0xb0baab62},
+{0x03816858,0x945a27b5},{0x04a1cf31,0x4cc03c54},{0x02c020e7,0xc7bdf175},{0x02e16b83,0x43e3b2e2},
+{0x0260210c,0x63f50e24},{0x03e1d869,0x09d2612f},{0x0320a682,0x8712c50e},{0x0101f6e3,0x6c09e6d9},
+{0x0221d346,0xb08e0c75},{0x03e18c8e,0x269060b0},{0x02e16945,0xadffddfb},{0x02000bc7,0x73f1b8e2},
+{0x0201fbb1,0x8077f460},{0x01e11a82,0xfc5b04a6},{0x01c0a278,0xe4f6e1b3},{0x03e18c4d,0x479b21ff},
+{0x02c11d7e,0x9aa6ced5},{0x02602804,0xc61c5089},{0x04a0fc51,0x4ed3314b},{0x0301d457,0xb0ca105e},
+{0x03012023,0x1948f932},{0x03a1e102,0x6ffe050c},{0x0260138b,0x7c2f78e6},{0x02c13378,0x30c06e9d},
+{0x02e01ce2,0x680d0784},{0x020013ee,0xd91b0ee0},{0x01e11150,0xa4595b2b},{0x02e1f0ab,0x582c576f},
+{0x0421d15a,0x33986ed4},{0x0260fe0f,0xa59c81f8},{0x04e01f0d,0x04112c75},{0x0081f41f,0xecffbe63},
+{0x02c131a3,0x53585376},{0x03e18c37,0xf89ce439},{0x0301d45d,0xb6ca19d0},{0x02212079,0x69724970},
+{0x020009e6,0x2a873f18},{0x038014f9,0x902ebab5},{0x03a00fda,0xaff73471},{0x0521d82b,0x3e1858f1},
+{0x026014d7,0x126c02bd},{0x0340fb63,0x75f66267},{0x01e16f67,0xf3a5f4ff},{0x04e01f3b,0x61dc6594},
+{0x03801411,0xef97f133},{0x02201b9c,0xa4e9ba04},{0x01a0a17d,0x705a6162},{0x02402f1a,0xcc73d53d},
+{0x04a1d1e6,0xdabb1f61},{0x0300fe96,0xd0ea3d40},{0x02e145d6,0x7af22554},{0x0341e868,0x5a78e5af},
+{0x0240120d,0x04eb29cb},{0x008022a8,0x501b0925},{0x03001d45,0xa643d159},{0x026110f1,0x1b4d91f8},
+{0x01a0a0f4,0xa62bb826},{0x05c01f0e,0x49e7db8c},{0x01a0a54e,0xc2e09f53},{0x03c1d153,0x40f41bf1},
+{0x05e02915,0x535d3538},{0x02e122a4,0x9a9b56e3},{0x034111cc,0xc357e419},{0x01e03105,0x85fa02be},
+{0x0180a619,0x5f0aa2d7},{0x04000837,0x8314571e},{0x02c11a84,0x96bf9b4d},{0x02e0110a,0xfad31d4a},
+{0x056033f6,0xaf7e47ba},{0x04a0fc42,0xa3f07ff7},{0x02801367,0xe45e4b6d},{0x03e18bdc,0xe7db4a31},
+{0x014007cd,0xf18f1a66},{0x026e0112,0x249739b7},{0x0340abe7,0xeddfd9ab},{0x04201ca4,0x70c1c80a},
+{0x02000bc0,0xc00eb29a},{0x0160333a,0x7849c969},{0x02c01676,0x99e5077f},{0x04a03361,0xcedc2555},
+{0x01c0a347,0xc977ae18},{0x03812416,0x659fc118},{0x03a02c70,0xe962a817},{0x03602352,0xcb983b13},
+{0x0161f61f,0x207b5d2e},{0x03a11a89,0xdc2ae6c3},{0x02a01869,0x441211e9},{0x050023b1,0x6af9dba4},
+{0x02c133e1,0xcfbbc726},{0x01e106f7,0x2d9f99ac},{0x01e0a448,0xcdc28078},{0x0200a9ab,0x9670446d},
+{0x02000f57,0x22212b83},{0x02e02af8,0xcb3e59c3},{0x05e1fa3c,0xcba8187b},{0x0201113e,0x95a17eb4},
+{0x01e0a556,0xb60ab49e},{0x03401607,0xc73a7469},{0x026169fe,0x514d3827},{0x02a0ab88,0xe62ce6b2},
+{0x0341e8bf,0x1980db1b},{0x02210813,0xe5cd6e46},{0x01e11107,0x5969e8b7},{0x0441da5e,0xa257dda5},
+{0x0281100b,0x76d95c5f},{0x02e16e72,0x69d45d4f},{0x02a02d13,0xe46562dd},{0x00a1f937,0x2e68f56c},
+{0x05802a92,0xbd134bf3},{0x04e1d0bd,0x523af862},{0x02e1d108,0xe697a6fe},{0x0581d848,0x035b6253},
+{0x01e00844,0xbfb59f09},{0x03e18cae,0x198d04dd},{0x030024e5,0x5cb6c0e8},{0x02c018e6,0xd5c4976a},
+{0x0441f155,0xd74f3b86},{0x0241f9b2,0xe37a62e5},{0x01602bf1,0x895cbf26},{0x030101eb,0xbc691e40},
+{0x04e1d640,0x00e1a5cb},{0x02a0198b,0x6db4729b},{0x03601621,0x0eb472ff},{0x02001dd2,0xc1a78646},
+{0x03e0069d,0x6ebd547c},{0x03402922,0x4de4cb81},{0x02002658,0xd556a517},{0x02c133ce,0x880f166f},
+{0x0161f4f9,0x273ead7b},{0x03c10b4c,0xaaf9cc1e},{0x00c1f3a6,0x6923369a},{0x0400a700,0x7fe98b11},
+{0x0201193e,0xbddf3794},{0x0201f91f,0xa8d79b2b},{0x02203139,0xc86328b9},{0x01e02655,0xbe28e6d8},
+{0x02418951,0x27835ac3},{0x0201bc4a,0x3fc867b7},{0x02c1f075,0x4717f529},{0x0540fd9c,0x93401a5c},
+{0x01c0a1c6,0x4eb58ea7},{0x018031c3,0xb41680ac},{0x02801468,0x2877f787},{0x028e0197,0x75604140},
+{0x03c01b1f,0x716a7542},{0x0321d6b5,0xb81e19fd},{0x02c1332b,0x030f920d},{0x02a026c9,0x26dfd80e},
+{0x036011b4,0xfbe23060},{0x03c1da20,0x9a5a027f},{0x02418971,0xa78d1e9f},{0x02c13056,0x38f13681},
+{0x020030d7,0x58ca0a78},{0x01c10934,0x207a5fc2},{0x01a0315c,0x720ec5c7},{0x0301f5f7,0x71cca44c},
+{0x02201712,0x377092e7},{0x02a0ab7d,0x09361827},{0x02e02a01,0x58dfc553},{0x02211160,0x7b7a1573},
+{0x01e0a519,0xe97bff47},{0x01c16a4c,0x8a366ea0},{0x04600220,0x0d58260b},{0x032029ea,0x3e1ef0b5},
+{0x0280124b,0x12671efa},{0x020030fa,0x02bc0b8c},{0x0281684f,0x784676e1},{0x03e1d918,0xc0ed848b},
+{0x03212355,0xa407a20a},{0x042027b9,0x3411bdb0},{0x0361f574,0x0c2e967e},{0x026022d9,0x6672fbc5},
+{0x01e11193,0x6d0aa093},{0x03210ccb,0x5d9a7c18},{0x028187f3,0xe389ce00},{0x01a0a28c,0x785fc049},
+{0x04a1d0de,0x87b77313},{0x0200308c,0x5454cdb7},{0x0280abc0,0xa8b23e34},{0x02e11a0d,0x24136d06},
+{0x02401b91,0x735d8461},{0x03202de3,0x529c34e3},{0x0141f485,0x287df99c},{0x028014b2,0x3ea43799},
+{0x02010474,0x0b441b94},{0x01c1169a,0xf9780ed9},{0x02a11da5,0xb1868edb},{0x01e11147,0xcd502af4},
+{0x028e01bc,0x05d7fd3c},{0x0521fa08,0x0dbae6cb},{0x02801dc5,0xe54ab428},{0x0300a9ef,0x16ac8482},
+{0x0181f497,0x711168d2},{0x03c1f65f,0x395b1b96},{0x02400e40,0xad2baa0e},{0x04601ac2,0xcd1b189a},
+{0x024111b7,0x9f05e31f},{0x01401fbf,0x7a433926},{0x03e1d8fa,0x95c1b8f2},{0x02e02c75,0xd36ae412},
+{0x03c12265,0xdee3a76f},{0x01e1068c,0x523a1a3d},{0x04000c04,0x46b77966},{0x01c0a175,0x90d897bd},
+{0x0121fa84,0x7fd13eea},{0x02812fb3,0x19f2663f},{0x02e10127,0xd39ba929},{0x0361d5ba,0xca9c9139},
+{0x01a0a5cf,0xd1239b4a},{0x026e014f,0x9588e110},{0x02e10575,0x7663ca5d},{0x0361084e,0xec32f061},
+{0x02e00f1a,0xcf472094},{0x02601bb3,0x1ca2c808},{0x028002e3,0x788c962d},{0x0260314b,0xc6153c07},
+{0x05800751,0x65152d98},{0x030118dc,0xbda54c82},{0x0281b06d,0x032feec9},{0x02e14529,0xfcac5625},
+{0x02e144ce,0x0dfe795b},{0x03e1ed36,0x14583f99},{0x02c101f7,0x77c5e87a},{0x01e12009,0x430a0ca7},
+{0x02418a16,0xb430d0f2},{0x02e168c2,0x8b85be9b},{0x01ae0033,0x70151234},{0x03202c26,0x6353081c},
+{0x01a023d1,0xbe16aaea},{0x0180214a,0xfada3e32},{0x022016ee,0x2f26f1ba},{0x03401086,0xdbeda78b},
+{0x0161f364,0x8fe25a86},{0x0241f5eb,0x3048975c},{0x01c0a2ee,0x9cad486e},{0x0621d94b,0xf18d2fca},
+{0x03010c1a,0xffeb22f4},{0x0361e86d,0x09bb540a},{0x01e00b41,0xc2d37e3e},{0x05801f2e,0x2bbb4728},
+{0x01e10484,0x91209394},{0x0420a702,0x95bc8892},{0x02e1342e,0x1bd44b30},{0x01e02abe,0x07c7fcbb},
+{0x036024f4,0x828ccd72},{0x01202605,0xce8d462c},{0x0480fc26,0x083b832b},{0x04602c66,0xa7f48d0b},
+{0x0340a648,0xab1ae539},{0x02c1fbb0,0xae64c998},{0x04410171,0xb77fd22d},{0x01e0a166,0x081aad16},
+{0x01e0a921,0x3ed63e52},{0x03411fe8,0xc31d0dc5},{0x0301f852,0x4ece5f85},{0x016031c4,0x0572b2a3},
+{0x03a1d132,0xa4ff61a9},{0x024112f0,0x0777b9d8},{0x0301f04f,0x719fb603},{0x01e114d6,0x898fb50f},
+{0x04c02baf,0x0a1739a1},{0x01a10925,0xadbf7efc},{0x0261d319,0x63a6f5e3},{0x01a1f3e0,0x1a2ab2ef},
+{0x03c120a7,0x46fbba5b},{0x042002d1,0xc9931b3b},{0x04e01eec,0xc36b3420},{0x06a0fe17,0x1931171b},
+{0x032118a3,0xe5ac3abe},{0x01c0a476,0x30816720},{0x02e1232e,0x28452686},{0x03e18baa,0xa1e7a7f2},
+{0x03a124c6,0x7d5a57c9},{0x020030b4,0x42e14125},{0x02411913,0x6b96cb77},{0x03a1d67e,0xdf588a4d},
+{0x03c1f8a7,0x6b5a1fe0},{0x0301f759,0x62c10d84},{0x01c0a298,0xc57fe8bd},{0x02c02c87,0x2b2dad18},
+{0x03200fa7,0xe8965b7a},{0x02c13195,0x0a2ea5d2},{0x03a1d124,0x479ff4d6},{0x02811938,0xdcc872f3},
+{0x0441f172,0x6845b7d6},{0x02c1f082,0x3260ae86},{0x02c0185c,0x8018759c},{0x01c00eb9,0x1558b7ef},
+{0x036018ed,0x74f04591},{0x02400908,0xd49c6105},{0x0480ab46,0xc31cf214},{0x01e0a095,0xfd47c432},
+{0x04a1df05,0xa9cb4307},{0x020030f4,0x1cbc347a},{0x03401de0,0x2d1b6a0a},{0x02400f7b,0xc6ee5a90},
+{0x0360fe29,0xb7fb50f2},{0x02c111c3,0x4569f667},{0x02c004c0,0x5722fc41},{0x03c1d6ec,0x37a1ee78},
+{0x02402403,0x1715c87b},{0x02e13235,0x41762b4f},{0x028e01e3,0x96e1dbdb},{0x0261f63c,0xb00b194e},
+{0x05a1f243,0xe98cf968},{0x02a11000,0xf7702f9e},{0x03a16992,0xbbe36fb4},{0x0221f0e6,0xc5f81005},
+{0x02600d89,0xdf5fe731},{0x02c130e5,0x0fd0472c},{0x0321d534,0x19a18b90},{0x0201063b,0x1821a1c9},
+{0x0220059b,0x651b5b20},{0x024016e2,0x17452ab6},{0x01c00b6f,0x7904d30a},{0x026006e8,0x010653a6},
+{0x02602880,0xcb1c5868},{0x03801f74,0x7dc04a7d},{0x01e02465,0xc8a090d8},{0x01c0265c,0x1415a9b9},
+{0x0320a692,0xdb79945e},{0x0321f659,0xac3ac7a7},{0x02a10022,0x172e619a},{0x03600943,0x99149f8c},
+{0x030122f5,0xaa745fa6},{0x02a11d21,0x154ec53f},{0x024189d1,0x2fc5f3cd},{0x03e1cf9b,0x41c7c2a7},
+{0x02a01868,0x243a81f9},{0x00a1f9f1,0xdcc4fe7a},{0x01a0a270,0xe38ce32f},{0x02a1bc4e,0xb3231c8e},
+{0x06202ba7,0x0b3853c2},{0x03c02519,0xd0b34fe7},{0x0221e92b,0xf9e34e60},{0x04410cde,0x9807953f},
+{0x02601342,0xb48e8619},{0x0321e7fd,0x0d36a84f},{0x0301d1a9,0xfac21b56},{0x03002d51,0xa18d8760},
+{0x02a1e91d,0x3b43d900},{0x02e13202,0xd8c7e7c8},{0x02200d06,0x7a15de9a},{0x046004e4,0x5cbb6338},
+{0x02e109b1,0x55aea2fc},{0x02010800,0x585447c0},{0x0581d0df,0x7147223b},{0x01a1f9f5,0xad306b75},
+{0x0460a75f,0x973a3431},{0x03211c99,0xd08cc6ea},{0x010002d9,0x802b3b09},{0x0201128d,0x6d51cbbe},
+{0x02a1003d,0xc4465e56},{0x03210852,0x615fbaf0},{0x02418912,0x9f1638bb},{0x04400288,0xf657fc4c},
+{0x032100fa,0xaded7762},{0x02211c24,0xec4ffea7},{0x02610f3c,0x4584cd99},{0x0260aa93,0xe48698b8},
+{0x03a0fb43,0x4aae47e5},{0x0201236b,0xad822308},{0x02c0080e,0xaeb6a8b8},{0x02a1ee10,0x91e63bb4},
+{0x04a01f65,0x0a9e6e53},{0x022120a0,0xb2b969ce},{0x02812fb4,0x18f264ac},{0x01c0a163,0xfb88944c},
+{0x0200306e,0x4e232779},{0x03e00512,0xd7602212},{0x01c0a56b,0xadd5f113},{0x03e01abc,0x4d766db1},
+{0x03400ae3,0xf8fc3f37},{0x01c0a01b,0xbebebf93},{0x01c0a5cc,0x4a384544},{0x0260032e,0x3800c2ca},
+{0x01c0a375,0xf581daf7},{0x0240079d,0xa19e53fa},{0x0300111c,0xe3045960},{0x02001c27,0xe3e516ff},
+{0x0200a916,0xc4aea725},{0x02a11adc,0x69c8a88d},{0x0261b071,0x29169e8c},{0x0380fe8d,0x0248b72a},
+{0x02210349,0x2b0d3b29},{0x01e0178b,0x151f5241},{0x026e0129,0x1ba63616},{0x01a0229c,0xa76f7dca},
+{0x03411072,0xf668b121},{0x034024cf,0x4365dad1},{0x02e14452,0xab7649ce},{0x03a027e9,0xfe923188},
+{0x03802765,0xc73387fc},{0x02c01a5d,0x10dbd3ec},{0x0241f0ec,0xd2702db6},{0x0300a88a,0x8f322a6c},
+{0x02400d2b,0xb21e2fc7},{0x0481d75e,0x79debf67},{0x02418a55,0x3549a0eb},{0x01e106e1,0x30bff210},
+{0x028169f3,0xf0020079},{0x03801636,0x475281ff},{0x02200067,0x285765fd},{0x01a0a0d8,0x18ae9d36},
+{0x03c1d7e2,0xb6b0bbee},{0x03e124b0,0xf65e9d02},{0x02601489,0x38910f68},{0x02201bb6,0x7dcc7568},
+{0x02c1326d,0xf4b0b028},{0x0781d1c9,0x0bea06e9},{0x0781d9e9,0xbd7b4e6d},{0x03412394,0x96f4b45a},
+{0x0061f6d6,0x35679216},{0x0341d211,0x0b4d9d6f},{0x0401d53d,0x458978e2},{0x0301f036,0xaa3ae336},
+{0x03401614,0xbb316729},{0x0180a20c,0x7a43797f},{0x032118c0,0xe40e0a0a},{0x02802dba,0xa13afba9},
+{0x0180a40e,0x5e83f4c1},{0x05001f12,0x98fb6093},{0x02611c57,0x284ba528},{0x0260142e,0xf38c259b},
+{0x02402f62,0x59c6fd03},{0x02c028a6,0xa975d9c9},{0x01c0a478,0x388173b8},{0x030024e2,0x61b6c8c7},
+{0x0320fee0,0xcdc681bf},{0x02211129,0xdae5e2f2},{0x0281fa52,0xc453bdcc},{0x02418822,0x7d820731},
+{0x02002f79,0x4d3fabb4},{0x03e0323c,0x6c54c522},{0x03411369,0x5612d5dd},{0x0380021e,0x076d0634},
+{0x02c12167,0xa01ea502},{0x01801bc0,0xc86608f3},{0x01402135,0x272caf4b},{0x030111e8,0xddf8f3bc},
+{0x024188c1,0x0dfe405b},{0x02418897,0x8be0f1a1},{0x010033c7,0x77a17370},{0x03610ca2,0x89bfda26},
+{0x0561cf17,0x5334ab04},{0x03e1d727,0x40277cdc},{0x028168be,0x384a3401},{0x03003014,0x0bd10a25},
+{0x06801ff7,0xd197ac1f},{0x01811713,0x13df90b3},{0x02e119e1,0x76c53681},{0x03c1f224,0xc686767e},
+{0x0341d165,0x1acaec98},{0x03200260,0xaad4d136},{0x0420019e,0x22209d96},{0x02e12027,0x49ced065},
+{0x02401308,0x2905a5f4},{0x01e01012,0xe06fe75f},{0x026112f7,0x5a9fd967},{0x01e102cb,0x0d748466},
+{0x0480fc23,0x5c800f3f},{0x0421d237,0x456be7e3},{0x01e11ee9,0x36ad2a67},{0x05a0fd92,0x4f319bc9},
+{0x00e1f98a,0x4b38d357},{0x02801254,0x14baf7b3},{0x0340fef3,0x67f8d6a1},{0x03a1f8a4,0x455df553},
+{0x00c1f409,0x76bd901e},{0x03c11abb,0x7af90a3d},{0x01e005ea,0x53cab6dd},{0x0100a60d,0xe153c312},
+{0x01c1102d,0x46800f03},{0x02002290,0x5b822d50},{0x03002aae,0x817afcf9},{0x050033ec,0x87cb9350},
+{0x0141f97e,0x13285525},{0x0221fa6a,0xe90bc060},{0x02e12045,0xb86882d0},{0x0320321b,0xa1482e26},
+{0x02e145c0,0xf428a44e},{0x02e1462b,0xd4c44596},{0x02a0043a,0xdde8986b},{0x0240a891,0x39f4c695},
+{0x04802920,0x929a6eba},{0x02e11d33,0xc2f0fa02},{0x0161f548,0xf3735b03},{0x0221149c,0x1cd98037},
+{0x01a029c8,0x6b331b55},{0x0320ff99,0xeca837e7},{0x0141f692,0x65e91247},{0x0460fce1,0x71bd7c5d},
+{0x01c017e0,0x98cf69c9},{0x03e1f764,0xf7e68837},{0x02e10099,0x982c4c48},{0x04c1d948,0xb49c884e},
+{0x01e0226b,0x369b3e41},{0x04e1d7c9,0x9ed3de17},{0x0240130a,0x2105995c},{0x01a0a49f,0x998e71af},
+{0x02e002fe,0x11950bac},{0x01e02bdd,0xf99936cd},{0x01e106d2,0xb2baae88},{0x0261d866,0x2ef3f3f2},
+{0x04612379,0x1fcffebf},{0x034024ca,0x3c65cfcc},{0x03a1d591,0xdd916d4c},{0x02816991,0x93a81e47},
+{0x0180a2c6,0x9a573397},{0x04a1d76e,0xee1b82df},{0x020013cc,0x88251cb9},{0x0321221a,0xc44a1b72},
+{0x04012468,0x8f344398},{0x04001d8c,0x748cada0},{0x01a0a41a,0x1320fdb6},{0x06c1d0d5,0xa5427a2f},
+{0x01003387,0x6c96d4c3},{0x02c00d4e,0xa425be22},{0x03e18ba6,0x0ce85063},{0x01a0a17e,0x745a67ae},
+{0x02e16917,0x671ff260},{0x02601248,0x2b02291f},{0x02803247,0xef74d599},{0x0321e133,0x0fb09783},
+{0x0321012f,0xef1050ab},{0x0381daa3,0xb533d541},{0x02e032bc,0x405b10cb},{0x01a0a0aa,0xdf95d73f},
+{0x01a01910,0xeaf900cf},{0x0100339a,0x75a82c0f},{0x03202411,0xaf5bdf31},{0x0541d791,0xf3e2b5be},
+{0x02012056,0x07e082cc},{0x02411920,0xc7d803a1},{0x0341d218,0x7b43c063},{0x01c02590,0x81db951d},
+{0x04a0250a,0x96eff0de},{0x03216819,0x1e47dde5},{0x0381d4f9,0xd8cfb3a8},{0x04002ccc,0x5a585c70},
+{0x02000bf8,0x71845724},{0x01e12305,0x8bd6a42f},{0x0121f95d,0xb4255c05},{0x04c0fcfe,0x4c7648d8},
+{0x0361ee92,0xcfc324d2},{0x0341f75b,0x3e3209bf},{0x04600d00,0x8b285d7f},{0x01e00b6d,0x7d8412cf},
+{0x02602a38,0x8c8a2379},{0x02c1304a,0x7b189a89},{0x0400ab57,0xe3881d8d},{0x0380302c,0x9039c56f},
+{0x03a0faa7,0x227076b3},{0x016031dd,0xde7ac403},{0x0741d9bd,0x25553a02},{0x03810cb0,0x5e188717},
+{0x0561d930,0x167f8d80},{0x0261b04c,0xc5b932c4},{0x01a11824,0x065221d5},{0x02011165,0x16b190bf},
+{0x0221bc2d,0x16a7fd0d},{0x05c01fa1,0x7155d0b8},{0x01202100,0x61d81bdd},{0x02210301,0x50456e2b},
+{0x02c12005,0x0798936a},{0x0281f641,0x82cc6674},{0x03a124c5,0x8a55ef12},{0x04e1d645,0xfde1a112},
+{0x0361e818,0xdb97bff3},{0x03411071,0xec68a163},{0x046124b9,0x281a12ad},{0x01a0a119,0xfc7ca45e},
+{0x02e14622,0x68de8146},{0x0261b083,0x68e081fc},{0x02812fa3,0x17016c10},{0x04e02b5e,0xf8ea6fcb},
+{0x02000632,0xfa656b47},{0x02c1328a,0x82ab7f84},{0x02801dc6,0x1bd7f0fc},{0x024189a1,0x27c825cc},
+{0x0320fed8,0x6e4512f5},{0x0221f532,0x7cd15f2b},{0x052004ea,0x130cb992},{0x0281fa26,0xb2a1499f},
+{0x01c01a4f,0xbefe866a},{0x02a00668,0x6a7babb6},{0x0261f847,0x92fbf0bc},{0x0201bc27,0x59dc185d},
+{0x034024c6,0x3865c980},{0x0081f417,0xcc71636d},{0x04a11a9f,0xdffcd19e},{0x038000cd,0x2d77638e},
+{0x0280abc7,0xfdc8c81e},{0x01e1fb18,0x2c5e98cc},{0x0241882c,0xed897346},{0x0320fef4,0x51f62a8f},
+{0x01603357,0xfd7730ab},{0x0301fa2d,0x15bb4aa3},{0x0201105a,0xaafe20f3},{0x02811d0e,0x419f4760},
+{0x030011ea,0x70d9f4ab},{0x02c02583,0xffd111cd},{0x02600d34,0x38ec7423},{0x02200073,0x345778e1},
+{0x02c169b0,0xbf6b1212},{0x0221f9e9,0xd94e1dd4},{0x02e1bc85,0x57521ed9},{0x02e14438,0x1e70eea9},
+{0x056003ff,0xd157ad41},{0x01a0a1db,0xba12ec3d},{0x01e11a6b,0x64511b02},{0x03c1ee34,0x1dd22d08},
+{0x01c01c00,0x3c28eabc},{0x03c0fbff,0xf28a7d86},{0x04e01b7a,0xf5e6f434},{0x0601d84f,0x57876212},
+{0x02000c98,0x3b2d428f},{0x03011c94,0x1ec19f62},{0x02418931,0xa37bcf32},{0x03001147,0x7d8f9a9a},
+{0x032025bc,0x924fba42},{0x03e00697,0xed583953},{0x0241884f,0xea6b5979},{0x03402c16,0x2fd451fb},
+{0x030020e3,0x00036828},{0x04602ac2,0x59989b58},{0x0261f0bf,0x0bc6c999},{0x02011495,0x199c18c2},
+{0x01e0a52f,0xae0aa806},{0x02a10016,0x5ecdc1c0},{0x02c132b7,0xf79ddbf1},{0x024112bf,0xc5f75105},
+{0x02601376,0xb2d9b485},{0x02a014b4,0x7283e5e2},{0x04e1cf1e,0x3a0949ba},{0x03010c1c,0x075bc0aa},
+{0x034006df,0x7f4c243b},{0x020006b3,0x32d4b520},{0x0360a8e6,0x0e72bf70},{0x028032a0,0x75a1fa6d},
+{0x01a1f5d2,0xb68ba269},{0x01800e87,0xab678d61},{0x01e00c2d,0x21feb9c6},{0x03c1ee68,0xfb43ff94},
+{0x01e111a2,0xdd120ca8},{0x0220a88f,0xf9bfd388},{0x016026cd,0x8f0612c1},{0x06c01f82,0x4c3a961c},
+{0x01a1181b,0xf22f7017},{0x03c1203c,0xb7225e04},{0x01c0a54d,0x3148011e},{0x02418a9b,0x4b9f4069},
+{0x01c0a19a,0xbc28bd46},{0x0421cf05,0xa1c761d5},{0x02a014cd,0xe6d88ea5},{0x024188a0,0xf8d94e73},
+{0x01e11c71,0x572fce78},{0x024189db,0x1dc398e0},{0x02201b5e,0x2cab5ef0},{0x0321d536,0x27a1a19a},
+{0x0340011f,0x58d5e001},{0x0301d30a,0x4a54d205},{0x01e0a07c,0xe32b5937},{0x02a1d31f,0xef5a6022},
+{0x02812f90,0xaefc4b2a},{0x02411927,0x7bd30ecf},{0x01e0a90c,0x26cd1e2e},{0x03002c0b,0xde7d3f8b},
+{0x04200900,0xc409140e},{0x03812452,0x777ff0d0},{0x01e0ffe3,0xc6e5aa06},{0x03e18ba1,0x11e85842},
+{0x03802b66,0x8796a25d},{0x050001fa,0x390930ce},{0x02402d56,0x1e9d18a8},{0x02610399,0xf588c600},
+{0x01a00b2a,0x938619b6},{0x026e0128,0x26a64767},{0x016e0032,0xe3dac816},{0x05a1fb61,0xb1682851},
+{0x01e0a912,0x6ea72bad},{0x02201bc6,0xf482185e},{0x01c02230,0x2462cd43},{0x01c0a6de,0x6d10e037},
+{0x0361d5d0,0xdc9cad8f},{0x00c1f54c,0x6acc12d3},{0x03011cad,0x66de92ce},{0x0341d6c4,0x970943ee},
+{0x0281d911,0x91333189},{0x02c02470,0xa5ca469b},{0x022111c0,0xc69901d0},{0x0380294e,0xd1f09565},
+{0x03e18b70,0x05cda4b3},{0x03e0075d,0x42d97e78},{0x0181f6cb,0xf782ed50},{0x0481fa17,0xa5f25332},
+{0x02c011eb,0x16c3df9b},{0x02c131e8,0x46ff0a18},{0x01a0a1bd,0x388c7ed3},{0x042025f3,0xfbeafb37},
+{0x02601438,0x2cb1502f},{0x0381d4fd,0xdccfb9f4},{0x02a1d1d8,0xb86d2c52},{0x01a0a329,0xc1a641e3},
+{0x03e18b0f,0xd9cf9e06},{0x03e18cd5,0x758546ec},{0x02e122a7,0x8142de5c},{0x01a11805,0x0258d74e},
+{0x03001d18,0x0ab8cda8},{0x02a00dee,0xfcecf596},{0x0480024a,0x588140dc},{0x01c10500,0xfe0bce28},
+{0x0300a962,0x748483c2},{0x0241895e,0xba88bf5a},{0x07801f86,0x6cd15812},{0x0381f8a2,0xa4f3ea43},
+{0x02611945,0x4d9ce000},{0x02a1697d,0xc4cf2883},{0x0301681d,0xa41bd5d6},{0x01c110a2,0x7c5e2a32},
+{0x05201f4c,0xace1a091},{0x0201221b,0x7e4881dd},{0x03a1d5b0,0x5d7bc130},{0x01a0a56e,0x1f20447d},
+{0x0101f5fa,0x72296703},{0x02c1118c,0xea22dc90},{0x01e1201d,0x8a0a7c6c},{0x0101fa98,0x262e7ea7},
+{0x01e0a6d7,0x4e684098},{0x02e133fb,0x94e4f3dc},{0x0261b0ba,0x1f733271},{0x02e122b5,0x8c13cf5a},
+{0x00e1f300,0x5bbe4d06},{0x03e18c70,0x81932e88},{0x02c1699b,0xc36b7ead},{0x02e16e6e,0x5ed44bfe},
+{0x0701cfb7,0x7b810b5c},{0x01c00987,0x2721c460},{0x02e0ffec,0xae67a81c},{0x04202aaf,0x6a2c7e9d},
+{0x02c16b7f,0x2add7eb4},{0x02401842,0x583dafab},{0x03a0fba9,0x1e542523},{0x02801492,0x1d382581},
+{0x03a1d685,0xc65862f2},{0x036015c4,0xb50aedce},{0x05211a46,0x25c38029},{0x0140a6f5,0x4fa18420},
+{0x022026c3,0x88e68d09},{0x02c130fb,0x20d4df1d},{0x0281d130,0x082a95da},{0x04e033ee,0x08f57c14},
+{0x02c1f083,0x3560b33f},{0x024111bf,0xeee84bfb},{0x04e1d8bf,0x4dca51fe},{0x0360321a,0xe59e8440},
+{0x01e16aa1,0xeecafb19},{0x05a0fd8e,0xf33c840d},{0x0401d54e,0x36896145},{0x02e1456b,0x7443b14b},
+{0x02800153,0x610ea47d},{0x03002edc,0x9c074f01},{0x02200305,0xffd203b5},{0x03a00fd7,0x752c8a14},
+{0x02603275,0xdf7c13db},{0x03201115,0x0d3cf77f},{0x02002600,0xfc75c21b},{0x028e0187,0xf167c039},
+{0x02010745,0x577c4844},{0x020013d7,0xeff1e50e},{0x03402092,0x1ecc15ae},{0x034122b1,0xadc171ac},
+{0x02200e19,0xeaa3a3f0},{0x02a11d55,0x13737071},{0x03a02c28,0xa152e4e9},{0x02e145fd,0xecfbd326},
+{0x02202730,0x53b7fe61},{0x04413432,0x5ab85408},{0x05010156,0x9e4c0102},{0x02c13255,0x84adc141},
+{0x02000a06,0xea026681},{0x02000d05,0x4236af7f},{0x02410910,0xfba2d988},{0x03e122d8,0x552691fd},
+{0x02000e96,0xf8c7a537},{0x02c16b36,0x3506b4aa},{0x0261b07e,0x67e08069},{0x01e0172d,0x8e7e3dd4},
+{0x024169d5,0x016f5262},{0x03c12424,0x4fc76a17},{0x02202ce9,0x7c5766c8},{0x01e00635,0xa57eb04b},
+{0x02e14405,0xae788d1e},{0x03e18c54,0x099881ce},{0x02c1312b,0x6f209067},{0x02418991,0xb3cb40c7},
+{0x0380fea5,0x254bf16e},{0x0421d231,0xc377e730},{0x030028b7,0xf5052ee9},{0x02200d15,0x762f7034},
+{0x01e16f99,0x70986029},{0x02416f51,0x22556646},{0x024001cc,0xee7ee448},{0x02a1043f,0x6ea68b33},
+{0x01e0241b,0xb16207e7},{0x01c0aab3,0x364bb3d8},{0x02a04dfa,0x356ab92f},{0x020031bd,0xd1814baa},
+{0x03a02cdf,0x6c4bc1f2},{0x01611141,0x88d9c1d8},{0x0400273c,0xc5fa8aab},{0x04c001ec,0x17ace88a},
+{0x02e13233,0xc76eaf7c},{0x01e10719,0x866cae07},{0x04e0fc2c,0x020d6cf4},{0x02e00287,0x79799d16},
+{0x01e1145a,0xbd908710},{0x0361e89f,0x0c1c0c32},{0x024019d0,0x3a18a870},{0x02a01567,0xe98ad3b6},
+{0x02012224,0xe8f7cd72},{0x01c0a178,0x6e1907fa},{0x02c13168,0x3fbe59cf},{0x05a02b99,0x339a8aa4},
+{0x03016880,0x5d93592e},{0x03611ab2,0x75294efd},{0x02801a28,0x0c3d7c07},{0x01e10674,0x3e28b1a0},
+{0x07602963,0x523561e0},{0x02c1d41b,0xd797e2d1},{0x02c13086,0x3c212fea},{0x02e00320,0x67db3e6f},
+{0x01e01704,0x94264368},{0x044121bf,0x529baf51},{0x0341d104,0x78cc5dab},{0x02c16997,0x90396d3a},
+{0x02602733,0xb2ec45b8},{0x0380256f,0xcb79a238},{0x01e11066,0x43971f5d},{0x03014595,0x663a25f6},
+{0x0260132d,0xa69c941a},{0x03800168,0x3c9d6de0},{0x02a116b9,0xf58afe2b},{0x0301f052,0x769fbde2},
+{0x0240a892,0x0a03858f},{0x03e01f38,0xdd7176a9},{0x034015d1,0xf1791f46},{0x01202691,0x7a54c0be},
+{0x0101f5b4,0xf3977951},{0x02c10d02,0x6f2a6058},{0x01e0098a,0xcf6d03f3},{0x0421d623,0x38b1d3ac},
+{0x036029b3,0x5a0e4bae},{0x0301d4bd,0x41a127ef},{0x0200136a,0x09080321},{0x03216b76,0x1063d53c},
+{0x01c0a276,0xecf6ee4b},{0x03003170,0x86ab034c},{0x02001175,0xd32b984b},{0x01e01684,0x1b7ea05e},
+{0x020102bb,0x5af87b77},{0x0361cf25,0xfe2ecbb6},{0x0520fd11,0xdce0ff93},{0x02211c1f,0x204bd355},
+{0x0260a775,0xf8d92e24},{0x0301058f,0x79622449},{0x02a1f394,0x122cf4d5},{0x02400805,0xc3be0c5f},
+{0x02418ad3,0xe91b8e0a},{0x03e01e7e,0x891c1a27},{0x01a0a0a1,0xed95ed49},{0x00c1f5b5,0xf09c2391},
+{0x01a0a114,0xfe7ca784},{0x03001c7e,0x0f8ac4a3},{0x02e133da,0x7ff3c0cc},{0x0101f994,0xac98111c},
+{0x01c116c4,0x9b7289ab},{0x01a0a546,0x172037e5},{0x0180a4be,0x9f194dc1},{0x022104a7,0x8ce8c5e9},
+{0x0481cf1b,0xaf6e9525},{0x02c13354,0xdabeaf9b},{0x0201218f,0x6c6010f2},{0x0361e891,0x36f799e7},
+{0x03210cc7,0x5e9a7dab},{0x02e133ec,0xfa733850},{0x0381ecb1,0xa5f52804},{0x01c0266f,0x5a4d39b1},
+{0x01e1e2d9,0xbae98c0b},{0x02810ae2,0x0c95609c},{0x02c119df,0x7931d2e9},{0x01a1e951,0x850f65d9},
+{0x00e1f436,0x6d57a8f0},{0x0320a837,0xe5257e7b},{0x0260105a,0x99c46300},{0x01c1e2d3,0xd7467002},
+{0x0381e876,0xf902014c},{0x02418a43,0x47477eaa},{0x02602f94,0xc5c43a33},{0x022032e4,0x7b1504b4},
+{0x03211a04,0x04397c29},{0x01a0a55e,0xc3238540},{0x022032d9,0x3107c443},{0x03c1f72b,0x02a556f6},
+{0x01a01bd4,0xf2bd6d22},{0x02601075,0x0fa19700},{0x02601225,0x3ff72fac},{0x02e010a4,0xb171f356},
+{0x048008d2,0xb5cf915c},{0x05810782,0x4906d067},{0x01a02103,0x62953bf7},{0x02c168c4,0x0b26b632},
+{0x01c0a2f9,0xaf8f5143},{0x0160a4b8,0x49c6cb69},{0x03e1fb9e,0xbbef3fcf},{0x026119a3,0x13913c97},
+{0x02c132f6,0x5f458d6a},{0x02418898,0x8ae0f00e},{0x0201bc29,0x51d9cd2e},{0x0300ffeb,0xaf487e96},
+{0x022027ce,0xab03b0e2},{0x02e101f4,0x06d5d2c4},{0x03e0fdf3,0x8d4dbd74},{0x02c1004a,0x77c35da5},
+{0x01e0263e,0x10f648b2},{0x01a0fe52,0x0b27cc11},{0x03a01e6b,0xe91ce218},{0x02610870,0xea92cb45},
+{0x02a16937,0x0feeaaf0},{0x0140221f,0xf2033038},{0x01a01bce,0x0eae8eac},{0x01e11642,0x5f538fa5},
+{0x02c130eb,0x15d28f35},{0x02010e87,0x1954e9e8},{0x01e11585,0xd9623333},{0x02e11036,0xb78bd755},
+{0x01c1e2d7,0xbf3d4fde},{0x0301d6e1,0x1ab63461},{0x00c1f934,0xd7083b68},{0x01e1fa79,0x969e83d8},
+{0x03001dc8,0x3fe950ef},{0x02402ed5,0x37366cc6},{0x02e14599,0xe139cf86},{0x00e1f97c,0x31fd8beb},
+{0x02410f14,0x96439c9a},{0x03e18bdd,0xe8db4bc4},{0x02e0205f,0xcc927a80},{0x03c1f1fc,0x9c2426c6},
+{0x01e11ee3,0x468cefec},{0x01a0055d,0x7de6af99},{0x03e02b8b,0x3bbfce93},{0x03201435,0x2501a8e6},
+{0x02211145,0x12f9c2d2},{0x04e1f780,0x8db8b883},{0x02002f02,0xbd601b4c},{0x034026af,0xb02a1dde},
+{0x0221bc35,0x38333088},{0x0261b0fa,0x9aea73e3},{0x0281f003,0x516d2e8a},{0x04002aa3,0x5cf1805e},
+{0x03602a99,0x63e7c764},{0x020017b8,0x58c1ad6c},{0x018031de,0x92aa0aea},{0x02a110cd,0xe8b6cf18},
+{0x03202a1e,0xcf4eb6cd},{0x01c1f5e5,0x89191f27},{0x0560fdb5,0x1f43dfb3},{0x0181170d,0xd8154c39},
+{0x01a01962,0xdda4fcd3},{0x02a110d7,0x3f9e213d},{0x0360fb65,0xfe1bcb5d},{0x026114c0,0x5a8125f6},
+{0x02601a96,0xdb3e708a},{0x03800160,0xe723bb37},{0x0301d8f5,0xed97569d},{0x02c130d7,0x0ece0702},
+{0x0280198c,0x9a33dca1},{0x0281f304,0x99bb6f3a},{0x01a102a2,0xc7f0ba3d},{0x02610ac7,0xb6b7ea8d},
+{0x01e1101c,0xd0fb7d12},{0x0341d21a,0x7d43c389},{0x0121f4bc,0xdc3cb8a3},{0x0261fa67,0x7bc4cc95},
+{0x02010f34,0xd684624d},{0x02410361,0x7af6702b},{0x02616949,0xd8753418},{0x01c0a268,0xf7e133c7},
+{0x02a019ab,0xd786f7b4},{0x020009f2,0xe48c7e2b},{0x026e0130,0x18a3f2c6},{0x01c0a104,0x9322a8f9},
+{0x02211c29,0xd05edd1d},{0x03610553,0x14ad3530},{0x028101e8,0x2b9fbcd8},{0x028012c2,0x1117b7df},
+{0x01a00b24,0xab90ccda},{0x02e102f2,0x407783d4},{0x018025cc,0x0e26aa31},{0x0260d7bf,0x1f9fb052},
+{0x02611d64,0x4fe8331d},{0x02c00859,0x1992a3a5},{0x02000a39,0xddf10a7c},{0x03202c5a,0xe787d059},
+{0x01c0a2d8,0xce16652e},{0x0741d9bc,0x41c40b42},{0x02e12387,0xf26a4815},{0x02e132fb,0x0d741a8d},
+{0x0141f90e,0xf68da7c5},{0x0321d7d2,0x89535023},{0x02e144e4,0x8ea72bcd},{0x03a00118,0x8e6e86e9},
+{0x0360163f,0x24e07f4b},{0x02c0317a,0x7004b02a},{0x0580fd60,0x4e9bfc32},{0x01e00e9f,0x9f768497},
+{0x0361689f,0x8581713d},{0x01e1f385,0x74ade975},{0x0320fe92,0xb132aec2},{0x01e0fe5f,0x3091019c},
+{0x01a16f3d,0xe62d694a},{0x03211a03,0xf43962f9},{0x02418a84,0xc2a478ec},{0x0261e93f,0xaf40ac45},
+{0x03c1f234,0x8eb530e4},{0x01c1050d,0xf60bc190},{0x0261b0ad,0x1f6427e7},{0x02800947,0x400a5084},
+{0x03610163,0x9fa7149d},{0x02202fac,0xd344a137},{0x05a0fc4f,0x7059712f},{0x03a00241,0x945cbf68},
+{0x0401f126,0x132ff9c0},{0x0301248e,0xbfb2f32e},{0x03a1d595,0xf1918cc8},{0x02211ef3,0x2e3344f4},
+{0x02418a87,0xc7a480cb},{0x0301d322,0x2af4eb52},{0x04612514,0x4da89621},{0x0280aa9f,0xf4c5b0a2},
+{0x01e16f41,0x804ee802},{0x0401245a,0xfb888200},{0x0301d4ca,0x34a11378},{0x0281fb82,0x0283b218},
+{0x0340160d,0x1f38c05a},{0x02418a2a,0xb03fd530},{0x02211c2d,0x302b98da},{0x02818d04,0xecd1572e},
+{0x02e16e7b,0x62d4524a},{0x0301d18c,0xbb487b0b},{0x0200a90b,0x7afd8b0c},{0x0380103e,0xb05296b3},
+{0x0201222b,0x42e4d368},{0x03a1df11,0xe8c52941},{0x010020be,0x5b92a772},{0x02401a03,0x01d3be02},
+{0x02200a9f,0xe0ea42a1},{0x03210ccd,0x5f9a7f3e},{0x02e01bda,0x131a44ce},{0x01c00c2a,0x0c5e98e6},
+{0x0680087b,0x581ebf69},{0x01c0a21a,0x109b8bb4},{0x0421d622,0x3bb1d865},{0x02c028b2,0x5327637f},
+{0x02a028a1,0x4d2078d5},{0x01a1e2dc,0xbd9e6156},{0x0261b0e9,0xed7a0a60},{0x03001d4a,0xfb924f1b},
+{0x02e1451f,0x8cb3f49a},{0x024115af,0x79997d79},{0x02418979,0xaf8d2b37},{0x02802806,0x1090001f},
+{0x06c00774,0x979e56b5},{0x02c13330,0xfe0f8a2e},{0x01c1f3ad,0xfa5faf18},{0x042121ca,0xc7a65707},
+{0x026111c1,0xa52fa887},{0x0601d82d,0xdcae6478},{0x02c1328c,0x78ab6fc6},{0x0480274a,0x62791128},
+{0x03610a52,0x494f2f14},{0x0621fb68,0xdd34e38b},{0x028104c8,0x80d00911},{0x02a168e7,0x527baf89},
+{0x02c02895,0xb9cf1365},{0x0300287e,0xf1e3563b},{0x03011ca9,0x02d07dd8},{0x0341e8ba,0xd66460cf},
+{0x01e00f47,0xf5645ef3},{0x02610116,0x62a39bc9},{0x0061f404,0x3a67f370},{0x028104f1,0xe8eb2f2f},
+{0x02e109ab,0xadaceeed},{0x030121ff,0x2a1f6eaa},{0x020010d0,0x1a7483f4},{0x02002f32,0xce597a4a},
+{0x03000f76,0x9a2b404f},{0x03a01e03,0x54f95846},{0x02401355,0x051cc697},{0x02c10d09,0xdb06e51a},
+{0x012114c7,0xf3f91d0c},{0x03e18b62,0x9dcac264},{0x0280aae8,0xf6a0af0c},{0x03e18cb9,0x8589dd4a},
+{0x03000c5d,0x0944c98a},{0x0260aaa3,0x046f71c9},{0x0101f368,0x087a1e3e},{0x0361226b,0x4dc8d4e6},
+{0x02e14491,0xa30a9cdd},{0x03c1f1ec,0xac243ff6},{0x02a003a7,0x72a3b379},{0x02c1217c,0xa03ef8ad},
+{0x030118ce,0x3dc7c1c5},{0x0300269f,0xa375e3a5},{0x01c11032,0x6a828646},{0x02c105ad,0xcb312eec},
+{0x03c1d4d3,0x2ee96db1},{0x01e1f947,0x2bcd192b},{0x014026bf,0x0765509d},{0x01c0a343,0xd5965068},
+{0x02211c27,0x2c439774},{0x02a1f545,0x8351d953},{0x0441d810,0x5f9d9923},{0x01002123,0x580a191c},
+{0x028118e8,0x4f597fdc},{0x0501d850,0xb458bedc},{0x01e00855,0xbbb598bd},{0x03200961,0xb4489f1c},
+{0x02a00259,0x9dca2c92},{0x02e1305e,0xa7386b29},{0x03e02af4,0x67fa04f5},{0x02c13026,0xfd24a022},
+{0x0301f703,0xd9be3455},{0x0220a903,0x8dfaeacd},{0x01c0a0dc,0x04e5e64c},{0x01e11308,0x12c6d81c},
+{0x0221030b,0xa943bbaf},{0x0181f16a,0x411cea50},{0x0400ab3b,0xf5c4cee5},{0x0280035d,0x8f3a0106},
+{0x02601304,0xce6503f4},{0x02c10e78,0xbb80e62c},{0x0340a7be,0x751146ff},{0x04202b70,0x765c77d1},
+{0x026008e9,0x2cc8a52d},{0x0241038f,0x19ad3076},{0x01c0a475,0x3c817a04},{0x0340a642,0xabdb77bc},
+{0x00a02604,0x6d77b66f},{0x03e02674,0x52c19afb},{0x03a12271,0x11d97497},{0x03216b2a,0x6717b528},
+{0x0241891a,0x8d276586},{0x01e16a88,0x8bd856dd},{0x01e00722,0x08674249},{0x0580fc5e,0xa06496ff},
+{0x064115ce,0xae88b60b},{0x03400f1f,0x7c282209},{0x03202273,0xa3267db6},{0x01e025e0,0xd995bea2},
+{0x0381e108,0x06905e7f},{0x01e0a58d,0xd43b0fb1},{0x01a0a3d5,0x36559d36},{0x022032f9,0x171ef4a4},
+{0x028e01b6,0x7e5e10d4},{0x02e02947,0xdcf0387a},{0x032100ea,0x506b02b4},{0x022009ed,0x22492ba7},
+{0x01a0a04d,0xddb02924},{0x02418a8c,0x58a19377},{0x02e0028a,0x3af016d2},{0x01402305,0x5ab89bd4},
+{0x01a0a31b,0x939b6c1d},{0x04001ec8,0x2bc4ef52},{0x03e0fdf2,0x8d342ae3},{0x0641d827,0x8763207b},
+{0x0640fc99,0x8700d18e},{0x02e1461b,0x67dc411c},{0x0380166c,0xdcb69498},{0x0361f765,0x758c6cda},
+{0x0381e89b,0x8f3d9a9d},{0x0141f39e,0xbb5e6b49},{0x00a00020,0x1808f0e5},{0x03a1ee2d,0x6b5099b1},
+{0x02800e37,0x9ffe970c},{0x020031b0,0xbb903392},{0x03e1d57f,0x75f51601},{0x0180a492,0x3a2747d5},
+{0x0400013f,0xba6c19fb},{0x02402edf,0xdd41c11f},{0x01c0a3a0,0x4a88bada},{0x0341f903,0x4382c835},
+{0x02418936,0x227ed5b6},{0x02c1309d,0x3c25ad18},{0x02a1ed02,0x04b2b56b},{0x0061fab0,0x42cbdec2},
+{0x03a1d58a,0xe6917b77},{0x03400f9d,0xe567f87a},{0x03e18b4a,0xc4c6829b},{0x01e10735,0xfb766092},
+{0x02e1f9b3,0x194e4c89},{0x02c01d34,0xaee7f168},{0x02e14556,0xe83e57b9},{0x01816a43,0xd2fdc9b8},
+{0x02a00e46,0x0558f226},{0x0541d829,0x41281380},{0x0141f41e,0x010f1876},{0x03e1f521,0x01d173a0},
+{0x02411342,0x636e3dd4},{0x028e01b5,0x7f5e1267},{0x0241882d,0xec8971b3},{0x03a0d7fb,0x6becffe8},
+{0x02e0fbda,0xc15a55fd},{0x01e00c25,0x8e37550c},{0x01a0a08d,0x7d6bbefa},{0x0341d1b0,0xfa684a21},
+{0x02401302,0xc4e647dd},{0x03e18cad,0x188d034a},{0x04001d86,0xdde0780f},{0x02e1034a,0x1e793fe1},
+{0x02000654,0x0ecb1789},{0x0301440a,0x4f621ae4},{0x01c1f684,0x48e4f0aa},{0x020013ac,0x98f39ab0},
+{0x0580fcf7,0x5a95d4c1},{0x01e10e89,0xb43af934},{0x02e13223,0xd170fdd1},{0x02e14493,0xa10a99b7},
+{0x0200a605,0xe96ac6fe},{0x0241033d,0x8c4c4192},{0x0361e858,0x0b5e7317},{0x02e028d6,0xa624ebc9},
+{0x028e0179,0x836d233d},{0x03c01569,0x5cb1b537},{0x02801213,0x7038380e},{0x0401d221,0x0041b3d6},
+{0x0220066a,0xa8f21a23},{0x03802fab,0x080ddd99},{0x03a004d1,0xf21cc948},{0x02418afa,0x6c11cee7},
+{0x046008c3,0x523ca4a7},{0x03a001c4,0xabb82768},{0x02e13379,0x9aee8454},{0x03c027f2,0xd0174149},
+{0x02a105ab,0x9405d807},{0x05200871,0x492adba4},{0x0300a77c,0x81178074},{0x02411c63,0x7d5a456e},
+{0x00e00edc,0x9cecb0a9},{0x02c00957,0x477d10c2},{0x03011ca1,0x3ab2c0ec},{0x0360aa7e,0xd9128235},
+{0x03014571,0x548351d7},{0x03c01ee7,0x3d957401},{0x0481ecb3,0x2e3e3c51},{0x03010583,0x0eb680c1},
+{0x0321d6ca,0x80586d5e},{0x0280fb27,0xe8dc02e3},{0x00a002d8,0xf9118dd5},{0x01e0a840,0x64066385},
+{0x04c021fa,0xf29a7203},{0x01a1fb00,0x32a7d1b2},{0x0621d8e4,0x46e876fa},{0x03a1ed1c,0xa9990ecf},
+{0x0300fed6,0xf3c207ef},{0x02e13390,0x0154b511},{0x02e130b2,0x267b6efb},{0x02202639,0x8b29036b},
+{0x04a1d784,0xea0ebfbb},{0x03a01b40,0x5fe6ce06},{0x03403223,0x33b97cb4},{0x0240121a,0x24ed9ac2},
+{0x02401a3b,0x6fd231d0},{0x0361f770,0xd4e7cdc7},{0x0241d30c,0x6f61d461},{0x02418a3d,0x453aaf91},
+{0x0180a40a,0x4483cbd3},{0x032017aa,0x7979e8a0},{0x02c131c7,0x56faa61a},{0x024189ad,0x9bcd5996},
+{0x01e1132f,0xfaedc1c4},{0x0441d8dd,0x940cc2d3},{0x02000f41,0x47f91e60},{0x06602ff2,0x5a4246b9},
+{0x04e02d6f,0x27fd1fe8},{0x03201b4b,0xb50e1c5a},{0x03a0024b,0x95be1d5e},{0x0260004f,0x6b1523bc},
+{0x022031b2,0x3f4f7762},{0x0580fc43,0xedf065db},{0x0321d522,0x0ba17586},{0x02a11d12,0x5f839e9a},
+{0x02a10038,0x439dabe4},{0x02a01a79,0x1cb0c8aa},{0x010025ce,0x87d41a9e},{0x01e00f42,0xe1849322},
+{0x05c0fe12,0x62f13f52},{0x02000e86,0x71013f1f},{0x01a0a1e5,0x81ff0c5d},{0x032006eb,0x3c515a39},
+{0x0260aa95,0x045e28a8},{0x02000ab0,0x5f961edb},{0x01e1069a,0xbc327256},{0x0221082f,0xa1e08af2},
+{0x03c0a7f7,0x4d43aa19},{0x026119ab,0xd37d501f},{0x02611181,0x01223b3d},{0x0381f89f,0x4a9ee0a0},
+{0x0121f34d,0x84177e11},{0x01c03320,0x4c92f124},{0x03e02343,0x79108b4c},{0x02418807,0x727fb749},
+{0x02e13246,0x68747b3e},{0x03c0a965,0x9161d80f},{0x02c02f1e,0x9a70c37f},{0x02c1f0a6,0x04335976},
+{0x02611923,0x97a8dc5f},{0x0240aaa8,0x54a171ac},{0x0221005b,0x28b681dd},{0x02a02c98,0x51ab4993},
+{0x026e012e,0x1aa3f5ec},{0x01c00b1f,0xdbc2ff10},{0x02e144ae,0x9c0614aa},{0x01a01bd0,0x02b6ca8d},
+{0x01c0a254,0x5518fc47},{0x026124f8,0x523c38f4},{0x0181f568,0xd15ae022},{0x02a10446,0x0e12a2d4},
+{0x0361d02e,0xc14d08bf},{0x04c1f801,0xb60f458a},{0x01c16f61,0xb0f3122c},{0x034024c9,0x3d65d15f},
+{0x01802134,0x0e6f2a22},{0x01a1f392,0x3ae6ecd9},{0x02000ea0,0x50e84708},{0x02c0241f,0x2898addd},
+{0x0240079e,0x27f14c38},{0x01c102c9,0x270d750b},{0x0301f021,0xda149c5d},{0x02418870,0x02eaa752},
+{0x03c1d749,0xaae71a91},{0x02c132bf,0xf29b957b},{0x02010609,0x992fe466},{0x02001cd2,0x2958676d},
+{0x05c0fd6d,0xfd91cc4d},{0x02800d4c,0x718f9c0e},{0x02e131de,0xec6976d3},{0x0221080d,0xfbc54223},
+{0x038022e5,0xa42b978b},{0x03004dd3,0x1fc6c9fc},{0x032026d6,0xe425d50c},{0x0281f592,0xc329ad6e},
+{0x02601320,0xd0b1446f},{0x032122d1,0x6b5eac4f},{0x02418885,0x91e57841},{0x02c132e0,0xc84aafe3},
+{0x02001fc0,0x6ddd1ccc},{0x01c0a075,0xfb267b52},{0x018033b9,0xdf9c66f3},{0x04c0068b,0x4dfef08b},
+{0x02410334,0x1d6ba77f},{0x02e14418,0x207dbdc2},{0x02e02f18,0x7e9a4088},{0x00e1f965,0x35a9fafc},
+{0x02e1440e,0xb27ad201},{0x01e1066d,0x4728bfcb},{0x02210390,0x397f9724},{0x01a0a0f3,0xea0513c2},
+{0x02c13110,0xec14893b},{0x0301da2b,0x59ac17fe},{0x0460037b,0x212dc568},{0x030169a4,0x9e2c78a7},
+{0x06a0077d,0x4add6442},{0x01a00b35,0x7794f82c},{0x0281b021,0xa105c49d},{0x0580fc53,0x16c720c6},
+{0x0320ff87,0xec769b1b},{0x01a0aa54,0x4e527dd5},{0x07c1d9cb,0x97db99b9},{0x05e1fa3f,0x7c1d4cc1},
+{0x0361d697,0x3206daeb},{0x0361ec95,0xf14e1c5b},{0x01e1f9d0,0xd1f6a24b},{0x032121d8,0x08631229},
+{0x03401ddc,0x2a1b6551},{0x02c13024,0xfe24a1b5},{0x02012307,0x86e4c96c},{0x02202912,0x31111756},
+{0x0180a4e4,0x56c51f1b},{0x02400906,0x2c8963d5},{0x0260abd5,0x7237b404},{0x028119cb,0xf3661a0d},
+{0x02e1f67d,0xaacb35d9},{0x02400abf,0x8df493b1},{0x018031df,0x778f9cec},{0x02010617,0xaf2dc871},
+{0x020030f9,0x0cbc1b4a},{0x00c1f6e1,0xd1208570},{0x01e11c8b,0xe5627690},{0x054008a9,0x989d284b},
+{0x01811403,0x644edef6},{0x02c13062,0x099bcbdc},{0x01c0a423,0xcaf3d618},{0x01a1092c,0xa6bf73f7},
+{0x03a0fab0,0x216e3689},{0x02801087,0x5cfa11e9},{0x02c1f7b5,0x3ca32945},{0x05801f66,0x1917fa9a},
+{0x03001118,0x14632022},{0x0280fbb3,0x5a62675d},{0x02603025,0x1268b097},{0x0301f0ca,0xa41cb3b2},
+{0x02410f3f,0x6874c14f},{0x022111b4,0xa6c8b944},{0x02a168a7,0xb2026fc5},{0x01a00ed8,0xb403feef},
+{0x0181f383,0xdcc0bf11},{0x026e014a,0x9c88ec15},{0x0441fa0b,0x77fe34dc},{0x0300feba,0x0323dbdb},
+{0x0460fd1a,0x0a5e83a9},{0x02c0a66f,0x52939c46},{0x01e0a91c,0x1ebbc875},{0x02e122a5,0x979b522a},
+{0x0261b091,0x6daeed0f},{0x01e02421,0x9251aa5f},{0x02810597,0x402fa22c},{0x02a0a9af,0xe5e0c61b},
+{0x0260abf6,0xa8dd69ce},{0x054033f7,0xc8d71cea},{0x02610a27,0xd78a0161},{0x0081f6aa,0xcb1194a9},
+{0x0101f33a,0x3bed58b5},{0x03c00389,0x4f62213a},{0x0401d539,0x41897296},{0x0340010f,0x11e2abdb},
+{0x046122d5,0x30f42272},{0x02401bb5,0x39d0d8b0},{0x0061f47f,0xd6c153c1},{0x04001d75,0x68983975},
+{0x0280204c,0xb1844830},{0x0320ff98,0xd0a80bd3},{0x02c132ec,0x5d434bad},{0x0201f399,0xb2371a5b},
+{0x03a1ec9a,0x96b6eafb},{0x05c02ba2,0xe551e124},{0x026e012c,0x1ca3f912},{0x03801506,0xc0a6cce5},
+{0x02010ff5,0xfdfb4b83},{0x02a0078f,0x2efacd9c},{0x0201f39f,0xb50d57a3},{0x04016803,0x94ed7375},
+{0x04001c92,0x455c39e1},{0x01a0a53b,0xd2e9b2df},{0x01e01c1e,0x515d5b63},{0x0200071a,0x416cb3c3},
+{0x0240a8a8,0xfdf2298a},{0x02c131d6,0x56fce4b1},{0x02c13268,0xf1b0ab6f},{0x03c1f22b,0xdf31832b},
+{0x02c1da7d,0xcc20f219},{0x01a0a615,0xe63d1ebb},{0x02811d01,0x0da505b2},{0x03202e0a,0x6453d576},
+{0x0400fb1f,0xe37b20b1},{0x02801999,0x25e98453},{0x01a10928,0xa2bf6dab},{0x02e130da,0xdd5a634b},
+{0x01e1e2e2,0x831b4963},{0x02e131c0,0x8c8781ed},{0x03e01c86,0x95cfed98},{0x0141f198,0x9c824bc9},
+{0x030027e1,0x081120b4},{0x02010385,0x1864daee},{0x02210050,0xa3cd09cd},{0x0201047e,0x0e778011},
+{0x02816860,0x91373785},{0x0301f053,0x759fbc4f},{0x00c1f3ab,0x7fd3e065},{0x02a00948,0xf5332fe3},
+{0x04a0fca6,0x24428db5},{0x02802e2e,0xf900a0f2},{0x04e0276d,0xe6e5a263},{0x03a1d056,0x4af4695e},
+{0x022032e2,0x5b23dcde},{0x0201110a,0xefea6ffd},{0x026100af,0x5f4efe6a},{0x01a0a2ae,0xfa4fdb15},
+{0x03e18caf,0x168d0024},{0x04410ced,0x6c47f751},{0x030021ae,0xebbca827},{0x036006f6,0x3697b2a6},
+{0x0161f575,0xf0ab10c9},{0x00c1fa73,0x4cf07612},{0x02011167,0x32a2b249},{0x0101f190,0x9a995bc4},
+{0x042000ce,0x0f37dea0},{0x0561f824,0x0eea9c02},{0x020009df,0x11275b1e},{0x0680077c,0x8ea8c3ae},
+{0x02c00436,0xfc505654},{0x02611ae6,0xda09d6d7},{0x02a16934,0x87fd4702},{0x0301d464,0xbdca24d5},
+{0x0261192b,0x04452667},{0x0261d1d5,0x0b888645},{0x02201b8e,0x6cc49103},{0x03602a6b,0x6d48d59f},
+{0x0181faf3,0xb7352d98},{0x02402f1d,0x74de4180},{0x0381cf38,0x0442bead},{0x01e10b20,0xe525b234},
+{0x02418859,0xe4691170},{0x03801fe5,0x1b65b079},{0x01c033ae,0x06c862c8},{0x01e10b19,0x895240fe},
+{0x0361d895,0x1677ace4},{0x01a0a0b3,0xcbaa004c},{0x00c02105,0x021a612d},{0x03402ec9,0xf8f1f08a},
+{0x02c1300b,0x831d244f},{0x02c02d05,0xd675bd67},{0x026110e2,0xd0592b86},{0x01a0a2cd,0xf628c559},
+{0x02c01394,0xa0c922a1},{0x01e02e9e,0xc60ff381},{0x01e112a0,0x21793079},{0x0360a7d3,0x19a6cd32},
+{0x02e1307e,0xbbb2bb78},{0x02c118f2,0x94dc9a66},{0x0261b0c6,0xd4cbf94c},{0x02010e92,0xa6375811},
+{0x02001040,0x26775fab},{0x02601542,0xfcb581cd},{0x02c130fc,0x1fd4dd8a},{0x02c1e902,0xee03a9cf},
+{0x0221f18d,0x80714397},{0x02a018b9,0xaae1bb24},{0x03a1d5b4,0x617bc77c},{0x0500278e,0xcc02ec64},
+{0x0320fb3b,0x27cfb3d4},{0x01a00b32,0x3bcc46b2},{0x01a1f396,0x36168e35},{0x0460d7f4,0x6cdf15ba},
+{0x02e025b2,0x0d020da7},{0x02418a7a,0xc2a6b783},{0x01e00f5d,0xc1ad0332},{0x042022f2,0x21dd5fdc},
+{0x01e0a8ce,0x4e9e9ae5},{0x02e12133,0x3d3ae8f3},{0x02a00432,0x05b9792e},{0x0580fdc4,0x903d8377},
+{0x02c0301a,0xafce2f3e},{0x02e11a29,0xdf3f1740},{0x024108eb,0xb56663b6},{0x02e0026f,0x72799211},
+{0x0320fb4a,0x6088f7a5},{0x0201bc5d,0x7dcd467f},{0x01a10280,0x11ee2cb4},{0x0260144c,0x18a6a357},
+{0x024189b6,0xa4cd67c1},{0x01c16a84,0x9dec94f2},{0x06000752,0xc06ea21f},{0x01a10e63,0x7c5da303},
+{0x02a10026,0x90d9cef9},{0x01a0a22c,0xb8f952c4},{0x01c1230b,0x7735e5b3},{0x0200169b,0x28e8b077},
+{0x026100b1,0x514ee860},{0x02a01cf2,0x6d782efa},{0x01801741,0xbcd230cc},{0x01c0a5f4,0x44383bd2},
+{0x01a0a457,0x8731e327},{0x02e1449a,0x9b0a9045},{0x02401282,0xd908f99b},{0x0300325d,0x6339ca72},
+{0x0181f322,0x4afba096},{0x01c0a2de,0xce075aa4},{0x01a02015,0xc8588c66},{0x02c13123,0x690f3dd4},
+{0x02e14601,0xf9fbe79d},{0x05403369,0xa8e83646},{0x02418ac1,0xd716f486},{0x02e1323c,0x66723981},
+{0x03a00321,0x52b9a8a4},{0x0260a8b3,0x74bf6902},{0x0381d6af,0x0c6eac82},{0x0320fb67,0xb1e31e8a},
+{0x02012073,0x34f4515b},{0x02a10019,0xa0c0fa13},{0x03400fce,0x0e72de67},{0x0240a883,0x25f4a719},
+{0x00a1f45b,0x47733620},{0x02e11a2b,0x37f338d7},{0x0341d6da,0x6c9966c4},{0x02601beb,0x872305fe},
+{0x01c1f7a4,0xd71f2b5a},{0x01e12072,0x5ffd6e5b},{0x02c00c81,0xfbd7c09d},{0x07a01f9e,0xf4cf7651},
+{0x04e02ad8,0xa9ea4b5d},{0x03e18c7f,0x5792ec6a},{0x01e0084e,0xb4b58db8},{0x0241f3d4,0x8bae3200},
+{0x02e02c91,0xf96ab318},{0x01c01c08,0x18267379},{0x01c1e2d1,0x8f297c96},{0x02a021ca,0x1112c66f},
+{0x02a018c1,0xb9f8aa39},{0x04602a35,0x0d4c664c},{0x02c13087,0x3d21317d},{0x01a0a608,0x1b203e31},
+{0x01c0a057,0xc2ff13ba},{0x03e121ce,0x5a687902},{0x02e008e2,0x9f907180},{0x01e102c6,0xed392db8},
+{0x0341d436,0x34b2bbdc},{0x0180a288,0xa488e021},{0x052033fe,0x2aa20bb9},{0x02e01d2d,0x780f4dd2},
+{0x0300a675,0xb0f43fe3},{0x06201fa9,0x15e98633},{0x01e1fb12,0x98ac40ef},{0x0301f057,0x931a37ab},
+{0x0261f58c,0xe87edbe3},{0x03412492,0x76b98410},{0x03802289,0xccec2e4b},{0x01e11593,0xc134edcd},
+{0x04001c97,0xc6c82248},{0x0260ab15,0x12737aed},{0x0261f201,0xc230c184},{0x03c0a656,0x0337f3f6},
+{0x02c131ff,0xf37a61e3},{0x01e1148f,0x5f624a54},{0x020115a3,0x0bc02718},{0x01e1101f,0x3b5f41d9},
+{0x02c10d0c,0xa324a206},{0x02001009,0xc4accd30},{0x01a10922,0x9ebf675f},{0x05412448,0xca1dcd87},
+{0x022022de,0x56988884},{0x02c1f0b6,0xb383ecfd},{0x02812fc9,0x1ef4acb5},{0x02e0a697,0x9636b9c8},
+{0x02816e80,0xb197ebe8},{0x04c02904,0x69563482},{0x0241fae3,0x60a048fa},{0x01e03116,0x95fa1bee},
+{0x03c002e5,0x884fb5a7},{0x01803164,0xe77e8982},{0x0261b0d8,0xebbd12f7},{0x01e0a5b5,0x994a0cb4},
+{0x03e02362,0xc04033bf},{0x0200305e,0xae4040ad},{0x0280211d,0x36da67f2},{0x02418973,0xa98d21c5},
+{0x01c1141d,0xc31f4753},{0x020030f7,0x08bc14fe},{0x0401fae2,0xd07be6c7},{0x02e124bb,0xa4f58490},
+{0x01c0a181,0xde21e227},{0x026104ef,0x73cc22dd},{0x01c0a5c7,0xf2081ebb},{0x01c11013,0x3a6eb2fe},
+{0x0340a7c1,0x45884771},{0x03a0fa82,0x204cab79},{0x02c11589,0xbf686246},{0x02e00829,0xe61a002c},
+{0x03e1d5fa,0x7605c752},{0x01c1145e,0xc497a870},{0x02a12187,0x1f9a8cd5},{0x01a0a03d,0x2a928d47},
+{0x01a0a3d0,0x026455e4},{0x01a0a5f7,0xc7238b8c},{0x01e0a330,0x61dd65f5},{0x00c026d3,0x6dea213f},
+{0x01c11728,0xd8716321},{0x0540fc8e,0x05987a5c},{0x02e131be,0x8687787b},{0x0261f5bb,0x59340bbe},
+{0x03c01ebb,0xb7f76511},{0x0341cfa8,0x458c9a4f},{0x03016b3f,0xb3a429fe},{0x04e12461,0x343fd318},
+{0x02c1da7b,0xca20eef3},{0x02c13191,0x0e2c6d87},{0x02001972,0xaa0a2e16},{0x02210815,0xd1cb1033},
+{0x01802043,0x756016bd},{0x0360a74c,0x65f3feca},{0x028168f2,0xfd8adf38},{0x02a02870,0x01a74e84},
+{0x01c1f101,0xf96cede7},{0x03c02353,0x3bec5536},{0x02010386,0x58406ed5},{0x03816829,0x5378af7a},
+{0x02011499,0xd9860fd7},{0x02c02924,0xb25cda81},{0x01e016ab,0x6b2e7c82},{0x02201836,0x87ff8865},
+{0x02011110,0xbf07c5df},{0x0221f029,0x5bf8e1cc},{0x026124ee,0xd8980eb5},{0x02c1f073,0x4917f84f},
+{0x0261b058,0xc6f9dbad},{0x0341f760,0x9c6fb1ce},{0x0340ff41,0x08e0e068},{0x02a1100c,0x252be877},
+{0x03a12064,0x31a30837},{0x01e00c59,0xf4dcb97a},{0x0341f143,0xff011074},{0x024006ed,0x418a121e},
+{0x0341f139,0xe500e786},{0x03e00760,0x721e46a3},{0x03a1f73e,0xd8b2e9d3},{0x02a16b5b,0x9dc3d568},
+{0x0200308b,0x6454e6e7},{0x0340ff56,0xffe0d23d},{0x03000fb7,0xce94440a},{0x020103a7,0xb2faacc4},
+{0x0340feeb,0x11c8da8c},{0x02418953,0x3585af64},{0x02801861,0x3baed715},{0x05e01f99,0xd8882d58},
+{0x01e017b9,0x292496fd},{0x01a16a4e,0x61a5ea3f},{0x01800b13,0x66ee171a},{0x0480fbad,0xa6cbb71a},
+{0x01616a42,0xe73f7edf},{0x01e02310,0x4a82dfa5},{0x02402e8d,0xfb9deb9a},{0x02418856,0xeb6b5b0c},
+{0x05000878,0xe6c39f09},{0x0220100e,0x8217b5db},{0x02616b13,0xb6963fbe},{0x04401d92,0x217d1c59},
+{0x01e0213a,0x220c2d21},{0x02c003e4,0x2e3bc377},{0x0280a728,0x3a3a5585},{0x02a1cf56,0xb59663b4},
+{0x00e000ac,0xda1dcf57},{0x02a02ca8,0x4970a5d3},{0x01c0a93e,0xc94c47bd},{0x02210810,0xf5cd8776},
+{0x02e02373,0x8ead25be},{0x024012d9,0x090dc259},{0x02212142,0x5c4fb6a7},{0x02000a2e,0x21e4a995},
+{0x02418952,0x26835930},{0x03210c29,0x22cae758},{0x0261b0f4,0xafcc7fde},{0x02e14579,0x7741776d},
+{0x03e18cc3,0x7b878ef5},{0x0260223a,0x2807bc00},{0x01a0a2a2,0x8b702c62},{0x02e02a06,0xee617e1d},
+{0x01c023dc,0x3bdd9738},{0x01c0a328,0x93b97961},{0x02e021b8,0x3f3a1490},{0x04600f13,0x68c0c4c1},
+{0x0401d85e,0x753932c3},{0x01a007a8,0xa5103b7a},{0x0361d6ef,0xca50e45c},{0x0341d4a5,0xde7cae94},
+{0x0240a9d3,0x03763fdb},{0x01e12040,0x3c0c4039},{0x03c1d80b,0x6fc7feb0},{0x02601aa7,0x1a0aa406},
+{0x0280a812,0xfccca92f},{0x02a00856,0x5f04825a},{0x03602aef,0x95e39b4e},{0x02a0281c,0x9a917336},
+{0x0480fcee,0x4515d204},{0x03216875,0x25db356a},{0x04a1f883,0x1e1d4daf},{0x02a10fb0,0xf1385c86},
+{0x02202fb5,0xbc59f96b},{0x02c0a7f2,0xa9e7e989},{0x02c02d03,0x03057bd7},{0x02e13366,0x136ee4ec},
+{0x02c02d02,0x743c5fb0},{0x02c132ca,0x6a9880cc},{0x02e1f7bd,0xb93f67e9},{0x02e017a7,0xbc6c0e67},
+{0x01c11137,0x21d574e3},{0x03210401,0x9fbcc3f0},{0x03a02aba,0x9d57f2f1},{0x03a0fad0,0xa57c7ddf},
+{0x0640fbee,0x57696a76},{0x03a1f89d,0xdf19d873},{0x0220a99d,0xaee78ba3},{0x03001056,0xa77878f9},
+{0x0160a4b9,0x6fa6b390},{0x04013434,0x0c47dab9},{0x02c01a72,0x107e54dd},{0x02400ccc,0x09b97a7f},
+{0x01a102b4,0xcbf0c089},{0x0340320a,0x0c51ab3b},{0x01802086,0xacd69dfa},{0x010020b5,0xa31167ab},
+{0x02418a65,0x55ac1c1a},{0x03a02c0c,0x7c126180},{0x01a0a115,0xf27c94a0},{0x02e1d6ce,0xe8109b70},
+{0x02418935,0x237ed749},{0x020112b0,0x99d319b8},{0x02c13370,0x98c350ec},{0x01600ed1,0x363d0390},
+{0x02e1d136,0x0b5b0b16},{0x03e18bec,0x07ddbb28},{0x03402482,0x3b4e3255},{0x0261b099,0xf3e5d9fb},
+{0x01002712,0xb46584b5},{0x01c0a462,0x82a97a85},{0x03812177,0xfcd399d3},{0x0281b022,0xba02778f},
+{0x03a11a43,0xfeed52f0},{0x01e10e97,0xc35de0df},{0x0421d227,0x5872c191},{0x03e121bb,0xc709eab4},
+{0x0480a671,0x7feac718},{0x0360164d,0x7aabcfa1},{0x02e008b1,0xaf72ec40},{0x04e01f3a,0x926f1919},
+{0x01a0a3f0,0xbdf2acb2},{0x03a0fb7a,0x9e3bdbd8},{0x02812f98,0xa9fa04b4},{0x04a1d054,0x2a14100c},
+{0x04a0292b,0x592d045c},{0x0360040e,0xd30660d5},{0x02810435,0xa3ecd786},{0x0241899b,0x31c8358a},
+{0x02e1338c,0xfd54aec5},{0x028110d5,0x970df609},{0x03011a2e,0x12b3433c},{0x0120262c,0x3f4ad72f},
+{0x0161f4ab,0x1ad0bf85},{0x0381e8c4,0xcea84d1c},{0x02e13131,0xda37546b},{0x022032d5,0x3f07da4d},
+{0x02a01675,0xe00d45a4},{0x028018c4,0xcecdd109},{0x02a014c1,0x6b12b59f},{0x03402ee2,0x68441a4d},
+{0x02811d1b,0x717034bb},{0x00c0264a,0x6f295bce},{0x02811c3b,0xcd9e3920},{0x02a11d30,0x557e3c8d},
+{0x02802582,0xbe5b1087},{0x02802ddc,0xf445550a},{0x0520fc60,0xd4dc7386},{0x01c0a237,0x52499df3},
+{0x01e0a21f,0xaeaea7ab},{0x02401a74,0xbbdddf54},{0x03a1e121,0x504372d6},{0x02000c4a,0xc8477140},
+{0x02211acd,0x7ae55321},{0x02800269,0x376c4273},{0x03e120d0,0x2be588d0},{0x02418ab5,0xc597b1b2},
+{0x0281fa69,0x0e2fd692},{0x03801634,0x57529b2f},{0x01e1bc19,0xf867741c},{0x0501f800,0x4cf50b9a},
+{0x02c118c1,0x90de0a22},{0x03e18c64,0x8b957cdd},{0x02a11d1e,0x29358433},{0x00e1f406,0x7e0d3ba2},
+{0x03001fcf,0x235cc158},{0x03e0047a,0xa7520a13},{0x03200ce3,0x622d4bae},{0x03a0a978,0x0afc9176},
+{0x0401d538,0x40897103},{0x0341f136,0xf200fbfd},{0x0341f145,0x0101139a},{0x03a1e11f,0x0480a6cc},
+{0x020009ef,0xdac7a872},{0x02418ae1,0x631e8caf},{0x01e00caf,0x20f8cf25},{0x00a1f9cc,0x5f4c4a5c},
+{0x03a008a1,0xa3ceec64},{0x02418900,0x911a9fdf},{0x05602a84,0x93c9ea40},{0x0280138a,0x21bae899},
+{0x0440069b,0xd265e123},{0x01a0a1a0,0x9b993dca},{0x0181f634,0xd5d86fe1},{0x01e11a81,0x744a786d},
+{0x01a0a417,0xa4afe765},{0x01e106f5,0x2b9f9686},{0x02201c29,0x319dd522},{0x0260133e,0xb67d401e},
+{0x0421e137,0x6bc3dbe8},{0x0240a8a5,0x15fcdcae},{0x0360fb54,0x060c5a8d},{0x0421d5e8,0x4136b4cb},
+{0x020122e9,0x401a1a26},{0x028001a2,0x87479aaf},{0x03210a9b,0xf6a15c5e},{0x01e10102,0x173e4311},
+{0x01c0315b,0x552344c4},{0x01e11a6d,0x44798b12},{0x02801227,0x4b4d0d79},{0x02418aa1,0x519d0b44},
+{0x04e0255f,0x6cd8e97b},{0x02610a13,0x8ecf13b2},{0x02001a26,0x59e6363b},{0x03e18cbd,0x6a89b2c9},
+{0x02c0104d,0xbc835305},{0x05e1d821,0xb20641f3},{0x0261b05e,0xbe208377},{0x02402e91,0x483da2fc},
+{0x03411af2,0xcd0bd94b},{0x02a0aa71,0x228a3abd},{0x03a02c1d,0x09e938a3},{0x034015e9,0xf167d625},
+{0x02601312,0x14b7fd75},{0x02e145c3,0xef289c6f},{0x02a018cc,0xe8f096b1},{0x02e1d6cf,0xe02893be},
+{0x03600180,0xd577bc56},{0x03e01677,0x115f7e3c},{0x0361e805,0x3eb60b4a},{0x02802da4,0x88327da4},
+{0x03e18bfa,0xb1e1055d},{0x01a01785,0x1900444a},{0x03401d63,0x0bcbf7c5},{0x020031a1,0x9fa5cdcd},
+{0x01800b05,0x58ee0110},{0x02811d89,0x4279fb5e},{0x03e01ba1,0x06770545},{0x02a108ae,0x53b12352},
+{0x040109db,0x75cfd19d},{0x03e0a832,0x771f78c8},{0x02c132b0,0xfb9de23d},{0x01e11491,0x97448d68},
+{0x0461d611,0xd3a2d685},{0x024112bb,0xac54a811},{0x02812fc2,0x24f6f4be},{0x02200b55,0x0f4a8828},
+{0x022122c6,0x2ed3e595},{0x02c008cc,0xbe60a19c},{0x0621fb5e,0x2f391543},{0x02e1145f,0xa1828270},
+{0x0221081e,0x91d77766},{0x03c1f230,0x446a77ee},{0x024112ce,0x4ca98dd4},{0x04001c99,0x3eef797d},
+{0x01a0a040,0x0d7ed7e8},{0x03c1ec9d,0xbc0db913},{0x0301da47,0xd947677b},{0x03e03198,0x3a1fcbf7},
+{0x03402ee9,0xb979fdc3},{0x020104a0,0x54de3fae},{0x026100c0,0xd167b6c6},{0x0201fb1b,0x89bf02f0},
+{0x02211ac0,0x72ba6582},{0x02800660,0xf1b8084d},{0x03800f16,0xf91c70f7},{0x00602609,0x23285681},
+{0x0341f893,0x7eac0d03},{0x020122e4,0x521a367c},{0x01a0a007,0x73b4ed4b},{0x0321d11b,0xa84da2c5},
+{0x02a019e0,0x9b87318e},{0x02211294,0xf81b3868},{0x02c13101,0xd816a856},{0x02a031f2,0x2f4d4c16},
+{0x01a0a363,0xc14d42c3},{0x02a0a836,0x80d4ad3a},{0x0240116f,0x36fe80ed},{0x02a019a2,0x6939fb08},
+{0x0281044e,0xbded0074},{0x030111e7,0x7936ad42},{0x024012f5,0xb4fe3393},{0x03c0d7e7,0x25b8b0f5},
+{0x02211320,0x89b76951},{0x0581f503,0x02186d19},{0x0441d8ba,0x0d86d337},{0x03c1da58,0x32538dd3},
+{0x03812428,0xdd171587},{0x02c017f2,0xf9d96815},{0x01c0a405,0xebc76b96},{0x0601d9a9,0xb711b404},
+{0x03a1e11d,0xf678ead2},{0x02c011c0,0x94f43be7},{0x01e1f9e7,0x342c4d5a},{0x01c023e2,0x2452c947},
+{0x03401454,0xb3495f77},{0x01a0a2b9,0x066375b1},{0x02200c42,0xb1b82fa1},{0x02a02e27,0xdf07f003},
+{0x05801ec6,0xcc718aed},{0x01a02663,0xd80fac61},{0x02e02d1d,0xefdc3362},{0x020030e4,0x18b3df69},
+{0x01c0a607,0xd3103cb3},{0x02c13257,0x81adbc88},{0x03601611,0x50318b75},{0x01c0a5ad,0x8be1ca5b},
+{0x018029eb,0xef393c3e},{0x03800373,0xbcca4237},{0x02e02b18,0x1352e032},{0x026008e7,0xba39a021},
+{0x03201895,0xdd659b37},{0x02c021f2,0x546611e4},{0x02e027f1,0x73bc3116},{0x0361d5cf,0xdb9cabfc},
+{0x04610b3e,0x97793ee1},{0x0240a737,0xed87317a},{0x02216ad6,0x065d7880},{0x0280137a,0x7c4be8b2},
+{0x03401616,0xb131576b},{0x02c1f06a,0x0e14f934},{0x02e0325f,0x8618ec9a},{0x026101df,0xb16b0653},
+{0x0180a6a0,0x64d1c7dc},{0x0261b0fd,0x9dea789c},{0x0280ab01,0xd3e40157},{0x032025bb,0x9adea627},
+{0x01c0a2ac,0x31e4f0a4},{0x03600268,0xfa584fc3},{0x02c003f2,0xc169c2a1},{0x00e1f388,0xeb04397c},
+{0x01e1065c,0x4a2d41b2},{0x0581d838,0x308227cb},{0x04002948,0x46383263},{0x03610562,0x88821d0b},
+{0x04400889,0xce2a3b71},{0x00e1f4e6,0x1435e41b},{0x04201dde,0xaa329794},{0x01a02adf,0x3797267c},
+{0x00e1f997,0x4773f8b0},{0x02401286,0xdf09030d},{0x03e1cf62,0x1734a239},{0x01a10929,0xa7bf758a},
+{0x0320040f,0x27460951},{0x012020a1,0xcc7e253d},{0x03a01ecd,0x398a2c61},{0x046107b3,0x058a5d3d},
+{0x0381f868,0x9ceaddef},{0x01c0a0bc,0x7a9db62a},{0x01811423,0x2c5b52c1},{0x02800438,0x2e84b7ae},
+{0x01e11118,0xe2558dae},{0x028018c6,0x688e3e3e},{0x0341d713,0x25133b50},{0x04602522,0x21a2d678},
+{0x0401d156,0xaed7c509},{0x02a0207c,0x708cd9df},{0x02e10c38,0x7952e189},{0x026008ef,0xc4d802f0},
+{0x02c0abb3,0xdf354f50},{0x0320ab61,0x0a2bd3aa},{0x02c13057,0x37f134ee},{0x02400914,0x18894459},
+{0x01e01961,0x6642d814},{0x02e00911,0x019dc05d},{0x02210313,0x9f43abf1},{0x02c10570,0xbed83551},
+{0x03016888,0x41ea9569},{0x02e1459d,0xe639d765},{0x02200071,0x325775bb},{0x0301d452,0xabca087f},
+{0x02418a29,0xb13fd6c3},{0x0261b01c,0x5a63c3f7},{0x05012437,0x2aa164c2},{0x0180a4da,0x2adaa026},
+{0x016023da,0x3f0eb7c8},{0x02200f85,0x0c65d690},{0x01a0a110,0xf6949fd2},{0x03e18b0e,0xd8cf9c73},
+{0x02a105a8,0x7414b031},{0x02e12299,0x827f5a9e},{0x030028af,0x0e77b262},{0x030012a5,0x593bcc4c},
+{0x02e1f9b1,0x111c4c95},{0x00a02220,0x77b49978},{0x02a0a8c2,0x3da53533},{0x030010b1,0xa98190d1},
+{0x02800a82,0x30f79d24},{0x0361d719,0xf3fbe414},{0x02001003,0xd4c6a06a},{0x026e011b,0x25a8846b},
+{0x0261b0a1,0x0e50856c},{0x0220a884,0xffbfdcfa},{0x020017c3,0x38adf354},{0x034027bc,0x7a5fd95a},
+{0x01e16aa9,0x05418590},{0x02e16e78,0x6cd46208},{0x01c0a362,0xe79fda01},{0x0101f4c5,0x5711111f},
+{0x01e0a6c5,0x232e945b},{0x0340320e,0x28abf04b},{0x0240a8d6,0x617d07bc},{0x03602946,0xe3397bed},
+{0x028118e3,0xcdf830af},{0x0361cf5f,0x27fd7658},{0x032118a7,0x25b72cda},{0x018020b7,0x37fb9870},
+{0x028003a0,0x88aaf89e},{0x06e0087d,0x55ad8033},{0x02e1f0d8,0x11f76c38},{0x0300a9ea,0xa4cf9cd3},
+{0x02403131,0x76f10d3c},{0x03410133,0xd27b19c4},{0x02c0288b,0x23a14cd7},{0x028e019a,0x02635dce},
+{0x0380fb61,0xe97ac093},{0x01e01c04,0x17e6efa2},{0x02c16b40,0xa74bfa23},{0x036018a6,0x021623da},
+{0x04210b4b,0x8c39d1d8},{0x0361249e,0xbaabb1b4},{0x02016ac7,0xb3875f3f},{0x02402fa9,0xb4a88c46},
+{0x02812f9a,0xabfa07da},{0x03a0a71c,0xf50c9ec1},{0x0081f5e2,0x33513ae3},{0x04c01e1c,0xda68627d},
+{0x0260004e,0x6c15254f},{0x024122c0,0x7edcdcf5},{0x02611357,0xf201ef31},{0x01a0195f,0xf5f102e4},
+{0x03a01ba3,0x9fd517a2},{0x01c0a314,0x68695e00},{0x02c1f080,0x3060ab60},{0x02816b05,0x963be5f5},
+{0x03a11aa0,0x11d1a442},{0x02e14463,0x268f1055},{0x03000237,0xf8657f08},{0x02c131b8,0xc6f784d3},
+{0x0301d466,0xbfca27fb},{0x0341f146,0x0201152d},{0x03810984,0xa1e6a1da},{0x0240037a,0x8e82182b},
+{0x01a017e6,0x27cbf095},{0x05001f6a,0x0f1d31c7},{0x03a10379,0x7436f83d},{0x01c0a220,0xbb7cf0d1},
+{0x0520fd13,0xb262d372},{0x02610357,0x53e3d35e},{0x0221fa66,0x9c5d053b},{0x05000230,0x26fee5b3},
+{0x04801f35,0xac26cf93},{0x024019c8,0xbbfd65ab},{0x030144f7,0xaab49c67},{0x03011372,0xbd3d40b3},
+{0x02a12285,0x3fb6382a},{0x03810c8e,0x5438cb04},{0x01c00c13,0x165659df},{0x04001ce8,0x9dd5cff8},
+{0x01c0a937,0xe53d6947},{0x01a11650,0x77a5325d},{0x02211c52,0xbfa0ef6f},{0x0121f34a,0x797b292c},
+{0x01811804,0x5e83146f},{0x052033f4,0xe8019f22},{0x02616b16,0xaaa53764},{0x02e13405,0xa4de5147},
+{0x02400939,0x009ee4e0},{0x01c16f3e,0x789f0e0f},{0x02200a16,0x59eba947},{0x01e11c87,0x918f11f2},
+{0x02211ad0,0x56c943f8},{0x0221cfc1,0x2bcb9f35},{0x02816a2b,0xb7404054},{0x0260107b,0x87910ac7},
+{0x04c1d8b5,0x3620d281},{0x03e18b7f,0xbbcd3035},{0x0200307c,0x6e2c5435},{0x0441f185,0x5d45a685},
+{0x03e18bf2,0x9ee0e774},{0x02c133ba,0x9515e6ab},{0x030001c2,0xa6a98cb3},{0x0200099b,0x73bcb019},
+{0x02c10d06,0x9efb4db3},{0x02e1336d,0x007582c8},{0x0340fe9c,0x2bfaa6ee},{0x02803043,0x2ef55c50},
+{0x02c12173,0x9435eb6d},{0x02a1f0df,0xc61b43e7},{0x0600fefa,0xf4ae8f36},{0x04c0fc19,0x139a7dbc},
+{0x02c02847,0x188ff265},{0x0621d7a1,0x747e0264},{0x02e02395,0x701184c2},{0x0241f5ed,0x37109d04},
+{0x03010a72,0x6ec15f33},{0x028e01ce,0x93d2cc98},{0x01c1180e,0xd677cf22},{0x02a0abd3,0x3fc3adcd},
+{0x02a01446,0x1d74362b},{0x02a031f9,0x45138327},{0x01c01c1b,0x6811d6b1},{0x03c1d47d,0xdc22dee0},
+{0x02e1f314,0x8f192aff},{0x02c02d0e,0x892f0589},{0x0301042e,0x5ec5e769},{0x03e18b4b,0xc5c6842e},
+{0x028018b3,0x58361dfb},{0x03200f96,0xaa7276d5},{0x034002b4,0x1f518915},{0x03a0fa8a,0x0d4c8d90},
+{0x02a02986,0x1387aa1e},{0x02e00d7c,0x87f8a4cd},{0x0281d32b,0xef71854d},{0x02418a7c,0xc4a6baa9},
+{0x01e02764,0x6a191f11},{0x01c1029a,0x13e60dd2},{0x0361fb7e,0xf6056fc8},{0x0340fea0,0xc3578c04},
+{0x0320a79f,0xc928df92},{0x022112cd,0xbc8520f2},{0x0381f92f,0xde7ba747},{0x03c00485,0x6be0d377},
+{0x03e18b4d,0xc7c68754},{0x02002666,0xa170c539},{0x01c0a44a,0x028425cf},{0x02e01400,0x799ced80},
+{0x02401262,0xe4fa01f5},{0x01e16a97,0x079d0439},{0x01e16a89,0x92d861e2},{0x04002cc4,0x811ef4fd},
+{0x02e14602,0xf8fbe60a},{0x0420a755,0xed0c359d},{0x04801e77,0xaac1295a},{0x03a0fb8e,0x5016799f},
+{0x0180a273,0x664a15c8},{0x02c00410,0xd9114da3},{0x012033d5,0xbcc7d08c},{0x03010b81,0xa58d84c2},
+{0x02c1331f,0xef0af563},{0x01a0a311,0x8b926529},{0x01a0a327,0xc3a64509},{0x05602a69,0xc8b01450},
+{0x020013c1,0xe809dd5c},{0x01e1051b,0x3d733741},{0x03001d22,0x04b8c436},{0x02c00d54,0x1e3e0b80},
+{0x02a014ee,0xcb0f67a2},{0x02c132a0,0xd95d0b09},{0x01a02407,0x9c597b05},{0x02601433,0x32b159a1},
+{0x020030e6,0x0cb3cc85},{0x03c1d56a,0xff2581ba},{0x03a1d061,0x65cf0717},{0x02a1f64e,0x92b718cd},
+{0x02e12348,0x77a14aa3},{0x0461fbc0,0x9354e240},{0x02411aca,0x6bdd384d},{0x02418889,0x8de571f5},
+{0x01c00b33,0xd1a01170},{0x01c11283,0x13fc899a},{0x00e0226c,0xfd8646cf},{0x028018ca,0x6a8e4164},
+{0x01c0a177,0x6618fb62},{0x02801985,0x89f79949},{0x038015bf,0x07b80e6f},{0x0300293a,0xc4c8b4bf},
+{0x026e0121,0x23a642ae},{0x01e0a6bc,0x12e8d3c6},{0x02e14515,0x04b0dfeb},{0x02e1325a,0xef803391},
+{0x02010f3b,0x899e561d},{0x02c132ad,0x4807061e},{0x03a0159e,0x71a46204},{0x03810993,0x9dfea074},
+{0x02801314,0x6dad88cc},{0x0300110d,0xbd5a8d37},{0x03c1d018,0xeec741fe},{0x020030bc,0x6cb2250e},
+{0x020017bc,0x2c7c43a4},{0x0341d20b,0x154dad2d},{0x024108a7,0xd4a68c1d},{0x03011362,0x6f92e9c5},
+{0x0300112d,0xbe0ab3c4},{0x01e0a219,0x7781da4d},{0x01a0a0ae,0xdcaa1b0f},{0x01e11190,0xc51a35a5},
+{0x01e02380,0x31418a06},{0x0141f96b,0x0832557c},{0x01a0a628,0xf17dc04f},{0x01e111ac,0x8d26a970},
+{0x04a12237,0xdc242c6a},{0x00a1f52a,0x416c179c},{0x052008b5,0x5b83ef30},{0x02003062,0x4c3b2939},
+{0x02a019ed,0x341ffa62},{0x02c028d1,0xc781d1d5},{0x02a10add,0xd2037d8f},{0x03a0fab7,0x226e381c},
+{0x03e18c32,0xfb9ce8f2},{0x03a1d8c4,0x5fabd3c2},{0x02602c9b,0xcdfa878f},{0x02e1f0d7,0xf68897fe},
+{0x04801e1d,0x8c6d2a26},{0x0281bc96,0x79c60663},{0x03c00d9c,0xb57da983},{0x03202ac6,0x11bd643a},
+{0x0440267a,0xa6a4e459},{0x01c1fb04,0x3f2ece13},{0x02c003ee,0xb06e5ce1},{0x01e1071b,0x876caf9a},
+{0x0300fb26,0x237255f4},{0x020030d1,0x6cca29f4},{0x0180a320,0x9a7e4307},{0x01602bf0,0xb16f53b0},
+{0x01003396,0x76b07c67},{0x01e00f53,0x0d6f1217},{0x01200608,0x93e9e69b},{0x016e002e,0xf8ef0276},
+{0x0361f00a,0x7240fbbc},{0x0381ee42,0x108281f1},{0x02418874,0xfeeaa106},{0x0441f160,0xea4f596f},
+{0x02e16913,0x8754ccbd},{0x01403303,0x8746b43d},{0x034118ae,0x8220ce1c},{0x04800527,0xf8a907e0},
+{0x02c168f5,0x198b6ce1},{0x05e1d92c,0xd58e4932},{0x0581d9af,0xd8f83bc9},{0x02e118c3,0x5476a60d},
+{0x034001bc,0x1cc2b067},{0x02e1cf90,0xa4ae75c9},{0x0240119c,0xfc748f8d},{0x02412032,0xcad598c7},
+{0x0580a70d,0x3f3a8f1f},{0x02001049,0x11ad0bcd},{0x02418a6f,0xc7a8fdf9},{0x03e18b1c,0xfed216dc},
+{0x012020bc,0x39949387},{0x02600f0e,0x7b4ceae4},{0x0341f4ed,0x7607a61f},{0x02a118ee,0x456ce8f9},
+{0x0121f14d,0x468172f4},{0x0321136a,0x488a4dfb},{0x0260a819,0x374d4043},{0x01e1f7d5,0x5c9eaecb},
+{0x0480fccb,0x54b27a3a},{0x02418a37,0x3b38613c},{0x0261b0e4,0xeebab349},{0x04a00496,0xa8fe8022},
+{0x03e01dca,0x63f2e5bb},{0x01602386,0x7680e619},{0x01a0a4b7,0x354a09b1},{0x02c1ee02,0xfd46510e},
+{0x01a017a1,0x590be1fd},{0x02801a84,0x2f2ce614},{0x03000f8a,0xdcfc2848},{0x01c0a1c4,0x46b5820f},
+{0x01a1173e,0x7cdf16aa},{0x02a10e7a,0xc2760ea1},{0x01a16f09,0xcafab7d2},{0x0200169a,0xac340ffb},
+{0x0321d523,0x0aa173f3},{0x02816a92,0xadf2681b},{0x04612062,0x01a0a6ac},{0x0421d751,0x4fb9ab1e},
+{0x01e1071e,0xf8698fe6},{0x01e0a604,0x8949f384},{0x024189de,0x2cc3b07d},{0x03e0a8f1,0x3c475f73},
+{0x03e18b8e,0xa8bbc92b},{0x02e10579,0xa25dff73},{0x03201c83,0xd8275568},{0x01e00cec,0xf4589d40},
+{0x01e0062a,0x0b60699a},{0x02418934,0xa67bd3eb},{0x01a00eb8,0x0e36d9e0},{0x02210314,0x9e43aa5e},
+{0x01802bc4,0xb2c93cff},{0x03e18c07,0x88a482ae},{0x02418a07,0xab2e8430},{0x020013f2,0xf234ce21},
+{0x02c13321,0x67126e10},{0x034111eb,0x49d177d0},{0x0301447b,0x47c5a5e3},{0x020122d7,0x47136966},
+{0x02c1314f,0xcac3b1ce},{0x04c1d7b6,0xf294a40e},{0x02e13133,0xca3df700},{0x02c1da8b,0xa0153f70},
+{0x0420fc96,0x2f1a07ca},{0x032002c4,0x49b46558},{0x03e02b88,0x2ddeef94},{0x03c1d562,0xf7257522},
+{0x01e10659,0x4f2d4991},{0x0281f938,0x39dfe0f0},{0x0480fca1,0xb0cfdcdc},{0x03202a6a,0xd20fb709},
+{0x02612501,0x2c62dc9a},{0x0160a4bc,0x739570bb},{0x034025b6,0x7d0236fc},{0x0161f5d1,0xaefb06e3},
+{0x028e01ba,0x03d7fa16},{0x0221cf83,0x4382f68b},{0x02410177,0x9f3dc2dc},{0x034109cc,0x39aeb573},
+{0x02601734,0xdd239806},{0x04c1d0f2,0x43c7f5b0},{0x02a168f6,0x90e65a95},{0x03014480,0x10c9cc7c},
+{0x03c1d47e,0xdd22e073},{0x0381e899,0xb00c560d},{0x02e02117,0x7aeb1c24},{0x02812fb6,0x11f01b10},
+{0x05c1d89f,0x08a0b30c},{0x022032fa,0x111eeb32},{0x0100338f,0xafb55350},{0x03e18b95,0x1cbebe5e},
+{0x03c01e98,0x4bf39e4c},{0x03e18c6e,0x7a95621a},{0x038000dd,0x2df84c7e},{0x016007cf,0x4d5506b5},
+{0x05003368,0xb75b158b},{0x02e0115b,0x65c0258b},{0x0440a651,0x57aee14d},{0x02c00d8e,0x1ced553d},
+{0x02e130b3,0x277b708e},{0x010032cc,0x5fb713f7},{0x020009b6,0x60eab049},{0x02c13054,0x35f131c8},
+{0x03a1d5b8,0x657bcdc8},{0x02a11d15,0xd3cfc7b4},{0x01a11734,0x954d51f9},{0x02401a17,0x6083381a},
+{0x03602bcf,0x6c3f13b1},{0x0261b0df,0x059cc26a},{0x0320a78f,0xb2c97938},{0x0360fb32,0x9ebc7870},
+{0x02a11934,0x31cd1c5c},{0x0421d636,0x47b1eb49},{0x0240aaaf,0x3f2f4c22},{0x0460fc8d,0x756be0a6},
+{0x02c0285a,0x6b7991ba},{0x01e11330,0xdad34be7},{0x0340abe0,0x661380ba},{0x03a1d7f7,0x85236bff},
+{0x07402a94,0x1d82c3ef},{0x01e1120d,0xa6a28bbf},{0x02a1d328,0x4d7fd6d0},{0x034011fb,0x17edee59},
+{0x03a1ec92,0x97c221f5},{0x0260a771,0x083a968a},{0x01602203,0x41d7b9d5},{0x03a001ea,0x9c52cc13},
+{0x01c0a043,0x72628de3},{0x03a1ee22,0x06221f10},{0x04601daa,0x74b85ab5},{0x01c0a5f5,0x31663c02},
+{0x0460fccd,0x11c40deb},{0x01e1129a,0x7975e96a},{0x02012053,0xea7af8a5},{0x02e0041c,0xa446a806},
+{0x02e0fbdf,0x85ba3b96},{0x01c0a6d9,0x2674c42d},{0x020031bf,0xb8902ed9},{0x02e1d360,0xeae55470},
+{0x0421f865,0xb0daac3f},{0x02c1d303,0x0e5c4990},{0x01e10b06,0x751e461f},{0x01e10761,0x7bff18d4},
+{0x03c1f21d,0x28857db7},{0x03603011,0x6423c5a1},{0x02c131ef,0xfd7cb038},{0x02c10e74,0x77824603},
+{0x02e00972,0xf39daa53},{0x020103b9,0x8ef83581},{0x0461d9e0,0x5c75dfe3},{0x0320247f,0xc14ed721},
+{0x03001d21,0x11b8d8ad},{0x02c122ed,0x0d903540},{0x03e18ca8,0xfc8cd736},{0x02210383,0xec2dee47},
+{0x02e1ed0f,0x06c9a36a},{0x02e10d34,0x548ea15c},{0x02a0155b,0x0ca088cd},{0x022114d8,0xa03820bc},
+{0x0201bc32,0x56c27bbe},{0x0321008f,0x0eeb93b5},{0x02e1eca2,0xe4b7d3ee},{0x032100ec,0x526b05da},
+{0x02410360,0x0ce14a80},{0x02a11aef,0x3af09dd9},{0x02811abf,0xbebdaeb2},{0x02e02729,0x1b9d617c},
+{0x01c16a7a,0x94f4d58c},{0x0340d7cd,0x39b9ab26},{0x030118a1,0x08aa2f27},{0x02e14638,0xe7c224e8},
+{0x0261b0e3,0xebbaae90},{0x02c1d1ae,0x2368c57e},{0x0421d7d8,0xb7537533},{0x026e0149,0x9b88ea82},
+{0x0220a6ed,0x58b9af54},{0x02c13320,0x68126fa3},{0x03a10878,0x7fd4249f},{0x03216b5c,0x1e4c5189},
+{0x01c10289,0xd3c0d839},{0x024188f5,0x121da989},{0x01a0a00e,0x28ebc70d},{0x034121d1,0xa79b9d68},
+{0x030024d7,0x4ab6a492},{0x01e1069d,0xc73283a7},{0x05a1d988,0xd0f8287b},{0x02e1d910,0xf79089ec},
+{0x026021e9,0xed5ffe3e},{0x0261b0eb,0xf37a13d2},{0x0301f0b7,0x6be19edc},{0x01c0a226,0x00a46ce0},
+{0x02e02af1,0x4467455d},{0x02e0ab48,0xb0faae05},{0x02a11c6a,0x0f43fa41},{0x03a024ed,0x4113a6d8},
+{0x01c01c13,0x483a46c1},{0x00a1f428,0x0170eff9},{0x024189ec,0xa2dc6f25},{0x02212080,0xbb95f40f},
+{0x00e1f431,0xe06b269e},{0x016029f4,0x8f3f9b33},{0x030011dd,0x311aca7f},{0x04002778,0x214ecda2},
+{0x02a02734,0x2a47082e},{0x02e1f855,0x4243a018},{0x03a1d672,0xd3587769},{0x02a022e1,0x5431e8f2},
+{0x0201f4bb,0xb3e6f040},{0x03010c0e,0x0ee45054},{0x0261b043,0xb8d73361},{0x01a0a14d,0x03a5fd6a},
+{0x030017a4,0xcbe8b59e},{0x02802f0c,0xe94a567e},{0x03810b64,0x82c10734},{0x0380143d,0x5dcfa920},
+{0x020115ab,0xcde4db89},{0x01c0a6ea,0x1b4bcc24},{0x03a00fd1,0x53923166},{0x03a120fa,0xf33088ec},
+{0x03e18b59,0x90c86f56},{0x01a0a5e4,0xd72c9f18},{0x0201f91a,0x345732fa},{0x03a03195,0xd6004ac4},
+{0x032120ae,0xdadc78f3},{0x02616e81,0x96c26c22},{0x03c02c0f,0xecea233f},{0x02a120f8,0xe6ed04fe},
+{0x0321f64b,0xcf1ad7e0},{0x00a1f40c,0x35405eea},{0x02a11448,0x62a2ada4},{0x03a01de9,0xc4521582},
+{0x01e0a5c6,0xb00aab2c},{0x0261b0ec,0xf27a123f},{0x0440038e,0x614886d0},{0x01c0a38f,0x97800dca},
+{0x03c00d9e,0xac0f5a66},{0x01e10184,0x7d5136ff},{0x0361e95e,0xd6c82616},{0x0181140b,0x443b24de},
+{0x0221fb1d,0x172a4276},{0x02a101ee,0x237408b6},{0x04a0fc3a,0xe7985439},{0x01c0a5c5,0xacaca179},
+{0x0261b037,0x4a6e3823},{0x0220078d,0x48e84c42},{0x04c1cf06,0x76771cc3},{0x02e14509,0x86a4e09e},
+{0x0401d73d,0xf562ea53},{0x02211a83,0x5ecafb3f},{0x02e1d85c,0x8aef53e8},{0x02800360,0xd87e9636},
+{0x01e1bc04,0x0367856d},{0x02c13150,0xcdc3b687},{0x00e1f689,0x41d62ef3},{0x03a11a87,0x342932b4},
+{0x0260154b,0xf8b57b81},{0x02e1216f,0x74ecb92f},{0x02001169,0xd92ba1bd},{0x03200317,0xa3fe1386},
+{0x028014d8,0xf208a2f6},{0x02002f24,0x36a1b115},{0x02e13145,0x372a9093},{0x028110d3,0x12a7f9b5},
+{0x03403209,0xe903383b},{0x03010c0a,0x0be44b9b},{0x03c01d7c,0xf8091643},{0x02002f9b,0xcb15dcae},
+{0x0141144a,0xfa60eecb},{0x02000bc8,0x7ffac622},{0x02a103d0,0xb55af25b},{0x0200a9a4,0x5e8e0159},
+{0x02c006ba,0x6c1f01ca},{0x0381240e,0x71529051},{0x024188fb,0x8c1a9800},{0x03211a17,0xd122c301},
+{0x02a0317e,0x7bd705ed},{0x0441d9a3,0xa6fa83f1},{0x0261b063,0x2f34bd12},{0x03016820,0xf42e3089},
+{0x0401d064,0x5dc9bff8},{0x02ce0059,0x763c743c},{0x02c10ac5,0xb8bad3d4},{0x02411924,0xc3951768},
+{0x0360023c,0xa7dfc0b5},{0x01a11611,0xe7a54c7c},{0x044119e4,0xb8a6d0c0},{0x0121f950,0xb2d82e5b},
+{0x02016ab8,0x75f17fae},{0x02c131b0,0xcff792fe},{0x02003070,0x702c575b},{0x0540fd5f,0xc8380e4e},
+{0x02c1fa50,0xa35b80ce},{0x02202011,0x19aaecd9},{0x01c16f2a,0x960aacba},{0x02c1cf7d,0x01b75216},
+{0x03e18c87,0x7890e1c6},{0x02c02926,0x8a287441},{0x01a1170c,0xb42fbfab},{0x01e11632,0x54ee3090},
+{0x01a0223d,0xd9bb0403},{0x02e01392,0xf9eb42e9},{0x03e18c11,0x86a240f1},{0x0181f99b,0x8e47f56c},
+{0x028119bc,0x22c875a4},{0x03216801,0x0ded37f2},{0x02e11c08,0xae976df5},{0x0441f874,0x12c99d3a},
+{0x02216ad5,0x26e05f5d},{0x02a00953,0x16e2ddba},{0x0441aff7,0xd05251e2},{0x0301f0a8,0xbd64a1f1},
+{0x01c0a39a,0x06be69c8},{0x02616a06,0x02349ee8},{0x020116b1,0xe8c3efac},{0x02610397,0xd88b8410},
+{0x02812269,0x54f5e4fb},{0x00c026b7,0xcac50e00},{0x03e01ee4,0x391629ba},{0x02802fa5,0x66cb72cf},
+{0x01c02656,0x729d0b03},{0x02418aa6,0x469cf9f3},{0x02a1d347,0x023fe301},{0x03400107,0x74720873},
+{0x0240a801,0x11abc309},{0x02802c89,0xf684f08b},{0x04e0298f,0xcedc1a09},{0x02202ece,0xa466ea8e},
+{0x03800560,0xe9d71501},{0x0341e88e,0xb3ce1d54},{0x02600046,0x741531e7},{0x02202fb2,0xfc6c2a86},
+{0x02002a42,0xb1419957},{0x0180212b,0xad804d23},{0x040021f9,0x516fe821},{0x02411905,0x67d0b0bc},
+{0x02e1325c,0xf18036b7},{0x01c1163f,0x3bca9f49},{0x02e13215,0x45520207},{0x0300a888,0xa5324d0e},
+{0x07402966,0x7b403f05},{0x03a0fa85,0x214cad0c},{0x02a02862,0xaaa42355},{0x04a0fcb0,0x3ecdf71b},
+{0x00c02020,0x2b293dbb},{0x0361d5bf,0xcb9c92cc},{0x032028ef,0xa2754c19},{0x03200f77,0xcf15eda7},
+{0x05401ed9,0x01830894},{0x01a0a415,0xa2afe43f},{0x01e10721,0x8e7137cd},{0x01c0a140,0xc06b5f3a},
+{0x02800792,0xad7c962d},{0x0260212d,0x5ef50645},{0x01c0a6b4,0x42aa9c70},{0x0240104b,0x2b74db08},
+{0x016022c5,0x532c89b0},{0x03a0fa72,0x363b84fa},{0x02418827,0xf2897b25},{0x01c003d5,0xf21f02a6},
+{0x02c00981,0x0c7f4de3},{0x03e18bb5,0x1deaa9bd},{0x01c0a302,0xaa8f4964},{0x0460fd26,0x82eb6244},
+{0x02e145aa,0x7536e6eb},{0x02612319,0xce2f2900},{0x01a11fe3,0xdcfd594b},{0x02400223,0x19816690},
+{0x0260246b,0x81aced73},{0x02c029f3,0x770bec08},{0x02c029f5,0xd3cfb290},{0x02e003c5,0x3ea41630},
+{0x02010632,0x292639ba},{0x02e1457e,0x75417447},{0x02e0051a,0xb8152ab6},{0x0380ff61,0x18c03ede},
+{0x03e18c00,0x8ba48767},{0x01811fdf,0xc6d5e8a2},{0x0480fcc1,0x6beee0cb},{0x02c168e5,0xae04abd5},
+{0x06c1d0d1,0x9a100123},{0x02e1460c,0x70fee189},{0x0280268c,0x3e92317f},{0x01a0a5aa,0x270f07f4},
+{0x03010c3f,0x970ea2eb},{0x0261b005,0xd5524824},{0x01c11698,0xb716c7a1},{0x04800498,0x338b4d66},
+{0x026111de,0x1456d092},{0x0301f01d,0xece90a5d},{0x03e18c21,0x7e9ff5c2},{0x03612254,0x7c9979ce},
+{0x02e16e6d,0x55d43dd3},{0x032169e3,0x60d1c579},{0x0481d78c,0x2e5e1f47},{0x01e1071f,0xf7698e53},
+{0x0321686f,0x11fe84ff},{0x04c1d9db,0x7beac7a6},{0x0220ff12,0xd2c3e8a1},{0x01802082,0xf89d5db8},
+{0x03011374,0xb186cf81},{0x02e00265,0x757996ca},{0x03e1210e,0x00e771a3},{0x0301459b,0xc509825a},
+{0x06000758,0xdd673281},{0x02e14531,0xffae9975},{0x0260004b,0x67151d70},{0x02210811,0x01cd9a5a},
+{0x01a1f309,0xa9d5bbb1},{0x01a0a5fd,0x2b0003b6},{0x032118a4,0xf9ac5a3a},{0x058021ec,0x5c970a07},
+{0x0301f049,0xf537240d},{0x02a030e5,0x2b3e3b40},{0x030102e0,0x306169a4},{0x03a1d677,0xd8587f48},
+{0x0221bc3d,0xe863dded},{0x02600e25,0x724ddfbf},{0x0280a74e,0x85479789},{0x0281035c,0x8c4a3f00},
+{0x0341e8bd,0x07706b14},{0x020116b5,0xf8f5a5a8},{0x02e14484,0x090d7c06},{0x01e106e7,0x35c23886},
+{0x01e1123e,0xb9eaba78},{0x02c1f062,0x78d09ba8},{0x022010d3,0xb9d44764},{0x032100f2,0x486af61c},
+{0x02e16b80,0x9ea18b14},{0x03002c30,0x5c674513},{0x02801337,0x3ebf827c},{0x04202275,0xfa2bfe31},
+{0x02e03293,0xe5c48c90},{0x02e1f011,0x992cd1d1},{0x01c01701,0x82727f77},{0x03e109d7,0xcf082331},
+{0x0180a4f7,0x6ef92046},{0x01c1fb20,0x542cb08b},{0x0320072e,0x51edd0fc},{0x03210c1b,0xc86ef623},
+{0x02c01073,0xbcb67575},{0x0260095f,0x28d6adcc},{0x024188cd,0x2213355d},{0x0421016a,0xe32fd40d},
+{0x01e0310d,0x8afa0a9d},{0x04e1d63c,0x04e1ac17},{0x03a02339,0x19860f2f},{0x0201064c,0xaba01e43},
+{0x04e02943,0x06de6bbd},{0x02a015a1,0xa053321e},{0x02a11fd1,0xc301f03e},{0x0301689a,0x93106db0},
+{0x030010a5,0xc6d4bb3e},{0x026e013e,0x20a1c0c7},{0x02400fc9,0xa7a2b7e8},{0x0301d402,0xc74d149b},
+{0x02e11fd0,0xe071ffae},{0x016031c2,0x0583fbc4},{0x02811c31,0x89b155cc},{0x034024bc,0x4e65ec22},
+{0x02012541,0x9f507032},{0x02201c26,0x2fb769e2},{0x032109c8,0x81d15331},{0x0320a9ee,0x056bf65c},
+{0x024188d8,0x1110dc03},{0x06202ba1,0xb65b259a},{0x03c1d710,0x2e85b1fa},{0x02c1316a,0x3ebe583c},
+{0x00e1f3fa,0x9fcde519},{0x01a1028b,0x0bee2342},{0x0361084b,0x02cf1499},{0x01a0a4dd,0x47185ab6},
+{0x02610fe3,0xefef2335},{0x03e18b00,0x0bcfecbc},{0x02a10009,0x9a6561c9},{0x01a0a10e,0xfe94ac6a},
+{0x04201dd8,0xd793b902},{0x022114b3,0x6620c0d3},{0x01c1f616,0x6b34c055},{0x01e1bc0a,0x026783da},
+{0x0361e80f,0xf9647d37},{0x01c03020,0x637e876a},{0x04001f68,0x488978db},{0x01e10b02,0x7f1e55dd},
+{0x028e019c,0x00635aa8},{0x01a0a474,0x4a3e1147},{0x02610a25,0xea14fb1b},{0x0421eeb9,0xcb835d2d},
+{0x03e0ffa6,0xf319de2b},{0x03402938,0x0d71b8e5},{0x01e1bc51,0xf0676784},{0x02400f75,0x76c6cd30},
+{0x0240a899,0x2e05fcd2},{0x02a0328f,0x00a9ad3a},{0x01002238,0x31da2888},{0x01e112a2,0x3158f5fe},
+{0x01a0273f,0x155acd95},{0x04e02bc8,0x8293e43a},{0x03001143,0x68f31e37},{0x024188d5,0x1210dd96},
+{0x0280abf0,0x5b010eb4},{0x0381d490,0xbb200916},{0x034000e1,0xec4a9011},{0x02000691,0xb644b574},
+{0x034004e9,0x2d9b6ffc},{0x02c0aa66,0x32f1f1f9},{0x01a16f35,0xd20ab78c},{0x01e01708,0xa0379f6d},
+{0x04c10153,0x51d122ee},{0x01e10b30,0x75612c0c},{0x0381f00d,0x931d0e6f},{0x0541d8e1,0x5f4904b7},
+{0x03c0a653,0x006068f2},{0x04400214,0xdf9db278},{0x0261b079,0xc02f9127},{0x02a1f3d2,0x72f1e481},
+{0x028e01ef,0x96df9d44},{0x01402e19,0x084baaed},{0x04a1d062,0x11f9c4c2},{0x0240d7b1,0xd6f669ad},
+{0x028e0063,0x74c225b3},{0x03c1d8f4,0x671c9914},{0x0241d2ec,0xb8e0c0b8},{0x034023ad,0x7da4f934},
+{0x0180a112,0xaa6895e8},{0x02c1d41a,0xd497de18},{0x02411348,0x8f506e04},{0x01e0a919,0x1ad3c70f},
+{0x03612480,0x47aecfc2},{0x02401030,0xd269f5ee},{0x01c0a339,0xd564b39c},{0x03e1e012,0x18a07bf2},
+{0x020009a7,0x8d5b38e4},{0x02c02e25,0xdb368957},{0x04a1d661,0x3c1b0f55},{0x03200472,0x63f453fa},
+{0x01202e30,0x616b2df3},{0x0260a985,0x13dc1417},{0x02e144fb,0xfbaa15fb},{0x05212446,0x7be74c89},
+{0x02e144b9,0x9903d15a},{0x020009a1,0xc53d7bf8},{0x0381f728,0xb2cc4c56},{0x03c0032d,0x2743568e},
+{0x02c01672,0x61d1279f},{0x03202df7,0x36803252},{0x03202a0c,0x570137e6},{0x02418a28,0xb63fdea2},
+{0x0181162a,0x341ab027},{0x03202c39,0x200aee6b},{0x01a0a468,0xaa44165e},{0x01a0a0e2,0xb622d6fa},
+{0x02400a5a,0x6c2692bb},{0x02800f33,0x44345084},{0x0221f64a,0x77f02091},{0x04e02ffb,0xe1184229},
+{0x02801d5b,0x6a8c8023},{0x02e0a80b,0xaaa792c4},{0x00e1f32f,0x044bb32a},{0x0280abc1,0x3a26b0b4},
+{0x01c0a419,0x0aefbdaa},{0x01e01a41,0x95a197fe},{0x0161f3b5,0xa675b671},{0x02802406,0x477e0be0},
+{0x02410adc,0xd2b9a009},{0x01e11a7d,0x1465b7ca},{0x02418a94,0x529f4b6e},{0x04c1d941,0x1586b10e},
+{0x03c1e949,0xb56bc81a},{0x0200218b,0x7199737c},{0x0361f761,0x9f81ffd0},{0x02a10fb3,0xfffd94cc},
+{0x04a1d65e,0x371b0776},{0x01c0a5ef,0xec081549},{0x048001ae,0xe5d5495b},{0x044107a1,0xe2bdc555},
+{0x01c11225,0xe3216381},{0x03e18cc2,0x7a878d62},{0x01816a64,0x8b6ea730},{0x03c1ec96,0x5deafe35},
+{0x03c1ee64,0x8dab81e4},{0x02812ff0,0x3b6734e7},{0x02601203,0xe3644c36},{0x02e10581,0x82438996},
+{0x03c1d568,0xf1256bb0},{0x01a0a297,0x8f3e95e2},{0x0161f542,0x22c61d16},{0x014031d4,0x713992cf},
+{0x01a02e4a,0x2b8a8bc8},{0x02e0a9fb,0x27f84340},{0x01a0a3ea,0xd4f2d0e7},{0x03a1f8ad,0x980fa405},
+{0x04400210,0x4c7ced07},{0x03403242,0xc4302842},{0x0381e016,0x01f21d43},{0x028112e6,0x81078f91},
+{0x02c1f7cd,0x561dbad8},{0x01a11106,0x51883dab},{0x02a1682c,0x9a90323e},{0x02418aa2,0x529d0cd7},
+{0x02a16a1e,0xb90a919a},{0x02001a13,0x974f98c4},{0x02e11a2a,0x580f41b4},{0x02611ff1,0xd4f14d07},
+{0x01c1e2c4,0x83730b64},{0x028005da,0x81da5424},{0x02a11ae2,0x62c89d88},{0x02012351,0xe8687a38},
+{0x0341d449,0x21b29df3},{0x022026f6,0x4633e39c},{0x02c11d8b,0x715781f1},{0x03800467,0x0f7ce15a},
+{0x0460fcc7,0x6bcc1352},{0x01c0aa2d,0x58c10f07},{0x01003384,0xb5b55cc2},{0x03c12063,0x097d6ed9},
+{0x0381f769,0xfb0f7c3d},{0x03e18c7d,0x5592e944},{0x02202f56,0x60063a8e},{0x0341054c,0x7277c93a},
+{0x0361193f,0x9ee83407},{0x022122d3,0x1fd3cdf8},{0x00c02644,0x372d9976},{0x01c0a084,0xd666a098},
+{0x03c00464,0x0737fa42},{0x0561d88f,0xceab0667},{0x02e1d1c5,0x22314412},{0x01c1121f,0xd710077c},
+{0x032029a0,0xe627056c},{0x020103a6,0xaeaec62f},{0x01a0a480,0x462f0071},{0x02e10c14,0x46619bca},
+{0x02003092,0x8e6061f8},{0x01e106ca,0xabbaa383},{0x01c11033,0x6271308d},{0x02202f2a,0xdb6c9f68},
+{0x04a1d02a,0x553e88b2},{0x0260140c,0x08aed8ec},{0x026121f1,0x191d3595},{0x0220089c,0x074fe1ee},
+{0x02e1323d,0x5f722e7c},{0x0180a18f,0xae4f044e},{0x03202d4b,0x7655b172},{0x03a1d5ab,0x5a7bbc77},
+{0x02610fbd,0x22ead2bf},{0x02c13068,0x0c9e0f2c},{0x0281e925,0x1ebad1e9},{0x0301d4ce,0x30a10d2c},
+{0x02600d6d,0xda2c27a2},{0x0381e01c,0x90df8ea4},{0x03216929,0xfc04803b},{0x0180aa1a,0xbb3dac93},
+{0x03e18c5a,0x1e98a2dd},{0x01e01920,0xe98be1e7},{0x0181faba,0x3f49a821},{0x03000d61,0x51c6bf45},
+{0x02003122,0xba9031ff},{0x0280a8c4,0xa5726fa0},{0x01e1f109,0x87e6229c},{0x04a1d956,0xbbfced5b},
+{0x02e130d0,0x2f77639b},{0x0320137c,0x51801d9e},{0x02601bab,0x905557a4},{0x02a0ff20,0xaa9f8aaf},
+{0x0401f74f,0xfd0a9774},{0x0301215b,0x4202ff50},{0x01e1bc09,0xf3676c3d},{0x0181d377,0xa2f4954c},
+{0x02a0a813,0x762685bb},{0x0221f7ea,0x0f2fd8c5},{0x0321aff2,0x9c3428ae},{0x0260a89b,0x7bd388e5},
+{0x02201a6e,0xd7c2101c},{0x02418888,0x8ee57388},{0x0180214d,0x46dfec42},{0x04e1f7a0,0xf13d318c},
+{0x02c132a9,0x4c070c6a},{0x020108fc,0xeb8fa6b6},{0x020112b4,0xadd33934},{0x0161f4ff,0x595accc3},
+{0x0201110b,0x613bf795},{0x03011d95,0xde61fb64},{0x01e1fb2f,0x3d5c74f8},{0x02c0300e,0xeb49c3a4},
+{0x0240091c,0x349ab98e},{0x01e11095,0x3390a9d8},{0x070029ab,0x9d457e93},{0x0301d803,0x7aef73ab},
+{0x0301088c,0x5422962e},{0x01002be6,0xe2d172ea},{0x03e18c14,0x89a245aa},{0x02011235,0x6e22bc70},
+{0x036017f9,0x629a855d},{0x02e1221e,0xa1ae6e6e},{0x02e13249,0x65747685},{0x03401da2,0xa3eb9905},
+{0x024189b2,0xa0cd6175},{0x02c024f9,0x33cf232d},{0x01c01907,0xec2e770a},{0x0320215d,0xca96a5fe},
+{0x03010cc9,0x4c1f82cd},{0x03403010,0x6880e294},{0x0321201e,0x229757dc},{0x01e16a8e,0x1694217a},
+{0x0360a8f0,0xe5e737ea},{0x0321240f,0x7cff1e0c},{0x03801d69,0xae6f74ee},{0x01a0a357,0xc854b5ec},
+{0x030011bb,0x3cae2a4e},{0x04a109bc,0x90ce0868},{0x02c13328,0x70127c3b},{0x04201fe1,0xebd5d5c6},
+{0x0301f837,0xec13be00},{0x0621cf37,0xedde61ac},{0x02a105a9,0x3409127e},{0x02611cb5,0xb01e4bdd},
+{0x020103b1,0x82e6d97c},{0x02211c22,0xd82d4ce9},{0x02418819,0x6c842b05},{0x02402059,0x17c398f0},
+{0x0301d416,0xbb4d01b7},{0x03410406,0xc14d9d26},{0x028e0068,0x7dc233de},{0x024121ec,0x843754d7},
+{0x01e106f6,0x2c9f9819},{0x028119b1,0x895f4eb1},{0x02a16a0c,0xbff02a45},{0x054021ed,0x5d332f7d},
+{0x020030bf,0x54c109d0},{0x02a003e3,0xa66e7a87},{0x034023ab,0x9bb9e1a5},{0x01a0a4e8,0x8934ad69},
+{0x0340ff51,0xf8e0c738},{0x0321209c,0x54bba91d},{0x02e0028e,0x8679b18d},{0x0180a001,0x5947c2ba},
+{0x02e0018f,0x418dcfef},{0x02400d16,0x759cac2a},{0x03e1e89e,0x738d89c7},{0x03e18b81,0x1cbc7fc7},
+{0x052027a6,0xdc41fde7},{0x0141f475,0x0bacff89},{0x020030ed,0x22c53848},{0x03a025de,0x490280db},
+{0x02e130a8,0x43033056},{0x02601fbe,0x2bbda5ff},{0x0240248f,0x18b6c998},{0x028e01e5,0x98e1df01},
+{0x03a1daaa,0xc49fda91},{0x034011a9,0x4d274c90},{0x0280a952,0xd08e0d2a},{0x01a1f54f,0xf0ca5034},
+{0x02c13065,0x109bd6e1},{0x02e1204b,0xc7e303e1},{0x01c1fb0b,0x502a6ba8},{0x02418a9f,0x4f9d081e},
+{0x0440a72f,0x8092da64},{0x01a0a53f,0x3311596f},{0x0121f4ce,0x97b616f7},{0x03c1cf75,0x81510f0b},
+{0x03410b8d,0xca3d02b2},{0x0360024f,0x2910af13},{0x02002f51,0x94318266},{0x0381015a,0x5fd54063},
+{0x02012263,0x533e899d},{0x03e18bd8,0x0cdb8470},{0x02601450,0x12a699e5},{0x02c01d36,0xb0e7f48e},
+{0x01c0a316,0x70696a98},{0x0480fc0c,0xb674588f},{0x038006ee,0x49ecdf8b},{0x02002488,0x15e810df},
+{0x02411408,0x799e99b7},{0x02c1317a,0x41cd677f},{0x02001a11,0x7f4678a0},{0x0321f01b,0x68da76c7},
+{0x01816a5e,0x2f1e84ad},{0x02a112df,0xdc41fdf7},{0x02601294,0x70d72cd0},{0x02c0a829,0xdbbcdbe8},
+{0x0261d86b,0xf43bed5a},{0x0561f79a,0xb8ecd108},{0x01400024,0x01dd353a},{0x02002447,0x25dccd7e},
+{0x03201ba8,0xb81e650d},{0x0461d8ef,0xc1702687},{0x01c0aab0,0x826d5c3d},{0x04a0252e,0x6715957c},
+{0x03610537,0x925aff6e},{0x0300fec6,0xdbc1078e},{0x02c00ce0,0x7e504258},{0x036006ac,0x87d82841},
+{0x020009bc,0x147daca1},{0x03a00197,0x104e704e},{0x048124af,0x2a3b3bc9},{0x03e00757,0xdacea931},
+{0x0200a854,0x928712d6},{0x02200680,0xeb6a2ad9},{0x04201fb8,0xfd0a2fac},{0x02202fb4,0x1976e589},
+{0x04600523,0x4279185e},{0x04a1d747,0x22855022},{0x0281b03b,0x28668e49},{0x0161f621,0x5c575836},
+{0x04a11fc1,0xb2676245},{0x02000a17,0x05f3880b},{0x0421d5d6,0x5736d76d},{0x03a0fac0,0x9b6b2500},
+{0x026012e6,0x56eb6e8f},{0x04201cad,0x2c06ac8d},{0x04002363,0x29646f12},{0x03802c04,0xfb01bc92},
+{0x02211fdb,0xd532135a},{0x02211c2a,0xf41e6e73},{0x02c1321c,0x75751e5b},{0x05602a4b,0xf22a000b},
+{0x0420075c,0x7e88940f},{0x02a0abf7,0x71b2cd5b},{0x0440fc8f,0x5e80c666},{0x030122f7,0x2265ec34},
+{0x02a0303a,0x660ffb1b},{0x02c1318c,0x022c5aa3},{0x02610384,0x1cee0fa7},{0x03001d0a,0xf4b8ab06},
+{0x02611061,0x7d09250b},{0x0240200c,0x34e2731b},{0x02418a09,0xad2e8756},{0x0280aae9,0xda105345},
+{0x0260146b,0x087d3c20},{0x02e10c04,0xf8c2e603},{0x01e00f5f,0xd58ccf03},{0x01816a47,0xe4c5af9a},
+{0x02e1da2c,0x30d0ebc8},{0x0181f7ac,0x5c786252},{0x01c1f4f5,0xd0eadb61},{0x01e1066f,0x4928c2f1},
+{0x0340161b,0xaf315445},{0x0241898c,0x349279c4},{0x0341d219,0x7a43bed0},{0x028e006d,0x82c23bbd},
+{0x0260aa82,0x3da5614b},{0x01802aeb,0x60987fcc},{0x03c1df02,0x7d040fd3},{0x01c10294,0xd0e1272b},
+{0x02802578,0x95e853d9},{0x02c1320f,0x6c751030},{0x03e18bc3,0x1feceb7a},{0x03c00f0c,0x29b9dd83},
+{0x03e1244d,0x1b0ea84d},{0x02e1449e,0x9f0857fa},{0x02e1681b,0x77d76709},{0x028105bb,0x582fc7f4},
+{0x02000ae8,0x13a1852b},{0x02c021a9,0x74699cd7},{0x02e017f4,0x889621cd},{0x028001ca,0x2a4946df},
+{0x03a12112,0x72972af8},{0x0521d828,0x56765915},{0x0281044a,0x9efbda31},{0x02200b57,0x8092a79a},
+{0x03e1d571,0x63f4f9ab},{0x03c1d472,0xf9230c87},{0x0241b00b,0x491ca010},{0x04801d1e,0x0ba6f8bd},
+{0x03a1cf94,0xfcc0b1da},{0x01616a4d,0xe459120c},{0x0360240b,0xafc21c79},{0x03401d65,0x07cbf179},
+{0x03e18c48,0xfb9aaa5b},{0x02a02885,0x3f1396d8},{0x04a1d9a4,0xad77d1ea},{0x01a0a4db,0xb1400330},
+{0x02ce0046,0x6d3c6611},{0x0541f894,0xe3f193f5},{0x052124f5,0xe8ea1bb7},{0x02400e2a,0xe6cf560b},
+{0x01e00c90,0x293372e5},{0x03e18b56,0x9bc880a7},{0x02418aea,0x680d4b6d},{0x02001b2b,0xfeeffb5c},
+{0x0521242f,0x15ef7a05},{0x02202be8,0x97ff9a28},{0x038015b9,0x0bb158f6},{0x0320a7b0,0xaff644ee},
+{0x03210a48,0x2db2e89f},{0x03c00466,0xc3d29a77},{0x0261b0f3,0xb2cc8497},{0x024019d4,0xe3d48702},
+{0x04c1d06b,0x173e4ffd},{0x0461eebb,0xe013bcd1},{0x03800944,0xd977aa7a},{0x02c1118a,0xe80ad484},
+{0x04400270,0x2368a82d},{0x04e0fdfd,0x7ed08af8},{0x024012a9,0xd4e89fa4},{0x01c00ec1,0xe981151b},
+{0x038101d2,0xaaeabc70},{0x0101f9ae,0xe38c01a3},{0x02816a08,0x362cbc0c},{0x0181e29b,0x7694d9bf},
+{0x03c1d55e,0xeb25623e},{0x0200aa40,0xe1c58da9},{0x01e00f67,0xc16a1d45},{0x02800e2c,0xac2872ac},
+{0x0341e834,0xb74303c0},{0x03010a97,0xee952c30},{0x03602a70,0x0ca31728},{0x02e02873,0x9a45c971},
+{0x0381ee57,0xc7e440e0},{0x030010be,0x01cb6390},{0x030002bc,0xf691f669},{0x02c1d192,0xf4cb0857},
+{0x02602e17,0x985904ef},{0x03010a86,0x962e7007},{0x020024ea,0xef64c1f2},{0x042006ae,0x7f1876bc},
+{0x04201edd,0xa30bff82},{0x03c00695,0xa54dcd84},{0x05c115d7,0xb1e5e44e},{0x0320113a,0xd2b82835},
+{0x02402e89,0x235f4e9c},{0x01a0a3a7,0x7d431c8a},{0x03c1d73c,0x0ddc310f},{0x0341e83e,0x12930082},
+{0x01e112a6,0x2d70f498},{0x02c133b7,0x9713ab3a},{0x03216e51,0x5a853880},{0x02418998,0xaccb35c2},
+{0x03013414,0xc3de45cb},{0x03a0facd,0x0f6bdb9c},{0x0300abe2,0x5ace99b4},{0x0300213e,0x78d0bec5},
+{0x0301f038,0xcf65b94a},{0x02a1087f,0x82ac4698},{0x04a1d8ce,0x69af0522},{0x0260107c,0x83a90961},
+{0x0501d9e1,0xd7ddf9d3},{0x02410ac6,0xced19ea3},{0x04001d8d,0xb660c5aa},{0x04402e01,0xca5ab27b},
+{0x01a0a5c9,0xd10a0364},{0x03401db7,0xd561c5bf},{0x0340023d,0x047ef256},{0x02a0184e,0x0a15f14f},
+{0x02811d13,0x0593aff9},{0x01e01a43,0xa9c449bc},{0x02e11370,0x6459cfbd},{0x0261f471,0x41c36ca5},
+{0x02e02048,0xb4962fc7},{0x0160262e,0x032c65e9},{0x02a16883,0xc153a0fa},{0x0441f15d,0xdf4f481e},
+{0x0220204f,0x36fc6f34},{0x0260122f,0xc2eb49ee},{0x01816f01,0x317b52c2},{0x02000f20,0x532f6b05},
+{0x05c01f0f,0x6f03285d},{0x02a0a826,0xf7756185},{0x02c132cd,0x67987c13},{0x02c13209,0x75775cf2},
+{0x0521d796,0x89b84de4},{0x038168b0,0x728be511},{0x02e00d0c,0x2530228b},{0x0181162d,0x40140746},
+{0x026012f8,0x9a291c53},{0x01c02ecf,0xcc4f5bbe},{0x0361e835,0xa9c60ee5},{0x02e131d5,0xbc19ee8d},
+{0x0580fd50,0xae5ae2a4},{0x0361d91c,0xf4a23222},{0x00e025ca,0x281a5ba5},{0x0361686b,0x9d6ecdff},
+{0x01a00eb0,0x2236f95c},{0x01c00b37,0x5165a18a},{0x03a014e9,0x26b1feb7},{0x01c0a073,0x032687ea},
+{0x02601490,0x3c9115b4},{0x00c1fa9e,0xdab5acc2},{0x01c0a43e,0x9dcc5d90},{0x02418aa3,0x539d0e6a},
+{0x02a1043c,0xf1800ef2},{0x03810c97,0x14453237},{0x0240a9e5,0x58f707aa},{0x01e00841,0xc5b5a87b},
+{0x0220aa4b,0x13ea7ae6},{0x01c11813,0xba86ad98},{0x03e1d606,0x8205da36},{0x02c10590,0xd2d854cd},
+{0x0340322b,0x33bf5fac},{0x02c028b4,0x732b25fa},{0x01e02a3c,0x60c29324},{0x026169fb,0x7d49003d},
+{0x05c0fd6b,0x59f3f20f},{0x02c00359,0x5e31cfce},{0x032002ca,0x1b123ee2},{0x0320224e,0xf3e229b5},
+{0x03c109b0,0x52de2887},{0x038002cf,0x623da588},{0x010e007e,0x22310a03},{0x03e01eb8,0x2a220b6a},
+{0x02602052,0x67185998},{0x0360014d,0x442bd2c3},{0x01c0204a,0xd3190bd7},{0x026016f0,0xed6fac57},
+{0x01a007c7,0xd254dcd9},{0x01402012,0x2929f891},{0x02c00d55,0x323e2afc},{0x01811651,0xb33bc0f9},
+{0x03c1f211,0xdfe0dfca},{0x02c131f7,0xf57ca3a0},{0x01a0a559,0xe6e31696},{0x028002b8,0x778c949a},
+{0x01a0a2d2,0xe0776df6},{0x02e1f57e,0x864ed427},{0x03c1d565,0xf4257069},{0x01e10733,0xf9765d6c},
+{0x01c0a356,0x115a0a5c},{0x028e0193,0x81605424},{0x02c1d425,0xd197d95f},{0x02c13126,0x6c0f428d},
+{0x01a0a10d,0xf2949986},{0x02c10acc,0x73ef453b},{0x0301d45f,0xb8ca1cf6},{0x02400e30,0xb12bb05a},
+{0x03e011c4,0x7e77afb8},{0x03e004c2,0xa790a442},{0x04e01e9c,0x21d4a40c},{0x02c132ab,0x460702f8},
+{0x03c018a0,0x6c78524b},{0x01c16f2f,0x976237ae},{0x0601cf15,0xd136147a},{0x0360046a,0xe9eff4d9},
+{0x02c13027,0xf8249843},{0x0601d8d7,0xa33bd151},{0x01a0a292,0xac524b41},{0x02e003e8,0xa65f2f35},
+{0x01a0a531,0xcf0a003e},{0x024189f8,0x3433d909},{0x01e10689,0x4337c409},{0x02a11d23,0xa29db7f5},
+{0x03e1d57b,0x79f51c4d},{0x01c1e2c8,0xd360019c},{0x02e1d313,0xf616b4e4},{0x0381e8b7,0x17ee1a88},
+{0x0341f148,0xf400ff23},{0x05a023c2,0xb3fb4cb3},{0x02a169de,0xc72bfd4a},{0x026112c9,0xfdbc58e2},
+{0x03200188,0xa150f5aa},{0x022112b5,0x048353b3},{0x022111c9,0xba99234f},{0x02801090,0x28b865a3},
+{0x040109da,0xfa984c9f},{0x02c009e0,0x5d33153a},{0x0240aaa6,0x74c4364e},{0x028169e9,0x8ba811af},
+{0x0280132b,0x8b72d81d},{0x0241884c,0xfb8bc7e7},{0x02a119dc,0x8125079c},{0x01e11695,0x09184739},
+{0x04a0fc05,0xbbd1b855},{0x02a11ae4,0x60c89a62},{0x030024dd,0x44b69b20},{0x0420094e,0x1b285502},
+{0x01a03163,0x560e99b3},{0x02c13344,0xd0ba22af},{0x02418823,0x7a820278},{0x02816a36,0x0d1cb048},
+{0x042021ef,0xadf7ad15},{0x024189b9,0x1bc15723},{0x02e0229b,0xb1c71f53},{0x0380015f,0xf842d06d},
+{0x01e0170a,0x882cec49},{0x0441cf18,0xc3184de4},{0x0240183e,0x9fce44fb},{0x0261b0d4,0x68d5dca4},
+{0x00e1f9ed,0x3203580f},{0x02e02867,0xfc98387f},{0x024188fa,0x8f1a9cb9},{0x03401de4,0x321b71e9},
+{0x04c1f8aa,0x7eeec433},{0x02c021dc,0x40bdb31d},{0x02c13091,0xad289d92},{0x01c0a5d2,0x64ec16a6},
+{0x02c13325,0x6b12745c},{0x01203306,0x45e4b8d4},{0x02602f9f,0xe3b064df},{0x0241047c,0x77367b60},
+{0x02e0a9b5,0x326ac717},{0x0240117f,0xb1053865},{0x01a0a1ed,0x660dead3},{0x01c0a11e,0xc28c5d69},
+{0x0461f872,0xfa00c15b},{0x02400ae9,0x1b324461},{0x038015e5,0x4494a60e},{0x0341f73a,0xd970f396},
+{0x0120339b,0xbd963553},{0x01e017c1,0x2d249d49},{0x02401292,0xdcef6801},{0x02c02151,0xf510dded},
+{0x02001006,0x3a90ae4e},{0x018022d0,0x0b1564da},{0x01e0a901,0x2db3af9d},{0x0301f0b8,0x2e4ad0de},
+{0x0180a3c8,0xaa809ace},{0x0381da55,0x0167d08e},{0x02400f73,0x6af85718},{0x01c0a072,0xf7267506},
+{0x02e0039a,0x3cc91bfc},{0x03011a27,0x2e67087f},{0x02e008ca,0x879e7505},{0x026121b5,0x4ac3dc98},
+{0x0201163d,0x27c451cc},{0x0280224a,0x38d43a25},{0x020030e1,0x5cd25f89},{0x02401937,0xf6fcf162},
+{0x02e1462e,0xd9c44d75},{0x04a02c55,0xb0f0d40f},{0x02401280,0xd108ed03},{0x02a16823,0x3165db93},
+{0x02402f11,0x5a05e7a6},{0x0240a894,0x41e5c8a3},{0x01e0a174,0xe9f71d7f},{0x0280128b,0xeefe2b77},
+{0x02e1323a,0x6472365b},{0x03c1f238,0xcd1f1e97},{0x0520fd71,0x9b785970},{0x02000851,0x5bce5ac6},
+{0x02211142,0xf4acd073},{0x0381013c,0xb9a15fe1},{0x024012aa,0xd8e8a5f0},{0x0201060c,0x9b2fe78c},
+{0x04000fc3,0xc6cd1aac},{0x03210cee,0x709a9a01},{0x01e00c36,0xb4e74fe1},{0x0081f56e,0xab4e9d38},
+{0x020022ee,0x5d2ba3a0},{0x02e0041a,0x94559960},{0x03802355,0xbd26f042},{0x028169ec,0xe22c0aa5},
+{0x01c0a38e,0x8b7ffae6},{0x02c0228a,0xd8f71614},{0x03600252,0x22bf09be},{0x02418988,0x30927378},
+{0x02401840,0xee422832},{0x02c13200,0x007a765a},{0x024189e1,0xa3deaf4f},{0x0240a8ae,0x05c09956},
+{0x02c009e1,0x83696b06},{0x03200271,0xaf634010},{0x02a1696b,0xffbdb103},{0x02800796,0xffa49fbd},
+{0x040025f4,0x5ac3cdf3},{0x0181f90f,0xa9b11e8c},{0x0481d026,0x9d572f75},{0x02e1d365,0xd04ce0bc},
+{0x02002078,0x99e1038a},{0x02602e4f,0x1a5ae16f},{0x0301f03a,0xcd65b624},{0x0361053f,0xf69ce8d0},
+{0x0281d115,0x326a281b},{0x0240d7b8,0xf0b72b3f},{0x0161f49b,0xaa39911f},{0x02a00c8c,0x53d75be0},
+{0x03e1f8a5,0xb39ce903},{0x01a016f3,0x1b905178},{0x02e02d1f,0xeaa9a4bb},{0x0600fef6,0x19df45b4},
+{0x0341d6c5,0x2e396c3d},{0x04812469,0xb0822e6f},{0x02c01b4a,0xfa3e0f3a},{0x01a0174d,0xcc2553e4},
+{0x0240fe07,0x5c688619},{0x02a0156b,0xd2d7c5a3},{0x038006f4,0x75d661c6},{0x026124e5,0x75d2ac3b},
+{0x0220266b,0x107fc57f},{0x04000171,0x78a570de},{0x04801fc3,0xd8842d88},{0x02e0285d,0xf6703be4},
+{0x02200686,0x37f05cc9},{0x02600b0b,0x31a48244},{0x01e0033d,0x8c3a7954},{0x010026f5,0x18d7c162},
+{0x03200675,0x96c58b7a},{0x02200c4c,0x7199b5cd},{0x014e005f,0xc37d7089},{0x02201b97,0xc8a94b5a},
+{0x024008f0,0x424c7bfa},{0x010033b7,0x60b059c5},{0x020103b4,0x6ec427be},{0x02c0076a,0xbef3f6a6},
+{0x0281f6a9,0x98f76f31},{0x02800deb,0xdeeb8c43},{0x01e10685,0x4f37d6ed},{0x03e12317,0xff06fa62},
+{0x01e115ad,0xa15d5ddd},{0x0220aa42,0x4805103f},{0x034027fc,0x89f4d2dc},{0x0281fa20,0x49078601},
+{0x01a0a0d1,0x18e03a02},{0x01c02664,0x5d74af1e},{0x02e01121,0x8e78451b},{0x0281697b,0xb9b2fbc5},
+{0x0260124d,0x270222d3},{0x01e1120f,0x960b8717},{0x02600a48,0x81a91947},{0x01a1f931,0x099e8010},
+{0x02418aee,0x660f86de},{0x028003e5,0xa6a359de},{0x02418927,0x20247b58},{0x01a02ade,0x1ac74705},
+{0x0200176c,0x3cf2c4aa},{0x0501d02b,0x8cc3b8da},{0x04402a88,0xcf32decb},{0x02a03286,0xa14ef133},
+{0x040109e4,0x0c3cccfe},{0x0441f15c,0xde4f468b},{0x0220080f,0x09243296},{0x01802300,0xce3c3e47},
+{0x0381f67a,0x58e619be},{0x02816890,0x2c38d7fc},{0x0341f0c3,0x260a84cd},{0x03e10b60,0xb4716ae9},
+{0x02610382,0x8f521f81},{0x03200235,0x95bc8400},{0x0321da40,0xa4a3f5ed},{0x022122c3,0x35d3f09a},
+{0x02c10d18,0x7b3bbc5d},{0x0241202a,0xc26c4b8c},{0x0441d744,0x64a1d794},{0x02010603,0x1b32efa3},
+{0x03203221,0x57546412},{0x02a12093,0x6245815a},{0x01816f3b,0xe18e5c8a},{0x03203211,0x7fd3f38c},
+{0x02616a19,0xf218af3b},{0x03002a11,0xb32d33f5},{0x0381104c,0x655ab452},{0x060006d6,0xa7cd62e5},
+{0x01a0a4d8,0x484df6f8},{0x0301f5aa,0x2f601062},{0x02e028d5,0xd3fdaa40},{0x01e0a506,0xee8f341f},
+{0x0621d0b9,0x7f930d99},{0x04600f03,0x9603d7e5},{0x01e10765,0x77ff1288},{0x03411ae7,0x5f7eab41},
+{0x02a0035e,0xaa00f07e},{0x028119cf,0x779075ac},{0x01e01752,0x5eae42fe},{0x04001d6e,0x32b5e613},
+{0x03e18cca,0x4987403f},{0x02418913,0xa0163a4e},{0x03202a89,0x158234f1},{0x01a0a11d,0xcfc890b4},
+{0x044025a6,0x4d858352},{0x02a019c5,0x262ca828},{0x01e10710,0xf5650dff},{0x0380feaf,0xb3213b3a},
+{0x02800fd6,0xe3f8a8bd},{0x03212378,0x314bffe4},{0x0280215f,0x0e1ec82e},{0x02800dc4,0x78ab03f3},
+{0x024188c7,0x1c132beb},{0x0301f704,0x2a9ba692},{0x03411a39,0xb16604ac},{0x0321d52d,0x20a19695},
+{0x0381d485,0xc220141b},{0x01c11d98,0x09065852},{0x0361225f,0x02942842},{0x02e1fb75,0x5b0cb5ae},
+{0x03801a56,0x60e33e66},{0x0241031f,0x3184b277},{0x02e027d2,0x3ae7fca6},{0x0240aae0,0x72fb0328},
+{0x03e18b3b,0xcfd7dd0d},{0x02a105ac,0x840e0d9c},{0x0361e810,0x467c3a87},{0x0301f046,0xf2371f54},
+{0x04e1f816,0x35a6c2ef},{0x01a0a196,0x823c68a4},{0x02603002,0xdf4c3ff1},{0x01a0a460,0x5e349430},
+{0x03e18c09,0x82a4793c},{0x02200074,0x35577a74},{0x01e12049,0x440c4cd1},{0x028e0066,0x77c22a6c},
+{0x022010e1,0xf5f3a16b},{0x02000a28,0xf9e22c06},{0x03c001ee,0x8e19b997},{0x03000f6a,0x38766f83},
+{0x026000f0,0xcdd02de3},{0x01c022d1,0x00cfe051},{0x02c10c06,0x4592f1a2},{0x02e144d0,0x1e236364},
+{0x03203230,0xe7eb0dc6},{0x03a02b40,0x0525c31f},{0x018022ac,0x537ee809},{0x01e10b2c,0xd55735d0},
+{0x0161f439,0x0e4af1c4},{0x0360158a,0xe72ccb3d},{0x01a0a429,0x0f20f76a},{0x0280ffed,0x4bda763c},
+{0x02a1d34b,0x1111c9fb},{0x0280152b,0xc0ab28bd},{0x038107ac,0x60b4ae37},{0x020013eb,0xf81b3fad},
+{0x0301f7cc,0xd897e2f6},{0x02211ac4,0x3ad8226e},{0x0240abec,0xb6789187},{0x03c1d168,0xd4ad8943},
+{0x08e0fbf9,0x25465c4f},{0x02e02e53,0x3bfa71c2},{0x028014dc,0xa81bb630},{0x036118ba,0x2eddbd30},
+{0x01e0aaf2,0x923bb617},{0x02c168bf,0x9f81aaec},{0x01a0aab4,0x4b3b438d},{0x01600ed6,0x1a675b5c},
+{0x02202466,0xa6df6a15},{0x02816903,0x94b63f3f},{0x028e016a,0x786ad355},{0x0421d627,0x34b1cd60},
+{0x0461d777,0xa8dba47d},{0x02810aec,0xb888471d},{0x02401201,0x04e09c6f},{0x0381ee29,0x522951bb},
+{0x03e12511,0xd8009b0e},{0x0381099d,0x7615bacb},{0x02a0110f,0x194e4085},{0x0300ffce,0x014b0b14},
+{0x01c01d25,0xa0e1665f},{0x03000f95,0x26aa94e1},{0x0381d491,0xb6200137},{0x0261219c,0xf587d537},
+{0x04001d74,0x0827419e},{0x02802bb7,0x30bc01dc},{0x028e01d0,0x99d2d60a},{0x02202f7e,0xa0f1ff73},
+{0x02a119da,0x8b25175a},{0x0180a052,0x8e867ee8},{0x02418aaf,0x4f9ac987},{0x04801eae,0x7c260c67},
+{0x02e1447d,0x0d0fc0e9},{0x01e1f5b8,0xe8338e5f},{0x04a025ea,0xf2486784},{0x02418a96,0x509f4848},
+{0x0381d501,0xd0cfa710},{0x01c0a501,0xab8be4e5},{0x0381ee21,0x907442de},{0x0220337f,0x9e9dc384},
+{0x02e13367,0x146ee67f},{0x0261f391,0x80c81123},{0x04c10154,0x964e937c},{0x04002c67,0x315497ee},
+{0x03a0fd4d,0xb0339476},{0x024009c0,0x7d65afe9},{0x02600e27,0xd8efb267},{0x02816b0f,0xa635eef7},
+{0x0220090f,0x68800c02},{0x024014bb,0xa54bddb3},{0x0341d4af,0xc47c85a6},{0x03210433,0x17908c40},
+{0x01e0a368,0x14736da0},{0x02411acf,0xd7fe73c8},{0x02610f53,0x019a2ea0},{0x028e01a0,0x046360f4},
+{0x03c01678,0x36e957c5},{0x02c02836,0xb17824f8},{0x01a0a40c,0x5eba068f},{0x0361f734,0xd8df2637},
+{0x03e18bbe,0xcdea2bcd},{0x0121f42f,0x0edd4639},{0x02602cab,0x0e0e7407},{0x00c1f528,0x1ac69447},
+{0x00802699,0x7858cf6e},{0x01e0304a,0xc1810b9f},{0x03e18ba2,0x10e856af},{0x03a0024e,0x843e27fe},
+{0x01c01be2,0x002580b1},{0x01c1f38d,0x5fc5b2fd},{0x01c0a1c3,0x4ab5885b},{0x01c0a14c,0xf04d95b6},
+{0x02401694,0x7f282786},{0x02c02893,0x1d9f04ce},{0x01a10e64,0xc1fc3d67},{0x01a16f91,0x8867740c},
+{0x01002205,0x256b0ad6},{0x0281e906,0x4ef57cb1},{0x02a1f7c2,0xd03a3471},{0x02c130a4,0xb12d210c},
+{0x0281d34c,0x1abf0a38},{0x01a1092d,0xa9bf78b0},{0x0200aa49,0xd8c57f7e},{0x00c1f422,0x8fdb9e1f},
+{0x0241887f,0x87e329ec},{0x05400c7b,0xbb720503},{0x01a02e41,0x7986f1c2},{0x02e1334c,0x0f942a1a},
+{0x0361e895,0x88fa0765},{0x0341053d,0x8b1b9ff1},{0x0280a4fd,0x4b0eeb41},{0x0100228c,0x72594142},
+{0x026124e2,0xeada202f},{0x02810a02,0x38288887},{0x0581d83c,0x49c3af05},{0x0521243d,0xe86ddbfc},
+{0x02001822,0x4e7e8296},{0x026122ff,0x01b55295},{0x02016f60,0x4e7ca460},{0x01a1f333,0x8433c766},
+{0x02810441,0x94fbca73},{0x04e01fcc,0x91dc7c2f},{0x04a00488,0x03dfbff6},{0x024003bc,0x9a36ad74},
+{0x01a0a34f,0xe254deda},{0x0221134d,0x709e11b5},{0x02802dac,0x891eff64},{0x03a01ef5,0xfa90e0ab},
+{0x0321e132,0x0bb09137},{0x02418aed,0x670f8871},{0x05801f06,0x4b6aa48f},{0x02c168ad,0x420b107a},
+{0x01a1f393,0xcdd83c9f},{0x01a007ae,0x9f73637a},{0x01202208,0x2cdeb54a},{0x03e021bf,0xb4ea8059},
+{0x04602350,0xf7f15a37},{0x024189ac,0xa8cfaca4},{0x032122cf,0xe5d42ce2},{0x028032a2,0x998782a3},
+{0x0280a80d,0x7c2ca572},{0x0121f12e,0x971011ce},{0x01a0a2e0,0xec7780da},{0x03601633,0xf85e5e57},
+{0x02c0185a,0x9f733b6d},{0x02c0283c,0x52f80900},{0x03c1cf72,0xc3b4a400},{0x02000bbe,0x87fad2ba},
+{0x03812143,0x723ab74f},{0x03610cab,0xcc99342f},{0x02210345,0x7798cc5a},{0x02602f2b,0x1143e679},
+{0x02c13070,0x149e1bc4},{0x02e1458e,0x71326371},{0x03c1f1ee,0xb6244fb4},{0x03a1e021,0xae0085ed},
+{0x01c02ee3,0x92c0c8db},{0x0341250f,0x71ef68e0},{0x04c1d924,0x38d540b7},{0x02200909,0x587ff2d2},
+{0x0280280a,0x0d8ffb66},{0x01e11154,0xa2595805},{0x0341e84f,0xb046bbc4},{0x01e1049c,0x8128c929},
+{0x01c0a3b6,0x63149371},{0x02a1695e,0xa5d23a98},{0x05001fd3,0xf057625b},{0x01e10488,0x71061db7},
+{0x04a0fc25,0x314f04b0},{0x01c0aa10,0xfc321114},{0x03610c96,0xa3c00314},{0x01e106ee,0x3ec48548},
+{0x02e10082,0x0631acc9},{0x0381241e,0x9af176ef},{0x0341da44,0x96e8eeeb},{0x04202787,0x50b2644c},
+{0x0180a3ee,0xa445fa34},{0x03e1ecaf,0x833afd72},{0x01c1181f,0x958f9aeb},{0x02000a9a,0x63c1062e},
+{0x0380ff25,0x46eccad9},{0x024027f5,0x67191d2e},{0x00e000a5,0x4bada252},{0x02e119de,0xc0f514b3},
+{0x0260a8d0,0x1f651e2e},{0x0281fb8f,0x8905b851},{0x0661d823,0x26d660e9},{0x0281d33a,0xf060f8af},
+{0x020005bd,0xdca3082a},{0x0621d99d,0x7029e900},{0x02616957,0x1c68d331},{0x0240aaa2,0x349f00b5},
+{0x02a0ab7b,0x25478d5c},{0x01e11034,0x82803f69},{0x02c132a2,0xd75d07e3},{0x0261235e,0x3ee2aa8f},
+{0x02c029ee,0x283d5f05},{0x03011c9e,0x0ee1d9dd},{0x02010627,0x2d287e9d},{0x01802b93,0xe96584bf},
+{0x01602295,0x20defb0b},{0x02e1da39,0x07595181},{0x03000724,0x30abb7af},{0x020103a4,0x6ecc7683},
+{0x0361e875,0x1ecdb786},{0x03004dc3,0x4407e6d7},{0x02011ad5,0xce0a1594},{0x0601d99b,0x895f88a9},
+{0x02010e80,0x0c4a4013},{0x01c0a24c,0x3f4a7671},{0x02602b0c,0xb1cbce7e},{0x01c0a6c8,0xfae77601},
+{0x0441225c,0x43a45d08},{0x0440fcf1,0x891f05b9},{0x03c1f597,0xe9c23830},{0x02a00585,0x72c84216},
+{0x01c0a43b,0xa1cc63dc},{0x01c1fb1f,0x422ed2cc},{0x03210ccf,0x5a9a775f},{0x0341d6ae,0xa6ca3fae},
+{0x02c021f1,0x4462f924},{0x06c0fe18,0x359c2f24},{0x0340d7d2,0x65938e3b},{0x0240d7c1,0xe45ad1df},
+{0x0121f14a,0x417021f4},{0x0300111f,0x3291b9c8},{0x01a0a2dd,0xe277711c},{0x02810f20,0x78c57658},
+{0x01e1f491,0xa3bd22c7},{0x03a12264,0xe35c0860},{0x0401d7d9,0xf452d5bf},{0x01e106b5,0x3cb33901},
+{0x01e0a85b,0x7442a6dd},{0x028027a1,0x06435d32},{0x02a00437,0x25c2a5ea},{0x04401f19,0xfaf24289},
+{0x016022ba,0x6fa30039},{0x01a017e2,0x842b55cf},{0x02202fbb,0xbdf8fd93},{0x02c10095,0x9bec783e},
+{0x0301690e,0x458b4fe3},{0x04a0fc38,0x036aa27c},{0x0540fd7f,0x29d92a3e},{0x02211c51,0xab7e4b85},
+{0x03a1233e,0x6f43561a},{0x0180a1c9,0x8454d25e},{0x0281d34d,0x00b7be85},{0x0461d61e,0xe6a2f46e},
+{0x0181f38a,0x3295aa2c},{0x03e006ca,0xa4fedd29},{0x0261d345,0xbb395234},{0x0481d05e,0x322fc4d4},
+{0x02801434,0xbb3091aa},{0x02e144e3,0x8da72a3a},{0x0281f3b6,0xdbb022ca},{0x02a000fe,0xbc638f85},
+{0x03a1f671,0xd71e385b},{0x020013a6,0x8ff38c85},{0x0260202e,0xef170cfd},{0x04e1d63e,0x06e1af3d},
+{0x01e1050a,0x3da4d40d},{0x03c02188,0x3c0d1cb6},{0x03e0049f,0x27c8fb3b},{0x01c1f9ec,0xf48fa58d},
+{0x020013b0,0xb20f9888},{0x02e0ffcd,0x9b910559},{0x02011042,0x32b5d15d},{0x02011327,0x3f3c6c11},
+{0x03410b8a,0x8b91bbfa},{0x0341e82b,0x36839efa},{0x01c0a32d,0xd56dadf8},{0x0360322e,0x6fd34773},
+{0x042006b4,0xafdc8438},{0x01a0297d,0x7884a219},{0x02600043,0x6f152a08},{0x02e168c8,0xa5917651},
+{0x02802a1c,0xd5e9a41e},{0x02c1232a,0x7064f7d8},{0x02e1058c,0x967e403a},{0x02c1d42c,0xe697fa6e},
+{0x0260123a,0x07cb4ae6},{0x01c0a2e2,0x01f8a1f6},{0x0441f174,0x6a45bafc},{0x02c130a5,0xb02d1f79},
+{0x03801441,0x63cfb292},{0x02a003e7,0x063b8e8f},{0x02010650,0x30966246},{0x022032f0,0x170dab83},
+{0x0301da82,0x53b71b75},{0x05a02bef,0x1e65f48a},{0x01a01746,0xe816756e},{0x0380316d,0x5621786c},
+{0x02e1cf51,0xe6ccfe0e},{0x02c132d6,0x4b47ac85},{0x03c000f6,0xc3dd094e},{0x03e18b72,0x07cda7d9},
+{0x04a0fc46,0x2b64153c},{0x02000b4c,0x1e219f3d},{0x02612358,0xc2ca8fc2},{0x0381ed14,0x6857cfa5},
+{0x02418981,0x3390399a},{0x01a0a4aa,0x34186b52},{0x02811957,0x7295e780},{0x02c10046,0x4d76e3c0},
+{0x03601576,0x47c1515c},{0x02202f05,0xce75c336},{0x04a01b75,0x1a9a710d},{0x03001dc9,0x36ec00b4},
+{0x03e021b6,0x94c8588f},{0x03010a85,0x95a8f9fc},{0x02e12532,0xbb7a1c8e},{0x0301f0c6,0x7cfbc3ad},
+{0x0181f319,0x6a0bfb87},{0x02211a54,0x15980426},{0x030122b2,0xe1f109ce},{0x01a007aa,0x9b9f1d9a},
+{0x02418831,0xec87331c},{0x0121f14c,0x35815831},{0x02c133c2,0x9b15f01d},{0x022112d8,0xd064ecc3},
+{0x042004c1,0xe5087ff9},{0x02401810,0x85ba296a},{0x02418aae,0x449ab836},{0x01c0260e,0xb6a696f0},
+{0x022101a0,0x17c148c2},{0x03016811,0x2a07b141},{0x03a12201,0x0ebfe7d3},{0x032169d1,0x71ddedef},
+{0x03a01e0d,0x85265d98},{0x0240a9d7,0x8a7e8ad6},{0x02a16a2a,0x259e661f},{0x01a11083,0x55b0c2b6},
+{0x0081f68a,0x57e978f1},{0x02c13308,0xfa0d454b},{0x020009dc,0x7a11cf18},{0x02601256,0x31137bb2},
+{0x02011fe7,0x0bdd6cf6},{0x03201abb,0x283da4bc},{0x03e18c3a,0x6a9d97af},{0x01c0a15a,0x2b574310},
+{0x02e0028c,0x777999f0},{0x0260117d,0xd0010100},{0x02001b2d,0xc6cad25b},{0x02003077,0xa859cf21},
+{0x028e01ec,0x93df988b},{0x03202eda,0xa95116d8},{0x02ce004e,0x653c5979},{0x0421d23c,0x4e6bf60e},
+{0x01a11618,0x3f3c9b19},{0x02001c67,0x16875a46},{0x02c13165,0x3abe51f0},{0x02e028ad,0x73733f42},
+{0x03612524,0x938657ca},{0x04c033fd,0x2b51f5eb},{0x02e1fbc8,0x379fb87d},{0x0661d9c6,0x9ec734cc},
+{0x00e025c9,0x8354f3fc},{0x02e12181,0xce38b41c},{0x02401279,0x04fc72ec},{0x02811d70,0x569cad1c},
+{0x038014b3,0x63182069},{0x02c1f251,0xec87d1de},{0x02c03149,0x0e12daed},{0x01c00beb,0xb63df459},
+{0x01e11a74,0x70627707},{0x0421d078,0xcf68bf3f},{0x02802b95,0x4ac79288},{0x03001c7a,0x512d5591},
+{0x01c0a416,0x7de90507},{0x028011bc,0x771a2624},{0x0201060f,0xb22dcd2a},{0x0460fcc2,0xa9a90bbd},
+{0x02e13234,0xc86eb10f},{0x02e121a1,0xb79c7e1d},{0x0101f966,0xdc5501c2},{0x02a0a874,0xa2108bae},
+{0x02011318,0xff92ea20},{0x032001a1,0x676088b4},{0x04a0fd39,0x7fae732d},{0x0201206e,0x11e0928a},
+{0x02c02cac,0x414769ad},{0x0341d70f,0xca0d44b6},{0x02e0a9fd,0x73fd3812},{0x02602e36,0x94e48e33},
+{0x04801e4b,0xf8d51f71},{0x03a0faad,0xd36ffa56},{0x03c0013b,0x3db09679},{0x05a1fb56,0xb4a11f2d},
+{0x02002f97,0xfb6712db},{0x0400112c,0x6536f35b},{0x02c12384,0x983eec15},{0x01a0a037,0x261bcfcc},
+{0x026e013c,0x16a1b109},{0x05a0fd61,0x6ce650ea},{0x0161fab4,0x19b539f6},{0x02e1441a,0x1e7dba9c},
+{0x03201d01,0x91c6fcca},{0x03c021b2,0x1f4c21ba},{0x03210ce4,0x739a9eba},{0x02011a5d,0xbf45b8a1},
+{0x04a0fc1a,0xe8ca793e},{0x0240248a,0x4adc1ec7},{0x02a015a5,0xc866f8ce},{0x02002f38,0x26b0a26f},
+{0x01603340,0x16aa3226},{0x02200849,0xd6e7fc68},{0x0421d239,0x4a6befc2},{0x03002a7d,0x78581f34},
+{0x02c13404,0x1a7611bc},{0x03211ca2,0xd7bb575e},{0x02a1bc67,0xaa230e63},{0x030028bd,0xd4b0835d},
+{0x01a0a500,0xeb0c6ae9},{0x0381ee1e,0x1c41a180},{0x02e16842,0x5310d2e9},{0x02e10cfd,0x9ccad310},
+{0x03a10b9c,0xad5d41d6},{0x03401e7d,0xad1809f0},{0x0441f179,0x7145c601},{0x02a00e1c,0x711de5ed},
+{0x0600087c,0xfdc2d0c7},{0x02e168e9,0x7bfaf7d3},{0x0240258f,0x4f8272ba},{0x03a0ff67,0xb16cc9e8},
+{0x01c11436,0x59e8e3d3},{0x01e10764,0x78ff141b},{0x03e18b9c,0xcebe4394},{0x0221209e,0x4b93ded4},
+{0x01c11012,0x4a5fc1a4},{0x0260202d,0x098df951},{0x01c1121e,0xc2ed55be},{0x04e1d64c,0x14e1c547},
+{0x02c0a82a,0xdcbcdd7b},{0x006022bd,0xa5ee3e38},{0x01e0a8fa,0x9f09518e},{0x02e145e3,0xe5f74af3},
+{0x02600661,0x69c8e249},{0x0341e927,0x77b4594e},{0x028119b2,0x4eb16199},{0x0361f655,0xac71daa5},
+{0x03200fa5,0x5c849d44},{0x02816a21,0xed5dfde9},{0x022013bf,0x3b8ffbae},{0x02e00391,0x676584e7},
+{0x02010a3f,0xd4ff522a},{0x02c133ed,0x1a785053},{0x036027da,0x8d9e0874},{0x02a02f67,0xeb53d274},
+{0x02401300,0xbce63b45},{0x0361d505,0x03bc3cf6},{0x02e1f0b9,0x5be6206f},{0x02a00567,0x76aeb07c},
+{0x03002a2d,0x035e7627},{0x02c168a3,0xe81ebfb6},{0x01801967,0xe0a14a01},{0x034002c8,0xb1ebe458},
+{0x0361bc81,0x661b68b5},{0x02a02d04,0x043cf2cd},{0x01c1f4f4,0xee7214da},{0x02e1d90a,0x59b6f3b5},
+{0x01c11228,0xf3012906},{0x01802e40,0x70b3b25c},{0x01600ed2,0x0f67a386},{0x03e02ce0,0xd9c74f83},
+{0x02400d37,0xe382f2c9},{0x02a119e3,0x7ef01bb3},{0x02e1212e,0x3d625fb9},{0x03e18b9d,0xcdbe4201},
+{0x02c0185b,0x3c239689},{0x0381f53d,0xedafda45},{0x03611a93,0xf106ef32},{0x02800a8d,0x3ab92873},
+{0x02e1443e,0x2070f1cf},{0x030144f0,0x6d16839c},{0x03211c95,0xd474c850},{0x0381f590,0x44e33184},
+{0x04611a3b,0x6e23fc1a},{0x02212111,0x857572f3},{0x01e122e2,0x8be7ed50},{0x0161fbc5,0x567e2927},
+{0x020020a0,0x7d9ccfae},{0x02a12158,0x0b9a6d59},{0x02e02ab4,0x4f317301},{0x0221031a,0xb343cb6d},
+{0x03e0189d,0x6a04b1fd},{0x02c12026,0xc732ef6d},{0x014e002f,0x662b9cf6},{0x05c1d8d9,0x66542845},
+{0x0261b09a,0xf4e5db8e},{0x01e0315d,0xe5fff695},{0x01602621,0x3dcc17f3},{0x01c0a401,0x6594e788},
+{0x07801f87,0x3a2e0bdb},{0x0260110c,0x00a9aa4d},{0x0421d7dc,0xd1f350f5},{0x06802ff8,0x160985d0},
+{0x0180a010,0x954c9e5c},{0x02c13351,0xdcbc742a},{0x04201b41,0xeaf6c8d4},{0x0621d1c7,0x17d467b4},
+{0x01e10b0d,0x99320683},{0x01c0a03c,0x23b427cd},{0x04c1d8ff,0xc65a5947},{0x03c01fec,0x5e2f2b66},
+{0x0121f925,0x84aac953},{0x03001ac6,0xcb484b3e},{0x05a1f245,0x5f81fea8},{0x03c02cc2,0xc79cbdf7},
+{0x01a11009,0x7f59ed95},{0x02811d6e,0xfe9e612b},{0x01e009a4,0x87706432},{0x02a1f7ae,0xb0d0888f},
+{0x0420063d,0xa4bb73b9},{0x02c13272,0x7da9390e},{0x00a1f953,0xc617a248},{0x0201bc50,0x73aaa47f},
+{0x038003d9,0x75432042},{0x0341cf40,0x85f9880e},{0x07a02964,0x322779f9},{0x0461d621,0xe3a2efb5},
+{0x02616b06,0xe2877a78},{0x01c01700,0x7a7272df},{0x03416894,0xa3b76205},{0x02e1f0bb,0x4e8aa71c},
+{0x04e004eb,0xdfc80dd5},{0x0381d123,0x90fa769e},{0x0160a626,0x45300cbc},{0x0341f60a,0xf8fda6d2},
+{0x01c0a354,0xd98254a4},{0x0421e13a,0x13de4785},{0x02000c22,0xed24dfde},{0x0221f5de,0x47096a19},
+{0x02e144a8,0x96060b38},{0x02c0056f,0x56741c4d},{0x0660fdf1,0x978cd6a7},{0x02001c50,0x20de866f},
+{0x02a168fa,0x1aca6ab3},{0x0121f9b8,0xe10bffc4},{0x02e00609,0x103c6bd7},{0x0701d9c9,0x884072d0},
+{0x01c16f71,0xc0f32b5c},{0x02411ac7,0x3be47ab1},{0x03003208,0xb75e3de3},{0x01c00742,0x7917ee08},
+{0x02600326,0x9e9d9f75},{0x03410132,0xac320439},{0x03402921,0x4bb60d5d},{0x03800158,0xf8289f9e},
+{0x028018bb,0xb87b3476},{0x0421d632,0x4bb1f195},{0x02410454,0x91766cb5},{0x022021d5,0xd1919d4a},
+{0x01a1f470,0xcd5ac367},{0x02602802,0xc51c4ef6},{0x02801df5,0x68b9fec2},{0x01e1070f,0xf4650c6c},
+{0x0441d7f5,0x2053c991},{0x0481d944,0x1248d059},{0x0281e916,0x42bad2a5},{0x02c1335a,0xddbeb454},
+{0x028118e7,0xf60128e2},{0x0381f51c,0xd740b1ad},{0x02418853,0xee6b5fc5},{0x02c11d8d,0x7d5794d5},
+{0x0240aaaa,0x54bb0992},{0x02c0ab6a,0x1d02f030},{0x0400234c,0x89096315},{0x03202eeb,0xc8c39523},
+{0x02c1d433,0xdf97ef69},{0x01c1f4fe,0x837846da},{0x0441d71c,0xe1668eae},{0x0121f6f0,0x29cb654a},
+{0x022120fc,0xad5969f7},{0x0620fda6,0x049611a2},{0x02210343,0x63cc30d3},{0x0601d964,0xffb4d7ae},
+{0x036002a9,0x6b39c81b},{0x01002042,0xbfa7d0e7},{0x02402fd5,0xf009c6fd},{0x02e122a3,0xa79b6b5a},
+{0x02003091,0x88605886},{0x02c02d58,0xfd873a2d},{0x0521245e,0xb70d69d5},{0x02a01857,0x41f83463},
+{0x02016adc,0x9adcd88f},{0x036124a8,0x2d0b753f},{0x008022bc,0x81bd12ba},{0x01c00f68,0x73121ab1},
+{0x0360163e,0x1ce072b3},{0x0261d315,0xfb2fae0d},{0x02c1325f,0x7fadb962},{0x02801844,0x588619ba},
+{0x02c1310a,0xef148df4},{0x02801c31,0x516bb68c},{0x0460fcc5,0x55f4a3f3},{0x04a01884,0x4b71112a},
+{0x02e1342d,0x1ed44fe9},{0x028e01a3,0x715bbdc6},{0x02e1f79f,0x38bf7718},{0x0361cf88,0x17787aaa},
+{0x0200305b,0x785744fa},{0x02412322,0x9dac0fe7},{0x05401ead,0x5959004e},{0x05c1da23,0x415e834d},
+{0x01a01799,0x2af15616},{0x04402506,0xbd4a7d09},{0x024008fe,0xe97ada46},{0x0401bca1,0x030ec5c0},
+{0x02e130ae,0x2a7b7547},{0x0321d52c,0x11a17ef8},{0x01e10b0b,0x7f40e81f},{0x02804df6,0xcba4ada4},
+{0x02e02d7f,0x3381f101},{0x02a02c81,0x6020e8a6},{0x0561d790,0x8f3e0bb0},{0x03a00d5b,0xb1c649de},
+{0x03c00625,0x49834e83},{0x0200305a,0x944017bf},{0x01c0a940,0x910d86d6},{0x01c102c1,0xbcee0d82},
+{0x02c119d5,0x5a3ca1ed},{0x03a014fb,0xf5905ab4},{0x026012ec,0xe3f93075},{0x0341e81c,0x0f74ceb9},
+{0x0200a904,0x9593124b},{0x02a00444,0x12e2dbac},{0x02611d60,0x5be84601},{0x0360fb9d,0xcd130de8},
+{0x0300feee,0xe6ffe598},{0x01e0a588,0x883b6842},{0x056033fa,0x375248d7},{0x02810137,0x1dd485ef},
+{0x0580fdc5,0xa13d640e},{0x02410199,0xb3e4c724},{0x03e1013d,0xc54b7d7a},{0x0101f9a9,0x257cb51c},
+{0x01e01c69,0xcd8a9137},{0x0161f9c3,0x2a5cad65},{0x03810ca8,0x1409080f},{0x04a1d660,0x351b0450},
+{0x0381f86f,0x4ec16de5},{0x04c0fd2d,0x6f968f34},{0x03802c13,0x6deb61e3},{0x02418abb,0xd916f7ac},
+{0x02e1fb8a,0x5316e07b},{0x03010c3e,0xe7eafd2c},{0x0200312b,0xd188076f},{0x03002336,0xbe8843bf},
+{0x0301214f,0x1c44d77c},{0x036027be,0x34cd439b},{0x02200065,0x265762d7},{0x022032e3,0x5123cd20},
+{0x0561d155,0x38ae3c38},{0x026012be,0xf517b614},{0x02210374,0x964377ce},{0x01a0aa16,0x2b43fa67},
+{0x02a105b8,0x34211764},{0x02e029f1,0x9f439720},{0x03402ac7,0x7f85d92f},{0x02400e15,0x0c82e92d},
+{0x01e11697,0xec64a779},{0x00e1f5a8,0x48ece4df},{0x02418a40,0x423aaad8},{0x03011ca0,0x62b53e7b},
+{0x03816866,0xfcdba9d3},{0x0460fc79,0x8b2df033},{0x04812251,0x1f414c26},{0x01c0a090,0x189d2278},
+{0x0320237f,0xd4eb0c8f},{0x0061f95a,0x9e322e26},{0x01c0226f,0x1e87d993},{0x0381098a,0x9206dc55},
+{0x0260097c,0xc67b6686},{0x03a1d5b7,0x667bcf5b},{0x02e14553,0xeb3e5c72},{0x04a021c5,0x4da7fd79},
+{0x02412071,0xfe18c456},{0x0260146d,0x147d4f04},{0x020120f2,0x74ccd47c},{0x0381ee8c,0xb02111f6},
+{0x01c1f3f0,0x694ac4c0},{0x03c0fb80,0xc5b217ce},{0x0341e82e,0xd419f87c},{0x02a02819,0x3c24db40},
+{0x02600f86,0x6e13326c},{0x01a0a07f,0x656b9932},{0x03a1d7f8,0xab5b5b39},{0x02c025fd,0x977279d3},
+{0x02c10423,0x88c08f65},{0x02010600,0x1e32f45c},{0x03001ab6,0x8052b133},{0x02e010f9,0x948401f1},
+{0x02e1da36,0x912475e9},{0x02801217,0x741ea674},{0x01c11419,0xab1411c6},{0x02211c01,0xdc58343c},
+{0x02001dd0,0xd0e298ea},{0x02418882,0x94e57cfa},{0x02812fbb,0x16f022ef},{0x0180a3f8,0x9245ddde},
+{0x028169aa,0x7fd1012b},{0x03e18b2e,0xacd5675d},{0x0221030d,0xab43bed5},{0x0380234d,0x0318aa14},
+{0x04e1f8ab,0x6cd496e2},{0x0441d043,0x46762f34},{0x02410387,0x0bee86fd},{0x026012f4,0xc22b99e2},
+{0x02410fe2,0x00ce2c19},{0x03a1cf63,0x4b08a479},{0x0261e946,0xef60970a},{0x03e18c1f,0x37a1c494},
+{0x02418879,0x91e339aa},{0x0221f18c,0x7077e62c},{0x01e00601,0x2e36bdab},{0x02e01130,0x8997d381},
+{0x020022c2,0xfbfbf1e0},{0x02801a89,0x7ead4178},{0x04001bad,0x4cff6d4e},{0x024189b0,0x9acd5803},
+{0x030008e1,0x99a9b1e2},{0x01c0a1a5,0x80195448},{0x02c10366,0x3e26fcf5},{0x02601332,0xfe2cdb4b},
+{0x03c1f7c3,0xacac25eb},{0x03010f48,0x6f92afb2},{0x01e10504,0x0da249e6},{0x01c0a93f,0xa5303894},
+{0x038124b7,0xa08d7797},{0x0360301f,0xc7b9fba6},{0x04c0fc1f,0x5c5db976},{0x0161e2a5,0x855a8000},
+{0x02e101e7,0xac062be0},{0x03a0a98b,0x3291859b},{0x01a11420,0x9c3e5f57},{0x02e00534,0x6e97e2ed},
+{0x0341f71c,0xda26942b},{0x02e1463c,0x67bf1cd1},{0x04a1f880,0x4551dd08},{0x022005c2,0xf8823181},
+{0x02802cad,0x16115328},{0x02816f25,0xde7e8938},{0x0380fb64,0x03c22ebf},{0x032118ab,0xbde3a8c0},
+{0x0121f5fb,0xe9ed3e16},{0x0360fed5,0x2bb6c21a},{0x024012d8,0x1d0de1d5},{0x044021c1,0x4566774d},
+{0x02803023,0xf8319785},{0x01e11324,0x0ecd8d95},{0x0141faa9,0xd5962593},{0x0320206b,0x820e25e4},
+{0x03000514,0x38bd0fef},{0x0281e922,0x6fe703f7},{0x01e00ca6,0xed3fe064},{0x02c000df,0x34dd71fd},
+{0x02c028a5,0xafd1423e},{0x02c02267,0x67aea595},{0x04601edc,0x3fb04b9f},{0x02401b8d,0xff132c13},
+{0x036107aa,0x685a149d},{0x04e1d0c0,0x2c70d68a},{0x0261133d,0x734d11c2},{0x02c13319,0xfa0b06b4},
+{0x03802cf0,0x138df431},{0x02810d20,0xb9b869b7},{0x01e108fd,0x606f99d5},{0x0260a8d9,0x2d44cde4},
+{0x03801d9d,0x00e08ede},{0x0260157d,0x16750365},{0x03e1d0ec,0xdba5009b},{0x026122ef,0xaec72f5e},
+{0x03e18c5e,0x1a989c91},{0x01e11014,0xaf3206a8},{0x03a01d5e,0x8766cf72},{0x030001bd,0x26286a88},
+{0x0401d0c8,0xcdd8eb8e},{0x01c0a227,0x0ca47fc4},{0x02e0285b,0xf6cbb0f5},{0x024188ad,0x01db9b35},
+{0x04001f72,0x11867903},{0x01c01783,0x27b7bbf6},{0x030010b2,0x02309018},{0x03e18b47,0x9ac6407d},
+{0x03a1d6e7,0x1c2c0ca5},{0x03a1015f,0x6c444d30},{0x01a0a206,0x9f51504b},{0x03e00135,0x353323f0},
+{0x0341d702,0x6f183ad0},{0x022013df,0x2a05865c},{0x0100232f,0x3433e913},{0x03401644,0x1759076d},
+{0x02a0a989,0xfa807f5f},{0x01816f21,0x39a4ad61},{0x0321f61a,0x7a5f85f2},{0x02010175,0xcd7fae21},
+{0x03e0253b,0xc0fb768a},{0x0301f78d,0xda463450},{0x026124e4,0x78d2b0f4},{0x0321d528,0x15a18544},
+{0x02011a5f,0xd32ae495},{0x00e026d4,0x464cff52},{0x026023b5,0xaf4132af},{0x0260a8a0,0x4c029b8a},
+{0x028014f8,0xc6b56c85},{0x032122b4,0x9208cc8e},{0x02e00c62,0x961fb264},{0x0320299d,0x0c2956b3},
+{0x03e18c39,0x029cf3f7},{0x02e00421,0xbe46d0f4},{0x03412485,0x6bfda901},{0x02c133e3,0xd9bbd6e4},
+{0x0340fb49,0x627930ea},{0x0681d825,0x942a9345},{0x01c0a3b2,0x5f2c920b},{0x0200a85a,0xccd6c689},
+{0x02a03282,0xee79462e},{0x020005b4,0xa6dbde6d},{0x03401408,0xcb4bc3d6},{0x01e11a7e,0x3056d954},
+{0x0101f43f,0x125b9c8a},{0x01202206,0xe4fb099e},{0x02c1e914,0x4f75a891},{0x03410376,0x7354c69f},
+{0x0401d0f4,0x98e013f3},{0x02e01bcf,0x0fd774b1},{0x01e01753,0x6aae55e2},{0x04801d98,0x66f32c84},
+{0x01c1168d,0x26fbc398},{0x0360febd,0x0f569ff3},{0x04e00682,0x2b6f43b3},{0x0261b0b3,0xa35a6a57},
+{0x03c1d4d4,0x2de96c1e},{0x02000a90,0x37c53e18},{0x04001e6e,0xcb35f140},{0x036011e4,0xd96041be},
+{0x02a02576,0xca817b43},{0x058001c5,0xf4417f35},{0x02212126,0x9b5f721f},{0x01a1141c,0x2176492b},
+{0x044008b2,0x939b4481},{0x03001890,0x6f51b92d},{0x0481d8af,0x27044ada},{0x02c0ffd3,0x6375dd7c},
+{0x0261f375,0x92174c0b},{0x02800d95,0xe7237c58},{0x02e005a2,0xd7fb225d},{0x026e0101,0xa39c7ed2},
+{0x02402a41,0x0b19f755},{0x0361040b,0x7632e4b9},{0x0441f876,0x269ab07a},{0x03e18c6a,0x76955bce},
+{0x03602446,0xfc761833},{0x02002d30,0xe857b017},{0x02418af2,0x6a0f8d2a},{0x01c102c5,0xd7d4a01d},
+{0x01a0a54a,0x10173284},{0x0181f943,0xd62eaf7c},{0x02411901,0x8bb2d454},{0x03c13437,0x982fec87},
+{0x02c13303,0xcd3debcf},{0x0321d102,0xb68ca2ba},{0x01a1141a,0x946fef8b},{0x04a01edf,0x14a3e81b},
+{0x02810f12,0x693c20c0},{0x02401505,0xc34c0ced},{0x01800b8e,0x245ffd43},{0x0581fbb5,0x9deb9b7f},
+{0x02a005b2,0x95b4305e},{0x03802e2a,0x44db78c8},{0x01c0a2b2,0x4e8b4972},{0x01e106d9,0xbabcf9b7},
+{0x01c02062,0xcf488aee},{0x02e13011,0xe57f60f0},{0x01c0a1a8,0xcc31d0d2},{0x03011a0c,0x587bb8d4},
+{0x03210880,0x8a81090e},{0x020112b8,0x97d31692},{0x02a10599,0x64034de0},{0x02a10020,0xf220987f},
+{0x0180a132,0x9a8f8c28},{0x03a01481,0x2ce9a8ec},{0x03a10b50,0x5bdeb5fe},{0x03a12060,0x19985513},
+{0x01e1143f,0x43b20586},{0x034015d0,0x077941e8},{0x02016ae9,0xdaaddf1a},{0x04402529,0x442253bb},
+{0x032022f1,0xd40c2cc5},{0x03212205,0x4a6a39f9},{0x01e16f66,0xf7a5fb4b},{0x034024bb,0x4f65edb5},
+{0x01e11109,0x53c78163},{0x03a0235f,0x49540e79},{0x03e1da0c,0x6f9907d2},{0x0301f0dc,0xac1d6cf0},
+{0x0281fb8e,0x50adb2b6},{0x01e11021,0x00cc6a6d},{0x0341e840,0x6516f32c},{0x01c0a935,0x7d4752eb},
+{0x02a11d82,0xabff6b01},{0x02c02d0b,0x06d43ed2},{0x03601629,0x34754775},{0x01a0a16a,0xef9e3f34},
+{0x0441d7db,0xa90b2993},{0x02000a95,0x33ad32e6},{0x0461d09a,0xe3224359},{0x03004dd4,0xe84f7a15},
+{0x026124fb,0x5931b69d},{0x0600fbf6,0x1c84c1c8},{0x02400aa0,0x1cb03295},{0x03c0023f,0x96718fc7},
+{0x030001bb,0x332088e1},{0x01a0a305,0xbd2ff992},{0x0360fea9,0xf4429b7b},{0x03016836,0x463a95ff},
+{0x0380ff34,0x55ece276},{0x01e1fb2e,0x9bbd8ec9},{0x020005ad,0xa8fee638},{0x0360016b,0xd0813009},
+{0x020114a4,0x6bed9227},{0x02600055,0x65151a4a},{0x03e02534,0x7b3230db},{0x02010462,0x5431c3ec},
+{0x02810449,0xa8fbe9ef},{0x02c13346,0xd6ba2c21},{0x03010a95,0x02ecc94c},{0x02e0325e,0x4d61b8f2},
+{0x032025ba,0x8c3096f9},{0x028169ac,0x32dd4613},{0x044004ab,0x4b54ef60},{0x02000c41,0xe2479a2e},
+{0x0180a49e,0xa2512bc0},{0x02e145ca,0x79efe52a},{0x01e0a581,0x70fefbe1},{0x0441d05a,0x9c701a68},
+{0x02a1ee1a,0x59d9f044},{0x01e10736,0xf67658b3},{0x01a033a6,0x2a3ebebd},{0x0180a1f4,0x4a614303},
+{0x0260134f,0x802f7f32},{0x02c119dd,0x1a5a5241},{0x01c0a24f,0x0a369b4a},{0x03e18b30,0x9dd78e57},
+{0x02c1332a,0x020f907a},{0x02801323,0xb50e546a},{0x02e028e9,0xf4643676},{0x0301d375,0x8ecaf173},
+{0x03400fac,0xe54967c0},{0x0301d4c3,0x3fa124c9},{0x04c1d8d3,0xac268e2c},{0x03e0058d,0xe84eaef9},
+{0x0240aaa0,0x74929982},{0x0421d033,0x4a1f8cd3},{0x02800e1e,0x9bcac704},{0x02c1251f,0xcc4b52dc},
+{0x01e1070b,0xf0650620},{0x02c1d42b,0xe797fc01},{0x03c024a8,0xf5011d93},{0x02e0053e,0x5e9e8582},
+{0x02402f8b,0xdd4bff29},{0x01802bd3,0x050ed8d7},{0x02a0aae7,0x4c70b95a},{0x024e0028,0x586268ea},
+{0x026006dc,0x80d53d0b},{0x0380327c,0xc1ab3481},{0x01e1f91c,0xd3d38bc1},{0x038004e8,0xd7b3f909},
+{0x03c02274,0x2b2e38b4},{0x0220fe56,0x4cf5b5f1},{0x01e110a1,0x95ea2052},{0x05210f56,0xd1b40f36},
+{0x020120f6,0x76ccd7a2},{0x036102f8,0xc5febfbf},{0x02e11d3c,0x8305affa},{0x01e005d8,0x81d3f9a3},
+{0x0220006c,0x1d5754ac},{0x03a121e6,0x20b71619},{0x02616b02,0xfa922d9c},{0x03c02d41,0xc4a89fb7},
+{0x03c01da4,0xed6b43ca},{0x02c0285c,0x53f80a93},{0x01e11315,0xcec1efe2},{0x0121f370,0xd8b7d6c9},
+{0x03c121f6,0x07515883},{0x03c03199,0x7a9e0078},{0x01e01729,0xc2787f82},{0x01a0a540,0x172886aa},
+{0x024169d7,0x036f5588},{0x03a00243,0x5bd0440b},{0x02a00457,0x41c51095},{0x0261b0ab,0x1d6424c1},
+{0x02210834,0xd9e321b1},{0x02e1f89c,0x5f5d4457},{0x03602d64,0x4f0aef53},{0x02e10f06,0xde020ba4},
+{0x0241888b,0x03dddcf2},{0x03200302,0xe4905b69},{0x01e00846,0xadb582b3},{0x02ce0045,0x6a3c6158},
+{0x03a0fa93,0x374a9117},{0x024106ab,0xbbeebab9},{0x02e14634,0xebc22b34},{0x0241f551,0x8609a737},
+{0x01603311,0x5be24ee6},{0x02602318,0x7c6aa536},{0x020110b3,0xdb78c8b4},{0x02200782,0x6c7b12d7},
+{0x020111d5,0x26c7d7e4},{0x02e10c43,0x48571194},{0x0201f4e8,0x7b9352c1},{0x03601dab,0x6a5a17c3},
+{0x03c1e005,0x988791d0},{0x04402957,0x77f8c010},{0x00e0214c,0xef355c45},{0x01a0a1c5,0x6295bb4d},
+{0x02a103cf,0x2ae1e03c},{0x04002953,0x3006d6ab},{0x0381ee8e,0x40cbfc39},{0x042009f9,0xd67fcf32},
+{0x02e1329c,0x697f6b39},{0x03e0ffb0,0xad594ab1},{0x03e02785,0x6e2e10bf},{0x02e110c2,0x836fc48c},
+{0x01c0a42a,0x0ae5304e},{0x012033ad,0x8ed47639},{0x02a10ada,0xcf48084a},{0x03600d73,0xc04058be},
+{0x02a1d13c,0xae034aca},{0x01a0a0be,0x2caf162d},{0x02811d68,0xf6a6a358},{0x02c00132,0xebb6e4cd},
+{0x02e145da,0x80f46d5d},{0x0580fe38,0xa4f12f6d},{0x0361f717,0xf4191f46},{0x02600d41,0xd1ef14b3},
+{0x01a0a146,0x09a606dc},{0x024188b4,0x0cfc0031},{0x01c02131,0xd2876424},{0x02c0fbe5,0x844f670a},
+{0x0461ee5d,0x23f6b916},{0x0361d16f,0x242072ff},{0x02a019f7,0xb3898ac0},{0x02210463,0xd51df353},
+{0x02418a0b,0xaf2e8a7c},{0x020026fe,0x04de7426},{0x028026e0,0x996d0dbe},{0x02e023af,0x23978134},
+{0x01e10185,0x83e70b16},{0x03e18c73,0x84933341},{0x02211ac3,0x66c2a163},{0x0361253f,0x0123d780},
+{0x02e02498,0xa042bf10},{0x0260a8a4,0x06963c76},{0x0240a76b,0xde901439},{0x02e145ec,0xecf755f8},
+{0x0420fc7f,0x1ed23944},{0x02e0fbd4,0x07fab944},{0x01a033c6,0x51460d17},{0x02e1454e,0x8895d93a},
+{0x03802b11,0xc1ad629b},{0x0261ecb0,0x9ab87c69},{0x0161019a,0xc455be5b},{0x02a11d84,0x75b2ce60},
+{0x02a000d0,0x12717886},{0x038121d4,0x6de90672},{0x02418a5e,0x54ae591e},{0x04201dfc,0x909f0312},
+{0x01a0a6bd,0x6f4eb15c},{0x01e0168b,0x759d025e},{0x0180a61e,0x22476b73},{0x02c13395,0x26be2048},
+{0x05e1d92a,0x184b2c86},{0x01c0a3b3,0x5b2c8bbf},{0x0341f5ba,0xeb28000e},{0x02c130f0,0x0ed28430},
+{0x0301f061,0x1b82dc85},{0x03610c87,0x9bbff67c},{0x03202180,0xee4b47cd},{0x0540253f,0xd7f797e1},
+{0x028019fc,0xebb4b7cd},{0x05c01f56,0xf0e02d21},{0x02802d8f,0x991d32e0},{0x0341d4b2,0xc37c8413},
+{0x02e0028d,0x78799b83},{0x02e1697f,0xf03a5d3d},{0x03602c58,0x2f72417e},{0x0221045b,0x680612dd},
+{0x01e11284,0x3d6a5203},{0x03a16834,0xb82b118b},{0x03201d15,0xcdc14b10},{0x0161f9e8,0xd1ec77ae},
+{0x03401d23,0x1a7cfb2d},{0x0261b0f7,0xaecc7e4b},{0x026110e6,0xcc3692f8},{0x0141f9cf,0x2c6396a8},
+{0x0341f72a,0x725b26fb},{0x030017a8,0xca1a4f44},{0x0200aadb,0x4936f7cb},{0x01c16aae,0xa8db5d22},
+{0x01c0230d,0x283a11cd},{0x02400acb,0x8ff496d7},{0x02e01072,0x47227bf6},{0x0360ffa1,0x0474dbad},
+{0x02010635,0x1a23e386},{0x02c00ce1,0xa8054fc4},{0x03202eb0,0x5a807485},{0x028104f4,0x4be00ddb},
+{0x02c02cae,0x79677057},{0x02011447,0x28c47fb8},{0x0200062e,0x0348e28b},{0x0261207c,0x732ccaba},
+{0x02a0156d,0xdcd7d561},{0x030010a6,0x9ba38396},{0x0360162d,0x36754a9b},{0x0240abcf,0x6efafcdc},
+{0x02201b86,0xb4c97f89},{0x02a01866,0x8c309855},{0x02e021ee,0xf4ff00b2},{0x01a10931,0x9dbf65cc},
+{0x01c026f9,0x52336a9d},{0x02a01864,0x9c105dda},{0x06800759,0x333daee7},{0x01802021,0xd7667c8e},
+{0x03a0291e,0xd4041049},{0x0261b0f6,0xadcc7cb8},{0x04001cb0,0xab03c335},{0x01c00b1b,0x37bf8081},
+{0x04c01d95,0x60c9bb8e},{0x0180a013,0x91662ff6},{0x03a0fad3,0xa67c7f72},{0x02210826,0xdbdc6912},
+{0x01e009b0,0xbb6aa5e0},{0x04a121d3,0x218b145d},{0x01003383,0x69b067f0},{0x01a10284,0x0fee298e},
+{0x03c016cb,0xba5e4eef},{0x00a1f9da,0xae0c729e},{0x02401a34,0x87db51f4},{0x02a10025,0xec05a5a3},
+{0x02c02a47,0xacaceac8},{0x01a00bae,0x752f1d6e},{0x0260a9cc,0xbbc47eb0},{0x02010b29,0x7cac54f5},
+{0x02c132b2,0xfa9de0aa},{0x024032b5,0x36367366},{0x026003c4,0x220705a8},{0x02c1307f,0x33236056},
+{0x02c132fc,0x5a45858b},{0x02a00343,0x3fbd3700},{0x01e0a85c,0xbc04af76},{0x05201ed6,0x6d921b2b},
+{0x03800f11,0x474ca070},{0x02418a32,0x4638728d},{0x032118a5,0xebac4430},{0x02c1da31,0x8ce3b31e},
+{0x02418868,0x00e86595},{0x01e1bc1a,0xfb6778d5},{0x01e01ced,0xcc8b70f7},{0x02e010c7,0xf1544302},
+{0x02800d03,0x8e9ec206},{0x0381d492,0xb51fffa4},{0x01e10696,0xc03278a2},{0x02801dcf,0x7a1379ca},
+{0x02210310,0x8472dfa5},{0x024189df,0xa5deb275},{0x024112e9,0x4536c761},{0x01c0a5eb,0xc7c3f813},
+{0x03a102f5,0x276897e7},{0x048115d5,0xcb944be6},{0x02a0ab78,0x1547742c},{0x02010744,0x3f847141},
+{0x030000bc,0xe2e1ef90},{0x0461d60e,0xd6a2db3e},{0x02812fd1,0x26f4b94d},{0x0201f376,0xd4d4b0aa},
+{0x04e02508,0xe720140c},{0x02411606,0x69d6d55f},{0x036015e6,0x1ca4488b},{0x01a0a40d,0x62ba0cdb},
+{0x0361cfa2,0xd8a2532e},{0x02418985,0x33927831},{0x0581f822,0xbf410cd1},{0x0221080e,0xf5c538b1},
+{0x0340fe21,0xeff1d8fb},{0x0141f96c,0x8770e3af},{0x0221bc45,0x5ff55c90},{0x0380a830,0x7a4f745b},
+{0x0081f4ba,0xae408228},{0x03c10b59,0x3afb95f2},{0x038014be,0xd2a6e93b},{0x01e11136,0x692b0557},
+{0x03e18cb1,0x7d89d0b2},{0x02e0271e,0x1d62d837},{0x0521d9fc,0x3969b6d5},{0x028005a4,0x340fc031},
+{0x03402a44,0xc0ffc2cc},{0x03e18bd7,0x1bdb9c0d},{0x022122e5,0x8d437cca},{0x0321d524,0x09a17260},
+{0x03a01e7f,0xfddc210a},{0x0480fca3,0xe2f33da7},{0x02411c50,0x6eb82829},{0x02812f92,0xabfc4671},
+{0x01202607,0x9db3d1e5},{0x0320ff84,0x36b623ef},{0x02000618,0xe408bef4},{0x02e14450,0xa97646a8},
+{0x01e0a6c6,0x2c0eb29b},{0x02a1fa25,0x8493d02c},{0x0180a473,0xaa6f51ad},{0x03200266,0xdfa84337},
+{0x02810e77,0xfb287473},{0x0261b101,0x1fc2a2d2},{0x02e14421,0x248002a5},{0x026e0131,0x17a3f133},
+{0x0440fceb,0x7c2f65be},{0x0481d020,0x26ac9267},{0x02202fa8,0x30d870e6},{0x01a10296,0x03ee16aa},
+{0x0200a9b2,0x7a7f22e3},{0x04c02530,0xd3bba527},{0x04e01e64,0x8df124b1},{0x02011117,0x5f009556},
+{0x022108f1,0x4d4c2676},{0x04e1e8d4,0x0da1bce4},{0x028e006c,0x81c23a2a},{0x01e106c0,0x41b57f77},
+{0x03c01e85,0x15325dc6},{0x028110dd,0x8533040e},{0x03e1d574,0x60f4f4f2},{0x02612518,0x8eed4abe},
+{0x0240a804,0x1dabd5ed},{0x01c1f3ef,0xf805e11e},{0x03c02183,0x4dbdd98e},{0x03601662,0x08d4df5c},
+{0x0341e85e,0xc9307b53},{0x0200311f,0xdf99669a},{0x0101f69d,0xbb1ce5de},{0x03200756,0x604eae47},
+{0x01e01046,0xb52da423},{0x04611a3c,0x463b1671},{0x01e1071a,0x886cb12d},{0x0141f488,0x8fdc6831},
+{0x03013225,0xa0dd7bed},{0x02e1215e,0x831286b3},{0x01c0a187,0xbf25a8c1},{0x01c10936,0xd8551d91},
+{0x022013e1,0x1e057378},{0x0421f87e,0x5505aecc},{0x0301f1a2,0x256b4ba3},{0x0320269e,0xec4a9ade},
+{0x026124ec,0xe4b636ad},{0x01c0a094,0x6809332d},{0x03002672,0xfc0069f4},{0x03410548,0x96ca182d},
+{0x02000b83,0x53a4d276},{0x01e11fe1,0x557af637},{0x0540fe83,0xf9e0ffd2},{0x0381d1da,0x1a0ed0ff},
+{0x03c0d7f8,0x4dbaf10c},{0x03a1e11c,0xd7f41b68},{0x0561d88c,0xf00775a3},{0x01c0a3e5,0x2f2283eb},
+{0x04e001d6,0xe3abd147},{0x02001a05,0x9f1e0890},{0x0340036f,0x371b79c8},{0x03e18bff,0xaae0fa58},
+{0x02801515,0x2e8234da},{0x02e1446c,0x2e8f1ced},{0x05c1d0c5,0x4570a58d},{0x0381ecad,0x040477a1},
+{0x02e0fe24,0x4a8bc0c3},{0x01a16f33,0xec81484f},{0x00a1f444,0x4411387c},{0x02010e6b,0x28aa859b},
+{0x020013d9,0xf1f1e834},{0x01e10734,0xfc766225},{0x02601357,0x0e78d4c4},{0x00c02be0,0x1da44d17},
+{0x0481e00a,0xad8dbfc0},{0x050109f0,0x41e8afd1},{0x00a1fa92,0x5d78688f},{0x0341e827,0x7bb8cd76},
+{0x0201030f,0x1981282b},{0x03e18c86,0x7990e359},{0x01e02616,0x7d24dbc8},{0x01e00304,0xf9cc53ff},
+{0x03011174,0x4c745e0d},{0x03e18b57,0x9ac87f14},{0x0441d7f0,0xe134fb41},{0x0240a8b1,0xf9c8d537},
+{0x0601d999,0x1c4d564d},{0x0380010e,0xa8bf7f50},{0x0240136f,0x20c1ad36},{0x02603285,0x19ca9ff6},
+{0x02202d36,0x1f0aa267},{0x02418a17,0xb330cf5f},{0x02e10c32,0x4f61a9f5},{0x022108e0,0xd8c8d3b1},
+{0x044006bd,0x4fcfe266},{0x03410559,0x06eb59f4},{0x04a120d7,0x38c55931},{0x0340a7c3,0x4122fd13},
+{0x00a026f7,0x266db0d1},{0x03e1d577,0x5df4f039},{0x0221031e,0xa06abcf4},{0x034121d0,0x74b96233},
+{0x0341f53c,0xbdcccb7c},{0x01e005e7,0x0c49fabc},{0x024e0021,0x19a68e15},{0x05202791,0x6c86f95f},
+{0x0201158f,0x472e7e91},{0x02c133f3,0x26786337},{0x02411001,0xfe5bc0cc},{0x0581f826,0x3b580409},
+{0x0200305f,0xb462dc61},{0x01e0084d,0xc1b5a22f},{0x02e14567,0x7843b797},{0x0480292e,0x85a06bfb},
+{0x01a0a0f9,0xa82bbb4c},{0x0341e81d,0xb4eb9178},{0x02418a9a,0x549f4e94},{0x02800ea8,0x92e918b2},
+{0x030120e3,0xec855218},{0x01e0a577,0x58a7dfe3},{0x03c11a40,0x56af625a},{0x0281e939,0x34f06bbc},
+{0x01e120b5,0x48059758},{0x03412486,0xac1c22d5},{0x01e00ca8,0xf127e1ca},{0x02a0d7c6,0x7e9fe3e7},
+{0x02000ce6,0x9db0872a},{0x03e18c0a,0x5aa43a44},{0x02e02d42,0xc5267441},{0x02a1059a,0x4800e335},
+{0x02402bca,0xa159cf48},{0x04802931,0xad87ebdf},{0x05001e2e,0x9ab57f60},{0x01a0a1dd,0xb212dfa5},
+{0x026104ce,0x4cba029d},{0x02402f25,0x4d1e5ce9},{0x02e0aa75,0x7c2c027d},{0x02a0abd8,0x14a21416},
+{0x020005ac,0x660c80c3},{0x01c0a1d8,0x5c7bf07e},{0x024112cc,0x1a0d9b90},{0x0301d44f,0xa8ca03c6},
+{0x01e1f4b2,0x2f1e1b1b},{0x02010195,0x2b2fdc33},{0x032121eb,0x98aafbdc},{0x01a0a242,0xef9b2e6e},
+{0x0201061b,0x8908b4b5},{0x02a1ec78,0x90e2c6f9},{0x02812fe5,0x3164e692},{0x046120ad,0x4cdf1372},
+{0x03412512,0xa5d9f46d},{0x0141f4fa,0x2bf855d1},{0x02801456,0xcc499b7e},{0x01a1f62c,0xb8957817},
+{0x0560fd69,0x415f2972},{0x03c1f3fb,0xa9100c2c},{0x04e1d959,0x7ae6731d},{0x01a10286,0x09ee201c},
+{0x01e102b6,0x40e17dab},{0x02e0041f,0x9812b9bf},{0x02a0153b,0x19b26d7e},{0x02c11da3,0xef20d9a1},
+{0x01c1e2c5,0x936c68cf},{0x026e0143,0xa58b38d7},{0x028e01ae,0x765e043c},{0x03000d56,0xcb9113d3},
+{0x030021bb,0x6ae24c3e},{0x02a10032,0x257342ad},{0x02c13138,0x691e485e},{0x03203171,0x02742ee7},
+{0x022032f2,0x110da211},{0x046003aa,0x4e6db340},{0x02e02991,0xf2c9595c},{0x020121f2,0x7a16dec5},
+{0x03c1d1dc,0x11a0acba},{0x03010c02,0x10e4537a},{0x03011a0f,0x77f6f474},{0x02c01ab7,0x16a935f1},
+{0x04e1d0ba,0x2258c1e6},{0x0421d04d,0x08823dd5},{0x02003001,0x41ee1aff},{0x0261cf54,0x1ef3f9c3},
+{0x02c00f09,0xa0bb27aa},{0x02c13372,0x9ac35412},{0x042008af,0xcee4819a},{0x046003fe,0xbbd8041b},
+{0x042004e7,0x47d65fdd},{0x026112e1,0xab127d1a},{0x04c1014d,0xe4989f95},{0x03a16863,0x3b638f37},
+{0x028119b6,0xd8ef894a},{0x00c1fa9c,0x9e0a9469},{0x02a16906,0xb8b18da8},{0x03c01cf1,0xb4a06ba3},
+{0x0241f200,0xb8bb6fb8},{0x01e10ea0,0xd74bd099},{0x02e02f68,0xe0a72224},{0x0261e933,0x0a5701d5},
+{0x01e00a05,0x7e4a545a},{0x0361d691,0x3806e45d},{0x03202ed4,0x90e8474f},{0x02000f64,0x4eb044d8},
+{0x02e121fc,0xd5c6e322},{0x01e1d9ff,0x5bc3ab06},{0x02e1450d,0x8aa4e6ea},{0x0201224e,0xbf0d96d5},
+{0x0241f477,0x87541412},{0x01c00ec3,0xe18a02df},{0x042109df,0xfa587aff},{0x02210832,0xd1e31519},
+{0x0380d7f5,0xc1effbe0},{0x0400114f,0xde3e8e4d},{0x01c00bb6,0x11469e42},{0x0421d240,0xc468de39},
+{0x01a0a2b6,0x0a637bfd},{0x02c0241c,0x08cfb985},{0x01c11413,0xeea92474},{0x01c01bdd,0xd8230322},
+{0x0261009f,0xc84754f0},{0x06e0fc68,0x933f2004},{0x04c01ee2,0xd75dcb6a},{0x012111c4,0x9aefa43b},
+{0x03e18b7d,0xb9cd2d0f},{0x02002f7f,0x58a1ce9f},{0x0561d79a,0x2b09b1a1},{0x02c0066f,0x0154c0bb},
+{0x0260aa96,0x65be65fa},{0x01c0a404,0xf7c77e7a},{0x00a1f36c,0x5c1ca63e},{0x02c003db,0x808b62eb},
+{0x04c1d003,0xdb74045c},{0x01a0a1f8,0x6341e74d},{0x03e18b5c,0xe6c8f6b8},{0x01a0a597,0xe72cb848},
+{0x02a02a20,0xd13243f3},{0x0241b00d,0x4f1ca982},{0x02c0286c,0x53f5cbfc},{0x03401598,0xc52e2854},
+{0x04402955,0xf24b8806},{0x03604dd1,0x2cc1cb83},{0x034118aa,0x5e3718e4},{0x02816990,0x4b0dc8ad},
+{0x0361ee49,0x197f05ac},{0x01c0a1be,0x882b2839},{0x028e017d,0x0765a444},{0x02c00574,0x50424617},
+{0x02c1f0a2,0x58e4de98},{0x024188d9,0x1e10f07a},{0x02c169d0,0x7eb0e8ac},{0x02e13357,0x0032ff80},
+{0x02802842,0x0c8ff9d3},{0x024188f3,0x101da663},{0x02801d56,0x708c8995},{0x04a1f781,0xf9ca9887},
+{0x020122fb,0x87b32e33},{0x02c13291,0x03b7838a},{0x04a003fd,0x36affeed},{0x01c0a077,0xd275a4d6},
+{0x0501cf32,0xec50dd7b},{0x02010803,0x66545dca},{0x0221081b,0xbdd1ac7c},{0x00c1f3c4,0x130663d2},
+{0x0081f5cf,0x6a78a9b6},{0x03801aca,0x771d7376},{0x01400384,0x2be352ea},{0x02402f0a,0x0735dae1},
+{0x02802d8d,0xd4d9e214},{0x03e0fdf9,0xf11d97ee},{0x02001166,0xcf2b91ff},{0x01c0a358,0x195a16f4},
+{0x01e013a3,0x0bd5755e},{0x024189d7,0x21c39f2c},{0x02810fb2,0x3aeb61fb},{0x01c16f2d,0x677194b9},
+{0x0300a873,0x30f3b1d4},{0x01e017bb,0x1d248419},{0x0260121f,0x10e853fb},{0x02a102e3,0x3c489289},
+{0x02401a6a,0x2f57653b},{0x03e18c52,0x0b9884f4},{0x0081f4a3,0x7452c3d1},{0x01a02256,0x121abdd9},
+{0x03c0d7ed,0x66c326c4},{0x0261035a,0xc81b60b2},{0x0421d787,0x5b78836d},{0x02600979,0x241526a8},
+{0x03011c92,0x56a3e276},{0x03c1f1ed,0xb7245147},{0x030024d2,0x51b6af97},{0x01a00b06,0x4fac1283},
+{0x01e10729,0x896ef157},{0x01e0a84a,0x84226c62},{0x04a01daf,0xd3ed6bd5},{0x02011337,0xa9a5532f},
+{0x01c11631,0x18dda779},{0x01c0a148,0xb075d366},{0x02a11fcb,0x8a059fa9},{0x02c1335c,0xdfbeb77a},
+{0x02c1193b,0x4966a038},{0x04c0276a,0xb0786464},{0x026023bb,0x9a63143f},{0x04a0fc58,0xb5381997},
+{0x02202162,0xe928a160},{0x02e028a7,0x0198405e},{0x02e133c0,0xb383a282},{0x02c01055,0x2286f2d9},
+{0x02a16a34,0xfba86857},{0x01c0a3e8,0xed3e89c9},{0x02012223,0x5ef88734},{0x02601697,0x7660fed7},
+{0x02e14598,0xe239d119},{0x0460fd16,0x239be0dd},{0x0440fc76,0x2b581626},{0x03601436,0x63a7540e},
+{0x038025df,0x0166caee},{0x028101e9,0x476cf607},{0x02202d44,0x180a9762},{0x0300066c,0x76e894b3},
+{0x01802025,0xbd8139e5},{0x02c00452,0x111ab338},{0x0180a4d1,0x72b640a5},{0x0321171d,0x98fc221b},
+{0x01c1f5b0,0xf6a69f2c},{0x024188bc,0x04fbf399},{0x01616a59,0x07624381},{0x03610c91,0xe8de84c7},
+{0x03016844,0x6c6192eb},{0x0281e90a,0x3ed2d13f},{0x02e144ba,0x9a03d2ed},{0x04a00dde,0x3c98d6cc},
+{0x0341e84c,0xcbea2492},{0x054004b8,0x0a0846e8},{0x0281d2f3,0x0c257c0d},{0x0580fd73,0x1afb3c81},
+{0x02c01852,0x1d9cf653},{0x01816f3a,0xed9fb88f},{0x01e0a920,0x22a236db},{0x02418ace,0xe6194aba},
+{0x03e10b66,0x1b23a246},{0x02c130a9,0xad2d1ac0},{0x04a115d2,0xca33ce23},{0x03e12276,0xeae40433},
+{0x0460fc8c,0x8b9cdc20},{0x02a031f3,0x2544ed93},{0x0480fcc6,0x77c8e54e},{0x024189da,0x20c39d99},
+{0x0400032b,0x4bc5ac56},{0x03602e50,0xf056efe2},{0x026e0146,0xa68b3a6a},{0x03c02c52,0xa9d4b372},
+{0x03c025be,0xfe6698f1},{0x03011a14,0xd02ff335},{0x034022e8,0xb97583a7},{0x024189af,0x99cd5670},
+{0x04210af3,0x9edecd9f},{0x03a120ab,0x58cd9804},{0x01c016c4,0x2eec0f84},{0x02e1455e,0xe73c178f},
+{0x02c13310,0xf40d3bd9},{0x02e029bb,0xb1e8139f},{0x01e106df,0x32bff536},{0x02c133e4,0x1d78550c},
+{0x026030ff,0x00fdc91f},{0x01c01789,0xa5fad764},{0x02410117,0xdce40f07},{0x02811d6b,0x02a6b63c},
+{0x02812fb2,0x1bf26965},{0x0161fa9b,0x95151205},{0x0361d8ab,0x10e98559},{0x0180a2c2,0xaa574cc7},
+{0x02001c48,0x8c4d2004},{0x0341f716,0x042c8750},{0x0421d238,0x446be650},{0x01e11eec,0x529e4bf1},
+{0x034011f9,0xa930bb79},{0x0201bc28,0x49e2baf2},{0x00e1faa7,0xf2a2ac06},{0x03603184,0xb494f85d},
+{0x04201fe0,0xad36705b},{0x01600650,0x973f98a3},{0x02e14557,0xe73e5626},{0x03e02c24,0x1646457a},
+{0x020104a5,0xc6de1474},{0x02e144b0,0x8e05fea0},{0x02c005e5,0x7494dbc1},{0x022013e7,0xce08c71f},
+{0x0261b07a,0xbd2f8c6e},{0x020013d0,0x92252c77},{0x01801742,0xd0d25048},{0x02200710,0x44b1218c},
+{0x03c1d4e2,0x3fe98874},{0x028187ee,0xf98c2f39},{0x036012d0,0xd47cbff4},{0x01e10693,0x473a08ec},
+{0x02a02889,0x4924efb7},{0x03e18ca4,0x088cea1a},{0x03c00d9a,0xbac22c07},{0x03e0292a,0xf0d2f90a},
+{0x02010359,0x7e3428cb},{0x02811aa2,0x55b522de},{0x0201bc1e,0x5be2d748},{0x02a00578,0x958e8d9e},
+{0x028018bf,0xd292ed27},{0x028e0185,0xef67bd13},{0x02e111e9,0xf4b24449},{0x02e010c3,0xac4f5935},
+{0x02e1461d,0x69dc4442},{0x04a0fc55,0xb1477d98},{0x02a1cf52,0xcd9cd71d},{0x02a003e9,0x7bb308e6},
+{0x026124e6,0x70d2a45c},{0x0260120b,0x603d1762},{0x01c16ab2,0x8cea3b98},{0x02601a32,0xc646a808},
+{0x02a11d86,0xf9dbac39},{0x028e015d,0x8771a6b7},{0x0261b0c7,0xd7cbfe05},{0x01e009e8,0xceb6b208},
+{0x05002b47,0xdee9042c},{0x02610f81,0x3e19387c},{0x03e18c23,0x7c9ff29c},{0x02418a02,0x40362a84},
+{0x03000fb0,0xd2395f83},{0x03010c0b,0xf8eb17ef},{0x0381241f,0xcca0633d},{0x01c0a19f,0x843becd6},
+{0x01a1f6d1,0x093bc6b4},{0x02001a75,0x1a310099},{0x0220a92b,0x430555ca},{0x0201227b,0x10101369},
+{0x03c006d8,0xe8c8c6ea},{0x0200a57b,0x83cbccd9},{0x01e10507,0x759f1c07},{0x020103be,0xbac91c90},
+{0x02418902,0x971aa951},{0x02e12215,0x59d0bcbc},{0x02e1fb70,0x600cbd8d},{0x05212441,0x0c30999d},
+{0x03a0016a,0xb7768bbc},{0x01c0aa57,0x6bf155ee},{0x05c1f830,0x39f5205c},{0x03611ab0,0x6f29458b},
+{0x02e0a9eb,0x43e964ca},{0x0421cf9a,0x1f83bc3d},{0x0381099c,0x93ed4795},{0x03402ab7,0x17fe7d1e},
+{0x01e00f62,0x05a0a24b},{0x026006da,0xb06d5e87},{0x02c131f0,0x007cb4f1},{0x05002564,0x2474a80b},
+{0x0121f43e,0xcca6a997},{0x02a0328c,0x7dbedb39},{0x01e01a15,0x56356ab8},{0x030010b7,0x1276cff3},
+{0x0340013a,0x1d1bbf60},{0x02c132fd,0x594583f8},{0x032006b5,0x8888ae42},{0x02c1e903,0xae47c82e},
+{0x04202cda,0xaa6eb80c},{0x03a1ec99,0xa20c7296},{0x03a0fa8c,0x0f4c90b6},{0x02e028b6,0x2021da40},
+{0x04401eb1,0x1a531a9d},{0x0280125a,0x3ce6c349},{0x02c00358,0xf7be02e9},{0x02801549,0x53a2dac0},
+{0x02a000bd,0x06bdc995},{0x03a1f705,0x901c2cfa},{0x02a02843,0xbe169d5c},{0x01c110a5,0xb4406d46},
+{0x03401129,0xc73a3baa},{0x03400f8c,0x17a6c309},{0x010033cb,0x6cb7286e},{0x02e10f54,0xff2ba811},
+{0x0381d145,0xa3ee0b91},{0x03e0324c,0x45770267},{0x04001d83,0xbef11b81},{0x03a01e8f,0xd0042d47},
+{0x01a1f7aa,0x96292e34},{0x0301da9f,0xa6d6adea},{0x032018d7,0x163e46aa},{0x0180a494,0xdf40c1f1},
+{0x02201801,0xbb0d958c},{0x04a033e7,0x9e19db62},{0x020111cd,0xc62990f9},{0x02c1f06c,0x1014fc5a},
+{0x0321f73f,0x8252c9b9},{0x02011044,0x28b5c19f},{0x02c133dd,0xd3bbcd72},{0x01e1f623,0x40398572},
+{0x07801fa7,0xb743e396},{0x0281f97a,0x2cc5da84},{0x03e18b22,0x95d54328},{0x0321f4ec,0xbb8daf61},
+{0x0200a9d6,0xee564293},{0x02e10595,0xc268bf2f},{0x03216806,0xa8b21cc5},{0x03c02a64,0x4c0d5ebf},
+{0x02e13387,0xf654a3c0},{0x02418a42,0x403aa7b2},{0x02e1041a,0xcdde1399},{0x02601bb8,0xe6bdb313},
+{0x032018da,0x263e5fda},{0x01c11201,0xd2e6b329},{0x01e009ec,0xa2010f0a},{0x04010146,0x5f5d4cee},
+{0x02e01dc3,0x6b1bfc4d},{0x02c1d421,0xcd97d313},{0x01e1e2ed,0xfebb3231},{0x01e0a575,0x9a9876c8},
+{0x03e18c04,0x87a4811b},{0x01c116c9,0x1402745f},{0x03801482,0x02e198b5},{0x01602195,0xc15e138d},
+{0x02c0a718,0x4f18fea8},{0x02e12180,0xca38add0},{0x04001f08,0x32efe922},{0x03602976,0xa8ff39fd},
+{0x0341d119,0xa083200b},{0x02c13071,0x9b96a184},{0x00a1f457,0x405fd290},{0x0401d1c2,0x1309ed92},
+{0x032000ba,0xffa68f08},{0x01a0a558,0xc709f3a6},{0x03e18b20,0x97d5464e},{0x01e10656,0x502d4b24},
+{0x02211ac2,0x0ac44f26},{0x022010fd,0x215fc341},{0x01e01710,0x8c57d39c},{0x02a1002b,0x81156f75},
+{0x01a16a55,0x384aefa9},{0x02401a70,0xf997b78f},{0x02c16898,0x75977715},{0x05e0fbb0,0xe4032503},
+{0x0481f725,0xbac1feb9},{0x01e10662,0xba303099},{0x02e1f46b,0x83a0b569},{0x02c13141,0x42c09d1f},
+{0x0501f803,0x00a953f7},{0x02c16b2d,0x6f0bb258},{0x032001ad,0x69bef8cb},{0x02200cbf,0x203af348},
+{0x0261d1b6,0x2411ff3a},{0x060008ba,0x6d0b7561},{0x05e01b71,0x0c86ee8b},{0x0540fe81,0xa2865334},
+{0x02000684,0xbaa2429f},{0x02e0047e,0xb96060fb},{0x02c10cfb,0xcb771316},{0x03a1d58c,0xe8917e9d},
+{0x032100e0,0xcc67f451},{0x0381ee4e,0x6e027721},{0x04a1d809,0xee0f9cc6},{0x03e18c91,0x768ea009},
+{0x02a031fb,0x7f49f86f},{0x02811d2b,0x79818a74},{0x01e1132e,0x02bc3190},{0x03e18b65,0x9ccac0d1},
+{0x01e0a141,0x3a02b525},{0x04c01fe6,0xa01d9b51},{0x02600278,0x5c14ee4b},{0x0320040b,0xc8a7948e},
+{0x01a01bde,0xcebaf5df},{0x04c1d979,0xf26a2dfd},{0x01a0a406,0x57b9fb8a},{0x02c13253,0x86adc467},
+{0x020114d5,0xc22b3949},{0x02c1bc95,0xaabe557d},{0x00a1f363,0xb74f0905},{0x0221112b,0x2ec8521a},
+{0x01c0a502,0x183edf67},{0x010033b8,0xa0b53bb3},{0x03e18c6c,0x749558a8},{0x0361d695,0x3406de11},
+{0x03c0a704,0x7abd2a33},{0x014029fa,0xdb73a818},{0x03016826,0x01af059b},{0x02e1f01a,0xcd5e70d9},
+{0x01c0a3ac,0x5709f331},{0x02e14559,0xe53e5300},{0x02600723,0x762da9c7},{0x046120bb,0x6541f2f8},
+{0x01811430,0x402186ac},{0x02800791,0x9b27fea3},{0x02c13294,0x02b781f7},{0x024029dc,0xb690f799},
+{0x012026e4,0xe9d06bb8},{0x0480fcda,0x04d8269d},{0x0341d49e,0xd77ca38f},{0x0361ee59,0x308e3817},
+{0x0341f13b,0xe700eaac},{0x02e02c4a,0x5a9d1864},{0x02e14513,0x06b0e311},{0x02e1441d,0x247dc40e},
+{0x01e1f31a,0x580b3f95},{0x02610916,0x04a96f62},{0x0240aa86,0x5490288b},{0x0261b0b5,0xa55a6d7d},
+{0x0360fb3c,0x5171dcbd},{0x02802179,0x42677e88},{0x02410a28,0x2e2304d2},{0x01ae0037,0x58948099},
+{0x022010d9,0xeebdede3},{0x02e0aa67,0xf6f0e0ad},{0x018033df,0x906ff7e6},{0x01200026,0x4fdd4624},
+{0x02e0112e,0x16937a67},{0x01e1207a,0x4bfd4edf},{0x048027ee,0xdf93cddd},{0x02a01478,0xdaf58e6c},
+{0x0261e90c,0x8f9d625f},{0x0180333e,0xd0f0f7a5},{0x01a0a5ae,0x1affea86},{0x02000f6c,0xee0a035d},
+{0x01a0a211,0xa760676d},{0x0441f189,0x6145acd1},{0x0560fd56,0x57c6e4ec},{0x02212357,0xe6781dbe},
+{0x02c1f070,0x0c14f60e},{0x0240140a,0xb14bf097},{0x02418a91,0x51a18872},{0x03410cc6,0xa540b49b},
+{0x00a02601,0xc290e71e},{0x01c0a445,0x6a03b8ae},{0x00c02653,0x9cd003d4},{0x024019f1,0x9e3e6f24},
+{0x036001b9,0x3fe132bb},{0x03c0fdcf,0x9b003738},{0x0280ab14,0xb3ca1678},{0x02210ff2,0x384c9a49},
+{0x01e11191,0xb52926ff},{0x024114b4,0x4b8f12f2},{0x024188dd,0x0e0e98b3},{0x0320a963,0x024b298f},
+{0x040121e8,0x97b43c04},{0x0221036b,0x9911dfbb},{0x02e0fb34,0x35762fab},{0x0221f7e1,0x5a8193c8},
+{0x02611941,0x83d8c11f},{0x01a11424,0x7fad5e75},{0x04c0fc47,0xbb544def},{0x04c1d861,0x8dd55c9d},
+{0x02a02268,0xbafb8c74},{0x01a0a184,0x746def66},{0x0360a8e1,0x5502a6ac},{0x0501cf8f,0x72bd8a91},
+{0x028006e4,0x11f7a2f5},{0x03200d5e,0xf3d6700b},{0x02401aa9,0x146556dc},{0x0441d845,0xf45915f3},
+{0x0321d52b,0x12a1808b},{0x0320fb89,0xde278182},{0x0481d015,0xc73068a2},{0x02c131a1,0xce882b37},
+{0x0241f647,0x4fd4af81},{0x026101ec,0xbf993a76},{0x024104e1,0x36bff752},{0x030008df,0x2f3906a2},
+{0x032008dc,0x45006af7},{0x0560fe3f,0x7b2afb1c},{0x0261cf86,0xba713185},{0x02601528,0x189fe792},
+{0x028187f6,0xe889d5df},{0x0201061c,0xaa2dc092},{0x02c00562,0x7a34071e},{0x01c0a247,0x4a4a87c2},
+{0x022010dc,0x634143e4},{0x0301324a,0x7a56f68c},{0x0321f7bc,0xe04e0a69},{0x02a031fe,0x7b49f223},
+{0x0341f50a,0x9fba547d},{0x0221133f,0x095bb8bd},{0x05a1d936,0x951d050a},{0x0480fcae,0xf9cb14ce},
+{0x03812196,0xe049d4a5},{0x02a0ab22,0x9bd8238d},{0x03002a3d,0xce5eaf1f},{0x01c0a572,0xf8f9e391},
+{0x026012b9,0xdf179372},{0x02c1f068,0x68e959a0},{0x02c13022,0xfc249e8f},{0x0400020d,0xbd0d6a15},
+{0x03e18b05,0x08cfe803},{0x02401b58,0x4312a34e},{0x02400926,0xe895c4bc},{0x0620fcdf,0xccf8dffc},
+{0x042006b8,0x92e672c8},{0x02a11da4,0x5ad72f17},{0x02e1442f,0x1c6eacec},{0x0460180d,0x002fed01},
+{0x0220ff16,0xde08f4f3},{0x02a0fe5b,0xe350d4ae},{0x03c02ae3,0xdd0ba07a},{0x02810adf,0x0252ff41},
+{0x02000604,0xc84337b6},{0x02e14461,0xa88c0b64},{0x07e02965,0xe2d975f0},{0x03c1f448,0x005d12c5},
+{0x03e0a64c,0x69a898d7},{0x02418a71,0xc5a8fad3},{0x02e1452f,0x01ac5e04},{0x02a10439,0xaf8e9d46},
+{0x0361e12c,0x3ee70588},{0x0380fb76,0x7d483320},{0x0461fa0a,0xeef9576b},{0x0301d8a7,0x7abbb0b6},
+{0x01e029c0,0xa2b3df71},{0x0281d885,0x809eab08},{0x02e14495,0x9f0a9691},{0x04801f34,0xb4e82cb0},
+{0x03216e5d,0x66854b64},{0x02002217,0x5ef21229},{0x02a1f0d6,0x318e4595},{0x022013e6,0xe808f00d},
+{0x0101f41d,0xd56be4f0},{0x02000cbc,0x82a12e47},{0x03010c35,0xfce433fe},{0x04a1bc24,0xa87cc48b},
+{0x01c0a2d1,0x0a01a8ea},{0x01c00989,0x4321f074},{0x0241d1cf,0x5e16c7f4},{0x01c00c06,0x0833b193},
+{0x01a0aa1e,0x8d9d70e1},{0x020030be,0x62b21550},{0x0121f4a9,0x8a569fa6},{0x026014a7,0x326e73b4},
+{0x02000e91,0xe2599aee},{0x02800700,0x10eeff46},{0x02200788,0x050adde7},{0x02e14558,0xe63e5493},
+{0x0420252c,0x8fe8bc0c},{0x034015a7,0xfe9c971e},{0x01a00be7,0x78d6267b},{0x02418aba,0xca97b991},
+{0x02200aea,0x92835cd7},{0x03e18cce,0x458739f3},{0x01e106f8,0x2e9f9b3f},{0x01e1144c,0xac3062f7},
+{0x026168c3,0x6a142e24},{0x0400201b,0xf1b350ed},{0x02002ce5,0x14007756},{0x03011c98,0x32a16b33},
+{0x02c13084,0x3a212cc4},{0x02c1682e,0xfbf7118e},{0x0441d734,0x329ded65},{0x0281695a,0x836bf21a},
+{0x02a0a993,0xbb4274ef},{0x02c132bd,0xf49b98a1},{0x0680fdf0,0x4a29dbed},{0x0180a4f5,0x2ac29b40},
+{0x02802cb1,0xb436026f},{0x0360a79c,0x3ba5aebd},{0x0341e869,0x44a0257a},{0x03a1d58b,0xe7917d0a},
+{0x02a029b8,0x1938b216},{0x0300abe5,0x6dde7461},{0x0380a698,0x00249d96},{0x02616b07,0xf68799f4},
+{0x042120b0,0x99044814},{0x0300fb57,0xd1c89e94},{0x02c1057e,0xb6d828b9},{0x0460fcb1,0xa0ffeb91},
+{0x01a00ed3,0x8ef5d664},{0x018016ce,0x6e2512d8},{0x0560fe37,0x115453ce},{0x02e145d5,0x7bf226e7},
+{0x02e1216d,0xe8c91a91},{0x02c133d1,0xf51bf3a4},{0x03801477,0x1628033d},{0x0361f733,0xd7df24a4},
+{0x030024d3,0x4eb6aade},{0x0380217e,0x2cf0073f},{0x03411a94,0xe3341b0e},{0x02801334,0x8e92e0ce},
+{0x020013ef,0xec34c4af},{0x04a0fc27,0xc92fb524},{0x03e1d7ea,0xba7e5d0f},{0x02403263,0xa0150b73},
+{0x02001b85,0x045c88d2},{0x03a1d681,0xc2585ca6},{0x0581fb5b,0x43f7f5cc},{0x02c13326,0x6e127915},
+{0x02610883,0x40765e87},{0x02a1d332,0xa881d833},{0x0201060e,0xb32dcebd},{0x03802a8a,0x3e44909a},
+{0x01c0a2f0,0x94ad3bd6},{0x03c0257f,0x57914972},{0x03e18c1e,0x3aa1c94d},{0x02a11d2d,0xaa30b08f},
+{0x02001b22,0xaad9b0d1},{0x01e01aa3,0x1aaeb050},{0x0341012d,0x265347a7},{0x01e0064a,0x4484c935},
+{0x020030c5,0x48e8065c},{0x024115b3,0x8d680029},{0x02418a8a,0x5aa1969d},{0x03e1ed31,0x8e372529},
+{0x0761d9f3,0xebe7b61e},{0x02616b12,0xca965f3a},{0x01c0a410,0x29d30623},{0x0281fa48,0x0586e878},
+{0x04800206,0xe4d8cd07},{0x0401cf02,0xb903c3d7},{0x04601ac4,0xddd9492a},{0x0421d721,0x20806acc},
+{0x02402f6e,0x2e92794a},{0x01a006d0,0x11167ed4},{0x028018be,0xd67aee8d},{0x03601e21,0x64affb2b},
+{0x01c0a165,0x0388a0e4},{0x01e0311a,0x84fa012b},{0x012023f1,0x1ac04428},{0x0201119b,0x7845f9f2},
+{0x038026a4,0xa1a63b1c},{0x0400030e,0x3e108e81},{0x03e02ce2,0x002ee8a0},{0x03e00109,0x07ea7feb},
+{0x03616813,0xe1a367cc},{0x0241228a,0xcbb37207},{0x02402bb3,0xf669851b},{0x04c1f604,0xd07e5bf6},
+{0x026012f9,0xae293bcf},{0x020031ac,0x9b7c797a},{0x0201207e,0x3cc2c127},{0x02e001a8,0xe529b122},
+{0x0421eea5,0xbd9e9e55},{0x03416800,0x341d6b3d},{0x02210305,0xa064012f},{0x0360104e,0x2f9b283c},
+{0x026012e5,0x60eb7e4d},{0x046001c8,0x405bf40e},{0x022031a7,0x484f858d},{0x04410eb1,0xeb5b53ba},
+{0x02418a1f,0xb33d9b52},{0x0361d5c9,0xd99ca8d6},{0x02411c11,0xb687ee10},{0x02c10a38,0xfa7ad8cf},
+{0x00a0222a,0x44481394},{0x02401834,0x503da313},{0x01c01792,0x8b62dc7f},{0x024189bb,0x21c16095},
+{0x03400834,0xcff9f60e},{0x0301d1af,0xa289a8cf},{0x02e00dd9,0x45371078},{0x02c01862,0xa0f373b6},
+{0x02c1d1bf,0x838bac11},{0x0341d4ab,0xc87c8bf2},{0x02e144de,0x1e2124cd},{0x03802a73,0xce7c364c},
+{0x02c02a66,0x72d946b1},{0x0241887d,0x8de3335e},{0x02c0056b,0x7ae72641},{0x0321013f,0xf097e55b},
+{0x02c020dc,0x09e4efd6},{0x03412114,0xcffbcd5b},{0x02a0051b,0x19b149e5},{0x03401ebd,0x7d685247},
+{0x02011c82,0x8fa0753d},{0x0521d97c,0x87e103d2},{0x02200731,0x41bb4c41},{0x02202fa6,0xcff0446f},
+{0x03616810,0x50a59a81},{0x03a0fa7f,0x023b331e},{0x03400159,0x66db330d},{0x02e1f853,0x86eb3975},
+{0x0181e294,0xa2c23ea1},{0x01a0a47d,0x4a2f06bd},{0x02c0abb0,0xad4ac6e9},{0x026012df,0x8ca46076},
+{0x05e1d826,0x8d416d8b},{0x02211054,0x2df66ce9},{0x01a0a10c,0x097cb8d5},{0x0061f68c,0xe48aef19},
+{0x0381f63d,0x062faaa0},{0x02000712,0x6990d89d},{0x02a0ab0c,0x8dbf39c6},{0x026006e9,0x65aa06ea},
+{0x02210f7c,0x2c38bfbb},{0x02600936,0x4ee34e3b},{0x0341d439,0x31b2b723},{0x04c1cf9d,0x725b98ec},
+{0x01a0a2fd,0xd130190e},{0x03601666,0x0ed4e8ce},{0x01e1f682,0x0daa5402},{0x03a1d7e8,0xf0b08f7c},
+{0x02602b02,0x31f663bd},{0x0161f4e7,0x68bae81f},{0x01e0a906,0x63e305ad},{0x0781d9ec,0x0f9c5fd4},
+{0x0320ff7b,0xfcaa8fae},{0x026100da,0x999897c7},{0x0280abcd,0xda8d76df},{0x0361e893,0x856d0198},
+{0x0321f530,0xc1da1d33},{0x02a02277,0xce8f94ed},{0x02e14446,0x20733066},{0x04602743,0x202e4ac7},
+{0x0260110b,0x1a8fed58},{0x028018ba,0x54c6ec7d},{0x03014497,0x89a828ad},{0x040124c1,0xcf647192},
+{0x02c1303d,0xf6158a93},{0x0401da48,0x55700acb},{0x04a1d04b,0xb021c4fa},{0x01a0a017,0x6ff534da},
+{0x0301042b,0x1aeef097},{0x02801258,0x44e6cfe1},{0x02c132f3,0x52433a5c},{0x03401597,0xb92e1570},
+{0x03012025,0x23fa4e50},{0x02e144e8,0x8ca728a7},{0x01c01c46,0x790cc437},{0x02a1183b,0xde38eab5},
+{0x02400cc0,0xbdcc8a93},{0x01e01927,0xe58bdb9b},{0x04611a3e,0x2e30634d},{0x03e1d07f,0xe6df1bbe},
+{0x0520253e,0x28e7715a},{0x01a0174b,0xb3d94dd3},{0x0321d708,0x9922336d},{0x02010391,0x5238169e},
+{0x02010620,0xac2b8521},{0x01e114d2,0xbe81bec5},{0x02201828,0x582e9b0a},{0x02e144f3,0xf5aa0c89},
+{0x0261f000,0xc5234522},{0x02a0aa61,0xea4b79d6},{0x0340aa5e,0xef7f86f7},{0x03401deb,0x251b5d72},
+{0x01a025d8,0x7d3a3a03},{0x03a1d6e3,0x1eca702d},{0x01e114ae,0x8f761d9c},{0x0501da72,0xb0f95806},
+{0x02e16871,0xdfe88990},{0x03e0a707,0x385862fb},{0x0201218d,0xdc60c142},{0x030028ed,0x3a73abf9},
+{0x0301d90f,0xe5b3fc58},{0x0261036d,0x1256e78b},{0x0241888e,0x02dddb5f},{0x02801d43,0x5f8c6ed2},
+{0x01e03117,0x8dfa0f56},{0x0300fb8b,0xdbea62da},{0x02a10cfa,0x87c600be},{0x05802b5f,0x5ee3c9bb},
+{0x01e0191d,0x6b76944f},{0x0361f00b,0xfae5502c},{0x032100f5,0xbd635f86},{0x04001e84,0xbc220b2d},
+{0x02200c40,0xb5869921},{0x01e104a2,0xcdba9866},{0x02e1f0be,0xb4e4c2a8},{0x0260142d,0xf3728db5},
+{0x0361e839,0x6117da68},{0x03012380,0xdffcd991},{0x07c02969,0xf108bfc5},{0x03e0a7f5,0x5e01cb98},
+{0x040027fe,0x8b7bbd41},{0x02c13398,0x2cbe29ba},{0x0201047a,0xc19927a5},{0x0240aa8e,0x54c1c557},
+{0x02602e83,0xc7737a95},{0x02e00b63,0xe6f21708},{0x0180a1ec,0x44613991},{0x0221083c,0x8def7600},
+{0x0221f6eb,0xd4d06e05},{0x02801570,0x005d7512},{0x02e14631,0xdac44f08},{0x0161f68d,0xedc06f03},
+{0x032002fa,0x240927c9},{0x02a0aba7,0x1940beb3},{0x02a1222d,0xc1e4767e},{0x02811c61,0x413dc902},
+{0x02402047,0xe94bcb4d},{0x0180a034,0x525900d6},{0x036015fd,0x5b7ae8a9},{0x03002a0e,0xe35a50a0},
+{0x02c13080,0x36212678},{0x0301f032,0xae3ae982},{0x0200a987,0x2680dd3e},{0x03801504,0x0f632f2d},
+{0x03210a91,0x106d0f71},{0x01a11104,0x4d88375f},{0x014033c1,0xdfaecea1},{0x03c1cf64,0x3c431daa},
+{0x0280144f,0x24350b4e},{0x026124e9,0xe6c8d0c2},{0x03412253,0x29cf9901},{0x03a01443,0xfcf691e7},
+{0x02a10410,0x32399519},{0x02001973,0xab0a2fa9},{0x04600f8f,0xb96c15e4},{0x02402066,0xe4976096},
+{0x01c110a3,0xa01dbb88},{0x030103c8,0x38899e66},{0x0640fda7,0xaa8498c5},{0x01c0a380,0x975d7b88},
+{0x0241f0ee,0xd47030dc},{0x03014434,0x383f8df0},{0x05c023ee,0x5bc60449},{0x02e12135,0x8b2a8c13},
+{0x03c0d7ec,0x81f58696},{0x04210b3c,0x2ac7af69},{0x02e13299,0x09ae5b5f},{0x02c1f701,0x2916abed},
+{0x02e0302e,0xcda705a2},{0x0361ec87,0x1e04907e},{0x0200a850,0x2680ed07},{0x02a0ab0b,0x79b48cee},
+{0x00a026f4,0xcd05975b},{0x03e00aff,0xf36af431},{0x01600e9a,0x5d5324a0},{0x02418930,0xa27bcd9f},
+{0x02210817,0xdbcb1ff1},{0x0401d0b8,0xc1dfba0a},{0x04001e5e,0xf3e2519e},{0x0200a90f,0x652c0244},
+{0x014007ca,0xf58f20b2},{0x0180a549,0x03e6a5a2},{0x02402e97,0x89a35607},{0x0401d77f,0x024c76f8},
+{0x02c00593,0xe4975b75},{0x01a02319,0x09a2442d},{0x00e1f487,0xd6bdf8cf},{0x0361e8b5,0xf9f1c2a9},
+{0x03e1d57a,0x5af4eb80},{0x01a1092a,0xa8bf771d},{0x02202fc4,0x7f1c901d},{0x02800f14,0x7e6ad9ca},
+{0x0260fe0a,0xac9c8cfd},{0x02e1bc2f,0x1cbbe2d1},{0x028019b8,0x6d7c8e33},{0x02418881,0x95e57e8d},
+{0x01c0a1e1,0x4ad0d552},{0x01a11011,0x7559ddd7},{0x03002ae7,0x92c391ff},{0x0461d616,0xcea2cea6},
+{0x0321084a,0x5df7de34},{0x0281682a,0x8c9d4588},{0x0301d4b7,0x4ba137ad},{0x032109c3,0xb60c2a61},
+{0x03e01ecc,0xf3c968e0},{0x026e0118,0x28a88924},{0x00a1f337,0x7359242b},{0x042002d3,0x02f4d5bf},
+{0x04c1d8c8,0xf7062dab},{0x026118e0,0x9b8eb94f},{0x02a0abb9,0x312090d0},{0x01a0a6aa,0x8f4a668e},
+{0x04202b43,0x2f925787},{0x0320a86e,0xbd567fe6},{0x0180a31c,0x8a7e29d7},{0x026019d7,0xd39dcfbf},
+{0x0361ee89,0x72977744},{0x01a0a49b,0x181f1ba2},{0x01e1f49f,0x2e49c11d},{0x02e11d3f,0x670583e6},
+{0x01c00387,0x6d229ac7},{0x026e010c,0x9c9a3536},{0x0141f697,0xac2d6b88},{0x02400a4d,0xbc082d38},
+{0x01a0a121,0x7bdb9430},{0x01c02285,0x14c67ea9},{0x02e14578,0x764175da},{0x0300301e,0x6b53454a},
+{0x050004b9,0x696af5f9},{0x04e1d14c,0x0bd94370},{0x04a0fd32,0xa61b91c8},{0x01c1e2d2,0xb343f8bf},
+{0x03216e47,0x6d855669},{0x01c0a26a,0xefe1272f},{0x0280abd4,0xab07a287},{0x024007e7,0xc56ccbc8},
+{0x03e18c79,0x7a932383},{0x0160a4ee,0x7c111269},{0x02c115bc,0x1b19ef23},{0x03c025c2,0xdb5cd2be},
+{0x0221115d,0x0e0b38d0},{0x0521243f,0x366e56c6},{0x0480fc0a,0x89e39ebe},{0x02610ad7,0x6757755d},
+{0x02011eeb,0x179e03c5},{0x0301454b,0x56e2df12},{0x0200aabf,0x60b7bab6},{0x0280155e,0xfc328dbf},
+{0x0320d7e0,0x76095263},{0x0221d308,0x7ae7d7e0},{0x03416b75,0x5964c658},{0x0241895c,0x2e85a45f},
+{0x02e145b9,0xf32ae152},{0x02411929,0x63c85bab},{0x0400301d,0x4d0b9768},{0x01c11026,0x2e755bdf},
+{0x01a1e2ee,0x3926e2ac},{0x01c0a1aa,0xd431dd6a},{0x0341ec88,0x8536e146},{0x0301f045,0x4ece4ff9},
+{0x02e14536,0xfaae9196},{0x0180a595,0xefe68626},{0x03a1d5ae,0x5b7bbe0a},{0x030024e8,0x5bb6bf55},
+{0x0220aaf6,0x9dd1290b},{0x03e18b33,0x9ed78fea},{0x01c0178e,0x05df9807},{0x02a00797,0x049e3716},
+{0x03c0a706,0x8ac3ff28},{0x02411c1e,0x09036fd1},{0x038120aa,0xafaddf70},{0x02201cf7,0x8588eff7},
+{0x0501d84d,0xf3ee1add},{0x02602e23,0xee4150dd},{0x0141f6b9,0x6f4ecc9c},{0x0600fd6e,0x640f8020},
+{0x02c130ed,0x13d28c0f},{0x02602581,0xa10b0bb8},{0x01e10e83,0x693548d0},{0x04e1d63f,0xffe1a438},
+{0x0360fb15,0x54b0418a},{0x01e1fb06,0x96ac3dc9},{0x02011c79,0x1d46ae35},{0x0441d7f1,0xeec6bd31},
+{0x036001c6,0xfa2bd0c1},{0x02a024f5,0x9dc77607},{0x01e01762,0x70d240fb},{0x0621fa45,0x26aa362e},
+{0x020013aa,0x91f38fab},{0x04201e1a,0xed16c3c5},{0x02202fc3,0x335617e6},{0x02e144b8,0x8c03bce3},
+{0x0361fb7f,0x8640defd},{0x02401a67,0x1f574c0b},{0x02001050,0xa7bf77fe},{0x04e1d64b,0x13e1c3b4},
+{0x0340114b,0x134779ed},{0x0181140e,0x385316e0},{0x01a16f38,0xaa49dff0},{0x02e00f12,0x24c7ff4f},
+{0x03a01e25,0x4efa0d8c},{0x01202212,0x00a2b0aa},{0x01c0a50d,0x6a861ae5},{0x01811615,0x6bfcf33b},
+{0x03802c07,0x12db032c},{0x01a02e5d,0x928a4b38},{0x02e01874,0xce4bdadd},{0x04601cfa,0x3405e38f},
+{0x03013415,0xc4de475e},{0x04001ea2,0xeed3376a},{0x01a00bb0,0xa5000ac9},{0x01e10b2b,0x8558f677},
+{0x01e0aa2e,0x35b3b660},{0x03802c33,0x98755102},{0x02c13043,0x00159a51},{0x0261203f,0xa5632bee},
+{0x0240071e,0xb71726cd},{0x0181f696,0x5e38f18f},{0x03212012,0xefc0df82},{0x03e18cc9,0x81879867},
+{0x0581f81a,0x49b148d0},{0x02800d48,0x5d8f7c92},{0x02c02859,0x25057c55},{0x02e1f850,0x9c591a8a},
+{0x03611a95,0xf4e1c777},{0x02418a21,0xb13d982c},{0x032011db,0xac843006},{0x01a01787,0x0b002e40},
+{0x02c121ef,0xb23e62c2},{0x0421fbc3,0xc97d06d7},{0x0541d929,0xa09f3f0c},{0x0320ff8f,0xd07d2acc},
+{0x01a029a3,0x1fb73d52},{0x024012e9,0x090b83c2},{0x03201c34,0x0be6d9c3},{0x0280128c,0xdaf5119f},
+{0x0480fca9,0xdbbdd40c},{0x020103c3,0xd2d3cfb4},{0x04e01ea7,0x69c14a7b},{0x02402f5a,0x9a0b6695},
+{0x02a033af,0x9e8d8c19},{0x05a1fa39,0x9a4e891d},{0x03202e1d,0x0459c9b2},{0x036118b9,0xe8c758b7},
+{0x0221203e,0x06c37472},{0x01a01c23,0x47b01907},{0x0361d02d,0x3d2c927c},{0x02e14612,0x79012cb8},
+{0x0301da9b,0xa2d6a79e},{0x0361e817,0x08156d00},{0x03202b17,0xc419b0d9},{0x03c10b45,0xf0b655c6},
+{0x024108a8,0x870cd757},{0x02401241,0x191f24aa},{0x03610b8b,0x4ec2acb8},{0x03012198,0x5c43be09},
+{0x02c01859,0x6d2c053b},{0x0400251c,0x3dfc37b0},{0x022110b2,0x53df02cb},{0x0381d867,0x0558b5a1},
+{0x02c019a6,0x0960a6db},{0x00a1f5d0,0x80f3737f},{0x02a0257a,0x8bf5775a},{0x01e1fa63,0x8cb15664},
+{0x01e00f60,0xbdc501cc},{0x04202975,0x085a0871},{0x02402f3c,0x86b51917},{0x02c032be,0x10908316},
+{0x03610d19,0xf79d23bc},{0x0260fe0e,0xa89c86b1},{0x0200116e,0xdf2bab2f},{0x02a16966,0x52aca39c},
+{0x03003257,0x17cef534},{0x02010646,0x2c46921e},{0x02e122af,0x7813afde},{0x0441eeae,0x3c06616b},
+{0x0281e8c7,0x512eb3bc},{0x03602485,0x8e964e1d},{0x0481da0e,0x6082b4c1},{0x026100b4,0x524cab5c},
+{0x05202b34,0x3d3ffeab},{0x036011b5,0xb4797c90},{0x02600138,0x45194af0},{0x042008ae,0x5027f987},
+{0x028e016e,0x746acd09},{0x0201227d,0x04100085},{0x0340112a,0xe17dee9a},{0x03802e00,0x8fc07abb},
+{0x01c0a394,0x3eba44c2},{0x026118ea,0x5d905cfc},{0x0581d8ea,0xf1e4dc9c},{0x03a00248,0x46bef2f3},
+{0x0341da11,0x09ad32f3},{0x02012229,0xf802726b},{0x0381d499,0xae1ff49f},{0x0421d776,0x93c8cb41},
+{0x02e1341b,0xb4cf2bdd},{0x0540fd9a,0x54f9c2de},{0x024005e1,0x90e08807},{0x02802b1d,0xdf22e268},
+{0x02c13089,0x2f211b73},{0x02a0104c,0xa0a982eb},{0x02003080,0x5429ecb0},{0x04c01e3c,0xca9ab964},
+{0x0260130b,0x48e3dbef},{0x01e10712,0xf7651125},{0x03801a59,0xd3ce46ef},{0x05e02ba3,0xbf3ff1a5},
+{0x028119b7,0x3a8eafdb},{0x028e0170,0x7e6adcc7},{0x0341e837,0x4f37e9ad},{0x01e106bc,0x3eb57abe},
+{0x0360097d,0xdf37ad90},{0x01a0a543,0xf3260f67},{0x02a1d304,0xfa9e5344},{0x028018bc,0x7c7658d4},
+{0x02c13154,0xc1c3a3a3},{0x02c025af,0x903fb8b9},{0x030028eb,0x90a5de16},{0x03e02a87,0x2b54254c},
+{0x04e0a70e,0x85361ec5},{0x03802c3f,0xb122c8aa},{0x0340ff65,0xce6921fe},{0x02a105af,0x7825ff9e},
+{0x03e18c84,0x7790e033},{0x03016877,0x8b0790d3},{0x03a1e009,0x84d17314},{0x03c024ab,0x10014814},
+{0x01a026cc,0xd00f891c},{0x038122b6,0xe8b233ad},{0x018033a7,0xc6463c00},{0x02a168fd,0xbc2be299},
+{0x03e18b45,0x98c63d57},{0x01811686,0x6d50b2a1},{0x01c11457,0x05dbfe4e},{0x026124ea,0xd9b6255c},
+{0x01a01782,0x4b141ab8},{0x028014b6,0x48a44757},{0x01c0a57d,0x3dc2fcb1},{0x04012279,0x0c63b4b2},
+{0x0180a0fc,0x5a8aaa3a},{0x05e1d0d2,0x17aabb01},{0x0341054a,0x70499389},{0x02c13174,0x40cb2755},
+{0x0401e8d0,0xc0e3c63b},{0x01c102a1,0xb712d4e9},{0x03016916,0x4c9d852d},{0x01e11c81,0xc15fff4d},
+{0x02e14547,0x8295cfc8},{0x0180a6a9,0x6cd1d474},{0x0241898b,0x35927b57},{0x040020d2,0x4fce9565},
+{0x01c0a47a,0x4b4a41ce},{0x02a0a877,0xe186f87f},{0x0061f41b,0xf88b0e95},{0x02418908,0xa3187d9e},
+{0x01a0a04f,0xdfb02c4a},{0x0181f493,0xb55d1c59},{0x0401d54b,0x33895c8c},{0x028110d1,0x86279f78},
+{0x02802577,0x20c3ab73},{0x00a1f946,0xac91bad1},{0x02401268,0xe52b9ec1},{0x0361d6ed,0x826c4981},
+{0x030010a1,0x01920c62},{0x01a1028f,0x08ee1e89},{0x02a01982,0x754b570d},{0x02e1d12b,0xf8af0ddf},
+{0x0360217d,0x7dbc91bd},{0x01e121b7,0x8811350b},{0x026169a0,0x351930b0},{0x03e01e40,0xbdc5ef7a},
+{0x0541f82c,0xbff88e10},{0x01e10ea2,0xcf88c6f6},{0x02000aaa,0xab9b13ad},{0x0281f506,0x712cdbe2},
+{0x05612149,0xf412936c},{0x02611915,0xaa4090ae},{0x02010332,0x46ea727e},{0x01a0a25b,0xa767b3e2},
+{0x02c1310d,0xed148ace},{0x02411c5f,0x22280165},{0x0221046e,0xa2998d2f},{0x0441eea6,0x5cfa29ba},
+{0x01e1da6b,0x180d5a60},{0x03202e21,0x7832b42d},{0x02e0057b,0x81000126},{0x024188fe,0x931aa305},
+{0x01e103a2,0xc21a9676},{0x0221bc33,0x80291484},{0x02e14538,0xf8ae8e70},{0x0441d723,0x63ab8a9e},
+{0x02e1d333,0x017c7a1f},{0x01a1f450,0xd3dafbd4},{0x01a0a30a,0xcb7daf31},{0x0121f197,0xe66459c0},
+{0x0241882f,0xfa8987bd},{0x01e102b1,0x7233eee9},{0x02c131cb,0x54faa2f4},{0x01c0a930,0xb952ea52},
+{0x01c1208a,0x8735fee3},{0x0241036e,0xd390def5},{0x02c1216e,0x982da2f4},{0x0360154d,0xaf30f043},
+{0x02e13129,0x2fe034a3},{0x03e0113d,0xbd620260},{0x02a00570,0xb5bbdf9c},{0x0260d7be,0x35aa6050},
+{0x0181f640,0x4d29851e},{0x03210853,0x14b4f9b6},{0x02e01a6c,0xfae65776},{0x0381d6a8,0x39830ea2},
+{0x02816b1a,0xba1e098d},{0x03c0a791,0xd29128fb},{0x01c00eb7,0xe1767b27},{0x05401f1b,0x9e467679},
+{0x0280ab73,0xbbeefa49},{0x0301233d,0x27c6c480},{0x03a1eca9,0x1c101574},{0x01e12312,0x9ad8fa63},
+{0x03802c5b,0xbc7989e5},{0x01400ead,0x0b91b168},{0x0540fd75,0x5b622f7f},{0x028e01e0,0x99e1e094},
+{0x03c1f1f4,0xb4244c8e},{0x0321d117,0x26956277},{0x01c1fb26,0xd42769dd},{0x00c1f3c6,0x64df03bf},
+{0x01c0a286,0x007ca56c},{0x020013f4,0xd934a6c6},{0x0601eef0,0xa80d94c6},{0x02c104c5,0x997c3154},
+{0x02e1234d,0x30ada6d1},{0x03e18b6e,0x0ccb7121},{0x0281d1d4,0x17ded95d},{0x0261b0b7,0x9f5a640b},
+{0x028119c5,0xc1e0cc02},{0x0300290c,0x2e058573},{0x02c13173,0x3fcb25c2},{0x032008f8,0xd2413d4d},
+{0x03a1d91d,0xffbb3092},{0x0361d1e3,0x1e1c63f4},{0x0160a00a,0x51845b5e},{0x022111dc,0x32daf581},
+{0x0361ee52,0x983f97ba},{0x02001044,0x31a45a9d},{0x02202f4b,0xd149fd68},{0x01a1e29a,0xaca3f2cd},
+{0x0101f4d8,0x792cf530},{0x028e01c6,0x19d5de21},{0x02e145d9,0x7ff46bca},{0x04e1d164,0xdcd88ddd},
+{0x04000151,0x9e082700},{0x02e1da1a,0xfb64361d},{0x03c1d6f4,0x50ea371a},{0x03216e4c,0x62854518},
+{0x030027f8,0xab474fc9},{0x01e110ac,0xeff2d33b},{0x022032f7,0x0b1ee1c0},{0x0241f540,0x0929096c},
+{0x01a0a262,0xa95f384b},{0x0521f807,0x91587699},{0x02a032ab,0x4d619d4b},{0x022032f1,0x070d9253},
+{0x026100a1,0xca475816},{0x032169da,0xc93accd2},{0x03c0a8f6,0xaa595ea3},{0x0380ffbb,0x31371a98},
+{0x01c1f585,0xd6154466},{0x01c0a398,0xfebe5d30},{0x02c1d42a,0xe497f748},{0x03e029fd,0x062bfa03},
+{0x02402bc0,0xcc9556ac},{0x02e144df,0x1b212014},{0x03c1ee71,0x0afad08d},{0x01c0a443,0x780cc914},
+{0x040124a1,0x016ae728},{0x02e1322b,0xd06ebda7},{0x03802762,0x679ffbc0},{0x03000898,0x0d4338ba},
+{0x012e007f,0xdeafa969},{0x020030b3,0x22d68169},{0x02a0ab83,0xf12cf803},{0x056107b4,0xfcb9f7f3},
+{0x02610a35,0x64ba635d},{0x01a0a032,0x241bcca6},{0x0321d36b,0x3d00f7d2},{0x03012221,0x44ac61ac},
+{0x0161f9fb,0xf3f90b3b},{0x0361cf5e,0xfc73d61d},{0x0521d0a6,0x9f8751cb},{0x02a0258d,0xab82184b},
+{0x01c0194f,0xffa013c1},{0x01a0a039,0x0d925fa0},{0x01c01c1c,0x34179503},{0x01c102c2,0x270b3674},
+{0x02e02a72,0xb5028e4d},{0x01c10283,0x17f75d3f},{0x02a02a67,0xd3d33ae4},{0x03a1d743,0xf24e6ce2},
+{0x02201364,0xf0c77b35},{0x0361ee88,0xdbb96b2b},{0x0201f66e,0xc5112c40},{0x036016f8,0xcf6c3aa8},
+{0x02a168f4,0xc429e772},{0x03a0077e,0x3cb58037},{0x04402c0a,0x771be228},{0x01a0a3fd,0x6a887ca7},
+{0x0161f3c2,0x1ee86605},{0x03402c34,0x488aff07},{0x02400930,0x245e7636},{0x03e18c0c,0x5ca43d6a},
+{0x024189ef,0x9ddc6746},{0x0581d052,0x5fcb2bb8},{0x02c13119,0x6e11844a},{0x0481cfb2,0xf4919cbb},
+{0x02200634,0x37739f4a},{0x02e1338a,0xfb54ab9f},{0x01a0a204,0x886036a0},{0x01c1169c,0xe9207809},
+{0x02c1327d,0x81ab7df1},{0x03002767,0x2ee77854},{0x02e14589,0x6c349a29},{0x02810ac1,0xc1de4ed1},
+{0x0301d456,0xafca0ecb},{0x010020a5,0x54e7df4e},{0x0400a670,0x1b7428e7},{0x038007f2,0x6ae44bab},
+{0x02e13015,0xf5772b5b},{0x0440a7b2,0x898bae62},{0x07000775,0x063990bc},{0x02800888,0xc39f6e02},
+{0x03210848,0xb54fce23},{0x03401d44,0x0c516b2c},{0x01a1f5cb,0xcd238553},{0x0340255d,0xf03fb69b},
+{0x02c10ad8,0x3137efd9},{0x00c1f6bd,0x5723ad08},{0x01c01911,0x800d3b8f},{0x0221f0e3,0xc0f80826},
+{0x0201062a,0x1e286700},{0x0221f5ec,0x70f43bff},{0x0201131f,0x05623d45},{0x032111ed,0xddf3abe7},
+{0x04600c00,0x65585022},{0x03e1d8a2,0xb22ee43c},{0x02600800,0x82844a37},{0x02000bc2,0x6418af22},
+{0x02011834,0xdba83956},{0x0340fb6c,0x27be9d92},{0x01e007ad,0x87d8362e},{0x0340a699,0xa367f583},
+{0x046033e1,0x8e20aabf},{0x0561df1a,0x39882e94},{0x02200b56,0xc5e8b646},{0x01e005d9,0x646a0a4a},
+{0x04604dc2,0x2e301eff},{0x01e106bf,0x42b5810a},{0x03c02a48,0xa90c9d7e},{0x01e01686,0x3ecfe5c5},
+{0x02a1e91f,0xedb715fd},{0x0441f862,0xa8ac2482},{0x02a01bbf,0x4e44c51c},{0x02601817,0x47edd22d},
+{0x0360111b,0x1bda4c17},{0x01e022cf,0x00277fe2},{0x0200a90d,0x7aa136bc},{0x0381d1e0,0x92768f5b},
+{0x0300d7f2,0xad6da1fb},{0x03810ca1,0x5147d0d5},{0x03a1daab,0xc19fd5d8},{0x016026ba,0x77902419},
+{0x020009eb,0x9a81cbe2},{0x0340ffb8,0xac414c0c},{0x01e1069e,0xc434bd85},{0x018016cd,0x77252103},
+{0x04c0ab44,0x8175c57c},{0x0180a495,0xb18a4110},{0x0320fe8e,0x0a16269f},{0x0440fc8a,0xdbef55e1},
+{0x01c16a78,0x9ff4e6dd},{0x04000493,0x2cb39e0b},{0x0340fecb,0xb072c487},{0x02e1fb72,0x5a0cb41b},
+{0x01a02bd5,0xc30c8c4b},{0x0300fe90,0x42889f42},{0x02601340,0xbc8e92b1},{0x01a0a117,0xfa7ca138},
+{0x02a0051d,0xe1b701eb},{0x01811656,0x8a4860b1},{0x01e0a2f1,0x989a79e7},{0x01a0a078,0x6d6ba5ca},
+{0x0601fb6b,0x02335649},{0x046109fe,0x86beac55},{0x0160270c,0x6fe24390},{0x03e02370,0xec153cda},
+{0x02e1f4c9,0x598db9cd},{0x0201129c,0x3fee8cce},{0x0260267c,0xe35ea8c4},{0x03a1f7c7,0xc247c123},
+{0x034024b9,0x4d65ea8f},{0x0580fd8a,0xcd48cbc9},{0x03a02b3f,0x17efa920},{0x01c0a151,0x3f6aea44},
+{0x01e1066a,0xc0303a0b},{0x02c131e3,0x43ff055f},{0x014029f8,0x230ddb1c},{0x02c1e948,0x55e69d1e},
+{0x02c110bb,0xbe5c60c6},{0x028017b4,0xa236dbaa},{0x03e18b67,0x9acabdab},{0x0160229d,0x8122131b},
+{0x02400f83,0xda730c22},{0x010020b1,0x8894d839},{0x01e02eb6,0x7be6e940},{0x01a0a3e0,0xce2462ae},
+{0x024188ba,0x0efc0357},{0x04e1d81b,0xbefb1493},{0x02c1f0b1,0xab41931e},{0x01c11737,0xc6ae4d22},
+{0x040020d4,0x3c17c987},{0x02a1204a,0xe94aa960},{0x026104bb,0x50ba08e9},{0x02a11637,0xa56a8d89},
+{0x03810998,0x95ed4abb},{0x03e01e0a,0x5051b795},{0x02a10042,0x23afb6c9},{0x026100ac,0x5e4efcd7},
+{0x028101dc,0x219bf96e},{0x03c0fba8,0x6f79dc15},{0x0921fbaa,0xcafd9f9d},{0x01811621,0x0406dcdf},
+{0x026012db,0x50da1bfc},{0x03a0face,0x106bdd2f},{0x0180a0c5,0x4e523ec5},{0x02e145e9,0xebf75465},
+{0x02601b05,0x39317804},{0x0320fea6,0x8654781b},{0x02e109af,0x51ae9cb0},{0x0100339c,0x75b07ad4},
+{0x02c13197,0x092ea43f},{0x02c1d905,0x41191af3},{0x024108fe,0x8809663b},{0x018016a5,0x6b250e1f},
+{0x03801532,0x81e49ba3},{0x01a0a48a,0x4a156ed7},{0x01e1e2e1,0x35cc5094},{0x0321f666,0xae8a912f},
+{0x02c1316f,0x3ccb2109},{0x0180229f,0xf3def362},{0x0441d8ee,0xcd113ee0},{0x02e1332f,0x517d8f52},
+{0x01602261,0xeb3329d9},{0x028e018c,0xf467c4f2},{0x0301d193,0x0a2e5956},{0x024189f1,0xa7dc7704},
+{0x02002ea5,0x27346e03},{0x0261e93d,0xd1f0a0ce},{0x02c10f45,0xa70645aa},{0x030144e7,0x2e22ec62},
+{0x01c11639,0x24ddba5d},{0x02a101d5,0x44a3aff4},{0x02a10442,0x28f6d108},{0x01a0a1f9,0x5741d469},
+{0x0661d9c7,0xc2bc1074},{0x02c1fa21,0x08250c35},{0x03a12516,0xf20df611},{0x018007dc,0x2dabca25},
+{0x0480fc56,0xa6bbbd9a},{0x02600042,0x70152b9b},{0x01e01949,0x9a43c417},{0x0460fcdb,0x4c01ff87},
+{0x02c1d429,0xe597f8db},{0x03602c65,0xf5bc9ddb},{0x02a00fd5,0x61a09aa0},{0x0260208c,0x50016102},
+{0x02c01867,0x8faa0d10},{0x0280035b,0xf4ea9832},{0x028e015b,0x796f5216},{0x0621d0c3,0xd5a779d3},
+{0x02a003c9,0x0b5c4b7d},{0x0280146a,0x2077eaef},{0x03211a34,0x5116e085},{0x03802a15,0x4b98b9c7},
+{0x042004bc,0x502fa6c2},{0x0221f0e8,0xc7f8132b},{0x0220102f,0xae831f4f},{0x01c0a0a9,0x5fe21725},
+{0x06601f94,0xf53d6dce},{0x03e18bc6,0x1cece6c1},{0x0261da14,0x03e92806},{0x02e14441,0x2570f9ae},
+{0x0321fb79,0x60828ac6},{0x03212414,0xc39feddc},{0x02410749,0x9de5db8f},{0x02e1f365,0xd9899230},
+{0x034020d1,0xea106ed9},{0x03410403,0x3632b49c},{0x01e0a914,0x52b60a23},{0x02401405,0xa74be0d9},
+{0x04a0fc15,0x0b88f04d},{0x0321d70b,0x59264bdb},{0x01e10b1e,0x79479a72},{0x01e1e2e8,0x199dee49},
+{0x01611402,0x7ae256bb},{0x01c0a364,0xdf9fcd69},{0x04c0fc11,0xd3ccc2ff},{0x01e10726,0x88712e5b},
+{0x04e01eab,0x19271374},{0x02812f9c,0xacfa096d},{0x02c0ab98,0xf3a30c3d},{0x012020bd,0x47ebe430},
+{0x036018f2,0xcac0d3e6},{0x02c1f0a1,0x37e0fb31},{0x01a02080,0x32449a28},{0x03601544,0xb330f68f},
+{0x026e0142,0xa28b341e},{0x02e00826,0xfa1a1fa8},{0x01c1051f,0xf20bbb44},{0x036107b5,0x0c6079b2},
+{0x0100fdfc,0xd6edb748},{0x01a1fb07,0x2fa7ccf9},{0x03e18b51,0x98c87bee},{0x02401306,0xbee63e6b},
+{0x03c01de5,0x171ec7b7},{0x0581f831,0xf7586bac},{0x01a0a46b,0xa25c0eac},{0x038102f7,0xf8cb65fd},
+{0x0441cfa5,0x7f8dd154},{0x02011c00,0x17d79015},{0x0340a75a,0xdad91d44},{0x0320ff96,0x169bae12},
+{0x02c017c8,0x910f3132},{0x0400ab49,0xa00e6ad1},{0x02211341,0x0d5bbf09},{0x0280082d,0x89d60d17},
+{0x01c0190c,0xa30e5cd3},{0x02e1327c,0x484e1d06},{0x03a0042a,0x303c8fcc},{0x03a12451,0x80c3dbba},
+{0x02400ac1,0x99f4a695},{0x04202ab2,0x6d00edd1},{0x0320fe20,0x77d908d4},{0x0261d350,0x6918588b},
+{0x0180a0b0,0x62525e41},{0x026100b6,0x504ca836},{0x02200a27,0xf0616a3e},{0x03010a9e,0x422859e1},
+{0x0421d951,0x086d0263},{0x02a11a98,0x249f172d},{0x04a0fcad,0x0426e4e6},{0x024106a4,0xe87027f7},
+{0x0440fc6c,0x47e08d67},{0x01c0a53c,0x77e1aadf},{0x02a16987,0x347ccb5e},{0x02e0052d,0x9a0ba161},
+{0x0261b06e,0x261699d3},{0x01e11727,0x4070a168},{0x0380163d,0x2b72a996},{0x01a01bd1,0x1ea7ec17},
+{0x0580fd7d,0xd961eb41},{0x0180a012,0x9d4caaf4},{0x07a0296e,0x448ac057},{0x028e0062,0x73c22420},
+{0x032100eb,0x536b076d},{0x01c026c5,0x35fc0fc6},{0x02400e01,0x501d7d87},{0x0180a003,0x5147b622},
+{0x02001b27,0x12cfc72d},{0x0361e874,0x12ae3944},{0x03802415,0x881c5b1d},{0x0240a88d,0x09eb80a9},
+{0x0521d06f,0x22103e88},{0x0481f711,0x942b8986},{0x03210a8d,0xd90e3495},{0x02602ce7,0xf251c44a},
+{0x026e0109,0xa79a4687},{0x01e00eaa,0xcc07f79e},{0x032124c3,0x3442e781},{0x01811405,0x601d3bde},
+{0x0241887a,0x92e33b3d},{0x0461da5d,0x008b15c6},{0x038002ce,0x372dd5c1},{0x020013ae,0xac0f8f16},
+{0x03402cd1,0x75e9d03e},{0x02e028b5,0x5a00bbc9},{0x024189cc,0x28c5e8c8},{0x04001d71,0x21f5ebc9},
+{0x0180a0cb,0x52524511},{0x02411a58,0x7157fb65},{0x03001896,0x0b43a437},{0x02616953,0x1c66949a},
+{0x020030cb,0x40cff4de},{0x0141f195,0xd8fd7af0},{0x04a1f885,0xed7ed32e},{0x03a12268,0xe9d99646},
+{0x01e12293,0x7fe7da6c},{0x0181f924,0x5de12da8},{0x0341032e,0x3c3f454c},{0x03e00db5,0x249e96ae},
+{0x0361ee84,0x5273cc23},{0x02c13250,0x88adc78d},{0x02e13427,0x1ed68e80},{0x02c13394,0x27be21db},
+{0x03a0fad8,0xad7c8a77},{0x0461d8f1,0xd866cb4f},{0x03e1d5f7,0x7105bf73},{0x0320ff86,0xd8767b9f},
+{0x02c0abb6,0xed35655a},{0x02210753,0x9df2ca4e},{0x02212262,0x20631eb3},{0x02c018e5,0xbb89d754},
+{0x04e01e7b,0xe4ca6273},{0x0241bc9e,0x1bb9ae5d},{0x02a0a996,0xce73488b},{0x02e1323f,0x6d74831d},
+{0x01e0061b,0xb59c026a},{0x0081f573,0xecb6510b},{0x03000413,0xf978ba86},{0x02611c38,0xf1790fe9},
+{0x02a03279,0x9fcb899e},{0x03a0fb84,0x28c40f96},{0x02a1bc69,0xaa3b1349},{0x02e0217a,0x2a70e544},
+{0x04c01e4a,0x8dab6552},{0x0341d438,0x32b2b8b6},{0x04c1d81c,0x0890116d},{0x02202f2f,0xf2d73e5c},
+{0x02e017f1,0x87f13aa7},{0x0341d1b2,0x55de75f9},{0x01816f1e,0xdd650837},{0x03a0fa92,0x364a8f84},
+{0x01a0a1ca,0x5f86ac0a},{0x01c017e5,0x3dfc4c57},{0x04a1cfb9,0x7a3509e0},{0x02e130b5,0x217b671c},
+{0x03602c0d,0x0c9d8dca},{0x0200071d,0x1c54a436},{0x02e12171,0x49d8edc6},{0x03011c9a,0x26eafa01},
+{0x02e16b1e,0x84e9a0d0},{0x05603037,0xb50d5491},{0x02e144a0,0x99084e88},{0x04a0fd37,0x5b6467e8},
+{0x02e13411,0x32d230ce},{0x028014c8,0x6476330c},{0x0221036c,0x921a237b},{0x03402f59,0x4ab23b7e},
+{0x0201d2e9,0x8e9bfef1},{0x03401624,0xf73642cb},{0x01600ea7,0x5d1f493d},{0x02e1340f,0x34d233f4},
+{0x030169a2,0xee1b59a7},{0x03e18c8b,0x2d906bb5},{0x01c16aa2,0xa0ca0769},{0x02c1330b,0x000d4ebd},
+{0x04001647,0xf23181d2},{0x0520336b,0x0fb40f31},{0x0480a658,0x9b6340f7},{0x02c0a828,0xdebce0a1},
+{0x02418a20,0xb43d9ce5},{0x02200072,0x3357774e},{0x0201131e,0x1d94fe76},{0x02002027,0x6fc2725c},
+{0x02c168bd,0xd639251b},{0x01e106e2,0x3ec0081a},{0x02011323,0xbdc842b9},{0x03a008e0,0x7b0f2d96},
+{0x02c1326a,0xf3b0ae95},{0x01c0a578,0xb25f911d},{0x01402225,0x49567067},{0x02e118d6,0x7c8a6cbd},
+{0x0360a679,0x3c4dd6ff},{0x01c0aa0a,0x9e66dda9},{0x034000ec,0x50c14ab8},{0x01c0a59e,0xd7c41143},
+{0x01c02087,0xafef7617},{0x0281696e,0xb2f939b1},{0x032121c8,0x486eafdc},{0x02803284,0xc2d3313e},
+{0x04202559,0x2a50ab98},{0x03601abe,0x024afd5d},{0x03a0ff5f,0x38eafa2a},{0x020122f3,0x9ab34c1c},
+{0x02c16981,0x1ae001ce},{0x02600656,0x1043b254},{0x03a0fab8,0x296e4321},{0x02a16922,0x21bfe85c},
+{0x0341f7cf,0x4170d761},{0x02c101e3,0x8fb5960e},{0x03e18bae,0x9de7a1a6},{0x01e1f306,0x557ae0f4},
+{0x0121faa4,0xb9ab2b6f},{0x0361f52f,0x98cf82ee},{0x0240136b,0xafd8eabb},{0x01a0aa1f,0x2e522309},
+{0x01811711,0xdbfd4d9f},{0x0481d181,0xeccc6f89},{0x02802af7,0x03f09e54},{0x02c12288,0xdbe4050c},
+{0x01a0190d,0xf2c7709b},{0x02e144cc,0x0bfe7635},{0x02c131f9,0xf97a6b55},{0x0300239c,0xec353729},
+{0x01c016a9,0x5b4d89e9},{0x0241898f,0xb5cb43ed},{0x032100f7,0xc7636f44},{0x01e00986,0xeb3b933b},
+{0x04a0254b,0x69d9597b},{0x02012216,0x6348575c},{0x03410851,0x30be44e7},{0x01a0269a,0x27725b8a},
+{0x03210552,0x0657281c},{0x0361e88f,0x36ce964d},{0x024189e9,0x9fdc6a6c},{0x0361f70b,0xe81c3067},
+{0x01a017a0,0x71169521},{0x03c1d4d1,0x30e970d7},{0x04803362,0xff5f8b34},{0x02602dd5,0xa6f8e86a},
+{0x0401d740,0x0bded6aa},{0x028e0176,0x766d0ec6},{0x01a1f6b7,0x74968734},{0x02c131b9,0x53faa161},
+{0x03800106,0xdbde425c},{0x01c1180b,0xd90d4dce},{0x02401a23,0x2fde9903},{0x0201182e,0xbb947f3e},
+{0x0441f168,0xf24f6607},{0x0181f600,0x19a56378},{0x0260004d,0x6d1526e2},{0x01e1bc0b,0xef6765f1},
+{0x04e1d7bf,0x3cb6f3f6},{0x0221f613,0x1efe0aa2},{0x0320fb53,0x99368d79},{0x0340fb9b,0xda16b2e4},
+{0x0401d6f0,0xa2f6b46e},{0x03e18b3d,0xc9d7d39b},{0x0261b0d7,0xecbd148a},{0x0521d7b3,0x82ff458e},
+{0x0280271c,0x89b3b029},{0x01e0a41c,0xf3747ae7},{0x04610794,0x3e241f05},{0x06c1d094,0x15d2dc5d},
+{0x0180a0c2,0x5e5257f5},{0x02e16b1f,0x07467c94},{0x03210094,0x85110352},{0x01a02089,0x118ab042},
+{0x024189a7,0x9dcf9b53},{0x02a016c1,0x5630b519},{0x02e14587,0x7634a9e7},{0x01a01918,0xc2f68340},
+{0x026e0102,0xa49c8065},{0x03200832,0x3592e030},{0x02800929,0xaeb7c7da},{0x040109d5,0x66f8422f},
+{0x0481d8bb,0x7f7c1055},{0x00c1f6d4,0x56db759f},{0x02812fd4,0x9e0fb81f},{0x0261b085,0x6ee08b6e},
+{0x03402045,0x067d9646},{0x03e027a9,0xf7050aeb},{0x02401fdd,0x0bec98ab},{0x01a0a1c8,0x57869f72},
+{0x03802ccf,0x483ea3aa},{0x02a0309d,0x8212b840},{0x04e01df3,0xced763f6},{0x01402bd8,0x11b458d0},
+{0x02402f03,0xa41a0f66},{0x02201a7b,0x7f3b4106},{0x020009b7,0x49247612},{0x01c022c0,0x84f87a2d},
+{0x0481d856,0x6e9de6d6},{0x02c0247c,0x57c82c1a},{0x0320fb97,0x51474c8e},{0x0581d84e,0xd8baf860},
+{0x02c1312e,0x702091fa},{0x04c1d814,0x679f0e70},{0x0521d7bc,0x31f86176},{0x034015cf,0xbf6c049d},
+{0x016007d3,0x5b4e60fa},{0x01600ea2,0x5d41db7f},{0x04402344,0x5a6dbbfb},{0x03801638,0x4b52884b},
+{0x0181f420,0x66e1acaf},{0x0261f265,0x399a2d3c},{0x022005d6,0x1f1f2099},{0x01a027d9,0xf383cb05},
+{0x03802907,0xe318456b},{0x01c0a441,0x7a0ccc3a},{0x02400e13,0xbd731d8a},{0x0300a9ed,0x28dea4fa},
+{0x026100a9,0x594ef4f8},{0x0281684b,0x36a20d83},{0x02a122e3,0xbaaf3efa},{0x01c1f6c7,0x57269a22},
+{0x02002657,0x3048261b},{0x02c13376,0x9cc35738},{0x02401038,0xbf2619ba},{0x0280246f,0x2c701ab6},
+{0x02002758,0x71fefbfe},{0x01c0a67e,0x2743810d},{0x0160a4f2,0x84111f01},{0x026e0123,0x21a63f88},
+{0x0221033b,0xf57003a9},{0x02a00451,0x1bed7733},{0x0281bc49,0x2db58208},{0x03c1f59f,0xde4da4db},
+{0x0220007a,0x2b576ab6},{0x01c0a171,0x6209ea8c},{0x01e0084c,0xc2b5a3c2},{0x01c0a426,0xcef3dc64},
+{0x038169e2,0x34125ca7},{0x01e1182f,0x607d7c77},{0x022112da,0x2c49a71a},{0x034024c8,0x3a65cca6},
+{0x02c1318a,0x082c6415},{0x01c0a322,0x7689c7b5},{0x02811d63,0x3691ed60},{0x03402c47,0x29839fad},
+{0x03c1242e,0xecc6ce3e},{0x032100e4,0xd067fa9d},{0x050109f1,0x9066e541},{0x028029bd,0xb625b98e},
+{0x01e12154,0x471d9aab},{0x0401085f,0xef6cb5f2},{0x0401d53c,0x4489774f},{0x016000a7,0x78b0556d},
+{0x01e02bfb,0x60138550},{0x01c11733,0x8bb2f8ef},{0x02010622,0xa62b7baf},{0x024189e7,0xaddebf0d},
+{0x0261e930,0xfc055123},{0x0280abd7,0xec33fcce},{0x02e004bb,0xc2393da3},{0x03e109d2,0x96a4bf7d},
+{0x0360a640,0xc87a95b6},{0x0361e807,0x6f7ddc30},{0x0360018e,0x88ba8afc},{0x02202f4c,0xcc2e5621},
+{0x0661fb5f,0x09993fde},{0x03803245,0xd844dd7a},{0x02c1311a,0x6d1182b7},{0x02418834,0xef8737d5},
+{0x0300052b,0x3ad17fd6},{0x0180a490,0x8c7f497d},{0x01e1158e,0x91211a85},{0x03201120,0xdc883faf},
+{0x0581f72e,0x21edc60c},{0x0361e814,0xd8cd2411},{0x03002ec5,0xddbbf8bb},{0x0361e873,0x1cb7615a},
+{0x03e18c18,0x7da232c6},{0x02e14572,0x72416f8e},{0x04201eeb,0x2bf53c14},{0x01a1180c,0xe23612ac},
+{0x02e169c7,0xb007fce0},{0x024189a9,0x9fcf9e79},{0x0421225e,0xca299213},{0x02202fc2,0xe16a7dc7},
+{0x03216e58,0x75856301},{0x0441d6b9,0x88aa2a72},{0x020030c9,0x42e7fcea},{0x02a119d4,0x7b24fe2a},
+{0x0380150c,0xbed9d1b2},{0x03200258,0x54dc62c1},{0x020030e2,0x62d268fb},{0x03400363,0x201b5593},
+{0x01c0232b,0x34b9aeee},{0x03c1d807,0xb56dc014},{0x020013c3,0xf209ed1a},{0x02e0065c,0x9229ffff},
+{0x02003071,0x9c59bc3d},{0x02e1fb74,0x5c0cb741},{0x02a0281a,0xaca8a3a9},{0x0280096e,0x8c3bc113},
+{0x0240259d,0xbf49f043},{0x05c0fbf5,0x612562b6},{0x02418962,0xb688b90e},{0x03216869,0x82976342},
+{0x02a0aba2,0x38299631},{0x02818d01,0xf1d15f0d},{0x0360163c,0x28e08597},{0x02418aa4,0x549d0ffd},
+{0x02e1bca2,0x0a9ac67d},{0x0260129a,0x34b8b948},{0x0460a70c,0xa999cc69},{0x04a1d012,0x5f755af9},
+{0x02c1040c,0x5cb74fc5},{0x01c11086,0x8455e805},{0x0360044a,0x7874df63},{0x02016f70,0x78537ccf},
+{0x0100227a,0x023fc716},{0x02604de2,0x44009b72},{0x0321e823,0xb35610ce},{0x0361d519,0xf7bc2a12},
+{0x02e028b3,0x9345be6c},{0x0261b0af,0x21642b0d},{0x01a0a45b,0x7131c085},{0x0221fb3a,0x9db15db2},
+{0x048004de,0xf08b78ba},{0x008029ff,0x662092aa},{0x01c0a2ec,0xbfda24fc},{0x0481d8be,0x8f1ff297},
+{0x01a00c07,0x5f0b9cd8},{0x03a0fac6,0xa16b2e72},{0x03e18b75,0x08cda96c},{0x01a0195d,0xeddfad2b},
+{0x02c11587,0x99320c7a},{0x0321234a,0x1b8a8043},{0x0280156f,0x2777f5f4},{0x03402c43,0xed301afa},
+{0x02200592,0xa557a5c2},{0x0281ec9e,0xd4f9dbbe},{0x0221018c,0xf28a6824},{0x0441eeb8,0x4011eaad},
+{0x0221082d,0xa9e0978a},{0x040023e9,0xdbc826c5},{0x03c1d46d,0xec22f810},{0x0261b062,0x2e34bb7f},
+{0x0241885d,0xe86917bc},{0x04c0a712,0x194041eb},{0x04000daa,0x186b4882},{0x0101f6df,0xe1d70202},
+{0x03800952,0x85e6486a},{0x042004f1,0x911f6d6f},{0x01a0a1ea,0x6a0df11f},{0x0521d151,0xed81154f},
+{0x02201733,0x4f012f92},{0x0260129e,0x3ab8c2ba},{0x04802ceb,0x6713eb93},{0x03201561,0xa745525c},
+{0x03602c02,0xb3c73b62},{0x02011199,0x36c00944},{0x0121fae6,0x0a4c0a2d},{0x024188d0,0x13131dc0},
+{0x03610545,0xb45aa387},{0x036102f3,0x77e3d557},{0x01e0a374,0x2a6b417d},{0x01a022c7,0x0e585584},
+{0x01e01c64,0xd18a9783},{0x01e1051d,0x2d79d9d6},{0x03c0a7d6,0x96b74515},{0x01a0a164,0xad65fa5c},
+{0x00c1f455,0xcc5832e5},{0x0280ab06,0xdde41115},{0x02418a77,0xc7a6bf62},{0x02000c6d,0xc46cee5f},
+{0x01c11818,0x02624e17},{0x02e16b2f,0xf5913b75},{0x02e14563,0xe43c12d6},{0x0440fd20,0xdea6377e},
+{0x02610f22,0x84409613},{0x0281695f,0x4763f4ec},{0x02c02478,0xe465df8a},{0x04000690,0x766365c3},
+{0x03610546,0x975f5b77},{0x0301d7d0,0x5f0158bf},{0x02a03007,0x9de4e09b},{0x03c000eb,0xcdde80d4},
+{0x0081f9a4,0x25f64d6d},{0x04a1d180,0x334af23c},{0x01a11616,0x251cfe83},{0x03801d68,0x158d535a},
+{0x04211a33,0xb44ef5ca},{0x02e144a5,0x9508483c},{0x01a031c9,0x6e94587a},{0x04002973,0x6b3e0a1d},
+{0x0481cf89,0x0a92394c},{0x01c0a3e7,0x27227753},{0x0380279b,0xec53fed0},{0x0121f452,0x82e0a64b},
+{0x0280147a,0xec51e1bb},{0x0261b0e5,0xedbab1b6},{0x02610368,0xd16ca577},{0x02c13117,0x68117ad8},
+{0x02810f74,0xe7c1e587},{0x0420fd24,0xfd890d31},{0x0300274e,0xb3176d10},{0x022031a9,0x61fe39a3},
+{0x03c00afd,0xc8f224ea},{0x02c1f07d,0xe980c2f1},{0x0441d042,0x740ae88e},{0x026e014e,0x9888e5c9},
+{0x00e1f3ca,0x39003377},{0x00c1f990,0x9a67009a},{0x03a01522,0x84de170b},{0x0381ec90,0xee6b23a0},
+{0x0201bc54,0x3cc862fe},{0x03801ef8,0x34853d74},{0x0261b089,0x75f41e2b},{0x03c00296,0xf754f4c5},
+{0x02201cd0,0xf88865ad},{0x00c1f9ab,0x49f133b4},{0x0240091a,0xe0846f03},{0x02c1040d,0x9ea8ad21},
+{0x0241f3a3,0x28845ff6},{0x01003376,0x8bcae0f3},{0x02c1ee06,0x9e1753db},{0x03401601,0xcd33c216},
+{0x0461d7f3,0xabd6b9da},{0x048004b2,0xa2079b68},{0x02a0aa85,0x4805463b},{0x03e01ffb,0x53da2725},
+{0x00a0002c,0x2863c218},{0x06201fa8,0xd9698364},{0x03e02372,0x57f5d083},{0x0141f37c,0xfb7d1345},
+{0x03e0a67a,0x2d6531f1},{0x02c16b8c,0xdb8f0594},{0x01e0a510,0x0af0e3c5},{0x02011a77,0x068e8672},
+{0x02c102ed,0x1de186d5},{0x02810acd,0x69a99127},{0x03800164,0xe7be2560},{0x03410a56,0x74c177f4},
+{0x01e1223e,0x5416f35d},{0x00a1f40b,0xf15ff296},{0x02a013f8,0x4911ac0e},{0x0260a81d,0x376d93ee},
+{0x02c029d4,0xe6d87dbc},{0x02c13088,0x2e2119e0},{0x02e12345,0x3f95b988},{0x02418aef,0x650f854b},
+{0x02c1327f,0x80ab7c5e},{0x03601656,0x8003b8ca},{0x03c026e5,0x8d8ca4b5},{0x02c13284,0x84ab82aa},
+{0x02816b14,0x4424da35},{0x02203266,0x15d56fe0},{0x02c131e6,0x44ff06f2},{0x0320fec8,0xdcc9931e},
+{0x02001b44,0xa2a63ede},{0x022013e2,0x21057831},{0x0101f48b,0xe58d7162},{0x0240a8a1,0x51c58e28},
+{0x042115da,0x5e31f0f3},{0x03012098,0xb5617007},{0x03a1f3fc,0x24c30b70},{0x02010b16,0x24da67d1},
+{0x02e00398,0xef0228e7},{0x00e1f99a,0xed8f832d},{0x02e03295,0x5786b90d},{0x03e1d5f4,0x7c05d0c4},
+{0x0341686a,0x08b62537},{0x02e0ffcf,0x6f7d385d},{0x0280329a,0xe7eb3ccb},{0x02400e1b,0x5256a5ba},
+{0x0381214c,0x542e9363},{0x0201222e,0x2bda21d7},{0x02202fa7,0xa5d6e86f},{0x03e0a7ae,0x9cd31969},
+{0x05e023c1,0xfe1880e0},{0x01a00b2e,0x97c905ef},{0x0440fd2a,0xb1b00e38},{0x03404dc7,0x442bfc76},
+{0x02e11d96,0x6f9a4680},{0x012020b8,0x45cc2065},{0x01c0a25a,0x423fedce},{0x0221f920,0x175d34f8},
+{0x02e1da2a,0xc1bff165},{0x01c02118,0xe0877a2e},{0x03a01e8b,0xef68b504},{0x0281f663,0x993b0b24},
+{0x01e1f4a5,0xf59350e7},{0x0941fba8,0x9573c78d},{0x0180aa1d,0xe76b1175},{0x01c0a1b4,0xbc4fccb6},
+{0x0580ab42,0x3ad28966},{0x03010c2d,0x98c658cb},{0x02400924,0x086d54ac},{0x02a019ff,0xbb1d31a9},
+{0x01a0a378,0xb94d362b},{0x01a02e15,0x9a3cfc63},{0x03000fa6,0xcaadd5a4},{0x03210a0c,0x4daf7614},
+{0x0200fe6a,0x2bfabe94},{0x0280129f,0x5b9eadc9},{0x04602553,0x1e94bd15},{0x02c02d06,0x62e4c0af},
+{0x03000544,0xdfd0b70e},{0x03000547,0xfa4b45b4},{0x01a0a20a,0xa337beb1},{0x028029b9,0xd291b8a9},
+{0x03601d7d,0xc7e3c4dc},{0x02c131a9,0x5658582f},{0x03e02675,0x1a79efd4},{0x0240aa98,0x34a74f7a},
+{0x02c130e3,0x10d048bf},{0x0320d7f9,0xda6a943b},{0x02202797,0x23abc6b6},{0x0341bc7b,0xe1e981eb},
+{0x0141f1ab,0x99c6eff5},{0x05a0fd01,0x853129b8},{0x0301f31b,0x73c9075f},{0x02c1304e,0x8718ad6d},
+{0x01e115a9,0x0128869a},{0x0640fc9a,0xa10bfdf8},{0x04a1d85b,0x4fbbc85d},{0x0501d8bc,0x686c70d8},
+{0x01a0a6ce,0x6347e2b3},{0x030101dd,0xe3175c32},{0x01a007fa,0xfa6de69a},{0x00e02442,0x1ecf6343},
+{0x01e0a5a7,0x56fc945c},{0x04e1d0da,0xbe94f5fa},{0x04002512,0xb52e1040},{0x01e16ab7,0x521a9ffd},
+{0x02a110f3,0x8a36875c},{0x0081f350,0xb9d9d56d},{0x06e1d950,0x489ff185},{0x05601fc4,0xe3e998c6},
+{0x01e1101d,0x0b2e8819},{0x0241897c,0x2e9031bb},{0x03c1d865,0x6c1aa906},{0x02e1ed07,0xebc536fc},
+{0x05201f1d,0x32a6db57},{0x04002954,0x49295637},{0x0381e8b1,0x1eb7b03b},{0x03e18c5d,0x19989afe},
+{0x02e144c4,0x1200be3e},{0x0481d955,0x9413c25b},{0x01a0a2a7,0x857022f0},{0x01e11a7a,0x315127e7},
+{0x03210849,0x766a786c},{0x01c1108f,0xa8471627},{0x05001f0a,0x0363aff6},{0x02c1011e,0x24f3a7f1},
+{0x01a11617,0x05099012},{0x02400a6d,0x71eb55b1},{0x02212190,0xdb2c1d36},{0x0240092c,0x0486e646},
+{0x0521d03d,0x68ceb7b2},{0x0181f366,0xa2e8de0e},{0x03202c1a,0x193ccd4f},{0x0421d639,0x52b1fc9a},
+{0x01811046,0x372c15d0},{0x0141f98f,0x500be7c3},{0x026012dc,0x3cd10224},{0x04400273,0xf0c958ce},
+{0x0301685f,0x2aeaced9},{0x03002375,0xfebd88e4},{0x02c1d301,0xb5071760},{0x02402d65,0x1a965697},
+{0x026169f7,0x31192a64},{0x0320219b,0x4f18ec3d},{0x02c131f2,0x027cb817},{0x02418a27,0xb73fe035},
+{0x022013e5,0xe208e69b},{0x01a0a3c6,0x0273606e},{0x02802844,0x9c931b1a},{0x02c1d9f8,0x3443e8e8},
+{0x0381e109,0x2e794428},{0x02011490,0x30a9430a},{0x02e145ee,0xecf9948f},{0x02c01d3f,0x98e7cec6},
+{0x028e018a,0xf267c1cc},{0x02210837,0xc1eb4aae},{0x0241891e,0x91276bd2},{0x0320042b,0x494f7fa7},
+{0x01e02e35,0x72ec2bdc},{0x0241898d,0x2b926b99},{0x01c0a52e,0xaeaca49f},{0x02a0186a,0x901706bb},
+{0x02602840,0xca1c56d5},{0x0260138d,0x0678c82c},{0x02a0025b,0xc72a2fef},{0x02812fa6,0x24018087},
+{0x03a0fb60,0x02ddadc5},{0x02a02e24,0xbfec0d02},{0x0261b050,0xc1b92c78},{0x02200eba,0x1d14d09c},
+{0x02a0a990,0x83bc6799},{0x02c133fa,0x1d761675},{0x01e02e14,0x523d85c0},{0x02216f64,0xceaa9254},
+{0x01c11653,0xd975f4a9},{0x02c12090,0xc62f99c1},{0x03802af2,0xe672dd9e},{0x02c1d432,0xdc97eab0},
+{0x02c11667,0xdeecac0b},{0x02c130c9,0x3d327a9e},{0x026124ed,0xd19803b0},{0x01e10521,0x6d5c2982},
+{0x01203327,0xdb0ccacf},{0x02816a93,0x31dc75df},{0x02e131a5,0x43088206},{0x026e0111,0x23973824},
+{0x01a0a1c7,0x5b86a5be},{0x03e18bf7,0x9be0e2bb},{0x0101f93e,0x6a40c1e5},{0x02402f37,0x9545c97c},
+{0x02811919,0xea2af689},{0x03016e7a,0xbf3f9848},{0x02800745,0x7333c98d},{0x01c16f29,0x37b5a80b},
+{0x0300111a,0xbb452e7a},{0x04801a5b,0xbbeca8d3},{0x03e18c66,0x899579b7},{0x030145f8,0x337a2c0c},
+{0x02801080,0x2cd2db37},{0x042032c5,0x05abdcc3},{0x04601ee0,0xeeea4390},{0x016007c2,0x357e5a56},
+{0x01e11338,0xfed5c32a},{0x0260082b,0xe0743c14},{0x03c0298c,0x289fcd71},{0x026014da,0x046becb3},
+{0x00a1f401,0x290ecf64},{0x028110f4,0x2be09fd8},{0x02802726,0x612c3b53},{0x0360a8e2,0x726d34b2},
+{0x02c131e4,0x42ff03cc},{0x02e1d6cd,0xf80865db},{0x0561d0d4,0xe2267c3b},{0x01e01005,0x386e3350},
+{0x02c13020,0xfe22631e},{0x02400d21,0x10352157},{0x0200307d,0x8e59a633},{0x02e10d27,0x015bac4a},
+{0x01203392,0xccca2853},{0x01e1200a,0x930a8a97},{0x03e0ffb9,0xeec4180c},{0x05801f2f,0x1f94f699},
+{0x02a01b48,0x503ed8b6},{0x03404dcd,0x0a9eec54},{0x01e00f61,0xc5937198},{0x02e1f0d3,0x1c122e75},
+{0x02e029a1,0x96744ce4},{0x0280107d,0x9022801b},{0x02802d91,0x8eac78b4},{0x03a120ef,0x8927fd8c},
+{0x02602e90,0xd1eec758},{0x02602a40,0xe836f357},{0x02803049,0x34f565c2},{0x0121f9fc,0xe41f3a94},
+{0x02a1692f,0xf2e840cf},{0x01c10b0e,0x2dd8cffc},{0x02e00582,0x70564996},{0x024115b9,0x81998a11},
+{0x0321f743,0xa40d1cf3},{0x02e008f5,0x585010ff},{0x03c024a2,0xff012d51},{0x0420180c,0x651e94cb},
+{0x02801d47,0x5e8c6d3f},{0x02602d8e,0xae73dc1e},{0x0281087b,0xae5240f3},{0x0320feb2,0xab5ba0d4},
+{0x04a1d01b,0xe04a9089},{0x014022b6,0xf4be3dd3},{0x020029c9,0x34b29c00},{0x03410b83,0x0a32182f},
+{0x02a00a01,0x31cbf62b},{0x0201062d,0x20262b8f},{0x02c13017,0x871f6932},{0x0301211b,0xdffadc39},
+{0x0201149f,0xd1b7a00b},{0x01a11689,0x1a12c9a8},{0x0501da01,0x5188cbb9},{0x03c007ee,0x5b8eb78b},
+{0x030124c2,0x080a0c25},{0x02e1fb73,0x590cb288},{0x01c0a861,0x74599c12},{0x0280abf4,0x6bd8234e},
+{0x02202f96,0x564b9bd3},{0x01a0a3cb,0x295588bf},{0x03a01e59,0x8f08d7b6},{0x0241885a,0xe5691303},
+{0x01811434,0x484c744b},{0x0160fe58,0xc35ae4e2},{0x02810365,0xc4ba5818},{0x024016a2,0x34c6b1f4},
+{0x05e1d0cc,0xa0adb0bf},{0x0280093f,0x340a3da0},{0x0520274b,0x3bcae4e9},{0x02a10006,0x153b451c},
+{0x0340160a,0x1b38ba0e},{0x03000828,0x551fd75b},{0x0101f36d,0xa865294a},{0x03e1d56c,0x68f5018a},
+{0x02803045,0x2af55604},{0x02801327,0x88e28288},{0x0180a6f2,0x39103b6d},{0x02016aeb,0xd495d0c2},
+{0x02a006c5,0x48a05bad},{0x00c02001,0x8fdd7a18},{0x018007ff,0xaf94dd19},{0x0240a8b2,0xfa0bbb24},
+{0x02c13012,0x8b1f6f7e},{0x04e115d4,0x417ac969},{0x02c13300,0xce3ded62},{0x02001aad,0x435725aa},
+{0x03e18c3b,0x6b9d9942},{0x0560fd88,0xd839ec9f},{0x0500fdc2,0xb489aaa4},{0x0441225b,0x2981a1d8},
+{0x0140266a,0xf433eec4},{0x01a1028a,0x0cee24d5},{0x03a1ec98,0xe67af470},{0x030024e9,0x58b6ba9c},
+{0x01e013cd,0x17d58842},{0x02a104d0,0x5d061db0},{0x03a1d5a4,0x517bae4c},{0x0220183a,0x9c223a23},
+{0x01a00b14,0x43abff9f},{0x02e10ad5,0x21cc6d81},{0x02211082,0x60b85a33},{0x02011493,0x682f31ce},
+{0x034024bf,0x5365f401},{0x026103d2,0x5b1e80ef},{0x02400e22,0x3adf2a51},{0x03a023f6,0xb31faf7c},
+{0x0361d699,0x4006f0f5},{0x05001aba,0xc4a02bfe},{0x01c00c85,0x093764ee},{0x03c12417,0x862c0c12},
+{0x01e006a4,0x77f08280},{0x0340fb58,0xfa484b44},{0x0241899d,0x2bc82c18},{0x0520fe89,0xf5158188},
+{0x02e16814,0xdc6d40d4},{0x0300104a,0x21860964},{0x03602ef2,0x97089f3d},{0x01802e13,0x0bbe0377},
+{0x0540fd7c,0x56b6e16d},{0x01802297,0x5ee132ef},{0x0280abf5,0xa532a096},{0x0161f3f9,0x72f4827d},
+{0x03a01878,0x7b69a357},{0x01c0a203,0xa7768868},{0x0381cf6b,0x98e9749c},{0x018016d1,0x7c2528e2},
+{0x03a1f898,0x8e9817d9},{0x01a0a6cc,0x6f1d1490},{0x006022bb,0x4f46575e},{0x02418975,0xa38d1853},
+{0x0121f341,0x3377c8d2},{0x038000e7,0x7d19865d},{0x0661d96f,0x25fe5762},{0x03016960,0x5da69f48},
+{0x01c0a6bf,0xcc3e7600},{0x0461d618,0xe8a2f794},{0x00a002c7,0xcf4ccdcc},{0x032011e8,0xc20d0026},
+{0x0400a96b,0x4a14bfb2},{0x02616a33,0xdc20db5e},{0x0540fd1d,0x0e3c6ac9},{0x0240127d,0x14fc8c1c},
+{0x02c01d3c,0xb5e7fc6d},{0x02c1f092,0x927d97c2},{0x01e0a5bc,0x445d0e9d},{0x01c1102f,0x5e892f27},
+{0x01a01951,0x21db81d9},{0x02c1315d,0x3dbc1812},{0x02418830,0xf989862a},{0x0240aa9a,0x149c8fbe},
+{0x0180224d,0xf4a2ed94},{0x01a10924,0xa0bf6a85},{0x02600d69,0x9f30d36f},{0x01c00c14,0x1c33d10f},
+{0x03202ed3,0x0ba938e6},{0x01c0a5e7,0xe4a50803},{0x03a014ce,0xd2fce0d5},{0x01c0a3c3,0x5f4629f1},
+{0x0320a889,0x6a2fc7d4},{0x02c16b3b,0xa3ccc3f3},{0x0341f131,0xed00f41e},{0x02000a38,0xbdd6949f},
+{0x0260ab2d,0xe59d0f43},{0x024188de,0x0d0e9720},{0x0241f559,0x21f928e2},{0x03e18cd3,0x738543c6},
+{0x0261b116,0xee1b9108},{0x01e02a58,0x74a25487},{0x01603353,0x222e3f43},{0x03e12382,0x102bd7f7},
+{0x02816965,0xaa0005ac},{0x0421cf97,0x7a838147},{0x0240fe01,0x62688f8b},{0x01c11fec,0x5ef21d85},
+{0x0241892b,0x9d7bc5c0},{0x02e14597,0xdf39cc60},{0x03000676,0x70b2f8d1},{0x02601310,0x1cb80a0d},
+{0x02e124a9,0x5aa50ec7},{0x03400949,0x13ab9cdf},{0x032118a6,0xd1d4bdb2},{0x01202744,0xf52b5047},
+{0x01802296,0x5119560d},{0x032118b6,0x0de8a3de},{0x03e18b60,0x9fcac58a},{0x0441bc9f,0x5f2ec6d3},
+{0x026119ce,0x2f93a742},{0x04011af6,0xeefde0ae},{0x0440a7a9,0x2e29dde8},{0x02a10ad2,0x62e29382},
+{0x03e18bfd,0xace0fd7e},{0x01a0a46a,0xa24409c6},{0x02400615,0x3dc6c4d9},{0x0200176a,0x34e16ef1},
+{0x0181161d,0x00206e79},{0x0201010a,0xa0590e21},{0x03216e8e,0x2b3ff494},{0x0240120e,0xfeeb2059},
+{0x02801b30,0x0735e7ba},{0x0501cf0f,0x039cdada},{0x02000a24,0x15d34d90},{0x0280a9e4,0x7d978661},
+{0x02c0fe7d,0x44785906},{0x0460253a,0x1d292137},{0x05212462,0xca4f7438},{0x04601d7a,0xfafd8c07},
+{0x028110d8,0x11c4b540},{0x0201113d,0x0c85acea},{0x03a1d03c,0x43d644bc},{0x02e132c3,0x18f4262f},
+{0x0200305c,0xa44030ef},{0x01c0a136,0xec581cc6},{0x0421cfaa,0x43daccb8},{0x04001082,0x4cc1eedc},
+{0x05e121ab,0x62494fd2},{0x026124d5,0x8aa87969},{0x02602d88,0x58e61192},{0x03212530,0x6142d7a5},
+{0x02e0283d,0xf7703d77},{0x05212474,0xf33ec1bd},{0x01e10694,0xbe32757c},{0x02a00d8d,0x3cb5045e},
+{0x02201cdd,0xa63c694c},{0x02c1305b,0x059bc590},{0x03a1ee94,0x131298c7},{0x02418af8,0x6e11d20d},
+{0x02e1d1c3,0xc7cf8d8c},{0x03a12431,0x4b5013b4},{0x036111f0,0x79ff2b1d},{0x01e11091,0xd72d2b13},
+{0x02e02ae8,0x08a374d6},{0x0421cf73,0x075e6833},{0x02e0031a,0xca463090},{0x0261f844,0xf3f014ab},
+{0x03a1f630,0x2dc5d8be},{0x02e002d7,0x676088a9},{0x01c0a2dc,0xc6074e0c},{0x0421d630,0x3db1db8b},
+{0x03a1d742,0x22714ab4},{0x02c13146,0x3ec096d3},{0x02c133af,0x9013a035},{0x0281e91c,0x1efb414f},
+{0x0340fba1,0x7997d8e7},{0x02812fc1,0x25f6f651},{0x030011e9,0x00b7940d},{0x01c0a5be,0x312ffc38},
+{0x0261b080,0x65e07d43},{0x02c0151f,0x9e13ebee},{0x03810cfe,0x23a63ad6},{0x07200777,0x98bee730},
+{0x0360322c,0x0dfc1ad7},{0x03a01534,0x64e1715e},{0x01202228,0xf38c4ce9},{0x01e111a9,0xe92368ad},
+{0x01a0a107,0xeeae2b20},{0x0081f986,0xa766af78},{0x0141f919,0xa7281e22},{0x022112b1,0x2051e2fb},
+{0x03e02676,0x5dd18f8d},{0x03800711,0x9dd525b8},{0x0221bc31,0x06ae9fa2},{0x03610f87,0xf73c4cf4},
+{0x01c02e8b,0xa3fa8b54},{0x01e013a5,0x14d58389},{0x02801a80,0xb2236efa},{0x02e11a20,0x181ba8e7},
+{0x0321f0c5,0x577c62f3},{0x0180a312,0x867e238b},{0x02e1441f,0x227fff7f},{0x0240059c,0x2c79f18a},
+{0x02c01a62,0xf3f1e026},{0x03000ac5,0xbeed0b94},{0x02a01aab,0x4e0edc10},{0x0361d704,0xd36f4c2b},
+{0x03e1e00c,0xcd077628},{0x0361e8b2,0x5d52208c},{0x01e03189,0x9384e9f7},{0x03a00dd4,0xbb08978e},
+{0x02810d1f,0xc9b882e7},{0x01203382,0xc9964837},{0x03e1d0ed,0x07ca16b8},{0x0361d517,0xf5bc26ec},
+{0x01e01c02,0x857f6d52},{0x0461078d,0x445c9689},{0x03802a5c,0x665eac45},{0x024115c1,0x83c8c092},
+{0x03e18c28,0x87a003ed},{0x0341d6bf,0xb657bb3a},{0x03000403,0xc57e78d8},{0x0441d726,0x542455a7},
+{0x02002f47,0x610d5c35},{0x02a014e0,0xe4bdfd67},{0x026100bf,0xd267b859},{0x01e01c6a,0xaba02200},
+{0x02a04df0,0x70d64cd2},{0x04c033ea,0x7c27166a},{0x03210cf2,0x73738f4a},{0x024007f9,0x1cfc1355},
+{0x01a11105,0x618856db},{0x02e1b120,0x2c17dd98},{0x01a0a09a,0xf795fd07},{0x02e14639,0xe8c2267b},
+{0x02e14593,0x66325220},{0x02602f4e,0xe2a1f21d},{0x02ce005a,0x793c78f5},{0x03c1f900,0xce4cebc1},
+{0x03801ac9,0x46601446},{0x03c1223b,0xb49c5bac},{0x0241884a,0xfd8bcb0d},{0x02c118c9,0x92de0d48},
+{0x032016f4,0x1ea795e2},{0x0200071f,0xad88e7a8},{0x0301210f,0x84ef63bc},{0x0301d4cc,0x36a1169e},
+{0x03e18ba0,0x12e859d5},{0x0381200e,0x527fc1f1},{0x0480fcb9,0xb1077063},{0x01e00643,0x1ff0b8c9},
+{0x0180a618,0x4fa93a71},{0x04001d91,0x28e9211e},{0x03c1241c,0xcc965c6f},{0x02202fcc,0x756ea04b},
+{0x01403330,0x58084ad3},{0x01e020a3,0xc07379c6},{0x03e18c58,0x05987b82},{0x026104b7,0x5cba1bcd},
+{0x0321012e,0xa4cf7d9d},{0x01c10497,0x1b1caf96},{0x02a0feff,0x5766db91},{0x03600e44,0x737fcebe},
+{0x02201c2b,0x6bd44a6a},{0x028e01ca,0x15d5d7d5},{0x02601b11,0x821dffda},{0x01e00c66,0xd522b350},
+{0x0140225b,0xf927db68},{0x026104f8,0xf80816d5},{0x03602c2a,0x46bc508a},{0x0220100a,0x5587a3c2},
+{0x026012cf,0xbc737d05},{0x02a012c3,0xb669e102},{0x03e1d6a5,0x0e4ac830},{0x02602dde,0x2ea91bd9},
+{0x0101f478,0x28101f36},{0x02e01136,0x76e7adf7},{0x03202187,0x62dfd6c0},{0x0321f668,0xf561bcd0},
+{0x02c0261c,0xe0d30113},{0x0440180f,0x6c803037},{0x028e017f,0x0565a11e},{0x0301d460,0xb9ca1e89},
+{0x03a10b7c,0x435c634d},{0x03e12058,0x63b58e61},{0x0321d116,0xe9a2d621},{0x052033f9,0xc83dbcba},
+{0x04a0ab4f,0x914b9e9c},{0x026124e7,0x76d4ec65},{0x0240134e,0xff03253f},{0x048107ab,0x89e8db3d},
+{0x03402979,0x2ba32bce},{0x03a1241d,0x4c7a1c94},{0x02a11ade,0x65c8a241},{0x0481d1e5,0xe25f5547},
+{0x0181f4cd,0x41ba6fb6},{0x02801a99,0x766824f2},{0x03e03035,0x66fac6ec},{0x0280ab75,0xb2eeec1e},
+{0x0380a8b4,0x3661b278},{0x0260aaa1,0xa48ab126},{0x05212445,0x1be6a370},{0x02016f58,0xac59a77b},
+{0x01e10e86,0xadedd5f4},{0x01c0a55c,0x2d6635b6},{0x0281f557,0x1b7af1ae},{0x01a0a569,0xd7035111},
+{0x0321e134,0x12b09c3c},{0x05001f42,0x99ad3dec},{0x0361f71d,0x83bb235b},{0x0360255a,0x289c0204},
+{0x02800ea9,0xaaaf52e9},{0x02a0abaa,0x3540eac7},{0x04c023cb,0xae9e8188},{0x0301d467,0xc0ca298e},
+{0x02c1143b,0x973fbb79},{0x01e01c6b,0xb2a02d05},{0x0201f6a7,0x458336cd},{0x0560276e,0xe08b635d},
+{0x0300320d,0xd01e0943},{0x026124e1,0x80499545},{0x02600d20,0xe68be1f7},{0x01002685,0x38dffbca},
+{0x0180a4b5,0x6b42c93e},{0x02a119d2,0x7f250476},{0x02e131c2,0x8a877ec7},{0x02418933,0xa57bd258},
+{0x01a0179a,0x0ad54d39},{0x03c1da53,0x8495d426},{0x036015dd,0x42e9a8e1},{0x01a0a0bb,0xd578733e},
+{0x03a10992,0x1d465b07},{0x02402e3e,0x2ba81f94},{0x01c00b9e,0xe12b32bc},{0x0160a622,0x3a3054e6},
+{0x02002469,0x01a12915},{0x02a011ae,0x9234defc},{0x02a0280e,0x3db043b1},{0x03a1ee36,0x3d339fea},
+{0x01e01c6e,0xdd8aaa67},{0x02816979,0x81ea9c37},{0x026e011c,0x24a882d8},{0x01a020aa,0xbe352e2c},
+{0x04c1f75c,0x47b8b450},{0x02418ab0,0x4e9ac7f4},{0x01c0a5ab,0x7aec3948},{0x03011a25,0x7a64a2df},
+{0x02418ac5,0xdf193fb5},{0x01416a52,0x66091d08},{0x03a002d0,0x33ec9bdc},{0x02e0aa76,0x3ceec991},
+{0x02000f5e,0x7abba0eb},{0x024188c5,0x09fe3a0f},{0x02a0fd3e,0xbf5bd3c1},{0x01ae003d,0xd3d16aab},
+{0x07201fab,0xddde4e17},{0x03010f72,0x770dc691},{0x01e11482,0x6348b8ba},{0x01e00e26,0x603c7ad5},
+{0x02e008f6,0xe1c9f82b},{0x0321aff5,0x9b34271b},{0x01a11803,0xa63bc466},{0x022112d1,0xf84f656c},
+{0x02e1444d,0x2c73434a},{0x022010f2,0x3b96857b},{0x01e0a19b,0x50558e77},{0x02a014e4,0x02b81c73},
+{0x02c1d310,0xe74c4ce1},{0x0340fbde,0xcf833b3d},{0x01a0a055,0x17b97ece},{0x0380fb70,0xdc7f407b},
+{0x01611712,0xabe02fff},{0x01e01c0b,0xf696dd83},{0x0141f9ba,0xc84e21e5},{0x02c13302,0xcc3dea3c},
+{0x03610a6f,0x7d2f1568},{0x01a02981,0xceecb93b},{0x04a01eb7,0x44a03218},{0x02418840,0xf98e0358},
+{0x0200304c,0xac3981c2},{0x01c02634,0xcf923952},{0x0661fb5d,0xcac9f159},{0x03c1e148,0xe2d11a97},
+{0x01e11152,0xb8597aa7},{0x03202de0,0x06974011},{0x06e1203d,0x75954fec},{0x02202eb4,0x3d747160},
+{0x0361d514,0xf2bc2233},{0x0141f49a,0x0cdefa00},{0x0241219f,0xd7dae86b},{0x01e1bc38,0xf2676aaa},
+{0x034023a2,0x9f65984e},{0x0641d98f,0x88542cab},{0x01e00a74,0x7f1aac68},{0x03a0149b,0x7fc23454},
+{0x03612403,0x54d21d93},{0x02202f81,0xea503066},{0x04802a8f,0x219e4e9f},{0x01c0005c,0x8e8b5a60},
+{0x05002793,0x23310381},{0x02c0aaeb,0xff43dd25},{0x02601a49,0xee8c0b84},{0x01e00ea3,0x2304d7ae},
+{0x02e145b3,0xf82ae931},{0x02a00de9,0xab905559},{0x0741d9be,0x7f56235e},{0x01c00c67,0x8773985a},
+{0x0201f7eb,0xec07405f},{0x02e019e9,0x9293b099},{0x02418843,0xf68dfe9f},{0x01202293,0x874aed1e},
+{0x02e009fd,0xb9f9db1c},{0x01c0315e,0x5b45e078},{0x0360feb9,0x4cdf8a2e},{0x02c109a2,0xc797a843},
+{0x0201063f,0x1d21a9a8},{0x020030ac,0x44e1444b},{0x01a1f5e6,0xa1151fd7},{0x02c130f9,0x1ed4dbf7},
+{0x03e01487,0x4f8f56b7},{0x018000f7,0x74bda553},{0x02e16b8d,0x8d2e926c},{0x024188a7,0xffd95978},
+{0x01a0a1fb,0x5f41e101},{0x03e16841,0x6f7ad768},{0x03a01f71,0x23b57f07},{0x03e18c81,0x7a90e4ec},
+{0x03400189,0x31118ac3},{0x038014af,0x6518238f},{0x02210196,0xd26964e0},{0x02003059,0x68572bca},
+{0x01e0172e,0x5a826926},{0x0341e82c,0x97ac2094},{0x0381e896,0xed465f8e},{0x0201230d,0xb9773ac5},
+{0x028026d2,0x44f6407e},{0x00e1f3df,0x2fbee8c0},{0x036102f4,0x7351593d},{0x02e0056c,0x3eb6bccb},
+{0x02e131ba,0x538ba560},{0x02c16a37,0xf01e72a0},{0x03e18beb,0x08ddbcbb},{0x026104fb,0x4683924a},
+{0x03e18b48,0x8bc628e0},{0x0461d61b,0xe5a2f2db},{0x014007d0,0xf78f23d8},{0x03c0a7fd,0x4bf38717},
+{0x05e0fd4c,0x33149a20},{0x026e0125,0x27a648fa},{0x02a0220d,0xcdcac64b},{0x05a0fd03,0x5c5a7be7},
+{0x02e10572,0x9254ebe7},{0x024188bf,0x13fe49cd},{0x02616a05,0xe611e092},{0x03e000ea,0xb6d12ced},
+{0x02a12109,0xb2b95e29},{0x01e11017,0xf4bb0e68},{0x03801c80,0xb2101235},{0x01c02317,0x580b4d9f},
+{0x01a16a68,0x338bbbcf},{0x01e01c75,0xcc914b69},{0x03402c1e,0x160e4496},{0x02e02d16,0x9edb8a72},
+{0x03a02cb9,0xf39ac28f},{0x01c0a3a8,0x0aa66b2e},{0x02418a0e,0xb22e8f35},{0x0341d435,0x35b2bd6f},
+{0x01e1fb0d,0xab619f50},{0x01e12261,0x60170641},{0x00e1f99d,0x700df9da},{0x0201bc20,0x60c28b7c},
+{0x03016e8f,0x319720cd},{0x0300074e,0xc643ae57},{0x0281d87d,0xc08841fc},{0x02211c26,0xf4615460},
+{0x0600fd82,0x0e440cbd},{0x02802f90,0x9f82ef0f},{0x02010648,0xbe9dfd95},{0x02e1457f,0x6a4162f6},
+{0x04200fbb,0x87c14bd5},{0x04402b72,0x011cc8f2},{0x024016db,0x2dae2cae},{0x0301f018,0x6787f99d},
+{0x0061f40f,0x8cd93383},{0x02c1f066,0x6ee96312},{0x02a013fd,0x282f8d2f},{0x03410ce9,0x8e409066},
+{0x01201ffd,0x740d4a12},{0x03800154,0x9171f831},{0x02418941,0x27811c2c},{0x04a0fc1d,0x11091ab9},
+{0x02200d24,0x1e312443},{0x03c0058e,0x57eadbf8},{0x02a01586,0x8e4c848b},{0x03011373,0xc577e473},
+{0x0261bc4f,0xac520dfa},{0x03802945,0x9e72e98a},{0x0221202b,0x18077af5},{0x024189f0,0x9edc68d9},
+{0x02c132c8,0x6c9883f2},{0x02e1f74c,0x46d6b99f},{0x0261123a,0xe473458a},{0x026119b0,0x0f779e65},
+{0x042000d4,0xec48b0ea},{0x052001de,0x467f6a22},{0x03012481,0xff8c5ff3},{0x01e10679,0x492b0188},
+{0x03e18b4e,0xc8c688e7},{0x01e10ea1,0x4a572afa},{0x01a11005,0x6b59ce19},{0x02e145c4,0x73efdbb8},
+{0x038014ca,0x09a0bb02},{0x01e00cb0,0x290a24de},{0x01c16abe,0xbcfe0ee0},{0x01a1f5d4,0x0b09ed0b},
+{0x02010b13,0x89c32e36},{0x02e1342a,0x2bd6a2f7},{0x02000f46,0xe04446a8},{0x03010125,0xa4625aef},
+{0x02601211,0xe3759557},{0x04002cd7,0xfafefe88},{0x01e00353,0xde621f8c},{0x0381f50e,0x1437f61a},
+{0x02401032,0xd6385f6e},{0x02810445,0xa7fbe85c},{0x03e18bfb,0xaee100a4},{0x0481d0a0,0x397c4878},
+{0x01a0a5bd,0xd12c95a6},{0x04000285,0xa57e0914},{0x03012120,0x2ecccc64},{0x026119b5,0xfb97d294},
+{0x01e0a859,0xd40dcf9a},{0x03010c12,0x11e4550d},{0x02e14581,0x7434a6c1},{0x02801410,0x6849bee3},
+{0x0640075e,0x4cf3fe0b},{0x02c005af,0xb35747d2},{0x02a001b7,0x0e4edff8},{0x01c0a063,0xce44498f},
+{0x01c00c39,0x5c49fc1e},{0x02811d88,0x1e77841b},{0x02c1f749,0xe8daf5d2},{0x0201062f,0x1e262869},
+{0x0361252d,0x012ab765},{0x01802bfd,0x55e5030d},{0x028e01a1,0xfb6352c9},{0x0621d98d,0xfa7648ae},
+{0x032026d7,0x78ad66b2},{0x02e131c1,0x8b87805a},{0x0341e892,0x5b24dfe3},{0x02c0aa64,0x9a0ec063},
+{0x03e0fffb,0xeb17ca54},{0x03c1d746,0x1e3dfbc0},{0x04a01eed,0x0357aaf9},{0x0200a9a0,0x62746fbf},
+{0x03e0ab39,0xf2084017},{0x020009dd,0x7df9d07e},{0x0401d732,0x257e17c4},{0x03001897,0x04867f1f},
+{0x02c133b4,0x8c1399e9},{0x02201ba0,0x8cdf06e0},{0x0261e943,0x87da582d},{0x02e133ff,0x90e4ed90},
+{0x03c00da4,0x71c89f12},{0x03e18b97,0x1abebb38},{0x0241192c,0x9fd58612},{0x02800602,0x45871a27},
+{0x02a007f4,0x7930ad1a},{0x03e1d56f,0x65f4fcd1},{0x0361ee91,0xc933ac7e},{0x0141f48c,0xd5503fd1},
+{0x024189d8,0x22c3a0bf},{0x02602d3f,0x141ea954},{0x02e00d7e,0x8daf0c8d},{0x02601358,0xf6e71e9c},
+{0x0361d6a9,0x41ae2248},{0x028e01e1,0x9ce1e54d},{0x02e14620,0x6cdc48fb},{0x014027c3,0x0839d22f},
+{0x038006ef,0x212d6ebd},{0x02c10d0f,0x7f222ac3},{0x03c01e07,0xda2ee95d},{0x02610fb6,0xca5ddc47},
+{0x028168a9,0x1a649ed4},{0x01816a60,0x097b43ae},{0x0200266e,0x9ada1d34},{0x0141f957,0xd1ddf83d},
+{0x03c1f60d,0x0810af82},{0x04401cc6,0xfd3cde51},{0x03e18b98,0x19beb9a5},{0x04a02af5,0x45b15bc8},
+{0x0381d8b7,0x87607f1f},{0x03601d54,0x0dd78e34},{0x04a1206c,0xe8ed918f},{0x02802dbe,0xa33afecf},
+{0x01a00c0e,0x5b0b968c},{0x04a004f2,0x9e0bbb46},{0x01c0a1f6,0xc09bc0c1},{0x02a0184c,0x01eb03b0},
+{0x0401f12b,0x20486b32},{0x01c11094,0xe454408e},{0x020114a1,0xe34c6b5b},{0x01c0a449,0x6003a8f0},
+{0x02c13081,0x3721280b},{0x02410352,0xa839c2bf},{0x04c1f92a,0xab7d7bb0},{0x02604de9,0x98bd7499},
+{0x02a028b0,0xf8a74059},{0x02e169cf,0x7867442a},{0x01c11187,0x32aa6196},{0x02010524,0xca0519b2},
+{0x0260279a,0xe09de9b3},{0x02800669,0x971553a3},{0x01c0aab7,0x64d32484},{0x05c1d091,0x91a8292e},
+{0x04a00520,0x7820820f},{0x03811fc6,0xffd8a7f8},{0x0240a8d1,0x7c157b70},{0x01a0a0cc,0xd8830553},
+{0x03e18b7c,0xb6cd2856},{0x01e02443,0x554fa63a},{0x028030a7,0x056accb1},{0x02a0317b,0x9a7f6b85},
+{0x0380164b,0x10815778},{0x03a0047b,0xe830df74},{0x01003399,0x559471f7},{0x01402227,0x5925fcf5},
+{0x01a0a290,0x9f5236ca},{0x02c1224b,0x9c772a6e},{0x02e144e0,0x1c2121a7},{0x02e16b21,0x68570cee},
+{0x02a169ab,0x4526c602},{0x01a01948,0x86a06e8d},{0x02400aee,0x69ea03ce},{0x02401a18,0x44830c06},
+{0x040120c5,0xe2654f2a},{0x01c02b52,0x9bafa131},{0x052109f4,0x7383dc6e},{0x02e0a802,0x73c37fc9},
+{0x0401d004,0x38159b95},{0x03012539,0x7a6595d1},{0x028e01c7,0x16d5d968},{0x02001b51,0xf5ee0441},
+{0x026e0119,0x2ba88ddd},{0x04a0275c,0x1344c456},{0x0280ff05,0xf0d11588},{0x02a0fb04,0xc0ad0f4f},
+{0x02001a16,0xa30609f6},{0x03800139,0xc5650d77},{0x0621d9b4,0x79120b07},{0x0381d494,0xb72002ca},
+{0x02c133f2,0x1b7851e6},{0x02418a13,0xaf30c913},{0x020032d4,0x3ba9a72a},{0x02003126,0xc6993f3f},
+{0x01600e99,0x7d5c515c},{0x0361e8b0,0x3296a471},{0x03e18ba9,0x19e864da},{0x01e1069f,0xc334bbf2},
+{0x02c00d7f,0x243e14f2},{0x02201ab2,0x41357701},{0x01c01957,0x8ad45069},{0x032118d9,0xf0ebd5c0},
+{0x03602413,0xde1b9511},{0x020103c0,0x66f5b7f2},{0x028014cb,0x608e31a6},{0x032011e3,0x1e455676},
+{0x026e0029,0x6a827dc1},{0x03c1d46f,0xfa230e1a},{0x0180a4e1,0x9afba421},{0x00c1f46a,0xecf3dba9},
+{0x0221f4e3,0xcb4d5e6c},{0x026100c1,0xdd67c9aa},{0x0360fee3,0x6b9069e1},{0x024008f2,0x72b00312},
+{0x02c0286a,0xdb71f345},{0x0480fc39,0x842e4afe},{0x01e12145,0x3e1d8c80},{0x02c003ed,0xec6132d2},
+{0x01e0a236,0x34e33431},{0x0261035f,0x6fcc1215},{0x03c00d75,0x51c7790f},{0x0261b060,0xc020869d},
+{0x030025d3,0x2691efbd},{0x01c0a418,0xfeefaac6},{0x02c02153,0x7fe19d7d},{0x0360068a,0x6e54e5aa},
+{0x0440ab4e,0xbda88cdd},{0x01e12100,0x40058ac0},{0x02001b24,0x0b015761},{0x02a02243,0xe77f28f3},
+{0x03800147,0x0944b4aa},{0x02c131eb,0xc702122f},{0x01e11031,0xc69baec3},{0x05201fbc,0x90b552ab},
+{0x0440108d,0x44c944af},{0x04c0fc4d,0xb0f25eb1},{0x04a0022c,0x42c9e0b5},{0x03212087,0x153f2a88},
+{0x01a00baa,0x58fb15f7},{0x0420ffae,0x683362b7},{0x044002b5,0xe887542e},{0x02c13108,0xf114911a},
+{0x01a006c7,0x011665a4},{0x03a1d898,0xd73b1300},{0x04010174,0x66b08178},{0x028e0061,0x76c228d9},
+{0x016031d9,0x0672b436},{0x03c12464,0xdc780fb0},{0x01e10715,0x826ca7bb},{0x0160332a,0xd25f6153},
+{0x0321f65a,0xaf8edee7},{0x0240a610,0x8ad5414c},{0x022112f2,0x01ec03c8},{0x0361e8aa,0x3035fd14},
+{0x0321215d,0xad981539},{0x03a1f3fd,0x2bc31675},{0x01000036,0x3c79b1ee},{0x02c133d2,0xf41bf211},
+{0x01e11196,0x851553b7},{0x02418969,0x9f8ad370},{0x02c1200f,0x4b524b0c},{0x02400d6f,0x672728e9},
+{0x05a1f248,0x66f8e2f9},{0x01e16f96,0x7b98717a},{0x02e1322f,0xcc6eb75b},{0x03a025a2,0x6bc104a4},
+{0x02e1453f,0x79938306},{0x02c130fd,0x12d4c913},{0x028e0192,0x80605291},{0x04810b7e,0x9a6583ee},
+{0x0441f724,0x49e2063a},{0x0220208a,0x8536b26b},{0x03a1fb6c,0xb620c482},{0x03010586,0x68bbbb95},
+{0x02e0a9f2,0xf2315dd2},{0x00e1f419,0x11be492e},{0x010033b0,0x9bcafa23},{0x01816a5a,0xffb6384a},
+{0x03210a6b,0x408f90a1},{0x012000a6,0x6276ed35},{0x020030ad,0x24d6848f},{0x01e0a864,0xd0276134},
+{0x02c13318,0xf90b0521},{0x0340ffbe,0x02149824},{0x0221fb3b,0xd7ca2d6b},{0x02e1458b,0x6e325eb8},
+{0x03410164,0xc269ae98},{0x03e027fd,0x046cea8e},{0x0621d9c3,0xf1e60882},{0x04e01f55,0xad8ab512},
+{0x02402faa,0xbd11e7fc},{0x04a120d1,0x5ceccdd2},{0x02011139,0xb7a89f97},{0x02400308,0xb4f63062},
+{0x02c13266,0xefb0a849},{0x03e18be0,0x1addd911},{0x02c10578,0xc2d83b9d},{0x036015d8,0x0fd3ef70},
+{0x01e01a4e,0xf5b7f56d},{0x028014ab,0x5cc6f915},{0x028014c5,0xaa7b1e6c},{0x02816b0a,0x8a0a3645},
+{0x02c133d6,0xf21beeeb},{0x02c00f1d,0x5ea3dc5c},{0x02801593,0x80675496},{0x02a0ab92,0x4531f96d},
+{0x0200205e,0x0a3a75ab},{0x028e01b3,0x755e02a9},{0x02e0289b,0xf7cbb288},{0x04c003ab,0x9939f811},
+{0x0300302a,0x9e327c03},{0x02411925,0xbbc6a79c},{0x02603273,0x3c913b9c},{0x02602fc9,0x7826c726},
+{0x026003c8,0x9dc52e96},{0x02001c63,0xb94a6397},{0x03e1da6e,0xd334309b},{0x01c16a9e,0x94d8ff0f},
+{0x0241b00a,0x4c1ca4c9},{0x02a02a52,0x73d704e1},{0x03402f8f,0x46c55e40},{0x02a0fb03,0xbbad0770},
+{0x0581d851,0x231bf282},{0x0321d6b3,0xb851f560},{0x01e0a221,0xa6ae9b13},{0x04201e9b,0x7c805023},
+{0x02210820,0x99d783fe},{0x01e00b6e,0xecd2a3c5},{0x02a031f1,0x2b4d45ca},{0x01e01709,0x9c4f9e07},
+{0x03e18c6f,0x79956087},{0x0241f46f,0xab2e3876},{0x01e11815,0xb315e9a3},{0x01e02169,0xac4cd947},
+{0x0681f676,0x2b796b83},{0x02a16915,0x07e410fc},{0x02003090,0x94606b6a},{0x030120ce,0x62936f14},
+{0x01a1141e,0xcbb25347},{0x02201048,0xf231ec28},{0x01c0a054,0xef024622},{0x03410cda,0xdb253320},
+{0x03600233,0xb38f28ad},{0x02800e0f,0xcddc1b08},{0x03c0d7df,0x7b8320dc},{0x0561cf0a,0x6ca4c156},
+{0x02000bcb,0x7a09c73a},{0x028169fd,0xc7f881f3},{0x038015c7,0xab0d14c1},{0x022016dc,0x1e94c3fc},
+{0x024189cb,0x29c5ea5b},{0x02418992,0xb2cb3f34},{0x02c02866,0xb275e7f4},{0x02a02e28,0x8fd43223},
+{0x024189ab,0xa9cfae37},{0x04a1f5d8,0xe26766eb},{0x02201b9d,0xa4a6d417},{0x01a0a199,0x93993132},
+{0x028021d4,0x873bd1bc},{0x022112db,0x088a15c4},{0x01c0a081,0xda66a6e4},{0x01e03250,0xaefd853e},
+{0x0161e2a1,0xa15aac14},{0x03401b67,0x32d5e8b1},{0x02402e8c,0xbff07fc4},{0x0261b0de,0x069cc3fd},
+{0x028019a3,0x61f51bba},{0x00e1f43d,0x90554d20},{0x0440fc6d,0x662d5071},{0x04401d96,0x4761a4bd},
+{0x0381d705,0x7ed08d63},{0x0361d16e,0x25207492},{0x02402703,0x0e1850df},{0x03a00f8d,0x6023cbf2},
+{0x03610131,0x211cf1a7},{0x02602db6,0x36bfaf91},{0x0380ff26,0x43ecc620},{0x05200c7d,0x01001aaa},
+{0x052033f0,0x6d0cd5c4},{0x02016f30,0x1e7664bf},{0x01c1fb10,0x452ed785},{0x0260107f,0x3b8c15f5},
+{0x01a11714,0x470288fb},{0x01a1092f,0xafbf8222},{0x026104dc,0xd9a984ac},{0x02002d49,0xe057a37f},
+{0x0220a99a,0x01c7fc20},{0x0381d6ab,0xd4440cec},{0x02c00b43,0xb991e8a6},{0x0061f9b5,0xc2456517},
+{0x01c0a52d,0xd3c40af7},{0x0341f73b,0xce775f8b},{0x020031a0,0xd39297f1},{0x01a023fd,0xfc30aa57},
+{0x04c01f63,0x05aabb0d},{0x02602e82,0x70251abb},{0x03e18bc0,0x1eece9e7},{0x01e10701,0x31a1de8f},
+{0x028014f2,0xc07acbeb},{0x0340233b,0x1d988773},{0x03a0ab52,0xa0fa5301},{0x0361f7c1,0x8c951c18},
+{0x01a031c8,0x10aa2c51},{0x0360a8bc,0x1493663a},{0x03a1e020,0x368e2f4b},{0x03011037,0x1dc87ed3},
+{0x03812519,0xab844e40},{0x03e18bc5,0x19ece208},{0x01a11687,0x0612aa2c},{0x02c1ec7b,0x12973e1b},
+{0x03202c31,0xafc137a6},{0x04002359,0xcd5eca1a},{0x0200a590,0x0a5bf067},{0x0320d7cb,0xecbbcba6},
+{0x02002164,0x3a022318},{0x0561d0a4,0xb04792ed},{0x02e16b88,0x4978695c},{0x01e00f26,0x5ce53ca9},
+{0x0260aaa5,0xa43ed0dd},{0x01a0a413,0xaaaff0d7},{0x0280fb01,0x58fd4ec4},{0x01a11702,0x4aa7516e},
+{0x02c11d53,0xec23c5c7},{0x022009bf,0x5e47665a},{0x02a019fe,0xa850126d},{0x01c0a32a,0xd96db444},
+{0x034015f0,0x1150af36},{0x0320fb77,0xa034a1c1},{0x0201f5a6,0x40a8be94},{0x04402bf3,0xbb7070f9},
+{0x02001004,0xc0c65eca},{0x00e1f3b2,0xf99c340f},{0x03810995,0x99fe9a28},{0x022115bf,0xc69639a2},
+{0x04a01f32,0xbe6d094c},{0x02e00540,0x608d3f87},{0x02a021db,0x3f97f2f9},{0x03a02752,0x2959ec68},
+{0x02e023d6,0x6b0a16dc},{0x02811d80,0x4e8b5763},{0x02200730,0xd17135cd},{0x01c1120a,0xeed7d4b3},
+{0x02c1321e,0x7586677c},{0x028e01be,0x07d80062},{0x02200a02,0x3205cf04},{0x0381e118,0x02a85d19},
+{0x014007d2,0xf88f256b},{0x026101f1,0x54fe7f5e},{0x02c00747,0x106383da},{0x0400d7d7,0x76d3ce4c},
+{0x02000a5e,0x29f5ff4e},{0x02e10a70,0xd26fabd4},{0x03a0fad7,0xa27c7926},{0x01e017d7,0x218864d1},
+{0x02402f71,0xa83c9f78},{0x03e1f74e,0x1875abe3},{0x0221f18b,0x5ab1af1b},{0x03601663,0x12d4ef1a},
+{0x01e0fe69,0x81ae98f7},{0x010032ce,0xb09bbcfd},{0x0281cfbf,0x05b58793},{0x0261088f,0xe3c6d452},
+{0x02e14496,0x9e0a94fe},{0x0421d236,0x476beb09},{0x00c02bdb,0xcecd3afe},{0x05c1d925,0x85098559},
+{0x02211cb3,0x12f51c00},{0x01e00988,0xc327cc8b},{0x02c132a7,0x585a015f},{0x03a0a8e8,0x6a69295b},
+{0x02402f1c,0x40e56123},{0x0200a6af,0xf33a6f04},{0x03010571,0x0da84d71},{0x02e122ec,0x61b64fcf},
+{0x04a1d97a,0x112d3a91},{0x01e0a9c0,0x6e3f44c4},{0x0261b0ea,0xf47a1565},{0x02e13147,0x5b2d07d6},
+{0x02002f7d,0xdfe95d6a},{0x02010741,0x39731eae},{0x0461d60d,0xd7a2dcd1},{0x01a0a4c5,0x22ed5ed5},
+{0x02e14404,0xad788b8b},{0x02802402,0xd39212aa},{0x04001f41,0x16c4afe5},{0x02a002f3,0x79fba278},
+{0x02c026ac,0xd169da3e},{0x02211c03,0x046bfaec},{0x01a0a6d8,0x3f3ade14},{0x01e1106f,0xa6363eb3},
+{0x0301da67,0x25cceb0a},{0x0320ff9c,0x14b3afd2},{0x03c1d47f,0xea22f4ea},{0x012033aa,0xd35c3c6c},
+{0x01c0a1ac,0xcc5a7342},{0x0360327d,0x21965c90},{0x0300a731,0x0db8d261},{0x0240118a,0x487828bd},
+{0x032010b4,0x64ae5a36},{0x02e16e7c,0x66d45896},{0x02000ab8,0x8398961e},{0x0180a041,0x76865920},
+{0x03602df5,0x86792607},{0x02000f29,0x980d922b},{0x03a03233,0x1fee88ba},{0x02816889,0x9e411887},
+{0x03e1d0ee,0x019f2c3f},{0x03803192,0x8b41a0b6},{0x02c03136,0xf9c6756e},{0x0481df00,0x6ec16e9c},
+{0x0401d7da,0x1d06c0f9},{0x01a00b68,0xfe44d210},{0x02c13162,0x3dbe56a9},{0x0141f453,0x2358a8b6},
+{0x03a1da0a,0xe5178d37},{0x02002f92,0x4635d424},{0x03a025dd,0x56fae1d2},{0x026008ad,0x469256cb},
+{0x02a0abc9,0x9638d0fe},{0x01c0a530,0xf808282d},{0x02a02474,0xc996f7fa},{0x01816f48,0xc99d414c},
+{0x0300083a,0x4daa4419},{0x036015ab,0x4168cefd},{0x02200a51,0xde48f4d7},{0x02801b7d,0xcc6df221},
+{0x03602df4,0x570343b2},{0x01a16f34,0xcc4d3a8c},{0x03200cdd,0xb638267c},{0x05e1d0c6,0x9454e801},
+{0x042109de,0x4b080e2f},{0x03000556,0xe85665fd},{0x03016843,0x9c0dd042},{0x0180a0bf,0x64526167},
+{0x02418876,0x08eab0c4},{0x01c02076,0xffa8f10d},{0x02e130b1,0x257b6d68},{0x028021d6,0x3ea1b0a3},
+{0x0140212a,0x39b9ca95},{0x01e00f45,0xc97b72fe},{0x03402096,0x22cc1bfa},{0x020031a3,0x8f9ef8d8},
+{0x04201886,0x7da6ca53},{0x03c11af1,0x0373dabd},{0x04001cac,0xf5ce78c7},{0x0201f62d,0x5b08a067},
+{0x04e01b77,0x564650f1},{0x01e11833,0x707d95a7},{0x03c02933,0x0b80dfb5},{0x02e1f856,0x9d21fa42},
+{0x03e18bb8,0x10ea9546},{0x01e0a910,0x0a9916b7},{0x0301d15f,0xf891a92f},{0x03e00f01,0xc122cc06},
+{0x028168d9,0xae2c038e},{0x02c132bb,0xf39b970e},{0x02e01bca,0xf6e63d57},{0x03010a93,0x0aecd5e4},
+{0x03202987,0x3541f391},{0x0461d60b,0xd5a2d9ab},{0x036015a9,0x1f77a401},{0x03a1d089,0x05b92964},
+{0x0301da9c,0xa3d6a931},{0x0301d1bc,0xb9a68dc7},{0x01e03109,0x87fa05e4},{0x0361d025,0xe7368162},
+{0x01e0a2d5,0x30a8f443},{0x0361e80d,0xf38ae53f},{0x02e14424,0x1d7ff7a0},{0x03e18c76,0x879337fa},
+{0x01c0a340,0xd99656b4},{0x02a0199c,0x6551f9a2},{0x03012488,0x334fa2cb},{0x03e1e8d1,0x52a09046},
+{0x03c1206d,0xfe0d87fc},{0x02401841,0x8e6ecc58},{0x0361da13,0x0677c72c},{0x0340a99e,0xdac562aa},
+{0x03010eac,0x25b33f8f},{0x02c11ae3,0x60969a7c},{0x02212226,0xe251db3d},{0x04c027a3,0x81ec2a49},
+{0x01e02320,0x51e5b57d},{0x02a1ee07,0x6da21e7e},{0x02016adb,0x7cc265d8},{0x02200a1b,0xb148ea2f},
+{0x0420274f,0x8678cab6},{0x0281fa29,0xfbdaf9c0},{0x02418a04,0x42362daa},{0x02610aed,0xc3cf7aac},
+{0x030010aa,0x68d22a33},{0x01e00698,0x34dd3a24},{0x02802a9e,0xb819d690},{0x0421f860,0x652f48e1},
+{0x02012083,0x36c2b7b5},{0x01a01743,0x17e762c9},{0x03410caa,0x1a431420},{0x03e18b35,0x98d78678},
+{0x0301f398,0xffc733d8},{0x0180a210,0x8a4392af},{0x02a01849,0xf9f345dd},{0x03c1fb6d,0xcba112bb},
+{0x0440254f,0x05c14c1b},{0x0520296b,0x81f6ab3e},{0x020010f7,0x1ab0ae1c},{0x03e18b64,0x9bcabf3e},
+{0x02c133ca,0x850f11b6},{0x0461d0f5,0x5acf14aa},{0x0341f57d,0x71118129},{0x01a02304,0x394ad0a0},
+{0x018000a0,0x5cb790c1},{0x01e11496,0x3b5fd311},{0x03c1fb9f,0xbf007832},{0x0101f95f,0x16da5d2f},
+{0x02a1bc42,0xa13b051e},{0x01c1163b,0x1addaa9f},{0x02a1ee0a,0xf7caf7f5},{0x01c11226,0x0b0bdc2a},
+{0x0200a91e,0xc913d9f9},{0x05601fe3,0x9d4b7126},{0x0221f18e,0x299dda40},{0x03e18b04,0x07cfe670},
+{0x02418acc,0xd81934b0},{0x044030fc,0x971558d6},{0x01203395,0xbc9633c0},{0x02e130b4,0x287b7221},
+{0x0341f7b9,0x890556f4},{0x0461d61a,0xeaa2faba},{0x01e12157,0x90228ac4},{0x0560fbb8,0x7604829d},
+{0x03e0048e,0x53a8635e},{0x03a01464,0x18a9abaf},{0x0421d637,0x44b1e690},{0x01c11ef1,0x45e00b42},
+{0x022016c3,0x9fc4ffc2},{0x0161f54a,0xe2b418ee},{0x03002150,0x6924e48d},{0x030024e1,0x60b6c734},
+{0x01202009,0x2b5107bc},{0x0480020a,0xe05503f3},{0x02010b31,0x9faba56d},{0x03c020ea,0x29f93258},
+{0x028021d9,0x59d69f0d},{0x0221119e,0xf9f2c894},{0x0341f890,0x039a5dc6},{0x0560fe36,0xd702920e},
+{0x02410338,0x1ef8dd05},{0x02c02c93,0xb96318d8},{0x02c02833,0x179efb5c},{0x02201833,0x54482ca4},
+{0x0380a75c,0xbe8a63fe},{0x0361d51a,0xf8bc2ba5},{0x0100338e,0x6fb07162},{0x022032e7,0x7714fe68},
+{0x01e10513,0x29936b70},{0x02c1321b,0x74751cc8},{0x0200a945,0x027dad1e},{0x02601a82,0xd4b37b32},
+{0x03801388,0xccdd62f3},{0x02c0186c,0x48c35b01},{0x01e10e84,0x56fe99cc},{0x02c1d177,0xb5fe0932},
+{0x0081fa81,0x85b59056},{0x02e1d6d1,0x003c4dd6},{0x02c13397,0x2dbe2b4d},{0x01a0a4a4,0x93ce7200},
+{0x026e005e,0xbc2b7cc3},{0x018027de,0xcfab6797},{0x01e00c6f,0x98db6eba},{0x02e00a81,0x452b5446},
+{0x01e1d2e2,0xa8f67f9d},{0x0341e7fe,0xf715477a},{0x0340fe91,0x8820e036},{0x01403309,0x87ff5b03},
+{0x0361e812,0x3c908c23},{0x02c1339a,0x2abe2694},{0x02011594,0xde3c7259},{0x02c10d26,0x192e930c},
+{0x020115c0,0xe0109de1},{0x01e02b50,0xcab8d519},{0x034121e2,0xb7ab4a95},{0x03410bae,0x92a72e0f},
+{0x01e03046,0xdb81348d},{0x03a001b8,0x73a6d5ee},{0x02e006cd,0xaa991a27},{0x0781d9ea,0x45e11320},
+{0x0221d314,0xdf88c10a},{0x032120e9,0xb590431c},{0x0181e297,0x2ebacc40},{0x02e133cd,0x39bd7327},
+{0x0561d84a,0xfc72de5f},{0x0241f55d,0x0fb0ccba},{0x0280202b,0xc52b6052},{0x02a003b1,0x4b903ac6},
+{0x028110d9,0xa2ba335a},{0x0501d84b,0xf4709c6f},{0x01a0a5b0,0x2711468b},{0x03810996,0x4e133d3c},
+{0x0300a9fe,0x3eb5f534},{0x02810321,0xcd5e81b0},{0x0340fec3,0xee4ab7dc},{0x01801be4,0xd066158b},
+{0x0441f150,0xda4f403f},{0x0620fd78,0xb5ebe27e},{0x06c029a9,0x0f1482f4},{0x01e01687,0x0ef607cf},
+{0x02811abe,0xc0bdb1d8},{0x028e0190,0x7e604f6b},{0x032100e7,0xc367e626},{0x02010b32,0x55045aea},
+{0x02c12178,0x9c38369c},{0x01c102ac,0xcef4e59d},{0x058115cc,0x2050d55b},{0x01e12311,0x2ad84a13},
+{0x02c1317d,0x42cd6912},{0x03201b08,0x277cfd5b},{0x03800fcb,0xbebed542},{0x0421d5e0,0x4936c163},
+{0x04202371,0x714303c2},{0x02001c54,0x529ed559},{0x02c12338,0x71cf6553},{0x0241cfc2,0x759114bf},
+{0x0261d903,0xee93a647},{0x02c168af,0xbfcc9c69},{0x03011a1f,0xb4fed4bd},{0x02401269,0xd92b8bdd},
+{0x0061f415,0x2b1dd969},{0x0341d44b,0x2fb2b3fd},{0x028014f0,0x027fb0ff},{0x038030a0,0xb46c1049},
+{0x036018eb,0xa2a4d7b3},{0x03001b3c,0x15ce36c4},{0x0180a4a3,0xe340c83d},{0x0441aff9,0xce524ebc},
+{0x020030d0,0x00eda532},{0x05c02ba4,0x902881f8},{0x0300290e,0xd63905d0},{0x02210887,0x1151c325},
+{0x02c02495,0x5d5771bd},{0x0121f495,0xee2d03a4},{0x0340a792,0x591738d5},{0x02e11075,0x539ac019},
+{0x01e0168c,0x916dbc97},{0x0320321c,0x5f5b2582},{0x0240080c,0x8a5249a2},{0x0421f863,0x0c510b32},
+{0x04e1d63d,0x05e1adaa},{0x02a11d81,0xd36b868b},{0x0241894c,0x308368ee},{0x016007d8,0x8f48a2a8},
+{0x0220fe6b,0x6f3bfbe3},{0x02418ac4,0xe21705d7},{0x02a02cea,0xace7d7d7},{0x02800dea,0x883c2c7f},
+{0x03a1ed16,0x86aaaff1},{0x02401939,0xc405abaa},{0x0401d146,0xeee5b8d1},{0x020112a7,0x2630ce2e},
+{0x02a122c2,0x44dc7879},{0x03c1f233,0x39f9af25},{0x04002dfd,0xad4ec6ef},{0x03010cd0,0x401f6fe9},
+{0x02c1310f,0xeb1487a8},{0x0261b0f0,0x9fb8def6},{0x0320fb73,0xad978a67},{0x0441cfae,0xae5e159b},
+{0x0601cf7b,0xcc12d8ed},{0x01e106d1,0xb3bab01b},{0x036001b6,0x9bef0dee},{0x024026d8,0x864dfda5},
+{0x01a0a5de,0x11202e73},{0x01a1169e,0x09e96271},{0x01c1fb16,0xd1276524},{0x02e00414,0x88443d5b},
+{0x02a0110e,0x48a798b5},{0x02a01594,0xf9aa8e75},{0x02e131b2,0xc5bf4370},{0x01e030a6,0xa13c2f1e},
+{0x0300026a,0xf3b8a973},{0x0221fbf1,0xeb235724},{0x0421cf10,0x2c168200},{0x024189c3,0x99be4be6},
+{0x02c13278,0x81a93f5a},{0x026120b6,0xb47c8665},{0x02c1d1d6,0xb65b9b40},{0x02c005be,0x2599295c},
+{0x01e01c16,0x2421ecb4},{0x02c0288e,0xa57a50ab},{0x01203374,0x1269f4ff},{0x028168ed,0x4e641e81},
+{0x032168b2,0x6069a8ca},{0x01c01c11,0x302f939d},{0x0561d7a2,0x18b18aef},{0x0420048b,0x0761736c},
+{0x00c02013,0x3ff162ea},{0x020013bd,0xe8032197},{0x01c0a0e7,0x20b2b4df},{0x02a16996,0x83fa806e},
+{0x02402408,0x98d094ab},{0x03a12457,0x2c4710a5},{0x02c00471,0x6ed6b9f5},{0x0280119e,0xd71c5898},
+{0x0380108f,0x7e9f852e},{0x020030eb,0x0cc515a6},{0x0280199d,0x4603fa30},{0x03e18b24,0x9bd54c9a},
+{0x0201f587,0xb9a9f745},{0x0381ee32,0xe8fd9149},{0x0440ab41,0xb6e2a84a},{0x016031e2,0xd570287c},
+{0x024188a4,0xfcd954bf},{0x02a028c8,0x081bf2ab},{0x02c0ab9a,0xf7a31289},{0x03e0ffab,0xf73dade1},
+{0x02802811,0x0e8dbe62},{0x04a1249d,0xa4e8d771},{0x028e0199,0x03635f61},{0x04c02c2e,0xbed0d90d},
+{0x0260096b,0x70db52b0},{0x0200a6ec,0xed5999f1},{0x02612500,0xa95fcfca},{0x01e01015,0x288e6dcb},
+{0x0201e2f3,0x86c4bbb0},{0x022032ed,0x1105534c},{0x01a0178f,0x48d131a5},{0x02a019c6,0x252ca695},
+{0x01e1e2ef,0x13d66c1d},{0x02c0a7f4,0x97e7cd33},{0x01a0a038,0x19927284},{0x02010527,0x5bb07b4d},
+{0x02600f2f,0x6322b0fe},{0x0421d006,0x42232de9},{0x00a0007e,0xc9707909},{0x0121f9cb,0xd0480a17},
+{0x01e10682,0x4837cbe8},{0x03400366,0x2e1b6b9d},{0x0480fcd3,0x39ba929b},{0x0381ee39,0xe5d1b098},
+{0x052109f3,0xe8e8d774},{0x038014a0,0x6119fa9d},{0x04202956,0x9bac57d7},{0x01c0a2f5,0x9cc0d026},
+{0x02a1d12d,0x557ffdea},{0x03402c7c,0x23cc1d8d},{0x0320fe9e,0xcad07a20},{0x01c1e2cd,0xb76ee012},
+{0x0281f792,0x0c33bdb2},{0x018e0034,0xc43f95c0},{0x02e028f4,0x90cce961},{0x0381da46,0xd9cb8d93},
+{0x02e01145,0x05c9f1e2},{0x00c1faa3,0x4bb771f7},{0x0261b082,0x6be086b5},{0x03c0a645,0x48762576},
+{0x026124ff,0x43ce43fa},{0x02e144af,0x8f060033},{0x02402719,0xd0f0da87},{0x034007f1,0x279b1c63},
+{0x02a1699e,0x28788512},{0x030010a2,0x8b878615},{0x0580fd79,0x726b5d1d},{0x028031bb,0x04981b05},
+{0x02802119,0x34da64cc},{0x02010804,0x6c54673c},{0x0561d7b8,0xf0d2654a},{0x00c026b0,0x285d44b4},
+{0x0380235e,0x063fe7b4},{0x0260d7bd,0x3faa700e},{0x02600cd6,0x778573a4},{0x01e16f7b,0xb7b91e43},
+{0x02ce004a,0x693c5fc5},{0x02e109b3,0x85aa715e},{0x038102f6,0xd55a75b9},{0x0421f87b,0xf0f55f1b},
+{0x03a00c80,0x57f097ca},{0x02a11d50,0x32900127},{0x02c1f063,0x6de9617f},{0x02418839,0xf4873fb4},
+{0x05a0a750,0xe278022f},{0x02e02ad2,0x501a3bb6},{0x03e1d047,0xf4767cfd},{0x01a0a213,0xa5606447},
+{0x024122e6,0xe6e0292f},{0x02c0300a,0x7a339c5c},{0x02e10b8c,0xbc74c4ac},{0x01a1092b,0xa5bf7264},
+{0x0241f0f3,0xd97038bb},{0x02e02185,0x1336c90a},{0x02011497,0xf3c292e5},{0x03c1f75f,0xa0d088d3},
+{0x03e18c1d,0x39a1c7ba},{0x03c024b1,0x0e0144ee},{0x00c02010,0xf135ca41},{0x0360fb17,0xb5ebdc45},
+{0x01c10498,0x271cc27a},{0x0481f591,0xa8e20b9a},{0x02c131d9,0x51fcdcd2},{0x0381e8a4,0x22ed2303},
+{0x03c1252f,0xc6f98731},{0x01a1108b,0x5fb0d274},{0x01e1066b,0xbf303878},{0x01c16a82,0xdccee30b},
+{0x00a1f34b,0x6c13bc30},{0x04e1cf5a,0x32e83b81},{0x01e10671,0x4b28c617},{0x042004e0,0x7cf3ab75},
+{0x048109f8,0x6b8497dd},{0x0240127a,0x18fc9268},{0x02e1460a,0x7afef147},{0x0340fb69,0xfe37ee9a},
+{0x01c0315f,0x5745da2c},{0x01c102be,0x3cdbfae1},{0x02a0a8fc,0x3a9ac37c},{0x022112cf,0xdc5e43e2},
+{0x020031be,0x6f8b3ec0},{0x03e18b11,0x10d23332},{0x042004d3,0x256c0d93},{0x0101f418,0xd5729104},
+{0x03a1d67a,0xdb588401},{0x02616b56,0x602128a2},{0x0401d80f,0xb39cd9e2},{0x02e1226a,0x8292dc6c},
+{0x03e02cca,0x66fec877},{0x01c00c10,0x1033be2b},{0x02011c8c,0x18493447},{0x0340fbd9,0x4bae4f14},
+{0x03010a82,0x82fb41b4},{0x0261250c,0x9d5d7e4f},{0x03c1f447,0x21a486be},{0x01e10b18,0x9538bbfc},
+{0x03210f4d,0xa6af8e36},{0x03a02c63,0x934fe415},{0x05e0fbf8,0x087f030d},{0x01a0a3e3,0xd22468fa},
+{0x01a026ae,0x91055071},{0x024001f3,0xe68de23a},{0x03010a6a,0x2ce560d7},{0x02418949,0x2f83675b},
+{0x040003cc,0x9cc421e4},{0x0260aa33,0x34c13146},{0x030032aa,0x1ae1e541},{0x0480335e,0x0ab2994b},
+{0x0261b06f,0x27169b66},{0x028104c0,0xd4e6539c},{0x0161f9e1,0x7ed9d349},{0x02c16988,0x4381c01a},
+{0x05e1d0ad,0x309b961e},{0x03410a6d,0x71ba73cd},{0x02e1440f,0xb17ad06e},{0x022025fa,0x51e1b3cb},
+{0x024188fc,0x8d1a9993},{0x0480fba5,0xdac360d5},{0x0101f96e,0x167a7614},{0x0181f612,0xbd668758},
+{0x0240116b,0x3d0784bb},{0x02c101db,0x128bd42f},{0x02c11d19,0x502142ff},{0x0300fb93,0x0bca39fd},
+{0x05a1fa3b,0x151005d7},{0x01e106f2,0x3ac47efc},{0x0301d411,0xb64cf9d8},{0x02418aa8,0x469abb5c},
+{0x03810162,0xd02d0358},{0x01a02e99,0x3b940370},{0x022110b4,0x60243a33},{0x024189fa,0x3233d5e3},
+{0x03c01e97,0x926238bd},{0x032100f0,0x4e6aff8e},{0x02c01988,0xee63e2ef},{0x01c0a098,0x141dc9a9},
+{0x02c1fa2c,0x4e76952b},{0x0641d9b5,0x623a826f},{0x028e01a5,0x6f5bbaa0},{0x0380fba7,0x2dd768c1},
+{0x0360108b,0x78a5f56a},{0x01c0a157,0x2f57495c},{0x0180a2b0,0x9e5739e3},{0x0520fd8b,0x6c5f0265},
+{0x03212410,0x10756bdc},{0x02801224,0x9b206bcb},{0x01a02210,0x67e780ee},{0x0380ff2c,0x4decd5de},
+{0x02602800,0xb5f3e02a},{0x0421d228,0x5172b68c},{0x020111c8,0x73c59f7e},{0x03a02ce1,0x8033dc88},
+{0x0200071b,0x75e8e17f},{0x02a10437,0xb53ad125},{0x03c024aa,0xf70120b9},{0x02801572,0x065d7e84},
+{0x03002a95,0xe12b4dbc},{0x02401180,0xc60450af},{0x02e1456a,0x7943b92a},{0x03c01d3b,0x61f53e38},
+{0x0201173b,0x1cc39930},{0x02c16943,0x8c07aded},{0x0300040a,0x0f9b15ef},{0x02c024f8,0xb2a83cfd},
+{0x0380233e,0xe425363e},{0x01e1067b,0x4f2b0afa},{0x01a0a567,0x0f287a12},{0x03e18c03,0x8ca488fa},
+{0x0360abe9,0x408ccc55},{0x0121f354,0x2fff45c8},{0x02e144da,0x1a211e81},{0x02601555,0xf883deb5},
+{0x02401bbb,0x2cb40c75},{0x02c133b5,0x89139530},{0x02e132e2,0xee927a73},{0x02a005b1,0x8cbaa8d0},
+{0x01e116b4,0xa91bd6e3},{0x0361690f,0xf7ba64ac},{0x02601346,0xb68e893f},{0x02418963,0xb588b77b},
+{0x0101f4ca,0x5e1162de},{0x0521df09,0xa1db8b7c},{0x02200ccd,0x240e523c},{0x02802115,0x4ada876e},
+{0x0381d024,0xda7409b2},{0x01a0aa1c,0xa0286a9b},{0x0341032f,0xdfaedf02},{0x01c11726,0xce715363},
+{0x03a006bf,0xa7868c41},{0x0260fe0d,0xa79c851e},{0x02c13082,0x3821299e},{0x05a0fe42,0x12b46291},
+{0x026012fa,0xa22928eb},{0x01416a58,0x60091396},{0x01c1f10a,0xda61b00d},{0x0300329c,0x5b3c8587},
+{0x02e10414,0xe403e717},{0x0541d0ab,0xda3bc463},{0x03a02b62,0x7f3aff24},{0x02c019c2,0x375974c0},
+{0x03202aa5,0x4825d016},{0x02202384,0x691b790d},{0x028105ae,0x462fab9e},{0x03e18c97,0x788ea32f},
+{0x02e145a9,0x7436e558},{0x05a115d6,0x91b139ba},{0x01e00cac,0x093101ee},{0x0321e135,0xfeb07cc0},
+{0x0181faa1,0x42a28265},{0x01a0a45d,0x62349a7c},{0x01a031cb,0x5fb774a1},{0x03216977,0xf79e4477},
+{0x0461da6f,0x9dada4e2},{0x02e133a5,0xe9c4acd0},{0x03a02c15,0x5f222532},{0x04001d82,0x0408ca10},
+{0x030024de,0x45b69cb3},{0x0460fb2d,0x7cd17ec2},{0x026124dd,0x97bc1598},{0x01c0a5d9,0x64c98464},
+{0x01a0a4bf,0x524d5a94},{0x0581d95e,0x9fd6ac0b},{0x0261b039,0x4e5f33e5},{0x01c01804,0xf4efda12},
+{0x024014a1,0xb34bf3bd},{0x02418854,0xed6b5e32},{0x0541df0a,0xeb2f8fac},{0x02c1309a,0x3e25b03e},
+{0x022019d2,0xa7404200},{0x0241134c,0x93507450},{0x0221fbf2,0x25938e7a},{0x0201149d,0x1418e743},
+{0x0221e92d,0x05e36144},{0x0440252a,0x655249ab},{0x0321f789,0x1d8b9dc4},{0x01e00f21,0x41188ed1},
+{0x03e18b1e,0xfcd213b6},{0x02c1682f,0x5267ad66},{0x02418aa5,0x459cf860},{0x02a028c2,0xb1a66cf1},
+{0x01602650,0x491e5be9},{0x01e00f0d,0xcd0aa8d9},{0x01a1162f,0xb68e5269},{0x01e01bf3,0x0c75d88d},
+{0x0260a822,0x77612cbb},{0x0601d095,0x83e8c925},{0x03202e5b,0x3a00c596},{0x01a0a6db,0x5b4e91e0},
+{0x0140330a,0x5f2c5212},{0x032100f3,0xc063643f},{0x0521d7c2,0x4668802a},{0x02c1f06f,0x0b14f47b},
+{0x04010b3a,0x3831c5ee},{0x042027b7,0x81f9eb5a},{0x03010d33,0xff4ee678},{0x01c01021,0x431a4e0b},
+{0x03c1d17c,0x532cfc57},{0x02200cc6,0x1c3aecfc},{0x0701d9ce,0xe15caecc},{0x02000cea,0x813a7384},
+{0x02e01876,0xda439efc},{0x02e131c4,0x80876f09},{0x0241892d,0x9f7bc8e6},{0x0260142b,0xd38165df},
+{0x03403241,0x30209ee6},{0x0181142c,0x0415ef45},{0x03200613,0x026da3cc},{0x02e1d33f,0xd2e5808f},
+{0x01e16f39,0xccd5b0df},{0x01e11c89,0xb9918f81},{0x03e002f2,0xb40c37b7},{0x03004df9,0xedaeea40},
+{0x02c13260,0x80adbaf5},{0x02e13192,0x15f0ceb2},{0x03400945,0x1dabac9d},{0x02c1fa28,0x86d699cb},
+{0x0201060b,0x982fe2d3},{0x0601d9a7,0xbf74779f},{0x02a0095c,0x588fcc82},{0x026e012b,0x1da3faa5},
+{0x02610f0e,0xb987a43a},{0x02610874,0x090846c6},{0x01c01802,0x4f1311fe},{0x0321f6ea,0xbf73422d},
+{0x02e00194,0xb33d4150},{0x0600fbf0,0x5b58db98},{0x0320ff9b,0xd6a81545},{0x0240a62a,0xcae271ff},
+{0x01c017cf,0xb0e1f3f8},{0x0101f5c9,0x02d8388e},{0x022013ca,0x69aa2e1a},{0x02411608,0x7fd6f801},
+{0x0380ff24,0x45ecc946},{0x024188ae,0x00db99a2},{0x024010e9,0xbb52dfc3},{0x02202d63,0x0f0a8937},
+{0x02a169e7,0xc24ff035},{0x03810f47,0xa21e0b5d},{0x03c1d8b3,0xd2ce711e},{0x04201880,0xd947ab57},
+{0x028e0161,0x8371a06b},{0x03014505,0x840a6904},{0x0340ff52,0xfbe0cbf1},{0x03e1d582,0x72f51148},
+{0x01c0a079,0xda75b16e},{0x01c0a50c,0x57b41b15},{0x02402fc6,0x4095cc5c},{0x02810e72,0x78536463},
+{0x01c0a126,0x889836c7},{0x02418a88,0xc6a47f38},{0x032028fe,0xcbe066b9},{0x0581d9b0,0xaeaac57e},
+{0x0400fdf6,0x9bee0117},{0x0380159f,0x0700682d},{0x024189d9,0x1fc39c06},{0x0200a865,0x7a219e62},
+{0x02801d58,0x6b8c81b6},{0x02e1f500,0xf55f576a},{0x03a00112,0x8b02058c},{0x0641d9ab,0xd658539d},
+{0x0261fb97,0xaccc0081},{0x01e01730,0x6a7bc691},{0x02a1ee08,0x693cebaa},{0x01c01c03,0x54320ae0},
+{0x02011157,0x06b9c654},{0x0201d2e0,0x655aca47},{0x030120e8,0x2da3cd7f},{0x01811427,0x643d95d5},
+{0x02c13077,0x3a236b5b},{0x0261b02d,0xcd4663ec},{0x0360fed1,0x7b37d7f5},{0x02c168db,0x0b13c66b},
+{0x01c0a39b,0xfeaf52a6},{0x03601660,0x1cb591ac},{0x02210350,0x9108d8c7},{0x02ae005d,0x8f497dfc},
+{0x0260105b,0xf502b22b},{0x02e14524,0x83b3e66f},{0x0580fd5d,0x68226891},{0x02610a22,0x75308ae7},
+{0x0460fc8b,0xb525a6b2},{0x05c01fa0,0xa3d616cd},{0x02400afc,0xf093d658},{0x01e1fb31,0xd2c9ab77},
+{0x0180a027,0x4458eacc},{0x0241883d,0x008e0e5d},{0x02010470,0x7084363f},{0x0240a76d,0x177258e0},
+{0x04401cc5,0xa08a3600},{0x02c169af,0x51d07e85},{0x0161f935,0x1fb193e9},{0x03e18b63,0x9ecac3f7},
+{0x0440fb9e,0x973060ab},{0x034014d1,0xc93a778f},{0x02e109ac,0xa9c4ed87},{0x028e0156,0x806f5d1b},
+{0x03a01b3b,0x66b05012},{0x01c110a7,0xa460a7c1},{0x03a00110,0x38e89d49},{0x01602b92,0xaa5d2df2},
+{0x02e14583,0x7234a39b},{0x02c0313c,0x0b7b685c},{0x02a16902,0xb386a4d5},{0x02c1318e,0x032c5c36},
+{0x02400a41,0x725d0a38},{0x02400f7d,0xb0fd4278},{0x0220a9c4,0x046334ac},{0x02c00e2f,0x59786906},
+{0x02e132b4,0x6e890d38},{0x024188be,0x10fe4514},{0x03e18b06,0x09cfe996},{0x03e18c2c,0x0c9f424c},
+{0x03c01c88,0x7071a876},{0x00c026b4,0xf78750d6},{0x01a102b2,0xd6f0d1da},{0x01e1e2e4,0xf078dce5},
+{0x0341d6d4,0xeca5aa70},{0x02c1ee0e,0x326654aa},{0x03002244,0x5da93caa},{0x0220231f,0xc5f99e65},
+{0x0381d1e2,0x791b6dac},{0x02a1ee13,0xcbd7a0c8},{0x03802233,0x7ba15ca9},{0x0241b006,0x63feb57d},
+{0x020013cf,0x90252951},{0x0301251b,0x1de47198},{0x01e10705,0xf4674b03},{0x05c1fa3a,0xff7c2bde},
+{0x01e108ec,0x88509e50},{0x02c1f090,0x8c7d8e50},{0x02e13238,0x6a723fcd},{0x03c02a30,0x057118c6},
+{0x02201b1c,0x6f1ae11a},{0x0641fb57,0x4fdf24f0},{0x03e1d00a,0x0103750e},{0x03e0027b,0x5d2cda33},
+{0x0260abed,0xcd25de9d},{0x05c1d963,0x40b07a29},{0x02616961,0x1c77ddbb},{0x03e0ab4c,0x54bcdf65},
+{0x02418aab,0x439ab6a3},{0x01a022c1,0x3b3842b1},{0x01e1fb23,0x9bae843f},{0x0220a886,0xe3bfb0e6},
+{0x02201a2d,0x0de29f0d},{0x0181f6e4,0x16d7bf3f},{0x03e0fb29,0x09753d34},{0x02e14539,0x07aea60d},
+{0x03202b13,0x9ae362f3},{0x032016be,0x5a1ec106},{0x03602c3c,0xf8dabbd3},{0x01602592,0x13bb6f17},
+{0x02418a1c,0xb03d9699},{0x0260aa8b,0xe47e49f3},{0x01a0a1b7,0x478c9670},{0x02c130ef,0x11d288e9},
+{0x024188fd,0x921aa172},{0x02601387,0x196e02ea},{0x03c0ab47,0xeed2ef48},{0x01c03161,0x1f19f566},
+{0x0281f552,0xcb650a89},{0x02418939,0x277edd95},{0x02601dc2,0x36d95808},{0x02e168a1,0xe59f73e7},
+{0x038000c0,0x5dfa65b3},{0x0381079b,0xdb7c2210},{0x02a02ca2,0x578204fe},{0x02812fd5,0x9d0fb68c},
+{0x02418a7e,0xcea6ca67},{0x0381e8c0,0x41445b45},{0x02010e9e,0xd75f7929},{0x03e18c7e,0x5692ead7},
+{0x03800350,0x7242e2e1},{0x01211641,0x13198502},{0x02e1460d,0x7e013497},{0x0341d185,0x744a03c9},
+{0x024114be,0x5bc0c8ee},{0x02802d94,0x62fe27d6},{0x036002c2,0xba2f1eb4},{0x02e13421,0xaacf1c1f},
+{0x02c132df,0xcd4ab7c2},{0x016007cb,0x67462519},{0x02c1333f,0xcdba1df6},{0x028187f4,0xea89d905},
+{0x02c10419,0x8dc09744},{0x02000d0e,0x3e36a933},{0x0220a95f,0x254645c0},{0x026012b2,0xd337d439},
+{0x026014ed,0x18b7ec78},{0x0220168e,0x4b99d412},{0x0340fb8f,0x2645502c},{0x03002c46,0x3248569a},
+{0x0061f466,0xf67c00e5},{0x02e145de,0x7cf46711},{0x04e1d7bd,0xd9789833},{0x0320ff80,0x3cb62d61},
+{0x02803027,0x23a635c8},{0x0181f5c7,0x8afe735b},{0x02a1f785,0xaaf9355a},{0x02410888,0xfdefb42b},
+{0x0641d934,0x981e5b3a},{0x01c0a60a,0x9ea50ed9},{0x0261b041,0xb2d729ef},{0x04a02ba8,0x844c8510},
+{0x01802e0b,0xba9f6d06},{0x03400329,0x6803118e},{0x028e01e2,0x9be1e3ba},{0x0221bc2c,0xc1189f81},
+{0x018016b5,0x7b25274f},{0x012033d9,0xce8aac21},{0x0380ff27,0x44ecc7b3},{0x02e11a31,0x1433a781},
+{0x02a031fc,0x874a0507},{0x0481d72a,0xe00d3e55},{0x02c13189,0x072c6282},{0x02801c2f,0x656bd608},
+{0x02418829,0xf08977ff},{0x02412036,0xefa50fc7},{0x02c029ef,0xd717f613},{0x03a02cbf,0x71b4902a},
+{0x016020af,0x601dfea6},{0x028e019f,0x05636287},{0x034121ea,0x185fbdcd},{0x01a0a1d5,0x93b41d84},
+{0x02c118f1,0xbd0420a3},{0x0301d413,0xbc4d034a},{0x028e006a,0x7bc230b8},{0x05a1d79e,0xb8f8c01b},
+{0x0561cfa6,0x9c6da675},{0x02a16962,0x2a8f1a8c},{0x02e1f015,0x9c94c843},{0x0361f750,0x8c71dad0},
+{0x0381e88a,0x99bb6504},{0x02816854,0x5977e2e0},{0x02e028bc,0xd4768328},{0x0680087e,0x2b382aca},
+{0x02001a12,0xbb0f2a1a},{0x0481d072,0x933c271b},{0x02a104b4,0x936dcffd},{0x03001d07,0xffb8bc57},
+{0x05002760,0x52aafd59},{0x0521243a,0xeef21fe5},{0x0381d050,0x4e5f3c29},{0x02e1691a,0x1a9e610a},
+{0x0601fba1,0x54c133bb},{0x02c1224a,0x0a7a9988},{0x022023ff,0x7147e6dc},{0x02210342,0x0d9b25f2},
+{0x02c0abae,0xb34ad05b},{0x01e0a51c,0xee2c2e15},{0x028104e5,0xb0ac6e48},{0x02800802,0x62ccea57},
+{0x01c00b25,0xa3e0bbfc},{0x03c00dad,0x9ff35fb2},{0x02200aeb,0xe9344f9b},{0x03c1cf33,0x41056792},
+{0x0380fb72,0xb8ef5e02},{0x0340160c,0x1738b3c2},{0x03c1d481,0xe822f1c4},{0x01a11455,0x2c0fcfc5},
+{0x01e00b3f,0xced39122},{0x034015ca,0xcb6c1781},{0x0201116c,0x0aa034ba},{0x05801dd3,0x7e63c1df},
+{0x0400135e,0xdeedbd2e},{0x02201a02,0x86e48a05},{0x024112c6,0x64b2adf8},{0x04a0fcce,0x5be5e7b7},
+{0x01816f0a,0xc59d3b00},{0x0180a4e2,0x4ab3c316},{0x02c1d424,0xce97d4a6},{0x0220224f,0x172c6d9a},
+{0x022108e2,0x9fc14f5f},{0x01a1169d,0xd5ed8dc3},{0x02c16846,0xc79e6354},{0x026111df,0x1356ceff},
+{0x03010d25,0xece577bd},{0x03a02c12,0xd18d5d1a},{0x0380ff2a,0x4fecd904},{0x04a0fcac,0x14b8ddf8},
+{0x03e18c99,0x7e8eaca1},{0x01a0aa1b,0xd03c3de3},{0x01402b90,0xc1606716},{0x032010b6,0x1baebe59},
+{0x0921fbab,0x9d135337},{0x04c1d81d,0xef92ba05},{0x02c019e8,0xd26e5889},{0x01c02659,0x28f78a74},
+{0x0161f4f1,0xbf849795},{0x03001d78,0xcf973182},{0x0581d8da,0x76e84dba},{0x010026f0,0x9fe41de2},
+{0x02816969,0xb89067f0},{0x024029c1,0x81acae74},{0x0280ab2b,0x9049534a},{0x02e133fd,0x96e4f702},
+{0x0280a81a,0x5aa90397},{0x0601d9e5,0x4603cb31},{0x04e0293f,0xa09f0ac7},{0x0300a77a,0x8317839a},
+{0x03802e56,0xc350a25e},{0x03200fa2,0x6f2e27b8},{0x0200072b,0x04fda6b0},{0x01c026ed,0x69e69ab5},
+{0x0261b035,0x4c6e3b49},{0x03410a6e,0xc00663c8},{0x0261b09c,0xf6e5deb4},{0x02a1f47d,0xca41ecad},
+{0x026100a6,0xd0476188},{0x02210348,0xdea8891a},{0x0301103f,0xea122f9f},{0x01e10b1b,0xa929d0ee},
+{0x0481f722,0x0a3d3b05},{0x0360a741,0xf8aeb93d},{0x02c02b23,0xcd1ee08c},{0x0280326e,0xb0ba9cd1},
+{0x02e16e75,0x65d45703},{0x03a10f4e,0xcd30c16c},{0x03600db3,0x8b83603d},{0x0381da51,0x1edb0793},
+{0x03a1e01b,0x39cdd344},{0x02212042,0xbbbe974b},{0x02c130e9,0x14d28da2},{0x02a00263,0x708d8639},
+{0x01a0a470,0xa05c0b86},{0x04802930,0xc610f44d},{0x01e1067a,0x502b0c8d},{0x02c13337,0x4db715df},
+{0x0320a79b,0xf90b160e},{0x0241f941,0xece6a990},{0x02e14499,0x9c0a91d8},{0x01e00021,0x2e0ce0c7},
+{0x0561f823,0x05099ee1},{0x02c0288d,0xb3cccb5c},{0x01a0a61f,0x43fd3f43},{0x02a1ee11,0x6cffc5a7},
+{0x02e1f6e8,0xf03a2d9b},{0x02c00294,0x4ba4522a},{0x0201119f,0xa5c61f5a},{0x02800dc6,0x1cc7220d},
+{0x03e18b55,0x9cc8823a},{0x06802ff3,0x8a8cd8bc},{0x0200a582,0x228e41bf},{0x02a168d7,0x5dde8709},
+{0x02602dae,0x9c8b3b3b},{0x02600a4b,0x7f8f7e3b},{0x01c00c68,0x32f71f20},{0x01a0a92a,0x15c69df4},
+{0x01e0a09e,0xe7afdb54},{0x04e01ce1,0x31da77bc},{0x00a1f3e8,0x60df45fd},{0x04c0fd30,0xe53573cd},
+{0x0200073b,0x27f31c56},{0x0660fbea,0x988ee399},{0x02c13039,0xfa135248},{0x0201221c,0x7a487b91},
+{0x046002eb,0x3140df34},{0x03e1d584,0x70f50e22},{0x0381d8b8,0x755483d7},{0x03801ba9,0x57773f0b},
+{0x01e0318c,0x8f9e7b91},{0x02400d23,0x57cf1be3},{0x030011b9,0x4aa32e8f},{0x0280198d,0x9e1a4b07},
+{0x02e10892,0xd1de40c7},{0x02601077,0x7797ad5c},{0x03c1252b,0xacbbab84},{0x02003121,0x7f8b57f0},
+{0x03011070,0xa5c7a2a5},{0x0480fcf6,0xa15dcaa4},{0x03e18be4,0x1edddf5d},{0x0381ec8f,0x375e4228},
+{0x0121fab3,0xa2d27b76},{0x02e1229d,0x7e87a317},{0x02c13046,0x7f18a0d5},{0x020116af,0xc4e1cc14},
+{0x02801214,0x04421b66},{0x02e1324d,0xd47763d9},{0x03002b30,0x19f5aab8},{0x02810a06,0x222865e5},
+{0x03e021cf,0x885f4d46},{0x0280261d,0xde83f99b},{0x03212151,0x37e44089},{0x0241886a,0xfee8626f},
+{0x02610f0d,0x54744fb2},{0x01c1e954,0x33f06b8f},{0x03c1d471,0xf8230af4},{0x01c0aa2f,0x42c0ec65},
+{0x0261b040,0xb3d72b82},{0x0161fa74,0x51d10a62},{0x0461d888,0x17fc2413},{0x0201159a,0x3237a738},
+{0x038008a6,0x23d55c61},{0x0480fd34,0xda73ea72},{0x03400364,0x241b5bdf},{0x03c02a59,0xa2b35e78},
+{0x02c10043,0x1ec36634},{0x02001b88,0x145ca202},{0x01e017d1,0x45c6a1cd},{0x02a169bc,0x57d28c4f},
+{0x026014d3,0x086bf2ff},{0x03200839,0x3b17328f},{0x0340ff48,0x01e0d563},{0x0521f828,0xa1db3402},
+{0x030020dd,0x1e13130d},{0x028005df,0xbb3ff263},{0x03410a58,0xb95e64db},{0x02e1d369,0xce67db2a},
+{0x02e145c8,0x77efe204},{0x02602a1b,0x9680de3c},{0x03610377,0x9e0b6f48},{0x0240a8d2,0x567d4fe6},
+{0x01c00b2b,0x073060e0},{0x020008e4,0x628d93c6},{0x02212240,0xf077b67d},{0x0081f4dd,0x49a26683},
+{0x04a02347,0xc0065847},{0x05e1d98b,0x542207cc},{0x02e0a68f,0xa5ceedde},{0x0341f524,0xa9b81079},
+{0x02a1002d,0x72f276d4},{0x0140230b,0xea4970fd},{0x02200d2e,0x121fc83e},{0x0280abcb,0x2bc8f88c},
+{0x02e017a5,0xa06be253},{0x0281d113,0xe9bc144d},{0x00a1f9ac,0x860c5ce0},{0x0440fd18,0xe45f7897},
+{0x01811644,0xa4695135},{0x03200276,0xbdc131e0},{0x030029d2,0xc0335095},{0x0220a86a,0xcdf7bab6},
+{0x02e16b39,0x8d474085},{0x0441d0d9,0x793f67f1},{0x0241892c,0x9e7bc753},{0x01a0a602,0xdb03575d},
+{0x02a028e0,0xee42a935},{0x02c1f077,0x4517f203},{0x02000c46,0xd24780fe},{0x01e0262d,0x98c74aa1},
+{0x024122d6,0xb77bb8b1},{0x02e00324,0xd200e5ff},{0x03401146,0x7b0a7631},{0x030028e7,0xeaa097c5},
+{0x02418944,0x26811a99},{0x0180a4ad,0x97451d21},{0x02812fa8,0x95fe6266},{0x01e11441,0x5fb2319a},
+{0x02418a54,0x32499c32},{0x01811682,0x6950ac55},{0x03a0fd4f,0xeb51dc01},{0x03e18bb1,0x19eaa371},
+{0x0621d9b6,0x3b29c5bf},{0x0261b04e,0xc3b92f9e},{0x01a0a36f,0xc54d490f},{0x02c13261,0xedb0a523},
+{0x02e1cf5b,0xcb35277a},{0x0340a99c,0xde06ceca},{0x038015bc,0x03b80823},{0x0261b0b8,0xa05a659e},
+{0x032014f3,0xca4b4c07},{0x03a024ee,0x074346ab},{0x01c0a47c,0x434a3536},{0x01a0a5a9,0xeaec173e},
+{0x02a0aba6,0x45186187},{0x0120fe45,0x10865536},{0x03a0fa99,0x314a87a5},{0x028012fc,0xd4c1dd2e},
+{0x0320fb39,0xdc5f2bd2},{0x03c01d1a,0x90042dbc},{0x032023d4,0xb519f0ed},{0x01e11025,0x536861fd},
+{0x0300a793,0x61ae0f7a},{0x012022d4,0x802a568d},{0x02a02749,0xd99f44bc},{0x04412255,0xa186c232},
+{0x04a1d66f,0x261aecb3},{0x0440fc6b,0x0f414731},{0x02e16e79,0x58d4428c},{0x0220005b,0x9ad13001},
+{0x01c102c7,0x291c82bb},{0x02e14428,0x29800a84},{0x024012da,0x250dee6d},{0x02a00e1a,0x5d39d9b4},
+{0x0501d0b1,0x6a7ed52f},{0x01c007a0,0x62b3b483},{0x04002342,0x4cd40726},{0x026017d3,0x27f9e96d},
+{0x01003373,0x5da5c7b0},{0x00a1f9e6,0x06db8ff2},{0x03c10790,0x6ce789e2},{0x0381ec85,0xc8f2b7fe},
+{0x036118a0,0x8c285e25},{0x01e0a5ed,0xead0a1bf},{0x01e1110e,0xe34a2918},{0x01c0194a,0x538b6b71},
+{0x0320a872,0xd3eb14f7},{0x02e1451b,0xfeb0d679},{0x02400f89,0x08d9f686},{0x02418aeb,0x590d33d0},
+{0x0401f71f,0xe86149d9},{0x02c1318f,0x042c5dc9},{0x01c0a58f,0xace4fa0a},{0x0240092f,0xfc75908d},
+{0x02001c2c,0xe7e51d4b},{0x01e0a56c,0x8549ed38},{0x01e11583,0xcd1cfbcb},{0x03002cc0,0x23ac6fe7},
+{0x01e0168f,0xb54e533e},{0x01a00ec9,0x3ec9c355},{0x0781d9e7,0xdf6adf31},{0x02011336,0x8971456c},
+{0x0161f6c5,0x1b6853c0},{0x02412107,0x34617456},{0x02e00422,0xa81d604b},{0x026014c2,0xd870249d},
+{0x03200692,0xe0312417},{0x02012156,0xf8b54c5c},{0x02e00185,0xa17f2020},{0x0141f34f,0xa8cd10c4},
+{0x02811d52,0xdb43ccbd},{0x01a1f311,0x414c8308},{0x032118d3,0xe95fac91},{0x01e03111,0x94fa1a5b},
+{0x0240183f,0xaa2e5116},{0x02e1313a,0xbdae0010},{0x02011a66,0x5a7ed188},{0x032025c1,0x35c45b1d},
+{0x01c1f340,0x0be00fe8},{0x020115a5,0x7b4ac90e},{0x0280a9e1,0xda575976},{0x04c1ed3b,0x0dfe4e86},
+{0x0641d9d0,0xd8175b44},{0x01a00b88,0x9539dd2a},{0x02c132ed,0x564340a8},{0x0661d1c8,0x941adefa},
+{0x02e1442b,0x196ea833},{0x01c02057,0x41bee96d},{0x02e145b7,0xf52ae478},{0x03e1d7e5,0xff517584},
+{0x05e1f832,0xdad33b9d},{0x03202c32,0xdf8e9d71},{0x01a0a547,0xef1dba56},{0x024188b5,0x09fbfb78},
+{0x0180a4ac,0xe2337b6c},{0x02c16a1a,0x1f80e1eb},{0x010007f8,0x43f5f102},{0x04402556,0x021ef560},
+{0x0620fc5b,0xc92ab7d0},{0x04a0027f,0xff8b7319},{0x036008a5,0xcb74fc17},{0x026026c8,0xb9cb7cc9},
+{0x0221f023,0xeadb15ba},{0x02610f71,0x55529b01},{0x01c1f5af,0x1492317a},{0x0261b030,0xca465f33},
+{0x02402ebb,0x6b0feecf},{0x0441da0b,0xfb9c4075},{0x03e120db,0x3d92dc29},{0x03e124ae,0xd6557046},
+{0x03402426,0xc24e47d4},{0x038027e8,0x38179639},{0x0201bc53,0x85acff6c},{0x0220a9d5,0xa208223d},
+{0x02402f6d,0xea61ce0a},{0x02e168cc,0x13e76b22},{0x03801ef2,0x851f747b},{0x0260a9c7,0x0d2e0390},
+{0x0401d0e6,0x39c65c77},{0x01c10e95,0x38514096},{0x01403342,0xef90005a},{0x03801a55,0x94dd8014},
+{0x02c130a3,0xb22d229f},{0x02000a0f,0xcdf94011},{0x03200342,0xf2946934},{0x0261f9bc,0x18977e68},
+{0x01e030a8,0xb13c484e},{0x01e009aa,0xef667a8e},{0x0260fe09,0xab9c8b6a},{0x0320329f,0x8d30023c},
+{0x028e01c0,0x09d80388},{0x0300313e,0x793b6426},{0x01e00c8a,0xfd16ab8d},{0x0381ec94,0x96de76f0},
+{0x01e16f6e,0x07d7b147},{0x03e18c43,0xf49a9f56},{0x054027e3,0xd67bce28},{0x01603345,0xa00f3833},
+{0x02a10896,0xa7b0c763},{0x02011a6c,0x82c43504},{0x02c1f0d5,0x38ef7b47},{0x02401230,0xf12362e0},
+{0x02e14603,0x77feec8e},{0x02e01ab3,0xc02d8861},{0x02c1f593,0x7d184983},{0x0581d9ae,0x88f01539},
+{0x0301442c,0x7b332b76},{0x03a011d3,0xe4e15f2c},{0x03802b68,0xfe8fd71d},{0x03200256,0xe78f5c4e},
+{0x02000bcc,0x73fab33e},{0x03602c45,0x7acd9151},{0x02a021e2,0xb7b905be},{0x0300219a,0x1a035634},
+{0x03c1ed20,0x0020b8f5},{0x02418906,0xa51880c4},{0x02812fea,0x2e64e1d9},{0x0481d06d,0x7dc81644},
+{0x01c0a3e9,0xf93e9cad},{0x01c0a3ca,0xf8a683a5},{0x02812fc4,0x29f6fc9d},{0x0260152a,0x129fde20},
+{0x03e18c2d,0x0b9f40b9},{0x02000999,0xf3d88f45},{0x0160232c,0x2cad3fb8},{0x04201acd,0xc1939660},
+{0x02e1680d,0x4ee06bc7},{0x0321d204,0x5c73c7c1},{0x0241031c,0x442719d0},{0x02202f49,0x8038c49c},
+{0x02c016e8,0xf370c72b},{0x0381ee1c,0xd1f8a59c},{0x036008c2,0x7a3b898d},{0x03000549,0x0aa2dc84},
+{0x02c11da8,0x6c92130e},{0x02800331,0xdfc799bc},{0x01c0a218,0xd187a0cf},{0x03a00dd1,0x02e18ac9},
+{0x020030b6,0x70b22b5a},{0x01602330,0x2bc26436},{0x02e1455f,0xe83c1922},{0x03a0a740,0x48ef53c4},
+{0x032100ee,0x4c6afc68},{0x0781fba6,0x894a72d1},{0x04402c59,0xb242ea48},{0x022110b6,0x73f2bce3},
+{0x01a0a2c4,0xba467bf9},{0x05411a36,0xac28d43a},{0x02c11d2f,0x2d5a4cf2},{0x0221f44f,0xb827db02},
+{0x01c0a44b,0x06842c1b},{0x02e0141d,0xd8f49f95},{0x03010bac,0x36c2ed82},{0x0241d1d3,0x3e6e434e},
+{0x048120ca,0x9c73d0c9},{0x0361054e,0x1d1f57e0},{0x036008b4,0x68fb315d},{0x03e00709,0xb6a8606d},
+{0x03e18b2c,0xa6d55deb},{0x01a0a108,0xfaae3e04},{0x032168f9,0xcf6eea8b},{0x026e0151,0xa388f71a},
+{0x02e02686,0xe5766409},{0x0341d214,0x824609ff},{0x03800dd2,0x5e767544},{0x0340fe70,0xcfd0c7af},
+{0x01c1121b,0xdede7748},{0x072029ae,0x3803bc0e},{0x02202f01,0x0273271b},{0x020013bb,0xec0327e3},
+{0x0421d067,0x2363d296},{0x03e12203,0x6b7e2a9d},{0x02ce0052,0x813c858d},{0x0441f152,0xdc4f4365},
+{0x0320035c,0x6896476b},{0x0400ab3a,0x51285e3e},{0x02401a63,0xeb750f43},{0x028108a9,0x7dac5b4d},
+{0x04201068,0xfffef41f},{0x02411c5a,0x673b5e75},{0x03c029de,0xf89453cc},{0x044109e9,0x77d9c786},
+{0x03600677,0x8956131c},{0x02a03291,0xe4d221f8},{0x02811d73,0x02866291},{0x03014574,0xdffd448b},
+{0x026012cb,0xb88d0e9f},{0x01a11710,0x1e7b7f8c},{0x0201bc30,0x3ed9af45},{0x026021e4,0xcbb42d86},
+{0x02e13262,0x8f145946},{0x02010631,0x1c262543},{0x03c1d8a0,0xbacf7fc9},{0x04a0fc17,0x2186d50f},
+{0x02810358,0x471556fa},{0x06e029ac,0xfb9c8a1b},{0x026124e0,0x74383940},{0x02a02178,0x8727b271},
+{0x0520049c,0x5575e5be},{0x03e18ca5,0x098cebad},{0x04602baa,0x68b09815},{0x032011f7,0xe1d40f7c},
+{0x04802039,0x2f711258},{0x03e1d80d,0xd386531a},{0x05601ec3,0xd664f76e},{0x01a0a31f,0x93c40e8d},
+{0x024122b8,0x715f39e2},{0x07402a93,0xcd188525},{0x02600a3e,0x79a90caf},{0x01c00c38,0x34611675},
+{0x020122e7,0x5b1a44a7},{0x0341da2d,0x1111da44},{0x01a0a02c,0x743a5faa},{0x026e0108,0xa89a481a},
+{0x02c13037,0xf8134f22},{0x00c1f380,0xa51b3ae9},{0x0180003f,0xa57ae9e0},{0x0241f611,0x9695e157},
+{0x0301446d,0xf74a22c4},{0x01a0aa0f,0xa4ac2e29},{0x01c0a403,0x5d94daf0},{0x01211350,0x5b0c8b86},
+{0x01a11707,0xd0e0e447},{0x024189cf,0x2dc5f0a7},{0x02601273,0xc49fe86a},{0x0261b0bf,0x20733404},
+{0x04e0049d,0x747ad0e5},{0x026e012f,0x19a3f459},{0x01e106c6,0xbfb88468},{0x02e16e70,0x56d43f66},
+{0x01e02075,0xc76c59cf},{0x03410fb1,0xd2812513},{0x02a00e03,0xfca036b9},{0x02c0fbc2,0x43d42f7e},
+{0x00c1f933,0x1519d80d},{0x02e0fb4d,0xa43e0fa4},{0x02602c99,0xce02d654},{0x0501d901,0x33f581dd},
+{0x01e12129,0xa01be82f},{0x01c0a0a0,0x140431c3},{0x02810f70,0xd3e662dc},{0x00a026b6,0xe3b9adf6},
+{0x02602dc8,0xc7152f13},{0x01c0a55b,0x40383586},{0x02001dd1,0x684aaaaf},{0x01e00cae,0x192a5f59},
+{0x02a0280d,0x3b13908c},{0x04601eee,0xc65a3dfa},{0x02802888,0x95954eac},{0x0541f61d,0x1ce8ab46},
+{0x02c1328e,0x00b77ed1},{0x01a01780,0x49141792},{0x02a0ab8c,0x1f2f7f04},{0x03211a15,0x3b8d9ba1},
+{0x0641d94e,0xa5cad160},{0x01a102ab,0xbcf0a8ec},{0x0280ab72,0xbdeefd6f},{0x0421f72d,0xf4853b0b},
+{0x01e11725,0x323eee92},{0x02a169cd,0x0fa789e5},{0x0261035e,0x2d1033b3},{0x0580fd6c,0x3dca2f39},
+{0x0381e889,0x3e6b39c9},{0x03211a32,0x4eea1e74},{0x01c0a2d9,0xca165ee2},{0x022032dc,0x5b1b8e19},
+{0x02802dbd,0xad3b0e8d},{0x0320144b,0xce4c5660},{0x02c1312d,0x7120938d},{0x02a169d4,0x6f18add5},
+{0x0220a994,0x3d90ad9a},{0x0340a7d5,0x3e3c9375},{0x02c00333,0xfe833630},{0x02602b07,0x4db21f38},
+{0x02a022cb,0x08233cbe},{0x032002a3,0x096bbbeb},{0x01a0a333,0xaebe28e0},{0x04a1d81a,0x499e13b9},
+{0x0381e10a,0xe6b73b8f},{0x03c1f21c,0xdc3f1a56},{0x02e14512,0x05b0e17e},{0x0241074a,0xb100b21f},
+{0x02e100d8,0x62387430},{0x01002711,0xbbb3c813},{0x03610c94,0xaaca9b75},{0x04c1d78a,0x5c0f554e},
+{0x02e10584,0x625261c0},{0x02401348,0x05032eb1},{0x02c13075,0x97969b38},{0x03011368,0x39c05a27},
+{0x0481f730,0xeaa336ce},{0x03e10b9b,0x49c12129},{0x0401f11c,0x2d3022ae},{0x03e1ed32,0x5cb797f9},
+{0x0521f794,0xf3e72fd0},{0x0421d0ca,0x0bedfe27},{0x02401199,0x007d9035},{0x0321f626,0x725c3437},
+{0x0101f34e,0xbdfaf4a4},{0x0421d223,0x5a72c4b7},{0x01c0260b,0xa378c78b},{0x0461d8eb,0xeb42cee3},
+{0x02418869,0xfde860dc},{0x03e0a749,0xe9b60a24},{0x04002783,0x99e6ee29},{0x01c0aab8,0x92058d28},
+{0x02a1e923,0xb34b7b56},{0x0201235a,0x237e9d68},{0x010022a3,0xe8420c55},{0x0321d200,0x6073ce0d},
+{0x03801c3e,0x63d40a30},{0x0340d7f1,0xee92d479},{0x01c029d7,0x05c2f35e},{0x02a11d7c,0xa622f5f8},
+{0x05601f36,0x406d94da},{0x0241f902,0x708fa949},{0x01e03128,0x98fa20a7},{0x02002b1c,0xafb31852},
+{0x01a0a3b4,0xbc7b58fd},{0x0381d6b1,0x0b02d375},{0x024188da,0x1f10f20d},{0x02a031f0,0x7f119fde},
+{0x02c1f0de,0x06bef722},{0x028119c3,0x5257bd0c},{0x03a1d5af,0x5e7bc2c3},{0x034002fb,0xba9497ed},
+{0x03a0293c,0x91cd47ad},{0x0160220f,0x6a7cb0f4},{0x030025d2,0xf734d156},{0x01c0a34e,0xcd9a46a6},
+{0x034121e1,0x0eb4b5ea},{0x03401de6,0x391b7cee},{0x02401cd3,0xcf05ebea},{0x02e144ec,0x88a7225b},
+{0x030003ec,0x6230e9db},{0x0340ff4d,0x04e0da1c},{0x020017c5,0x1cadc740},{0x02e1f57f,0xd62cd075},
+{0x05e1d9f1,0x7706c0e1},{0x02202e8e,0x4a143e14},{0x01c0a458,0x4a891455},{0x0280fe65,0x2dfe7000},
+{0x02c13060,0x0b9bcf02},{0x02c13044,0xff1598be},{0x02e11caf,0x754984f1},{0x02c1331a,0xfb0b0847},
+{0x0201122f,0x61fb2930},{0x02c131b4,0xd2f797b7},{0x02610909,0x0e2af3f9},{0x0241f0f1,0xd7703595},
+{0x02010f3a,0x3c6254f5},{0x0281f3be,0x84b49cb9},{0x04400525,0xffa2f485},{0x02c130f8,0x1bd4d73e},
+{0x02e14442,0x247336b2},{0x02e0ab4b,0x52abfe4b},{0x02e10123,0x102dac93},{0x050004b0,0xa4cb205d},
+{0x03c1ed2f,0x41fd8335},{0x02a1ec7e,0x41346c10},{0x03801fc1,0x147882d9},{0x024000e6,0xdd87184a},
+{0x030017b0,0xc3e8a906},{0x034015ec,0xeb67ccb3},{0x0261190f,0x7a0a4d48},{0x024189ee,0x9cdc65b3},
+{0x02604dd2,0x4dc980c5},{0x02a11add,0x4ec87e0c},{0x0201060a,0x9a2fe5f9},{0x01c020bb,0xe97434a4},
+{0x03e0038a,0x9051b44d},{0x02a0fe5a,0x42f357ee},{0x0341053b,0x3df9ec6e},{0x02c16950,0x5eb76217},
+{0x01a1168c,0x2a03d84e},{0x02603272,0xa28d785c},{0x0261b0e7,0xef7a0d86},{0x040008a2,0xf7eae221},
+{0x022023ae,0x77d65562},{0x01c1f381,0xa5e59341},{0x0280055e,0xc195e1d3},{0x020030dc,0x02eda858},
+{0x02c131db,0x52fcde65},{0x024115bb,0x8d999cf5},{0x02e1330a,0x08e200fb},{0x01e1f4c6,0xc6ef85c8},
+{0x024188d4,0x1510e24f},{0x0180aa27,0x2b4518a8},{0x030111b8,0x54028b50},{0x03e18b5b,0xe7c8f84b},
+{0x042025f7,0x7a014fe4},{0x034107b7,0x0ab405d9},{0x04a13433,0xd2fb135a},{0x03a024f3,0xad869cef},
+{0x024189c2,0x98be4a53},{0x02800430,0x2684ab16},{0x01e00780,0xa9d7dd28},{0x03801d27,0x27f98eef},
+{0x028032cf,0xa407c1e5},{0x0440020c,0x5c95f6e6},{0x04c0a70f,0x0aa88ed3},{0x03e1d010,0x9268be01},
+{0x02602da0,0x67e1a855},{0x02a04de5,0xcf4944c1},{0x01c0a431,0x65db0ff2},{0x0360a666,0xa7673fee},
+{0x0321238d,0x3e60d5a9},{0x03a1ec93,0x75111fb7},{0x0400fd4e,0xa5dd2855},{0x0300074d,0x4fc7bf43},
+{0x02002054,0x3730c610},{0x02e006b0,0x3beff13f},{0x01c16aa5,0xccf76c4b},{0x02210b24,0x1a2ca5d7},
+{0x03a0012a,0xac3e2f40},{0x02418ae6,0x640d4521},{0x01a1f4f3,0xfdfb2426},{0x00a02bf2,0x2f10a472},
+{0x03801380,0x0ea80a5a},{0x02a02f2d,0x9b0773ee},{0x0101f48e,0xd49eea99},{0x0361d019,0xa9a8fd01},
+{0x02200cc1,0x0c3ad3cc},{0x0401d065,0x9fa2008d},{0x02418871,0xfdea9f73},{0x01e0a16f,0xc70593c9},
+{0x02410a10,0xe21e1000},{0x0200a51f,0xe06ab8d3},{0x04a027ef,0xf6ab9a98},{0x03a1220b,0x55026be6},
+{0x0321d374,0xf6c1c3a5},{0x01c11810,0x01b0d666},{0x0620fc9b,0x10fa4c6f},{0x01c0a1b2,0xc44fd94e},
+{0x0361d518,0xf6bc287f},{0x02c1e900,0x691ba904},{0x02e145f9,0xf0fbd972},{0x0640fe3e,0x6a7962a2},
+{0x01e00c8f,0x4d3e38ed},{0x0361f899,0x75c63969},{0x020103bb,0xa6d8079e},{0x01811684,0x5d509971},
+{0x01c0a514,0xcd817513},{0x01e01c77,0xd29154db},{0x01e10684,0x4e37d55a},{0x0340a979,0xf3f0eb35},
+{0x03a1d16a,0x0deef206},{0x03a01fcb,0x1d7b49a2},{0x024189e5,0x9fdea903},{0x020008e5,0xa51d3bf6},
+{0x02802124,0x3eda748a},{0x03e18bba,0xc9ea2581},{0x01e0a155,0xf779748d},{0x034121d2,0x369aeb85},
+{0x0261fbbc,0x214ddfe1},{0x02a032a8,0x828aa8c4},{0x01e007ea,0x59677ee0},{0x01c1e2ca,0x8b417b30},
+{0x0381d48b,0xc02010f5},{0x04001d76,0xd657468f},{0x0500298e,0xc1c1db3e},{0x0200073a,0x27df2f26},
+{0x06e1d972,0xe23e1dca},{0x038016bc,0x0e5d77b9},{0x0301448c,0xc3463b2c},{0x0261b067,0x2b34b6c6},
+{0x0381daa4,0xb433d3ae},{0x0201061f,0xa92b8068},{0x02801cf4,0x6c4b4790},{0x01e023b3,0x8d50120f},
+{0x02c16a10,0x311d41ab},{0x0540fd1f,0xc20dc004},{0x0480fc40,0xe6891d3a},{0x04a0fc30,0x39196b66},
+{0x02811d25,0x7d698bda},{0x01a0a28d,0x9b52307e},{0x028e01bd,0x08d801f5},{0x03203216,0x4b5b0606},
+{0x020110b1,0xbf789ca0},{0x02210814,0xd5cb167f},{0x0200aa4a,0xe2c58f3c},{0x0261b0ae,0x2064297a},
+{0x0360fb8a,0x4680b399},{0x02a12531,0xdf500cda},{0x0341d187,0x19816b26},{0x01811610,0x77f64a5a},
+{0x0441f543,0x2f26a431},{0x0241da00,0xa2247f46},{0x03202ded,0x089dfefc},{0x04201ca8,0xe087b151},
+{0x0261f915,0x693dd834},{0x03a0149f,0x89e4d654},{0x01c00bb7,0xe95c2599},{0x03a1d58e,0xda916893},
+{0x01e115a8,0xc55fd520},{0x03401604,0xcb3a7ab5},{0x02816a12,0x7987dcad},{0x03202de1,0x46798fbd},
+{0x0280aa8d,0x2eda7a27},{0x02c130f6,0x19d4d418},{0x01800eca,0x3dd7d9cb},{0x02c1330d,0xfe0d4b97},
+{0x03e18c25,0x7a9fef76},{0x034029c4,0x483c1ffc},{0x01c0a541,0x62c9813e},{0x02011a60,0xd8e86195},
+{0x04e02944,0x32b7fc73},{0x04e1d849,0xf955816d},{0x04c1f795,0x035be4fc},{0x05801f07,0xfb551272},
+{0x02600041,0x71152d2e},{0x02418806,0x7b7fc574},{0x05002a80,0x6a9e1e88},{0x04201ca6,0xd971517d},
+{0x03216e4d,0x5c853ba6},{0x0241895f,0xb988bdc7},{0x03810989,0x6a045ec6},{0x04413431,0x1e44b63e},
+{0x01602669,0x1bdcd817},{0x03010091,0x09e88234},{0x01a0223e,0x5dc28c4b},{0x01a00bf5,0x23a9bd8c},
+{0x02c1f7b1,0x1573a26a},{0x02001c70,0x05f873a3},{0x02400a59,0xbfe59367},{0x0380a717,0xb9324d46},
+{0x03011a5a,0x91b0483c},{0x02200f5a,0x45ef2388},{0x03c1f1f5,0x9f242b7f},{0x02804dd0,0x32d444f4},
+{0x03810085,0xd93d80c5},{0x01e10683,0x4937cd7b},{0x0280abf9,0x3a814f46},{0x02602bb6,0xee0e68eb},
+{0x01e007a9,0x00cd308e},{0x036016bd,0x869debba},{0x0401d77c,0x22168f5e},{0x0260fe0c,0xaa9c89d7},
+{0x02010458,0xddd7f698},{0x024106a3,0xb0e36930},{0x02c169e1,0x789fdc07},{0x036021eb,0x2d91eb56},
+{0x0361ee99,0x6811c52f},{0x02c13219,0x73751b35},{0x030122c5,0x73db2a8a},{0x01a0a00c,0x20ebba75},
+{0x02401a6d,0xe7979b39},{0x02418ae8,0x660d4847},{0x01e1214e,0x481d9c3e},{0x03e1ee76,0xb19c8fc2},
+{0x01c11205,0xdae6bfc1},{0x02602da8,0x9a8b3815},{0x01e11052,0xf9c93d39},{0x03c1d7e6,0x362b4970},
+{0x01a0a1b3,0xa3994a62},{0x02401351,0x151cdfc7},{0x0141f517,0x904acf9d},{0x01002624,0x20065cf6},
+{0x034100cd,0xc1842595},{0x03a027ba,0x2d0278d2},{0x0301249f,0x46509490},{0x02c10047,0x805ffb2f},
+{0x0201132d,0x5ce22c17},{0x06e1fb51,0x1cee3f3e},{0x02418837,0xea872ff6},{0x01ee003f,0x6ce082f2},
+{0x01e11306,0xeab3116c},{0x03a029e5,0xcb1aa0c8},{0x0241227e,0xdf2fa6f6},{0x02e145cd,0x6cefd0b3},
+{0x02a1b165,0x8f4355da},{0x01c0a061,0xcb12a80a},{0x03210b8f,0x29c3cb82},{0x02e14528,0xfbac5492},
+{0x01c0a14a,0xb875dffe},{0x02e133ee,0xbd660c56},{0x0681fb49,0x986de3ac},{0x0320053c,0x888db0b0},
+{0x00e02214,0xc6470ae0},{0x03e1d56e,0x66f4fe64},{0x01802718,0x079b34d2},{0x02402c9f,0x79d6116f},
+{0x02c102ee,0x5ef3641b},{0x02c0a839,0x55a39301},{0x02010637,0x1d23e83f},{0x0241893d,0x2b7ee3e1},
+{0x02610906,0x04267f09},{0x05e1f501,0x4eff31e1},{0x04a1ee7c,0x5d1a6c7a},{0x0421eeb3,0xbe2367df},
+{0x0340d7f0,0xf57558d3},{0x04201e90,0x7a8f75c1},{0x01e11317,0x06a432f6},{0x0321d707,0x491f76e6},
+{0x02e029d1,0xa0e91d2e},{0x0200a86c,0xb3d95d10},{0x0361d69b,0x3e06edcf},{0x01e11634,0x11347d08},
+{0x02e1008a,0x3c7329bc},{0x0541d0ae,0x083dee85},{0x03616af3,0x550be336},{0x0261089b,0xfebaed78},
+{0x02401a29,0x5ff26c4b},{0x02e13426,0x1fd69013},{0x028018b8,0xde2f396f},{0x032118b5,0x16e8b209},
+{0x0101fa94,0x73e5d1ee},{0x01c02ee1,0x9af84427},{0x0480335a,0x00821f09},{0x02e10573,0xb657632a},
+{0x02e10d35,0x649f2ae0},{0x03e01fb1,0x2c9fd590},{0x03410846,0xd3f14b9f},{0x03810558,0x9264b8c1},
+{0x0420fd14,0xec2dd2c4},{0x03a16862,0xaba9008b},{0x0361053a,0xdafb8ee6},{0x02211233,0x7343c95b},
+{0x0360d7e9,0x75434a08},{0x02610897,0x192436f3},{0x0381bca0,0x2e093a42},{0x02600051,0x611513fe},
+{0x028e0198,0x766042d3},{0x02e1699c,0x58011c88},{0x0300fec2,0xdee7982c},{0x0561d95f,0xd4649713},
+{0x016029e1,0xe0bff196},{0x0381d85f,0x2978bfdd},{0x0201f58f,0x789ceb11},{0x02401a4c,0x1fe53b98},
+{0x0301da9d,0xa4d6aac4},{0x02602dce,0xd515451d},{0x03a0159d,0x67a45246},{0x0241882b,0xee8974d9},
+{0x01a0a52a,0xd2f201a4},{0x02e02401,0xbb9f6771},{0x04c0fc12,0x5e2a7780},{0x03401448,0x7dd74377},
+{0x032010b9,0x32e931e5},{0x03a1d05d,0xc1d815bb},{0x0300a75b,0x78a0e857},{0x030023f3,0x4cac8385},
+{0x03e000fb,0x7d6feafd},{0x0121f93d,0x5bee33c4},{0x02201a31,0xf1f17d83},{0x012033b2,0xdb96648d},
+{0x03816864,0xbce8940c},{0x0381bc78,0xd467b0da},{0x01a0231c,0xbd753fd8},{0x026124ab,0x18c4805a},
+{0x02c16932,0x7fadacf8},{0x02c13161,0x40bc1ccb},{0x02e1338e,0xff54b1eb},{0x01c0a1b0,0xd25a7cb4},
+{0x0381d85d,0x29f73af9},{0x03c018a5,0x20735d79},{0x04602b6c,0x2a73ced7},{0x00e1f98d,0x2f3b1645},
+{0x03000f90,0xf696c199},{0x02a02497,0x6931cbc9},{0x028e01dd,0x88d07cb0},{0x02418972,0xa68d1d0c},
+{0x02418a24,0xb83da331},{0x0361e84e,0x3d475d8b},{0x0321cf20,0xf043c444},{0x01a0a31e,0x87c3fba9},
+{0x02a03144,0x9b64f5e1},{0x0361d014,0x44f5a225},{0x0460feef,0x87feb176},{0x0340017a,0xbfbec56e},
+{0x0261b03f,0xb4d72d15},{0x02a02858,0x151789f4},{0x010033c5,0x82a184c1},{0x01e11835,0x6a7d8c35},
+{0x0381d4ed,0xcccfa0c4},{0x02400a20,0xfd621c7c},{0x03e18b93,0x1ebec184},{0x02e130ea,0xaa755c59},
+{0x0301ed0b,0x643fdabe},{0x01800ecd,0xe28ed45f},{0x01c0a6c0,0x96d8ebe1},{0x02010624,0x26287398},
+{0x03802271,0xd6a28b89},{0x02a01b49,0x93feaee8},{0x026002fd,0xdb8e19d4},{0x0380d7f6,0xb8562b08},
+{0x03800337,0x2a0d81d8},{0x03602c77,0x8b3a1fee},{0x020116b3,0xe4f5862c},{0x02601252,0x2b137240},
+{0x01c1e959,0x0a70de53},{0x02600966,0xe9ea39e2},{0x02a0ab21,0x7fd7f779},{0x02e14443,0x25733845},
+{0x02000a2a,0x2dde00b4},{0x01c10183,0xa1c1b3ec},{0x03e1cf3d,0xe643430a},{0x03401071,0x0cf0ab25},
+{0x00e1f4a7,0x41957151},{0x0361d171,0x22206fd9},{0x01802b1a,0xd49e8a8e},{0x02801c2d,0x6c6be10d},
+{0x04a12471,0xab3100fb},{0x02c10d36,0x5ef68f18},{0x0220ff0a,0x7d9524d4},{0x01a0a562,0xdae9bf77},
+{0x01e01760,0x64d22e17},{0x03000c63,0x7be574f8},{0x03000315,0x65d24091},{0x01a1f423,0x4cb3bda5},
+{0x01e104a1,0xf352c3f0},{0x02c02896,0xaf7821d2},{0x01c01c0d,0x801c89d5},{0x02212034,0xe0568f82},
+{0x02c13380,0x2bc066be},{0x0181161f,0x1ff7fe69},{0x01e16f1d,0xdce82897},{0x03410c90,0x36434034},
+{0x038001f4,0x03a15c78},{0x03e18b61,0xa0cac71d},{0x032169f5,0xe172c9da},{0x01e106d8,0xb9bcf824},
+{0x0261f607,0x93efb5b7},{0x0460a68b,0x7e0d9032},{0x04601da8,0x3ca17bb6},{0x03c01d55,0xa591ea6a},
+{0x02802f58,0x951873cc},{0x0421f878,0xb48b5694},{0x0341d20e,0x0e4da228},{0x02010b27,0x36082184},
+{0x0561d864,0x9459d08f},{0x01a0a0a5,0xe395dd8b},{0x03816f4f,0x10a4a42f},{0x032121cc,0x306c4b7d},
+{0x01a02702,0xbe2725bf},{0x02812fd6,0x9c0fb4f9},{0x0081fa9d,0xeabe9caa},{0x04e02546,0x9f1671bb},
+{0x03000402,0xb16593a5},{0x0220ff11,0x4b7d08f7},{0x03e004d0,0x5d02f613},{0x02802db8,0xa93b0841},
+{0x01c0265a,0xd6bf7563},{0x04c0335f,0x4015de1e},{0x03612213,0x552c78a9},{0x03410557,0x1727cd44},
+{0x02a00605,0xae5971d2},{0x02a03146,0xe8c6e6c0},{0x036025da,0xc530ba37},{0x026014a5,0x306e708e},
+{0x01a0a617,0x115e7ecd},{0x026124fa,0x562f734d},{0x05200877,0xabff2828},{0x03402bb9,0x0dafbb0d},
+{0x02002168,0x7834c078},{0x03e10b49,0xe480b035},{0x04001d81,0x728aee9e},{0x0321d362,0xefb5ffc4},
+{0x02811d6a,0xfc97a240},{0x010033c2,0x55a5bb18},{0x02811af5,0x215fce86},{0x01e0a244,0x37261d44},
+{0x02801a85,0x407aa418},{0x01c0a6e2,0x0748049b},{0x03e18cc6,0x76878716},{0x03a1eca5,0xaa452c59},
+{0x0200307b,0x8e1d7c0b},{0x02a1bc90,0x79792af7},{0x04001cae,0xc2d5cae4},{0x03011a16,0xde744ad5},
+{0x0281f563,0x25e6513b},{0x028119b4,0x063819dd},{0x02e12343,0x678fe852},{0x02c10d16,0x972cdde7},
+{0x04401f49,0x7ea54572},{0x03402393,0x9e52fed7},{0x02003053,0x6e1b0b14},{0x01a0aab2,0x2f3b1779},
+{0x02418a51,0x31499a9f},{0x02a0017f,0x7dd0f23f},{0x02c13271,0x7ca9377b},{0x036012d6,0xca7cb036},
+{0x0221005a,0x27b6804a},{0x04e1d64a,0xfae19c59},{0x0320ff7d,0xf0aa7cca},{0x02801414,0x4e58a07f},
+{0x028e01a4,0x725bbf59},{0x03e004c7,0x68e9b724},{0x02a104b8,0x3e79bca6},{0x03400429,0x8e3b7c1b},
+{0x02602d86,0xa8aec6e0},{0x00c1f4d2,0x8bcd5d0c},{0x01a0a026,0x2bf946fc},{0x0361f50d,0x2641e801},
+{0x0241d2eb,0x3e9945c4},{0x04c002e4,0x324e8d26},{0x03400e43,0xbef27de7},{0x02c119d1,0x0e5a3f5d},
+{0x03c1d6b6,0x68c65e61},{0x02c131a2,0xc38819e6},{0x04c02b6e,0x8b914f3f},{0x02c0066e,0xc6652db0},
+{0x01c0a6a5,0xdf9f5b3f},{0x02e14420,0x217ffdec},{0x0221f4de,0x360cfc7a},{0x04601423,0x0b774ebd},
+{0x02e14426,0x1f7ffac6},{0x02c13358,0xdbbeb12e},{0x02200a9e,0x77244e9a},{0x0081fab1,0x6401d312},
+{0x0360a69b,0x1d55a315},{0x03e00d9b,0x2fc8b787},{0x028168c5,0x9a510e6d},{0x0081f6a2,0xe9a9267f},
+{0x01602034,0xebdf0070},{0x028169f0,0xc6f9592d},{0x0241192f,0xcbbe7207},{0x0261b10d,0x7a20ea9a},
+{0x03210ccc,0x609a80d1},{0x0261b01f,0x4f63b2a6},{0x03a0fabc,0xae6d8180},{0x02c133df,0xcdbbc400},
+{0x02e1324e,0xd1775f20},{0x01c02222,0x6f4b90cb},{0x0301d376,0x76458cf7},{0x060115ca,0x2358ca75},
+{0x0241fb90,0x0834be3d},{0x03c1d55c,0xed256564},{0x02210059,0x96c87828},{0x0240a897,0x59f07bc7},
+{0x05801dff,0xc4a90cf1},{0x03e18c8d,0x27906243},{0x0240130d,0x25059fa8},{0x02a003b8,0x85a9b0e6},
+{0x04201eef,0x493a7fdf},{0x03a1d599,0xf5919314},{0x0480fd00,0x12c2eb90},{0x0361ecb4,0x6cc23dca},
+{0x02816b01,0x5b0007c1},{0x0280ab05,0xe3e41a87},{0x03011cae,0xfea59685},{0x02a10f1f,0x167432dc},
+{0x0280129c,0x6bc1593b},{0x0321d9fe,0xbfd7b219},{0x02c131f3,0x017cb684},{0x01a1d378,0x60f182f8},
+{0x0280152e,0xc6cdc471},{0x02c1f746,0x115601d1},{0x0181f6ba,0xdcbeb67e},{0x03402941,0x0d62bf22},
+{0x02200aad,0xaee44b13},{0x02c168e4,0x515e6564},{0x02401164,0xbad4eb51},{0x01a116c6,0xeda301cd},
+{0x0280118b,0xe251e965},{0x0180aa51,0xc25db7df},{0x02a01fee,0xc8ec0689},{0x02a00c61,0xba55049e},
+{0x02e02a5b,0x723cc171},{0x03c10b55,0x83cadce3},{0x0500a71f,0x4db17ecd},{0x01816f10,0xe95ccc56},
+{0x01c0a2ce,0xc72a0e71},{0x01c0a5c4,0xd1c407d1},{0x02c168fb,0x201eceb0},{0x0441f164,0xe64f5323},
+{0x0200099d,0x396e8f66},{0x02e1444e,0x2d7344dd},{0x02400d6b,0x646bdee9},{0x01e106e5,0x42c24cfd},
+{0x052027c1,0x8e399f8e},{0x01a0a1ee,0x6df45f85},{0x024103ce,0xddd57fd2},{0x04202bf6,0x7189c6dc},
+{0x02601484,0x1a7d5876},{0x01a1f922,0x65d154de},{0x02402f60,0x8c093778},{0x0220300c,0x59a2166b},
+{0x02e13036,0xc1637b4a},{0x026012f3,0xd634b3ba},{0x02801094,0x0522dba5},{0x02801a1f,0x6ef8527a},
+{0x00e1f9f3,0xb23b031b},{0x0061f400,0x83d92558},{0x03402288,0x7edb0f14},{0x02600058,0x5a1508f9},
+{0x03601736,0xe040d7b6},{0x01a02064,0xfee49f70},{0x0260a821,0x174acf4c},{0x02600054,0x66151bdd},
+{0x0301f318,0x3fc2b3c5},{0x02810d1d,0xb5b8636b},{0x0501d79f,0x49678747},{0x02203141,0x4a39d9c7},
+{0x0260a81e,0x774927d5},{0x0321f0cb,0x434d9fb0},{0x02c131d8,0x54fce18b},{0x02001725,0xc42768b1},
+{0x01a0a269,0xa75f3525},{0x03010420,0xbe4b74db},{0x0201050b,0xa254476f},{0x026e013d,0x1fa1bf34},
+{0x036002bd,0x21ec0d0d},{0x0101f572,0x7a5caf2c},{0x02e13236,0x68723ca7},{0x02611640,0x5315fb18},
+{0x02600f3f,0x4341b368},{0x02011ad9,0xba09f618},{0x03a0fabf,0xb36d895f},{0x04001f7a,0xe9cdf933},
+{0x01a0a2c1,0xc66d9e4d},{0x02011591,0x5b13aa85},{0x04a0a758,0x4d0af265},{0x02e133d4,0x9afe78a9},
+{0x02c0ffcc,0x5d75d40a},{0x0201f649,0x37f3a4e5},{0x02c0045c,0x73162e19},{0x0301d6d8,0x75a95ed1},
+{0x0241d18f,0x358d94c6},{0x0381d6e8,0xb62d2585},{0x04616802,0x98100ff2},{0x03a1d5b1,0x607bc5e9},
+{0x0521d7aa,0x9c9102ad},{0x02e02142,0x10820ec9},{0x032023a0,0x787906c7},{0x01c0a0b9,0x769dafde},
+{0x03800971,0x8f1bc382},{0x02e16e65,0x6ed4652e},{0x03003182,0xbfb00aad},{0x02210346,0x8e3151fe},
+{0x014026f3,0xb7ddd5ee},{0x0381cf2c,0x3c7cf91d},{0x03810c83,0xabe43c53},{0x0161f628,0x84c875f3},
+{0x02c10886,0x0afdb349},{0x03a02cb5,0x5b02f22b},{0x0461d76d,0x33b05574},{0x02402f7a,0xe124eed8},
+{0x0280185e,0x2faec431},{0x02c0fbd8,0x52cead5a},{0x01a0a481,0x05f881b7},{0x0401f125,0x142ffb53},
+{0x03402ace,0x8faad37d},{0x026e0152,0xa488f8ad},{0x0180a1b9,0x8654d584},{0x02e0215b,0x5e98e8d5},
+{0x03201eff,0x5a84f629},{0x01e02079,0x30e0769f},{0x02016ac8,0x35e13f95},{0x01e0a6d0,0x6f03f295},
+{0x01c108e4,0x0794de5c},{0x030014ec,0x1ed61e18},{0x02402f4d,0x7e00ced9},{0x03e1df0d,0x1e39d034},
+{0x01e11ee5,0x1abc08dd},{0x0240153e,0xb94bfd2f},{0x0221005d,0x1eb6721f},{0x0180a4ab,0x40b62558},
+{0x01c16f02,0xb5384f76},{0x024112a9,0xdd740b73},{0x02a0abba,0x3520971c},{0x036021b7,0x24876f97},
+{0x01e1fb29,0xd0c769ba},{0x04a021cc,0x572461ce},{0x0141f681,0x4e9d3c70},{0x0281f859,0x06be1a29},
+{0x03601062,0x24641af9},{0x0481d87c,0xee3d6781},{0x0361ee47,0x9eeaf45f},{0x01a0aa11,0x9f09c6d5},
+{0x03c01f61,0x2ae02885},{0x02e13033,0xf55dbcf8},{0x02418974,0xa88d2032},{0x036015f2,0xa1131d17},
+{0x01c0a275,0xe8f6e7ff},{0x026112e3,0x8f125106},{0x02e13231,0xce6eba81},{0x0360165d,0x18b58b60},
+{0x01a01bdb,0x3adbf38e},{0x01a0a477,0x353df038},{0x02a11932,0x2d9b7944},{0x01e017e3,0xbe9e3445},
+{0x024188eb,0x100c5d42},{0x03003204,0x5e086e4b},{0x03210a62,0xddb3ffaa},{0x0180a2bf,0xa4574355},
+{0x02c1f08d,0x8f7d9309},{0x01a102b5,0xbdf0aa7f},{0x0301d4cd,0x31a10ebf},{0x01c10e85,0x7c5ce495},
+{0x0281f262,0xc6227226},{0x046025ed,0x60bd28e9},{0x01e0a6b6,0x27496944},{0x01e03108,0x89fa090a},
+{0x03a0fac4,0x9f6b2b4c},{0x03e01e60,0xd24880ec},{0x02c026ef,0x7b2cb1b8},{0x03e18cbf,0x6889afa3},
+{0x02610e7b,0xdc9b733d},{0x0361d5c6,0xd69ca41d},{0x0461d04f,0x149b3edc},{0x02e00693,0x2502478e},
+{0x0381ee31,0xeff3c925},{0x0400ffaa,0x85a1664e},{0x02801253,0x00b04adb},{0x0180aa18,0x2f8804e1},
+{0x0400324a,0xf4629951},{0x02418a93,0x539f4d01},{0x03c124bc,0xec4242e9},{0x0260a4f8,0x09578278},
+{0x02601325,0xccb13e23},{0x01a0a564,0x2f000a02},{0x028119ba,0x306f781c},{0x0081f9d9,0x8d3f1f43},
+{0x01c0a407,0xf3c7782e},{0x026122dc,0x6ce075f1},{0x02802b2f,0xba14cd72},{0x01a0a433,0xad56efd2},
+{0x02210755,0x1dc6162e},{0x01a0a26c,0xad5f3e97},{0x01a0a1d1,0x43958a80},{0x00e02448,0x91607e83},
+{0x03603226,0x9851593d},{0x01c02110,0xc98755f9},{0x020010f1,0xe18b8388},{0x02a1d175,0x69396d88},
+{0x030124c0,0x22d899da},{0x028104c6,0xc0c3a1de},{0x0281b167,0xfa6abb60},{0x02801500,0xceb5791d},
+{0x0521d8e2,0x893f03e4},{0x0341e82a,0x0a453c9e},{0x026119ca,0x13a285b8},{0x01c10e66,0x28ce6798},
+{0x04e02544,0xc06de8cb},{0x03212185,0xb6ea0c59},{0x03600335,0x669baddb},{0x032027a7,0xe7ca1ad6},
+{0x020114c3,0x47f2600e},{0x0180a469,0x447282b2},{0x01a0a6a1,0x4f56cdc1},{0x018111c5,0x0bdfb9d5},
+{0x0360fb36,0xa8b76079},{0x02e10c3d,0x47571001},{0x02a104be,0x992b4cfd},{0x01602e0f,0xa02df723},
+{0x03e18ca2,0x028ce0a8},{0x0321d51e,0x0fa17bd2},{0x04a0fefb,0x0f4156d5},{0x0121f5c5,0x1536082a},
+{0x024115b1,0xa1ad4429},{0x028023fa,0x6003220e},{0x0321f016,0xdd9c36d8},{0x040120be,0x0e631ea6},
+{0x02e11040,0x838d1a89},{0x030144ed,0x391aaeee},{0x02011fd8,0x5d64460e},{0x02c10f11,0xd88cd7ac},
+{0x0441f183,0x5b45a35f},{0x0301d6d7,0x11f08f60},{0x05e1d843,0xc9b48369},{0x0181fa86,0xe5d76b55},
+{0x03011035,0x18b746b1},{0x03c1d4df,0x42e98d2d},{0x01e0a2eb,0xa867ae2c},{0x026018b0,0xdc726980},
+{0x0341104a,0xc9ceaf72},{0x0201f787,0x819f2c51},{0x03c1f216,0x71b319fa},{0x0401d72c,0xe9694b19},
+{0x01e0a301,0xbb904974},{0x0181fa9a,0x51eb2012},{0x03202ac0,0xec180a02},{0x05e02ba5,0xbbbfc429},
+{0x01c1e2c3,0x7b61b5ab},{0x03800fcc,0xd2f103a9},{0x02e14412,0xae7acbb5},{0x0681d82f,0xd559c6db},
+{0x00c02696,0x4a04a3a6},{0x0561f818,0x915a91fb},{0x01c0a34d,0xd99a598a},{0x03a1d5a2,0x4f7bab26},
+{0x0321f923,0x7af9ae97},{0x0221d2e8,0x3958cd64},{0x03002b32,0x364543e3},{0x024106a1,0x675beffe},
+{0x0241d245,0x09e4194c},{0x02e02a43,0x7c61c8cb},{0x03201b0a,0x1a0b0e3f},{0x0241881e,0x81820d7d},
+{0x03001932,0xb8aa3418},{0x03c020e5,0xcaca9f28},{0x02011fea,0xed230978},{0x01e01017,0x146bbc0d},
+{0x03a1cf42,0x6022cb37},{0x01e1050e,0x1988c4e4},{0x01a0a3f6,0xcdfbc03e},{0x0521da22,0xba040171},
+{0x0661d841,0xb1d8bef4},{0x05c1d8de,0x6e8f84bf},{0x028102ea,0xcdabf062},{0x02c16925,0x76762c7f},
+{0x02418a68,0x54ac1a87},{0x026e011e,0x26a885fe},{0x03a0fa76,0x323b7eae},{0x030168d2,0x4d76bc94},
+{0x0381e106,0x26aad45c},{0x01a00b26,0x8bb7a9ea},{0x00a02302,0xefb053bb},{0x03c024a9,0xf6011f26},
+{0x01002216,0x0eadcf49},{0x04e1d75a,0xac99f95e},{0x01a0a2ab,0x9f79463a},{0x036030fe,0x669b8e39},
+{0x01c11207,0xc6e6a045},{0x018020a2,0x333f28cb},{0x01c02133,0xcd875c45},{0x0200a900,0xd425f8d1},
+{0x0421d15b,0x67d0e7b2},{0x02a01673,0xd60d35e6},{0x022017dd,0xae0e1d2d},{0x02e1447e,0x0c0fbf56},
+{0x04e02509,0xde6e8581},{0x034000fa,0x4a02a53d},{0x02a16a15,0xd538f5df},{0x03a1d59e,0xea9181c3},
+{0x02c006de,0xd85102e5},{0x02c1f07b,0xeb80c617},{0x028e01de,0x89d07e43},{0x04a1d997,0xba0f857a},
+{0x02400cc2,0xd99b19db},{0x02a0a823,0xf3755b39},{0x03203015,0x7dd6ace0},{0x03801499,0x37abfe93},
+{0x02e130cd,0x3077652e},{0x0301d415,0xba4d0024},{0x03202392,0x7a64c711},{0x03216b2b,0x2891a6b6},
+{0x0301d412,0xb74cfb6b},{0x01a0a545,0x2b08527b},{0x02601247,0x5b15fc67},{0x01e1070a,0xfd67592e},
+{0x03201409,0xcf4c57f3},{0x0501d9d6,0x9c311107},{0x02210375,0x361bd13e},{0x0260122c,0xb2c89e7c},
+{0x05e1d9d2,0xe0f0e08b},{0x03c1d4d6,0x2be968f8},{0x020013b7,0xac0501ba},{0x0240122d,0xc920e551},
+{0x024012ce,0xff2e0646},{0x01a0a5dd,0x31085bed},{0x04e1d14d,0xa200f2ee},{0x01c0a385,0x8f7573d6},
+{0x034032ad,0xe057df75},{0x0581d970,0xef876d2b},{0x01e01921,0xe18bd54f},{0x0341e81b,0xab145422},
+{0x05c0fbf3,0x66fee070},{0x04402c2d,0x27bc40fd},{0x0240126e,0xdf2b954f},{0x0501f79b,0x429df592},
+{0x02411ad4,0x02eb2c15},{0x0261f5ac,0xe7c606ee},{0x03e18b8f,0xa9bbcabe},{0x02a1086f,0xe2a36691},
+{0x03a12242,0xfa4dadb7},{0x0241f7a5,0x47e233de},{0x02c1331e,0xee0af3d0},{0x02a02eaa,0x8a57ded5},
+{0x03610c82,0x99bff356},{0x0201238f,0x530cecd1},{0x02418918,0x8b276260},{0x02c0041e,0xe71163ad},
+{0x02202ec4,0xef68dfc8},{0x0521d954,0x13242399},{0x02e102f1,0x721a032d},{0x02a10f08,0xd476c020},
+{0x03412017,0xc49c8f7a},{0x02a10039,0xa1e9d1e4},{0x02c0102b,0x509d55a9},{0x02410a2b,0x0a208d8f},
+{0x03802755,0x2ca81fe6},{0x02a01df8,0xb9c6b7bc},{0x02200d1c,0x522cf8f1},{0x03a0ff69,0xa56cb704},
+{0x03411a02,0x32566df4},{0x02a02173,0xbb6289a1},{0x03600339,0xb80291bb},{0x02c13052,0x3bf13b3a},
+{0x02616ae6,0x35bc2623},{0x02a00564,0xa3b135ea},{0x02612147,0x9560813a},{0x0361204c,0xce644629},
+{0x04402bf8,0x89a56829},{0x02416951,0xe16ce16b},{0x02c133a6,0x27bbe344},{0x01a0a5f2,0xeae31ce2},
+{0x0200062b,0x7e5caf90},{0x01a0a0d9,0x24aeb01a},{0x0121f993,0x44957026},{0x02001b2f,0x02d7fcc2},
+{0x05012433,0xd953f12d},{0x04001ac7,0x4bb1bf26},{0x0241036f,0x203fcb58},{0x02c12174,0xa0383ce8},
+{0x04a0a66c,0x98bde872},{0x030145a4,0x137bfc14},{0x01a0a3c9,0x067366ba},{0x02e0216f,0x8275e25a},
+{0x0280154c,0x45b1cf40},{0x04402c62,0x625a34c2},{0x0481d076,0x074a7c96},{0x04202b79,0x528f8c0f},
+{0x038015b7,0xdf72aaf3},{0x01c0a51a,0xae5a1cda},{0x01a1f930,0xb25525d2},{0x03e0277f,0x779d9d9b},
+{0x03a000d8,0x0e4ffdc8},{0x0520fda3,0xf4a44ca1},{0x01e1e2cc,0x19db2f0a},{0x03a1d8b4,0x7ec278c4},
+{0x02a0abab,0x3640ec5a},{0x01a01bd8,0xd6cc4b98},{0x01e11030,0x068f4790},{0x0180a201,0x76437333},
+{0x03c00db6,0xecb05458},{0x02418ac7,0xdd193c8f},{0x03210a67,0x6cd95b83},{0x01a027d7,0xe9f1dcf7},
+{0x02000e8e,0xd2609089},{0x04202cfa,0x7bc145b3},{0x02c13090,0xae289f25},{0x04e1d005,0x255ce298},
+{0x02000edf,0xa653a620},{0x0401d103,0x8523f7aa},{0x02410a1f,0xf9e5dd37},{0x0481d7a9,0x4207ddb6},
+{0x02a03298,0x06d71564},{0x030145a0,0x5d136bfe},{0x01a0a0c8,0xe27887b5},{0x01c0a22d,0xc47cfefc},
+{0x03010c21,0x65c18b54},{0x0201212c,0x6eeed3d9},{0x01e0067e,0x2e9c2206},{0x0440a7a5,0xa395db01},
+{0x0241897a,0xae8d29a4},{0x0180aa13,0xd3485fb7},{0x01202234,0x9ae1cb97},{0x028119af,0x9c08d925},
+{0x04200fba,0x83d94a6f},{0x04a01e65,0xcb55f880},{0x03016b23,0xe2fabb3d},{0x02a12364,0xef4c1bde},
+{0x01811808,0x58830afd},{0x02a01856,0x29ed813f},{0x034024cc,0x3e65d2f2},{0x04402566,0x25a29101},
+{0x03603219,0xd9856280},{0x01811800,0x4a82f4f3},{0x05a0a756,0x71f32374},{0x02e1fb85,0xb73adfb5},
+{0x0340165a,0xec6e8a0b},{0x01202e3f,0x9c6a0349},{0x02c1059d,0x88eb3b2c},{0x0441faf0,0xeb3523ff},
+{0x02c130e2,0x11d04a52},{0x022032e5,0x7314f81c},{0x01402aab,0xcdd6e6c9},{0x0661d1ca,0x4e8d68b6},
+{0x02e1442e,0x1b6eab59},{0x0121f35d,0x9a0c1a5c},{0x0520336a,0xaab86d10},{0x03c111f3,0x60401801},
+{0x02a1684c,0x8fa1a6fa},{0x03a1d1aa,0x976999db},{0x0441da5f,0xe284b78d},{0x0361da18,0x655b0559},
+{0x04802c5e,0x85761cdc},{0x03212194,0x2266d71e},{0x02e13263,0x8e1457b3},{0x02a01b38,0x9ea81f5a},
+{0x0101f913,0xeef14d83},{0x0260127c,0x6290f01b},{0x02a10028,0xecce7343},{0x02a16a1f,0x7352adbc},
+{0x03800dd6,0xa486e22c},{0x04202972,0xa377f00c},{0x03e1ee6d,0xd088b029},{0x03001543,0x9ba307e8},
+{0x03014472,0x5fcec607},{0x02810335,0x663fd1fb},{0x028e01db,0x96d092ba},{0x02c13204,0x72775839},
+{0x01c0a09b,0x181dcff5},{0x02e145bc,0xf828aa9a},{0x0261b03a,0x4d5f3252},{0x02000ca1,0xac87315e},
+{0x01a0a55a,0x32e80b68},{0x0200a9a9,0x368b83ca},{0x02c00519,0x894d4ab8},{0x01e00c19,0x54dabefd},
+{0x020108e9,0x09b0ef47},{0x0220a88c,0xf3bfca16},{0x03003253,0xbf4f2e19},{0x02400958,0xcc61bd45},
+{0x02c1325e,0x82adbe1b},{0x0340115a,0xd8a39b50},{0x01e1039b,0x3d3fc4c2},{0x02801034,0x87d61427},
+{0x036121ae,0x266d3e87},{0x04801ff6,0x94d86c46},{0x050027a0,0x8bebbd88},{0x02418924,0x25248337},
+{0x01c00c6c,0x261a9f12},{0x032100e9,0x516b0447},{0x02c16974,0x6506c8a6},{0x0361f718,0xafd85186},
+{0x02401a6f,0xef75158f},{0x0241889d,0x81e0e1e3},{0x01e16f57,0xb0b9133e},{0x030109ad,0xf2048436},
+{0x02e11aeb,0xf702c0f6},{0x01e007e8,0x492cce88},{0x02210393,0x02f566e5},{0x03600167,0x38a11d00},
+{0x01c11742,0xd30e0777},{0x024012a8,0xe0e8b288},{0x02c16983,0xb0b28a47},{0x0201f9bd,0x6be5ba1b},
+{0x0580309a,0x061b1526},{0x02202fb8,0xc954690f},{0x0381e81a,0xb5924d9f},{0x05203365,0xb14e2a76},
+{0x02610097,0xca5662a0},{0x02200c48,0x559989b9},{0x028187f5,0xe989d772},{0x0340fbdb,0xc738ecd2},
+{0x03c01efc,0x93c281fd},{0x0481d6f3,0x069edb9d},{0x06c0fe3c,0xec207f92},{0x0361e8a7,0xba2eb2c7},
+{0x00c1f407,0xa9ab3e25},{0x0320028b,0x5fff2481},{0x00a02038,0xe534eb88},{0x032010bd,0xf6fdee29},
+{0x03612052,0x14b4e044},{0x02211112,0xec163b4a},{0x0260aaab,0xc463d416},{0x032002e6,0xba816a79},
+{0x02810ad1,0x78eab24f},{0x03016b22,0xcd54773f},{0x03c10168,0x7071bf95},{0x03e18bf3,0x9fe0e907},
+{0x0200061a,0x52e55e70},{0x02418ab8,0xc497b01f},{0x0400fe10,0x78082d3f},{0x01a0a2b7,0xfe636919},
+{0x00c1f9fd,0x213cb3c7},{0x03a16821,0x258563cb},{0x028011ab,0x94131b71},{0x02e02875,0x6300c9f4},
+{0x01802e4b,0xd5f77d0b},{0x03201d11,0xfcde3f2c},{0x02600dec,0x2be0c661},{0x030002de,0xf62d2d66},
+{0x02a02845,0x3e139545},{0x0561f896,0x207cfac0},{0x034017f8,0x66809917},{0x03002329,0x0476da1f},
+{0x0680fbe9,0xe2df35d1},{0x0460251e,0x366ce3fe},{0x02c132cf,0x7598921d},{0x02a1d355,0xb51cdb74},
+{0x03a0faa0,0x27707e92},{0x03a10cca,0x700352f9},{0x02a0a9b8,0x76bd0318},{0x03010b89,0x29c113bf},
+{0x03402757,0x9e032400},{0x0240a885,0x4e086dc9},{0x01a0a409,0x66796bd1},{0x008026fa,0xad1a1660},
+{0x0400a7f8,0x9256b31c},{0x05a1cf7c,0xa31fea9c},{0x02e0fe7e,0xb579052c},{0x0201e2f8,0xc5eb344b},
+{0x022030fb,0xbd86572d},{0x01e01c6f,0xbe793079},{0x0540fdbd,0x8bfe14d0},{0x01e116b0,0xa31bcd71},
+{0x01e1f32c,0xe0684900},{0x02202fbd,0x0ba675c5},{0x02a01b80,0x714ecf30},{0x0281b08e,0x1e4635bd},
+{0x0501d0b5,0x47b37dac},{0x0241893e,0x2a7ee24e},{0x01e106d5,0xb3bceeb2},{0x02801535,0xc0e5bfe5},
+{0x016007dd,0x4343add6},{0x02816e85,0x9b11d112},{0x01a0a539,0x0b0edbe0},{0x02a009ce,0xb8b47f6d},
+{0x03c1d554,0xe52558cc},{0x02c0ffc7,0x5375c44c},{0x0341cf2a,0xd4500383},{0x01c0a58b,0x444a6b72},
+{0x00602312,0xbcabd5fb},{0x02201811,0xadb9bb3c},{0x01e007a7,0xa11dca9e},{0x02011319,0x11de8d44},
+{0x03c1e010,0xdfacb4c1},{0x02802c8b,0x6ab75f9b},{0x01c0211b,0xde877708},{0x03802c36,0x6c8c2f52},
+{0x01603335,0x4489561e},{0x02400720,0x9686b361},{0x01e1067c,0x4e2b0967},{0x03216e4e,0x638546ab},
+{0x02000ab5,0x77a0d1ff},{0x04c1e029,0x61cffc75},{0x02a0184f,0x260712d9},{0x02402579,0x7953c735},
+{0x0281f661,0xabc293d2},{0x02012246,0x7020a230},{0x02c00e17,0xc4f3e681},{0x03c1d4da,0x27e962ac},
+{0x024003be,0xa2166661},{0x0201f5b1,0x367e0a2e},{0x02c1123d,0x9795352a},{0x01e16f5a,0xb1a10feb},
+{0x0200a6b2,0x5c5f4be6},{0x030120d2,0x96355e01},{0x03e18b49,0x8cc62a73},{0x02a0149a,0xcd49eb64},
+{0x03c1df10,0x890422b7},{0x02e01bd9,0xd7f5319d},{0x02e0286e,0x0b884f36},{0x0360111d,0xe1ee75a1},
+{0x028e01ab,0x795bca5e},{0x02c0a827,0xb7d6ffa8},{0x04000d5d,0xaf51281f},{0x0320a665,0x8f6d73b6},
+{0x03e18cab,0x128cf9d8},{0x04a10152,0xcfa6ab32},{0x044115d8,0x2927df96},{0x02e145ba,0xf628a774},
+{0x02400915,0x1098424b},{0x01c0a6f6,0xdf667df6},{0x0180a2a0,0x7e6ccdd2},{0x03016804,0xbd533d1f},
+{0x0421d063,0x3e6d5e36},{0x024111db,0x231c4328},{0x02401109,0x17abf660},{0x0320feb0,0x7228f6cf},
+{0x0300a68c,0xe06b9aec},{0x02c1f5da,0xeb35043d},{0x03c0ab31,0x9ed6e7b5},{0x03e000f4,0x31870b87},
+{0x02403268,0x9bf3eecd},{0x0121f91d,0x4ddec9c6},{0x05e0fcd9,0xa6b76a11},{0x02a031f8,0x3f1379b5},
+{0x0580fe40,0xe959f7db},{0x02e144db,0x172119c8},{0x02c028ca,0x62750661},{0x0300a7bb,0x9f473f00},
+{0x0340150b,0xd8e4b00b},{0x0261b10a,0x683455fc},{0x01e00f54,0xd1a4cd9d},{0x02e144d3,0x1b235eab},
+{0x05a1f246,0x68815724},{0x02800795,0x6cc64a67},{0x038023ac,0x298329d3},{0x01e1236a,0x9ff955ed},
+{0x030145b6,0xcf88867e},{0x01a00ec2,0x283702ce},{0x02e114c6,0xbc1a78a9},{0x0281ec74,0x66b038ce},
+{0x02418896,0x88e0ece8},{0x0161f992,0xd8f33cc6},{0x01c00c32,0x7454af42},{0x0441affb,0xcc524b96},
+{0x0180a3d2,0xae80a11a},{0x0340ff4e,0x07e0ded5},{0x01600e88,0x3d50b3a9},{0x0400a660,0x1449b9ce},
+{0x02616a14,0xfa4c9736},{0x03801669,0xe0b69ae4},{0x046004f0,0x1e41fd4c},{0x036015da,0x1bd40254},
+{0x03812164,0xb3a25664},{0x02610907,0x549193cc},{0x0261b01e,0x5063b439},{0x0320045e,0xba50d342},
+{0x02418977,0xa58d1b79},{0x0281e7e0,0x5ffbf4b6},{0x02e10d1b,0x6f394051},{0x0200238d,0x17500309},
+{0x0420250d,0xfed23f41},{0x00c1f9c4,0x3dd5b98f},{0x03a00824,0x8266adb9},{0x02211909,0xcedcc893},
+{0x0541d8fb,0xd0e9ee10},{0x038012d4,0x2158b017},{0x0201fb28,0x2e27d3de},{0x04a01b78,0x5b9924e0},
+{0x02e00f3c,0x6c5f3b5f},{0x03a1205a,0x8db11095},{0x0241087a,0x7b907159},{0x0221038a,0xc8be6499},
+{0x02c10b8e,0x6f94ff20},{0x0321f836,0xe0dc57b0},{0x02e0081c,0xea1a0678},{0x01a11743,0x2ef7d5d7},
+{0x0381ee30,0x4d385812},{0x014000ad,0x9bde56b1},{0x02c130ac,0xbb2d30ca},{0x02e144c0,0x0e00b7f2},
+{0x02e00424,0xab46b30b},{0x02e01135,0x371e4e5a},{0x02200e92,0xf5fd2578},{0x03c1210c,0x5137a669},
+{0x03e18cbc,0x6b89b45c},{0x0161018e,0x1ec75d26},{0x02610917,0x118989a9},{0x034015f4,0x1b50bef4},
+{0x02c0109c,0x6778a752},{0x046002b6,0x1c0ebc26},{0x05402b8f,0x66fdde10},{0x01a0a4c0,0x06e6d8ad},
+{0x03000ac9,0xb8ed0222},{0x03e1cf6c,0xfccfa644},{0x03a1d195,0x0eef5351},{0x03c02769,0x52f21384},
+{0x03a020d9,0x91ec6711},{0x00a026b3,0x92182729},{0x024188ab,0xfbdb91c3},{0x02e10c07,0x6d52cea5},
+{0x02616a23,0xf24a4c07},{0x02800fd2,0x6899b1f9},{0x01e00816,0x63b473bf},{0x020021f3,0x6949b292},
+{0x0240d7bc,0x4e9e1303},{0x02000cab,0x0a9e22ee},{0x04e00ddd,0x047c6cfa},{0x03a014e1,0x5ec5de97},
+{0x03c004a9,0xaa31bb96},{0x02e11a30,0x5bf5b01a},{0x02401305,0xb8e634f9},{0x02800664,0x60462adf},
+{0x03c1f541,0xd416d114},{0x028e01c4,0x1bd5e147},{0x01e00783,0x3397a7ba},{0x03e1d581,0x73f512db},
+{0x02418970,0xaa8ae4c1},{0x03c02cce,0xec0ec47f},{0x00e1f4ee,0xc9f37878},{0x03010a69,0xbd5f0fc3},
+{0x03216af0,0x4d0adf1e},{0x02c02b4e,0xba3e5b36},{0x0261b111,0x7620e44e},{0x02c133e5,0x207859c5},
+{0x02c01035,0x97037e24},{0x026122ab,0x91762dec},{0x024188ee,0x130c61fb},{0x04810c9e,0xae60bc3a},
+{0x0241899e,0x2cc82dab},{0x02c01397,0xd4260f2f},{0x02e144aa,0x98060e5e},{0x01c00bea,0xe8fab609},
+{0x026100bb,0xd667bea5},{0x02200740,0x9fc8ee16},{0x0320ff79,0xf06e52a2},{0x01c11816,0xdaa1767b},
+{0x05e1cf00,0xa6f8c892},{0x03016a27,0xe03733ad},{0x016000b6,0xf0bc1af0},{0x02e14564,0xe53c1469},
+{0x0361ee8f,0x0aa8eb52},{0x02a00d88,0xedca41a3},{0x032122cc,0x269319b0},{0x01a0a313,0x939271c1},
+{0x02802821,0x0d8dbccf},{0x02601251,0x47139e54},{0x02e010a8,0xd17cb312},{0x0280123f,0xc846f38f},
+{0x02a16a20,0x6adca516},{0x030100b5,0xb9e29a3b},{0x040124b1,0x24f1a1ca},{0x03c02794,0xbaafb88a},
+{0x02a104cd,0x31d2c995},{0x01a00bb9,0x6937594f},{0x01a1180a,0xfa40c5d0},{0x01a0aa14,0x3cd8c5b7},
+{0x01a0a5d0,0xf0ec20b0},{0x03402df0,0xffb22510},{0x03c1241b,0x6ff6c665},{0x0161f609,0x78214953},
+{0x042022c9,0x8b5f2dba},{0x0300a9f4,0x24492774},{0x02a04dfc,0x905e7c74},{0x04c1fa19,0x2895633a},
+{0x02e1331c,0x60601f01},{0x01e12248,0x5016ed11},{0x03e18be9,0x11ddcae6},{0x00a0231a,0xea17a2c8},
+{0x03216b3c,0xa0e02ab9},{0x028187ed,0xf88c2da6},{0x03602989,0x4fb11d49},{0x01a0a5b1,0x1b288cf6},
+{0x01a00bb8,0x49034b8c},{0x0341e8b9,0xa1e2e9ca},{0x042025f6,0x87039bf3},{0x03e01e02,0x2857eaff},
+{0x0321e7f5,0x2e88c906},{0x02e028e5,0x4e5ef025},{0x03600173,0x1f3e2a6c},{0x02801419,0x4035f833},
+{0x02e1da19,0x06e38adf},{0x01a0a6e4,0x870e2fce},{0x0320a961,0xbd18b64f},{0x02802e26,0x6bfd2caa},
+{0x020108f2,0x8c6b60bb},{0x02210fe1,0x39b2e6bc},{0x02a11661,0xd2737ed5},{0x02a16954,0x80499939},
+{0x02411143,0x649f90a9},{0x01e16a94,0x1c9d2548},{0x03c01f28,0x6d8459f6},{0x02411234,0x47d75fdd},
+{0x0320a78d,0xaef6435b},{0x03001df7,0x45c28640},{0x056027a5,0x7be11104},{0x02c104c9,0x81717e30},
+{0x0240a739,0xec872fe7},{0x0461d8c1,0x7a69f26e},{0x0300ff71,0xcf772011},{0x01c0a260,0xbfe558cd},
+{0x02e13031,0xd15b45b5},{0x0441d761,0x77322802},{0x024114c1,0x31467c66},{0x02a031fa,0x3b0cb7a4},
+{0x02e14471,0x0e0fc27c},{0x02a02834,0x178e6666},{0x02800db8,0x2e7d8cc8},{0x02e131bd,0x87877a0e},
+{0x01a0a38a,0x034a13fa},{0x0180a4df,0x3efd51e4},{0x01003372,0x959953e5},{0x01e10675,0x3f28b333},
+{0x03e18b5f,0xebc8fe97},{0x02c1335e,0xd1bea170},{0x0321d183,0x823751ad},{0x024106b1,0x2172e193},
+{0x02c11a5b,0x34820e6f},{0x03611a8c,0x23d7e146},{0x03201abd,0xb82ac224},{0x0241190c,0x8f9942ba},
+{0x01e0170c,0x7066b212},{0x01c00c87,0x01375856},{0x04a0203a,0xe7c8555d},{0x030121f3,0x9db2cb06},
+{0x0461d7ef,0x56f81987},{0x02a1f838,0xc5f3a289},{0x03801e11,0xe12b0512},{0x02c02856,0xb278268b},
+{0x04a01b79,0xbd63b97c},{0x02011c77,0x28a0cb17},{0x02201b59,0xc0bc957b},{0x02e02c8e,0x009799d5},
+{0x0121f54d,0x825f5c11},{0x02c02b2c,0xf4c30032},{0x03212117,0xcd7ccfec},{0x02c130d5,0x0cce03dc},
+{0x01a02eb8,0xe07448a4},{0x0160224b,0xce358139},{0x03c0fffa,0xebff12d0},{0x02002ebd,0x6f016058},
+{0x05201f5d,0xcae7ce47},{0x04c001dc,0xfb7ff592},{0x0301d463,0xbcca2342},{0x01e02074,0xa17e3feb},
+{0x0240a729,0x26b5566a},{0x0380fb66,0x9b7798a9},{0x02601284,0x671698be},{0x03a1ee1d,0xfc22c057},
+{0x02011155,0x3e9c0968},{0x0420fd2b,0x1e21d56f},{0x028110d0,0x01132e65},{0x02418892,0xfeddd513},
+{0x02800922,0x69a5fff0},{0x01003377,0x99995a31},{0x02e1f01e,0x799848cf},{0x03610550,0xb67c71ce},
+{0x0341e883,0x08dee497},{0x02e0261b,0x8cdc4414},{0x0201fa65,0x8b7e331e},{0x0401d731,0xc82126e5},
+{0x028e0183,0x01659ad2},{0x040025f1,0xddf85333},{0x02418a50,0x2e4995e6},{0x02c0aa62,0x3fe77cc0},
+{0x02418ad1,0xe31b8498},{0x03410089,0x352c61fb},{0x0340abdc,0x98c38991},{0x0401f114,0x25301616},
+{0x02001821,0x5a7e957a},{0x01a102ba,0xc6f0b8aa},{0x0240d7c2,0x027d935b},{0x03c1f222,0xb81a805a},
+{0x01c0a17c,0x95d89f9c},{0x02a0184d,0x5de955ed},{0x0201f32a,0xc64af8c3},{0x0301041c,0x0237dfd1},
+{0x04e0069a,0x20e43e33},{0x0241fbf5,0x322582d0},{0x01c0a360,0x13649ade},{0x04210f55,0xd1c1bd3e},
+{0x01e00c58,0xae6b62cf},{0x03e01cb3,0x742a5919},{0x02212247,0x855f0926},{0x008026cf,0xe67669f8},
+{0x03c10140,0x9b95c080},{0x0240337e,0x65e5e1d1},{0x0221109a,0xd74f5982},{0x0441f17f,0x57459d13},
+{0x02202d37,0x150a92a9},{0x02418851,0xe86b5653},{0x01c0a434,0x61db09a6},{0x0180a0e4,0x4a8a910a},
+{0x03401540,0x4f47337f},{0x02e16923,0xc1b10932},{0x03603217,0x4a11e80e},{0x03a0fa71,0x353b8367},
+{0x0121f16d,0x78417dcd},{0x02c101d6,0x171ec12f},{0x0201061a,0xab2dc225},{0x02c13171,0x3acb1de3},
+{0x04e01f0c,0xcc2a3cd2},{0x03012538,0xf2438726},{0x02e1fb71,0x5f0cbbfa},{0x02c13254,0x83adbfae},
+{0x0221bc37,0x891f5624},{0x02201839,0x88426e52},{0x01e0a6c4,0x907f7970},{0x02211a53,0x25981d56},
+{0x01e00bc6,0xdc2ef893},{0x0180a282,0x9e88d6af},{0x01c0a23c,0x130a2670},{0x02800934,0x0bdb7e44},
+{0x03612505,0xaae55645},{0x0520fd5a,0xe18f2d71},{0x01e10b25,0xa5436288},{0x01e0a6c3,0x26693a81},
+{0x026003c1,0xa4a88a51},{0x02e1339c,0x464006f8},{0x02601092,0xa990cb49},{0x01a11745,0x7691d063},
+{0x01a1181e,0xba4d2d03},{0x03a12419,0x98a97a94},{0x01c0098f,0x3321d744},{0x03812542,0xb92a8dd4},
+{0x03601db8,0x615a0998},{0x03e18bf9,0x99e0df95},{0x0241b002,0x53eb1495},{0x026119c7,0xebb80d0f},
+{0x0141faf6,0xafc3198b},{0x0301f83c,0x72a89fb3},{0x02a021a7,0x6e7cd2ee},{0x03c0238b,0x26db4691},
+{0x036015c6,0xa50ad49e},{0x01e00850,0xb7b59271},{0x03210cc4,0x639a858a},{0x0221082b,0xbbd9f81b},
+{0x02410f32,0xd5437b8e},{0x02e12535,0xb3105574},{0x01e0a90a,0x0ec26b0a},{0x01a11809,0xf2272152},
+{0x02e144dc,0x18211b5b},{0x0280fb06,0x60193046},{0x02801944,0x88ed8388},{0x02e02141,0x158216a8},
+{0x0180a296,0x7a6cc786},{0x0201bc5c,0x83cd4ff1},{0x01e1bc44,0xfa677742},{0x04003190,0x9bb30976},
+{0x0620fda4,0x35e487f7},{0x0121f620,0xd90ea5c7},{0x022010e0,0x6d11cf9d},{0x0181f7a9,0x99eade47},
+{0x02202f55,0xb867fea5},{0x0320a646,0xb7f942db},{0x03e1d069,0x3624f0a1},{0x0280ab0a,0xc4c87fc3},
+{0x03001127,0x7115a5d8},{0x0240202f,0x3474f9f2},{0x01a0a3d7,0x3e55a9ce},{0x02c130d8,0x0fce0895},
+{0x0341d212,0x0a4d9bdc},{0x026012b8,0xeb17a656},{0x0320ff78,0xe06e3972},{0x0401d222,0x0b41c527},
+{0x02012301,0x57c66a5b},{0x01c1f632,0xf019138e},{0x02ce0041,0x6e3c67a4},{0x03a0faaa,0xd8700235},
+{0x02010628,0x2c287d0a},{0x01e1d2e1,0xb22743f3},{0x03410c89,0x2a432d50},{0x03c1da66,0x838c94f0},
+{0x0401e00f,0x55d2afd7},{0x01a0a3b8,0xb27b493f},{0x01c11309,0xb0dc4f09},{0x0301f060,0x1882d7cc},
+{0x02418a34,0x4038691b},{0x0380a8e0,0x7d82737a},{0x02811953,0xe54e797d},{0x0721d82e,0xcab3f39d},
+{0x03a0155c,0xa5cc1cbd},{0x020115ac,0xb61d0e52},{0x03c124bd,0xf42a4a9b},{0x01c0a14e,0xf84da24e},
+{0x03812523,0x0d645eed},{0x026124fe,0x5431aebe},{0x02a1683b,0x606ba034},{0x03e0236f,0xba5de925},
+{0x0301223a,0xc45e6547},{0x0400a652,0xe2503fdb},{0x01c16f36,0x72e1910f},{0x01e16f72,0xd3ccd20f},
+{0x02e1011d,0x40c1f0bf},{0x01a0a318,0xcf8cc007},{0x02a0a65f,0x3ac50590},{0x02a0ab03,0xee0c3c0e},
+{0x06001f5f,0xa10b1a8f},{0x024008f3,0x4eb285b5},{0x01e00b4b,0xc8d387b0},{0x05c01f6e,0x5fea5695},
+{0x0701d9cc,0xc7e65d75},{0x02a019c4,0x2c2cb19a},{0x0160331e,0x96975ae0},{0x02602595,0x8a0908e3},
+{0x01a01365,0x5a88f19b},{0x01e115ae,0xe91f6676},{0x03e18c22,0x7d9ff42f},{0x02a014b8,0x709be7a2},
+{0x0160a4b3,0x29ac558c},{0x02812f91,0xadfc4997},{0x01e11fda,0x842a7d19},{0x01616a62,0x4ddc0466},
+{0x02010193,0xf43f728f},{0x02404dc4,0xac9fe044},{0x02c1209a,0x86afb099},{0x01e0200d,0x0ed7b722},
+{0x0441f187,0x5f45a9ab},{0x02802850,0x9c979848},{0x03e1d578,0x5cf4eea6},{0x02418afb,0x6911ca2e},
+{0x0581f51b,0x4f938e17},{0x0621fb5a,0xf5b49fda},{0x03e00510,0xc79e4ca3},{0x02e145b5,0xf62ae60b},
+{0x02801584,0x3cc560c9},{0x03e18b6a,0x10cb776d},{0x03c00450,0x00354ed2},{0x01a1029b,0x0aee21af},
+{0x02a02069,0xc5870ffd},{0x02a11fef,0x3cd5a0c9},{0x02e1309b,0x5454d7ed},{0x03200b75,0x81a2f057},
+{0x0401da38,0x8a412f88},{0x03c11a0a,0x3f815c56},{0x02e02182,0xc94e5179},{0x0180a00f,0x994ca4a8},
+{0x0641fb3c,0x331233a9},{0x01a116a9,0xb9fc6c39},{0x02001b15,0xe2fed9d2},{0x04402507,0xdb8ca8fe},
+{0x03c121cb,0xcee3c9df},{0x01c10508,0x020bd474},{0x02411ff0,0xcf1bd927},{0x0241f263,0x20af684e},
+{0x0701d9cd,0xcafaa841},{0x02202d3b,0x07fff0d6},{0x03612010,0xf02e7c2f},{0x022009cb,0x58475ce8},
+{0x02c1308b,0xa7289420},{0x02e1320a,0x9de6edc9},{0x01202713,0x094ed3f2},{0x03210c1d,0xad5170c1},
+{0x03e1d7f9,0x77b236d3},{0x0201bc0d,0x49f1c57c},{0x02a1ee19,0x700ed896},{0x03a1ed1b,0x1c2ba555},
+{0x0101f952,0x7ece18d9},{0x04c01e2f,0x945b7fd7},{0x0240089e,0x97046fb9},{0x0320208e,0xc0020e1c},
+{0x02c0057e,0x684fe715},{0x03210f03,0x55db2f26},{0x028187f0,0xe689d2b9},{0x02411952,0x886143c7},
+{0x03802cf1,0x4f0b100d},{0x05012473,0x01f94b2d},{0x0400303b,0xc3704cc8},{0x04601eda,0x64cbf6d2},
+{0x01e11c7a,0x95771358},{0x0560fd67,0x451dca0c},{0x02010fed,0xa77539c6},{0x01e10b2d,0xc54c8f44},
+{0x0261bc94,0x153a6984},{0x03c024b0,0x0d01435b},{0x02e14514,0x03b0de58},{0x050001be,0x77410cc1},
+{0x0320ff89,0xd6767879},{0x02c13035,0xf7134d8f},{0x034103cb,0x3440c637},{0x0401d541,0x49897f2e},
+{0x03e1f59d,0xdf1d932e},{0x03802071,0x8d24120d},{0x03c008da,0xf4662254},{0x02001c61,0xbc4a6850},
+{0x04a1d66d,0x281aefd9},{0x02ce004c,0x633c5653},{0x05a0fd98,0x576e6821},{0x02810d21,0xb3b86045},
+{0x02e02d48,0xac264ce6},{0x02418abd,0xdb16fad2},{0x04c02773,0x21c4c05e},{0x02c1bc22,0x346a0024},
+{0x02a00568,0x6aae9d98},{0x020111d4,0x961c9a00},{0x02e1683e,0x9e145611},{0x02801c33,0x4d6bb040},
+{0x02c10d1c,0xbb2f552a},{0x0240122a,0xc520df05},{0x05a1d8e5,0xfcf11657},{0x0341f515,0xf50d100b},
+{0x02c132b8,0xf69dda5e},{0x0520fdc1,0x9bb77d73},{0x01c0a0b2,0xb09e1f7c},{0x0301f771,0x3def1137},
+{0x030007ef,0x00659b2d},{0x01a1144e,0x9bcdc26e},{0x04601b6b,0x4bef353f},{0x0381f569,0x344b1c04},
+{0x03202a75,0x1e98af22},{0x04001c3c,0xba9047f0},{0x024188df,0x140ea225},{0x04601db5,0x4070867d},
+{0x02400938,0x005bfef3},{0x0341f0c7,0x0425b670},{0x03c1f214,0x87b54c87},{0x0380ab65,0x6a233a8d},
+{0x02c131bb,0x52fa9fce},{0x02e13067,0x6dd4bfda},{0x0340a779,0xcfe72045},{0x04401d99,0x6f8c90e9},
+{0x04e1d653,0x0be1b71c},{0x02a1000e,0xa8ac4824},{0x044109f7,0x56fa7a07},{0x01a0a093,0xef95f06f},
+{0x02e16e6f,0x59d4441f},{0x02a030ee,0x8b434f8e},{0x01e00b22,0x9820224e},{0x02a169f4,0xfb263ef8},
+{0x0441f178,0x6e45c148},{0x03e1d607,0x8105d8a3},{0x0140238c,0xec7506e7},{0x0380010c,0xb97c9867},
+{0x0321d804,0x1c1ac7f8},{0x02e1204f,0x1d752215},{0x02418a4f,0x2f499779},{0x02a01590,0x21be5525},
+{0x0300d7ef,0x53730b3b},{0x03e004c9,0x59012b11},{0x0101f334,0x3f5b4a9d},{0x02010f42,0xc112ff6c},
+{0x04001eba,0x51fa5ae6},{0x02c13331,0xff0f8bc1},{0x0200263c,0x6a336a1d},{0x0380a7c0,0x76aaf372},
+{0x02802263,0x4f996656},{0x03801def,0x1ff0ec44},{0x01e0a253,0x1554e4cd},{0x02c1059b,0xbd6cb231},
+{0x0301324f,0x1feb25b3},{0x02418ac3,0xe1170444},{0x01e0101d,0x309fc384},{0x01800b92,0x2e600d01},
+{0x02e006ab,0x2c0ba6c3},{0x01c0a235,0x272cd82e},{0x01a0a6f3,0x0e14cbac},{0x0280124c,0xfe5c7222},
+{0x030012a1,0x693be57c},{0x01e1129b,0x7d5dead0},{0x01c0a07d,0x0e627b92},{0x02802db9,0x9d3af55d},
+{0x02812fbe,0x1af0293b},{0x01e029b7,0xc34c8e60},{0x03c1f59a,0xf353b8c6},{0x0461d0dc,0x8d334ce4},
+{0x042002a8,0xc99f3564},{0x01a0228e,0x19bbb281},{0x02002405,0xfff4c801},{0x03c0a967,0x0b883485},
+{0x0241e92c,0x71dc3388},{0x01e01711,0x6c3bcabf},{0x01e0a34c,0x5694796b},{0x01e11286,0x8587456f},
+{0x02e00583,0x4271752b},{0x02e03186,0xa561a033},{0x0801d1ce,0x979a5f1b},{0x02400aed,0x5fb0ccbc},
+{0x02212192,0xdd2c205c},{0x02c130a0,0x3b25ab85},{0x0341d43f,0x3bb2c6e1},{0x02210613,0xbc17da03},
+{0x020013d5,0xebf1dec2},{0x07c02967,0xc120af2d},{0x00a02032,0x072a30e0},{0x03a0fad1,0xa47c7c4c},
+{0x02e1337d,0xaae64ebf},{0x0301d33c,0x73df3ba4},{0x01e10b01,0x711e3fd3},{0x01003398,0xbab564a1},
+{0x0341013e,0x91368d80},{0x02c0a8f8,0x0c18b409},{0x0241d1ea,0x0386fa4a},{0x02c0a9c2,0x27732741},
+{0x02418940,0x2a8120e5},{0x020027db,0xd1ea89b0},{0x01e0a08f,0xdf5cb860},{0x0061f32b,0xe4cd895f},
+{0x04002563,0xc9c128b2},{0x0200aadd,0x3cfb77e4},{0x02401208,0x08eb3017},{0x0281f58b,0x32ddb21a},
+{0x03603017,0x63781d33},{0x0401cf95,0xd81cceb3},{0x01e102cd,0x0f74878c},{0x0361f601,0x66e07411},
+{0x02010451,0x6c7c1c16},{0x02e13339,0x1d398549},{0x04c101fd,0x7c4c85a7},{0x0180a123,0x8e8f7944},
+{0x0421d23e,0xc268db13},{0x05402542,0x06c21b21},{0x02811d0b,0x19a51896},{0x02211c2e,0xe8699041},
+{0x0261b023,0x47501e56},{0x0501fa4c,0xf4084a4d},{0x02a169ca,0xbf899fb6},{0x01e1072e,0x866eec9e},
+{0x02418a6d,0xc9a9011f},{0x02810000,0x14c9aee7},{0x020032d2,0x41a9b09c},{0x0161e2a6,0x955a9930},
+{0x03810af5,0xe8e266da},{0x050033ed,0x32e010b3},{0x01e01c40,0xef99c3a7},{0x0121f635,0x46aa2bf8},
+{0x0360fb56,0xcb45b017},{0x01811416,0x14509f9d},{0x03200fa9,0x9fb9cc4b},{0x01e01042,0x49984ed1},
+{0x0100338a,0x8ecae5ac},{0x03a01f76,0xd109c388},{0x0360293b,0xccaa4ec5},{0x01e10e6e,0xbf59aefe},
+{0x0261e931,0x6e2e12a6},{0x02a0094f,0xf3332cbd},{0x03a0303e,0xd8da52ba},{0x0261fa6b,0x3f3aab91},
+{0x03402980,0xe65c5a9d},{0x02212138,0xfb0a2883},{0x02a008ea,0x258f8e8b},{0x04a1fa16,0xaf406b11},
+{0x03a10a0d,0x429ca81b},{0x03610555,0x5eb659a9},{0x01a0a0c1,0x28a00557},{0x03a00126,0xaac41aad},
+{0x0180aa15,0x33700647},{0x028014db,0xe7e600f6},{0x0260309f,0x7f7c07e2},{0x03002189,0xde700068},
+{0x02210475,0x9d2e5474},{0x02211c13,0x105275ea},{0x03400505,0xae973eb2},{0x02800f08,0xcf44a89f},
+{0x02e00f3d,0xb75b3442},{0x05c01f57,0x654905cc},{0x02400c3d,0x45181c55},{0x01a0a0fb,0xea4a3846},
+{0x03c0016f,0xa4f802d6},{0x00a1f96f,0x51dd6ed0},{0x034011ec,0x76102168},{0x01e02e4d,0xa4380690},
+{0x05e01f98,0xe31e7ebb},{0x03c1f210,0xdc4d7b17},{0x0260093c,0xbe0ccdbf},{0x03e1d737,0xc02ed73f},
+{0x01c11483,0x89714d77},{0x01a0a248,0xab67ba2e},{0x03000531,0xa65bb4ca},{0x0321084f,0x5391e595},
+{0x03402c11,0x626dd894},{0x02416ae4,0x6b6ff689},{0x0341e806,0x416bc60c},{0x02c018e8,0xfca0e22c},
+{0x0340ff59,0xf0e0baa0},{0x03410ce5,0xdc681aa0},{0x03201113,0xab804221},{0x04c01ef0,0x084a18b8},
+{0x01e00c23,0x48c962f8},{0x03410f01,0x4425ef19},{0x0180a116,0x9a687cb8},{0x04e1d642,0x02e1a8f1},
+{0x02601583,0xd0b2fdf2},{0x01a11fe6,0x85f52268},{0x03400ac4,0x16c4c177},{0x026e0141,0xa38b35b1},
+{0x03a01ecb,0xe9bd9cbb},{0x02e10c23,0x3256eef2},{0x02c13216,0x7175180f},{0x00c02645,0x6c079c0d},
+{0x05801f90,0x090e8940},{0x06e01ded,0x75d2198c},{0x0180a020,0x4a58f43e},{0x02c01929,0x6bcab0a1},
+{0x03e018f5,0x2d5682bd},{0x024104e4,0x5ec274e1},{0x030024d9,0x48b6a16c},{0x04e1d646,0xfee1a2a5},
+{0x03612434,0xf8f48aaf},{0x028019ba,0x899f4c89},{0x014023f0,0x3ce4cc14},{0x02002f17,0xa4a7a9f0},
+{0x01c16ab0,0xd8ef306a},{0x0481d149,0xbd800781},{0x0280123b,0x1c1a582d},{0x02611943,0xed7367e4},
+{0x0361055b,0x81a0a093},{0x0300fb4b,0x9536ef14},{0x02e02476,0x9c826722},{0x0220068c,0x3a7c0ca3},
+{0x0341d030,0x25c0ed43},{0x02602810,0xc81c53af},{0x03a1d07e,0xead8ce71},{0x02411911,0xbfad1602},
+{0x04a1d81f,0xa6f52fc2},{0x02401b53,0xf45ae3e1},{0x0500fdab,0xdb11e80a},{0x02c13187,0xb032db55},
+{0x0261b0f1,0xb4cc87bd},{0x00c1f3b8,0x12874dcf},{0x06201f89,0xd24a6c9c},{0x02000327,0xd85ca1c5},
+{0x03612507,0xa16a6317},{0x024025b0,0xf1b0f1d7},{0x01a0a5b6,0x170832ff},{0x03812274,0xdcb6f5fe},
+{0x02816a09,0x76d17d52},{0x01e0101a,0x1c7d11c6},{0x03216e52,0x70855b22},{0x03c1ed37,0x612ad3a0},
+{0x0380fd40,0x4aec6b4c},{0x0340ff43,0x0ae0e38e},{0x0340ffa4,0x8e1bd82c},{0x02800b60,0x3bf8c8a2},
+{0x0241e928,0x9a07ff1e},{0x01e11c8e,0xfd6d29b4},{0x02c1bc80,0xf00c8903},{0x0340ff4c,0x05e0dbaf},
+{0x028021e8,0x328260ce},{0x03601413,0xfd249f1a},{0x020013db,0xdaf1c3ff},{0x0360a8ec,0x919f5093},
+{0x0220ff0b,0x77287009},{0x02c0184a,0x3d5abe65},{0x02418a2c,0xb23fd856},{0x02e1b001,0xef76573f},
+{0x02800def,0xb2643143},{0x02c0ab9b,0xf4a30dd0},{0x01a0334d,0x09af23bb},{0x0241226d,0x5fdf4ba6},
+{0x0300a867,0xa750acc0},{0x016020b4,0x7cc072d5},{0x0341213c,0x491d7307},{0x03210130,0x7ad10946},
+{0x02a122d4,0xa7941eb6},{0x03e1f8a0,0x4bdb2ebd},{0x02210ff3,0x62caa143},{0x03016b6e,0x1b95adf8},
+{0x02401bbc,0x3ce63e17},{0x03010c44,0x01e43bdd},{0x02a01990,0xb156ee74},{0x02e03172,0x66e3ab8f},
+{0x02e14409,0xb67ad84d},{0x02a16839,0x4e1f61c3},{0x02400d66,0x438d1a0f},{0x01a0a2c9,0xbc467f1f},
+{0x014023cd,0xee7177e6},{0x01e106b6,0x3db33a94},{0x0240fe04,0x6768976a},{0x01e10681,0x4b37d0a1},
+{0x0340036a,0x271b6098},{0x0220240a,0x03b3619e},{0x01e00f51,0x098710b1},{0x02c13336,0x4cb7144c},
+{0x02c13063,0x0a9bcd6f},{0x0461d09b,0x67e073eb},{0x024106ad,0x9bfc329f},{0x02c008bc,0x7145e35d},
+{0x04a1cf8c,0x2e50fb1d},{0x02c02172,0x440bf7a7},{0x03200fab,0x4300c2d6},{0x0361f772,0x6dfe0abe},
+{0x0441f182,0x58459ea6},{0x04c1d14e,0x76d4bed8},{0x0341d20f,0x114da6e1},{0x0501d06e,0xcbb275ea},
+{0x02c132fa,0x5b45871e},{0x03c01fd1,0x7c37dfeb},{0x0301ed0c,0x5930d037},{0x03401609,0x1138aa50},
+{0x0401d53b,0x438975bc},{0x02c13041,0xfa1590df},{0x01a016f2,0xfa4af901},{0x03000532,0xb4a02e87},
+{0x01e0aab9,0x122bb9db},{0x02c102ef,0x9005beb2},{0x01e0a436,0x08049317},{0x0380250c,0x3fa4279e},
+{0x028e01d4,0x8dd2c326},{0x024189a3,0xa1cfa19f},{0x02210347,0x75b64b62},{0x0281cf6e,0x9768cf4a},
+{0x02410904,0x2bb6acd0},{0x030032b2,0xced15ccf},{0x01a0a124,0x7fdb9a7c},{0x0261192e,0x8bd9264d},
+{0x02a003e1,0x3dc1a41a},{0x02a1fa51,0x0928f925},{0x02a00581,0xb5aa967b},{0x02a01533,0x719ddd4e},
+{0x0261b090,0x6caeeb7c},{0x03801ceb,0xb539e0f5},{0x02c13049,0x7a1898f6},{0x02e145e8,0xe8f74fac},
+{0x03c021df,0x6adf461c},{0x0081f33f,0x642b736a},{0x03011cab,0x16b049a9},{0x03410a96,0x128356e8},
+{0x02801b23,0xaaacb3e2},{0x0200220b,0x5be17b4a},{0x02a104b5,0xf4141178},{0x01c0a3de,0xd942666c},
+{0x02000a15,0xedea67e7},{0x03e18b12,0x0fd2319f},{0x032016f7,0x56ac6b38},{0x0301d4b9,0x45a12e3b},
+{0x02a10036,0xc7a8818a},{0x02202f73,0x07717ec4},{0x01c0a592,0x31a8c874},{0x01e1202d,0x870a77b3},
+{0x02e133eb,0xfd733d09},{0x0381078e,0x5fac6d60},{0x01003385,0xb4b55b2f},{0x03e01e1e,0x4748528b},
+{0x01c0a099,0x201ddc8d},{0x02611c5e,0x3ddc9567},{0x02418a6a,0x4aac0ac9},{0x0381d4fe,0xddcfbb87},
+{0x0701d9cf,0xfb5a2db0},{0x02e00861,0x441294ae},{0x02a1d876,0xcedad1d9},{0x01e02161,0x4b796032},
+{0x02a0ab87,0xe52ce51f},{0x0481f595,0x9b0ec8bf},{0x028105a5,0x482faec4},{0x01a11681,0x0e12b6c4},
+{0x04a02b94,0xf88b5361},{0x0320a9b0,0x8aeecdc7},{0x03a1d5a1,0x507bacb9},{0x0221105f,0x93242ffb},
+{0x03e18b16,0x0bd22b53},{0x03a0fa84,0x224cae9f},{0x0361d735,0xcb79a8c4},{0x02e16fe4,0x74fe591a},
+{0x04a02532,0xbee9f638},{0x0261d334,0x468b3c13},{0x03a1cf65,0x4981dca5},{0x01803318,0xfa3eb15d},
+{0x05c1fa34,0xc30dabec},{0x01c102c4,0x39dbf628},{0x01a0a3a1,0x714309a6},{0x0480fcc3,0xf68e1a36},
+{0x02616a03,0xf211f376},{0x0261d340,0xf009b2d1},{0x0261b09b,0xf5e5dd21},{0x0261ec72,0x34a96204},
+{0x02c00d90,0xf8087037},{0x05a02a13,0x9f7d2774},{0x03e0a8f3,0xc3471b6b},{0x0141f5e0,0xb78086fb},
+{0x0300a9f9,0xf3ca4c58},{0x04c1d14b,0x76480a05},{0x06e1d986,0xa70fe359},{0x02c131f5,0x037cb9aa},
+{0x03002232,0xf7426b01},{0x01e111d1,0x4605a660},{0x02e00250,0x6e798bc5},{0x0200a6ae,0x4ff06de7},
+{0x0661fb43,0x14709769},{0x01e1f790,0x43b6207c},{0x0221115a,0x02b11bee},{0x03a0fa83,0x1f4ca9e6},
+{0x0440fbbc,0x7a131250},{0x0341e82f,0x052a7944},{0x02801088,0x5bfa1056},{0x02210450,0x9544cb41},
+{0x02a014d4,0xce132cad},{0x024026c4,0xb7d18681},{0x03810986,0x5a249941},{0x02216ae0,0x1827d0ab},
+{0x02211acb,0x1abdac91},{0x0361d68e,0x2b06cfe6},{0x01a0a0dd,0x1aaea05c},{0x034103ca,0x972f69b1},
+{0x0661d0c4,0x32f98817},{0x0240271f,0x813e4f55},{0x020005b7,0x94df74cc},{0x0380d7db,0xdd1b4b70},
+{0x02612222,0x534ec98b},{0x0441da60,0x59de54f2},{0x02600977,0x701d2c40},{0x02200ce9,0x334a18b0},
+{0x0420a748,0xa9aedea1},{0x04612318,0x6660dc7f},{0x03a02c54,0xaba2253d},{0x0201182c,0xe3a845ee},
+{0x03a00fd0,0xe70b471f},{0x01c01722,0x590bb418},{0x02001768,0xecc2e885},{0x02a0203c,0xfdb7a81c},
+{0x03402c00,0x71d0d3fa},{0x03a124ac,0x84f243d4},{0x01c02a57,0x35de7e03},{0x0200ffe5,0xfa84fdb5},
+{0x02a015a3,0x82620d6e},{0x02a1b150,0x293bb6d9},{0x03c1d1c1,0xa52c4b3c},{0x01a0a04a,0xd9b022d8},
+{0x00a1f977,0xa346f44b},{0x02e145f2,0xe8f98e43},{0x02c13073,0x9d96a4aa},{0x02610873,0x578e0d40},
+{0x02012081,0x37c2b948},{0x028007f5,0x206d30ee},{0x0361e8a6,0xc47478bd},{0x04202368,0x6c58eaea},
+{0x02002008,0xb50b9b73},{0x0501da75,0x83f0b1eb},{0x01a102ad,0xd7f0d36d},{0x02411d47,0x8a80a3ec},
+{0x00c1f32d,0x6c9b7fbe},{0x01a0a3da,0xf238b016},{0x01e0a3af,0xed9e4028},{0x02c13132,0x6d208d41},
+{0x0561f820,0xb821f66e},{0x01a01363,0xe85b068b},{0x03200543,0xe2579250},{0x02201162,0xcb8d5442},
+{0x0341f140,0xfc010bbb},{0x01a1f627,0x6c8a6ae2},{0x02202f13,0x1b7e2d89},{0x02c0045a,0x727833d6},
+{0x04a1d669,0x341b02bd},{0x010033d8,0x99caf6fd},{0x032028f7,0x0e3f4c44},{0x04e1f805,0x109d9be2},
+{0x01e01019,0x545f54da},{0x01a00ba8,0x9d319afd},{0x03000ce2,0x9d8f0a16},{0x03401d29,0x1ba46441},
+{0x02418a64,0x50ac143b},{0x0361ed3c,0x29ceb8f9},{0x03a00117,0x9a7f133b},{0x0180aa24,0xe383100f},
+{0x01a0aa59,0x0dcce705},{0x01a02226,0x8d3a4ac4},{0x02e1253d,0xf0284c4a},{0x02a02f22,0x4f8174ad},
+{0x026e0127,0x25a645d4},{0x03001bff,0xfcdbe554},{0x02e14573,0x73417121},{0x02c028c9,0x320a0dfa},
+{0x02200a96,0xd4bdd0f0},{0x05201ea4,0x24e320bf},{0x03a1d5aa,0x577bb7be},{0x02c13124,0x6a0f3f67},
+{0x02a10fc7,0xf449a529},{0x0460fcde,0xd8e8f60b},{0x03c00db4,0xaf980b2e},{0x0140225e,0xac0eefc0},
+{0x03c120c2,0xfa17cee4},{0x01e0a50f,0xfb85ceb5},{0x0561cf6a,0xfca3f51e},{0x01c1158a,0x66227284},
+{0x03a1253a,0x302be28e},{0x02e14440,0x2670fb41},{0x00e1f42e,0x7e006d51},{0x03e1d87a,0x3b2914a8},
+{0x01a0a48c,0x4c1571fd},{0x030028de,0xe4e5805b},{0x0260a893,0x9d9cff4f},{0x01c11221,0x2ae36c1a},
+{0x0180a1dc,0x46613cb7},{0x0281bc63,0x8d570fb3},{0x022025fb,0x815f012e},{0x03216e55,0x6c8554d6},
+{0x03e18b34,0x99d7880b},{0x03c01524,0x739ea97e},{0x03a0faab,0xd56ffd7c},{0x02a0aba9,0x1f40c825},
+{0x0161f5dc,0xb262d815},{0x022005ae,0x0fb4f070},{0x032014c6,0xa9c57750},{0x03e0106b,0x0b11b35b},
+{0x03e18b50,0x99c87d81},{0x02601299,0x20b899cc},{0x02a0a7b7,0x2fff4f93},{0x02c1f07f,0x3160acf3},
+{0x014031d2,0x5d397353},{0x03012124,0x48c941e7},{0x0221d2e3,0x80206527},{0x0360fec5,0xb30eecc5},
+{0x0301d4c9,0x35a1150b},{0x0381e100,0x0a76cce5},{0x0581d83e,0x4282936f},{0x04a1d75d,0x199b1900},
+{0x0380a975,0xf0f8b4ad},{0x016e0001,0xd10f8a09},{0x05c1fb66,0xfcdcd7ba},{0x050008c4,0x32a7b260},
+{0x03e18c1a,0x36a1c301},{0x022008d3,0xbe4c8817},{0x03e10b54,0x2e438621},{0x05810798,0x3e816083},
+{0x01e111a0,0xbd3a7cb8},{0x02a02849,0x3e24de66},{0x028e01eb,0x92df96f8},{0x02801580,0xe4d9f0f9},
+{0x026124f9,0x3d409513},{0x01c0a1ae,0xd45a7fda},{0x01e01c19,0x126b1895},{0x028e0075,0x8ac24855},
+{0x02c04df4,0xfed4fdb6},{0x0201132b,0x29426ded},{0x02210e98,0x95923bc7},{0x03601654,0x9003d1fa},
+{0x032001b4,0x99f56f94},{0x02e14482,0x170fd0a7},{0x0321fb78,0x61828c59},{0x0321f012,0x898cae0b},
+{0x03210cd2,0x5c9a7a85},{0x02002f00,0xd15659cb},{0x02e1455d,0xe63c15fc},{0x03000cc3,0x978f00a4},
+{0x02e14624,0x66de7e20},{0x01e103a1,0xbe1a902a},{0x032001c3,0x22331f14},{0x0381f767,0xf50f72cb},
+{0x01e0a365,0x187373ec},{0x0200270e,0x3b22c9ed},{0x04a11a3a,0xda274b05},{0x02a003a4,0xe4ea14ed},
+{0x02c133a7,0x28bbe4d7},{0x032018d4,0x253e5e47},{0x030024e7,0x5ab6bdc2},{0x0261018b,0x96ff02be},
+{0x0280065f,0x8aefcc3c},{0x0341f0c8,0x9f68655e},{0x0181e2ab,0xa2a8a6bb},{0x01811806,0x4e82fb3f},
+{0x01a0a050,0x19b981f4},{0x03a0267b,0x2c05e0a5},{0x03e0d7d6,0x2d352286},{0x02601096,0xb63bae8b},
+{0x02200aa5,0xb8a4df25},{0x038015fe,0xee7cab84},{0x02e13391,0x0054b37e},{0x02c11cb6,0xdd077781},
+{0x01a11206,0xa54160b8},{0x01e11016,0xb397397c},{0x014026d0,0x3f6a8185},{0x0241894f,0x358370cd},
+{0x03e1d601,0x8f05eead},{0x02a018b6,0x697030a1},{0x02e132b1,0x958b8934},{0x0361d5ce,0xde9cb0b5},
+{0x02e12370,0xa706a7b4},{0x02402f14,0xbbcf0982},{0x0180a4d3,0x6ae7d0d9},{0x02c132c2,0xf59b9a34},
+{0x040023f5,0x72d7e2e9},{0x0340ff55,0xfce0cd84},{0x02e00702,0x7cb04216},{0x0360163a,0x38e09ec7},
+{0x03412525,0x26e0dd69},{0x01e0170e,0x5432aa9b},{0x03200701,0x486bbb59},{0x02800300,0xa37fa32c},
+{0x032121c1,0x347d9aea},{0x02810860,0x4b166c64},{0x0160a4f4,0x7010ff85},{0x01c0a58e,0xd82a0c70},
+{0x0320a79d,0xe51a011c},{0x03612003,0xf4601c59},{0x03c0fbe3,0x1e0a42ff},{0x022010d6,0xc93d7b98},
+{0x02c02878,0x7710e610},{0x06802b7b,0x54f07640},{0x02a0a8c0,0x5f96602f},{0x01c0a01d,0xc6becc2b},
+{0x0261b057,0xc3f9d6f4},{0x04e0fd0c,0x5d3f2e88},{0x0361d8c6,0x64c51747},{0x02602bc2,0x57222eee},
+{0x03a0018b,0xe9bc6c55},{0x028105b7,0x4c2fb510},{0x0341d446,0x24b2a2ac},{0x01e00ba9,0x862e56b1},
+{0x03203200,0x40a26928},{0x044021b4,0x25da7147},{0x02400e42,0xa32b9a50},{0x0240290a,0x52b090c4},
+{0x02e1f0a4,0x565f7fdc},{0x01e01c12,0xcac58f25},{0x02401232,0xf9236f78},{0x03e18c9d,0x098df472},
+{0x01202294,0x8f195cea},{0x0421d082,0x4577a020},{0x0380103c,0x8c93055d},{0x0440fc93,0xe4546b14},
+{0x026108aa,0xe5e42fcb},{0x02a01565,0xf3ad75b6},{0x02c1fbca,0x6041edf0},{0x01e1109f,0xa641b722},
+{0x0340159a,0xbd2e1bbc},{0x02012309,0x9fe4f0c7},{0x062009f8,0x02d92810},{0x02c10d0a,0xa70ca36c},
+{0x03016870,0x0190258a},{0x01402260,0x6f2c9823},{0x02601037,0x87f8eae1},{0x02c00463,0x9a4d657b},
+{0x034007f3,0x34599916},{0x024189a0,0x2ec830d1},{0x03e18b52,0x97c87a5b},{0x0260132a,0x9a9c8136},
+{0x0200a770,0x6ac34644},{0x0580fc35,0x6ae4cc41},{0x030100cf,0xd8400a10},{0x02211c0b,0xe45840d4},
+{0x02016af5,0xbf9cd801},{0x02c10a45,0x8296c66c},{0x03c01e8d,0xf9ac6619},{0x02c13069,0x0f9e13e5},
+{0x03410f4a,0x3a71f3ce},{0x02e144bd,0x0900b013},{0x01a0a23b,0xd59b0580},{0x03212103,0x76f1d664},
+{0x032011f8,0x500bcb04},{0x02210456,0x90056ebe},{0x02c0abb5,0xe7355be8},{0x02810a1d,0xc7b19173},
+{0x04801f23,0x51a09f20},{0x0280aaea,0x42494f8e},{0x0641fb3e,0xff11b9da},{0x0260a4fc,0x25170736},
+{0x038001f8,0x6f287a64},{0x0461d76b,0x1395df97},{0x034024be,0x5065ef48},{0x03402404,0x5b7a9d90},
+{0x02e01bc3,0x1fb73a36},{0x02c132ee,0x5743423b},{0x04a0fd02,0xf9ef058e},{0x01c0a453,0xfb527dfe},
+{0x02002ede,0x7ff93f95},{0x0281cf85,0x282f9e3a},{0x02812fc7,0x1af6e500},{0x0241892e,0xa07bca79},
+{0x030009c3,0x5240302e},{0x01a0a0df,0xdccc53d6},{0x04a004f4,0x135e0a1f},{0x02a1e90e,0x4a179f82},
+{0x0160a4a1,0x739ffe17},{0x0221033a,0x103f1492},{0x0081f467,0xe046ce63},{0x026019d8,0x55f7b015},
+{0x02211c15,0x1c63d1ef},{0x02600815,0x5e9cdab1},{0x0301f014,0x7a5c679d},{0x01c0a205,0x9f767bd0},
+{0x02200734,0x7ab3f064},{0x0341d43e,0x3cb2c874},{0x03e02978,0xcd36ef03},{0x0260241a,0xee1619e0},
+{0x02418999,0x2fc83264},{0x03e1df01,0xc7c4f63e},{0x0441cf14,0xc60b571e},{0x0340a776,0x396de3a4},
+{0x01a0a3d9,0x3c55a6a8},{0x02c130bb,0xaa2ad770},{0x02601383,0x14e85a47},{0x01c16aaa,0xacc35e88},
+{0x010033cc,0x78b979e9},{0x028e01a9,0x735bc0ec},{0x0300a694,0x728499f8},{0x01e10657,0x512d4cb7},
+{0x03c02cc5,0x59d9d150},{0x02a1695c,0x943aae2b},{0x02a019a0,0x4d48d97e},{0x02a169be,0x2120840f},
+{0x042004e5,0x51a1abdb},{0x01c1e2c0,0xc766aa7d},{0x01e1f589,0xcb9b4b9e},{0x03810af1,0xdb0bebeb},
+{0x0200a673,0x698bbdd4},{0x00e02be5,0x5d7ecb30},{0x028187ef,0xf68c2a80},{0x024011a3,0x867b6035},
+{0x02000646,0xd1f67967},{0x02e1446e,0x2d8f1b5a},{0x02c1318b,0x012c5910},{0x0321aff3,0x9d342a41},
+{0x04c01e5d,0xf659c5c9},{0x02e14610,0x7f01362a},{0x0681d9c2,0xe6871c4f},{0x03c11a35,0xdfde789a},
+{0x0440a659,0x349f8a56},{0x0480fd36,0xc2956cbf},{0x0480fd38,0xb3041508},{0x01a11739,0x85e9dd69},
+{0x0320247e,0x4ea0dd31},{0x0241f550,0x341b37bd},{0x02812f99,0xaafa0647},{0x01c0a42e,0xcac8497a},
+{0x01e106ed,0x3fc486db},{0x03a1d03f,0x181cb863},{0x02010478,0xaa7d2cf3},{0x01e1f0a0,0xf7979e48},
+{0x02c1217a,0x3030d0d3},{0x0201064a,0xfd12f58c},{0x02016f7f,0x9855edc6},{0x02e0aa69,0xf7def56d},
+{0x03e18cd2,0x74854559},{0x02003069,0x4e3b2c5f},{0x0221083f,0x9bef8c0a},{0x03e0022e,0x5df05f40},
+{0x02e14458,0xa1763a10},{0x03e1f879,0xdfeaa764},{0x022010d2,0x952a1727},{0x032020d0,0x07f45740},
+{0x02601412,0x12aee8aa},{0x0140fe50,0x5750b95f},{0x02418863,0xfbe85db6},{0x0320fe26,0xbaabea77},
+{0x0320a641,0x1f036cf5},{0x02411101,0x6aa8abfe},{0x0381d6f5,0x6cd8a2e7},{0x04a021cb,0x26de72b0},
+{0x0321f0bc,0xa05684e6},{0x024188e8,0x0d0c5889},{0x0280ab2c,0x7c3ea672},{0x02c1335d,0xd2bea303},
+{0x0320026c,0x2217a73d},{0x04e0fcf2,0x9ecd8719},{0x0280094d,0x35d365a4},{0x0381d6fc,0x9d4bd494},
+{0x0260a807,0x575ebbc4},{0x034001aa,0xdaf0997b},{0x02e1f31c,0xc4caf187},{0x0401d129,0xe6b75dbd},
+{0x02c1d126,0xafb83f39},{0x0241018d,0x8dc270c3},{0x0320fb3e,0xbe47aa0b},{0x0400fdf7,0xc5917655},
+{0x028e01da,0x95d09127},{0x03e1ee6e,0xbc1e00d8},{0x05200f17,0xf2435ef5},{0x01a03313,0x9aa6e747},
+{0x0280a8d8,0x32aeb34f},{0x0380d7d4,0xe2568f79},{0x026119a1,0xdb7d5cb7},{0x02600919,0x361da613},
+{0x0261b033,0x4e6e3e6f},{0x02e14454,0xad764cf4},{0x02e121fe,0x2f06ee0a},{0x034024c0,0x5265f26e},
+{0x0480049a,0xff25bb19},{0x052004fa,0xf5129ab0},{0x02601353,0xca424fbe},{0x01e10698,0xba326f30},
+{0x02812f96,0xa7fc4025},{0x030032ae,0xb801ee36},{0x03e18cbe,0x6989b136},{0x0300072d,0x2b651c5d},
+{0x03a0279d,0x3c2d7970},{0x0381d8b9,0x84abe4a0},{0x0341d6bd,0x8e6ed591},{0x0381e8b3,0x1ffe2615},
+{0x02c13105,0xdc16aea2},{0x02c132e3,0xc74aae50},{0x0381d6ba,0xc96a6c21},{0x0261b092,0xefd6c925},
+{0x03c021ce,0x96271bc8},{0x01a00bec,0x3cbecbdf},{0x038014df,0xd7f1e124},{0x02802841,0x0c8dbb3c},
+{0x022111d3,0xbdbb7374},{0x02a0fe7f,0x5878fbd7},{0x03c1d139,0x4c1a669d},{0x0241190e,0xa7a3f5de},
+{0x01a0a3fb,0xcffbc364},{0x02e11c06,0xa09757eb},{0x0221105e,0x5c3d7ab5},{0x02410f05,0x8608ec42},
+{0x02c13297,0x85ba8ec7},{0x0101f4d6,0xde07a8ac},{0x02600053,0x5f1510d8},{0x02a01a78,0x1db0ca3d},
+{0x02602f84,0x3946b38a},{0x0180a4ea,0x62bce33a},{0x026115c4,0x71de4b37},{0x03210c27,0x39cb0b8d},
+{0x03e12536,0x91a75a4b},{0x044109fb,0x48854ced},{0x02816b54,0x4f2b3852},{0x02200f69,0xc2071218},
+{0x0421d780,0x1caa4a32},{0x02816f3f,0x5843b665},{0x04402b4d,0xe486536c},{0x02812faf,0x9efe7091},
+{0x02011288,0x6e03436f},{0x00a1fab7,0x01abf27c},{0x03a027b3,0x4873447e},{0x02c13347,0xd5ba2a8e},
+{0x01a01b5a,0x9ff0548e},{0x02c131ad,0xcef7916b},{0x01e00639,0x75452c27},{0x0521d8fd,0xb82b9cbd},
+{0x02401bb9,0xc9327d30},{0x01a11446,0xdd4386d2},{0x01c003f1,0x3ba0ec6a},{0x0240126d,0xe92ba50d},
+{0x0541f897,0x97bdf3f0},{0x0201109b,0xf5145ef0},{0x03810799,0x2b09fe9f},{0x056023c8,0x539edefa},
+{0x0380050e,0xf04a8811},{0x02803028,0x0bb8c552},{0x03e18c82,0x7d90e9a5},{0x040016d2,0x5047082a},
+{0x03016905,0xde05994d},{0x01e1f6d2,0xbef4a7ee},{0x02e025d0,0x0af4b280},{0x0461cf1c,0x69624899},
+{0x010033b3,0x5bb051e6},{0x03202270,0x85bf9eaa},{0x02801461,0x10802084},{0x02610905,0x081cb8ca},
+{0x03e111f4,0x92555079},{0x02001763,0x28d012ec},{0x022032fd,0x0b259d85},{0x02a16e83,0xd8445cba},
+{0x02c02272,0x702e4227},{0x02600e32,0x02c63a81},{0x02200b02,0x80f63aff},{0x02a1001c,0xe264e258},
+{0x02e14617,0x63dc3ad0},{0x02010652,0xb0af30ac},{0x02800658,0xb24cb2db},{0x04c1d14a,0x14240427},
+{0x038011fc,0xc6087399},{0x032002aa,0x0ed87dae},{0x0260325a,0xc8747d12},{0x01e106b8,0x3fb33dba},
+{0x02810fbb,0xa8fec546},{0x036024ec,0x8e471326},{0x02c13334,0x4ab71126},{0x028012bc,0x49452fa5},
+{0x024189c4,0x9abe4d79},{0x0381e8b8,0xe938b8dc},{0x01e033a2,0xc4a9245b},{0x03e011ed,0xae58de3e},
+{0x02801510,0x2a822e8e},{0x02c00561,0x3aa44d0b},{0x02210808,0xbbc8aefa},{0x01e106ea,0x42c48b94},
+{0x02c16817,0x84f0e6fa},{0x01e0a523,0x59d5ff94},{0x03e0a678,0x6586cee4},{0x0201133c,0x6f504b5c},
+{0x03216e93,0xc850a7b8},{0x01a01954,0x29ecd792},{0x02e025e5,0xf92c1182},{0x0180a47f,0xa46f483b},
+{0x0261b0a6,0x13508d4b},{0x03402722,0xbced1250},{0x02601548,0xf2b5720f},{0x02a0098c,0x06e964ee},
+{0x03201b66,0x9c09dae0},{0x054033f8,0x818f1a12},{0x01c16aa6,0x80f27779},{0x02e02154,0x21799ba0},
+{0x01a0aab6,0x313b1a9f},{0x0200a9a7,0x7697217d},{0x0201116a,0x4aad656d},{0x02c10d14,0xb31dff71},
+{0x0180a0da,0x4e6387e6},{0x02418a86,0xc4a47c12},{0x0260157f,0xd8b30a8a},{0x0221fb38,0x92b05ac7},
+{0x02a0288a,0xb7a8b4fa},{0x02e14402,0xb37894fd},{0x036011d8,0x9a879c1a},{0x02e133e6,0xa174eacc},
+{0x04a1d65f,0x361b05e3},{0x01c00e57,0xefa521d1},{0x02418942,0x28811dbf},{0x02e01809,0xd864310c},
+{0x024014ea,0xa44bdc20},{0x03a00104,0xf54b9095},{0x028011b8,0xd9525ba1},{0x0301d1de,0x4e9dc92e},
+{0x04002c5d,0x56cb2478},{0x0260aadf,0xe0e2a4c7},{0x0261b0f8,0x9cea7709},{0x04402349,0x0e86869f},
+{0x02402026,0x6fa55fce},{0x02000c9b,0x5e2e63d3},{0x00a1f348,0x42ce13fc},{0x0381ee98,0x94f2e43b},
+{0x00c1f577,0x03ef3688},{0x02c132f7,0x5e458bd7},{0x028e01e7,0x92e1d58f},{0x02e12497,0x6a0ae6a1},
+{0x04010170,0x8c7e0cb8},{0x04a1d8e7,0xa01154c3},{0x01a0aa07,0x407d505e},{0x0200ff3f,0x7b6bf868},
+{0x02418959,0x3385ac3e},{0x03e1da59,0x581ddb95},{0x03202c3d,0xcea5974d},{0x01e1072d,0x856eeb0b},
+{0x01a0331b,0x2684ee23},{0x02e1337b,0x9cee877a},{0x01202136,0x3887ff98},{0x02200d2c,0x221925a9},
+{0x03a1e02a,0x37bb9a62},{0x02c131fc,0xf47a6376},{0x02a168da,0x58de7f2a},{0x0241115f,0xa6f3e51b},
+{0x0381e10e,0xd67c8b37},{0x03012131,0x59ec05db},{0x0560fd7a,0xdbf1c7dd},{0x00e1f68f,0xdda12629},
+{0x02c01872,0x69d21a33},{0x03a0faa8,0x2f708b2a},{0x02802dd4,0x08d581fd},{0x01c0a13b,0xfd583789},
+{0x03e02524,0x55f3da5f},{0x01a0a029,0x2812d896},{0x0341d040,0x5a9d8e7b},{0x0560fe11,0x547f968e},
+{0x01c0a5a6,0x216622d2},{0x022010ec,0x4973b9e9},{0x02e14516,0x09b0e7ca},{0x03e1ee62,0x199df608},
+{0x02801dce,0x5a9ae46f},{0x02401187,0xd0c60369},{0x030144a2,0xd5167dae},{0x03a02951,0x5199034f},
+{0x01a1e2c1,0xc59e6dee},{0x020023fc,0xc3c3d2e8},{0x03e01e8e,0xb63883ee},{0x030005bc,0xf0fb1f1f},
+{0x02401349,0x19034e2d},{0x02c0109b,0xc03bcf1c},{0x03802b63,0x1ee6d4f4},{0x01a026da,0xaa155a2b},
+{0x02e03138,0x7e970698},{0x02e00548,0x00b9c805},{0x04201ca9,0x6ff1fce1},{0x02c13384,0x27c06072},
+{0x03e0ab3f,0x1982d269},{0x026100a8,0x5a4ef68b},{0x02c1004b,0xd587d87f},{0x030124a7,0x4f4e67d0},
+{0x0261b0f9,0x99ea7250},{0x02e13410,0x33d23261},{0x0220100c,0x95333dbb},{0x03402c1c,0x8ee8873c},
+{0x0200a9ad,0x92884307},{0x01a1161e,0x771ede2d},{0x02e144b2,0x9203c655},{0x01e11c80,0x0153981a},
+{0x03200552,0xf6667e35},{0x0501cf99,0xa372bfda},{0x0301f74d,0x19798b43},{0x026014c4,0xd2701b2b},
+{0x02c13333,0x49b70f93},{0x04402741,0xc79ae3a3},{0x0220006e,0x1f5757d2},{0x0320a684,0x899e459e},
+{0x016025cf,0x72571c58},{0x01e1f932,0x61068b25},{0x03012075,0xbf7239b2},{0x03800143,0xde752335},
+{0x0341e851,0x15edc89a},{0x0320ff82,0x30b61a7d},{0x0241d190,0xfec71a70},{0x020013bc,0xf2033155},
+{0x0401df0b,0xf81444f6},{0x01e01014,0xfc6108e9},{0x01c0a1bb,0x8c2b2e85},{0x01e1149e,0x8764c7e3},
+{0x02e0113b,0x1df806f7},{0x01c0a045,0x7a629a7b},{0x0221d344,0x69d5b16a},{0x02c02923,0x84b2e3ff},
+{0x03c1f73d,0xca5e7600},{0x0280a9cb,0x3574dd44},{0x02802265,0x514e40f8},{0x02202e1f,0x4276bb9d},
+{0x02410a2f,0x51e29628},{0x03011a23,0xc03828ca},{0x02e14447,0x217331f9},{0x01e108e5,0xffae4190},
+{0x0280a89d,0x76a17ce4},{0x01002241,0xb13244ec},{0x0461d17e,0x1830f206},{0x02200aa7,0xa71013d5},
+{0x02201043,0x7d6fc4eb},{0x02812fe2,0x990d71a9},{0x02011295,0x6f7dd436},{0x02610867,0xe4e2cc8f},
+{0x01c110a9,0xd417fd36},{0x02e1446a,0x1f8f0550},{0x044008c5,0x73ffa37b},{0x01a10932,0xacbf7d69},
+{0x05402b6f,0xc119bed7},{0x038168d5,0x2c1b8a59},{0x0301f025,0x4a286b1b},{0x02611407,0x61bb5aa1},
+{0x01c0191a,0x119b3821},{0x03c024a5,0xfa012572},{0x03c107ae,0x7188c254},{0x02c00b76,0x00c42f60},
+{0x01e0a50b,0x9cb921e4},{0x01c0a06b,0x031d8d8e},{0x0420fc87,0xa5be852a},{0x02c12188,0xa74bcfa5},
+{0x0281d2ed,0x6c721392},{0x028169e4,0x4a0f0714},{0x03a1d686,0xc7586485},{0x04001c85,0x8f5ae4da},
+{0x04c1251d,0xc574d9db},{0x02000633,0x14a93246},{0x0381e112,0xf2b092ae},{0x0140334b,0x6ffa51a0},
+{0x0220a851,0x0ede7127},{0x028e016f,0x7d6adb34},{0x02c1d431,0xdd97ec43},{0x02418826,0x798200e5},
+{0x0420fc75,0x1f824fc1},{0x028110d2,0x958a9ade},{0x0401da69,0x8511dcbd},{0x030012a6,0x633bdc0a},
+{0x02c1307b,0x3e2371a7},{0x02e1338d,0xfc54ad32},{0x02a03087,0x2b1927bd},{0x01a1f3a0,0xbe30616c},
+{0x0520254a,0xf368c93e},{0x02e14527,0xfaac52ff},{0x02012397,0xb7c7017b},{0x01c0a183,0xd621d58f},
+{0x03216e4f,0x608541f2},{0x03e18bd5,0x19db98e7},{0x01a0031b,0x991e9618},{0x01a0a396,0x85432922},
+{0x02812fdf,0x960d6cf0},{0x02201a65,0xdbc21668},{0x0240aade,0x9ca022a4},{0x0201f791,0x9cf822ae},
+{0x02410a17,0x3e1c623d},{0x02201047,0xee588766},{0x02e118d8,0x40653d70},{0x02c124d0,0x801339af},
+{0x030021ea,0xf58ab7ba},{0x0360fb14,0xca61239c},{0x02c0aa68,0x659b81b9},{0x0600fc65,0x0e82cd0a},
+{0x0401f122,0x1730000c},{0x03e01ca3,0x39257f0a},{0x028e01ac,0x7a5bcbf1},{0x0321d202,0x5e73cae7},
+{0x0260204b,0x1491e6b6},{0x014020a7,0x31ecc204},{0x02a023d2,0xc3ad8212},{0x01c11024,0x4a667d69},
+{0x01c0a263,0xbbe55281},{0x05e1d9f2,0x02278d50},{0x0600fc5c,0xddea81c6},{0x02e1da33,0xa943ea4e},
+{0x0280257b,0x2f86eab4},{0x0260abc4,0x460a4f22},{0x02600823,0xd6742c56},{0x0341e855,0xea27955e},
+{0x0321680e,0x27a48e63},{0x0340fe74,0xe91e1427},{0x04c1d958,0xc870beac},{0x02e144d8,0x162356cc},
+{0x02000c9f,0xdf30c11e},{0x01e11123,0x6b1f29d6},{0x0260ab11,0x027361bd},{0x024122e1,0xe4bc0eb8},
+{0x02c1314c,0xc8c3aea8},{0x03001158,0xa77c4337},{0x03c1d8f0,0x6e1186b8},{0x01811708,0xf7ee6f29},
+{0x050026ff,0xb0351e8d},{0x0281e908,0x06f08e2b},{0x01a1fb01,0x31a7d01f},{0x01c0a0c7,0x70bdfa17},
+{0x026112f8,0x9db6fb8d},{0x04a1d664,0x391b0a9c},{0x0201f797,0xdf6f4342},{0x0320019c,0xb1f64814},
+{0x02401195,0x489e0991},{0x02001008,0x067463d1},{0x02410a29,0x35f1749e},{0x0100221e,0x870b68b9},
+{0x02011ad8,0xc40a05d6},{0x024189bd,0x1fc15d6f},{0x05a1d0be,0x3d1b7756},{0x02c1208b,0x134d12b0},
+{0x01e10700,0x32a1e022},{0x04a0fc07,0x38605cb0},{0x028002b3,0x6e8c866f},{0x02e1d316,0x3f695945},
+{0x0280044d,0x2a84b162},{0x02202fc5,0x68a1ca79},{0x03403210,0x7aefccfd},{0x0621fb4d,0x74ccf818},
+{0x0381f719,0x85889e5c},{0x01e1068f,0x4b3a0f38},{0x02c1d41d,0xd997e5f7},{0x02c1f005,0x36a1bf27},
+{0x02402fc1,0x9ed22b5c},{0x02610370,0xd56cabc3},{0x022032db,0x771bba2d},{0x016007c1,0xf83c3c60},
+{0x02001683,0xb4d42f71},{0x02e144ee,0x85a71da2},{0x02a118ed,0xb1c3c747},{0x0181f6cd,0x839b365e},
+{0x0380ff39,0x62ecf6ed},{0x020029d9,0xd5d5a065},{0x024115be,0xe02d54fd},{0x02e16982,0x72f872bf},
+{0x01e0a230,0x770a9737},{0x02a1bc92,0xa19a2ad6},{0x03801495,0x3dac0805},{0x0300a976,0xfc13ec49},
+{0x03e1d07b,0xf63b6701},{0x022121a7,0xd56bf6bf},{0x02a02c8f,0xbde0c062},{0x02c0a68d,0x16b62769},
+{0x01e033a0,0x83111093},{0x02610fee,0xcbd1e728},{0x05601d73,0xecd683c5},{0x00e1f968,0xb9a870ed},
+{0x01c0a066,0xff03ef5c},{0x02c0289c,0x60f81f0a},{0x04e1d644,0xfce19f7f},{0x04a1246c,0x4ff846c8},
+{0x02c132a8,0x4b070ad7},{0x03a0fb62,0xcdc0a602},{0x0321209b,0x85e539ec},{0x02400812,0xaeff6f1f},
+{0x02801529,0x9eb9fdc1},{0x0441fa09,0xe7659d5e},{0x0580a745,0x9b53c989},{0x03401dc0,0xbecb1d84},
+{0x0321d52a,0x13a1821e},{0x03a0048f,0x8162a7e5},{0x01a0aa19,0x434d1a8b},{0x0280a9df,0xf55401c4},
+{0x0221045e,0x5ceaa275},{0x03400336,0x514112f1},{0x00e1f3f5,0x059b9d99},{0x04c02aee,0x07c85cae},
+{0x02211059,0xcdf46046},{0x026e0144,0xa48b3744},{0x0401f8a1,0xfc1c107a},{0x02c13121,0x670f3aae},
+{0x0381e13c,0xae33eb6e},{0x032032ac,0xe867ed44},{0x018115c2,0x962c6783},{0x01202325,0x4198bb13},
+{0x02602913,0xa81da6fd},{0x038015ba,0x0db15c1c},{0x0100002b,0xb961f274},{0x02e0a9ba,0xf34aec9f},
+{0x01a0a0db,0x1caea382},{0x02a00571,0x87c01460},{0x0381cf96,0x3c919045},{0x032011f5,0xf24d500c},
+{0x02c16b8b,0x4bb65031},{0x01e0a925,0x00b95aa4},{0x0320052c,0xe9a5e1ee},{0x02c16895,0x745db601},
+{0x04c1d036,0x83e0fabf},{0x0241889a,0x8ce0f334},{0x0160073f,0xeab5bb31},{0x01e0a062,0x8c803d75},
+{0x02e120e2,0xad20722f},{0x0321fb98,0x2084ef3f},{0x024106a8,0x6f4998f3},{0x0501f82d,0x08b8ab40},
+{0x02e0fe7a,0x0771db96},{0x01c0a10b,0x7c5685f7},{0x0321201b,0x32c50067},{0x0220063a,0x81081dae},
+{0x02601318,0xfcdee71d},{0x04400559,0x2e4a8571},{0x0320094a,0xcd3aaf0a},{0x0381e116,0x0ab9b2d2},
+{0x02200f38,0x14370900},{0x03601600,0x5f7aeef5},{0x0560a751,0x38607f4e},{0x028e01e6,0x97e1dd6e},
+{0x02a0119d,0x3fff0d3d},{0x03e1d5f3,0x7d05d257},{0x04e03364,0xf51bdbf4},{0x02a02bcb,0x045c2af6},
+{0x02a10f00,0xe3e8b81b},{0x02e11d91,0xe4ad4830},{0x0201bc3a,0x90cd6468},{0x04402ed9,0x1c8ce1fb},
+{0x0480fd0f,0x3378769a},{0x01e10716,0x816ca628},{0x03412404,0x9d068481},{0x0261e941,0xeae12658},
+{0x01c033a1,0x392d0c12},{0x03016942,0xcdea428c},{0x03210129,0x5c83d982},{0x03a1f707,0x0cf57301},
+{0x01e00b20,0x990e370e},{0x03e1d5f8,0x7005bde0},{0x0220119a,0x71a04e4c},{0x01e0a217,0x6f81cdb5},
+{0x0280143a,0xa0f43e94},{0x0501d7c7,0x0ef88117},{0x05602ff1,0xe9502350},{0x02c1302f,0xf3134743},
+{0x05c12470,0x076072c2},{0x01a0a20b,0x9f37b865},{0x02601263,0xd9a54b24},{0x02a02831,0x3d229e3c},
+{0x0360a71b,0x289ddeca},{0x02a01998,0x6acf5a34},{0x024106ae,0xe7980e98},{0x01e1bc1c,0xee67645e},
+{0x01a0a18b,0x704b56d8},{0x0300090b,0x414bdbc2},{0x02600e07,0x75e0a6ac},{0x0260080a,0xaaa48cea},
+{0x04c1d88b,0x424dc70d},{0x02c00576,0x5f1ef943},{0x026021a8,0x2477447c},{0x01e1d2e6,0xb42d7d17},
+{0x03c1ed33,0x2d5b5dbf},{0x02801439,0xc9219d2a},{0x022010e7,0xe4fd59d1},{0x03c025bf,0xa4ec2d03},
+{0x052001d5,0x2792aa6e},{0x024188e3,0x180ea871},{0x0480298d,0xf4e446a3},{0x026e0140,0xa08b30f8},
+{0x0261038d,0xcc21a3f0},{0x0321d6c3,0x0e144fbb},{0x0320111e,0x70a04c11},{0x0301457c,0xf907f942},
+{0x028012e3,0x86ae4cc0},{0x02800289,0x7c1f45f8},{0x0200a947,0x9add68ed},{0x02e10428,0xad97d3bd},
+{0x0441fa14,0x4eee6f19},{0x02c11d3d,0xcb87e459},{0x01e1bc41,0xfc677a68},{0x02c1043d,0xc8929d3d},
+{0x03c00162,0xbbfc0761},{0x02a10e76,0xaaf1adf1},{0x02200aab,0xbd0a11f9},{0x02e1332d,0x2d7b180f},
+{0x01e1065a,0x4c2d44d8},{0x0581d789,0xad975724},{0x01e10e6d,0xbb5711a7},{0x0281f55e,0xdec81b0c},
+{0x04201fc9,0x6c552590},{0x06802ffa,0x7f9e7c11},{0x0321d370,0x8b40c0a5},{0x02a0ffea,0x6fed1531},
+{0x01e10ea8,0x54a950ff},{0x014031d0,0x7539991b},{0x01c1f50f,0x5f513159},{0x02002f9a,0xe0ed5ce0},
+{0x02210611,0xe51a5925},{0x0180a4a2,0x80a77f8e},{0x02003051,0x681b01a2},{0x02a110e1,0xbbd83b9f},
+{0x03012342,0x069940f7},{0x03200199,0x18ec7b92},{0x01c00726,0xa152475f},{0x024188b1,0x05dba181},
+{0x01c0a938,0x6d4df580},{0x03a0fab1,0x206e34f6},{0x048000ab,0x97854a09},{0x03212496,0x99e7970d},
+{0x03c1ee6f,0xc7e19db1},{0x01811421,0x3041c127},{0x02e145e2,0x78f460c5},{0x0161fa78,0xfdf43b0f},
+{0x0340036b,0x2c1b6877},{0x0340016d,0x0259bf57},{0x01c11738,0x3954ec1c},{0x02c13040,0xfb159272},
+{0x0280328b,0xb2ca1db2},{0x01a0a4d2,0x84f982f1},{0x0421d226,0x5572bcd8},{0x0480fcea,0xc1befe8c},
+{0x0180225c,0x61a9f8d6},{0x01c00c2f,0x186ff4eb},{0x0421cf0e,0x3d753328},{0x02e1694a,0xabc6fa12},
+{0x03212388,0xe871ea53},{0x04a10b65,0x652b88ef},{0x02202bb2,0x728c3486},{0x02010606,0x1c32f136},
+{0x02402e95,0x3741ee9e},{0x02401829,0x6ffcfe25},{0x04a1246d,0xcf69b2c2},{0x02e02837,0x8d954b2b},
+{0x02a10447,0x858e577c},{0x02c10f0c,0x4e305d9c},{0x01002728,0xf96d0172},{0x02418a06,0x343617a0},
+{0x02e118cc,0x5a9941c1},{0x02c00565,0xab1aa45f},{0x028019c0,0x498b6011},{0x04401f18,0xf61028b8},
+{0x02418add,0x671e92fb},{0x02e1040f,0xebfa2724},{0x02e1f0ae,0x0d539a1b},{0x0301f312,0xa46c9ef3},
+{0x01811451,0x2f11883f},{0x02e1456d,0x7643b471},{0x03c1d088,0x68a75c68},{0x024012f6,0xbefe4351},
+{0x02a10323,0x6bc2084e},{0x0241890b,0xa01878e5},{0x01c1fb05,0x572cb544},{0x0281044f,0xa3fbe210},
+{0x0160205b,0xbc799741},{0x03200ddb,0x26aa167e},{0x0381d6f2,0x5093cdee},{0x02c02155,0xfab8e44d},
+{0x04c0fd2f,0x4197998f},{0x0241898a,0x36927cea},{0x01a0a5ea,0xdb14a07e},{0x0481fa0c,0x5e7fc1c4},
+{0x01a16f2c,0xc4023e6d},{0x028019b6,0x859f463d},{0x02201fce,0x97e472f6},{0x03012235,0x12efc7f8},
+{0x03c1d7f6,0x86817e73},{0x01a0a37d,0xef49f47e},{0x02000c34,0xff0390e2},{0x03e124b4,0xa26ae4b9},
+{0x03c1ee61,0x771465f6},{0x04c008fc,0x1a3a5641},{0x04201feb,0x128e5520},{0x01a10927,0xb4bf8a01},
+{0x0361f326,0xb9a9382f},{0x016e0031,0xa9131320},{0x03210cef,0x6c9a93b5},{0x0101f331,0x031f1788},
+{0x02a0145b,0x069eecbf},{0x03a10991,0x395f4cd2},{0x0341e8ad,0x7dd1e100},{0x0261e93b,0xcdc74c7b},
+{0x02002023,0xa5165054},{0x03a1ed1d,0x708b25a5},{0x01c0a430,0xc2c83ce2},{0x02400cbe,0x15b98d63},
+{0x046033e0,0x9861bb55},{0x0360a763,0x09f6fdcb},{0x01e00a85,0xf78af8c1},{0x02c1da79,0xd020f865},
+{0x0341d442,0x38b2c228},{0x02610fbe,0x9f643237},{0x02c1bc23,0x46a69718},{0x01c0a33f,0x9d8b6ae4},
+{0x03e18bde,0xe9db4d57},{0x03810c85,0x664a307b},{0x0321f909,0x0be2f007},{0x04a01dbc,0xffd705e9},
+{0x04a0023e,0x9d31f0a2},{0x0180a2b8,0xa657467b},{0x04a033e6,0x95b7c778},{0x02001051,0xffd5c8d5},
+{0x02601207,0xf786fdf4},{0x02200af9,0xa82eb79b},{0x0540336d,0xe05fc95c},{0x030100d2,0x2db09f37},
+{0x02602dd8,0x38a92b97},{0x0441f163,0xe54f5190},{0x02201172,0xcbc7eb6a},{0x02e006c4,0x748dc114},
+{0x020103af,0x7eb53664},{0x03a1d8b2,0x4deb661f},{0x0321d7d3,0xcef1ea87},{0x020e0022,0x7b60d596},
+{0x03a0fab2,0x1f6e3363},{0x02610901,0xe5f9ed56},{0x0380fb96,0x01a423c5},{0x03c1d553,0xe6255a5f},
+{0x0360158d,0xe32cc4f1},{0x02802da3,0x9c3b977c},{0x0460048a,0x38b8e5a3},{0x02616fe0,0xbdd4c9a6},
+{0x02e13175,0x13ce847c},{0x01e0a984,0x3a92795b},{0x02001a14,0x5b44015d},{0x01a1018a,0x276caaf4},
+{0x0341d91f,0x574f350c},{0x05212310,0xefb6c2f8},{0x04e1d0b4,0xaf603e2e},{0x04c1cf30,0xd6f28d45},
+{0x020120fb,0x6accc4be},{0x02003086,0xa4487fb4},{0x02e1da56,0x619e4abf},{0x04a1d667,0x2e1af94b},
+{0x02e13172,0x2fbfa606},{0x02418a90,0x54a18d2b},{0x0200306a,0x58233737},{0x03a026d5,0x9bacfdcf},
+{0x03a02911,0x51287338},{0x0240a735,0xd387088c},{0x026119ad,0xe77d6f9b},{0x0381e105,0xe2744f56},
+{0x03011a47,0xfe07c85f},{0x030120e5,0x5974b48e},{0x062023c4,0x73113878},{0x02410118,0xd0b94912},
+{0x02418a2e,0xbc3fe814},{0x01e106ce,0xaebaa83c},{0x042022f9,0x808f4d89},{0x02a0a980,0x804fef75},
+{0x04001881,0x8e9fee95},{0x03202e08,0xd98344d4},{0x0381d8ec,0x87780423},{0x05001f53,0x72791536},
+{0x01c02199,0x6ec0c55a},{0x03001877,0x36b9900e},{0x04201dd7,0x82d12199},{0x020013d4,0xc818b586},
+{0x02400968,0x755e589a},{0x028e01a8,0x765bc5a5},{0x02418afd,0x6711c708},{0x02002468,0xbd0e1840},
+{0x02801494,0x19381f35},{0x03e18b32,0x9fd7917d},{0x05a1d818,0x9c2f4a34},{0x02801531,0xbae5b673},
+{0x0401f12c,0x314885f5},{0x01a0a6dd,0x8f18c9c2},{0x02002edd,0x28aadfbb},{0x02211cb4,0x1cf52bbe},
+{0x032121e9,0x574e73ce},{0x0601d816,0x76f5d1e8},{0x0580fd59,0xb6569f2e},{0x0221122c,0x6743b677},
+{0x022010ee,0xe1d79d9e},{0x04a0fc3f,0x260a48f8},{0x0381d10f,0x079a8e00},{0x03a1d16b,0x0ceef073},
+{0x036011f3,0xa61cc2be},{0x03416e46,0x5fcc1058},{0x04c0335b,0x6e93b823},{0x0741d9ba,0x643e579b},
+{0x03014545,0x16571374},{0x0260133d,0xac7d3060},{0x03a01883,0xe69ac905},{0x02e00833,0x73a05c6d},
+{0x02a110bc,0x3ea852cf},{0x05c1d83a,0xdb9fe42e},{0x02c13053,0x36f1335b},{0x0180a008,0x5d5b50be},
+{0x0121f377,0xefd5f588},{0x03a0fa8b,0x104c9249},{0x020030c1,0x5cc11668},{0x0301012a,0xeb1ecc1f},
+{0x0260a9cf,0x208c93d6},{0x03a014e5,0x7cbffda3},{0x01e11214,0xed11d3d2},{0x020120b7,0xcacd5bde},
+{0x01c1102e,0x7a7a50b1},{0x0241f6f1,0x3ff68e21},{0x0201f67c,0x04636fcb},{0x00c1f458,0x70e42f9e},
+{0x02a01dfb,0x89be4f32},{0x0400ffa8,0x7f1638ab},{0x03c1d6e2,0x25667769},{0x03a0fab9,0x286e418e},
+{0x01c0a266,0xa516cb18},{0x01e01c01,0x6d764d2e},{0x034124ca,0x55ae0487},{0x04c1ed3a,0xbd90e69b},
+{0x020030cf,0x1cdec6bc},{0x01e0172a,0x6ea51ae4},{0x020111d9,0x839663b4},{0x02800845,0x3487a8c6},
+{0x02c133e2,0xd0bbc8b9},{0x03e0a7ab,0x441bd248},{0x01c0a926,0xbc73c535},{0x0361f519,0x761be598},
+{0x0241888f,0xffddd6a6},{0x0361d6a0,0x3906e5f0},{0x03a1ed17,0xa74f02b5},{0x02e144c5,0x04fe6b30},
+{0x02a0ffa0,0x0112df4b},{0x05c01ff2,0x579abd01},{0x01e1da6a,0x9f168d87},{0x01a0a6b5,0x7f480ec7},
+{0x03c00dd0,0xd13a27ef},{0x03210128,0x77a329dc},{0x00e1f3d5,0x34ce4aa4},{0x00e1f3ed,0x30bb96ad},
+{0x02418a2f,0x43386dd4},{0x01c0ff5e,0x21d003be},{0x02801dc4,0x863c1b6d},{0x0421d7ed,0xd7c23c53},
+{0x02202ecd,0xe6a57608},{0x01c1f5e7,0x90c90728},{0x02a1f0d2,0xa281cb9f},{0x04012144,0x4f2e8cb7},
+{0x02212191,0xdc2c1ec9},{0x038000d1,0xf344f64f},{0x01e116ae,0xaf1be055},{0x02c02827,0x178ff0d2},
+{0x03401d2a,0xd333bd66},{0x0521cf34,0xe97bac4c},{0x02a105b3,0x28295345},{0x0461f544,0x2d1f86dc},
+{0x01e12155,0x531dad8f},{0x03812006,0x5cf8bec7},{0x01a1161c,0x34da7d6d},{0x02a1f652,0x934ed9e7},
+{0x02e145d4,0x7cf2287a},{0x028e01cf,0x9ad2d79d},{0x02a105a1,0x2bf7bcc5},{0x05402900,0x576abc24},
+{0x02c1217d,0x4039e45f},{0x01e1204d,0x500c5fb5},{0x02e02410,0x548550df},{0x02c1329d,0xdb5d0e2f},
+{0x02a101d4,0x5bab5918},{0x024188cf,0x14131f53},{0x03601649,0x74abc62f},{0x0400277d,0xc27e1655},
+{0x0561d0d0,0x0c53a2c7},{0x01ae0024,0x6e63ee6c},{0x01e00ea5,0x29b12f44},{0x04200874,0x0d128fe5},
+{0x03210841,0x9eff46f9},{0x03010c08,0x3cde8890},{0x04601e53,0xb9162290},{0x02800b01,0x6447fa1b},
+{0x05202549,0x128e871a},{0x01e10e93,0x87318e77},{0x02c1319c,0xc9882358},{0x03800dac,0xded303db},
+{0x0201f78e,0x18d229d7},{0x02611954,0x2fd94b5b},{0x03612212,0x9f76152e},{0x03a0143f,0x16e7b04b},
+{0x0260314d,0x26d9473d},{0x01e106db,0x36bffb82},{0x0160a491,0x8bba675c},{0x03400978,0x71a8487b},
+{0x01c0a33d,0x958b5e4c},{0x02601274,0xb096ce92},{0x02c02494,0x7f29a77a},{0x0261f554,0x7c2818a9},
+{0x00e02050,0x933552b6},{0x048020e6,0x3bce3b5e},{0x01e0a1a2,0x0e2fbe71},{0x01e1048d,0x5d2651e6},
+{0x02010633,0x2a263b4d},{0x02a16a18,0xc7b47d11},{0x03a027b5,0xa619b670},{0x03e18b8d,0xa7bbc798},
+{0x01c0a23d,0x6722af92},{0x02c11c69,0xc2fa1ec7},{0x064115cd,0x1f62bc24},{0x02c10f24,0xdbd38894},
+{0x02602dc9,0xdb154e8f},{0x03612407,0x17356f93},{0x040009f1,0x3f280962},{0x01a0a2a1,0x874783a6},
+{0x02c1333e,0xceba1f89},{0x04400150,0x2143a307},{0x04a107a6,0x9a7a8491},{0x0241e2a7,0x63d7c01d},
+{0x026101e0,0x067e9eb7},{0x02600614,0xa38f5a7f},{0x02816891,0x6a0d836e},{0x032100c3,0xc057a31a},
+{0x03e0105e,0xddaed6d7},{0x02801469,0x2677f461},{0x01c0a591,0xd2284006},{0x05002541,0x9d920d00},
+{0x03e023ec,0x1bbf22cb},{0x02201a0b,0xa318917c},{0x0381e8c2,0x86b21e24},{0x02a018d0,0xee226c29},
+{0x02c168bb,0x129e3bc5},{0x0501d79b,0x31247b92},{0x01e102c3,0xbca67032},{0x04000201,0x50ebe0e7},
+{0x0421eea9,0x0d2b86a2},{0x0420321d,0xbd4c34a9},{0x0340a96e,0xcc70df0e},{0x0501d7af,0x2f2aca59},
+{0x01a03379,0x9acdb398},{0x03000533,0x101a62d1},{0x03602ef3,0xdaef3a7a},{0x0701fb46,0xf64687d3},
+{0x03801509,0xbf20b178},{0x04010b5a,0x9fec2b20},{0x02801991,0x5a26abee},{0x03a12430,0x8d1ee764},
+{0x01e0a24a,0xc737fc3f},{0x038119d6,0xe28e6e7a},{0x022103b0,0x47f90656},{0x03c0323e,0x25fe9a7c},
+{0x02e13120,0x03f748ae},{0x03011d40,0x380cc82e},{0x01c1e2d0,0x6f5059a6},{0x0301d1a6,0x7913beae},
+{0x02800969,0xc220d608},{0x0381d017,0x8f98bbaa},{0x02a02c8d,0x537daf2c},{0x0240a4f9,0xced8673e},
+{0x02a16873,0xdf3884a1},{0x02401281,0xc508da1f},{0x024112f5,0x609e67a2},{0x0221033c,0x0400965c},
+{0x02418a46,0x46477d17},{0x0101f474,0x069ae6e3},{0x0501243c,0x228321a0},{0x028e015c,0x7a6f53a9},
+{0x020030d5,0x08dea740},{0x01c0a6c9,0xd0887104},{0x03e10ae5,0x9303fc4e},{0x02418858,0xf16b647e},
+{0x02202f83,0xdaabf71b},{0x0380fecf,0xef9fad6c},{0x02c1223d,0x3c38d80b},{0x032006ce,0xb4161bf2},
+{0x0361d50e,0x0cbc4b21},{0x03201b4c,0xab18043f},{0x01c11658,0xbefe1b06},{0x02e1461a,0x66dc3f89},
+{0x0400a7d0,0x44abed90},{0x0181f940,0x540cf953},{0x0320239e,0x84fd1bc2},{0x026100be,0xd367b9ec},
+{0x022010f5,0xef9190a9},{0x03002a0f,0xe2f7a961},{0x03e01fbb,0xbe819c96},{0x02211c21,0x045ab1cb},
+{0x01e01aa8,0x21378151},{0x0380ff37,0x54ece0e3},{0x022010d5,0x0d4e4cd0},{0x0320188c,0x8d72dd8d},
+{0x02e13270,0x545f790b},{0x0381d714,0xba10bb5b},{0x02c0057a,0x8ffc387e},{0x02401194,0xeeb72819},
+{0x03e1f4b9,0x57e7f102},{0x066022fc,0x9f1d9d8b},{0x024189b3,0x9dcd5cbc},{0x02402068,0x14292f33},
+{0x02a013fa,0x3f119c50},{0x02c168f7,0x7ad61ffa},{0x00c1f56f,0x184d5198},{0x02000a35,0xc9ce58be},
+{0x03e18c7a,0x5292e48b},{0x020111ad,0x50fc8c52},{0x01a0a2e9,0xd07754c6},{0x0261009c,0xcc4999d3},
+{0x00e0005f,0x3a7d8c1b},{0x0301bc98,0x42be575f},{0x0200a84d,0x0ab21218},{0x016007e4,0x57665f94},
+{0x028169fc,0xa5ebaa04},{0x032008be,0x173a1f45},{0x0681cfa1,0xfb33a549},{0x01c0a0f8,0xd0d7807c},
+{0x0541f726,0x91e4157a},{0x0380238f,0xc4ae84cf},{0x028e015f,0x8971a9dd},{0x0441f875,0x8f7d3d10},
+{0x02816b1b,0xa61dea11},{0x02418a61,0x51ac15ce},{0x02001681,0x8887ef0d},{0x01801fbd,0x1e8d33d8},
+{0x02e13097,0x106138d4},{0x01e0a846,0x8808dac8},{0x02e10c34,0x45570cdb},{0x03611a38,0x06dc91e0},
+{0x03c1d563,0xf625738f},{0x07001fad,0xd17acbf3},{0x0260ff17,0x3531ceb6},{0x02a00441,0x1fe2f023},
+{0x01e005de,0x3e6c32df},{0x028104bf,0xb0e3dc59},{0x04201ff9,0x585c0641},{0x03800474,0x1a44e0dc},
+{0x01e1159d,0x91640072},{0x0340a7d8,0xe637f8be},{0x036118bf,0x563e1131},{0x032015c3,0x5c16bd01},
+{0x01803346,0x0d009e69},{0x01e11ee6,0x2e823cc8},{0x026e013f,0xa18b328b},{0x01a01956,0x39e4a1fd},
+{0x018031cd,0x112a594c},{0x04001cb2,0xdb17967d},{0x02a0aba5,0x2540d197},{0x02e13092,0x69f07329},
+{0x0641d0b3,0x37b84aa3},{0x01c0a14b,0xfc4da89a},{0x03e000e2,0xdb4fc199},{0x02e01d5d,0x55091e3d},
+{0x03a0298b,0x546b1202},{0x00c1f9ee,0x045ec19e},{0x03200184,0xaaa65a65},{0x01a1f7d7,0xc88233a0},
+{0x0621d89e,0x89df3a30},{0x0200ffe6,0xbfd1b369},{0x02e13055,0x73b0faab},{0x03e10a7f,0xa596a901},
+{0x02211c10,0xf84955c6},{0x016007b0,0x4440493c},{0x0300abe3,0xf69cabd7},{0x01e16f93,0x7698699b},
+{0x03e18bea,0x09ddbe4e},{0x03010c2a,0xa6c66ed5},{0x0381d6b2,0xc8bac68b},{0x02a16878,0x3bd7af2b},
+{0x03410532,0x25236274},{0x02a00f31,0xe4a74209},{0x0581d811,0xa85d481a},{0x028e01d1,0x98d2d477},
+{0x02801808,0x8ad9c3c0},{0x02c10d13,0xd72076b4},{0x0141f4e0,0x59975715},{0x034168b3,0x254e2ea9},
+{0x02c0158e,0x437de874},{0x0361eca8,0x152e0561},{0x01e03378,0x8a0742f2},{0x02601472,0x0c7d426c},
+{0x03e00588,0xfec49b13},{0x04013430,0x4c19e138},{0x01c1f9d7,0xd28c08e3},{0x02211038,0xd82f0ef0},
+{0x03c04de3,0xd7e51412},{0x0380012c,0x055c51c8},{0x02202d59,0x060a7b0c},{0x0181f60c,0xb5122eb8},
+{0x02811d6d,0x3680a43f},{0x01e0311b,0x82f9fe05},{0x02e025b3,0x3bea6dd5},{0x02c13109,0xf21492ad},
+{0x01c10496,0x1f1cb5e2},{0x02a11d6f,0xe93d0f53},{0x02401228,0xcd20eb9d},{0x010022a4,0x3b88b34c},
+{0x03801493,0x41ac0e51},{0x0461f881,0xf8caf578},{0x03200f91,0x1364830d},{0x03c1d478,0xe322e9e5},
+{0x02c1ee18,0x7fb03fb4},{0x026100b9,0x5c4cbb1a},{0x02c16928,0x43e1324c},{0x0360322f,0x225e477c},
+{0x02418a5c,0x52ae55f8},{0x020010dd,0xda7a2f62},{0x020013da,0xdbf1c592},{0x02616b68,0xed184035},
+{0x02010654,0xb5b17722},{0x03a01e87,0x0be0bd35},{0x0541d857,0xe6650962},{0x022122bf,0xebb6fa08},
+{0x0340a78b,0xcde34203},{0x04a002f5,0x1e303d53},{0x0361d696,0x3306dc7e},{0x016000b4,0xd51c0209},
+{0x02418a23,0xb73da19e},{0x01e106f1,0x3bc4808f},{0x00e1f6a3,0x73b797e9},{0x02816952,0xa4b6586f},
+{0x02001a42,0x4893782d},{0x028002b2,0x668c79d7},{0x03200253,0x2f6257b5},{0x02401181,0xb6d3a50b},
+{0x0401245f,0xacfb7bd2},{0x02418a45,0x45477b84},{0x03e006b2,0x30cd3896},{0x0481d0f1,0x64517044},
+{0x0461eeb4,0x86d1598d},{0x0300215a,0x60b040fd},{0x02211cb2,0x22f53530},{0x03602a63,0xbe15df3f},
+{0x028019bd,0x857cb3fb},{0x02c1317c,0x43cd6aa5},{0x024121b8,0x94376e07},{0x03e18c0b,0x5da43efd},
+{0x03a1f53f,0x6ffe2587},{0x02c01d40,0x9ae7d1ec},{0x01e11eef,0x627e1176},{0x03a00f0b,0xe8d54de3},
+{0x020108e1,0x83f1a1de},{0x02811abc,0xbabda866},{0x01c1f12f,0xd0a5f3f1},{0x03210a8c,0xce5626d5},
+{0x01a0a0ca,0xe08311eb},{0x0741d9bf,0xf1d678a7},{0x01e116c7,0x502b96f0},{0x02003078,0x881d7299},
+{0x02401773,0xf55d38cb},{0x0341f740,0xb35345d1},{0x0320a7b1,0x9af623df},{0x0380a8e4,0xfa8bea94},
+{0x0141f9d3,0xf50cdef3},{0x02410180,0x863f706b},{0x02c10444,0x2344e5a2},{0x02c11c43,0x4dd4a751},
+{0x01a0a31a,0xc78cb36f},{0x0380a67b,0x8b7ae383},{0x01c02714,0x2abbe699},{0x02c019f6,0x349bef78},
+{0x0401cf04,0x56c4e8af},{0x0280026e,0x8bbab751},{0x02c13079,0x402374cd},{0x01e1fb21,0x99ac4282},
+{0x0340a9bf,0x20809cd0},{0x03a1ee37,0x803f97b1},{0x02418a2d,0xbd3fe9a7},{0x04c00468,0x35513dba},
+{0x02c133db,0xd2bbcbdf},{0x038108ab,0x225eb541},{0x01c01745,0x07d32381},{0x026009bd,0xfa575cfd},
+{0x02410371,0x2635476e},{0x036005ba,0xe77c706c},{0x03801631,0xfe8502ca},{0x02a10023,0x6586abfd},
+{0x0260fb24,0x70418375},{0x0341d6c9,0x39c62c6f},{0x01e01be7,0x110071a7},{0x01c1f64d,0x3898c138},
+{0x0521cf41,0xf4753af4},{0x010026fd,0x2f0225a3},{0x0301d408,0xc14d0b29},{0x0300fdff,0x9192a6a7},
+{0x0240206f,0xf65c0796},{0x01e1130a,0xc6d0edd4},{0x01e00be9,0x06c265df},{0x03e18c41,0xf29a9c30},
+{0x02a1003a,0xd99a4834},{0x01e11a9b,0x4c45688a},{0x04002909,0xeea25e94},{0x026012fe,0xa829325d},
+{0x01a1169b,0xd2071f5d},{0x0301f04b,0xef371a9b},{0x03e1f71e,0x5a412673},{0x01e02e92,0xb197f5d7},
+{0x01a116a3,0xfdd8066c},{0x02c00418,0xe1115a3b},{0x04a0fc0b,0xc792d09f},{0x02800e4f,0x4b62e672},
+{0x02212029,0x76e85072},{0x03210ce6,0x6e9a96db},{0x0461d766,0xab3accab},{0x01a0a27c,0xd29bd2f6},
+{0x01c0a929,0x9c9c3545},{0x02e1463f,0x64bf1818},{0x03c0ffb6,0xee8cb7af},{0x03a1cfb5,0x77749cae},
+{0x01a10295,0x04ee183d},{0x01802191,0x06b65870},{0x02e145a1,0xe739d8f8},{0x03810c9f,0x5a604b3c},
+{0x0261b086,0x6fe08d01},{0x01200039,0x3ac344a6},{0x034011fa,0xdcd71729},{0x04a1d66e,0x271aee46},
+{0x02000a8a,0x53a75518},{0x02016f80,0xe9514746},{0x03811a44,0xc10ced28},{0x0340fee8,0xae6070b5},
+{0x04002950,0xb4389577},{0x02002fb6,0x9f204a96},{0x0160a60e,0x4cac5926},{0x02601813,0x66b45df0},
+{0x03201159,0x8b5ca7f5},{0x038021f0,0x6f3ff062},{0x0381d6d6,0xebe312a9},{0x03000f78,0x902b3091},
+{0x03201059,0x3be68031},{0x032028fb,0x06c3aad5},{0x01a0a053,0x15b97ba8},{0x02200f74,0xb21efc45},
+{0x02616f06,0x7b369a64},{0x0261090c,0x6bd7deac},{0x0661fb54,0xc3e7b2ce},{0x02c13003,0x861d2908},
+{0x0280166f,0x44c56d61},{0x0341e801,0x5dce0db8},{0x0260a896,0x5813f78f},{0x02e028cb,0x83d10c1a},
+{0x0180272f,0x9b16ca17},{0x02c02817,0x168fef3f},{0x03202c74,0x991aaef8},{0x028030a3,0x016ac665},
+{0x01a0a5a8,0xd723a4bc},{0x01a0179f,0x38d7d43a},{0x01c0a5af,0xa02684e8},{0x0160a4f0,0x801118b5},
+{0x03816af4,0xae84e80c},{0x05a1fb50,0xa178d7c6},{0x0361f841,0xc28c995c},{0x01e11121,0x4a06ed51},
+{0x03801501,0x982ec74d},{0x01e0a16d,0xcf05a061},{0x0361d692,0x3706e2ca},{0x0521d952,0xce620c65},
+{0x02400c83,0x77c6224b},{0x02002a53,0xda646ae4},{0x03e01e42,0x89cd8ae2},{0x01e02460,0x10162ef4},
+{0x026100ae,0x604efffd},{0x02a11944,0x44586db1},{0x01e122fc,0x7bd68aff},{0x0301d419,0xae4ced40},
+{0x016029e6,0x052687e4},{0x028030a9,0xfb6abcf3},{0x0401ed30,0xcd214ebf},{0x0301f054,0x941a393e},
+{0x01e0fe66,0xa9b78374},{0x0381078c,0xca4d7292},{0x05a1d0e0,0xa5ece8fb},{0x022007f6,0x628935b9},
+{0x0320fbc0,0x8ea2dcf6},{0x01e11729,0x2e708512},{0x01400037,0x48a9a07b},{0x01a0a285,0x9138d834},
+{0x02418818,0x6984264c},{0x03216989,0x59966a58},{0x01e0a265,0x22e1f5c0},{0x02201b9e,0x8c9c20f3},
+{0x040004cc,0x8b914cf3},{0x030024df,0x62b6ca5a},{0x01a0190f,0x0eb89225},{0x02e00190,0x7041ba46},
+{0x0300046e,0xd7ed806d},{0x0360fee9,0xb4e2108f},{0x02a10885,0x8ca6720e},{0x0420a713,0x123948a5},
+{0x01e10b09,0x852759ab},{0x02210344,0xa9c940c9},{0x034024c1,0x5565f727},{0x0521d975,0x3340db13},
+{0x01c1f576,0xb42164c7},{0x03c12527,0x346d68cb},{0x01811700,0x4c04b9b4},{0x03e01cb6,0x74553a20},
+{0x024106b0,0x4ab72246},{0x03e18bd9,0x0ddb8603},{0x01a0a113,0xfaa3b0a8},{0x03e16993,0x4df4a564},
+{0x05a01ed4,0x68c8d0ad},{0x02c1316d,0x44be61ae},{0x02602736,0x73ba6709},{0x02a0198a,0x896e08cb},
+{0x02418996,0xaecb38e8},{0x0301233b,0x067363cf},{0x02c13099,0x4125b4f7},{0x02a11ae0,0x4bc87953},
+{0x0261b05c,0xc2f9d561},{0x03c00f04,0xac33e765},{0x0340323a,0xce2b9cd8},{0x02401b03,0x948e3949},
+{0x01a0a5fb,0xd6e9b92b},{0x0201061e,0xae2b8847},{0x02418860,0xeb691c75},{0x01c0a3c1,0x57461d59},
+{0x024012ed,0xf90b6a92},{0x028168d1,0x7940facf},{0x03c1e014,0x8bb1638f},{0x03c024a6,0xfb012705},
+{0x02e14555,0xe93e594c},{0x030010c0,0x7b377311},{0x02210452,0x85023729},{0x00e02108,0x8e333341},
+{0x0241895d,0xbb88c0ed},{0x01a1f9bf,0xbbf378fe},{0x01c1f4ad,0xd105654d},{0x03c02a9a,0x7e40a953},
+{0x05001e38,0x6d906478},{0x02c032b1,0xc58d8b82},{0x02202fce,0x1dbd68b1},{0x03a1e101,0xa3b35235},
+{0x0241fa62,0x448b26d6},{0x03e10b7a,0xe78bee8e},{0x03014600,0x2b68d653},{0x024026fb,0x95fe5648},
+{0x02001aa0,0x91feb8ce},{0x0241f260,0x18fa9068},{0x01e1fb24,0xad61a276},{0x05200390,0x62117781},
+{0x0461d779,0xf916bc9e},{0x026100cb,0x19a6d8d1},{0x01c000b9,0x4978d17d},{0x03a002ac,0x9ed18e5a},
+{0x02c13107,0xde16b1c8},{0x03e18bef,0x0cddc307},{0x0301f51e,0x3801c321},{0x01e02628,0xdb06f3cc},
+{0x0341f133,0xef00f744},{0x03e18bf8,0x98e0de02},{0x03200245,0x9cf62705},{0x02418abe,0xdc16fc65},
+{0x00a02641,0xbcd192f7},{0x03e02678,0x9c62bc67},{0x02000aac,0x3fbe8eeb},{0x02e1bc4d,0x32979df5},
+{0x02000f4e,0x5bbdd485},{0x028030a1,0x096ad2fd},{0x02000a26,0xf5fbbda0},{0x0381ed3d,0x2b08b464},
+{0x028032a7,0x2509ad5b},{0x02418a81,0xc1a47759},{0x0561d95d,0x1a80ce2b},{0x0381d05b,0x826d6913},
+{0x03e01e04,0x073c61b3},{0x030011c7,0x4ed8ef5f},{0x02e10413,0xd3ac5047},{0x05a023c7,0xe163eb45},
+{0x01c00c0f,0x1c3e5e6b},{0x030169bf,0x52871059},{0x0241fa03,0x8649e609},{0x030005a6,0x20ebf8ec},
+{0x01c0a352,0xd182480c},{0x03201104,0x9e8a618a},{0x02c133ea,0x1f785832},{0x06002ff6,0x76316938},
+{0x030120a9,0xcab38e05},{0x01e1113b,0xdaba4441},{0x01a0a186,0x7c6dfbfe},{0x03010a87,0xd458a922},
+{0x016e002a,0xfe6d9fcf},{0x02801dbb,0x768c9307},{0x01c00c24,0x2467b90a},{0x01802030,0x1046d858},
+{0x040004d6,0x37fd2a4c},{0x01c006e5,0x28b08751},{0x0360a664,0xa8674181},{0x03c1d559,0xf0256a1d},
+{0x01a1162b,0x3a9d5a90},{0x02418943,0x25811906},{0x01811603,0x64053568},{0x02418a18,0xb230cdcc},
+{0x01e114d1,0xca0da86b},{0x03e18b87,0x1abc7ca1},{0x01c0a33b,0xdd64c034},{0x02210053,0x23d2507b},
+{0x03a1d59d,0xe9918030},{0x026019b5,0xa043b45e},{0x024006e3,0x48acbe31},{0x0500fdae,0xe9f97fdf},
+{0x0381e01e,0x682cd95e},{0x0441eead,0xcb577206},{0x02802dd3,0xeccc5b8d},{0x03202ee7,0x35b06720},
+{0x02411c1c,0x74bed9a9},{0x01403325,0x1786bc15},{0x03a1d673,0xd45878fc},{0x02c114bd,0xb83d1333},
+{0x02800310,0x56965388},{0x0441df14,0x47dc7d8e},{0x02e16901,0x1ff96767},{0x01e106b7,0x3eb33c27},
+{0x0141f4d9,0xe3a84cb6},{0x0401f90b,0x4d326bca},{0x01a0a1ce,0x479590cc},{0x01c0a36a,0xebc2728f},
+{0x03212210,0x42eb3d31},{0x02a018c0,0xb5d611ab},{0x0480292d,0x2be89a2b},{0x01c02632,0x3ae67000},
+{0x01a0a6a4,0x3f34224f},{0x03e18c88,0x8390f317},{0x03a00f37,0x63bfe2be},{0x038018f4,0x81507a87},
+{0x02e00ae0,0xfb4581ef},{0x020016d5,0x33562d7e},{0x03c1f228,0x07b6c35c},{0x0421d5e6,0x4736be3d},
+{0x022031a5,0x14707baf},{0x02810f0b,0xd68f5d85},{0x02e12028,0x4ba2b9c7},{0x02802175,0x2e712b97},
+{0x04e0fe16,0xd5532d11},{0x0140fe55,0x112f63e7},{0x01a0a2ca,0xfa28cba5},{0x03816b66,0xd07e71a4},
+{0x0280a732,0x735685bd},{0x03c02724,0xb6003e5f},{0x02016f56,0x855de744},{0x02e0287a,0x3d63290e},
+{0x03a1d8c7,0xef6e7539},{0x07c1cfb8,0x6f00bc13},{0x0321da81,0x0009d6ac},{0x02210055,0x16c0f2e3},
+{0x01c11067,0xddaa3ff9},{0x02c0325c,0xf21a8c10},{0x02e11a2c,0xfc2a875d},{0x04001a7f,0x331ed77f},
+{0x04802c29,0x41b3d95d},{0x01e106e6,0x3fc24844},{0x01a0a928,0xffc67b52},{0x03600612,0xd633505b},
+{0x01e02004,0x04773efe},{0x01e106dc,0x35bff9ef},{0x02c13324,0x6c1275ef},{0x02c133b3,0x8b139856},
+{0x0340316b,0xb37aeb2e},{0x0361250e,0x82a1505f},{0x05000fd3,0xd7363f73},{0x02a00f2c,0xb3d59a46},
+{0x032012a4,0x8222322b},{0x01a1f69a,0x8730c478},{0x03a1ec8e,0x83535220},{0x0200058f,0xde4e1fe7},
+{0x03601648,0x6eabbcbd},{0x0301f0ad,0xc78f200c},{0x00e1f99e,0x17bfcd4e},{0x07a0296f,0xd32ba673},
+{0x03c1d46c,0xef22fcc9},{0x028e018d,0xf767c9ab},{0x0341fb7c,0x65466bd4},{0x0500fd64,0x4d847580},
+{0x0361055d,0xb06d5dd2},{0x01802040,0x5fdd3dce},{0x02a0198e,0x9565ccea},{0x02000848,0x67dfb6cb},
+{0x03801124,0xf99faa22},{0x02811d67,0x02afb098},{0x03601735,0x0a63051d},{0x02e001c1,0x6740c3e8},
+{0x0520fd7e,0x816b082d},{0x0401f117,0x32302a8d},{0x0241b013,0xccf4cd6c},{0x01e0a344,0x37a5f9e2},
+{0x0420fbe0,0x4a64fc8c},{0x02602d80,0x642385c8},{0x01c10935,0x384b2755},{0x02616b09,0xb6afd7a4},
+{0x01c16a9c,0x9dd90d3a},{0x02e145dd,0x7bf4657e},{0x02411c1a,0x2f50e795},{0x01e1e2f5,0x26524968},
+{0x0240a8ac,0x1dcb4c7a},{0x03400951,0x6f69f8dd},{0x01e1163a,0x1502e688},{0x02601381,0x08e84763},
+{0x01a0a466,0x7d79e981},{0x01e10466,0x08bb0300},{0x03800502,0x81de89e1},{0x02602d85,0xc5829966},
+{0x02a0ab8a,0x192f7592},{0x02a1001b,0x13d5f2ce},{0x0301f035,0xab3ae4c9},{0x0240055a,0x4ae0f863},
+{0x0221f465,0xc026d8e9},{0x02011492,0x3dd8db86},{0x03610c81,0xb0caa4e7},{0x040124b3,0xfb04ff60},
+{0x00c1f3a9,0x4846d5a9},{0x0261b0d1,0xebfdba4d},{0x0261f637,0xe438cfc7},{0x01e1072a,0x8a6ef2ea},
+{0x04001c9b,0xb2c45abf},{0x0260152d,0x209ff42a},{0x02402029,0x46eae340},{0x02e124a4,0xfe0380d8},
+{0x02e14623,0x67de7fb3},{0x0280021d,0x77f61523},{0x028012e4,0x9ab76698},{0x03001407,0xa302ee36},
+{0x02811d78,0x62ae0921},{0x03c01ec9,0xcf75af5d},{0x02c13010,0x8c1f7111},{0x0121f9c9,0xf4d65bb2},
+{0x02e145a6,0x7936ed37},{0x0420250e,0xf030a573},{0x03610791,0xc5deca57},{0x05212432,0xb42c935f},
+{0x03c03194,0x8223a522},{0x03801458,0xd5f96868},{0x0520fdbf,0x5d77923a},{0x01a0a29f,0x8f47903e},
+{0x02e16e69,0x5bd44745},{0x01a102b9,0xbaf0a5c6},{0x02000352,0x0d2baf8b},{0x03e18b76,0x0bcdae25},
+{0x04002367,0x41992d68},{0x0301d45a,0xb3ca1517},{0x03401e3f,0xaab20385},{0x0201047d,0x6e843319},
+{0x01a02ea7,0x4724601c},{0x0341d868,0x18d88bbf},{0x02e10c31,0x8743ed09},{0x0220183d,0x5ffd0ad6},
+{0x02418acd,0xe7194c4d},{0x0241b011,0xcef4d092},{0x04601f24,0x8d09373b},{0x01e10732,0xfa765eff},
+{0x020013d2,0x9925377c},{0x04001cb5,0xf708b807},{0x02418ab3,0xbf97a840},{0x0360a6f1,0x630d3c3e},
+{0x0180a29d,0x846cd744},{0x0301f0c1,0x80c3239e},{0x02e0316a,0x544b5743},{0x0201f5bc,0xb6394508},
+{0x02600056,0x641518b7},{0x0401f115,0x24301483},{0x0121f14f,0x1e7839a0},{0x0101f330,0x523545e9},
+{0x01a0a30e,0xd67dc082},{0x02401270,0x1925e06f},{0x0121f9e2,0x19aebc93},{0x01a01747,0x07ef985e},
+{0x02c1d423,0xcf97d639},{0x0300abe8,0x2301e36d},{0x028e0069,0x7ec23571},{0x01a0a467,0xa6441012},
+{0x03c00622,0xe3c2ee05},{0x02418a6b,0xcba90445},{0x02e1058a,0x727bc8f7},{0x03e0010a,0x54e1361c},
+{0x03a0fac5,0xa06b2cdf},{0x02e168b5,0xfa137103},{0x02e14552,0xec3e5e05},{0x02411161,0x9f40b9bb},
+{0x0421d5e9,0x4236b65e},{0x02a01cef,0xb9dbd3b0},{0x0320a663,0x4470cf3c},{0x03010af4,0xd2206bb3},
+{0x030008f9,0xb5707c38},{0x02a0ab20,0x93d816f5},{0x0301f034,0xac3ae65c},{0x03a1daaf,0xc59fdc24},
+{0x01800e52,0x1bab252e},{0x0361e841,0x80a6b671},{0x0221030a,0xa85bbf02},{0x02e01cdf,0x7f28cce9},
+{0x036024eb,0xfa5f5602},{0x01a0a55f,0xfeec36ba},{0x04a1d77e,0x4e43f17a},{0x02616a32,0xd620d1ec},
+{0x02e145dc,0x7ef46a37},{0x02c131cf,0x59fce96a},{0x08c0fbfb,0xceeb124c},{0x03e01e36,0x31a3deb1},
+{0x0320ff85,0xe0768837},{0x032118b7,0x25eb083d},{0x01a10179,0xc24b34f3},{0x03a002cc,0xe9288672},
+{0x0281090b,0x46d1b831},{0x01e10518,0x796d8587},{0x02601bcd,0x768185ac},{0x02a0aa60,0x02562cfa},
+{0x0381e877,0x0196aac8},{0x0381d001,0xaa375582},{0x030010ac,0x099fc7e2},{0x0241f6b0,0xe5b7f2e3},
+{0x0180a03a,0x7e8665b8},{0x03a1df0f,0xcd3b91ae},{0x02e1684a,0xc495e411},{0x018027dc,0xd0d7e691},
+{0x0241d321,0x231aa7ef},{0x03a02cc9,0x1621d0ae},{0x03a1f3fe,0x2ac314e2},{0x01c02112,0xcc875ab2},
+{0x0361e124,0x34e6f5ca},{0x05c1d961,0xd39e47cd},{0x02c0abb2,0xa44ab8be},{0x022112de,0x144086f6},
+{0x01816a4f,0x47122008},{0x0141f683,0x4a32f4b6},{0x0121f194,0x517279bb},{0x01602120,0xcd1200fd},
+{0x0381d1bd,0x222a9c63},{0x0341e82d,0xa6ed9e8d},{0x02a00442,0xd1bda480},{0x03e1da1c,0x525ef28a},
+{0x02c008bb,0x73348f8e},{0x01c0a065,0x0303f5a8},{0x04001c9c,0xba373a96},{0x03c0ab5b,0x54804d03},
+{0x03c008a0,0x8cb07674},{0x024104e9,0xeabb0280},{0x03200d71,0x2a9814e1},{0x02c02d22,0x4363f42c},
+{0x01602aaa,0xdf07ae8c},{0x01800b85,0x2860038f},{0x01e01c14,0x77b09a99},{0x02810182,0x4f5d99c0},
+{0x02e1ed0d,0xa4b6035d},{0x038022ec,0x878b2d09},{0x0300a677,0xacf43997},{0x02a11705,0x82181c79},
+{0x02e122f4,0x94f8ea43},{0x03810ca9,0x3d2e1973},{0x02a1002f,0x27070d5b},{0x03c1d167,0xd5ad8ad6},
+{0x0280a769,0x44844107},{0x02a11c6b,0x1f480860},{0x02c13274,0x7fa93c34},{0x02e02abf,0x0be53487},
+{0x0341234e,0x6554dad5},{0x01e0a6eb,0x5fe7a201},{0x01a11719,0xd777e705},{0x02c131bc,0x51fa9e3b},
+{0x02e13239,0x637234c8},{0x03801530,0x8de4ae87},{0x03c1d0b7,0xf12850e2},{0x04602552,0x3d7ab6c5},
+{0x03401622,0x07365bfb},{0x02800f0f,0xdf963248},{0x0301d44e,0xa7ca0233},{0x0301d458,0xb1ca11f1},
+{0x02a0104f,0x21df10bf},{0x0360fb20,0x12f1cb74},{0x02a028c1,0xc71d674c},{0x02c11d2e,0x9c97bdf6},
+{0x0421d70d,0x51bcccd3},{0x02e1323b,0x657237ee},{0x0300a78c,0x2bcb0c3c},{0x02a01be8,0x78d33f17},
+{0x02c13205,0x717756a6},{0x0401d722,0x47f6d192},{0x020017bd,0x387c5688},{0x0300aa74,0xfe8c01b9},
+{0x03014477,0xebc753a6},{0x02e12092,0x67bff3bf},{0x02418ad8,0xde1b7cb9},{0x0261b0cd,0xe4b88ac4},
+{0x02800abd,0xdc0460ae},{0x03e10ae6,0x4cdc5bae},{0x07201f8a,0xa68f60bb},{0x03801d2f,0xdb33e11a},
+{0x03401db1,0xb02b1650},{0x02c0a9bc,0x6484ef14},{0x02602dc2,0x36e8a41d},{0x02601107,0x438a42b5},
+{0x03c1d567,0xf2256d43},{0x018114c5,0x99ad3fe3},{0x02201b55,0xe12ae21b},{0x02c131ed,0xc9021555},
+{0x0420fc6a,0xbde2b7fc},{0x01a00b2f,0x9f9775bb},{0x02401295,0xd8ef61b5},{0x0260a81b,0x577004e5},
+{0x02411a57,0x85581ae1},{0x03600962,0xaf14c22e},{0x0281f001,0x3bc4faa8},{0x02e144b6,0x8e03c009},
+{0x02c10d32,0xc1dc724a},{0x03a011de,0xb24ff65f},{0x03a1d140,0x5890bbb7},{0x032011d0,0x87af1d0d},
+{0x05a0fd68,0x49eb593c},{0x038000c1,0x93dc8256},{0x03201ba5,0x7f9b00b2},{0x0200136e,0x144d0f73},
+{0x00a1fa91,0x06fad72a},{0x03e18ba7,0x0be84ed0},{0x03010081,0x8ba04ab7},{0x0441d0d8,0x18aaeab5},
+{0x02e145db,0x7df468a4},{0x01a11701,0x945f60aa},{0x02c1310b,0xf0148f87},{0x04a1d8a6,0x3fc09519},
+{0x07801fa6,0xa05d5c13},{0x03410ce1,0x921e0470},{0x02418a8d,0x55a18ebe},{0x01e00964,0x718a3339},
+{0x04602bac,0xc2d61759},{0x01e0084b,0xc3b5a555},{0x01a0a321,0x8bc401f5},{0x0421d232,0xc777ed7c},
+{0x02a1f906,0x24e5dc2c},{0x0260a81f,0x176b22f7},{0x0161f95b,0x09f76ffd},{0x02002b55,0xdcba5cf7},
+{0x01c0221d,0x8ae1590f},{0x0241890a,0xa1187a78},{0x02e00349,0x4b3ad870},{0x0380ff2f,0x4cecd44b},
+{0x046004f3,0x2e5f6981},{0x02e028b9,0xaea0978e},{0x01e10713,0xf86512b8},{0x020111d0,0xb11b263e},
+{0x034011ce,0x09ec4bcd},{0x03203202,0x6cd0516e},{0x03c01e6f,0xff0a48e3},{0x01e01bea,0x05005ec3},
+{0x02c104cc,0x91f0ca38},{0x03c1f65c,0x6750281a},{0x03600142,0x6b3ba458},{0x0101f421,0x2fa2c987},
+{0x01c00c8e,0x0d376b3a},{0x01e00628,0x9ad4bd4c},{0x0261b108,0x6a345922},{0x020111ca,0x131beb9b},
+{0x01c006c6,0x9b5a6c65},{0x00a1f451,0xd5c440f0},{0x030102f0,0x939c70ab},{0x0260a89e,0xceb3f962},
+{0x0280249b,0x976c338c},{0x03000554,0x9e4c3652},{0x0181f60f,0xdeb04cfc},{0x03000fa3,0x029018b8},
+{0x01c03151,0x4b233506},{0x03200221,0xf4eb48a6},{0x0200005e,0xb6a30cd1},{0x01a0a5d3,0xd0e9afb9},
+{0x030120da,0xb03647c0},{0x02001a2c,0xee09b179},{0x03211366,0x623483c1},{0x03c1d4e6,0x3be98228},
+{0x03012330,0x4dd0a720},{0x0121144d,0x0136fcd3},{0x0081fa80,0x8f159405},{0x03a1e87e,0xcd4b6903},
+{0x01602308,0x630230ff},{0x03a1d597,0xf3918fee},{0x0220a6ef,0x195f1720},{0x04a1d06c,0xc0e75556},
+{0x0340ff62,0xaf6078a8},{0x02e10d30,0x5b3f3332},{0x02a02816,0x3cb0421e},{0x024188c2,0x0cfe3ec8},
+{0x02400aa2,0xb109b875},{0x03e18bdb,0xe6db489e},{0x0261b054,0x45e10bb4},{0x024104e7,0x1eb6d72e},
+{0x0480fc9e,0x672ca565},{0x024188b2,0x04db9fee},{0x020003d1,0x9b0a6241},{0x02c02ca6,0x8f371079},
+{0x032114b8,0x0aa09eb5},{0x0480fc9c,0x977f87c2},{0x032018d8,0x083e30a0},{0x01c01905,0xac7f94f6},
+{0x0320ff95,0x2c9bd0b4},{0x03000fa1,0xe69ef72e},{0x02016a99,0xac272c97},{0x01e00a93,0xf18aef4f},
+{0x02a1da3e,0x7a603381},{0x020030ce,0x42cff804},{0x01e102cc,0x0e7485f9},{0x01a02e2f,0x1f718d9b},
+{0x01a0a299,0x82701e37},{0x0360018a,0x19529106},{0x02602da2,0x6fe1b4ed},{0x02a12086,0x2e63d3ed},
+{0x03e0a752,0xb9a96489},{0x0480d7dc,0x6ece832d},{0x02c13104,0xdd16b035},{0x03e01066,0xd49ae463},
+{0x03014479,0xe9c75080},{0x0441f169,0xf34f679a},{0x03a1f7d1,0xb81f9740},{0x0141f5f0,0x2ab35238},
+{0x026100dd,0x8e988676},{0x03e1d728,0x5020da47},{0x02801582,0x06cb1bf5},{0x02200061,0x22575c8b},
+{0x02812fdc,0x9a0d733c},{0x026e007b,0xecfbe3f1},{0x01c1f582,0x196a098f},{0x02812f94,0xa9fc434b},
+{0x0301d906,0xacaae557},{0x01c0a6c1,0xd04d86d6},{0x03c1d700,0x486c65ca},{0x02a10f78,0x8faf7be1},
+{0x03400509,0xc860e650},{0x022122de,0xd6d98337},{0x02a1000b,0x53772ea7},{0x0201bc36,0x49cab60c},
+{0x0101f56b,0x17fed209},{0x01c01c41,0x77068b13},{0x0320ff7f,0xf6aa863c},{0x02010653,0xb8af3d44},
+{0x0340ff4b,0x02e0d6f6},{0x05a107ad,0x567cdff9},{0x0341e7f9,0xdf88ed31},{0x01a1e2de,0xb99e5b0a},
+{0x0421f87c,0x8d8f288c},{0x0420069f,0xed20e157},{0x01a0a03b,0x15926c38},{0x02002f5c,0xc9d8ca74},
+{0x02c132de,0xce4ab955},{0x024106b2,0x2ac3072c},{0x02602f95,0xec9250ae},{0x01c01960,0xdfe8619c},
+{0x01602137,0xad8f58ed},{0x02418a8f,0x53a18b98},{0x02002b24,0x54dd237b},{0x0380050c,0x2698a278},
+{0x0180a6b3,0x68d1ce28},{0x00e1f95c,0xb33f5d79},{0x0321ecae,0x5aa4c30e},{0x02e144f5,0xf7aa0faf},
+{0x04e0fba4,0x6b0323bc},{0x02a1d109,0x79cf1470},{0x02200a66,0x96fb50d6},{0x03210c2b,0x2ccaf716},
+{0x02011ad6,0xca0a0f48},{0x03a1d586,0xe291752b},{0x0461d76c,0x4b5036c2},{0x0281173c,0x92660503},
+{0x02616b17,0xb6a54a48},{0x01811706,0x0c1120e7},{0x02a169b2,0xe276e16b},{0x01c0aab1,0x421a29f0},
+{0x02603281,0xe4e3239c},{0x02c025a5,0x5b7f3e39},{0x02e144bb,0x0b00b339},{0x02601526,0x1c9fedde},
+{0x02a169c1,0x8b47b519},{0x022003da,0x3ab3adc6},{0x01a0a180,0x6c5a5b16},{0x01c11812,0x3bfef719},
+{0x04000708,0x613e05e5},{0x03a1d5a9,0x587bb951},{0x01a0a324,0xc7a64b55},{0x0380150d,0x54184f1e},
+{0x02c006d9,0xdbfdff70},{0x02c03165,0x2cbb4085},{0x01a0aa0b,0x3f250632},{0x0421f87d,0x403a9872},
+{0x02c02499,0xfc1517a0},{0x018026ec,0x9107ef7f},{0x0221036a,0x902b6976},{0x05a0fd63,0xa5ef64a7},
+{0x02210822,0xa5d796e2},{0x02601338,0xb07d36ac},{0x02800704,0xfbcfb1ce},{0x02e10bad,0x27afc0d1},
+{0x034024b6,0x4865e2b0},{0x02811d1f,0x6d89c655},{0x01c1118f,0x28aa51d8},{0x02010b05,0xaf9e2427},
+{0x02416fe1,0x5887ead8},{0x02802890,0x9b9796b5},{0x01c0208b,0x421da916},{0x032100e2,0xca67f12b},
+{0x03a1d679,0xda58826e},{0x02e0286d,0x767343fb},{0x02800f87,0x9016a951},{0x02801997,0x72315f12},
+{0x02402fbe,0x2b761295},{0x02a10ae0,0xee605f96},{0x03a12270,0x7474530f},{0x06c1d94d,0xcc94f8e7},
+{0x02418a19,0xb930d8d1},{0x02010190,0x24b693fb},{0x02410351,0x999de6e1},{0x0320fb59,0x59493538},
+{0x01c003d7,0x54d1a42e},{0x02801366,0xc88d4cab},{0x0301057f,0xa9130324},{0x02003068,0xae62d2ef},
+{0x07002918,0x720a3b67},{0x0301f891,0xb49c2cf6},{0x0361d50d,0x0bbc498e},{0x04400388,0xb8b52940},
+{0x03a02ac3,0x01bc87a4},{0x03e18c46,0xf99aa735},{0x034005f4,0x2e2f0f47},{0x0241883b,0xfe8e0b37},
+{0x02e02e5a,0x97a0157b},{0x0320d7e2,0xd953e45c},{0x01c02631,0x6c9182b7},{0x03c1fb9c,0xb8834c45},
+{0x03e1ed23,0x8052b868},{0x02e1337a,0x9dee890d},{0x0321d537,0x26a1a007},{0x02001b18,0xcaf5b9ae},
+{0x03010f1b,0xbc93e659},{0x0661fb41,0x62a93c2e},{0x0281f10d,0xdc5bcd42},{0x02802245,0xfd8a6093},
+{0x03003201,0x003fa483},{0x0301f05a,0x961a3c64},{0x02610a2d,0x44a16b46},{0x02c1f071,0x4b17fb75},
+{0x0281e7e9,0x6c1e99dc},{0x0380051e,0xad8a7105},{0x0361f63a,0x7ebbdd14},{0x030122f6,0x1265d304},
+{0x03c0319b,0x48768083},{0x03e18bab,0xa0e7a65f},{0x03e18b40,0x93c63578},{0x0201111e,0xaf628fac},
+{0x022112f1,0x3aa00832},{0x024189f3,0x3733ddc2},{0x01c0a601,0x5ec97af2},{0x030168e0,0x85efe03d},
+{0x02c1d125,0xacb83a80},{0x046004dd,0xa90a225d},{0x04c1da05,0x10b99b42},{0x02c13058,0x32f12d0f},
+{0x0260121b,0xd51e0f81},{0x01c1122a,0x26fcfdb4},{0x0280ff0d,0x0da18bc4},{0x0261b0db,0xe8bd0e3e},
+{0x0400d7da,0x899b2bff},{0x0320ff92,0xcc7d2480},{0x0241889c,0x8ee0f65a},{0x02418a12,0xb030caa6},
+{0x02402919,0xdca95432},{0x0321f7c9,0xdf7844b5},{0x02a11586,0xe8f5f58c},{0x02010471,0x9e9d6dba},
+{0x04a01cbe,0x67cfbf0d},{0x03416e91,0x63a846ed},{0x03e18b08,0x13cff954},{0x04a0a742,0x2ee80737},
+{0x03000678,0x90c78bb6},{0x026e010b,0x9d9a36c9},{0x01c0a2db,0xd2166b7a},{0x01e10510,0x5d8dad1e},
+{0x05c01f81,0xc2dc0d55},{0x0421f520,0x7ff85f79},{0x00a02647,0xc6cbdc6d},{0x02e14494,0xa00a9824},
+{0x01e0a3c4,0x686eb969},{0x02e00538,0x07997f5f},{0x02a16967,0xfd54527b},{0x0241896f,0xa98ae32e},
+{0x01a03348,0x00f71a9b},{0x03601661,0x02d4d5ea},{0x03a1ee5b,0xcaf4ff33},{0x02c13375,0x9dc358cb},
+{0x01c0a593,0xc4d0d749},{0x03200238,0x52d8cc33},{0x026119b3,0x27825189},{0x02c130f7,0x1cd4d8d1},
+{0x03e0d7d5,0xb03961bb},{0x0381ee80,0x1c64dea0},{0x02802493,0x0790b224},{0x038000cc,0x70753b8b},
+{0x03c00136,0xc55d8f16},{0x0340ff4a,0x03e0d889},{0x032121db,0xe860a132},{0x02a1f9d8,0x6227cb9d},
+{0x02c01d42,0x9de7d6a5},{0x01c0a370,0xf7aa808d},{0x03a12408,0xe6b15a33},{0x01811652,0x35c8d013},
+{0x024189b8,0x1cc158b6},{0x03e18bb7,0x1beaa697},{0x03a12333,0x7960cc05},{0x04c01f03,0xe6095fc4},
+{0x04e1d863,0x3ba12544},{0x01a02b20,0xd759f002},{0x01c0a162,0xff889a98},{0x03c1f227,0x05547767},
+{0x03010138,0x8da6ea3a},{0x02011a78,0x2ed5f886},{0x03e18ca7,0x078ce887},{0x02c13164,0x3bbe5383},
+{0x04e01ede,0x07099ae6},{0x040124f6,0x5792b55d},{0x02211c0d,0xc85814c0},{0x02c13314,0xf60b0068},
+{0x038021de,0x4483d4a5},{0x02c01b5d,0x5ba43392},{0x02e00551,0x609e88a8},{0x02c16b42,0x15863e1e},
+{0x03c1d4d2,0x2fe96f44},{0x03401577,0x65b8a98b},{0x01e106fe,0x2da1d843},{0x01a031e0,0x2a8182d7},
+{0x04e0278f,0x68cec9ec},{0x0580fd94,0x093f84b1},{0x04802bc5,0x1f67f091},{0x034121d7,0x241339e8},
+{0x03402129,0xab09a6c3},{0x020030cc,0x4cd007c2},{0x01c01c0e,0x1c0ce1df},{0x00a1fac1,0x787e0bb6},
+{0x0221081c,0xbbd1a956},{0x01a0a627,0x9e081669},{0x02c01390,0x9cc33142},{0x03000f9f,0x0676871e},
+{0x0361e128,0x26e6dfc0},{0x02600ecc,0xfcbc3f01},{0x0381ee86,0x3ab28110},{0x02802824,0x9d931cad},
+{0x02a0a8b7,0x1fa98327},{0x028019b2,0x598b7941},{0x01e0a13a,0xa2dfde03},{0x01e01c07,0x1c8d611a},
+{0x0621fa46,0xa495bf28},{0x02c1f072,0x4a17f9e2},{0x00c02014,0x5b0204db},{0x02e10c1e,0x3056ebcc},
+{0x02602d8b,0x9cdf10ce},{0x02c1f586,0xfd288224},{0x02810460,0x78826221},{0x01a0a317,0xc38cad23},
+{0x02602dd9,0x44a93e7b},{0x02610a19,0xacd12808},{0x04c01e76,0x33641e19},{0x05202914,0xe80876c5},
+{0x01c01781,0x31b7cbb4},{0x0540296d,0x8af41e89},{0x03c02c03,0xea942ebb},{0x01c11827,0xeeded696},
+{0x0141f4a8,0x91925981},{0x02601036,0xdebc6dfa},{0x03a006f3,0xddfff01e},{0x02a01a77,0x16b0bf38},
+{0x0301f04c,0xf0371c2e},{0x01a017a2,0x04dd928c},{0x0401f76c,0x06a88271},{0x02611d09,0x60e5aac9},
+{0x022115b8,0xe3ff15b6},{0x0180a4af,0x920a2b14},{0x02e133b2,0xf6e0a1ca},{0x02c03133,0x367d868e},
+{0x02216ad4,0xe4c40caa},{0x02e16b87,0xb03d02f3},{0x024189a5,0xa3cfa4c5},{0x02e01b35,0xca1c5189},
+{0x02a01442,0x5b701a97},{0x01c0a3aa,0x08a66808},{0x04a1d994,0xaed1296a},{0x03002735,0x24944059},
+{0x01e0a91b,0xfa9fb94c},{0x02201835,0x40257ae6},{0x01c12000,0x8b36052f},{0x010026be,0x1581f3bd},
+{0x02a11c65,0x948801cb},{0x04611a3d,0x123f41c3},{0x0241882e,0xeb897020},{0x01e01bec,0x0b006835},
+{0x04402cd6,0xd0950c49},{0x02a10037,0xcdd48555},{0x0301d6d5,0x96dab045},{0x0480ff9f,0x39afb994},
+{0x0160332c,0x04fa1593},{0x0261b10f,0x7820e774},{0x02c1d428,0xd297daf2},{0x0441f184,0x5a45a1cc},
+{0x02811d11,0x59a9fa84},{0x0161f462,0xe258005f},{0x02a16994,0x3e8c5fe3},{0x05001e69,0xd8172232},
+{0x03600119,0xbe19423c},{0x03a02570,0xef30b02d},{0x03410405,0x15418b33},{0x00e1f6c1,0x5188f7eb},
+{0x01811802,0x5283018b},{0x056020ec,0xce0f70b5},{0x020017da,0x9aaa2691},{0x01e10668,0xbe3036e5},
+{0x01c1fb22,0x522a6ece},{0x0480fcbb,0x15b892b6},{0x0441f175,0x6d45bfb5},{0x0420046d,0x256be68d},
+{0x0380ff32,0x57ece59c},{0x01a0a5db,0xf1260c41},{0x03e03236,0xe664198f},{0x0241886b,0x03e86a4e},
+{0x02e13287,0x9bfc98cf},{0x03a1d589,0xe59179e4},{0x02003058,0xa840373b},{0x02c1f064,0x6ce95fec},
+{0x0240fe08,0x5b688486},{0x01e0331a,0xdd5183b2},{0x0261b0cb,0xe2b8879e},{0x03e18b71,0x04cda320},
+{0x02a02101,0x901a45d6},{0x01c10e8f,0x4c73f254},{0x0360fe8f,0x0b2bf471},{0x0121f578,0x3d5ed4ee},
+{0x0261b0fc,0xa0ea7d55},{0x02c1ee0c,0xc5bd9f11},{0x02e14640,0x6bbf231d},{0x02000e82,0x671e0e36},
+{0x03600113,0x1e9894b9},{0x02402f99,0xf313c20d},{0x03a0fab5,0x246e3b42},{0x03602550,0xf32dcf40},
+{0x0561d998,0x9c3a56b3},{0x02402575,0x7714a292},{0x0200308a,0x4854bad3},{0x01e1f910,0x18ea7e13},
+{0x02c1f079,0xed80c93d},{0x01e11125,0xbdccb9bf},{0x028e01ed,0x98dfa06a},{0x0440a73e,0x555cdb19},
+{0x02c10598,0x164483e0},{0x01e1f4f6,0x4051507a},{0x03610796,0x6e5a1e0f},{0x03e1ee77,0xd442e1f9},
+{0x03e0279c,0x598d42e4},{0x04202a32,0x8b2a53b6},{0x00c02627,0xcbcd5e58},{0x01c1f4a4,0x8892d9d4},
+{0x02e1d30b,0x24d86e99},{0x0181f35b,0xc9895cc0},{0x02811c66,0x42e5dc41},{0x0481d148,0x79bbdae3},
+{0x01a00a70,0x8c4fb32f},{0x0200307f,0x5029e664},{0x0781fba4,0xd456bd0b},{0x02a030e3,0x3f3e5abc},
+{0x03a0022f,0xb1e4ebed},{0x02c13307,0xfb0d46de},{0x02a03287,0x44aa6001},{0x01a0a133,0xc7fa20e8},
+{0x04601fe9,0xc62cb1e7},{0x0121f3b1,0xa01198d5},{0x03a1f16e,0x76ba1a74},{0x02001b2e,0xdaed8419},
+{0x0361bc9d,0x2ad7daab},{0x034024c3,0x5765fa4d},{0x016026a0,0x1c21f1ea},{0x04401d8b,0xa61e7716},
+{0x03a021b1,0x476118f0},{0x05a1d9a1,0xea67904b},{0x01e016e5,0x22030e66},{0x04c0fcfa,0x48201ab4},
+{0x01e007af,0x6dc9cf4e},{0x0480a708,0x240654e3},{0x01a0a1c0,0x9377f35c},{0x03402a1f,0x3ce01fbe},
+{0x01e1f546,0x7cd07390},{0x0340fea8,0xb947d4a1},{0x0361d5d1,0xe19cb56e},{0x03800766,0x55453fb1},
+{0x02e0ffc3,0x5b5a869f},{0x01c01029,0x411a4ae5},{0x02a11d74,0xf5767965},{0x02012368,0x5f3c83ba},
+{0x01a11683,0xe5fef014},{0x01e03155,0xb1760ea7},{0x0081f6c0,0xdc617dc0},{0x038014b7,0x6d183027},
+{0x0261b0b9,0xa15a6731},{0x0201101e,0xfe51fe8d},{0x03210ceb,0x6d7385d8},{0x02a1fa4e,0x867f32a3},
+{0x032021fe,0x199c93e0},{0x02e16e67,0x64d45570},{0x01e1fb27,0x19ba838c},{0x02e005f3,0x2ce143e0},
+{0x03a0fb1e,0x6b3fa56d},{0x02412239,0x92a1d2ce},{0x01e1f648,0xe6751120},{0x0341d6b8,0x16a1786d},
+{0x0261f972,0x180b15c9},{0x00a1f47b,0x19181530},{0x05a0fc13,0x0edd42f2},{0x01e10487,0x950894fa},
+{0x02a01517,0x11c31ac7},{0x01a0a2c7,0xbe468245},{0x0340164e,0xf76e9b5c},{0x0360158c,0xdd2cbb7f},
+{0x0300ffca,0x13e523a8},{0x02c1f084,0x3460b1ac},{0x04001caa,0xb7ba8f75},{0x0560fd19,0x8589e30f},
+{0x01e1067e,0x442af9a9},{0x01c0a503,0xeda5162e},{0x05401f4b,0xae403006},{0x02e16e74,0x60d44f24},
+{0x026e0139,0x13a1ac50},{0x01c0a518,0xa4063789},{0x0320ffb5,0x9b2b33af},{0x02c0282b,0x19a13d19},
+{0x03e1f7ba,0x4ba252ed},{0x0100338b,0x7ea83a3a},{0x0181f38b,0xfa1b9eed},{0x02e1458d,0x703261de},
+{0x02a1e915,0xca51c030},{0x01c0a1a3,0xb75a5233},{0x01a0a2cb,0xfe28d1f1},{0x02c00399,0x5e9d5116},
+{0x05a1fa33,0x5c5c9b67},{0x0200a943,0x2f5cc77d},{0x02a0ff1c,0x8bf701d3},{0x02a0abbf,0x4d11b25a},
+{0x02e144ac,0x9a061184},{0x0361d50a,0x08bc44d5},{0x02c133cb,0x860f1349},{0x03e1d7fe,0x6b660ba0},
+{0x026012bd,0xef17aca2},{0x0381e870,0xcde1156e},{0x02a0094c,0xf1332997},{0x03010859,0xd93efb89},
+{0x026e010d,0x1f9731d8},{0x02e118c7,0x8458dc89},{0x0301ed12,0x640ee0ec},{0x02200aa1,0x6f2dd0c1},
+{0x0641fb55,0x85be494d},{0x03a00dc2,0x0ba2f44b},{0x02c1d34e,0xe7443bd5},{0x028e0064,0x79c22d92},
+{0x0140a6f4,0xe8367774},{0x02202b2b,0x7ab27865},{0x022016bb,0xaffca1f1},{0x020005b9,0x23a3f869},
+{0x02002d53,0xf457c2fb},{0x0201064b,0xaaa01cb0},{0x03e18c89,0x8290f184},{0x0361d097,0x2ddc3fd8},
+{0x03802b67,0xb713c99b},{0x01c0a5b2,0x6ec99422},{0x02401205,0xf4e0833f},{0x0181f4c4,0x519a41f5},
+{0x022104df,0xc6e47270},{0x02e0ffc6,0x656390b9},{0x02a1130b,0xd460361b},{0x0341e86a,0xa6a16028},
+{0x02a032bb,0x2d6a763e},{0x02c00a8c,0x283cfef9},{0x0300201d,0xc9677bf3},{0x02418a76,0xc6a6bdcf},
+{0x02003315,0x8ffddbd6},{0x04e02903,0xe30a472c},{0x02c1f08c,0xd8c9829a},{0x01c11183,0x26aa4eb2},
+{0x03c1d4e9,0x38e97d6f},{0x02003113,0x9ea5cc3a},{0x02c1d131,0x108a5b5b},{0x0420fd12,0x864771ed},
+{0x030101fc,0x8d748928},{0x03012540,0xb0a884f0},{0x02211293,0xc038f554},{0x03016b20,0x4e400f9e},
+{0x02e13429,0x20d691a6},{0x0180a4ef,0x7adf9b44},{0x0480fc06,0x3062e81d},{0x01e16f5b,0xb1dba713},
+{0x0440fce2,0xdc2458f2},{0x04c02562,0x66cd56c6},{0x03e18b28,0x8fd539b6},{0x036027cd,0x4647e89b},
+{0x02a0ab7f,0x01360b8f},{0x022032de,0x711bb0bb},{0x03c004a0,0x0f1fb140},{0x04e0336c,0xfe5bb8a8},
+{0x00e020ad,0x9cc19b36},{0x02401290,0xd4ef5b69},{0x02210492,0x21b1c039},{0x01600a73,0xf45c3deb},
+{0x02a11635,0x9f6a8417},{0x02210372,0x3a1bd78a},{0x02202e8f,0xe7fe22aa},{0x0441da28,0x8b5624c1},
+{0x05401f27,0x090e907e},{0x01c00b2d,0x93421f16},{0x04c1d166,0xd886bff6},{0x03c024b4,0x09013d0f},
+{0x02a031f6,0x43138001},{0x0180226a,0xd0f1279a},{0x020017ba,0x6899242c},{0x0340050d,0xe96e79d1},
+{0x02200e90,0xdbc3eeb8},{0x01a02085,0x1e38e852},{0x03416f53,0x44d4cf90},{0x0480fc44,0xfad23d09},
+{0x0421d5d8,0x5136cdfb},{0x0421d724,0x20eb6cb5},{0x0320fb47,0x3ef67ce0},{0x01811132,0x3e43be5f},
+{0x01e0310b,0x81f9fc72},{0x03800b77,0x327d4bdc},{0x0501d0db,0x9cf14031},{0x02c13144,0x3dc09540},
+{0x01e00c86,0x31337f7d},{0x0421d8dc,0x5915ba80},{0x05e023ef,0x482b3110},{0x03c01ef7,0xed91a2cd},
+{0x02c131ab,0x5558569c},{0x02610f1e,0x831e023e},{0x02e0a96c,0xa1d5cf8d},{0x04a02772,0x20a7094f},
+{0x01c16a9f,0x9bd90a14},{0x02a016d7,0xad320ac8},{0x03802557,0x87522c08},{0x01e0060f,0xdee1fbb6},
+{0x02c02899,0x26057de8},{0x02a11d1c,0x398d1b03},{0x02c01083,0xb2a94c3e},{0x03e01065,0xd0d52998},
+{0x01a11659,0xda4451b3},{0x0201d2e5,0x51a69611},{0x0301f03b,0xce65b7b7},{0x0381d6c6,0x5dc2a239},
+{0x0341d49f,0xd47c9ed6},{0x02c0aaf1,0x1a6eb1b0},{0x02200d30,0x024002b9},{0x0461d620,0xe0a2eafc},
+{0x046002ae,0x4e9fb3af},{0x02411c2b,0x638fdffc},{0x02600ac8,0x2ff102f0},{0x03001058,0xc178a1e7},
+{0x03e18c90,0x758e9e76},{0x030109c5,0xb6d88057},{0x014031e3,0x5c3971c0},{0x02400a69,0x8a1284ac},
+{0x03c1f221,0x4714309c},{0x02401291,0xc8ef4885},{0x0341040a,0xc34da04c},{0x038012d3,0x3561c9ef},
+{0x01816f26,0xcd6baacc},{0x01e12313,0xa0d903d5},{0x0281e7e1,0x53fbe1d2},{0x05a00750,0xd51f42a4},
+{0x0280103f,0x8262eda1},{0x02a11c40,0x8d9713d2},{0x02401301,0xc8e64e29},{0x03a1d916,0x0d4c07e7},
+{0x03401603,0xd13a8427},{0x018023e4,0x0095d0f8},{0x01e005d7,0x66efcb6f},{0x02e16b26,0x01caa587},
+{0x02801573,0xfc5d6ec6},{0x0141f5cd,0x08237052},{0x0560fd62,0x0e25b20f},{0x0401f871,0x136bc792},
+{0x01e01922,0xd58bc26b},{0x03a0a762,0x6a1de8ae},{0x018007d7,0xae6b03b7},{0x044109e7,0xcee1abdd},
+{0x02c1329e,0xda5d0c9c},{0x020017b6,0x30ade6bc},{0x010033ba,0x9fcb006f},{0x0381688f,0xcd2bf590},
+{0x04c00526,0x50f76b49},{0x02e0ffdb,0x5f952413},{0x028e019b,0x01635c3b},{0x04200174,0xafa20a12},
+{0x01c0a1de,0x46d0cf06},{0x01e103a0,0xb61a8392},{0x03001e9e,0xb6874cae},{0x020115a0,0xfa556424},
+{0x02600d22,0xc58d9497},{0x02c130a1,0xb42d25c5},{0x02a031f4,0x6b04b46f},{0x01c16a6f,0x2e797c92},
+{0x02a169ba,0xc96e3979},{0x03e02cc8,0xba4b5319},{0x02c130c5,0x413280ea},{0x04201e2a,0x7193fcba},
+{0x02c133cf,0xf71bf6ca},{0x01e10108,0x7dae679d},{0x024188d6,0x1310df29},{0x0421d5dc,0x4d36c7af},
+{0x0181f36b,0x5f7bf9b6},{0x01c16f19,0x60fe625d},{0x03410f4b,0xf44a532e},{0x0340a72a,0x5ad95ecd},
+{0x0441affe,0xd952600d},{0x02801c30,0x676bd92e},{0x0420fc84,0x729ab43e},{0x02801511,0x26822842},
+{0x01a0a1ba,0x4b8c9cbc},{0x02611c5d,0xf83dfb03},{0x03800963,0xffae0046},{0x0301f05e,0x1682d4a6},
+{0x0440fe93,0x1e4af67d},{0x02a0aba4,0x41185b3b},{0x03204dd6,0xaefd3e9b},{0x01c1f5e4,0xf267e59b},
+{0x02e0ffcb,0x6b9536f7},{0x02e0282f,0x8b93096e},{0x02c131e0,0x40ff00a6},{0x03401608,0x0b38a0de},
+{0x032006fd,0x2e164e34},{0x02c0a695,0xb8d0d2a5},{0x02c02d1b,0x566ecf69},{0x0361d71a,0x4616aea8},
+{0x02c13361,0xe2c0faca},{0x01e0a848,0x64494972},{0x0441f17a,0x7045c46e},{0x04c02247,0x594bfb86},
+{0x02a00903,0xe1f8cd33},{0x0440fd1e,0x9121db7b},{0x02c02177,0xfd445fe4},{0x03a1f3ff,0x29c3134f},
+{0x044120b8,0x34dbceef},{0x0380165e,0x0aca0b3f},{0x024188e0,0x130ea092},{0x02012123,0x75fe72db},
+{0x0420047d,0x8475f9e6},{0x0380a7d7,0x2100d2f6},{0x04602539,0xa2b5f15b},{0x0341253e,0xd7fe3c8b},
+{0x032101f2,0x35614de4},{0x02211169,0x56415cd3},{0x034111f1,0x70ebb203},{0x02a0280b,0xc116a215},
+{0x02801d49,0x5b8c6886},{0x03c01f60,0x836130b4},{0x04a1d658,0x3d1b10e8},{0x03a0fa73,0x373b868d},
+{0x054027ed,0xd5900273},{0x02e12303,0xc9b55bc8},{0x01a0a192,0x7c3c5f32},{0x01a0a280,0x8c6a6d21},
+{0x02a02475,0x72a015c0},{0x0260a772,0x02421782},{0x02e00689,0xb43ff91c},{0x01c16a70,0xd5dde290},
+{0x02e13418,0xb1cf2724},{0x02e14453,0xae764e87},{0x04c01cb9,0x30854733},{0x0501d7c8,0x7add64a3},
+{0x04210b5d,0x572a8065},{0x02418ac8,0xdc193afc},{0x03a01e57,0x341173bc},{0x03a0ff68,0xa96cbd50},
+{0x02a01a83,0x18dbb460},{0x0261f307,0x8e23f0ba},{0x01e16a8c,0x0d94134f},{0x02a01a88,0xc3d513db},
+{0x0241209f,0x09e99e26},{0x02c13218,0x727519a2},{0x0321207f,0x6e5cf51d},{0x02200cd5,0x2ffd9e1a},
+{0x03c01e96,0xb59ee25f},{0x02c03252,0xd8bb1103},{0x01e0a6e7,0xec6b10e4},{0x0341e853,0xa5a95038},
+{0x01a11203,0xaf417076},{0x01a0a603,0xe725fc83},{0x02e1693b,0x2a46c42e},{0x0360236a,0x1f82a279},
+{0x030028fc,0x908e2357},{0x0361d51b,0xf9bc2d38},{0x02c027d4,0x95c3ba3a},{0x03601630,0xf45e580b},
+{0x01e00e9e,0x57afb9e6},{0x046001cb,0x2de06490},{0x01c0a30f,0x79f68a96},{0x02202d52,0x090a7fc5},
+{0x0540fdaa,0xd38fb912},{0x03014478,0xeac75213},{0x04602961,0x8a7824ac},{0x01a1f5f4,0x19c95d90},
+{0x01c0a036,0x91c7c5fc},{0x0180a625,0x0435d1f4},{0x032005a0,0x1e6dd9dc},{0x01e009b9,0xdf2a3736},
+{0x0241e92a,0x6a0dc3bc},{0x01c0210e,0xca3aef5c},{0x0261b0a0,0x0d5083d9},{0x03800768,0xc4d2cf1f},
+{0x0361e81e,0xebace370},{0x01816f04,0x115f49e5},{0x0400026b,0x8b06fcad},{0x01811680,0x7150b8ed},
+{0x020103a5,0x9aaea6b3},{0x01c1158c,0x60226912},{0x02418817,0x6a8427df},{0x0341d445,0x25b2a43f},
+{0x04a004dc,0xfb9c87ce},{0x01e106dd,0x34bff85c},{0x02003066,0xb862e2ad},{0x0340ff45,0x0ce0e6b4},
+{0x02418a83,0xc3a47a7f},{0x03210124,0x47523659},{0x02201805,0x59734d7f},{0x030101d7,0x7b782b48},
+{0x0121f386,0xf8d8fe25},{0x024019d9,0x093b535a},{0x02e1441c,0x1f7dbc2f},{0x04002a37,0x1d5f1bf0},
+{0x02400d31,0x72e4e6e3},{0x00e1f37a,0x801db132},{0x00e02603,0xd7a88b3e},{0x02e16861,0xb8db2206},
+{0x03610e9b,0xb92f2f78},{0x03e18b2d,0xabd565ca},{0x02418a7b,0xc3a6b916},{0x02e145d2,0x76f21f08},
+{0x02e14416,0x1a7db450},{0x012002da,0x23b0a010},{0x02202462,0x8961c438},{0x02a01983,0xad70800e},
+{0x02012041,0x044984c7},{0x01a116a4,0xbde46d9f},{0x0280a734,0x65566fb3},{0x022032f5,0x512a88e5},
+{0x03210f26,0x45b3c234},{0x0361d1d1,0x83e65227},{0x01a0a0f7,0xaa2bbe72},{0x02803288,0x1e64888e},
+{0x0280ffee,0xae378d31},{0x02818d00,0xf0d15d7a},{0x020000b3,0xdb14352d},{0x03c025c3,0x370a64b0},
+{0x0381e142,0x9b51485e},{0x02c13322,0x6a1272c9},{0x03a1ed25,0xeca94a5c},{0x03a16b5d,0xf1f40682},
+{0x02418adf,0x691e9621},{0x028e016b,0x716ac850},{0x03a1daad,0xc79fdf4a},{0x0301229e,0xcbb2abe2},
+{0x02001c78,0xe5443a31},{0x02a1bc4c,0xb02317d5},{0x03200ae2,0xaa08e201},{0x0521d95c,0x0bc8ae7e},
+{0x01e0a509,0xf3d0afea},{0x02e132f0,0x80e35a1d},{0x0420fbae,0xe6530387},{0x0380a9be,0x566a7390},
+{0x02a1d32c,0x4771cda5},{0x03410cd7,0x9f20577e},{0x0101f513,0x4fd66ba6},{0x0241881c,0x6d842c98},
+{0x02a003f7,0x630eeb4f},{0x0261b075,0x2d16a4d8},{0x0381d4ff,0xdecfbd1a},{0x02e10093,0x3b3c90c1},
+{0x03e18c8f,0x29906569},{0x0501f10c,0x56563abe},{0x0301698a,0xdfb2155b},{0x0660fc63,0xbca4c9ac},
+{0x01e11494,0x2f4e770c},{0x02c13051,0x3cf13ccd},{0x02401352,0xf91cb3b3},{0x02a0ab76,0x11476de0},
+{0x02418a22,0xb23d99bf},{0x02202d60,0x030a7653},{0x01e1106a,0x430f716f},{0x0081f440,0x2f82d48b},
+{0x01202e47,0xd70e8268},{0x02012225,0xfef7f014},{0x00e1f5ca,0x0577f752},{0x04e01ed3,0xe14f21d1},
+{0x034024bd,0x5165f0db},{0x03c021cd,0xa4cc412b},{0x032016bf,0x77aa2339},{0x0401ed35,0xeaf8f94c},
+{0x03e01c90,0x9957b2f6},{0x01c11584,0x76228bb4},{0x01e01c17,0x368a7650},{0x02e1693c,0x7482cced},
+{0x03c1d470,0xfb230fad},{0x01ee007c,0x525e9f37},{0x038015f8,0x95a4d9d5},{0x038015b8,0x17b16bda},
+{0x00e026b9,0xc2e3b493},{0x024019e2,0x58042477},{0x024188e5,0x0a0c53d0},{0x0281e7e6,0x69fc0474},
+{0x03016807,0x0e26ed94},{0x0180a5e1,0xffe69f56},{0x03010c17,0xf4e42766},{0x02011c7f,0x31e7bd12},
+{0x05602ff4,0x4ce60c8a},{0x0421d62d,0x3eb1dd1e},{0x0661fa47,0x88ecd45c},{0x01c0a6a8,0x65eb7733},
+{0x05801fc2,0xe941b3c0},{0x022032f4,0x672aab87},{0x03e01f73,0x750a14e1},{0x01e0a5dc,0x8349ea12},
+{0x024106a7,0xf9d7bc8c},{0x02c13393,0x28be236e},{0x0340abdb,0x05a68a2c},{0x03202c48,0x4449facd},
+{0x02c132b9,0xf19dd27f},{0x01a0a294,0x8b3e8f96},{0x0201bc5b,0x47e07935},{0x0301f7b0,0x247a05ea},
+{0x030118de,0x1c415aa2},{0x02e16b3e,0x7000df35},{0x01e0a536,0x4afc8178},{0x02210824,0xe1dc7284},
+{0x02600e39,0xf6948ad1},{0x03c1f21a,0xee6cb44c},{0x01a0a3d1,0xf67ddae6},{0x0180331d,0x355d4f14},
+{0x03e1e89c,0x2321c740},{0x02e10b39,0x71938d40},{0x03612339,0xbf6f49d2},{0x03210a68,0x5d0cc2fc},
+{0x02403265,0xded48735},{0x01c11693,0x96e2b9de},{0x01e03319,0x8ec9f586},{0x0560fd97,0x715278cd},
+{0x020030dd,0x62ca1a36},{0x03401602,0xbb3a6185},{0x04200529,0x23d31472},{0x01a0a28a,0x805fcce1},
+{0x01c00c28,0x4058da94},{0x04e1d0ce,0xecd74d6e},{0x02a0047f,0xe0f19780},{0x0240117b,0x34acf49f},
+{0x04011663,0x796b306c},{0x0360ffa7,0xcb2f14ab},{0x0260ab28,0xe99d158f},{0x01e11a63,0x485ff978},
+{0x02802f3d,0x495426fd},{0x0200211e,0x01fbdcee},{0x0240a9d8,0x007f31f8},{0x0381213b,0x5689d354},
+{0x01c0a34b,0x0059ef99},{0x026e014b,0x9988e75c},{0x04e1f829,0x824c3ad2},{0x02610a2e,0x3c90158d},
+{0x02a00479,0x37bc067b},{0x0241f561,0x1258d2e4},{0x03e01e2d,0xba767920},{0x02202b06,0x5a876abf},
+{0x01c0a0ba,0x729da992},{0x01a00e54,0x09717ba8},{0x03401ddd,0x2b1b66e4},{0x02a02823,0xbf169eef},
+{0x02c1314b,0xc9c3b03b},{0x03003244,0xc4fcf5ce},{0x00c1f3cc,0x86466f52},{0x010033da,0x9acaf890},
+{0x02a003cf,0xd5ed7d08},{0x05001f13,0xf3f042e6},{0x022103c1,0x08e08647},{0x01e10479,0x6cc01d9a},
+{0x02800746,0xe37c4d01},{0x02a030e7,0x453e642e},{0x022112d9,0xf080f5a0},{0x0100221b,0x53bd8518},
+{0x0541da25,0x41ee969f},{0x0321f7c4,0xc2619609},{0x05602bed,0xb9876601},{0x040027b2,0xaecc968b},
+{0x0361f904,0x8f8878fb},{0x02201b89,0x64d38ef5},{0x01c02580,0x299b1b0f},{0x0321f020,0x198e6272},
+{0x02002424,0xd0da9a40},{0x0420aaf3,0x1477516f},{0x03403016,0x199f6ff6},{0x0360141f,0x8919f200},
+{0x0441f170,0x6645b4b0},{0x03e0019d,0xb1100ad9},{0x0241897b,0x2d903028},{0x028e0157,0x856f64fa},
+{0x0260124a,0x330235b7},{0x01c11307,0xacdc48bd},{0x02a02838,0x16178b87},{0x01c00b99,0xcd0880fe},
+{0x02c16b67,0x4f73b788},{0x02811931,0xe2c87c65},{0x03e0048d,0x641f5bcc},{0x02e1f745,0xece60324},
+{0x0481da0d,0x06df46b9},{0x0141f342,0x2193eb37},{0x02c131d1,0x57fce644},{0x0340ab40,0xe8fef599},
+{0x02a1693d,0x5abe044c},{0x02e14568,0x7743b604},{0x03a102f9,0x2f5b8598},{0x02c132ea,0x5b434887},
+{0x01c11696,0x0129982d},{0x0221bc2e,0x81411afd},{0x02c1311b,0x6c118124},{0x03e18c33,0xfc9cea85},
+{0x0101f939,0x95b3bfba},{0x02a1697a,0x05356bcc},{0x03003177,0xc487ff18},{0x0381d503,0xd2cfaa36},
+{0x028101f3,0x6e119cf2},{0x0341d100,0xeb0a9564},{0x01c11619,0xf079e78d},{0x01a16f45,0xd7f8b382},
+{0x02e14635,0xecc22cc7},{0x0260a8d5,0x9164f2f4},{0x03c02c06,0xcd02f14b},{0x02c133c5,0x8d15da13},
+{0x0340322d,0x3fc224ed},{0x03c10baf,0xa22045a2},{0x02411903,0x639f0da4},{0x012033ff,0x9e730aee},
+{0x02c132a4,0xe55d1ded},{0x01203371,0x535441fd},{0x034024cd,0x4165d7ab},{0x024010ed,0xe766acbf},
+{0x02000cb1,0x721ccf4e},{0x0341e808,0xef70fe6a},{0x01c0a2e8,0xc9da34ba},{0x03002269,0x515db723},
+{0x0361fb80,0x5a9b20f3},{0x03a1e87f,0x1f49c6cc},{0x0301d137,0x837c9fee},{0x0340a9bb,0x645f34a8},
+{0x04c1d7b5,0xa29664b5},{0x0360ab30,0x28cfabe8},{0x02c13143,0x40c099f9},{0x04202b77,0x7007c94f},
+{0x010033c8,0x92994f2c},{0x03a1d5b5,0x647bcc35},{0x0320039f,0x5211e640},{0x02a01a97,0x9fed2927},
+{0x01e1f3f4,0x01d49b70},{0x01e0aa30,0xfdb96e66},{0x03e18c15,0x8aa2473d},{0x01a0a3f5,0xb7f2a340},
+{0x0240095e,0x1c90066a},{0x03e02929,0x9af71296},{0x0380ff36,0x53ecdf50},{0x03c0a69d,0xb85597ec},
+{0x0300115c,0x756c0108},{0x024104e8,0xfab45feb},{0x018022a0,0x0b082184},{0x02c133de,0xd4bbcf05},
+{0x03c1d552,0xe7255bf2},{0x0301f0c2,0xc7252bab},{0x036015c8,0xa10ace52},{0x02e16e60,0x61d450b7},
+{0x03a01460,0x1e901d3b},{0x0340fedf,0x7037f111},{0x0621f81e,0x30fa5d9f},{0x05600c7e,0x426c625c},
+{0x03200f9c,0x374be4a4},{0x036012d1,0xc07ca078},{0x04a01e72,0xac3e1d44},{0x0361ee93,0x7a5bea8d},
+{0x02c133f9,0x1c7614e2},{0x02a0085b,0xd093b824},{0x01c1f534,0x077f3f0b},{0x02c16921,0x09939944},
+{0x03e0277e,0x00c43b9a},{0x01a1168a,0x11fab82a},{0x01e122db,0x87e7e704},{0x024188b7,0x0ffc04ea},
+{0x0381eca7,0x2385b943},{0x02e1315e,0x821a4aa9},{0x018007da,0x1cb63912},{0x03a023a4,0x2d6e37cb},
+{0x01e11c88,0x0072e16d},{0x06400770,0x9f24114f},{0x04c0fe86,0x8c11b1dc},{0x0400324f,0x072f74d7},
+{0x028015a0,0xebf75063},{0x02002629,0xb35aa35c},{0x0361e86b,0xb5908f24},{0x01a16f0e,0x73b84eca},
+{0x0480fc20,0x906ba1f4},{0x03a10b72,0x20d287c9},{0x0440a724,0x862bd702},{0x02c13002,0x8d1d340d},
+{0x0441da74,0xa2aa241e},{0x0301faf5,0x4460a031},{0x0261b076,0x2e16a66b},{0x02c131fd,0xf57a6509},
+{0x0560275b,0x7fc67e40},{0x0300241e,0x87485c48},{0x0300089a,0x09942acd},{0x02010623,0x2728752b},
+{0x02201170,0x87c30330},{0x0301d451,0xaaca06ec},{0x038008ab,0xdf41660a},{0x020121fd,0x644858ef},
+{0x0280a89f,0x5c684624},{0x050008cb,0x3905a496},{0x02203316,0x14f50e4a},{0x0520fdb3,0x4727c563},
+{0x02c02d17,0xfad2c602},{0x0381ed13,0xafafa48f},{0x03412508,0x1ec01473},{0x03000860,0xae8e64f3},
+{0x0300206c,0x35aeff04},{0x01a0a0cd,0x28f3daea},{0x0260aa8f,0x04576ce3},{0x01e10b35,0xc93490aa},
+{0x03c1d007,0x3be93e00},{0x02e1453e,0x7c9387bf},{0x03e18b9f,0xcbbe3edb},{0x03c024ae,0x13014ccd},
+{0x02000ab2,0x73b8d099},{0x03201b64,0x3317cea8},{0x0240126a,0xdd2b9229},{0x01e00bca,0xe62f0851},
+{0x02610f39,0x95dca451},{0x01e02326,0x07cb03e3},{0x03e18cb5,0x7989ca66},{0x02e11a0b,0xec3129f2},
+{0x02801b25,0x8aac7d3c},{0x03210a94,0x71fb0e39},{0x0320188e,0x5d4223cd},{0x02c1d17a,0x99c4a2b7},
+{0x02200f00,0x3b067722},{0x04c0fd4a,0xeda20cff},{0x01c01be3,0x5b30b54a},{0x01a1f66d,0xacc4c6a3},
+{0x04e1d980,0xc50154c2},{0x0341d444,0x26b2a5d2},{0x01e0a90e,0x5eaf6142},{0x02e13396,0x064c6e2b},
+{0x0300228b,0x2e81dfcf},{0x01a0a0ee,0xb213c624},{0x03811fcd,0x6ebd3fef},{0x03a1e11b,0xcbd8165f},
+{0x02801223,0x8715bef3},{0x01a00c05,0x570b9040},{0x046033e5,0xd34f27c5},{0x01e00997,0xcf4a71b1},
+{0x04010a51,0x046c76af},{0x00c000af,0x6c63f647},{0x0280158f,0x8867612e},{0x0420257e,0x35c0bfac},
+{0x04001f09,0xde8a8b23},{0x01c0a3cc,0x00a6903d},{0x01e110ba,0x5f1c52bf},{0x05a1f247,0x325a1e23},
+{0x0380319f,0x85d88cee},{0x02c00707,0x31a2f5fa},{0x01a02221,0x6a9eb90c},{0x02812fc6,0x1bf6e693},
+{0x01a11691,0xedf840e7},{0x0360fb2a,0x57c75fcd},{0x02001923,0x392b1e7a},{0x01a0a083,0x676b9c58},
+{0x042022b5,0x153dd4b0},{0x03216e5f,0x7485616e},{0x0220318a,0x82d95f39},{0x01a0a3bc,0xc27b626f},
+{0x03202c73,0x32647a26},{0x01a1f433,0xc01fa2a3},{0x020016e4,0xc2d80654},{0x0101f3e5,0x00e98b33},
+{0x02212095,0x01c30657},{0x02e131c8,0x4793e141},{0x01a0a6ab,0x9718d65a},{0x0441d778,0x79ff0484},
+{0x0161f358,0xc8521d41},{0x032003ea,0xe9f19180},{0x03c1e004,0x24c6f74a},{0x0321f74b,0x598ecf8a},
+{0x04001ab0,0x0930d3a4},{0x02611c58,0x905efe32},{0x0341d44a,0x20b29c60},{0x01c0a2d3,0x02019c52},
+{0x02202fd1,0xdf95060d},{0x02e1057a,0xca607d02},{0x02418a5d,0x55ae5ab1},{0x02c1699a,0x4decf414},
+{0x01a0a315,0x7cc3ea58},{0x0460fd29,0xa459d35e},{0x02200a5c,0x2383f6fa},{0x0180a3cf,0xa480915c},
+{0x02200ab7,0x9c57694b},{0x01a10297,0xfeee0ecb},{0x03000fb2,0xea856594},{0x01c0a167,0x0588a40a},
+{0x01e11122,0x4a28f620},{0x02002463,0xe8b5c31c},{0x0540ab67,0x6ed6fe6a},{0x01e1212d,0xa81bf4c7},
+{0x0421d629,0x42b1e36a},{0x02c13118,0x6f1185dd},{0x02c028d8,0x000dec24},{0x02e168dc,0x92545a9e},
+{0x0180a0d3,0x6263a762},{0x03202ee6,0x61b1a883},{0x04200134,0x3e4eb091},{0x0161f6ca,0x249c2f64},
+{0x03e18c85,0x7690dea0},{0x028e01d9,0x94d08f94},{0x03011a11,0x025bac6c},{0x02418950,0x34836f3a},
+{0x01a0aa09,0x44e28332},{0x050121de,0xbf0e9e99},{0x0200a94b,0x94dd5f7b},{0x0701fb67,0x957f5622},
+{0x030121e5,0xeacad5fe},{0x03014431,0x933c4b9a},{0x04812166,0x60fe279e},{0x02c02d11,0xf64350d4},
+{0x02a01860,0x443cf2f0},{0x02e00261,0x65ac1c34},{0x03400103,0x102e174b},{0x0180a2aa,0x926ced4e},
+{0x0580fd86,0x5922ac16},{0x028028c0,0x179cd717},{0x02610a43,0x983f0e55},{0x0300083b,0x4ae6e575},
+{0x01a1f3a8,0x3ad7b719},{0x0360140f,0xf72495a8},{0x0101f516,0x239b3e99},{0x0320ff8c,0x2070dcc9},
+{0x0341e81f,0xddb8438b},{0x0461d610,0xd0a2d1cc},{0x02e109b6,0x7fb123b1},{0x03010430,0x66c5f401},
+{0x018016e9,0x69250af9},{0x03c10b69,0x73aba6df},{0x02600acc,0x2bf0fca4},{0x03212236,0x5072988e},
+{0x02811da1,0x7c529d01},{0x048115d0,0x5dd7ab5f},{0x01a0a111,0xf2a3a410},{0x02c132ce,0x66987a80},
+{0x0401d011,0xfa90cc2d},{0x05802a91,0x0a2ac8bf},{0x0681cfa4,0x12dae546},{0x02418a0a,0xae2e88e9},
+{0x0341d441,0x39b2c3bb},{0x01c00b19,0xc75b58cd},{0x01600025,0x8758c107},{0x02c1218c,0x744dbdf3},
+{0x0180a0f0,0x448a8798},{0x03210c0c,0xcf6f0128},{0x02011598,0xff8c8478},{0x02e0286b,0x86d34f6a},
+{0x0321f57c,0x31107b6d},{0x01e01c73,0xd78aa0f5},{0x02201a69,0xc7c1f6ec},{0x02c1320e,0x7977633e},
+{0x01e1f5a5,0xe9047d2a},{0x03200192,0xc3cba291},{0x010033dc,0x70c877db},{0x01c1f5bd,0x1b4909cf},
+{0x0360012b,0x049db99d},{0x02e16b84,0x5f5e3c6a},{0x02e10c36,0x7543d0b3},{0x02c1307d,0x342361e9},
+{0x02600937,0xeefe8d98},{0x02418a4d,0x2d499453},{0x02c132a3,0xd65d0650},{0x036015c5,0x9b0ac4e0},
+{0x0380a8e5,0x0bd9a898},{0x01e106c8,0xbdb88142},{0x02c16995,0x2d819d78},{0x02210486,0xb61557cd},
+{0x0300a9fa,0x005802da},{0x044027e6,0xa31ba582},{0x01a0225a,0x6b60110c},{0x03c027aa,0x7af55136},
+{0x02c1301f,0xf9225b3f},{0x03c1f219,0x3de2d8a7},{0x01c11092,0x903df603},{0x01e0a55d,0x42fc74e0},
+{0x03a0ff6a,0xb56cd034},{0x02602b04,0xcee4c87c},{0x02e145d1,0x77f2209b},{0x0421d22e,0xc87a2da6},
+{0x01c02cfe,0xf4237c0a},{0x01a1f46e,0x91132f17},{0x038021ba,0x1958a2b6},{0x0121f4c7,0x328580c5},
+{0x01a0174f,0x1018f2fd},{0x0261b093,0xecd6c46c},{0x04e01f14,0x07d5c5b1},{0x0361d693,0x3606e137},
+{0x03002181,0xa22498ee},{0x0541d891,0xfb6265d8},{0x022019fa,0x95548c85},{0x0200306b,0x50232a9f},
+{0x03c10b58,0x200d03ec},{0x02e029f0,0x6a237d86},{0x01c0a23f,0x6f22bc2a},{0x036015e4,0x18a4423f},
+{0x0381d1a2,0xa0f9848f},{0x03216e50,0x5b853a13},{0x01a0a130,0xcbfa2734},{0x0380087a,0x7734a73b},
+{0x0301fa2e,0xcd5c07af},{0x0341e825,0xff077910},{0x04a0fcd5,0x5c26faf0},{0x022009cd,0x1c404962},
+{0x04a1d943,0x06c69955},{0x04a12373,0x5bc92e7a},{0x03400743,0x8a3fbab5},{0x034109c7,0x90c171a4},
+{0x0341f869,0x3f43635f},{0x0061fa93,0xbe92413b},{0x02a014b0,0xb888d142},{0x00e1f36e,0x037dad4f},
+{0x0320290f,0x6832e42d},{0x042006d1,0x70c3ad98},{0x01e00641,0x6798ebb0},{0x05a1d0b2,0xa82438b5},
+{0x01c0a551,0xac70d0cc},{0x0181e29e,0x7abfc112},{0x02e1d802,0x71e21aa5},{0x02c13013,0x8a1f6deb},
+{0x03e18c62,0x8595736b},{0x02e13185,0xc013d54e},{0x01616a5d,0x0d29f462},{0x026e0114,0x26973cdd},
+{0x02c0228d,0x8bf1c488},{0x0381e897,0xc8fa3a78},{0x01a0223c,0xf05c62b1},{0x06a01fa5,0x86714fb6},
+{0x0341f134,0xf000f8d7},{0x036015f5,0x4b7890e2},{0x024188af,0xffdb980f},{0x01c01795,0x0bbfb51d},
+{0x02e144e9,0x89a723ee},{0x02e12214,0xf5cdc854},{0x0320ff7c,0xf4aa8316},{0x02616a2d,0xba1e6741},
+{0x0401e14e,0xd357ef05},{0x0240a8ab,0xf5e0d3d1},{0x01e10f3e,0x0832700b},{0x01e00e24,0x2c1996b7},
+{0x02a02d21,0x3d308095},{0x0200263b,0x4256e62a},{0x01e0a16c,0xcb059a15},{0x05210161,0x66536db9},
+{0x03e18b6b,0x0dcb72b4},{0x03401bfd,0x692834e9},{0x02e003e6,0x5f4d2b80},{0x0320054f,0xfa01bb68},
+{0x02610875,0x1d8c65d4},{0x0221082a,0xc1da018d},{0x01e0312a,0x99fa223a},{0x02802716,0xfb56232e},
+{0x0240a778,0xd5b8a87e},{0x01a0a486,0x03f87e91},{0x0201f959,0x7ec8214f},{0x02418891,0xfdddd380},
+{0x0341d43a,0x30b2b590},{0x028e01b1,0x735dff83},{0x03e01e56,0x8cd58469},{0x01c0a351,0xd5824e58},
+{0x020031a6,0x798b4e7e},{0x01c0a291,0x5e8c385b},{0x0240a8a3,0x31edfe38},{0x0361f00f,0x19bf162c},
+{0x02401aaa,0x24a2b9cd},{0x02c130c4,0x4232827d},{0x01602b91,0x5a1be26b},{0x02e1f571,0xe99677d1},
+{0x01c0a0a4,0x17ec3329},{0x02202d4f,0x1b0a9c1b},{0x0300d7ea,0xef11c963},{0x0141e94a,0x24d249bb},
+{0x016e002b,0x18572182},{0x0420257c,0x7e7efd78},{0x04000215,0xd6ca945b},{0x02811c39,0xe99e6534},
+{0x0180a616,0x6db566f9},{0x02801b10,0x39a1a0cd},{0x01c0a6ac,0xabbd1e77},{0x02c130c0,0xb62aea54},
+{0x0320abdf,0x93382a48},{0x0100339e,0xb9b5630e},{0x01ce0025,0x6115a4b1},{0x04a1fbb4,0xb47403dc},
+{0x02e1452a,0xf5ac4b20},{0x0261b0a2,0x0f5086ff},{0x01602e2d,0x5ebccf51},{0x028e01bf,0x0ad8051b},
+{0x036001b2,0xf592a748},{0x01e029d8,0x7fd7768a},{0x0360a8ee,0x91e23680},{0x0481d8cb,0x01d5f146},
+{0x02c0171f,0x6b7337ce},{0x044109e2,0xd2bab0c2},{0x02a01b1d,0x49ad5dde},{0x0340aa5f,0x6694bf34},
+{0x020017be,0x80b2e1da},{0x028003b2,0xf6e2a55c},{0x0380138c,0xc7256f99},{0x0381d4fc,0xdbcfb861},
+{0x01a16f23,0xc01a3d07},{0x0240fe02,0x61688df8},{0x02c13312,0xf30d3a46},{0x02e1336a,0x176eeb38},
+{0x01c01c20,0x8c144df4},{0x00e02440,0xe4fa8ff8},{0x01e0a504,0x7ae23920},{0x0261f5f3,0x30bb1ca6},
+{0x03403224,0x43ca0638},{0x01a11202,0xab416a2a},{0x03c1ed1a,0x0a129006},{0x04602b5b,0xcbbbd809},
+{0x0401d9f5,0x1b215b37},{0x01202593,0xbefcdc2a},{0x02810fc0,0x1a91a9bf},{0x0300aa7d,0xeca6c3b9},
+{0x01c1f498,0xf48d7700},{0x03a10999,0x8d8c55ab},{0x0240300d,0xa96b204c},{0x02802882,0x19900e4a},
+{0x016029d3,0x655296ce},{0x02803292,0x3d235d18},{0x03c01ecf,0xa720a67f},{0x03a1d6dc,0x0734afe0},
+{0x02816976,0x3a0dadea},{0x02e1333a,0x1a398090},{0x0241236d,0xa55c579e},{0x03e01efa,0x30410819},
+{0x04400213,0x327dae3b},{0x01603323,0xf405c6b9},{0x0281f660,0x4cfc2d64},{0x02c11d32,0xcd87e77f},
+{0x02c00cf2,0x4fc76bab},{0x01c0a43a,0x5d0c9e93},{0x04001e26,0xef596af2},{0x03210c2c,0x7458ab98},
+{0x00a1f686,0x2393a209},{0x02402e1b,0x0186f688},{0x03e18b53,0x96c878c8},{0x03610f88,0xea54f32a},
+{0x03202a04,0x1b4f0014},{0x00a1fa95,0x1f8ab051},{0x02602daa,0xa28b44ad},{0x0220a908,0x28c56b2a},
+{0x02c01391,0xf00f74ed},{0x0180193b,0x7cef9e80},{0x0381ee27,0xeea9c528},{0x048004a2,0x03eebe10},
+{0x01e00f4f,0xe9af80c1},{0x02a10040,0xc0c8d7da},{0x028012bb,0x2d3a7635},{0x03e10f57,0xb710d2af},
+{0x03c1f235,0x79fbcccc},{0x022029f9,0x14dd7cb4},{0x01616a5b,0xd95fbc80},{0x0301d13d,0x5491b391},
+{0x02201765,0x96c58e16},{0x01a1181d,0xee476eb1},{0x02c03180,0x9a13fbf8},{0x0280147e,0xea51de95},
+{0x01e111d2,0x8347c456},{0x0301233f,0x45c6f3ba},{0x01e11028,0x4775fe01},{0x00e1faa0,0xebdcfbd8},
+{0x01c0a936,0xd11ab789},{0x0360153f,0x50b40740},{0x026169f6,0x554682ae},{0x024014d0,0xa64bdf46},
+{0x0481fa15,0x889a3030},{0x02e16838,0x8a949436},{0x03a0fa7d,0x003b2ff8},{0x02c133d9,0xf01bebc5},
+{0x03e18bb2,0x16ea9eb8},{0x032011b2,0x39942776},{0x03412506,0x52d3ee07},{0x022032e8,0x7114f4f6},
+{0x03c0151c,0xcb8a194e},{0x02200a1e,0xb646641d},{0x04a004b6,0x9ad61eab},{0x04e025c8,0xdbd0584c},
+{0x02c13136,0x672083cf},{0x01e00f22,0xa83e057b},{0x02418aa0,0x509d09b1},{0x02e13419,0xb2cf28b7},
+{0x01c0a85e,0x6e5992a0},{0x028030a5,0x156ae5e1},{0x02801491,0x4d6590af},{0x01a00ed7,0x3123aa89},
+{0x0461d080,0x920a4290},{0x02404def,0x595b7a80},{0x0181f44d,0x908fd81c},{0x01c0a3c0,0x6346303d},
+{0x01c0058a,0xeaed6dea},{0x05010f1c,0xcb8a58d9},{0x0340072f,0x3c919e28},{0x0221064e,0xb0a6a80a},
+{0x0341e80c,0xf1febe68},{0x0381d706,0x41af99f5},{0x0141f349,0x978e8377},{0x028e0186,0xee67bb80},
+{0x03011ca7,0x12c84843},{0x01a0a2b4,0xe94fc052},{0x01e10339,0x01f2e5aa},{0x02011192,0x79da229f},
+{0x02402d43,0xc8c2f51f},{0x04e02545,0x69466095},{0x02010601,0x2132f915},{0x0301681a,0x213b1935},
+{0x008029fe,0x26b6b2ab},{0x01a0a016,0x63f521f6},{0x02a1e919,0x9cbe024a},{0x04e1d947,0xa2f8a6c0},
+{0x01a116a6,0x25da83fb},{0x030022b3,0xf690ef36},{0x02800803,0x26951be3},{0x02600d29,0xcd28ba81},
+{0x03800123,0xf6c609c1},{0x02c1331d,0xfd0b0b6d},{0x02418af7,0x6d11d07a},{0x02c025ae,0xf4830197},
+{0x0421f67b,0xcfa19caf},{0x034109ce,0xc4d42ca0},{0x0280a951,0xd68e169c},{0x0380ff30,0x59ece8c2},
+{0x014026df,0x4d4f904f},{0x0380ff2b,0x50ecda97},{0x02812fc8,0x1df4ab22},{0x058008a8,0xb11b5c5f},
+{0x02a10015,0xa95f356a},{0x03002c4c,0xa2f93ea1},{0x01616a45,0x294cb2b8},{0x01a01bc5,0xd2a2f745},
+{0x02e11ae5,0x7ed173d1},{0x0300283f,0x12757a17},{0x02211ef5,0x22333210},{0x02202315,0xdf3e9f69},
+{0x03e12169,0x41ffe0e5},{0x0421d62b,0x40b1e044},{0x0261b019,0x5563bc18},{0x04e01ebf,0x694b1f8a},
+{0x04c1ed38,0x5ed94cc7},{0x0161f6ab,0xb097afdf},{0x01e10706,0xf3674970},{0x03610a61,0x41f236f8},
+{0x02a01b0d,0xa9a7869c},{0x020013a9,0x97f3991d},{0x01e10728,0x857129a2},{0x0221081a,0xc1d1b2c8},
+{0x02816867,0xebd963d7},{0x00c02bdc,0xe636e35a},{0x0100337a,0x6db96898},{0x02c01d33,0xade7efd5},
+{0x03801e30,0x8902aed4},{0x0241b00e,0x501cab15},{0x01a0a5a3,0xdae303b2},{0x0221f3d6,0x8152b1c4},
+{0x0300169c,0xd6770791},{0x02c021c9,0x03f493df},{0x02a00c8b,0x71d78b1a},{0x05c1d96c,0x69c2d875},
+{0x02a00440,0x1ee2ee90},{0x0221f0e4,0xc3f80cdf},{0x026122e8,0x6bf72281},{0x02812fe7,0x2f64e36c},
+{0x030024db,0x46b69e46},{0x02e017ab,0xb072b748},{0x04a01da1,0xee151733},{0x01a0a228,0xc8f96bf4},
+{0x0381e104,0xc6832dcc},{0x024188f6,0x111da7f6},{0x02e14596,0xe039cdf3},{0x01a16f05,0x09124931},
+{0x01a00b9c,0xb53c4e21},{0x02c12371,0x445d8912},{0x02402f65,0x0ddadfeb},{0x03a0a797,0x7f8dce46},
+{0x022006a6,0x74e38a23},{0x02e115db,0xf158d244},{0x02e144b1,0x9103c4c2},{0x03c1f739,0x07ab3c52},
+{0x0441eeb6,0x441c7e55},{0x0141f357,0x42132d7e},{0x02802aa1,0xa1e1220d},{0x0381daa5,0xb333d21b},
+{0x01c11a50,0x327ff3c8},{0x0321fb7a,0x5f828933},{0x03012325,0x485dab01},{0x0181173f,0x1e573459},
+{0x0261b11c,0xf41b9a7a},{0x0181f3f6,0x6619521a},{0x03002019,0xb65d13a4},{0x02a1bc87,0x7c46e4c4},
+{0x026014a3,0x2c6e6a42},{0x01e10b2f,0x994a0b69},{0x01e01724,0xb298b9fd},{0x02801b31,0xf7562235},
+{0x02c1f081,0x3360b019},{0x03011a59,0x87b0387e},{0x03a1d91e,0xe9d92966},{0x02802d89,0x6bdaf121},
+{0x0301d407,0xc04d0996},{0x01e1222a,0xa4139fb6},{0x02a00251,0x2e1ee4cc},{0x01e026a1,0xa93cfecc},
+{0x04001dae,0x8d63fea5},{0x034001d2,0x6adc52d8},{0x01e1f02b,0x924313e2},{0x024188a6,0xfed957e5},
+{0x03a00716,0xf566783c},{0x04e0278b,0x3d7f2dd6},{0x02c1689b,0x41fe50c7},{0x03401df1,0x361b7835},
+{0x02a014fe,0xb98b69d4},{0x0381fb81,0x48f0d43e},{0x0441d763,0x6f11c7bf},{0x02c03006,0xaa468ebe},
+{0x02a01512,0xa9e50951},{0x03e02781,0x82d03635},{0x02a11100,0x425d9670},{0x026017d5,0x621993f6},
+{0x02a16927,0xebc49c5b},{0x02e02a2c,0x4d197658},{0x02000857,0xa755b6d4},{0x02e14414,0x1c7db776},
+{0x01e03093,0xc0810a0c},{0x034024c4,0x5665f8ba},{0x02000c6e,0x587bf635},{0x0521cf68,0xb5cb311c},
+{0x022032ef,0x130da537},{0x02a02746,0xe40d2989},{0x03e18b84,0x17bc77e8},{0x024104ec,0x268546fa},
+{0x0541df17,0x7daaa699},{0x02e02d15,0x600ed3ca},{0x02e131da,0xa40f3b69},{0x01e0084a,0xbcb59a50},
+{0x02812ff1,0xd448020f},{0x0281e8c8,0x89e19682},{0x02616a1d,0x9e3e8ed8},{0x03a1e01f,0x428e422f},
+{0x03a0facb,0x0d6bd876},{0x024188bb,0x03fbf206},{0x0381d141,0xfe73e282},{0x02a11d2a,0x67c9dfb1},
+{0x02802822,0x0b8ff840},{0x02e14451,0xac764b61},{0x01e106fc,0x329fa18b},{0x01a0a499,0x824928f6},
+{0x0261b0d5,0x6bd5e15d},{0x0201bc2a,0x59c28077},{0x020013af,0xb80fa1fa},{0x02011597,0xbd125faf},
+{0x02a0043d,0x1ae2e844},{0x01a02006,0x00630a56},{0x03a001b5,0xe1187da3},{0x01e0a6ba,0xf2f1faa3},
+{0x03401d5a,0x10517178},{0x0380ff38,0x61ecf55a},{0x02010602,0x2032f782},{0x0261b08c,0x78f422e4},
+{0x01e0a544,0x7d49e0a0},{0x0560fd72,0xf5a95b60},{0x0261b0e0,0x009cba8b},{0x02a01589,0x924c8ad7},
+{0x026e010f,0x219734fe},{0x02a16a38,0x0e66e269},{0x01c0a1a7,0x781947b0},{0x02010640,0x1e21ab3b},
+{0x01a0a4c2,0xb6e1dd8f},{0x02ce0047,0x6c3c647e},{0x01816f0b,0xe5765df0},{0x02202ed2,0x043aac2f},
+{0x0280138e,0xb92caa07},{0x01a0a560,0x130ee878},{0x02403261,0x3bda5265},{0x02e10ba9,0x7b4ecaba},
+{0x0321d36f,0x48e4042f},{0x0361ec91,0xd277a7a8},{0x01e16ac4,0x725c6982},{0x01e11c8a,0xe17c082a},
+{0x03a1208c,0xea2177d4},{0x02a169c2,0x2cfeb257},{0x030006db,0x9275fe28},{0x03e0319c,0xfb8d6230},
+{0x0280107a,0x52dead08},{0x02800941,0x500a69b4},{0x01ae0027,0x80da3ae2},{0x032023d5,0x6f5ef4ed},
+{0x02a00674,0xe5074b80},{0x04001f51,0x9aff2462},{0x00c022a9,0x5a8cda55},{0x01e10724,0x8a713181},
+{0x0540336e,0x991375a2},{0x01a007a6,0x808c473a},{0x02c1d908,0xbbbc9603},{0x01c0a150,0xf64d9f28},
+{0x01c0a0fe,0x24e5b3a0},{0x03e02cd8,0xbd486bed},{0x0241b012,0xcff4d225},{0x02812fd0,0x25f4b7ba},
+{0x01a00e55,0x7a1c872c},{0x01602007,0x089525d9},{0x04e1da5c,0x0d0a001f},{0x026029b1,0x923866b5},
+{0x02602db2,0x38bfb2b7},{0x03802b60,0x1f67f7d5},{0x02c1d330,0x111e1379},{0x030020e9,0x00d2b018},
+{0x05002b39,0xd6744e10},{0x01a1f42b,0x4209f191},{0x02c0213d,0xa7631f38},{0x03201615,0x7c127233},
+{0x01c00b21,0xa9196f50},{0x022032d7,0x2b07bad1},{0x01e1072c,0x846ee978},{0x0460a759,0x39f9c568},
+{0x012027b0,0x83be951c},{0x0280327f,0x03a34c00},{0x0240078b,0xf2fd2acb},{0x0261133b,0xec01df7e},
+{0x0241038c,0xf26b911b},{0x0381231f,0x17247829},{0x0520fc62,0xde7beffe},{0x02c13399,0x2bbe2827},
+{0x02a028a4,0xa395fe8f},{0x02a0131f,0x9d2c25fd},{0x01a0a61d,0xfb01cfd5},{0x03402090,0x18cc0c3c},
+{0x01e0a517,0x724a502a},{0x0121f4cb,0x0ce6a231},{0x02a10ac2,0xc3139a65},{0x0281694c,0xbec16834},
+{0x0261b109,0x6934578f},{0x01002709,0x24d44115},{0x0301f76f,0x641aa7bb},{0x022032fe,0x1125a6f7},
+{0x01a0a5ac,0xe6e9d25b},{0x0240127e,0x1efc9bda},{0x02601595,0xca700e93},{0x03e18b6f,0x09cb6c68},
+{0x024019d5,0x7c8c51ca},{0x01e11153,0xa8596177},{0x02418990,0xb4cb425a},{0x02601a3a,0xda6959c6},
+{0x024189c7,0x9dbe5232},{0x02e1455a,0xf43e6a9d},{0x03401ef3,0xe9f3a508},{0x03002a2b,0x26b5f419},
+{0x0261fbf8,0xc35c1173},{0x01801963,0xd4a1371d},{0x01002680,0x33dff3eb},{0x01a0a0c3,0xdc787e43},
+{0x01c0a259,0xfe4e8d4c},{0x0301444a,0xf14fda26},{0x020116ac,0x3ba4ba04},{0x0361f7d3,0x90e3fd97},
+{0x01202259,0xb1ea962c},{0x036109cb,0x7c608309},{0x01c102ae,0x0b0b0a60},{0x01c11458,0xfb0734e0},
+{0x03002992,0xcc2b3c53},{0x014007ce,0x018f3396},{0x02e1337e,0xabe65052},{0x0681fa32,0x0681b242},
+{0x03a0faa5,0x247079d9},{0x03212160,0x7b8eed14},{0x01e017b7,0x3924b02d},{0x05a0fd8d,0x2ff9d743},
+{0x03000fb3,0xb68b23e6},{0x0381f741,0x09720c47},{0x034029cd,0x315556ad},{0x03810988,0x2df7345f},
+{0x026119ae,0xd7955b51},{0x0320a7ac,0xdf6b86d1},{0x02e1446f,0x0f0fc40f},{0x01e121a0,0x88227e2c},
+{0x01e16f77,0x04af0a1e},{0x01a0a18a,0x6c4b508c},{0x010033b4,0x9ecafedc},{0x0420a764,0x6678027c},
+{0x01e1071d,0x796c9990},{0x03e18c4c,0x449b1d46},{0x02a0143e,0x756138fb},{0x02001b56,0xcfcc8a99},
+{0x0141f4be,0x8513c632},{0x02e02586,0x32d2d194},{0x0460a71d,0x4fc2c980},{0x02c0056a,0x3f48009a},
+{0x01a16a63,0xbde90744},{0x02601a27,0xce7002a7},{0x032023a7,0x5689915e},{0x01e0a5e3,0x444509b7},
+{0x0380145a,0xd1f9621c},{0x0221082c,0xa5d9d579},{0x02418901,0x961aa7be},{0x00a1f54b,0xc68948d5},
+{0x032011ad,0xcbfb1854},{0x02a1000a,0x402e8a29},{0x02801451,0x0643e69e},{0x0241f6e7,0xf1485980},
+{0x03c1d474,0xf7230961},{0x01e0a1a4,0x062fb1d9},{0x01e11313,0xb0b7334c},{0x04a1d768,0x8cb3963f},
+{0x046004a7,0x96d97ace},{0x026e0122,0x24a64441},{0x02c01cdb,0xd6fa8592},{0x04202e57,0x41025d74},
+{0x02a02aa6,0xdfa7fd95},{0x02602bb0,0x945a8707},{0x04a124cf,0x657e4826},{0x02811d61,0xeea696c0},
+{0x01c0a3c5,0x5d4626cb},{0x04c1d94a,0x0b9cb1ba},{0x036121e3,0x43b03f4f},{0x0260091f,0x1d3ce546},
+{0x03012182,0x1b4d1344},{0x04210b3b,0x7739c701},{0x0221f024,0x9e8c40f1},{0x024189e4,0xa0deaa96},
+{0x034018db,0xc63072d6},{0x0301f043,0x4cce4cd3},{0x01e10667,0xbb30322c},{0x02002f48,0x523ee164},
+{0x03401610,0xeb568392},{0x0261f67f,0xbc9e3204},{0x01a0a131,0xbffa1450},{0x03400f35,0x9ef8d2e9},
+{0x03e18c05,0x86a47f88},{0x03e18bcf,0xecec9b31},{0x02418a01,0x41362c17},{0x03e1d576,0x5ef4f1cc},
+{0x03e0fe94,0x6969c3d6},{0x02201a7a,0x5f9827e2},{0x010023e5,0x93c9f171},{0x03011a41,0x41dd87c2},
+{0x02812fbd,0x19f027a8},{0x03a0fa94,0x344a8c5e},{0x02a030c3,0x3f451681},{0x03c024a0,0xfd012a2b},
+{0x0280fffd,0xf068cc0e},{0x02a01863,0x341a477e},{0x0241cfaf,0xe57922f4},{0x03e121cd,0x5e730caa},
+{0x02c1f7b8,0x42481910},{0x02401a1a,0x5a832ea8},{0x02a0ab84,0xf52cfe4f},{0x0400a725,0xa80369d1},
+{0x030028fa,0xd919e002},{0x02602d92,0xfe3e246c},{0x0341d161,0x1748d3a7},{0x0260065d,0xbec61efd},
+{0x02811d22,0x35a78341},{0x02a02d23,0x0d5f933a},{0x02000a30,0xe1d90be2},{0x05201e7a,0xa9d99c92},
+{0x03a01e41,0xb1f97423},{0x03a1d17f,0x73a68e36},{0x022032fb,0x07259739},{0x02e144fc,0xfaaa1468},
+{0x02e130b0,0x2c7b786d},{0x02610457,0xf0fef1fc},{0x01a00b30,0x5f8bd808},{0x030103cd,0x889d352b},
+{0x03610561,0xf5f68206},{0x0280a81c,0x4f460e7d},{0x01c0a361,0xe39fd3b5},{0x02a11d42,0xcd596966},
+{0x02c13290,0xfeb77bab},{0x03202dfb,0x46593c12},{0x0280039d,0xa0a6a138},{0x04a01f05,0x37dd3d98},
+{0x02c124d1,0x40289b3e},{0x02601329,0x969c7aea},{0x03000409,0x08c2d48d},{0x02011592,0x60d12785},
+{0x01a01965,0x01bf78fc},{0x0401d147,0x0a596437},{0x05e1fba0,0xe5863966},{0x0381f39d,0x0b0cd856},
+{0x03e18bcd,0xeaec980b},{0x038107a8,0xf23d606d},{0x0341e804,0xd40be73c},{0x026e0150,0x9688e2a3},
+{0x03200dcf,0xe641dfe8},{0x0160a4a9,0x32b31f7c},{0x0221f78f,0xfd4cf2fc},{0x03c1f22a,0x91a1d48d},
+{0x01a0a105,0xcf9a729b},{0x04e0fd3c,0x9d035615},{0x01e0a84b,0xa0138dec},{0x0321213a,0xdeb9becc},
+{0x0441d74a,0xa73aa495},{0x020017c6,0x6081c2c3},{0x01c0a6d1,0xefaa01cb},{0x0261b049,0xc2eacad7},
+{0x02a11c64,0x43f9d13a},{0x02000aa6,0xa3cca3e1},{0x02a01989,0xa55f2a55},{0x02418925,0x22247e7e},
+{0x026e014d,0x9788e436},{0x01e027bf,0xa08ad2ef},{0x0320fbe4,0x1ae25629},{0x01c0a437,0x76db2ab5},
+{0x02610754,0xa635aec6},{0x00e1f42c,0x9c52e73f},{0x02211ac9,0x62da9ffd},{0x03e18cb7,0x7789c740},
+{0x01e1d2ea,0xc823d008},{0x0601d98c,0xca3a8034},{0x02201714,0xbcdd49c3},{0x0420049e,0x69dde314},
+{0x02200713,0x94231d5e},{0x03a014ff,0x9380b5e4},{0x0240fb23,0x06de5e36},{0x02c103d4,0x9378616a},
+{0x03a01899,0x9840c477},{0x02e0041d,0xa346a673},{0x01c0a215,0xc4878c58},{0x01c0a0a8,0x1dec3c9b},
+{0x02a0074f,0xc9be74aa},{0x03a1d7e3,0x0dc36c30},{0x0321202f,0xcdfbbcc1},{0x02a00d82,0xea771a91},
+{0x01811601,0x2bf15588},{0x02c131fb,0xf77a682f},{0x0061f987,0xb56e2308},{0x02410318,0x54dd1681},
+{0x03e18c4a,0x429b1a20},{0x02e029a7,0xb0fab505},{0x03c1d01e,0x8224c9c3},{0x03416e56,0x51d2b613},
+{0x02418922,0x2724865d},{0x03c0a7fa,0x87041f91},{0x0381cf8b,0xfad9acb5},{0x03001d1b,0x0eb8d3f4},
+{0x028019b1,0x819f3ff1},{0x0261b0bc,0x1d732f4b},{0x03411a8e,0xd033fd25},{0x01c0aabd,0x511a418d},
+{0x01c16a7d,0xd6c5df3d},{0x02c1304c,0x79189763},{0x02600f2a,0x641bbf6e},{0x0201f464,0x7f470e3e},
+{0x0460234a,0x6f0ef2d7},{0x02418a41,0x413aa945},{0x022104f6,0xb6e45940},{0x0341d43b,0x3fb2cd2d},
+{0x01c0a161,0x4361f634},{0x026019b3,0xb043cd8e},{0x01c11208,0xb6f5919f},{0x01e10762,0x7eff1d8d},
+{0x0401d21f,0xff41b243},{0x02401483,0xab4be725},{0x0601d839,0x67336ca7},{0x01e0072c,0xe154b320},
+{0x02212088,0x3978a555},{0x02e0a971,0xf03b16db},{0x034000e0,0x38c6bd20},{0x02611607,0xaa316377},
+{0x026e0100,0xa69c838b},{0x03812099,0xcc6ec531},{0x0201131d,0xb57ca17f},{0x02c02a26,0xf0785677},
+{0x02a00297,0xdb82dc3c},{0x0200318b,0xcaa3cbcc},{0x03602cfc,0x823868b1},{0x03010c1f,0x09e44875},
+{0x0321d526,0x17a1886a},{0x02e0300b,0x0ffad4d5},{0x03000868,0x6d8c98d6},{0x042109d9,0x25da7698},
+{0x02c1ed05,0x0b7b5cdb},{0x01a0a0f2,0xf205205a},{0x02c13295,0xf7b770a6},{0x04802538,0xe6813454},
+{0x0261b095,0xead6c146},{0x0241888a,0x8ce57062},{0x0281d312,0x1b6f8e13},{0x02e10d39,0x28e6f680},
+{0x04001d85,0x40ccc2b6},{0x02802f30,0x6b27fce5},{0x04a0275e,0x20dd849b},{0x0380fe2a,0x03758fad},
+{0x0361d516,0xf4bc2559},{0x05602937,0x78b034a5},{0x04c1df15,0x09bdf466},{0x02e02ca4,0xb34245df},
+{0x01c11185,0x2eaa5b4a},{0x048033e4,0xfd400087},{0x02210871,0xd715f853},{0x0241886f,0x03eaa8e5},
+{0x034015f1,0x1750b8a8},{0x02e01132,0x52d86457},{0x0321d529,0x14a183b1},{0x02400d25,0x956d0b2b},
+{0x0420a723,0x03c8340d},{0x0441f176,0x6c45be22},{0x030010bc,0xb6007c73},{0x026e0133,0x25a4073d},
+{0x01c0a50e,0x60543e63},{0x02c1334a,0xd2bc646c},{0x02801444,0x9cf43848},{0x026015a6,0x0b6bf7b8},
+{0x0201bc5e,0x7bcd4359},{0x01e10718,0x836ca94e},{0x01e12228,0xb013b29a},{0x0380145e,0xcff95ef6},
+{0x026009d7,0xbf9121b2},{0x02600e5b,0xd4603cbc},{0x03a04df2,0xa06ae00a},{0x02e144cd,0x0cfe77c8},
+{0x02000c9e,0x5cdbe119},{0x02e02156,0x4e929594},{0x02e02c94,0x70d5d006},{0x0340fffc,0xaac03ae1},
+{0x03610556,0xd0e7982f},{0x03e18b17,0x0ad229c0},{0x026122c1,0x7caf8d45},{0x02a1f650,0x8f529c9d},
+{0x01c0a38b,0xd79cf49e},{0x0280ab9d,0xb7eef3fd},{0x05c1f833,0xab7fda4d},{0x0401d8f9,0xb8bfba11},
+{0x0361d184,0x2a1f638c},{0x038014cf,0xe974bb4c},{0x028e01b2,0x725dfdf0},{0x01a16f37,0x83b01935},
+{0x05a1219d,0x5ecad42d},{0x02002e93,0x99153e1d},{0x0381e819,0x57e9e1a9},{0x02a1f64f,0x722ea968},
+{0x05a01ff4,0xfc5d4fbd},{0x0240005d,0x39e059c6},{0x026e0117,0x29a88ab7},{0x0300019a,0x6ce16ba1},
+{0x030024d1,0x50b6ae04},{0x02011098,0xed613390},{0x02c1337c,0x2dc069e4},{0x0361d69f,0x3a06e783},
+{0x03e18b66,0x99cabc18},{0x01e01c5c,0xdf825ec8},{0x036168e3,0x8b7169c8},{0x026112e7,0xa51273a8},
+{0x0381d91a,0xc2607bdb},{0x024188a8,0x00d95b0b},{0x052109ef,0xb30ad52f},{0x02418803,0x7e7fca2d},
+{0x0581f812,0xaeeae806},{0x02203009,0xecc8c374},{0x01a16f03,0x304039d6},{0x03e18ba3,0x0fe8551c},
+{0x01801969,0xc6a12113},{0x02210fea,0x1ab9b861},{0x03000416,0x719a08e5},{0x02612043,0xd245940a},
+{0x0520fd80,0xc390020b},{0x0241f698,0x1b34b6e2},{0x0300299b,0xe60f6bdd},{0x02200e1d,0xf1de370c},
+{0x02a1ec7d,0x70a9b246},{0x032001a5,0x292c13ff},{0x0340fbb6,0xb29efbc4},{0x028110da,0x79981db2},
+{0x03c1f1f9,0x9b242533},{0x0361ee90,0x563a7b41},{0x0241880f,0xfa7cbbca},{0x0121fa97,0x5a675df9},
+{0x03401acb,0x54c063c1},{0x02800f32,0xdf19ccd6},{0x03610983,0x1a79fcc9},{0x01a1f63f,0xc20cd7c6},
+{0x02a0ab94,0x2931cd59},{0x03e0fe28,0x610962c0},{0x05202aa9,0x7d5a3be4},{0x0301088e,0x7c78631e},
+{0x042109d4,0x37b91161},{0x03c0fb5e,0x36c9a2d0},{0x03e18b4f,0xc9c68a7a},{0x02c1d307,0xe4a20bde},
+{0x0381e10f,0xde8de0f0},{0x00c1f3c3,0x0f384e1b},{0x03c1f638,0xf5ac59cb},{0x02ce0051,0x7e3c80d4},
+{0x0561d8e3,0xca7eed5b},{0x01e01a51,0xb9d5ac0d},{0x02612517,0x87fc4a43},{0x024189f7,0x3333d776},
+{0x0201f7e9,0xd35e80c8},{0x03a12250,0x70a8bde8},{0x03a0fa7a,0x053b37d7},{0x0280032a,0x2505e16d},
+{0x03e124b2,0xce5c1f73},{0x00e0002f,0x11bd4bc0},{0x02a1ed06,0x59a90759},{0x01e1f49d,0xbbb21293},
+{0x03a02997,0xa132bc32},{0x02418a26,0xb43fdb7c},{0x01c0a5fe,0x90266bb8},{0x02418883,0x93e57b67},
+{0x01c0a43c,0xa5cc6a28},{0x01a01748,0x23e0b9e8},{0x01800ec8,0x40012af8},{0x03011367,0xa4808eed},
+{0x0460fca2,0xc07a728c},{0x0241889b,0x8fe0f7ed},{0x0301da9e,0xa5d6ac57},{0x01c10290,0xf2d25227},
+{0x03a00624,0x04a1da2e},{0x03e01e24,0x4f06e9bd},{0x03c02afc,0xb219734f},{0x02002f06,0xc5ca7025},
+{0x03a0fa9e,0xe54a1001},{0x0201e2e3,0x619dc00a},{0x030118a9,0xfeaa1f69},{0x02e10c2f,0x3c618c0c},
+{0x02600de8,0xf711b643},{0x02811d26,0x557f1331},{0x02e13222,0xd270ff64},{0x0341e885,0xe93899bf},
+{0x0361d694,0x3506dfa4},{0x06002ba6,0xa5bce3bf},{0x0241d114,0xb8c0a190},{0x0301089c,0x928998ba},
+{0x03e18bcc,0xefec9fea},{0x05200876,0x6dbf4ed5},{0x0361ec8d,0xa3f24ba2},{0x04401cc7,0x9377908f},
+{0x01a0a031,0x6e3a5638},{0x020104a4,0xd6d1a330},{0x01c0a2df,0xc21f4ca6},{0x02602dc5,0x2ae89139},
+{0x0220182d,0x643ff70f},{0x0360162a,0x3a7550e7},{0x03601416,0x87c318b0},{0x04a1d756,0xd050c980},
+{0x01600e95,0x3d25d2a2},{0x036015f7,0x3b7877b2},{0x036000f8,0x25a26ee1},{0x03800fca,0x16e1b387},
+{0x02c00818,0x4b8a3849},{0x026100d1,0x17958c8a},{0x02e102eb,0x58c137c6},{0x02a10f7b,0x73459649},
+{0x0341e843,0x08922f13},{0x04c1cfb6,0x16eb8d03},{0x0160aa05,0x77c2ba0d},{0x0441d73a,0xe115a945},
+{0x02a1003f,0x857fae61},{0x0221fa60,0x68a825a1},{0x00e02697,0x064c3804},{0x01a1100f,0x6f59d465},
+{0x0520fc7c,0x96af58f5},{0x05003367,0xeb27324a},{0x01e026dc,0xe444a424},{0x03203215,0x4b6b15b5},
+{0x0481d757,0x0ec77eee},{0x0300a7bd,0xa7474b98},{0x0361e026,0xed1496a4},{0x0541f82a,0xa9332545},
+{0x02c1fb86,0x8232bc9b},{0x03a01b6a,0xd52bc713},{0x02e021a3,0xa91a32cb},{0x02418a30,0x44386f67},
+{0x0420fe31,0x85acf582},{0x0361f4eb,0x9c3b3c45},{0x022005a8,0x96e0ef78},{0x03e004bd,0x7354e505},
+{0x02e16b2e,0xd6eeb364},{0x0360a662,0x7b64bc13},{0x02800dc0,0xcbe1949d},{0x03a1d337,0xb0b7c51c},
+{0x0401f119,0x30302767},{0x02210b34,0xef50d950},{0x0361fbc4,0xd6eea036},{0x02e130fa,0x3f15df82},
+{0x02e02876,0x2f21f1dd},{0x0261b073,0x2b16a1b2},{0x01a0a122,0x87dba714},{0x03a0236d,0x35567f8c},
+{0x01c00b27,0x910ebc2c},{0x0440295b,0xaeb269cc},{0x01e16f73,0xa7b90513},{0x0321685b,0xa9dd6db9},
+{0x028018c3,0xcaab387b},{0x04000211,0xe97ddd64},{0x02a110f8,0x18fd4e77},{0x02e0a9b4,0xdd7dd3d5},
+{0x03e18caa,0x158cfe91},{0x02810fc2,0x31e3e014},{0x02812fac,0x97fe658c},{0x02a16973,0xcbd82de4},
+{0x04e109ee,0x3fb2d225},{0x02602fd4,0x33e2fcf3},{0x02a1fae4,0xa1f8804a},{0x0200079a,0xce2f5a17},
+{0x020103ab,0x6addb958},{0x024188db,0x100e9bd9},{0x03a12243,0x4f27b979},{0x0340fec7,0x1ddd4e72},
+{0x02c131b6,0xd4f79add},{0x02000ecb,0x6c8e071f},{0x0320188f,0x132f5341},{0x01a0a5d8,0x11287d38},
+{0x0261f631,0x63dbc94a},{0x03402eed,0x585f47e3},{0x02e144d5,0x1d2361d1},{0x02418a47,0x4347785e},
+{0x0301d4c6,0x38a119c4},{0x02c109a1,0xd397bb27},{0x04c1f809,0xbe9967a2},{0x0441f177,0x6f45c2db},
+{0x02418980,0x32903807},{0x0300ffd4,0x1b55c15e},{0x02e101f5,0x3649b0f8},{0x01c11692,0x6fb84447},
+{0x0261d302,0x9b6368f7},{0x02c1319d,0xca8824eb},{0x040021c0,0xc173fd1a},{0x01002602,0xe781e6e5},
+{0x02a02055,0x72f9a9fb},{0x0201135d,0xa043bc01},{0x02418899,0x8de0f4c7},{0x036015b2,0x52ea3328},
+{0x04a01f2d,0x3f71de49},{0x01e0003e,0x301f0acb},{0x02c029db,0x48b607d2},{0x02611926,0x46a66d9f},
+{0x02c132eb,0x5c434a1a},{0x02a10189,0x39ad5a60},{0x01a0a3f1,0xc1f2b2fe},{0x02601283,0x530d7ee6},
+{0x02411956,0xac79695d},{0x028e0168,0x766ad02f},{0x02616b69,0x6a1e5f4d},{0x032122a0,0x14fb4ff7},
+{0x01e00c6a,0x0159c462},{0x02e120bc,0x73fb479b},{0x0341f147,0xf300fd90},{0x02e00620,0xfc06ee59},
+{0x04e01ec5,0xbdbc4888},{0x04802a90,0xdd715c0b},{0x01e00a09,0x6a4a34de},{0x01c0a53e,0x8c26656c},
+{0x02a105b0,0x58238ea7},{0x0161f6ce,0x11f8179e},{0x02418841,0xfc8e0811},{0x03a1e002,0xe163030a},
+{0x0440fc92,0xf687402e},{0x01a11412,0x9fc7d452},{0x0380033a,0xc6245392},{0x04801eb4,0x8830d245},
+{0x0600fef8,0x348c2246},{0x02c00396,0x0fd01ccb},{0x0360108e,0xdd0d0ffb},{0x02c13214,0x7075167c},
+{0x01e110a6,0x1c81ec90},{0x0260258e,0x4fd9ac89},{0x02e0180e,0x09e93627},{0x03e18b85,0x18bc797b},
+{0x0320d7e5,0x242a73bc},{0x01e0226d,0x806c306f},{0x01e020b9,0xe76dc816},{0x0141f6f9,0x5c5ebe2f},
+{0x02802828,0x9b95581e},{0x01e10658,0x4e2d47fe},{0x02e14630,0xdbc4509b},{0x024003dc,0xe79b8fc1},
+{0x01c0a598,0xf165b172},{0x0300055f,0x57b8768f},{0x0341054d,0x703bf913},{0x01e00c1d,0x7a992f2e},
+{0x02411928,0x9f92a025},{0x01a0a342,0xc6be4ea8},{0x02c1f6a5,0xfedc963e},{0x05800875,0x4e4e382e},
+{0x034118bc,0x8ddbfa4f},{0x02801185,0xc96af9ed},{0x02602d3a,0x4735a68d},{0x01e11c85,0xa56eddc3},
+{0x02a027df,0xa9e0a352},{0x02e145ac,0x7336e3c5},{0x01616a40,0x492442a8},{0x0301d179,0xe9890e63},
+{0x024012cd,0x052e0fb8},{0x03216e45,0x73855fdb},{0x03016933,0x5d88b3bb},{0x02e13373,0xf47dbea9},
+{0x01e02213,0x455c8437},{0x03202bcc,0x43d0294e},{0x02402f74,0xd80bd24f},{0x04601fd6,0x0c38d686},
+{0x02e132b3,0x718911f1},{0x020009ea,0x0307359a},{0x036005f1,0x1d15f204},{0x0281f788,0x8ac95105},
+{0x0320239f,0x692774ec},{0x03c00140,0x9e5b4aac},{0x02e14503,0x87a2a39a},{0x03e0324d,0x24d7d83c},
+{0x0181f67e,0x399ab924},{0x04e0a7ca,0xe83813b3},{0x0240095b,0xd47312fe},{0x02603029,0xf6880c27},
+{0x01a0a2c3,0xbe6d91b5},{0x02c1330e,0xfd0d4a04},{0x0521d7a5,0xf7f7ed47},{0x03013242,0x86685291},
+{0x01602334,0x274ec715},{0x0321f7ca,0x0930096e},{0x0361d508,0x06bc41af},{0x04801e19,0xc55303ca},
+{0x02602ca9,0x15ee2cf4},{0x02a02fc0,0x9da8e8df},{0x04600362,0x62a6c40b},{0x0281f4b6,0x03785f6f},
+{0x02a1ee09,0xd25edf91},{0x03a00762,0xdf71e366},{0x02a027f0,0xd704cedd},{0x02c1302b,0x0424ab27},
+{0x02210fe8,0xadbc204e},{0x04c02ae6,0xda7c09f2},{0x02610f76,0x11476134},{0x0260a816,0x377edd0f},
+{0x03c011cc,0x35f5bcc9},{0x02a11ae1,0x4dc87c79},{0x0421d973,0x56824d46},{0x03c01e49,0xa51e1fc1},
+{0x02000f65,0xae95057b},{0x0421d783,0xb023f003},{0x01e10e91,0xc145717d},{0x01e00028,0x6fa71944},
+{0x04202560,0x6510907f},{0x0461d853,0x209f0958},{0x0241b009,0x5efead9e},{0x024188e4,0x170ea6de},
+{0x0200a6b8,0xe936cf5c},{0x02610198,0x2b07e5d0},{0x036015fa,0x37787166},{0x030029ed,0x3f4a161d},
+{0x02e14544,0x8693977d},{0x01c110af,0xb0586be0},{0x02c133a3,0x25bbe01e},{0x02812fad,0x98fe671f},
+{0x03e1d579,0x5bf4ed13},{0x036008d9,0x28619c1c},{0x026119c9,0x1788f41e},{0x01c0a57f,0x0a44ac77},
+{0x02810872,0x3b790077},{0x0480fb2c,0xe63f479a},{0x01c00c1c,0x284fba70},{0x0301455c,0x363fc111},
+{0x02202f6b,0xadf5bd51},{0x02812fa4,0x1a0170c9},{0x01a0a6cd,0x834a53aa},{0x0461d615,0xcfa2d039},
+{0x02812fef,0x396731c1},{0x03e02970,0xde9adc64},{0x0501d7ab,0x00e42c51},{0x0461f7c8,0x7e0c0338},
+{0x04012520,0xf0ee00e0},{0x04e1d854,0x4c566880},{0x00a1f351,0xb0c131c6},{0x0421d5ea,0x4336b7f1},
+{0x03200fb5,0xa43f74ee},{0x0341d6cc,0x9dfb9ba6},{0x032015c2,0x5616b38f},{0x03601632,0xf05e51bf},
+{0x032118af,0x0fb70a38},{0x02210812,0xfbcd90e8},{0x0261b0b2,0x2532948d},{0x028032a1,0x3cd67cac},
+{0x028e01cc,0x95d2cfbe},{0x02c13163,0x3cbe5516},{0x02600d3a,0xdebd722b},{0x0440065b,0x17951ade},
+{0x01c0a41e,0x0fefc589},{0x02e1443c,0x2270f4f5},{0x04001c91,0x229b77d6},{0x028011b7,0x4072a011},
+{0x01e00a07,0x764a47c2},{0x02202ec3,0x281ce432},{0x03200542,0x49610564},{0x02402695,0x176486bf},
+{0x02e145fe,0xebfbd193},{0x028031b5,0x11982f7c},{0x02e13417,0x2ed22a82},{0x0281bc62,0x93571925},
+{0x02016ae2,0x90a231a9},{0x02e12208,0x90169147},{0x03e00219,0xb9a2f42d},{0x01a0a3f9,0xd1fbc68a},
+{0x02e13364,0x116ee1c6},{0x02e16b3a,0x3802fdd4},{0x02c13151,0xccc3b4f4},{0x0201f6f2,0xbddbcf7e},
+{0x0301d409,0xbe4d0670},{0x01e102ce,0xfc563c93},{0x03c0234e,0x13f29a2d},{0x020013ce,0x8c252305},
+{0x02201b04,0x58ae573e},{0x03210404,0xa9bcd3ae},{0x040000d6,0x63bd6395},{0x02e1340a,0xa1de4c8e},
+{0x02a016ed,0x1f7eafaa},{0x024189f4,0x3833df55},{0x02400ac7,0x89f48d65},{0x03800137,0x0f401b85},
+{0x04800524,0x92f5bd34},{0x03c1f237,0x4a090a32},{0x05e01cd5,0xfd7733d8},{0x02611609,0x8c68e137},
+{0x0181f976,0x4f60a5fc},{0x02802814,0x9a9317f4},{0x0240d7b9,0x5c9e290d},{0x03e18b74,0x09cdaaff},
+{0x01e111d6,0xae97606c},{0x0360309e,0x9de7dae6},{0x0241b014,0xd003dcaf},{0x01e1bc00,0xf5676f63},
+{0x0300081f,0x5801b55f},{0x02602287,0x42a7e52d},{0x01e10678,0x4a2b031b},{0x03600193,0xc9d06eab},
+{0x0201116d,0x2ad4427d},{0x01e106b4,0x3bb3376e},{0x02001be9,0xa5b346c6},{0x0301229a,0xd067a892},
+{0x026100dc,0x8f988809},{0x04001df9,0xcc4ac9ff},{0x0220d7c4,0x6fa04b26},{0x03a01637,0x00e237ce},
+{0x02a11d79,0xe3e1ae15},{0x03c0a70b,0x1f639f87},{0x0661da09,0x7b32086b},{0x01c00993,0x2d21cdd2},
+{0x03e12078,0x702f9162},{0x0141f622,0xe8cd5694},{0x028e017e,0x0865a5d7},{0x03a10cff,0xef14ceb8},
+{0x0321e136,0x01b08179},{0x0260aa35,0x48a0fd17},{0x00e02747,0x74da2855},{0x0180a4d4,0x8abf60c9},
+{0x03a1daa9,0xc39fd8fe},{0x0300ff75,0xc977169f},{0x02001767,0x50d2907b},{0x01a0a0ea,0xe60e07d2},
+{0x01a027d5,0x0b31e883},{0x03a0fa9d,0xe44a0e6e},{0x018007c9,0x0f8485b4},{0x0381242d,0x978c0810},
+{0x0540076d,0x7443b2ca},{0x0661d981,0x394a8c32},{0x034008c0,0x6d7b3f9f},{0x0241887c,0x8ce331cb},
+{0x02c02291,0x32788fd8},{0x0240fe05,0x666895d7},{0x01e00c9c,0xd91d2ea6},{0x04c1d9dd,0x0375def7},
+{0x02418af9,0x6b11cd54},{0x0320fec0,0x7259a67c},{0x0601d967,0x750dddca},{0x0261b104,0x22d1b215},
+{0x03201061,0x8e2dca4f},{0x02010525,0x6659f929},{0x026119bd,0xc79d90e6},{0x01c0a2e6,0x07f8ab68},
+{0x0260097b,0x60d3c8c0},{0x02410f73,0x1c73a1fd},{0x02602fcd,0xa29c4b15},{0x0321f60e,0xb1771faf},
+{0x01c11582,0x5a225fa0},{0x03a01133,0x12ab1157},{0x0361cf3c,0x1b119392},{0x018033de,0x9c73ee75},
+{0x02601559,0x0083eb4d},{0x04e1d0bf,0x96469c61},{0x01800b87,0x30601027},{0x02c032b9,0xd277141e},
+{0x036121b4,0xe303fd4f},{0x0401e89d,0x70c7c051},{0x03601b3f,0xf31be06f},{0x022007a5,0x61f6d79c},
+{0x03e01e6c,0x5baed529},{0x00c1f527,0xb2cbe074},{0x02601267,0x156dfc9e},{0x01c1f4b8,0x545ca8e1},
+{0x028187f7,0xe789d44c},{0x01c0222d,0xbb5346fd},{0x03e0fd49,0x6a3d9614},{0x0180a27b,0x644a12a2},
+{0x01a0a281,0x886a66d5},{0x03e18c24,0x7b9ff109},{0x03400480,0x134556a1},{0x02c1f0b2,0xb1612de7},
+{0x01e10672,0x4c28c7aa},{0x06401fc7,0x7709d626},{0x02210306,0x6081b183},{0x01e0178d,0x0f1f48cf},
+{0x01e12097,0x86ffea57},{0x01e106c7,0xc0b885fb},{0x02a02f5e,0x0e1acb88},{0x048025eb,0xacd2dc69},
+{0x02e0ffd6,0xa39111f1},{0x03c1f1eb,0xad244189},{0x00e1f9c6,0xf7089d5a},{0x0261f839,0xc35df4d9},
+{0x03c1f21f,0xe01930d6},{0x0280a73c,0x7b569255},{0x050020e4,0xe2a71a34},{0x02000ab9,0x5bafb075},
+{0x0241d121,0xa1537d52},{0x01a0a5e8,0xc6f1eec0},{0x01c16f47,0x8b3743c3},{0x02e144ad,0x9d06163d},
+{0x02801313,0x81b835a4},{0x0300abea,0xbf8a3e7d},{0x0420048c,0xe5c546cf},{0x02402a45,0xec6f3566},
+{0x03600101,0x80c7ab05},{0x0200a909,0x9ac9577f},{0x036115dd,0xede53315},{0x02211d46,0xda29a86c},
+{0x030024dc,0x47b69fd9},{0x022112d2,0x247b374e},{0x020003e0,0x6a1980c9},{0x03212113,0xb1b6697e},
+{0x02e02d14,0xf2826245},{0x02c1207d,0x6a59d20c},{0x0281fa1e,0x8db6878b},{0x01c0a46f,0x4ee6ae7a},
+{0x0421d628,0x35b1cef3},{0x0241880b,0xf67cb57e},{0x0201bc4b,0x93effb63},{0x0500fe8b,0x5605b4cd},
+{0x0560259c,0xb93474bb},{0x0341e7f1,0xf838ac9f},{0x01e0230c,0xc3ba1386},{0x02602bbd,0x3c3588dc},
+{0x02e10d22,0x54f59a3c},{0x0340ff5a,0xf3e0bf59},{0x03401b0c,0x1b86a77a},{0x0301d311,0xa66c346e},
+{0x03c1d6ac,0x87cd5024},{0x04c0a710,0x9cde164b},{0x0200a9a2,0x429cdfcf},{0x0341d323,0x54a56276},
+{0x0360012f,0x02d679a0},{0x0121f14b,0x33695025},{0x02810434,0x69f28c66},{0x03e00120,0xb6871bf8},
+{0x01c0a212,0x75bd9ccd},{0x03e18c06,0x89a48441},{0x03800361,0xd840df45},{0x02a1044d,0x6c73eca4},
+{0x01ce0060,0xf59c78fe},{0x01a00bb2,0x512ca62b},{0x0340ff3b,0xe9c87762},{0x04c1d7b9,0xf27b0c28},
+{0x0480020e,0xbf2601a9},{0x02e16e8b,0x73fee079},{0x03c024a3,0xf801224c},{0x03c0249e,0x0301339d},
+{0x01a00b38,0x3b8960c5},{0x0361d892,0x15ac73a6},{0x0261b034,0x4d6e3cdc},{0x01c016b8,0xe6f62b88},
+{0x0280095a,0x2ac72ea7},{0x020114d9,0xc4e68349},{0x03802338,0xf0be9b76},{0x04201caf,0x9e7d70dc},
+{0x03a002ad,0xa5c7f271},{0x02602dad,0x968b31c9},{0x01c1120e,0x06e0f4d7},{0x01c0a51d,0xde421ac8},
+{0x02c0abb7,0xd3353c6c},{0x02e0fe76,0x9fd1551e},{0x0361d182,0xd64b20ca},{0x01e03106,0x93fa18c8},
+{0x0301d418,0xb14cf1f9},{0x03a12456,0x6d457281},{0x03a0fac2,0x9d6b2826},{0x0681fb62,0x29b7f8e2},
+{0x01801964,0xcca12a85},{0x02e0fb4f,0xb08d4164},{0x026104c2,0x52ba0c0f},{0x02a026ca,0xe49c3494},
+{0x01600b70,0x064908e9},{0x0380103d,0xc89e9cc4},{0x03010c33,0x22ed6a2c},{0x02a1693e,0x7342e7d9},
+{0x02c1da32,0x02767569},{0x02e1314d,0xf50c58cb},{0x01a1e952,0x079c74f3},{0x0421d5d7,0x5036cc68},
+{0x03c1d6fa,0xc738d55e},{0x02811c33,0xdd6cb584},{0x0201bc57,0x3ec86624},{0x03c001e2,0x638f3907},
+{0x0221210a,0xb673817f},{0x02411c2c,0x43756a1f},{0x0221f9bb,0x6db279dd},{0x04601e17,0x58f5a99e},
+{0x03812275,0x2cbbf11c},{0x04e1d815,0xf02bf4c5},{0x06c01f9c,0xf487562b},{0x046109f9,0xe53e665d},
+{0x020009fb,0x1ae752bf},{0x03001d1c,0x0fb8d587},{0x02211114,0xa2e01c0a},{0x0461f64c,0xd06a5d8b},
+{0x04210b6c,0xbd410024},{0x02c130b7,0xaf2adf4f},{0x032002a0,0xae75c0ec},{0x02812fd7,0x9b0fb366},
+{0x07c1cfbb,0x49a6694c},{0x0260a856,0x68bb6273},{0x01c0a355,0x155a10a8},{0x01a0a149,0x13a6169a},
+{0x02801b19,0xf2c35189},{0x03e18bc1,0x1dece854},{0x01c16a79,0xa6f4f1e2},{0x02e14626,0x6cde8792},
+{0x02e16848,0x4a3d9b59},{0x02e020ee,0x57e71c56},{0x03e1cf3f,0x5cdf49fc},{0x0620076f,0xc5a8468b},
+{0x0580fd05,0xe5386985},{0x02e0033f,0x208eff78},{0x02c1301e,0xf82259ac},{0x02801b5f,0xb7456cfb},
+{0x03211a01,0x10398f0d},{0x026112f3,0xa49ccf4a},{0x01611238,0x0d4bceb5},{0x032009e3,0x98d5a540},
+{0x0280a9e0,0x34dc98b2},{0x0401d6f6,0x872edf0f},{0x01a0a61a,0x9d0dbe63},{0x03211fc2,0x5f883cf3},
+{0x04e1d949,0x202a9190},{0x02418904,0xa71883ea},{0x02003076,0x642c4477},{0x01c1169f,0x764f4705},
+{0x02e131e1,0x386e6ba5},{0x02000ca3,0x3ca7d356},{0x01e1158b,0xed30b5e3},{0x03a006fa,0x935d9eba},
+{0x01c0a1e7,0x028f5cb4},{0x0501d7b2,0x4daf3934},{0x030028dd,0xceae3b54},{0x044004cb,0x9408a2ea},
+{0x02210f41,0x44a2ce5c},{0x02201803,0x312049e2},{0x012033d6,0x20d5e582},{0x01c0a134,0x4ac73362},
+{0x02010615,0xb02dca04},{0x01c0a341,0xcd9643d0},{0x02c1685d,0x04a7e9c7},{0x04601e9d,0x919d3293},
+{0x0300239b,0xc7e1a7f7},{0x01a0a3e6,0xbf244b11},{0x0261b0b1,0x243292fa},{0x028119d0,0x6c157bac},
+{0x01c026ad,0x96886f1d},{0x024189d3,0x21c5ddc3},{0x03210cc2,0x649a871d},{0x022005d2,0xa90376ec},
+{0x03002877,0xfe053d14},{0x02e109a5,0x69b94fd4},{0x01c0a179,0x59ff5098},{0x038018a7,0x1bbc5015},
+{0x03e02995,0x83666858},{0x02400973,0x24a15c23},{0x0180a2a4,0x8e6ce702},{0x01c0a583,0x400d08df},
+{0x03402c19,0x6655d9fa},{0x02202b29,0x0e4bad09},{0x0161f7a8,0xc807b230},{0x02812f97,0xa6fc3e92},
+{0x03e18b19,0x18d23fca},{0x02a00c60,0x849556f2},{0x0160064e,0x841c319b},{0x03a1d680,0xc1585b13},
+{0x02a11d59,0x5bd135d1},{0x02c13112,0xea148615},{0x01a02694,0xeb1a52cc},{0x02e145f6,0xf4f9a127},
+{0x034015d5,0xfb792f04},{0x01c11227,0x0ef24a90},{0x0341e800,0xa766d1e5},{0x02c1f076,0x4617f396},
+{0x0761d9f4,0x851cc7bb},{0x0261212b,0xf75304ca},{0x0421d230,0xc577ea56},{0x02e102ec,0xbdc2cc8f},
+{0x0440a7c6,0xa24fa903},{0x01a0a411,0x5cba0369},{0x022032eb,0x2b057c3a},{0x02e02d19,0x23c76a86},
+{0x02600921,0xacbda7e6},{0x0261e937,0x9031e265},{0x0341e85a,0x8588095c},{0x0281da4d,0x808ea325},
+{0x05c1d9b1,0x9eb51dae},{0x0201bc16,0x80d406fd},{0x02616b6b,0xeda692d5},{0x04a10cac,0x02feb797},
+{0x02a0abbe,0x282082a5},{0x0421f8b0,0x5b862215},{0x01e16f84,0xf9a5fe71},{0x02212033,0xa010d646},
+{0x03810f89,0x7116196c},{0x020030b1,0x28d68adb},{0x03002c4e,0x4ce34a6b},{0x048109fd,0xf97dec4a},
+{0x028e01d8,0x93d08e01},{0x0520a7c7,0xdb005087},{0x0300febe,0xda7a0cc8},{0x022104ea,0xd0e4822e},
+{0x03c1f8a6,0x910eef16},{0x0320fecc,0x3eeb0975},{0x02a10863,0x70d7bf1c},{0x01a00e59,0xeae3d03c},
+{0x03014486,0x843a9f0c},{0x03000f10,0x1a0125e7},{0x0141f4b3,0x5488925a},{0x02e003bf,0x450ee69d},
+{0x02c1306b,0x099e0a73},{0x01c102b3,0x32dbeb23},{0x0300fbd6,0x2a2a0a08},{0x02c02bc3,0x0d6ab813},
+{0x04416e96,0x991a91ea},{0x03e18b0a,0xdccfa2bf},{0x03410538,0xde7c1b4b},{0x03c1d4d0,0x31e9726a},
+{0x02a0ab82,0xf635fa3e},{0x02211c05,0xd8269124},{0x02418a44,0x4847803d},{0x03010c15,0x3bed9187},
+{0x0100002a,0xbda7cdc1},{0x0541d0c2,0xee458fac},{0x0361e8af,0x1f26e241},{0x01c16f40,0x94902f99},
+{0x03811ae8,0x2c160e43},{0x01e0068e,0xd4b6d38e},{0x01e1f936,0x57ae4172},{0x024029be,0x78392b20},
+{0x0280328d,0xa7e9ac77},{0x0340050f,0x1fbe2738},{0x0301f1a4,0x560411e1},{0x03a0166a,0x60756b73},
+{0x024189e6,0x9edea770},{0x01e1122b,0x448bfb32},{0x036015fb,0x4b7acf79},{0x01a1fac2,0x339b7e85},
+{0x03c01f01,0x87a30f4c},{0x0261e2a9,0x7ea3c116},{0x04402b6a,0x54987472},{0x04c0252f,0x94db994f},
+{0x0301f679,0x4b878793},{0x02e13392,0x0354b837},{0x026104dd,0x60fa230d},{0x03c0fe2d,0x7410dba4},
+{0x0400d7eb,0x17ef0d6b},{0x01c0a45c,0x06528f4f},{0x05202790,0x26769c59},{0x036015db,0x13d3f5bc},
+{0x01c005d4,0xf7dda861},{0x02418a33,0x3f386788},{0x0441f15b,0xdd4f44f8},{0x0320ff94,0x189bb138},
+{0x032027f4,0x4a644ffe},{0x00e1f9a3,0x123a6f0a},{0x0521225d,0x289577f0},{0x02812faa,0x99fe68b2},
+{0x0161f193,0xb24056a4},{0x02e132d3,0x3dc3a2d3},{0x02602da6,0x69e1ab7b},{0x03a1d7fc,0x1856877b},
+{0x030017ae,0xbe89b871},{0x01a0a279,0xd69bd942},{0x03a00dab,0x67473c88},{0x026e0137,0x19a1b5c2},
+{0x0640fd99,0x148c77b3},{0x0321d8ae,0x2c21c4cc},{0x03012349,0xa0c3e8c2},{0x02601b0f,0xe8669980},
+{0x0261b0b4,0xa45a6bea},{0x03e00125,0x43da67f6},{0x02e1462a,0xd5c44729},{0x0200aa48,0xcfc57153},
+{0x03014449,0xf04fd893},{0x0221112d,0x1af9cf6a},{0x032022e2,0xcd8f1baf},{0x0221f0e2,0xc1f809b9},
+{0x02010629,0x1f286893},{0x03e011d1,0x128da28e},{0x01a01947,0xf525e563},{0x03001fdf,0x0f674929},
+{0x01e108ef,0x0f73cdb9},{0x03401437,0xeb2ba28b},{0x02e1692a,0x39a0a257},{0x03602a8d,0x9ccf6c98},
+{0x02001b33,0xc2e463f5},{0x0440a674,0xcedd978c},{0x03000d60,0x5be96145},{0x02418aec,0x5a0d3563},
+{0x01c00c17,0x6c435989},{0x02418872,0xfcea9de0},{0x0160334e,0x02f7906a},{0x02418a0d,0xb12e8da2},
+{0x01003390,0x62b718b0},{0x0221038b,0xbb436773},{0x0641d968,0xc37c561d},{0x02e10194,0x80fdf410},
+{0x02c008ee,0x12109232},{0x02e12315,0xb451fbd8},{0x02202d61,0x020a74c0},{0x0221bc5f,0x3c3f189c},
+{0x0221116b,0x66dff9b9},{0x00a02323,0x37baa0ef},{0x01a02740,0x197eab3b},{0x03c01fdb,0xa4389d37},
+{0x01c0a4de,0xb66cb3e0},{0x032004ba,0x3b8b4df0},{0x02816907,0x77e7ae64},{0x030122a1,0x3d4c6fd8},
+{0x03c02776,0x00525a7a},{0x01c1109e,0xb826dbac},{0x020005d0,0x8e233a08},{0x02e024f7,0x5d3fa38b},
+{0x0241e2a2,0x57d7ad39},{0x0521d7a7,0xd7c3df84},{0x0441d771,0xad34c121},{0x01a11200,0xa3415d92},
+{0x01e0101e,0x18951060},{0x0421d752,0x23f82a55},{0x0241f538,0x27eac8d6},{0x0101f30c,0xe22fc3a0},
+{0x04c1f10f,0x4381ac90},{0x02c133b6,0x8a1396c3},{0x02a169a6,0x506adc22},{0x03016b29,0x5ce57bce},
+{0x0140297e,0xdd701f6c},{0x0501d95a,0xe028a435},{0x0520fc74,0xffd7c517},{0x026100bc,0xd567bd12},
+{0x022032da,0x6f1bad95},{0x0520022a,0xca44789c},{0x03410ce8,0x9f5aeea6},{0x024012ca,0x012e096c},
+{0x03612218,0x5b296cd4},{0x03e10b85,0xfe04c533},{0x01a0a01c,0x54f50a59},{0x02a1bc68,0xaa188107},
+{0x024012c9,0x152e28e8},{0x02000e8c,0xb9da5340},{0x0261b032,0x4f6e4002},{0x034011da,0xb5cf4f9d},
+{0x02601328,0xa29c8dce},{0x04e1d0b0,0x025177e4},{0x02000736,0xdceecedc},{0x02400e1f,0x02d0fce6},
+{0x026007d1,0x99ff2093},{0x0480fc3e,0x3db82b15},{0x03c1d55b,0xee2566f7},{0x022019d1,0xfbbcbb3a},
+{0x02600813,0xa1a7a50f},{0x02a019bb,0xb5b13578},{0x0321f90a,0x758afff5},{0x0261b102,0x20d1aeef},
+{0x024188b9,0x0dfc01c4},{0x0280185d,0x2baebde5},{0x03601dd5,0x67082954},{0x02003065,0x683b554d},
+{0x01c0fe60,0x51b76efb},{0x03e18c29,0x86a0025a},{0x02c1306e,0x0a9e0c06},{0x02e020db,0x5daea9f4},
+{0x04c02ced,0x98d85f6f},{0x0441f15f,0xe94f57dc},{0x01a01bf2,0xbe7a0f66},{0x0200304b,0x641afb56},
+{0x01a0a135,0xc9fa240e},{0x04001e8c,0xc8698ac2},{0x01c1fb11,0x552cb21e},{0x02c1301d,0xfb225e65},
+{0x042100cc,0x382ec212},{0x01a0fe61,0x260ff9d8},{0x01c110a0,0x984f4bbc},{0x0260aa34,0x0cd6b89d},
+{0x0321d532,0x1ba18eb6},{0x04a0292c,0x02665d26},{0x0440020b,0x3d809be0},{0x03e18c4b,0x459b1ed9},
+{0x03c1ee7a,0x0aa6fafa},{0x01e01c37,0x8a632be6},{0x01e017e8,0xe7922712},{0x03a1d741,0x1268e2bf},
+{0x0461d60a,0xdaa2e18a},{0x02000679,0x5d35c954},{0x034000f3,0x6af3e047},{0x0381d4f0,0xcfcfa57d},
+{0x046004b7,0x795a2fac},{0x02001b26,0x0ee958c7},{0x02401260,0xecfa0e8d},{0x03611af3,0xfec602b2},
+{0x0380fe22,0x04957ea6},{0x00a1f985,0xe3b471cf},{0x00c1f680,0xc4c40e95},{0x01e114ab,0x5368f335},
+{0x02a119b9,0x53dc5bb2},{0x0441d762,0x77346699},{0x02801993,0x95f0f068},{0x02c00311,0x4d9737d6},
+{0x03a1d590,0xdc916bb9},{0x03e18c57,0x0898803b},{0x02401a0f,0xce753e7c},{0x03c1f22e,0xad0529fa},
+{0x0201fb0e,0x2e259547},{0x04c033f3,0xe62db4da},{0x03202de7,0xff9df0d1},{0x02c105aa,0xb54046cc},
+{0x03a1e110,0xe405776d},{0x058022af,0xb8153674},{0x0360114e,0xfb9e9b5f},{0x0440a7a3,0x6db59140},
+{0x02e145a5,0x7836eba4},{0x0180a12e,0x8a8f72f8},{0x040008b8,0xa97e742f},{0x0300291b,0xfd959c51},
+{0x02a0147c,0xf8e6b31c},{0x02810a42,0x9d64bd33},{0x0641df08,0x36afd5b1},{0x0540fe35,0xa4a8cee3},
+{0x0240118e,0xf6b734b1},{0x024025f9,0x8ccdc15f},{0x02811d87,0x1a8f82b5},{0x04201acc,0xd693b76f},
+{0x032100f8,0xc86370d7},{0x0221f0e9,0xc6f81198},{0x0441f180,0x56459b80},{0x01c16aba,0xf0f9e38e},
+{0x0461d609,0xdba2e31d},{0x01816f07,0x19709f9e},{0x0180a185,0xb24f0a9a},{0x0381015b,0xf03b6415},
+{0x0200304e,0xb4398e5a},{0x02c00577,0x072bafd1},{0x01c0a587,0xd5e00042},{0x01a0a32c,0xb6be3578},
+{0x02e02a71,0x7946f36b},{0x058004bf,0x4adc3b82},{0x01c10298,0xefc1044d},{0x03a1d67b,0xdc588594},
+{0x030120c1,0x12a739ad},{0x03016865,0x1b8ff071},{0x02c10080,0xd0004397},{0x01a0a5b7,0x2b205761},
+{0x0380fba2,0x6074c93f},{0x030027fa,0x10bd74a6},{0x0361f656,0x0ae337fd},{0x0301008d,0x40c47370},
+{0x02418af5,0x5f0f7bd9},{0x03a023a6,0x28c97aaa},{0x01c0a2d6,0x0f01b0c9},{0x02a032b6,0x30df80ae},
+{0x04c01eb3,0x2b70f740},{0x0580256b,0x85b8cd0f},{0x02418a05,0x35361933},{0x02418afc,0x6a11cbc1},
+{0x01e1049d,0x6737aac5},{0x02c0065e,0x6e8604ef},{0x0421ed2b,0xd06cf85d},{0x02610fc9,0x82d76282},
+{0x0361d6dd,0x26321332},{0x0381d483,0xc8201d8d},{0x01c0a5a1,0xdc07fc19},{0x02200ca0,0xacaf0c88},
+{0x05a1d7a4,0x0d65625e},{0x03a04ddb,0x899982d8},{0x02c02374,0xdbe72d4c},{0x0261d324,0x3c2da5ba},
+{0x0241883e,0xff8e0cca},{0x040107a9,0xc5be6c52},{0x0061f442,0xab233813},{0x02c12352,0xf75302e5},
+{0x02c01b42,0x7cd10bea},{0x020016b4,0x525e44c2},{0x03400155,0xef2e5bb6},{0x0361f4d4,0x0b6a6b05},
+{0x0401d11d,0x3f94716f},{0x04c0fe34,0x477abc3f},{0x02e00e5a,0x9be7ead8},{0x02200d4f,0xfff1eac3},
+{0x01c0a576,0x1df32723},{0x03401153,0x81a4af70},{0x02602eac,0x784e2d98},{0x02e12091,0x34d6fcc5},
+{0x02c016e7,0xc21bcb86},{0x0281f581,0xfec1d3e4},{0x02c1306d,0x0b9e0d99},{0x028e017b,0x0965a76a},
+{0x0241e926,0x89e553ac},{0x06e01df0,0x9e81d21a},{0x04e004fb,0x3ca4381b},{0x0261b05a,0xc0f9d23b},
+{0x02c1d420,0xda97e78a},{0x02801cf6,0xd6c2b47a},{0x03201b14,0xd8dd5dd9},{0x02602f40,0xbc152ca9},
+{0x02c02d01,0xfbb90363},{0x018e0035,0x54ead3a4},{0x0281693f,0x09814eeb},{0x01a02311,0x27f1ff6c},
+{0x0460fc89,0xaf503836},{0x01c11c8f,0x14dc0192},{0x0320a960,0xa54c52d7},{0x022032ec,0x1b05630a},
+{0x0640fd9b,0xf1374664},{0x01e0a35f,0x0d5f40f2},{0x02e1011c,0xbf008aef},{0x0521d8a9,0xf3c84034},
+{0x050145ce,0x4796de37},{0x042025f2,0x9430a624},{0x02e145ad,0xfc2aef7d},{0x02210181,0xd721b057},
+{0x03e10b5b,0x5bdd7fd4},{0x0481f712,0x952b8b19},{0x028031b4,0x0d982930},{0x04802537,0xf0abe7b4},
+{0x03e18b99,0x18beb812},{0x03602a78,0xfdb2a652},{0x02410319,0x9b845ab8},{0x03216e4a,0x5f85405f},
+{0x02c1cf5d,0x33a8017f},{0x02600ac0,0x7004ef68},{0x0240ab63,0xd3b8a558},{0x01c0a400,0x6194e13c},
+{0x0461d61c,0xe4a2f148},{0x02a013fb,0x391192de},{0x02418a10,0xb42e925b},{0x0220136c,0xe503c3cd},
+{0x018007c5,0xb2b5f9e4},{0x03e0d7d1,0xf581f496},{0x02401934,0x0f061186},{0x01e013a2,0x0dd57884},
+{0x03012168,0x43f9a566},{0x03a009f6,0xfd71640b},{0x02412260,0x385527ba},{0x02e144e1,0x11211056},
+{0x03602046,0x0b17a787},{0x0321d208,0x5873c175},{0x03c1d6bc,0xda98a5f4},{0x0521d890,0x42075430},
+{0x03e0106c,0x1011bb3a},{0x0221112f,0x1ef9d5b6},{0x01e00bb4,0xfe993453},{0x03a006fc,0xfeed5406},
+{0x02400ebb,0x7ddcc1b2},{0x0401d6e6,0xab9e44bf},{0x0540fc7a,0x3c15e9f7},{0x0120230a,0x22267146},
+{0x01a001a6,0x6dc8f64e},{0x01e106bd,0x3db5792b},{0x0280a727,0xd0f1492c},{0x0341f007,0x46493562},
+{0x03e18c9e,0x0a8df605},{0x0321d186,0x801b31ac},{0x02602f42,0xb010648e},{0x02e13244,0x6a747e64},
+{0x01c0a267,0xebe120e3},{0x01c0a427,0x0ee5369a},{0x02810e73,0x4878d0b9},{0x01e1129d,0x91809c8e},
+{0x01e10523,0x3961e7d4},{0x02402067,0x5fe246b2},{0x02e1443d,0x2170f362},{0x02c11636,0x39ae389f},
+{0x026119c2,0xdfa6b10a},{0x03216e4b,0x6485483e},{0x01c0a59f,0xc2acc41b},{0x0341e832,0xcc1cc7a2},
+{0x02a014fa,0x9b9a4524},{0x03e0321e,0x49b1d03e},{0x0201f5ea,0xc1fe41ce},{0x01c1fb09,0x562cb3b1},
+{0x03c1f65e,0xb8a4b250},{0x02401178,0xb0d4db93},{0x0381d19c,0xaaf9944d},{0x02e130b6,0x227b68af},
+{0x016025e6,0x535b1a0a},{0x01a1161a,0x6f6d54d9},{0x01c0a393,0x8d7ffe0c},{0x0421d084,0x326969d6},
+{0x02801099,0xb0f48495},{0x02c00912,0x58827ee4},{0x02a016c9,0x09d5e5f1},{0x03a1d041,0x1db8f5ee},
+{0x01a0a5b8,0xeb1db40a},{0x032001a7,0xe6b5db5f},{0x04802525,0xe1cc8b86},{0x04200218,0x240e1a48},
+{0x03002f33,0xff49fb5d},{0x01400038,0xed143d19},{0x02200807,0xff2422d8},{0x02e1340e,0x35d23587},
+{0x01c0a197,0xc028c392},{0x018031c6,0x212a727c},{0x0641d9aa,0xc1361614},{0x02c1330c,0xff0d4d2a},
+{0x01e0a5ee,0xba0abaea},{0x03a004ca,0x7ca4c34e},{0x01e0a14f,0x2c31fd50},{0x04a01e16,0x7f6f2c8b},
+{0x04002cbd,0xe164d74a},{0x01e0a6b9,0xe8b0b668},{0x01e11023,0x4310cb2d},{0x02c02d25,0x0769a5e6},
+{0x03203229,0x382713a7},{0x0101f484,0x59b0f0da},{0x0161f3c5,0xd48f1031},{0x0140299f,0xa6d6f412},
+{0x0081f9a2,0x8cdefd6c},{0x04001c9e,0xafa00478},{0x02a01592,0xfbc29681},{0x02c132aa,0x4d070dfd},
+{0x01e1068d,0x513a18aa},{0x02c02d0a,0xa6f367c2},{0x02c1bc82,0x39d148e2},{0x02401bb4,0x0745b3cc},
+{0x01602721,0x3a0af4a2},{0x04001ca1,0xca8c8f45},{0x05201ec0,0x9ab87d2a},{0x038006b9,0x1fb01fd7},
+{0x0340a782,0xd9e73003},{0x0341d4b1,0xc27c8280},{0x02010e71,0x283ce370},{0x02a01527,0x2debe428},
+{0x01a027dd,0xfc7c734e},{0x02a0219f,0xb36ac409},{0x0480fd06,0xdcfe445b},{0x030017ac,0xd5962fc3},
+{0x0241f0ea,0xd0702a90},{0x02816b50,0x3fe6e080},{0x03011a1a,0xb826d311},{0x0261b114,0xf02a9eb8},
+{0x03c1f239,0x283d5363},{0x0281fa68,0xb8124d57},{0x0561f827,0xface8419},{0x0161f41a,0x923d374a},
+{0x02c10587,0xb8d82bdf},{0x0540067d,0x617ef2d2},{0x01c0a5ec,0xb2acaaeb},{0x03610088,0x4f8ebe27},
+{0x02e1451a,0xfdb0d4e6},{0x0120231b,0x340990bd},{0x0321f747,0x2de94a56},{0x032118b8,0x11bdc923},
+{0x02c024fe,0x874c29d8},{0x02a01430,0x02eac2d9},{0x036002f9,0x1476a589},{0x0241b007,0x60feb0c4},
+{0x01e16f81,0xa9a10353},{0x02a16b53,0x136e1812},{0x01e1f104,0xc18dae3d},{0x03411a90,0xcd33f86c},
+{0x01a0a493,0x21a2820b},{0x0200aa47,0xd6c57c58},{0x02e1316b,0x42a54cc7},{0x0421d5da,0x5336d121},
+{0x02816b10,0xc74da209},{0x02202d5c,0x050a7979},{0x04c10b5f,0xbf11a51a},{0x03e18bbf,0xcaea2714},
+{0x026104b0,0x58ba1581},{0x0160fe4f,0xe3cc1780},{0x01a0a0f5,0xb22bcb0a},{0x0321d6c7,0xcfc65ee3},
+{0x04810789,0xf2a11c30},{0x01e1121d,0xd5240726},{0x0341d8c5,0x548c7029},{0x0321ed10,0xb63ef1f3},
+{0x02401401,0xad4bea4b},{0x0261b0ce,0xe7b88f7d},{0x01c1fb13,0x512a6d3b},{0x02e145be,0xf228a128},
+{0x020013b9,0xf403347b},{0x02a00706,0xb5f5bb39},{0x0261f699,0xb3315cf4},{0x0141f90d,0x47b95652},
+{0x01611480,0x7d529c0e},{0x02600886,0x2ea313f0},{0x02616b52,0x8b70f4b0},{0x02c131d4,0x55fce31e},
+{0x04802528,0x8e4be4f2},{0x01a16f22,0xaa4247b2},{0x01e0a22e,0xf0cae60e},{0x03401128,0xe3ee8874},
+{0x03a0fa81,0x1d4ca6c0},{0x01a11411,0xa5855152},{0x02e13402,0x9de50207},{0x0260144e,0x0ca69073},
+{0x0320166e,0x32b1af91},{0x04c0fc4b,0x2932b384},{0x0201fb36,0xaca4cd09},{0x034121c5,0x3c67653b},
+{0x0301249b,0x7b5aa32c},{0x08202b83,0x819fd921},{0x02a0156c,0xded7d887},{0x03c01b3d,0xb39e9993},
+{0x03e018a1,0x07ab3b83},{0x0341d4ae,0xc77c8a5f},{0x02812fd3,0x9f0fb9b2},{0x0320a999,0xce32a138},
+{0x00a1f6f6,0xb832fd61},{0x032122c8,0xe7d46000},{0x0281f94d,0x0e2165c9},{0x02c01699,0xf58542e5},
+{0x00e1f9f0,0xc60169b8},{0x02a16912,0x2655b085},{0x0301447c,0x48c5a776},{0x02016ae3,0xc4bf0599},
+{0x04c01f02,0x38eefba9},{0x02e1f754,0x432745ec},{0x022112c2,0xe044b248},{0x01a1f9be,0x02ecdda4},
+{0x0201f3cd,0x5a5b9a36},{0x0321e826,0x19b48e84},{0x0301d4cf,0x33a111e5},{0x0101f579,0xd975e02f},
+{0x0340a8eb,0x2371047a},{0x02e025e7,0x696b689d},{0x02c130c7,0x3b327778},{0x01a03154,0x620eac97},
+{0x0301da63,0x22e81777},{0x0341bc91,0x36a1b399},{0x02418a39,0x493ab5dd},{0x01c027d6,0x849d3094},
+{0x02c1311f,0x660f391b},{0x026023b7,0xc49485c6},{0x05401ec7,0xed2feea2},{0x04e1d764,0x542eef6b},
+{0x02e14562,0xe33c1143},{0x04a0fc41,0xcda585dd},{0x0240088e,0x62c22d85},{0x01c00c92,0x03375b7c},
+{0x028026e1,0x986d0c2b},{0x01e10666,0xbc3033bf},{0x03a1d670,0xd1587443},{0x02000e89,0x140196e3},
+{0x01a0a01f,0x7008bc92},{0x03000470,0xef9ca680},{0x01c00b9f,0x23157747},{0x02002eb2,0xc7f04076},
+{0x04010b42,0xc718de79},{0x048109fc,0xa72218f0},{0x04a02357,0x85e7bade},{0x02000aaf,0x9f89b7a8},
+{0x03e0a654,0xc7a69b68},{0x02a1f645,0x29b57355},{0x0301f03c,0xcb65b2fe},{0x02001a0d,0x6f0a3548},
+{0x042021bd,0xa3079ca6},{0x02802aac,0xd1666546},{0x0381e117,0x32bc3061},{0x04201d24,0x63dd5439},
+{0x01c00c2c,0x783b1da8},{0x02e0085a,0x73ab772a},{0x04c00696,0xf2ade83d},{0x0501f782,0x1dcd0234},
+{0x01e0194e,0x783ca334},{0x0161f5bf,0xe27158d0},{0x02200ab3,0x280b4031},{0x02e109a4,0x55969e16},
+{0x0361f654,0xefd76e47},{0x03201139,0x23e829f5},{0x02c03251,0xf3522569},{0x02c13130,0x6a208888},
+{0x04802932,0x9419e26b},{0x02200ae6,0xc92070d5},{0x05802b8c,0x2b994b6d},{0x03c0234f,0x6af2a00f},
+{0x02202166,0x9c1ffbdd},{0x04e01ab9,0x16ede72d},{0x0260abce,0x86fde982},{0x0340a7ba,0x811159e3},
+{0x01e01c65,0x03961f2c},{0x0301e95f,0x6551b10b},{0x02410489,0x8c535544},{0x0301d40e,0xc34d0e4f},
+{0x03a0fb5a,0x85e1f048},{0x02a022b0,0xf144c884},{0x02e124ce,0x7b174fa4},{0x0241f0f4,0xe27702ab},
+{0x02a0ab77,0xf93e4dbc},{0x0460fc78,0xba886861},{0x02611c62,0x610ed317},{0x02c133d8,0xf11bed58},
+{0x0341e821,0xe57e9475},{0x03402c78,0xa3449f93},{0x01a11829,0xaa53cf98},{0x028169eb,0xd1d473d5},
+{0x02a1f639,0x6a4a5cc8},{0x02c10d15,0x8b1b81e2},{0x01a01914,0xe6b61496},{0x0461e8d2,0x51214eeb},
+{0x01e10e8e,0x4c6790c2},{0x03c0ffad,0x205da98c},{0x03812324,0x19b26ead},{0x012033d2,0x8972606c},
+{0x02418961,0xb788baa1},{0x024189aa,0x9ecf9ce6},{0x0301f030,0x2220f862},{0x02c133a8,0x29bbe66a},
+{0x02611d06,0x66e5b43b},{0x0361e8a5,0xbeae10a0},{0x01a0a160,0x9d65e12c},{0x02e12163,0x7e51f3e2},
+{0x02a11930,0x55af3ff4},{0x036008c1,0xbc389696},{0x02c022cc,0xb7dbc1d1},{0x02000a9c,0x8fa9f223},
+{0x0281bc58,0xa6601aef},{0x02e14546,0x8395d15b},{0x02e032a3,0xb2c2203c},{0x02002f41,0xbce429d8},
+{0x0161f917,0x7447b00d},{0x01e108ed,0xfc28ca78},{0x0380a7c2,0xec2073b0},{0x030024d0,0x53b6b2bd},
+{0x01e00bcd,0xf57adb93},{0x0261f644,0x200f6547},{0x01602138,0x96b6ffb7},{0x0321f793,0x6a3c469f},
+{0x02401bbd,0x4467ed90},{0x01a0194c,0x7401f0c7},{0x05212030,0x157984a1},{0x028101f6,0xe7404432},
+{0x028012c5,0x1517be2b},{0x01a1173a,0xafd3aa3c},{0x0580fdb8,0x36bbf5c0},{0x01802b21,0x7a47f3a2},
+{0x04a1f884,0x7af149b0},{0x01a1f9d4,0xf6ef1be9},{0x01a10287,0xffee105e},{0x0260123e,0x09cb4e0c},
+{0x042109f6,0xfa3da364},{0x02801981,0x4e2ee7cf},{0x01a1faf2,0x5b06e9a2},{0x02211043,0xe02f1b88},
+{0x04001d72,0xe1277b27},{0x02a001a9,0xd465ddf9},{0x03401627,0xfb364917},{0x0421d8e6,0xe6129584},
+{0x02211058,0x86763404},{0x0340083e,0xf9e45b63},{0x0161f6fc,0x3d51dfbd},{0x0440fc71,0x893e213b},
+{0x04801421,0x79459fc8},{0x03c1f75e,0x96634674},{0x03e18c47,0xf89aa5a2},{0x04016e95,0x60a81d68},
+{0x02810899,0xb794ef91},{0x06c02b7d,0x36c65d5d},{0x01e00cb2,0x3d2cd69c},{0x02010747,0x5a644817},
+{0x024189a4,0xa0cfa00c},{0x03216892,0xb3b7890e},{0x01a0a5e2,0xf00c72c8},{0x01c0a5a5,0x54385502},
+{0x0381eca6,0xccd6597f},{0x03610535,0x9f6f823e},{0x03c1d46e,0xed22f9a3},{0x03c0249d,0x0201320a},
+{0x03404ddc,0x6bbae79a},{0x03c01d4c,0x7eea5d04},{0x0300214f,0xc1abff67},{0x0181f6fa,0x9d2df4e6},
+{0x01e013a4,0x11d57ed0},{0x02e1454a,0x8795d7a7},{0x03801e80,0xe504923d},{0x03210f4c,0x91b94d06},
+{0x01e0a863,0x9c2b8c86},{0x02c130d2,0x09cdff23},{0x01c116aa,0xd4c24f19},{0x0341f732,0x41c6bf7e},
+{0x02c025e4,0x94007881},{0x0441fa11,0xf5c7372e},{0x018031c5,0x162a612b},{0x01c116a1,0xc715852f},
+{0x0321d535,0x28a1a32d},{0x02a104ba,0xe1c86e54},{0x02000799,0xca256504},{0x03a1cf43,0x5f22c9a4},
+{0x0381d4f5,0xc4cf942c},{0x03602a5d,0xd12e3ce9},{0x01e1bc05,0xf66770f6},{0x02c1da77,0xce20f53f},
+{0x0280272c,0x7e804e00},{0x030032af,0x921aaf07},{0x02a019c7,0x1f2c9d23},{0x03a1e88b,0x36f7a770},
+{0x020013c4,0xd809c42c},{0x0321f71b,0xcb65bee2},{0x0281b0a7,0x52ba4e39},{0x01c0a561,0x6eec2664},
+{0x0300054a,0x4029b53f},{0x02a02825,0x3d1393b2},{0x02a169a9,0x47f27167},{0x0381241a,0xecd5c9e2},
+{0x03e18b01,0x0ccfee4f},{0x012020a8,0x4de00aab},{0x0241031b,0x59873006},{0x0061f408,0x494e7327},
+{0x02e13256,0xdd86d300},{0x03e1d89b,0x39a94710},{0x03e02b0e,0x527a43ad},{0x02a10d00,0x6cdf9a46},
+{0x020031b1,0x778b4b58},{0x034024ce,0x4065d618},{0x0260a4fb,0xef34c748},{0x02c10422,0x87c08dd2},
+{0x03802688,0xe8bd1a8a},{0x0200a997,0x46834e35},{0x01e02e3d,0x931ca38d},{0x02810902,0x9ab57c7a},
+{0x02e1448f,0x110d889e},{0x01e1132c,0xfaaadbd7},{0x02e14525,0x82b3e4dc},{0x0441da80,0xd278d5d3},
+{0x0321bc93,0x68acdca4},{0x0540fdc7,0xf9b4758d},{0x03602afb,0xd3c72071},{0x04c1d14f,0xc8a93836},
+{0x0360162f,0xee5e4e99},{0x024189fe,0x3c362438},{0x02410317,0x619885bf},{0x01e1050f,0x6d870a89},
+{0x04e1d64e,0x16e1c86d},{0x02c0258a,0xe390ad5a},{0x0441f171,0x6945b969},{0x03e1d73e,0x1239d2d2},
+{0x02a01cde,0x29bdef73},{0x026003c7,0x4338571c},{0x04c01f62,0x4e34030c},{0x0560fbb9,0x6299d2d1},
+{0x03e1d573,0x61f4f685},{0x04201d7f,0xe999e872},{0x02611460,0x23fe9612},{0x0241895b,0x2d85a2cc},
+{0x03401dba,0x1b5182c9},{0x02c011bf,0x35f22e71},{0x02601a48,0xee492597},{0x02e1f854,0xbfd9e482},
+{0x02e120c4,0xaceed563},{0x02610ad6,0x1c944a35},{0x01e01723,0x9a8f99d9},{0x026e0136,0x18a1b42f},
+{0x0461d7f4,0x26500a44},{0x04a1d995,0x47483e0e},{0x03e18cd0,0x72854233},{0x0361037a,0x3f8fdaa3},
+{0x0201045f,0x6f0f0cd1},{0x00c1f459,0x4917a48d},{0x04001ca0,0x3b304e2b},{0x02601818,0x604d7d8b},
+{0x024189ca,0xa0be56eb},{0x0301698d,0x85623ce5},{0x02e130cc,0x337769e7},{0x01e1067d,0x4d2b07d4},
+{0x01e10514,0x2d9371bc},{0x030120bf,0x0c75936f},{0x03c1f1f2,0xb2244968},{0x01c10ea3,0x204edc37},
+{0x02000e8f,0xb22a742e},{0x042002c1,0xbceebc03},{0x03e18be1,0x19ddd77e},{0x02e144f1,0xf3aa0963},
+{0x0081f9b4,0x854c22cf},{0x03c1253b,0xad372e58},{0x020112b2,0x91d30d20},{0x0660fef7,0xc0a72f4d},
+{0x0421d87f,0x9cfc1b17},{0x01c1fa96,0x5da7ce9b},{0x0360fb13,0xb7343f90},{0x01002618,0x43af2cf9},
+{0x01c00c08,0x30477843},{0x0260268f,0x0bf9f98a},{0x0361244f,0xc0f64b4e},{0x0101f6bb,0xb6d04da0},
+{0x01a1f963,0x76b0b5aa},{0x0380103b,0xb47beb06},{0x03e18b94,0x1dbebff1},{0x0401ed2d,0xf152221a},
+{0x02c02835,0xbbcf168b},{0x02601553,0xfc83e501},{0x0180a18c,0xa44ef490},{0x03a02cd3,0x85914b35},
+{0x0460fc77,0x9ff90edb},{0x02010742,0x61759c3d},{0x02a01502,0xc3ae0bd4},{0x02000f44,0xafd41f10},
+{0x03a145b1,0x225164bd},{0x02201177,0xbb8d3b12},{0x02811d1d,0x5198a4cb},{0x01e0170b,0x783521de},
+{0x0360a7fe,0xed3b88f1},{0x0061f416,0xecf80faf},{0x01e00c7f,0x9deb8e10},{0x028e01b0,0x785e0762},
+{0x0601d92b,0x711da8d8},{0x0661fb4e,0x36b7b2f1},{0x02000aa8,0xa7b4a547},{0x026014f1,0x12b7e306},
+{0x02e14607,0x7bfef2da},{0x0360167f,0x3aea0d60},{0x0721d9ef,0x7117a949},{0x01e01041,0xa7091a67},
+{0x0340ffb2,0x3f9c0ba4},{0x03e1205e,0x2aff3b88},{0x03a12202,0xc77ab499},{0x0201da87,0xc11deda7},
+{0x02e11d8a,0xecad54c8},{0x03211c6c,0x5634f49c},{0x0420180b,0xe2af3661},{0x028003ef,0x45c1af0c},
+{0x0361ee85,0xbbce6b7f},{0x01e1128a,0x6d7e254b},{0x03c1cf80,0x705f879d},{0x0301f742,0xc2b51313},
+{0x032012a3,0x6e191853},{0x0340a77b,0xcde71d1f},{0x01602422,0x0ef74535},{0x0381ee82,0x7b12c8f9},
+{0x04a1d665,0x301afc71},{0x0421eeaf,0xe013ac5c},{0x02c019ee,0xa7214cd4},{0x04a01ac0,0x35447720},
+{0x01c1e950,0x27d0f57d},{0x02401246,0x1f1f2e1c},{0x03200501,0xc984e080},{0x0141f1aa,0xa1939cc9},
+{0x0061f41c,0xa16686f6},{0x036015ff,0x677afb8d},{0x03c024af,0x0c0141c8},{0x03016b25,0xe3f0237c},
+{0x02c00e3f,0x5037fd8d},{0x04601fe8,0x8c16fdce},{0x02e145fc,0xedfbd4b9},{0x02c1304d,0x8618abda},
+{0x02e14565,0xee3c2294},{0x03c1f1e9,0xab243e63},{0x02410308,0xe005eaed},{0x03a026e6,0xf0182e4a},
+{0x0381d7cb,0xf0566953},{0x024188f7,0x1c1db947},{0x02c109a0,0xcf97b4db},{0x0941fba9,0x1e8015f9},
+{0x02e13213,0x1d4f8478},{0x04201ac1,0xe6f03300},{0x00a1fad2,0x66b145ec},{0x02200d79,0xdc61a019},
+{0x07a1fba5,0xe35febc8},{0x03400744,0xfb009279},{0x016022d3,0x7f1eea5f},{0x0441eeb7,0x001ece1e},
+{0x02a019fb,0x97b5f4bf},{0x06000761,0xfd58070b},{0x0280a820,0x620903c3},{0x0161fac3,0x2613aee4},
+{0x01e111b2,0xa52fc994},{0x04c0256c,0xf5a94383},{0x03e18b96,0x1bbebccb},{0x026100b8,0x4f4ca6a3},
+{0x0581fb40,0xf47870a1},{0x02611443,0xfb59122c},{0x03210ce2,0x749aa04d},{0x02610f07,0x69ec97e2},
+{0x0081f97b,0xbe484148},{0x028018b5,0xd121a9c2},{0x03403234,0xba97f69b},{0x0140224c,0x0b9c3175},
+{0x03400769,0xc8e976f8},{0x04401ff8,0xe1a43223},{0x02a0060e,0xe4b384f7},{0x02e028d9,0xb4a2df97},
+{0x028e007d,0xbbadf0a8},{0x0241881a,0x6b842972},{0x0241d320,0xe33ddbdf},{0x02a0abca,0x2ae8e775},
+{0x02010b2a,0xbd1586f2},{0x01e00647,0xb70fd38e},{0x02c13103,0xda16ab7c},{0x01a009fa,0x3c8c3e11},
+{0x0461d77a,0xed5deafc},{0x024188f2,0x151dae42},{0x0241897f,0x31903674},{0x0280fbb2,0x793f5e41},
+{0x02602db0,0x30bfa61f},{0x05002b48,0x3e60a933},{0x028014c9,0x648e37f2},{0x02418a8b,0x57a191e4},
+{0x0461d769,0x77e8cd6a},{0x03401085,0xa749b39c},{0x030003fc,0x5faf5e2a},{0x04000400,0x62ef613f},
+{0x02e144f4,0xf4aa0af6},{0x038004af,0xbd103d5c},{0x02600d94,0xa48251a7},{0x0501245d,0x197ab482},
+{0x0481d079,0xe8736630},{0x02010506,0x059a1fc8},{0x0200a50a,0x8de3e17d},{0x018033bf,0x7a95f004},
+{0x01803301,0x8ace48e2},{0x036001a4,0x7b97e88a},{0x03e0167d,0x25689814},{0x02e12184,0xa0362d1b},
+{0x02602808,0xc71c521c},{0x02e130cf,0x2e776208},{0x01e0170f,0x744d2078},{0x0181f615,0xc886c4d7},
+{0x0361249c,0x6afeb336},{0x02a018d2,0x10139725},{0x042124dc,0xf172920b},{0x02212306,0x3032b63e},
+{0x02211c0e,0xc06712b2},{0x020009f3,0x0ac3901f},{0x0341e845,0x3690cf46},{0x02a1043b,0x8452d842},
+{0x022032f6,0x131eee58},{0x01a0191b,0xdaffa364},{0x02c02872,0x58276b5e},{0x03801f20,0xf444bffd},
+{0x02601385,0x0d6df006},{0x02c130c2,0x40327f57},{0x02601288,0x56f3ed4c},{0x0521d7a6,0x54190f92},
+{0x02210315,0x64681fe9},{0x02e1b11f,0x1399222d},{0x01e023d7,0x345b8c4f},{0x02c1d90e,0x3275d7e0},
+{0x02c0ab35,0x4cf2523f},{0x02c11da7,0x4f64ecfc},{0x02e00537,0x1b999edb},{0x01002398,0x8a41f5f3},
+{0x02812fe4,0xa30d8167},{0x03a1d5a3,0x527bafdf},{0x02a0aa6b,0x0e6788ff},{0x02002630,0x1fb6bb4b},
+{0x02811d08,0x15a5124a},{0x02400e34,0xa92ba3c2},{0x0401d738,0x8412fe12},{0x01a0a412,0x9eafddf3},
+{0x02600a47,0x659e5fd7},{0x02c13208,0x76775e85},{0x028104b9,0x98d92935},{0x02c0280f,0x158fedac},
+{0x03411fd3,0x08407a7f},{0x0221145d,0x77ce129c},{0x032010b8,0xb0260a55},{0x02e12165,0x7051ddd8},
+{0x02e118cf,0x7658c67f},{0x0301f715,0xaceee187},{0x01a11717,0x2050fb26},{0x0160333c,0xfdaa7241},
+{0x0521f804,0xbb316292},{0x02810f19,0x23e2323d},{0x02418ab6,0xc697b345},{0x0660fc02,0x8f0c3573},
+{0x0480fcba,0xca201b2b},{0x03c1f21e,0xadc6472f},{0x0221d10c,0x3c711680},{0x0641203b,0x0437e853},
+{0x026102e1,0xe423bdd9},{0x020013b2,0x9b0f7453},{0x03610982,0x1c79ffef},{0x03c1d6e9,0xce5dd5a9},
+{0x03a102fa,0x57f9756e},{0x040025f5,0xc11420ae},{0x02c0282e,0xa37a4d85},{0x0321251a,0x52d4a373},
+{0x028169ae,0x86ca4297},{0x02401296,0xdeef6b27},{0x03e02516,0xf9ee7406},{0x02410f30,0x502c2c0c},
+{0x02600f2b,0x6e12f6f4},{0x02a10ae3,0x0db66541},{0x01e16f83,0xf9de5702},{0x0481f72f,0xd74c5bb7},
+{0x01c0a36e,0xefaa73f5},{0x02a029da,0x3cf7ae4d},{0x0240a8ad,0xe2010800},{0x02601321,0xbcb124f3},
+{0x0560fd15,0x3fb86f03},{0x02e00411,0xbc401209},{0x0360fec1,0x8ff9919f},{0x02a11d72,0x0f150230},
+{0x0301d462,0xbbca21af},{0x03000131,0xfb6583c1},{0x03e18c5b,0x1b989e24},{0x01a033a4,0xb19cb0f5},
+{0x020017ce,0x4c467e7a},{0x0520fdb6,0x76b79af0},{0x02418a9e,0x4e9d068b},{0x04a022ab,0xed7c34cc},
+{0x02e02049,0xb93c2137},{0x0521d8d5,0xb6df86d5},{0x02418ad2,0xe41b862b},{0x05002b4c,0x7a3f4f16},
+{0x01a007fd,0x09015952},{0x0220119b,0x8ba0773a},{0x0281e8cc,0xc6363c00},{0x03c1d862,0xb5445841},
+{0x04e1cf9c,0x4c9bfb35},{0x03a12495,0x5aa6be9f},{0x048025e9,0x4ed365e4},{0x02418920,0x93276ef8},
+{0x032014a2,0x3ad1648a},{0x03010cc0,0x481f7c81},{0x026019d3,0xde8ea262},{0x03a1d67d,0xde5888ba},
+{0x0300034b,0x5840da8a},{0x04a12069,0x37f58112},{0x0201da61,0xdfe6bfb2},{0x03a0fabb,0xaf6d8313},
+{0x04201425,0xdcfe46d7},{0x0381d0e8,0x75eff86e},{0x02801374,0x38ee68e9},{0x05a1f241,0x314c356c},
+{0x0501e027,0xf2e2c906},{0x02a031ff,0x854a01e1},{0x02c13212,0x6f7514e9},{0x02416fe2,0x830318af},
+{0x03402a16,0x4edde05d},{0x0260128a,0x5ef3f9e4},{0x03e01e32,0x86c1e45c},{0x01e0aa2c,0x25c2a7ba},
+{0x0440052f,0xf3299033},{0x0281d178,0xb9e8d52e},{0x02c00595,0x6b2abc76},{0x02001b84,0x185ca84e},
+{0x04a01e50,0x2154f538},{0x03c01e0f,0x8c2245b3},{0x016007de,0x675fbcff},{0x0240122e,0xbf20d593},
+{0x01403326,0x59378dca},{0x02c1300e,0x8e1f7437},{0x0261cfc0,0xc077f169},{0x0221080c,0x01c54b95},
+{0x02600982,0xbd887537},{0x02c13139,0x6a1e49f1},{0x03602c42,0x03c6d231},{0x02802f23,0x8ca7c773},
+{0x0460a71a,0x43beed73},{0x03000280,0x0cb8d0ce},{0x0340ff58,0xf1e0bc33},{0x02801498,0x133815c3},
+{0x02600abe,0x37f10f88},{0x030010ab,0xf7b27273},{0x03c1d556,0xe32555a6},{0x02e169b3,0x005b0334},
+{0x02e10418,0x6d5db2f2},{0x01c0a0ad,0x65e22097},{0x0240fe06,0x65689444},{0x0460a66d,0xc7d053d5},
+{0x03600fc7,0xcf8984e6},{0x0301d40c,0xc54d1175},{0x0121f98b,0x6984b804},{0x02e003b5,0x0d60a560},
+{0x0200240f,0x93d92fff},{0x0381d6c0,0x724f5521},{0x02002eb1,0x0bea8d80},{0x024111b3,0xe2e83917},
+{0x0180a3d6,0x9e8087ea},{0x03a11ab8,0x73ad5d3c},{0x02416ad8,0xde5aff9e},{0x022112b9,0x1451d017},
+{0x0260ab29,0xd59cf613},{0x03800508,0x98ed4729},{0x02810862,0x4db5ebd6},{0x01a0179c,0x0acc52dd},
+{0x0361ee81,0x8ab3815d},{0x01802229,0xc8833fc8},{0x0320152c,0x18e774a9},{0x03e18bee,0x0dddc49a},
+{0x01c0a26f,0xadca1455},{0x026e0148,0x988b2460},{0x03812454,0x46e8b380},{0x02418978,0xa48d19e6},
+{0x02c13059,0x31f12b7c},{0x02a1e920,0xa9085c02},{0x0241890e,0xa3163f07},{0x02418adb,0x6d1e9c6d},
+{0x0360141b,0x79d20d30},{0x03a121a9,0x3991bcee},{0x044109dd,0x9f72aa99},{0x02c105a6,0x0adab0dd},
+{0x03600198,0xda91dc47},{0x02c02874,0x662b1183},{0x03e10b52,0xc9779a69},{0x04e1f783,0x6a71e816},
+{0x0081f426,0x43a53ff2},{0x02c1f091,0x937d9955},{0x022122ae,0x30c06103},{0x032022ef,0x4f0be694},
+{0x01a0a0d5,0xd8e5e570},{0x02a022f5,0xd9983622},{0x024108ee,0x9420735e},{0x01a0a1d4,0x87b40aa0},
+{0x00a1f4da,0x17c1cf71},{0x03a0fac8,0xa36b3198},{0x0260aa88,0xf84df657},{0x02a02d95,0xb936df6d},
+{0x0441d886,0x0d2dd4ca},{0x0261b070,0x28169cf9},{0x03c1cf26,0xaea486bc},{0x018e0030,0xdcc3b8fe},
+{0x03a1ee2c,0x23f2069f},{0x01a0a3ce,0xfa64494c},{0x0341f13c,0xe800ec3f},{0x02000a10,0xe20259e9},
+{0x02e14432,0x1e6eb012},{0x0520fc86,0x25f7cc40},{0x0261090d,0x00289184},{0x0241b00f,0xc8f4c720},
+{0x0340a77d,0xcce71b8c},{0x0260a789,0x004b12d3},{0x02e00541,0x0a883af7},{0x02e007f0,0xcff3d0f9},
+{0x0440fbbe,0x47c5f5c9},{0x030010ae,0x855957ec},{0x02e14534,0xfcae94bc},{0x0221038e,0xa52ee44c},
+{0x02418932,0xa47bd0c5},{0x0280096d,0xa2c54625},{0x00c022a7,0xe4821e0b},{0x03600127,0x4f1dc014},
+{0x0261090a,0x00aff6d3},{0x02e14561,0xe23c0fb0},{0x03e01e22,0xf61fda21},{0x02e1d372,0xfc4b50c5},
+{0x05e02b35,0xb2249bf6},{0x022023d9,0x735060ea},{0x02000b03,0x3db671f5},{0x01e1f786,0xdbf816fb},
+{0x0220225f,0x2b6a6a8d},{0x02000eac,0x9b389d5e},{0x024188cb,0x20133237},{0x01e00f63,0xd9733d69},
+{0x01602766,0xc1699359},{0x02a0148a,0xbce31a12},{0x02e0054c,0x1ac47e4f},{0x028002e2,0x6d8c84dc},
+{0x03e1d604,0x8c05e9f4},{0x02c13170,0x39cb1c50},{0x0441d045,0x27ee9dae},{0x0261b10c,0x663452d6},
+{0x03e01e58,0x143b624f},{0x02c1fa2f,0x65d10e9c},{0x02803283,0x879daeb6},{0x030017b3,0xdfe8d51a},
+{0x02a012c4,0xa260c72a},{0x02418a11,0xb130cc39},{0x04c02aa8,0x4341bd9d},{0x01ae0038,0xb198cc9f},
+{0x01c0a3d8,0xead5cbd0},{0x0260a8b0,0x5954a424},{0x0260274d,0x56205339},{0x01a0a1cd,0x836edfd0},
+{0x03402de2,0x27521f8e},{0x024016c0,0x2bae2988},{0x02e0281f,0x8a9307db},{0x03000d01,0xa3cfaa58},
+{0x01e115a2,0xf95a16ce},{0x02e16e6c,0x5fd44d91},{0x03e1fbae,0xeeb3227c},{0x02801191,0xdf410c31},
+{0x02c11361,0x864832ab},{0x02816a22,0xa3c539bc},{0x01e10695,0xbf32770f},{0x02e01b47,0x434cea00},
+{0x02211158,0x9f61770a},{0x0241234f,0x62707b99},{0x02001161,0xcb2b8bb3},{0x0341e88c,0x0087346b},
+{0x03002b16,0xe1be445a},{0x06a0fc90,0xf49f7c18},{0x0181f38c,0x66db1555},{0x04001e06,0xb5d72a4e},
+{0x02a02852,0xbaaaf84a},{0x0320a96f,0xad8201d1},{0x01202e3a,0x3987faf7},{0x02a10030,0xcc0b2579},
+{0x028e0184,0x02659c65},{0x0220182c,0xb8135bad},{0x03400169,0x5e969fb7},{0x01e10661,0xb7302be0},
+{0x02800959,0xc03774fb},{0x02411a56,0x4d5dd2e7},{0x022112ba,0xbc423b05},{0x03c1e852,0xcddadf8c},
+{0x02a11a9c,0x8d27b66f},{0x03202f15,0xef19ed52},{0x05400754,0x1aaf2884},{0x02e00f1c,0x1c3790c6},
+{0x02c1305f,0x069bc723},{0x01e1113a,0x2bea51f1},{0x02003145,0x7ea6f572},{0x03602906,0x9263f028},
+{0x0541cf7a,0x107b7967},{0x03e1fb9b,0x9b6c89ae},{0x01a0074a,0xc5240aab},{0x01a116a5,0x21f28295},
+{0x022112b7,0x1851d663},{0x01a0a4a7,0xeda8405d},{0x0420ffaf,0xc9db659f},{0x02c02159,0xf63ea380},
+{0x02401275,0x1525da23},{0x034001f9,0x71b5f087},{0x01e01698,0x218ed97f},{0x02812fe3,0xa20d7fd4},
+{0x04a1da4b,0x0d11d158},{0x0380feab,0x748826ed},{0x03c0294b,0xafc4e028},{0x034122b3,0xf44f19e7},
+{0x03616805,0xb8ef2243},{0x0121f691,0xf6419b7d},{0x02011c04,0x03d77099},{0x02810fba,0x28443846},
+{0x0280143c,0x94f42bb0},{0x0221f100,0x3cbe2d29},{0x01ee003c,0x87931e1c},{0x02418847,0xf68bc008},
+{0x04601ee8,0xcbb29828},{0x03c1d755,0x13a183ad},{0x0760077b,0x6913a420},{0x03c1ee79,0xdc71ece0},
+{0x03601398,0x3fa032d3},{0x03201b62,0xe58a10b4},{0x034121c9,0x963e5fb0},{0x02c130c8,0x3e327c31},
+{0x05c1d9b2,0x5dcef973},{0x03802b69,0x1ea81d5b},{0x02c01b81,0x8ff4a17b},{0x02a01097,0x01e15e5e},
+{0x0380034d,0x5d10d1b4},{0x02e01c3f,0x01e15a7e},{0x0141f3d0,0x1035b0f9},{0x034018ec,0x45bcf740},
+{0x038145bd,0x75428ba8},{0x0301d6d9,0xf1d61983},{0x03a00272,0x43a2c214},{0x030144e6,0x2d22eacf},
+{0x03610ca4,0x8abfdbb9},{0x04402527,0xc3b62c8b},{0x038006f5,0xcf2f7e6e},{0x02c130bf,0xad2adc29},
+{0x0241f3b4,0xb0a98627},{0x01e102a4,0xf4c25d58},{0x0341f13e,0xea00ef65},{0x04c01f3d,0xce94ec68},
+{0x028016b7,0xfec77365},{0x0081fa7b,0x92934e09},{0x0320ff9a,0xdca81eb7},{0x0380011a,0x66fb0701},
+{0x03a0fa80,0x1e4ca853},{0x022009a0,0x127f3176},{0x01e00f58,0xfd75b4ac},{0x02010485,0xd31620cf},
+{0x02e145df,0x79f46258},{0x042020e0,0xfd23a0bf},{0x02816904,0x0ca86314},{0x0301d414,0xbd4d04dd},
+{0x03e18bd0,0x14db9108},{0x0181f3f2,0x886ed334},{0x02418a98,0x569f51ba},{0x01c01680,0xdffeb82e},
+{0x02411c23,0x0361087d},{0x028110e0,0x0f915256},{0x0260148b,0x3491091c},{0x02e0aa7b,0x69f1f92c},
+{0x02e1462d,0xd6c448bc},{0x02e145fb,0xeefbd64c},{0x0321d521,0x0ca17719},{0x04001fd9,0xb99f23c0},
+{0x02c00580,0x8f060a14},{0x07602962,0x65f7844d},{0x02a00671,0xd5d2a2ff},{0x0241891c,0x8f2768ac},
+{0x03e1d5fe,0x8a05e6ce},{0x0261b0ff,0x19c29960},{0x0461d750,0x29dbb774},{0x02e111e4,0x019b4fd9},
+{0x01e10ea4,0x15d4cd76},{0x016007d5,0x6f7112b8},{0x03800fd8,0x549d6c8d},{0x03e18c51,0x0e9889ad},
+{0x030025a4,0x688538c3},{0x02010505,0x4c150532},{0x03c0233a,0xc21efb02},{0x04e1d9d7,0xcb540ce7},
+{0x022006b1,0xfb15c996},{0x02a169a7,0x53657205},{0x03a01e6d,0x6939ec48},{0x04a0a73a,0x98e90855},
+{0x01002bbe,0x49fd977d},{0x03016af2,0x634f0644},{0x02001c28,0xe1e513d9},{0x03e1d602,0x8e05ed1a},
+{0x038000d5,0x36466c22},{0x0441d96e,0x245db43f},{0x0361e847,0x1cc26136},{0x0360fd4b,0x83b29e40},
+{0x0321d709,0x793a05f3},{0x03c12429,0x624c10c4},{0x046004f7,0xd3b97f98},{0x0361085c,0xa6ddd228},
+{0x03c0fb3a,0xde7375d8},{0x03c1d068,0x8d72ee77},{0x01e11151,0x9c594e93},{0x0480254d,0x3d9391c9},
+{0x04a0fc29,0x5d217b06},{0x03e02ae2,0x567a19be},{0x02411c59,0x758ac6c7},{0x014002dc,0x7f2aa58a},
+{0x03e12522,0xf742a53d},{0x0381f199,0xae31fc45},{0x01e0a915,0x06b11551},{0x01e16ac0,0xc8a08af0},
+{0x02611c3f,0x35c93045},{0x020027cf,0xddeb44f0},{0x014029fb,0xb7e8e485},{0x0160a014,0x558461aa},
+{0x0481fa1a,0x842c0b7d},{0x0321683d,0x4fdc09c6},{0x05c1f92d,0x45781dfe},{0x01ae0023,0xb2d674df},
+{0x028e006e,0x7fc23704},{0x0081faa2,0x30e0dc57},{0x040109dc,0x1fd492d3},{0x02c13029,0xfa249b69},
+{0x01802081,0xcc9a8062},{0x0101f369,0x0bbc2d57},{0x03016812,0x06af8f24},{0x0561cf77,0x26b7e27d},
+{0x02e1455b,0xf33e690a},{0x032121cf,0x506800af},{0x016025cb,0xfbaf724e},{0x03401606,0xcf3a8101},
+{0x02c13045,0x7e189f42},{0x03610d17,0x43a2188e},{0x0381ee2f,0x2168eec9},{0x02601a91,0x3e2c1bf2},
+{0x00a02322,0xd01db3fb},{0x02c00e47,0xb9bee017},{0x0160330f,0x88cd113a},{0x02801b1b,0x5c7254eb},
+{0x02a10f04,0x8b0b8d55},{0x038008ff,0x05b2d95c},{0x02e14521,0x86b3eb28},{0x02212094,0xe95cc33e},
+{0x028014ac,0x44a4410b},{0x018022ae,0x8f173cc0},{0x008026b5,0x715dac17},{0x03e0309b,0xf2e81924},
+{0x0360a834,0xeb2bba24},{0x02e14636,0xe9c2280e},{0x0241b004,0x51eb116f},{0x016111da,0x69814aa9},
+{0x0260aa99,0x0477c08e},{0x02000a2f,0xd9c7b629},{0x0480fc9f,0x0b4bd1bf},{0x03c10b61,0x76dbefd6},
+{0x02c018c2,0x9013d5e4},{0x03e18c63,0x849571d8},{0x02816a00,0xe0f8a94e},{0x028102e9,0xb7776653},
+{0x01e1f3b9,0xa0998950},{0x0320fed4,0xfcd1060e},{0x01c1fac4,0x21ccf5c5},{0x0101f43a,0x3ffd2e90},
+{0x02c02c88,0x50d3b31a},{0x02c130e8,0x15d0509e},{0x02a11d1a,0xabe54f0b},{0x030010a9,0xfde5dba9},
+{0x01a0a1ef,0x71f465d1},{0x02a011a0,0x6e9fcab7},{0x012020a6,0x59f12a2b},{0x0201d2e4,0xc2d6d621},
+{0x03e18c55,0x0a988361},{0x0201063a,0x15219d10},{0x02e10a60,0xc6879dd6},{0x02802a61,0x73084ee3},
+{0x04a124c9,0xf59ef892},{0x03202edb,0x3e4e3936},{0x024022d5,0x48dfcd12},{0x02601105,0x04cac6f3},
+{0x0581d88d,0x894500e4},{0x01e00842,0xc8b5ad34},{0x02403267,0xb5da31d8},{0x05212513,0x6d31a462},
+{0x03c1f218,0x927d0547},{0x0260a818,0x3766d829},{0x020103bf,0x92e036e7},{0x02200d32,0x6e1e1a7b},
+{0x016020bf,0x4d91a13c},{0x0220a9c6,0x630014fd},{0x02a01140,0x3065d01f},{0x02c119e2,0x39dc8956},
+{0x02202f6a,0xf08d060c},{0x026110f2,0xf59622be},{0x01a00b0a,0x938e687b},{0x024112d6,0xe070f28e},
+{0x0381cf57,0xb30c85ce},{0x02c13009,0x891d2dc1},{0x03e18c1c,0x34a1bfdb},{0x04001f78,0xff213ea8},
+{0x01c0a43f,0x720cbfa2},{0x0300053a,0xe0c9505b},{0x01e0a5f0,0x97b91a05},{0x03e18b6d,0x0bcb6f8e},
+{0x01c0a335,0xdd7cc51a},{0x03a0faca,0x0c6bd6e3},{0x03e18c19,0x7ea23459},{0x03c02774,0x6e536c80},
+{0x02401236,0xff2378ea},{0x0341d443,0x27b2a765},{0x014000b0,0x45cf1038},{0x0360a8ba,0xf6933700},
+{0x0241105d,0x26dec3af},{0x03016986,0x84fa4d44},{0x03411a8d,0xd6340697},{0x00e1fae7,0xa62b66f4},
+{0x03a0025c,0x0b74f161},{0x02601354,0xde4cfc96},{0x0320d7de,0x3bce9dbc},{0x044124f4,0x5cd5b030},
+{0x02e144a9,0x99060ff1},{0x0180a524,0x0be6b23a},{0x01e106cf,0xb1baacf5},{0x0180a4e0,0x4ef6af4f},
+{0x04401f48,0xb6461d3f},{0x02e1f7d6,0x587f022a},{0x02411951,0x71e37a8d},{0x0341bc83,0xe73e90f0},
+{0x0281cf6f,0x4225822e},{0x0301da1f,0x4d85399d},{0x0180a483,0x8e6f2599},{0x026021e6,0x846b79a5},
+{0x0320fbbb,0x43629eb6},{0x02e1341e,0xafcf23fe},{0x0381f685,0x3d23c511},{0x0301f755,0x2dcc56ce},
+{0x02e169f1,0x46136b47},{0x0280080b,0xb9b751d9},{0x0380166b,0xd4b68800},{0x01e00c37,0x7caa21fa},
+{0x01e0a555,0x0adb617b},{0x03e18bb4,0x1ceaa82a},{0x0341e830,0x2db3e083},{0x02e16f52,0x764c4e8d},
+{0x02800d40,0x1da29f8a},{0x00a1f40e,0x7e3e6006},{0x01c00c26,0x4440dbfa},{0x014033c0,0x15362857},
+{0x03a11a86,0x002d5e06},{0x02c01395,0xb1048538},{0x0501fa4b,0x6652450b},{0x0201bc34,0x5ac2820a},
+{0x04a0a75e,0x28f17c24},{0x034111ec,0x204093cd},{0x028e0077,0x88c2452f},{0x01e11839,0x05a9bf67},
+{0x02e144d6,0x1c23603e},{0x00e1f490,0xbdb8573e},{0x02e13423,0x22d694cc},{0x02c1f83a,0x340366aa},
+{0x01e10731,0x816ee4bf},{0x02810ad9,0x915c690d},{0x02410865,0x2d774e45},{0x024008f1,0x31ad036a},
+{0x028001f1,0x3a62f7f5},{0x03a0fa98,0x304a8612},{0x032121c4,0xf071f6eb},{0x02e144ff,0x83a29d4e},
+{0x02418a48,0x444779f1},{0x03a01503,0x9da357e4},{0x02c1315c,0x3cbc167f},{0x02c132cb,0x69987f39},
+{0x02400cc8,0x1db999fb},{0x0280aa5d,0xfb61ca74},{0x01c0a350,0xd59a533e},{0x01e10722,0x8c7134a7},
+{0x0221f027,0xa67794b4},{0x02a02d00,0x04478029},{0x02e1fbbf,0x7175c397},{0x0241fbf0,0xadad4002},
+{0x0160330e,0x39b8f8d5},{0x03e1d580,0x74f5146e},{0x04a107af,0xe76cddbf},{0x03410159,0x4f9782a3},
+{0x03602c72,0x9ba19ebb},{0x02201b95,0x7ca45688},{0x020017bf,0x809949f4},{0x0280326c,0xac2fbf23},
+{0x01a00022,0x51e6b8b0},{0x02418910,0xa516422d},{0x0401f112,0x2730193c},{0x0301da62,0x72edbe53},
+{0x02a0199b,0x616b8b3c},{0x04002c22,0x2baa70b3},{0x0281035d,0x3fd77a55},{0x0340fb94,0x63b244f1},
+{0x02e14511,0x7ea4d406},{0x01c0a2ed,0x98ad4222},{0x04a1d65c,0x411b1734},{0x03e02cde,0xfdea1a71},
+{0x02e02c8c,0x68db18d3},{0x0341f76a,0x934b65f6},{0x01c0a05e,0xc712a1be},{0x026011ba,0x353c9dfc},
+{0x0320a970,0x4368b86f},{0x02416ada,0xfbc6a8d0},{0x01c0a535,0x3566424e},{0x03602c38,0x58430b46},
+{0x02c132c7,0x6d988585},{0x00c1f412,0xfa2635c8},{0x024188ea,0x0f0c5baf},{0x02810889,0xfc98c875},
+{0x01a0aa55,0xacfec8a5},{0x02001c5f,0xcf40b9ae},{0x04401eaf,0xb8127548},{0x0421245b,0x6e1256db},
+{0x02c028c6,0x2372c840},{0x02803181,0x1198c113},{0x0161f971,0x4da137b7},{0x03a1d687,0xc8586618},
+{0x03600183,0xfbeebc22},{0x02c01984,0x14d4089d},{0x05e01fd7,0xd74bec4b},{0x02e145b4,0xf72ae79e},
+{0x02e0ffc4,0x679530ab},{0x03c101e2,0x1803ec7a},{0x04401e79,0x7296d53c},{0x02c1f07c,0xe880c15e},
+{0x0261e92f,0x5bb06b60},{0x0221149a,0x2ff50817},{0x02e0ab33,0xa8eba503},{0x03a0a8e3,0xbf6fc9e0},
+{0x022031aa,0xdaf05f0b},{0x0241cf50,0x61bf799f},{0x04a1d04c,0x35d5cbfd},{0x01e10b17,0xb9232e59},
+{0x03600830,0xda9245ee},{0x02c130a6,0xaf2d1de6},{0x02811d56,0x667a00b7},{0x01c016a7,0x0c93a961},
+{0x0380141a,0xc7842a83},{0x02000b42,0x1df00271},{0x0241f360,0x05575176},{0x04010b46,0x4658614c},
+{0x02400806,0xd451662a},{0x01e121aa,0x9c229da8},{0x03c003ac,0x4ed5095d},{0x03a01f30,0xa0e12ff4},
+{0x026003b7,0x1587f08a},{0x01a0a537,0xcb2391d8},{0x02a1f55b,0x8f7e033c},{0x01e0214b,0x718d9b9a},
+{0x01c0a249,0x524a945a},{0x01e1148c,0x5b48ac22},{0x0381d48d,0xba200783},{0x02200d35,0x6a361915},
+{0x01a0a283,0x906a736d},{0x01c0a389,0xcf9ce806},{0x02a10fb8,0x761ad179},{0x01811613,0x5feb9736},
+{0x0361f73c,0xbeebb03b},{0x0360fb6a,0xe26a7325},{0x01e1d196,0xe38c622b},{0x02e0217b,0xa4b86038},
+{0x02418abf,0xd516f160},{0x0401d733,0x9fe4122e},{0x0320fb8d,0xfab5e76a},{0x02812fda,0xa80fc7dd},
+{0x04c01f2a,0x4d2610a2},{0x01e00bee,0x8c00e86c},{0x02c130ba,0xb12ae275},{0x0261b077,0xc22f944d},
+{0x01c1f7e5,0xe6f9fc2c},{0x03e1d5ee,0x7a05cd9e},{0x02c130a2,0xb32d2432},{0x0421d5e1,0x4a36c2f6},
+{0x0441ee5f,0x5ea4f72c},{0x04a01b6f,0xb6997e9d},{0x02801564,0x06329d7d},{0x01a01958,0x29a9f1a5},
+{0x024189d5,0x23c3a252},{0x0361f89e,0x9320951a},{0x02c104bd,0xd987cf07},{0x048001ed,0xbee6d315},
+{0x03801ba6,0x754c2543},{0x038124cc,0x50a8d5e2},{0x0300029f,0xf6b8ae2c},{0x02e14542,0x78938173},
+{0x01c10e67,0x3f134102},{0x0161160a,0x00b6ef65},{0x0161f4a2,0xfe1e5a04},{0x02c13159,0x39bc11c6},
+{0x0200305d,0x6e57353c},{0x028000bf,0xc89b50dd},{0x02211906,0xd8dcd851},{0x020103a8,0xb2b7c6d7},
+{0x0380fb7f,0x229e603a},{0x01a1180f,0xca2cf288},{0x03a02996,0xb84f1a04},{0x04c12440,0x8bbfbb2d},
+{0x02418a7d,0xcda6c8d4},{0x00c1f954,0xf8b98612},{0x0161f3a5,0xb57680e0},{0x028112e4,0x8cd605a9},
+{0x02a11d29,0x6fdb356a},{0x0140269b,0xb891406c},{0x03e18bf1,0xa1e0ec2d},{0x0261b112,0xf22aa1de},
+{0x04401f59,0xa449c679},{0x02816a1b,0xd9763659},{0x022009e9,0xb1d1e78a},{0x01a01915,0xdee7a4ca},
+{0x02811d75,0x329a35d9},{0x02212356,0x3c78a520},{0x01e02635,0xa0cd068b},{0x03402514,0x1ca886b7},
+{0x02816975,0x3b71d340},{0x0340ffb7,0x479af27d},{0x01402283,0xbdb3d7fd},{0x03c01150,0x1e10601e},
+{0x03200fae,0xe1df3502},{0x02418a75,0xc5a6bc3c},{0x03a0145c,0xe095cbcf},{0x028006aa,0x3fca4b1d},
+{0x03c0257d,0xff932466},{0x02002ce6,0x831a578f},{0x024019c9,0xbcfd673e},{0x02c1326c,0xf5b0b1bb},
+{0x03602ec8,0xcdf584ee},{0x03a02a7b,0xa095f4db},{0x01a102a5,0xd1f0c9fb},{0x04c00494,0x6e8480b0},
+{0x02001688,0xad42eea7},{0x02c1317f,0xb732e65a},{0x02a1f567,0x571b2669},{0x0301f05d,0x1782d639},
+{0x02812fbc,0x17f02482},{0x0280031d,0x7235775a},{0x01e1e953,0xdb007a89},{0x02a016de,0xf1ef7c0e},
+{0x03410a46,0x51482fe5},{0x02402732,0x93fc705e},{0x02416a04,0x3d71ef6d},{0x04a01da7,0xcb245d88},
+{0x0300a868,0xc341ce4a},{0x04201ca5,0x1efc7485},{0x05402ff0,0xdad4f035},{0x0580fc5f,0x6fab1e4f},
+{0x03e18c2b,0x0d9f43df},{0x03a1da3f,0xeaae9041},{0x0121f9dc,0x6a9ae692},{0x05c1d833,0x2dd3f03c},
+{0x02600f3e,0x38015864},{0x0241896c,0xa68ade75},{0x030118d2,0xa48c4796},{0x02a104d3,0x32f16d5b},
+{0x0540fdc6,0x5bf0905d},{0x03e18b0b,0xddcfa452},{0x04802949,0x3101b79c},{0x03201b12,0xd2675b91},
+{0x04003191,0x70d65414},{0x05011fc0,0x758f1651},{0x024003bd,0x8a2fd87f},{0x0281044b,0x9dfbd89e},
+{0x03a00172,0x13385ff9},{0x024189a2,0x28c8275f},{0x01c11828,0x271c047d},{0x03c0a7d1,0xc6e95107},
+{0x01e1048c,0xb9231123},{0x02802492,0x884e27d4},{0x01e11339,0xf6c46d71},{0x036009f5,0x5ddc1e71},
+{0x02c00483,0x85e40310},{0x0301f1a5,0xc90730cd},{0x030111cb,0xfb692290},{0x02e14492,0xa20a9b4a},
+{0x04c1d1e4,0xe17b41c2},{0x0381e10b,0xdaa5df8a},{0x0501d781,0x3521d748},{0x02401550,0xc24c0b5a},
+{0x0221f62e,0x3012107f},{0x0121f3e9,0xb0389811},{0x0221f3db,0x797cb4da},{0x03801885,0xa8b792d3},
+{0x04c02bc6,0x0a994d82},{0x01a02eab,0xd48c3aa6},{0x02201bb2,0x019e7a9a},{0x03810c86,0x562e40ce},
+{0x02816b0d,0x589c63ad},{0x02c028c5,0x35d453c7},{0x01c0a06d,0xbb442ba6},{0x032100ab,0xa1a58dbe},
+{0x02e1f799,0xc5caac9a},{0x02602041,0xa3ba3fc1},{0x0260aa36,0x48e3e304},{0x03212150,0x50e70034},
+{0x0221fa64,0xc6e40a85},{0x02802b1e,0xb7c94cda},{0x02a01378,0x271c08a9},{0x032118dd,0x4d812f27},
+{0x01e11220,0x9f527912},{0x02c131ec,0xc80213c2},{0x02010607,0x27330287},{0x00a1f9f9,0x00cff47a},
+{0x0480236e,0xc5de46c9},{0x0121f9f7,0xc28b998e},{0x02a16b57,0x087d456f},{0x028169b8,0xb1ebbce8},
+{0x02e130ce,0x317766c1},{0x03a00246,0xf5a270ba},{0x04402a9b,0x6fca68a7},{0x0320a696,0x8fa1987b},
+{0x02a12004,0x0923dd84},{0x028011af,0x3927e667},{0x036015b3,0x50ea3002},{0x01c0a2b3,0x528b4fbe},
+{0x01c1f9ce,0x79832a73},{0x03e1d572,0x62f4f818},{0x02c01d3a,0xb4e7fada},{0x02e145f7,0xf1fbdb05},
+{0x03c0fbe1,0x1c06ca85},{0x02801dcc,0x3add99c7},{0x0341d21c,0x7f43c6af},{0x04e1d655,0x0de1ba42},
+{0x03201646,0xe04c72b6},{0x0441eea2,0xdef82867},{0x03a02cc7,0xe043c20b},{0x03810f49,0xc0fb0241},
+{0x03000faf,0xba71924c},{0x01c0a5c2,0xb270da3e},{0x0301d403,0xcc4d1c7a},{0x02c0329b,0x13f537a2},
+{0x02211a76,0xf378d057},{0x01a00be8,0xd0248655},{0x024106a2,0x324286a5},{0x0201f6ec,0xcfb67b37},
+{0x0241882a,0xef89766c},{0x01e02a54,0x2a3ac0b2},{0x02c1f08e,0x8e7d9176},{0x0360fe95,0x0dfa80db},
+{0x020030ea,0x28c541ba},{0x02e1447a,0x0a0fbc30},{0x02c0046f,0x33543218},{0x02c0057d,0x5c105f23},
+{0x02e00401,0xc251649c},{0x01802b22,0xec311140},{0x03c1f1e7,0xb12447d5},{0x04416ff1,0x4f24ecc1},
+{0x04c01ff3,0x34484381},{0x0321df03,0x4edc594f},{0x02e131cc,0x7b8e22ef},{0x0201f69b,0x965dbbe9},
+{0x0241893a,0x267edc02},{0x02000619,0x58766628},{0x05a1fb45,0xe8902ff2},{0x02000e9c,0xb77898e3},
+{0x04c01e39,0xf34bc343},{0x0461d8cd,0x53eded8c},{0x0261b106,0x1cd1a8a3},{0x02802884,0x8f9306a3},
+{0x02200c3e,0x5d999651},{0x02801baa,0xac318a2b},{0x01c025ad,0x86e698ef},{0x02200a23,0xc62629a2},
+{0x0261b0e1,0xff9cb8f8},{0x03812121,0xe5a9f7df},{0x0341220a,0xdc30ee6a},{0x02801556,0x339806b4},
+{0x03202a28,0xbbb438b3},{0x03e1d008,0x3c533872},{0x01e007b1,0xb07072e6},{0x016007e3,0x7357811e},
+{0x03410890,0x9e4cfb9f},{0x0240079f,0x980ed387},{0x01a1fb0f,0x2ea7cb66},{0x01c00c30,0x58638db8},
+{0x01e025e1,0xa3b7826f},{0x02c008eb,0xf83ccd0a},{0x03004ded,0xf577fc14},{0x03a01e63,0x1c9a10e5},
+{0x028032a4,0xbb2eeaee},{0x012022c3,0xa82a91ac},{0x022019f2,0x5f64b30c},{0x02403022,0x45e7710f},
+{0x02200064,0x25576144},{0x03a0fecd,0x6bc61f2f},{0x01000032,0xe8f7da24},{0x01c0a2fb,0x909e2b00},
+{0x01c0a189,0xb7259c29},{0x02418956,0x3885b41d},{0x026122d2,0x0b1878d8},{0x0441df1d,0xf4512527},
+{0x02402e22,0xc2c74610},{0x01e115a1,0xcd2e44ec},{0x02012365,0xab3cfb5e},{0x02e000de,0x3e8270c8},
+{0x03210a7a,0x035779d5},{0x04a0fcfc,0x1ab8d252},{0x01a0a044,0xe4b03429},{0x030120af,0xe2be4129},
+{0x01a00c09,0x6b0bafbc},{0x02602ad4,0xdc8e0b43},{0x03002d4c,0xa85bf599},{0x0341e890,0x26973d5f},
+{0x03a1f840,0x7803010c},{0x03201471,0x247a738f},{0x0360feed,0xaa28dc63},{0x02200d26,0x3e0a4733},
+{0x02810436,0x71d90118},{0x0340fece,0xcfc3c45c},{0x02c019aa,0x709dad48},{0x02e1ec80,0xb8844b0c},
+{0x02a1207b,0x1940ded2},{0x02e16b1c,0xf37fe15a},{0x026012e0,0x5ceb7801},{0x02e1449d,0x9e085667},
+{0x02001a44,0xc8ce25df},{0x02e010c1,0xfc7f355a},{0x02e10c05,0x04c2f8e7},{0x026012b5,0xdf37e71d},
+{0x020030e0,0x4cd24659},{0x04202b85,0x93a76db3},{0x02811d24,0x458748c6},{0x02402ae1,0xdf6a99b8},
+{0x01803300,0x600b8bb0},{0x01e0a876,0xf681c1ba},{0x02c13000,0x8b1d30e7},{0x02e0fbe7,0xbeae101a},
+{0x0180aa0e,0x177ee4bd},{0x02200cee,0x7270914b},{0x02418946,0x24811773},{0x01c0a573,0x322ffdcb},
+{0x04402b6d,0xc11aab87},{0x02410a31,0xf2176d6b},{0x02212232,0xdf815a89},{0x0520fd9f,0xb3b419ea},
+{0x02c10d05,0x7310cebe},{0x0361d68f,0x2a06ce53},{0x0160aa03,0x6dc2aa4f},{0x02801dcb,0x91df7f1f},
+{0x03e18cac,0x138cfb6b},{0x03a02409,0x142b5983},{0x028014fc,0xc0b56313},{0x0341d20d,0x0f4da3bb},
+{0x0161fa7a,0xa3a3d3ce},{0x024021d1,0xbc04cccb},{0x00c02698,0xacb6bc46},{0x02c005b3,0xa505879f},
+{0x0340322a,0xe08bad89},{0x03402099,0x1fcc1741},{0x04202960,0x214a626b},{0x01c16abb,0xc4cc7eac},
+{0x02a10ac9,0x516ff3d7},{0x0220272d,0xa5709c9a},{0x03a0fac9,0xa46b332b},{0x020009ad,0x10cb06ce},
+{0x0441d7df,0xa793c7ce},{0x02e010a0,0xb168f8fa},{0x02601238,0x0fcb577e},{0x01a0a250,0xa367ad96},
+{0x03410547,0x793c073e},{0x0560fd53,0xf7a1e7d4},{0x01e12116,0x5c05b6d4},{0x01e00f40,0x1966d636},
+{0x02000374,0xae5de562},{0x03a0fbfd,0x6f806806},{0x02200d17,0x2e10e9c8},{0x0501d79c,0xf1265569},
+{0x04212521,0x674e24d5},{0x02c0021c,0x18a24a04},{0x02602d87,0x62a8f501},{0x0641fa31,0x1895ba56},
+{0x01a0a31d,0x8b9b5f85},{0x02a1697e,0xbb19f7bf},{0x0321e7fb,0x0eeca26d},{0x0401d8ed,0x7b4da36f},
+{0x04001fd8,0xf2519c49},{0x03a00100,0xe901be48},{0x01e00c2b,0xf40162f0},{0x02a023e8,0x02f18173},
+{0x0561d08d,0x12f8856e},{0x0421cf91,0xccad09b2},{0x02a16919,0xf82f9d1d},{0x03e02cbe,0x5875e77d},
+{0x02c02b2d,0xbdff0880},{0x03c12332,0x4a9a4850},{0x02601106,0xc8660b75},{0x0481d037,0xe17649e6},
+{0x0321e824,0xa353b907},{0x02c13047,0x7c189c1c},{0x0461079c,0xa6cbacf2},{0x02c1cf58,0x31bca2c0},
+{0x02201a0e,0xe325c22f},{0x0281ec79,0x355964c6},{0x02a0137b,0x89a3f4d7},{0x0361f713,0x2b1ad8cf},
+{0x01a0a4bd,0x5d1b7b90},{0x08202b81,0x7add83cb},{0x02c00448,0x245bac1b},{0x02801b0b,0x9edbbd5d},
+{0x02403264,0x63b04ff5},{0x02a018e4,0xadc2223c},{0x0381e11a,0xd6bf7124},{0x0301248a,0x835bf947},
+{0x00c02200,0x929792a3},{0x02a0308e,0x313bc371},{0x00c1f445,0xbcb3cc9d},{0x026002b9,0x099dab7f},
+{0x02e144ab,0x9b061317},{0x032121be,0x4d8000dc},{0x0580fd93,0x8c9ac880},{0x0300fbb5,0xc99c2bca},
+{0x0241e2ae,0x6b7926fa},{0x03401e31,0xd56ac2ab},{0x036029c5,0xcc8b241f},{0x02811d71,0xf28d0526},
+{0x0320fbba,0x2e6c5d86},{0x01c0a158,0x33574fa8},{0x01c0a92e,0xd3d52260},{0x02810d1e,0xadb856d3},
+{0x02812fc0,0x22f6f198},{0x02418a66,0x56ac1dad},{0x02e14483,0x160fcf14},{0x0320febc,0x1d833e61},
+{0x022121fa,0x8c685cf8},{0x02e13227,0xce70f918},{0x05a1d960,0x8fd643fc},{0x01e1f6dd,0x439e1461},
+{0x02416b65,0x300309ef},{0x020030c6,0x58c1101c},{0x0240aa94,0x14b627a4},{0x02c11d43,0x52eb9696},
+{0x02e132d8,0x55ccc2f7},{0x04000d5a,0x44df8028},{0x0440fc72,0xfbd09bc1},{0x01c1f397,0xcaa011a7},
+{0x022115b0,0xefff289a},{0x04c10155,0xd8f13bd1},{0x02202f28,0x84854a01},{0x03a10987,0x5a9d9009},
+{0x03e18be3,0x17ddd458},{0x04612465,0x54c8c85f},{0x01c0a05c,0xa7fee939},{0x04e001df,0xdc99cceb},
+{0x03a02ce3,0x0d8c48c3},{0x01601c7d,0xb685fa30},{0x022025fc,0xdc683e34},{0x02c130d4,0x0bce0249},
+{0x01816a41,0x4a2a29a7},{0x0301013a,0xe33c2fab},{0x0221081f,0x95d77db2},{0x0460fc9d,0xe942a27a},
+{0x044109e8,0x73c11deb},{0x01e1f5ee,0xfdd9fd9d},{0x028104cf,0xd8ccc202},{0x02601331,0x0a2cee2f},
+{0x02c11831,0xfb8040a1},{0x01a0a4ed,0x4df05e4c},{0x01e00631,0x2da7869c},{0x02601179,0x7b4c9a0e},
+{0x0341e86c,0x3e9021d2},{0x01a0a3ec,0xfa292520},{0x02418911,0x9e163728},{0x04a023c9,0x7f669c74},
+{0x01a10285,0x0eee27fb},{0x02210307,0x545f0c5d},{0x02418923,0x242481a4},{0x02210835,0xdbe324d7},
+{0x02816b0b,0x960a4929},{0x01a0a399,0x87432c48},{0x02e13221,0xd37100f7},{0x02811c68,0xb25c600e},
+{0x024016d4,0x19ae0d32},{0x02c133b1,0x8e139d0f},{0x02c02863,0xa89c0e08},{0x03216822,0x9aaad940},
+{0x01c0a36c,0xf3c27f27},{0x02e144a3,0x9b0851ae},{0x03e0a65a,0xc57b73c5},{0x02800e08,0x5b4108da},
+{0x0341e83a,0x6bb9691b},{0x02e02d18,0x19e5ca96},{0x03c1e143,0xd736b67c},{0x01e1110c,0xd09eb98f},
+{0x030008f7,0x177df6c8},{0x03a01157,0x2fc8ce5f},{0x0281692d,0x7862e66d},{0x0461f61c,0x1a0ccd2f},
+{0x02401356,0xff1cbd25},{0x0480fcdc,0xc409ad1a},{0x02001c74,0x09968051},{0x03604dff,0x085be928},
+{0x01a0a2e3,0xdc7767aa},{0x01a02044,0xbc7d3474},{0x0320ff83,0x40b633ad},{0x01e00c31,0xede791a0},
+{0x02a1091b,0x0b4f2ffa},{0x02602b03,0x995f953f},{0x03216e41,0x6a8551b0},{0x02210ff4,0x36647181},
+{0x02e122f9,0x8232b7eb},{0x01e009ac,0xdb43c8d0},{0x03802fbf,0xf028e4ca},{0x0220269d,0x2dfc305c},
+{0x0200fbbf,0xa3cb7cc3},{0x02e1d33e,0x83a96aae},{0x01e0a435,0xfc048033},{0x0201119d,0xa876b3b2},
+{0x02202d47,0x080a7e32},{0x0381cf61,0x782c2c92},{0x02e020e8,0xb4ea8c00},{0x052027ec,0x3448e2d4},
+{0x03c00955,0x77b03513},{0x032100e5,0xcd67f5e4},{0x01c0a231,0x6c182a15},{0x02e132e6,0x1794f995},
+{0x01e006dd,0x946773f0},{0x01602ae0,0xe85a3c35},{0x03c12067,0x5dc40862},{0x02e1462f,0xd8c44be2},
+{0x02401285,0xd508f34f},{0x04c1f669,0x99546a85},{0x02601319,0x08defa01},{0x02602ada,0x730df420},
+{0x03a1d671,0xd25875d6},{0x044029f7,0xb9994104},{0x028014c3,0x8c89f9bc},{0x0340015b,0xcb754e83},
+{0x06402917,0x00595e9a},{0x01c0a512,0x45f50d6b},{0x0221213e,0x132ce08d},{0x03a0159c,0x69a4556c},
+{0x03e1d753,0x0a1669e9},{0x01c0a32b,0xcd6da160},{0x03602c18,0x136b35ee},{0x020007e9,0x28c64b19},
+{0x03200282,0xc3b2c6da},{0x03200960,0x5a6aa3b0},{0x03c00486,0x40240f0a},{0x00e1f3b3,0x8e90771b},
+{0x01e01761,0x5cd2217f},{0x0200a9aa,0x3e59f396},{0x032120e7,0x8cadf372},{0x01c01788,0x6059cabe},
+{0x03a0a753,0xdc9fd6bc},{0x02e14550,0x7a95c330},{0x02a02d70,0xf3cd3115},{0x02c028d4,0x692d54d3},
+{0x02a003a1,0xd10a7914},{0x0281683c,0x39a2123c},{0x02e14445,0x2373351f},{0x02810ade,0xdca382d8},
+{0x03e1e01d,0x00d685bb},{0x03a1d59f,0xeb918356},{0x01811709,0xe7f511be},{0x0321aff0,0x9e342bd4},
+{0x02812fa1,0x1d017582},{0x03a1d049,0xf17bdaeb},{0x02418a03,0x43362f3d},{0x03a02cd5,0xb89c28da},
+{0x04610cdd,0xcf4f5dca},{0x02e14467,0x228f0a09},{0x01c0a93d,0x8515c2b7},{0x0261b061,0xb9207b98},
+{0x0320abde,0x10ec4e56},{0x02a0044f,0x49c51d2d},{0x03e03239,0x03cc8a10},{0x02402611,0xc0135120},
+{0x02010309,0x1f81319d},{0x01e02160,0x2e0ed22c},{0x0421d7e1,0x84c82925},{0x03010c39,0x30de75ac},
+{0x0101f926,0x3a3713cc},{0x05e1d8df,0xeded7ae5},{0x02c02425,0x56084429},{0x036118b3,0x72c47a56},
+{0x01c00b6b,0xaca51e9a},{0x036001ba,0x7c6dce9f},{0x02a03085,0x3119312f},{0x030120b4,0x13fb640b},
+{0x02812fa0,0x1b01725c},{0x03e12389,0xfad4e0ed},{0x01c0a3fa,0xa5545774},{0x03a120ec,0x94a7135a},
+{0x03610a75,0x0f715375},{0x0261d18d,0xeb1edc65},{0x0320ff91,0xdc7d3db0},{0x03c1f89a,0xbb6edcea},
+{0x02a1f523,0x7c57f04f},{0x0320ff5b,0x17ced6ea},{0x02010333,0x8a819cea},{0x0200304d,0x6c1b07ee},
+{0x0201fb19,0x2d27d24b},{0x02016ad9,0xbab5fb7f},{0x03c1248f,0xa56493d2},{0x040008fd,0xbb57925c},
+{0x0300ff01,0x9668a9fc},{0x0461d619,0xeba2fc4d},{0x01e0a1af,0x1072a784},{0x02600817,0x0e884f4d},
+{0x0441d71f,0x19777270},{0x01e00cb9,0x25222378},{0x03010a81,0x8b2347e7},{0x03000405,0xd13d2395},
+{0x02a003fa,0x63fda3c1},{0x0360a7c5,0xd129b86f},{0x02811d0c,0x2996273c},{0x0521d0af,0xb78cef50},
+{0x0201f395,0xc9c98751},{0x02c105b4,0xad151b61},{0x02401188,0xd2c6068f},{0x01602615,0xea4e8a2d},
+{0x00e02adc,0x02840edf},{0x032002cb,0xf4bfb92b},{0x02e00473,0x8f4163e9},{0x04c01d90,0xbe341e84},
+{0x01c0a338,0xd97cbece},{0x03e00116,0x8d9c6cd2},{0x02803047,0x3af56f34},{0x022013dd,0x320592f4},
+{0x0341228b,0xe7450c51},{0x01002684,0x37dffa37},{0x02c01d31,0xabe7ecaf},{0x02200598,0x3e8a42a7},
+{0x02802caf,0x2785415a},{0x01802a0a,0x7a5a16b2},{0x02a12249,0x8be2f5a0},{0x0261190d,0xfd33151c},
+{0x024104ee,0x4e87c489},{0x01a0a571,0xd11b4c85},{0x0261b048,0xc3eacc6a},{0x01800e8d,0x4b27e1eb},
+{0x0361e864,0x541f1bd2},{0x0121fab9,0xd072c450},{0x02416b71,0xfb97c08f},{0x0121f33e,0xaa407e83},
+{0x02c1333b,0x4fb71905},{0x01a033a3,0xda3174c7},{0x02002d67,0xde57a059},{0x03e18cba,0x6d89b782},
+{0x02816a0e,0x322cb5c0},{0x030100a4,0xe037e076},{0x0221f3c0,0xd1690d99},{0x01c1e2cb,0xa34c2e54},
+{0x0221bc3e,0xbb341311},{0x02e133d7,0xcbf8b59e},{0x0540fdb9,0x7ac87c9a},{0x034015e8,0x0767f8c7},
+{0x0341e8bb,0x83035b32},{0x03216e8d,0x532328f3},{0x02c02871,0x487ecb51},{0x01e1068a,0x503a1717},
+{0x02802799,0x76bd8736},{0x0341e7ee,0xd1e1d713},{0x0341d11a,0x97f14ddb},{0x03012411,0x26ae9af6},
+{0x02602f45,0x92ba85f2},{0x0360164a,0x7eabd5ed},{0x02e12132,0xfaea6f3d},{0x0341e7f6,0xd471d47d},
+{0x02600657,0x6e75e084},{0x01e10b1f,0x752f8f40},{0x042020eb,0x1acb8253},{0x01c0a2d0,0xfe019606},
+{0x0301d4c0,0x42a12982},{0x034024b8,0x4a65e5d6},{0x030016ad,0xe9cb6bbd},{0x01c1e2f6,0x8a8bc840},
+{0x0401f75a,0xd33b8c7c},{0x03e100ce,0xddd9d72b},{0x036002be,0xd6233421},{0x0301d4b6,0x48a132f4},
+{0x02610aeb,0x60275d37},{0x0621d9e4,0x1b45cb8e},{0x026008f4,0x8413ed15},{0x0261b04d,0xc4b93131},
+{0x0201010b,0x2f28ce11},{0x0401d083,0x2c4ac71a},{0x04210b4e,0xc8b251c8},{0x0461d60f,0xd1a2d35f},
+{0x02c1f06e,0x0a14f2e8},{0x0201f570,0x89d89614},{0x0420a701,0xc68724ee},{0x03016e66,0x9c3666d3},
+{0x02201fde,0xe38e2f19},{0x0361d509,0x07bc4342},{0x02800443,0x1a849832},{0x01602335,0xf9fa332c},
+{0x01c0a369,0xefc278db},{0x0261fa6d,0xef4c7207},{0x02e14465,0x248f0d2f},{0x02818d08,0xe8d150e2},
+{0x03810793,0x91093a37},{0x02e14645,0x5ebf0ea6},{0x0301d36d,0x4f00e7ba},{0x03c10b6a,0x4deaafe3},
+{0x02816935,0x2875f035},{0x02e00408,0x6c531bd1},{0x01c1049a,0x0b1c9666},{0x036006a3,0xc963b59c},
+{0x02e16b41,0x36e05af6},{0x03600191,0x489dea78},{0x04a0fc08,0xab6c3f02},{0x03e18b54,0x9dc883cd},
+{0x02e14464,0x258f0ec2},{0x0461da29,0x1d3809fd},{0x0240a74f,0x13815d1e},{0x01a000a9,0x1553714b},
+{0x03e10797,0x28701920},{0x03c1f1fd,0xa7243817},{0x02a16847,0x2995a885},{0x02c131b5,0xd3f7994a},
+{0x026e0126,0x28a64a8d},{0x0121f921,0x2863b68b},{0x02c1ed09,0xeb0d103b},{0x03002a02,0x00c04ef7},
+{0x02410fe6,0x962eca6c},{0x02418a0f,0xb32e90c8},{0x04601b72,0xa1ec6d5c},{0x0441f873,0xc0e58dab},
+{0x0261b053,0x46e10d47},{0x03a120de,0x57d3db45},{0x024189fd,0x3d3625cb},{0x026e011d,0x27a88791},
+{0x02c02d2d,0xe19b8632},{0x0221119c,0xdd3f28d4},{0x01e1d31d,0xcc2522f7},{0x05000fd4,0xcb0b4633},
+{0x04002e46,0x0e1d2cff},{0x0441cf1f,0x90dca7cf},{0x05a0fc49,0x13285f7d},{0x04a1d75f,0xc85e8187},
+{0x03202c4f,0x66e33304},{0x02a028a8,0x1219c3d2},{0x04a0a8f4,0xcde9e2f4},{0x02211599,0x7722c9b6},
+{0x02411ad1,0xb2847c84},{0x04001d8e,0xb5329a7c},{0x02a1104b,0xb5277968},{0x0261b097,0xe8d6be20},
+{0x0281f608,0x1ed5d451},{0x02211140,0x783f1be6},{0x01616a44,0xf550de0a},{0x026012e1,0x50eb651d},
+{0x032015c0,0x6016c34d},{0x03e018a8,0x81136f45},{0x01811433,0x28186688},{0x02411940,0x1dd84688},
+{0x026121b6,0x582aff87},{0x0301d461,0xbaca201c},{0x01c03156,0x4f233b52},{0x0201214d,0xfc9f8c59},
+{0x022023d8,0x9b49bef2},{0x02002e48,0x95b1e037},{0x04001d6f,0x1514698c},{0x02e00f1e,0x2c79f226},
+{0x01c1f91b,0xebd5e530},{0x02c133cc,0x870f14dc},{0x02e14533,0xfdae964f},{0x02800665,0x36f65423},
+{0x02418875,0x09eab257},{0x03a00489,0x2984d9ac},{0x02400932,0x18a99804},{0x0401d72f,0xd5b251b0},
+{0x02402f2e,0x7d803f95},{0x03a16825,0x9b54433b},{0x0341d20a,0x124da874},{0x02800f2e,0xfc37a5c6},
+{0x02403038,0x24bbb07e},{0x01c0a170,0x6609f0d8},{0x05a02a36,0x045921b8},{0x02010b12,0x69a8b859},
+{0x0141f6bc,0xf19185dd},{0x02c1339d,0x20be16d6},{0x0101f9ea,0xef12629f},{0x03401117,0xb28198ec},
+{0x02a1fb89,0x2562ee26},{0x0121f3ae,0xc1eff226},{0x01611404,0x66e2373f},{0x02c01a64,0x83f1e950},
+{0x01e026ee,0xe29d7205},{0x03e1d86e,0x183bc152},{0x0461d1ad,0xb6beca18},{0x0321171e,0xad1ed3d9},
+{0x03603227,0x8d2631bb},{0x02c02c97,0x83808c9b},{0x0101f43b,0x534de22a},{0x03e1d8db,0x928fa419},
+{0x03200865,0x297176fa},{0x0301d4b8,0x4aa1361a},{0x03c0fe71,0x7aad76fd},{0x0360018c,0xdb319b00},
+{0x01e10483,0xa5434552},{0x05a02bec,0x0561c1b1},{0x03a01e93,0x148d2f1e},{0x02e145c6,0x75efdede},
+{0x0580336f,0x93bb1f10},{0x02c019e7,0x8f93e353},{0x0181f3cb,0xf58b788f},{0x05600406,0x808addf3},
+{0x0180a2cc,0x8e5720b3},{0x030024d4,0x4fb6ac71},{0x01a11415,0xc8867296},{0x01a0a172,0xe79e329c},
+{0x05a1d0a3,0x65d5a5eb},{0x010033cd,0xbbb56634},{0x02216f86,0xbc606cf6},{0x04a006e0,0x525b5f79},
+{0x0300fb6b,0xf2abf82e},{0x01e0a917,0x42be3fb8},{0x01e00c27,0x21088b5c},{0x0240096c,0xf18c5368},
+{0x02a018c8,0x0eec5555},{0x03e18c2a,0x0e9f4572},{0x02610a16,0x3449d476},{0x01e00721,0x7cad3565},
+{0x06002ff5,0xd83ee3c8},{0x04601cc4,0xd93338dc},{0x02e145d3,0x7df22a0d},{0x0440020f,0x165c84d2},
+{0x03401641,0x1158fdfb},{0x038026a9,0x8b0b0e89},{0x02201825,0xb02ce6fb},{0x0381098e,0x79fc2931},
+{0x01c1182b,0xb71bc957},{0x05601f37,0x205af6f3},{0x032118a2,0xe5bb4548},{0x0341cfb0,0x3fa9c719},
+{0x01c006e6,0x48c51a36},{0x02c02869,0x350c514a},{0x02e10592,0x866cdde9},{0x05200c78,0x37f8ee29},
+{0x03a1d683,0xc4585fcc},{0x0320302b,0xeb0433b3},{0x02801347,0xe062715a},{0x030017a3,0xdbe8cece},
+{0x02e14456,0xaf76501a},{0x03e18b25,0x9cd54e2d},{0x02210805,0xadc898f0},{0x0380feb1,0x1a757657},
+{0x030124a3,0x727a6d0d},{0x04a0fcab,0xee99a3c9},{0x0660fd7b,0x6a843603},{0x0381e8c1,0xee2cbc55},
+{0x03e18c36,0xf79ce2a6},{0x01a0a532,0xeee3232e},{0x01c00b36,0x49544bd1},{0x02e14632,0xedc22e5a},
+{0x03a01cee,0xf7316a02},{0x03e18b1f,0xfbd21223},{0x01a102b0,0xd0f0c868},{0x0200fe63,0xf6231808},
+{0x02a01521,0x0dc3147b},{0x01a01744,0x2ff215ed},{0x0380250f,0xcc4d48b5},{0x02a01093,0x1d6cdc63},
+{0x0541d884,0x8ed14117},{0x02e13277,0x106bd9f2},{0x01a0a44c,0x8531e001},{0x01c1f3ee,0x442cd7c9},
+{0x02202f5f,0xd9197e3b},{0x01e005d1,0xfa005ed1},{0x0340fb85,0x30168cd3},{0x0200067b,0xfef2bad9},
+{0x02811049,0xee5ad6d1},{0x028e018b,0xf567c685},{0x02a0a8cf,0x52851b12},{0x02600814,0x31487611},
+{0x06e02b7c,0xdbb56dad},{0x02e010b3,0xd14b1646},{0x01a0a6df,0x4956c44f},{0x036121d5,0x432e1053},
+{0x03e1d7fd,0xbbc69b0e},{0x02a0abf8,0x2eb8ee79},{0x01e10670,0x4a28c484},{0x01c0a570,0xa2a51525},
+{0x02a168eb,0x82c98e94},{0x0401d21e,0x0541bbb5},{0x04c1d9da,0xe62b34c6},{0x0241894d,0x33836da7},
+{0x01e0339f,0xf9a1ca35},{0x03c111ce,0xf3abfd7e},{0x01a0a323,0x89c3fecf},{0x03a1cfa9,0x505fa88d},
+{0x03e1e008,0xaa4eda8d},{0x03002a4e,0xac681f9a},{0x03a1d88e,0x6a14846f},{0x0180a009,0x595b4a72},
+{0x0380013d,0x863c30e8},{0x04c0fcbd,0x1be1d491},{0x0160203d,0xa4340318},{0x0361d6a3,0x4606fa67},
+{0x01a02e86,0xba87ac86},{0x01a00b39,0xa3c25d0e},{0x0341055e,0xa0d62539},{0x02200c4b,0x5776fa9d},
+{0x03a0a78a,0xbe68e7da},{0x01a11422,0x896c5f87},{0x0301f04e,0x729fb796},{0x02400917,0xf88d8f27},
+{0x01e0a6ad,0x4c99a1e2},{0x02c1315b,0x3bbc14ec},{0x05e1da26,0xfcd83087},{0x0360165f,0x24b59e44},
+{0x03e02cb4,0xafd74fc4},{0x0280a8b6,0x313cc4d4},{0x03802cd0,0xc50d5afb},{0x02e1692e,0x617a0e4c},
+{0x0260aa9d,0xe454fbec},{0x02a003bb,0xbc8d0edf},{0x03e18c53,0x0c988687},{0x03812528,0xf39bfe53},
+{0x02c00433,0xab77359b},{0x01c02eb5,0xc04fb220},{0x028018d3,0xb18e5402},{0x03c1231b,0x03be7fdb},
+{0x02812fd8,0x9a0fb1d3},{0x01e11335,0xc2c898c3},{0x03a1205d,0x49bd717c},{0x03e0135f,0x1da0979e},
+{0x02a02861,0x4e207a68},{0x0220a9d9,0xc1393a5d},{0x02003050,0x98396246},{0x0161f78b,0xf5521b3e},
+{0x04a1d899,0xfd5c060a},{0x02201168,0xdbc8049a},{0x03a01154,0xf528d327},{0x0321193c,0x874ba782},
+{0x036015f9,0x3f787dfe},{0x02c10fbc,0xfe0a7d17},{0x02c1f0ba,0x1008bd3a},{0x02c13327,0x6d127782},
+{0x04402cec,0x6681b3ca},{0x01a0a033,0x301bdf8a},{0x02803041,0x36f568e8},{0x02c04dd9,0x746b262c},
+{0x03e00130,0x86c64c1e},{0x032100ef,0x4f6b0121},{0x028e0165,0x7f719a1f},{0x05c1d0e5,0x693f4838},
+{0x0661d982,0xdccdea97},{0x02202f09,0xc4675530},{0x0200099e,0x5018346f},{0x02211acc,0x1ee700e4},
+{0x03e18b23,0x96d544bb},{0x01e106d6,0xaebce6d3},{0x02602f57,0x73853597},{0x0501cf01,0x6c579570},
+{0x03610c84,0x9abff4e9},{0x02603260,0x670076ca},{0x01e1231d,0xa7d90eda},{0x03e1d56d,0x67f4fff7},
+{0x0301f05b,0x1582d313},{0x02a01587,0x8a4c7e3f},{0x0401d74e,0x7677d030},{0x0360297b,0x303f9af0},
+{0x01810e61,0x26023a5f},{0x0161fae0,0xa4b62260},{0x01c02661,0x2a50192f},{0x03a0a64d,0xf909072c},
+{0x01e0194d,0xef20d16a},{0x046121e0,0x868e2ccb},{0x048026e3,0xb1657f46},{0x04c001fb,0x3b07e8b9},
+{0x01e01c5a,0xd98aa41b},{0x016029cc,0x279cca5d},{0x02c1321f,0x78866c35},{0x02600d4a,0xebef3da1},
+{0x028169f2,0xf904498f},{0x0520fd51,0x97790159},{0x02c11d34,0xe18806fb},{0x01a1f38e,0x6d686de4},
+{0x03000f0a,0xb23727a6},{0x03601dd4,0x61081fe2},{0x02200c77,0xc7292fba},{0x03000db9,0x4ea2aa5c},
+{0x02802db4,0x07a83922},{0x0340209b,0x0acbf632},{0x01a0a35d,0xcc54bc38},{0x01a0a4e3,0x1e3946a3},
+{0x01002682,0x35dff711},{0x02418a6c,0xcaa902b2},{0x0281d1d2,0x9dd0a604},{0x01c0a933,0xb9100465},
+{0x0300feae,0x6a279f92},{0x01e02165,0xe77eeaf0},{0x01c16aa0,0xb8d4ba8d},{0x028021d0,0x1497eb3b},
+{0x02000029,0xd58c482b},{0x01802e38,0x506d383d},{0x0181e2a3,0x42bd2a53},{0x01e1fac0,0x0d9b2286},
+{0x0441f17d,0x7545cc4d},{0x01e10fe4,0x8e005d96},{0x04001e00,0x9ffbd755},{0x00e000b8,0xb5fe735d},
+{0x02412048,0x5e22b806},{0x0321d157,0x046308cd},{0x05a027b1,0xc8aa7d46},{0x04a0fc22,0x07d5152f},
+{0x0160229e,0xacfcc5ba},{0x03a1da3c,0x66e5b9b8},{0x03e1f56a,0x560a9d3d},{0x0561f8b1,0x54746bd8},
+{0x04400f19,0x33014edc},{0x03c029d0,0x02dfcd50},{0x0340fb99,0xdf28321e},{0x02e144cf,0x1f2364f7},
+{0x01e0a57c,0xf6c8ba1c},{0x02601404,0x38777782},{0x01c00bf6,0x356ba72f},{0x03202381,0xfc0616de},
+{0x02a00d57,0xa43f6c5b},{0x02610fc6,0x2403ec93},{0x030028f3,0x24dbddeb},{0x03600357,0x2dc4f917},
+{0x02e145b0,0xfa2aec57},{0x0561d8aa,0xbf5f2b1e},{0x02c13267,0xeeb0a6b6},{0x0320fb31,0xd4c684c1},
+{0x05e1fa3d,0xa8858dd7},{0x01a0a538,0xf6ec2a22},{0x03e0167b,0x1b45f614},{0x02611669,0x059c734b},
+{0x04e0fe30,0x670aa25c},{0x0481eef1,0x9070797f},{0x02e027c5,0xa1f1352d},{0x04a029e8,0x52f72426},
+{0x0341685c,0x4c367ecd},{0x01c01c1a,0x8ffc4f5a},{0x02c0317c,0x4a66b798},{0x0180a0ec,0x428a8472},
+{0x03000e45,0xcd56e4ee},{0x02402f72,0x188b7060},{0x03e1d5f1,0x7f05d57d},{0x04001fba,0x7b8b9e72},
+{0x0261f505,0x4edbd7ce},{0x02a0246c,0xa823880d},{0x0280ab70,0xc5ef0a07},{0x0281093f,0x6402f89e},
+{0x00a1f3f7,0x60dcecdd},{0x01e0a238,0x2ce32799},{0x02e00407,0x6029bae6},{0x02200323,0x38e362ad},
+{0x02802251,0x7c5faba5},{0x03801639,0x43527bb3},{0x0421d5ed,0x3e36b012},{0x02801076,0x307765de},
+{0x03610a9f,0x6e25de9f},{0x020013f3,0xd834a533},{0x03210c19,0xba6ee019},{0x04803359,0xbaa946cf},
+{0x02c1104d,0x86535ce5},{0x02a1f584,0x8deab521},{0x02e01131,0x176f4fff},{0x02a1bca3,0x1befc634},
+{0x03c1205f,0x0d1c5454},{0x02602705,0x460d292a},{0x024189c9,0x9fbe5558},{0x01e01000,0x085a6008},
+{0x0401da37,0xfd3af0ca},{0x03a0fe2c,0xd7cdfc73},{0x026118e5,0xbee7e729},{0x02e10b91,0x39bf46cd},
+{0x01c0a2b5,0x4a8b4326},{0x026104f9,0xe69bc0e1},{0x02801d50,0x638c751e},{0x02002464,0xfb40b5a0},
+{0x034000ed,0xf502f629},{0x02c13340,0xccba1c63},{0x05a0fbf1,0xfecbf169},{0x0241fbf4,0x00d7926c},
+{0x01c16f2e,0xce496da1},{0x02e003a9,0xa12c336c},{0x05e1d820,0x8c976a91},{0x02a02e84,0xe481f41f},
+{0x01e00853,0xb5b58f4b},{0x0461e139,0x5a52bd1e},{0x036006fb,0x25f00522},{0x0601fba3,0x90c7e542},
+{0x0221f69f,0xb3469ceb},{0x02a01160,0x396addda},{0x01c1f3e2,0x6cf75569},{0x02416ad0,0xbf28abc6},
+{0x03a1098f,0x0af48fb9},{0x036015d3,0x90bb8647},{0x01a11718,0xc06abcbd},{0x0280133b,0xc21d7717},
+{0x01a0260a,0xadab95a9},{0x03e1d5f5,0x7305c299},{0x02e00e20,0x6396928e},{0x03210139,0x7b33f2d0},
+{0x032100f9,0xb9611aa3},{0x01802218,0x16e0fe2b},{0x02c1304f,0x841ae74b},{0x02012044,0xfc49782f},
+{0x022009a2,0x2cb86836},{0x04202b78,0x86ba9119},{0x02e10c22,0x5161ad1b},{0x0480fccf,0xb3e65e49},
+{0x01e1fbba,0x02b641b0},{0x02c01d38,0xb2e7f7b4},{0x02418984,0x26902523},{0x02a168e2,0x506fd313},
+{0x028e0164,0x8471a1fe},{0x0321237e,0xade90671},{0x01e01706,0x84467de3},{0x02c13305,0xcb3de8a9},
+{0x0260a80e,0x375c4acd},{0x01c02198,0x17a885e8},{0x0320291c,0x4fcfe050},{0x0380015a,0x74618b0c},
+{0x0400255b,0xedc2e8cd},{0x03602ef0,0x498f93c3},{0x0521d82a,0x5b409d7e},{0x02000c20,0xec36cb1e},
+{0x02e0051c,0x982402e0},{0x0260005a,0x581505d3},{0x01c1f975,0x33f034fd},{0x02c02a5f,0xdef8cd96},
+{0x038025b5,0xf7c74908},{0x02e1f71a,0xbaf33e61},{0x030016c8,0x85a9f180},{0x0341d209,0x134daa07},
+{0x00a1f5ff,0x63b288a2},{0x02c0abb8,0xd6354125},{0x0121f5cc,0xc342c9f5},{0x03e021bc,0x57b6d295},
+{0x04402526,0xb6dfaadb},{0x0341e80e,0xa2101497},{0x04e027a8,0x6c51a84b},{0x02811d28,0x3d75f30d},
+{0x01a016af,0x15904806},{0x05c1d840,0x27f546da},{0x0240092a,0xf0643488},{0x03a1ecaa,0xfba1cc96},
+{0x02e1d160,0x98c5fcbc},{0x01c0a367,0xf881dfb0},{0x01a0a1e2,0x7dff0611},{0x032101e1,0x3e728d5e},
+{0x01c03158,0x5f45e6c4},{0x0521d0bb,0x9c96debd},{0x01e12326,0xa6d90d47},{0x01a11431,0xdb587266},
+{0x0201fa71,0xb2b9c8de},{0x01c02193,0xee501b69},{0x01a027c2,0x4c47dfb3},{0x03802360,0xad2a0511},
+{0x03401613,0xe7567d46},{0x02802170,0x2c6af273},{0x00a1f361,0x7faefbd6},{0x0340ff46,0x0fe0eb6d},
+{0x0261b05b,0xbff9d0a8},{0x03a1d5a8,0x557bb498},{0x0201121c,0xeebd0748},{0x01a0a02f,0x703a595e},
+{0x02418805,0x7c7fc707},{0x01e10677,0x4b2b04ae},{0x02816e84,0xe259d3ea},{0x03e18b37,0x9ad7899e},
+{0x0441f161,0xeb4f5b02},{0x03e0277a,0x8d61ef0a},{0x0301d800,0x522e026d},{0x03800355,0xf4ee9a7d},
+{0x0320fb30,0x2c3f0dd4},{0x02e16f9b,0xf623138d},{0x0200311e,0xb7902d46},{0x01a01968,0x0ba783d4},
+{0x024188ce,0x211333ca},{0x0261fbb3,0x23258a4d},{0x0141f3a4,0x79e01e89},{0x02a00566,0xa7993750},
+{0x02002ea4,0x41cb8269},{0x01a11417,0x02d49349},{0x02c028b1,0x417ec04c},{0x02c132db,0x4f47b2d1},
+{0x01a02bd6,0xea37daaf},{0x0520fdaf,0x7686dcd9},{0x03210847,0x69cb325f},{0x04800f36,0xac92b421},
+{0x03810990,0x4601e783},{0x02601bed,0x89230924},{0x0121f3ce,0x7b35a203},{0x0180a4e6,0x82f0f0fd},
+{0x03601efe,0x28a8ade0},{0x0701d990,0x7663cfd7},{0x02811d65,0x1288ba58},{0x04e1d940,0xad2d94ec},
+{0x0201112a,0xf2f09deb},{0x01c0030c,0x43df57a4},{0x01a01791,0x4ad134cb},{0x02e168df,0x3cbb0017},
+{0x01e1f022,0xedda736b},{0x02e02bbc,0x8b117a7d},{0x01e0a097,0x0547d0ca},{0x02800d93,0x26836c0c},
+{0x022009c7,0x52475376},{0x01c0a088,0xd2803232},{0x0201f93b,0xbb3db9b3},{0x02c130e7,0x16d05231},
+{0x01a01908,0x26c1b249},{0x03c01fd0,0x504d6f62},{0x02a105b5,0x681cec12},{0x016007db,0x97739047},
+{0x0201fbbb,0x8416a622},{0x038003ae,0x4d3e5919},{0x0360aa7f,0xebe48205},{0x02a0ab91,0x3931e689},
+{0x04a0fc2d,0xf0cd3051},{0x02e032b8,0x97417d86},{0x02801473,0xd62f2cd7},{0x02c13352,0xddbc75bd},
+{0x0621d090,0x3c07ec5a},{0x03400970,0x1758f9c6},{0x0380fd47,0x7561c261},{0x0441f153,0xd54f3860},
+{0x048004ac,0x7bf387e8},{0x04201ddb,0xa5328fb5},{0x02001a76,0x1730fbe0},{0x0101f4d3,0x38d462e0},
+{0x03e0106d,0x1111bccd},{0x02a16926,0x6a16dc5e},{0x02a030fd,0xafde7633},{0x01a0a182,0x615a49c5},
+{0x0301f050,0x709fb470},{0x01a0a599,0xd6e0becf},{0x01a1162c,0xfaa9c1c3},{0x02a10a0f,0xfbd4af52},
+{0x024029b6,0xae5ad796},{0x0560259f,0x5e9b51f0},{0x0360fb68,0x91800bbe},{0x02812fd2,0xa00fbb45},
+{0x0520fdb0,0xd88e44a2},{0x03010c20,0xfeeb2161},{0x02e1454f,0x7b95c4c3},{0x06c1d971,0x5dc8c423},
+{0x04802ae5,0xa309b6c5},{0x03c0189c,0x946137f4},{0x02e14614,0x7b012fde},{0x026119cd,0x07a92e99},
+{0x01c0a563,0x7fe1b777},{0x01e10509,0x59a73eb8},{0x0621d9a6,0x739067cc},{0x0481d78b,0x85f3cabc},
+{0x0240299a,0x85165cd9},{0x02e11af4,0x2e5b5ba4},{0x0261b08a,0x7af4260a},{0x0300ab60,0x974c79d8},
+{0x02c1300d,0x8f1f75ca},{0x02a0aae5,0x3955317a},{0x02c12386,0x4448f535},{0x0240120a,0x00eb237f},
+{0x0440fc94,0xbb0c03ca},{0x02a168a4,0x3edb5190},{0x0481d84c,0x9304e847},{0x02200062,0x23575e1e},
+{0x03601dd6,0x5008051f},{0x02000b40,0x020deb71},{0x02e14487,0x0a0d7d99},{0x0301d45b,0xb4ca16aa},
+{0x02200653,0x18e543ff},{0x0361f657,0x200d3eaf},{0x02a1da16,0xf3a66cd2},{0x02c02a51,0xb23c237d},
+{0x0340ff50,0xf9e0c8cb},{0x03002fa4,0x848b3ab2},{0x0461d9a5,0x2bb01862},{0x0241883c,0xfd8e09a4},
+{0x02402f0b,0x11cce69c},{0x01a00725,0xc5aa93cf},{0x02e00555,0x1f81a041},{0x01ee0040,0x72d3554c},
+{0x0261b055,0x44e10a21},{0x02c13269,0xf0b0a9dc},{0x0421d78f,0xf57c27e7},{0x02e14604,0x78feee21},
+{0x0381e011,0xa621064c},{0x01602306,0x90745f35},{0x01a11654,0x771d846f},{0x04c01e18,0x26229469},
+{0x0481246a,0xbfe1e09f},{0x04202b37,0xe81e474d},{0x02401cf8,0xda1ff6d3},{0x01e00eab,0x80806de5},
+{0x0421d1e1,0x500afc94},{0x03212241,0xe44b4b70},{0x02c132d2,0x4447a180},{0x01e1046d,0x36ced322},
+{0x02202633,0x5d6fdf26},{0x00a0264e,0xf171b921},{0x03410f25,0x2239f57c},{0x03801db3,0x620b68d3},
+{0x03e0a709,0x876e2f19},{0x02e027d3,0x28761e44},{0x03c122aa,0x63825ad5},{0x01c0a1b6,0xba4fc990},
+{0x01c0a19e,0x903bffba},{0x04e02a82,0x68f92375},{0x03000fa8,0x1287e323},{0x01c0a05f,0xc3129b72},
+{0x0241d32a,0xba0ce0ea},{0x03e18c38,0x019cf264},{0x02e0ffd2,0x65952d85},{0x0341f7c0,0x7b38d75f},
+{0x02a16959,0x1ab610cc},{0x030020e2,0xe859e52d},{0x032120f9,0x1f084d12},{0x02418a70,0xc6a8fc66},
+{0x03000739,0x0d024fa7},{0x01c01721,0x650bc6fc},{0x0241e934,0xaa19616f},{0x026012ab,0xd751726b},
+{0x01c0a52b,0xb470dd64},{0x00c1f52b,0xceeff9d6},{0x02816e89,0xa7aebb02},{0x04a1d938,0x63bb554d},
+{0x03e004ff,0xc5a1e5b4},{0x02201b92,0x94ad76ac},{0x0201bc5a,0x45e0760f},{0x02a1059e,0x67f20b0b},
+{0x038009f7,0xb5e9ca7d},{0x036168ea,0x80d4c866},{0x02a1043e,0xfdbb0c04},{0x02003055,0x74573eae},
+{0x0241d1b7,0x1a930e7e},{0x02c13094,0xaf28a0b8},{0x03a1e001,0x2c6e50f5},{0x02c01d9e,0xbc2f837a},
+{0x0301d368,0x9e7768e4},{0x03010b90,0x8bec2e23},{0x03611c35,0x2310975b},{0x01c03160,0x5f235482},
+{0x02402f0d,0xb6c6ec5c},{0x02e03259,0x2d846e03},{0x02400a3f,0x7e5d1d1c},{0x024189be,0x1ec15bdc},
+{0x0221f0e1,0xbef80500},{0x02610868,0xa903b773},{0x02c133a1,0x24bbde8b},{0x01e10b11,0xa95b6dba},
+{0x00e1f492,0x5a6e14d7},{0x01c16f5d,0xb4f31878},{0x02011285,0xfc70d9eb},{0x01e01c45,0xd07d32f1},
+{0x03401dee,0x2f1b6d30},{0x01c0a388,0xdb9cfaea},{0x03c02aa4,0xddc24943},{0x0341d085,0xa351434d},
+{0x01c00303,0xdb11d4c1},{0x04210b3d,0xddd09db7},{0x01e1132a,0xa6d77739},{0x034023e1,0x90e6c443},
+{0x038002b1,0x5c35c836},{0x02418a80,0xbea472a0},{0x03e18b14,0x0dd22e79},{0x03c1d46a,0xf122ffef},
+{0x01e0a41d,0xe7746803},{0x03e18c69,0x7e956866},{0x020030c4,0x48c0f6ec},{0x02012360,0x8f505702},
+{0x02e0287c,0xd3768195},{0x03800afe,0x3dcd7c99},{0x02c1011a,0x35392aab},{0x026e010e,0x2097336b},
+{0x03011343,0x8193061b},{0x02e144c6,0x05fe6cc3},{0x02e00e06,0x3a77b768},{0x03c1e017,0xa20179b0},
+{0x02c01d41,0x9be7d37f},{0x0280148e,0x534c023b},{0x03e01ef4,0xf14d4e4e},{0x03e18b7b,0xb7cd29e9},
+{0x0280132c,0xa77d918d},{0x02c01d35,0xafe7f2fb},{0x02a1ec7f,0xa1813615},{0x020003f0,0x4b3418ee},
+{0x02c00904,0x4e826f26},{0x02412244,0xbb73cbfd},{0x02e145bb,0xf728a907},{0x01e10669,0xbd303552},
+{0x01c00bb1,0x76e18173},{0x01e10e94,0x67170ac6},{0x0301d363,0x128b1cb0},{0x02a1ed0a,0x23d5787a},
+{0x02418a3e,0x443aadfe},{0x0260096a,0x3e502dcc},{0x04001d6c,0x2d5585f7},{0x03801db9,0x4b566694},
+{0x01e0101c,0x305cdd97},{0x03c01d67,0x9f999588},{0x0461016f,0x9e012ac7},{0x02e10589,0x5e83f840},
+{0x01e12020,0x890a7ad9},{0x0221f5e9,0xf8a1a60d},{0x0281e918,0x62d54882},{0x02c13381,0x2cc06851},
+{0x01e1e2f0,0x103d382a},{0x04c1d03b,0x1cde5e5f},{0x02e144e5,0x8ba72714},{0x02a02d0d,0x0424ede7},
+{0x0181e2a0,0x62b50dee},{0x0421d5d9,0x5236cf8e},{0x01e1172a,0x2a707ec6},{0x02c01b82,0x32a97d46},
+{0x02c1d15d,0xcd17c308},{0x02e016e6,0xa38a02cf},{0x04a1230e,0xb86ca290},{0x01e116c3,0xc2e428ed},
+{0x03e18c56,0x07987ea8},{0x03402c35,0x20000d99},{0x02c130b8,0xb02ae0e2},{0x0221f6b5,0x1c026cb8},
+{0x0461d782,0x0c3bc1e6},{0x02c132f2,0x59434561},{0x0301f03f,0x50ce531f},{0x02e1691c,0x1438224b},
+{0x018033a5,0xe22a63b8},{0x028101e4,0xbbebdceb},{0x02c1303a,0xfb1353db},{0x0440ab3c,0x516f9753},
+{0x03c01d32,0x5cf53659},{0x04202959,0x3876350b},{0x03014429,0x1990f41f},{0x02a01855,0x2dd582a5},
+{0x0481d89d,0x9640de7c},{0x02418adc,0x6c1e9ada},{0x0281694e,0x4c1ab0e8},{0x02c13386,0x29be2501},
+{0x0660fc00,0xfa75ddbc},{0x02010467,0x4189fc70},{0x030016b1,0x0160edec},{0x01c00e8a,0x29fe039d},
+{0x02e1cf70,0x6150e20b},{0x02a02f82,0xd909e40a},{0x02c169e0,0xa884cfa9},{0x02812fcf,0x17f4a1b0},
+{0x03c1f231,0x8b4abcfd},{0x01e1f78c,0xfa26d391},{0x03e18bb9,0x11ea96d9},{0x0340036e,0x351b76a2},
+{0x01e16ae8,0xec60fcf1},{0x0280328a,0x294240bb},{0x0320a69e,0xf59de113},{0x0361d6a1,0x4806fd8d},
+{0x0321f83e,0x6bc7a12e},{0x0321d52f,0x1ea1936f},{0x02200d38,0x264279fc},{0x02a1da41,0x8dcebb3d},
+{0x03812175,0x4cfb2733},{0x0480a7a6,0xefdaf82a},{0x02c16b8f,0x85787a17},{0x02e13363,0x106ee033},
+{0x01e02bd1,0xf99e48f6},{0x03e0083d,0xf9bf84dc},{0x02001a0c,0x7b1b914d},{0x02400d27,0x283fd47b},
+{0x01811704,0xf4066dc3},{0x03200f9e,0xd9d4d26c},{0x030008ce,0x0cfc281c},{0x0420037c,0x73e0c432},
+{0x01e029c6,0xf2ca554a},{0x022026e7,0xa46e3ba7},{0x02000b48,0x2221a589},{0x01e1f3f3,0x09fb5fb2},
+{0x02a00e16,0x6c6dfd75},{0x01a0a0ef,0xa613b340},{0x01a0a200,0x972eb171},{0x03e0017b,0xca553a77},
+{0x03410c80,0x2e43339c},{0x01e11184,0xd11a4889},{0x01e01c4d,0xde8c2a5f},{0x01c1f460,0x2a727b31},
+{0x02a0ab86,0xff2d0e0d},{0x01c1f6d0,0x911739d9},{0x0641d9d1,0x0023dbec},{0x01c16f24,0xdb376127},
+{0x04200377,0x90377021},{0x0340fb55,0x3e866fab},{0x02611c3a,0xf779195b},{0x01c11103,0x5b829782},
+{0x01c0a2f2,0x89ad2a85},{0x02411303,0xdce2799c},{0x04e0276b,0x3d787967},{0x01c10b00,0x19d8b080},
+{0x02602b05,0xf98e0caf},{0x024188e9,0x0e0c5a1c},{0x04002a7c,0x4af2ec60},{0x02600385,0x0a673f16},
+{0x024104f0,0x0e7a93d6},{0x01e1235d,0x8bf93671},{0x02010802,0x60545458},{0x032010af,0xf5c27014},
+{0x01a102aa,0xbef0ac12},{0x03002b46,0xbdbf50c6},{0x02a01054,0xa972ad2f},{0x01e10482,0xc902d6a8},
+{0x04211a09,0xd5485317},{0x03401e55,0xf2f1f83c},{0x03010a9a,0x85508a5f},{0x028e0174,0x786d11ec},
+{0x02a02883,0xc516a861},{0x04c02ba9,0x8620f229},{0x02000c99,0x48b92f5b},{0x01e11723,0xee83a80a},
+{0x02610a11,0x8a69e0de},{0x0201047b,0x7ca49cce},{0x0421f723,0x92d92d2c},{0x02c105a4,0x77bb9c64},
+{0x04a1d01f,0x4f638f94},{0x01a00b67,0x6fe7cb4a},{0x02e10d10,0xb0da46ab},{0x0260aa9b,0xa481b6ca},
+{0x02c13125,0x6b0f40fa},{0x02a16a30,0xf09f5caa},{0x034002ff,0xc8b5bf6c},{0x03e18bb0,0x18eaa1de},
+{0x020103b5,0x82c4473a},{0x0320251b,0x7bd761d3},{0x03e18cb3,0x7b89cd8c},{0x01200030,0xe6ac2a14},
+{0x03800d59,0xdc1a5b15},{0x0261e913,0xa99d8b4d},{0x02a01084,0x7489a817},{0x01a1f332,0x0b7d65fc},
+{0x02c12162,0xa81eb19a},{0x03e1014f,0x5e64be6a},{0x02a1bc99,0x20597b02},{0x05001f43,0x43b3986d},
+{0x028012c0,0x1917c477},{0x02a16851,0x4c527a5f},{0x02400ccb,0x23dc35af},{0x024188d1,0x1610e3e2},
+{0x02a1e90d,0x0ed35065},{0x02c01d30,0xaae7eb1c},{0x02011195,0x31d6b1df},{0x02001013,0x7a3a303f},
+{0x032124c7,0x95ae019d},{0x026014ef,0x14b7e62c},{0x02010625,0x2b287b77},{0x02410893,0x23bf932b},
+{0x01600eaf,0x285a22c8},{0x0461f92c,0x3c820207},{0x03401642,0x0b58f489},{0x01a11823,0x0e63778e},
+{0x02e11d94,0xe0ad41e4},{0x01a0a202,0x8f2ea4d9},{0x0241d335,0x4ea6b3fc},{0x046025a7,0xdcbc5216},
+{0x01803304,0xe418be26},{0x022013e4,0xde08e04f},{0x0401d739,0x2dd4a399},{0x02201371,0x71634ffd},
+{0x0201063c,0x1921a35c},{0x01e01a37,0xf5c93e8e},{0x01c1e2c6,0xb72bfa25},{0x0300053f,0x984c2ce0},
+{0x0340ff5d,0xdc2545e1},{0x02001823,0x507e85bc},{0x0141f57a,0x9953da9d},{0x022122fa,0x304aa6d4},
+{0x020114a6,0x5b776a9d},{0x0320fbc1,0x47156566},{0x030032b3,0x3e1fedc5},{0x04c1078f,0x6e299ce8},
+{0x01c00bf9,0xaae0b618},{0x03a1e111,0x8bef2696},{0x024005c4,0x46b0d554},{0x01c0a096,0x5309121e},
+{0x01e0310c,0x7ff9f94c},{0x03a1d917,0x0b9d41bf},{0x04c0fc45,0xd5ec918a},{0x03c0d7d8,0xb76457f1},
+{0x03a1e120,0x110c620d},{0x04a0fc14,0x6a8118c0},{0x02611c32,0xe178f6b9},{0x0340021f,0x9428b70f},
+{0x03210bab,0xebd9fde2},{0x026100b0,0x524ee9f3},{0x01c0a37c,0xd76b57d2},{0x02200ca2,0xabc0f7c8},
+{0x02610f7f,0x4b56f28c},{0x03600670,0x770112f5},{0x02a16835,0x28a2cb83},{0x02ce004b,0x683c5e32},
+{0x0280fb02,0x55fd4a0b},{0x02a0125b,0x1758d8e0},{0x03c01f00,0x05c2e079},{0x040000cb,0xaacf1387},
+{0x0460fcbf,0x846b681e},{0x0181f588,0x0dc8feef},{0x02a1000f,0x2e6cc6d6},{0x03e18c30,0xf99ce5cc},
+{0x02a11d0d,0xc875aad2},{0x01e009b8,0x97682e9d},{0x03000d5f,0xa8c2b33d},{0x0441fbc2,0x654c9dae},
+{0x03c02c0e,0x81f507b3},{0x0641fa30,0xa76c53b0},{0x05001f6b,0xd2e4d1aa},{0x0580256a,0x674c9669},
+{0x024188e6,0x0b0c5563},{0x0261b025,0x45501b30},{0x01e16ab4,0x46283c01},{0x020013e9,0xf01b3315},
+{0x02211837,0xd03b6892},{0x03c0249f,0xfc012898},{0x046027bb,0xe676f2bf},{0x01a0a550,0xcaf1f50c},
+{0x02e120df,0xb0dd928e},{0x042109e3,0x4b946f5f},{0x0481d8f7,0x6a85bb39},{0x05e1d962,0xd85ea085},
+{0x02601112,0xd1eedda5},{0x01c16aad,0x90d23cfe},{0x02011596,0xa3ecbea6},{0x044109ff,0x1c92eac6},
+{0x0261089d,0x6e26c106},{0x02c0059f,0x6aaceb9e},{0x05a1fa35,0xf8e7d3fd},{0x040032c4,0x472aa3d0},
+{0x03800128,0xef9b81a4},{0x03c10166,0x0f8162ce},{0x0581d0e4,0xd421faeb},{0x0401d77b,0xd2185005},
+{0x02c1f61b,0x11f0da30},{0x03c0294d,0x318edabc},{0x02e1236f,0xe67fcea1},{0x02a0ab7e,0x053611db},
+{0x032121c3,0x2d76d420},{0x02418a56,0x34499f58},{0x03a1f8a3,0x44927312},{0x0260fb28,0xe3b37a50},
+{0x03e18cd4,0x7685487f},{0x0380ff28,0x51ecdc2a},{0x0381d6aa,0x38817bd3},{0x014020ae,0x7a78a0ee},
+{0x03e000ee,0x7ab427e1},{0x01a0a5c3,0xd11490c0},{0x0301f6c8,0x9dcb482e},{0x03402df1,0x151b708a},
+{0x03c00da2,0x27ed9060},{0x04a10b7f,0xa1255190},{0x04002351,0x61eae314},{0x02e011f0,0xea690a8d},
+{0x02c02d09,0xff65341c},{0x01a0330d,0xcb7c8d3f},{0x02800820,0xafe16835},{0x0340081b,0x95980bbf},
+{0x0321680c,0x0bbfabc5},{0x02816b0e,0xb23601db},{0x01a0a61c,0xa4679744},{0x03410533,0x7323f53a},
+{0x0221123b,0x2c8bf9b7},{0x02c13348,0xd4bc6792},{0x0441f870,0xdd59a102},{0x02612015,0x09818282},
+{0x02010503,0xf1813a95},{0x0421d631,0x4ab1f002},{0x02801382,0xebc5b126},{0x02e1458a,0x6b349896},
+{0x0180fe4b,0x347ff0c8},{0x0300a974,0x5f722d70},{0x02c13134,0x6c208bae},{0x020013b8,0xab050027},
+{0x01c01953,0x730e1632},{0x03e0ffac,0x6ef52db1},{0x01c00b1d,0xea9f5ffe},{0x0260aaa7,0xc45946ba},
+{0x032122b0,0x4c17848e},{0x0301d4c1,0x3da121a3},{0x0280133c,0xae12ca3f},{0x02001c6c,0xdd355bbb},
+{0x02418ab1,0xc197ab66},{0x01e11326,0xaea5e705},{0x03201d1d,0x16de681a},{0x01e00741,0x789e5d0b},
+{0x03210a7b,0x84a4b745},{0x036015f6,0x41788124},{0x03402fb1,0x23b6a230},{0x04202533,0x82f494d9},
+{0x05e1fba2,0xbda6786d},{0x03a01d66,0xc762f559},{0x0341cf2b,0x260004b2},{0x0300aa43,0xc7081ea7},
+{0x026e013b,0x15a1af76},{0x01616a61,0x73742ff0},{0x01403012,0x52798d13},{0x02e1f714,0x5ca911bb},
+{0x02801467,0x1c77e4a3},{0x01a02444,0x160bb906},{0x0241f0f2,0xd8703728},{0x02011a6a,0xacff75a0},
+{0x05e115cb,0xb10dba48},{0x01000031,0xfb87bede},{0x03010084,0x85ff53e7},{0x02c1e917,0xc83611cf},
+{0x02e133f0,0x99639513},{0x02212390,0xa558f138},{0x01e1068b,0x4f3a1584},{0x0341d21b,0x7c43c1f6},
+{0x03c02a31,0x9cb28a59},{0x024189fc,0x4033ebed},{0x05e1fa41,0x7842b50b},{0x0160270d,0x24b05926},
+{0x03c1d4e3,0x3ee986e1},{0x036011d7,0xf19b5bac},{0x024189ff,0x3f3628f1},{0x0180a3fe,0x4a83d545},
+{0x02e1687c,0x29af3771},{0x02001c55,0x42fa7fc9},{0x05a1f244,0x4fe10656},{0x0141f5a4,0xe1e946a8},
+{0x02201c57,0x81c1d5c2},{0x030024e4,0x5fb6c5a1},{0x02418ae2,0x621e8b1c},{0x02e12183,0xbe389aec},
+{0x0460309c,0x0901250e},{0x01e01c52,0x40bb6e45},{0x00a1faac,0xb3dda791},{0x0461cf39,0x4839da7f},
+{0x02802f3a,0x7b1515f4},{0x01a0a59d,0xeb14b9ae},{0x0440fce4,0x6e1f1094},{0x03804dc0,0x68df27b6},
+{0x02c13293,0x01b78064},{0x02e14506,0x79a28d90},{0x024023df,0x50e9e5d1},{0x02811c2f,0xe19e589c},
+{0x02801596,0x9278ba0d},{0x00e1f454,0x2ee702ec},{0x0281d1b5,0xf28a1d1e},{0x02a0037f,0x176022a3},
+{0x02800301,0xa0c29ad1},{0x0300a72b,0x5ba990ea},{0x01402237,0x425a9dd7},{0x03400129,0x7079629b},
+{0x05002a98,0xcaf97ada},{0x0260131d,0xf8dee0d1},{0x01a0174a,0xebfe76d4},{0x02e13258,0xed80306b},
+{0x026110e4,0xb045716e},{0x02801344,0xd87a69a8},{0x03000fb1,0xca6aefb7},{0x0120003b,0x533c86fe},
+{0x03610ca0,0x87bfd700},{0x0441d78e,0xb2114c13},{0x0341e846,0x1c54d5ab},{0x0601d99e,0xf81d738a},
+{0x0341698f,0x24240ee2},{0x02c1f4b5,0x48511b48},{0x01811456,0xc244a3bb},{0x0321d207,0x5773bfe2},
+{0x02c021ab,0x73f69f26},{0x038008d8,0xfd83e39a},{0x01a0a1d7,0x8bb410ec},{0x0101f352,0xafb8988c},
+{0x0261b056,0x43e1088e},{0x0561f81b,0x4b72a466},{0x0321251e,0x5fb15977},{0x02211172,0x98447eef},
+{0x0281f846,0x3de6964c},{0x032107b6,0x47dcd29c},{0x03e1ed2a,0x82c2532c},{0x02c02d1a,0x069ae7a4},
+{0x032018d6,0x0e3e3a12},{0x03c0ff60,0x3cd62ba1},{0x02011c02,0x1fd79cad},{0x0261191e,0xbaf103b9},
+{0x03e004e1,0xd8c6c5d6},{0x028021d8,0x95c8c163},{0x03a004c4,0x7563a4dc},{0x02812fb5,0x1ef26e1e},
+{0x03a0fa89,0x254cb358},{0x020013b6,0x9204d8cc},{0x02e10100,0x9c968dad},{0x02c11d17,0x6a5a79bf},
+{0x03011fc4,0x3d572965},{0x024189ce,0x2ac5ebee},{0x024111bd,0xdae82c7f},{0x01c11084,0xdc42ead5},
+{0x02a0144d,0xcedf5795},{0x02211060,0xd7dbaa12},{0x0140269c,0x6a060192},{0x02c114bf,0x4d1214b8},
+{0x02e1008c,0xd15da7e3},{0x01c0a1a1,0x8c3bf96e},{0x028e005b,0x9d74518f},{0x0340a97a,0x1b11d1ea},
+{0x0360fb46,0xe8cd1c85},{0x03c03019,0x2d8b9aef},{0x01c02281,0x627186f7},{0x02e0a781,0x7179907e},
+{0x02c101e6,0xc0a1c260},{0x07a01f9f,0x037acb26},{0x034121c6,0x2298d919},{0x028019fd,0xbe327b93},
+{0x01e10e9c,0xff641823},{0x0201211e,0x6cfe64b0},{0x01c0a156,0x506b0507},{0x03211c97,0x04e4efe8},
+{0x030014bf,0x2a94af21},{0x02010477,0xbe7690aa},{0x02a16b58,0x8deb5ee5},{0x03200fb4,0xbc074225},
+{0x0320ff7e,0x00aa95fa},{0x02811aa1,0x54b5214b},{0x03002a19,0xafc4d62c},{0x02c1d30d,0xa5e1c167},
+{0x02a1691b,0xa2aae2aa},{0x0541fa4d,0xfc286e31},{0x02e00822,0xee1a0cc4},{0x0201fb95,0xe4ae3d5d},
+{0x01a02731,0x84f3fb4c},{0x02a03096,0x4544dd49},{0x03c1d01d,0x4165392d},{0x02a00c01,0xf563288b},
+{0x02a11da9,0x9118423b},{0x0441fbb8,0x79d8043f},{0x0521d7ad,0x8563ca1b},{0x02a0a99f,0x181e73a4},
+{0x02c0ab62,0x2d829a38},{0x0340010d,0x37aee8cc},{0x03200553,0x4b5c7bf8},{0x02401235,0xf523692c},
+{0x0401f121,0x1830019f},{0x03c1d479,0xe022e52c},{0x02e021aa,0x2d00b692},{0x02c02e31,0x5b7365dc},
+{0x04a115d1,0x11892e9c},{0x04210b43,0x2c1ed1d5},{0x01e10473,0x270056be},{0x0741d9bb,0x4cbbe35e},
+{0x02e111ea,0xe50e489c},{0x02418846,0xf98bc4c1},{0x02411081,0x14228c39},{0x0381226f,0x18b14444},
+{0x01e0a6e0,0xe362085d},{0x03400365,0x281b622b},{0x0200a843,0x5fc31285},{0x01e0a2e5,0xbc757c90},
+{0x02010b22,0x3a1970f1},{0x0400a8f2,0x86977ca2},{0x02e1340d,0x36d2371a},{0x0300fe7c,0xe440fa8d},
+{0x038022db,0x7c671198},{0x02601431,0x34b15cc7},{0x0161f4bf,0x1e862f92},{0x0360a7ad,0xc664e17c},
+{0x02e01806,0x4a199bb3},{0x01c0a21b,0x049b78d0},{0x0280aae3,0x4eb6ffe3},{0x05201fd2,0xbb344945},
+{0x0321d105,0xe4469820},{0x02a1f7d8,0x74df9131},{0x01402116,0x6dbffd8c},{0x02011144,0x3b62516e},
+{0x02c04de6,0xf0fd33b9},{0x01c0a2fa,0x989e3798},{0x0341d711,0xc5467f93},{0x028112e0,0x790782f9},
+{0x01c10e8d,0x1c601f0c},{0x02601081,0x1f9af46b},{0x0480fce5,0xd6590c03},{0x01e10690,0x4e3a13f1},
+{0x0321d52e,0x1fa19502},{0x038027b6,0x83f53d45},{0x01a0a310,0x9792780d},{0x0280108a,0x60fa1835},
+{0x0420167e,0x759550df},{0x05002548,0xf4f130e4},{0x03c01d9b,0x67e19eab},{0x0081f476,0xf14806e9},
+{0x0341d4a6,0xdf7cb027},{0x0401e882,0x62e1bbc3},{0x022032f8,0x271f0dd4},{0x04600497,0x08d92725},
+{0x02a1f851,0xb4927b5a},{0x024104db,0x59aa681c},{0x04e01f45,0x3c866273},{0x02c1f065,0x6fe964a5},
+{0x040115d9,0x6f516f68},{0x03c1e11e,0x2a4018aa},{0x05611a9e,0x790cc442},{0x0221082e,0xa5e0913e},
+{0x0541d795,0x423b1f66},{0x02a10443,0x5f8bdd13},{0x02801089,0x5dfa137c},{0x02200cca,0x263afcba},
+{0x02c00244,0x8633956b},{0x01a03321,0x0a287e67},{0x02016ad1,0xe4b87c34},{0x01a0a138,0x07a603b6},
+{0x03602a7e,0x0cda986d},{0x0301d405,0xca4d1954},{0x01a1e2db,0xc99e743a},{0x03e006e2,0xa48684cd},
+{0x02a1e910,0xafc71a8f},{0x03a022e7,0xa46fcd6f},{0x01e00cb5,0x41134502},{0x02c13317,0xf80b038e},
+{0x02601307,0x5e8878e6},{0x03000a76,0xee2a4252},{0x028011a5,0xf6cb7e59},{0x02601a92,0x07f41388},
+{0x032100ed,0x4d6afdfb},{0x04800216,0x15b7b957},{0x0321d6df,0x8b50c0e5},{0x02e1d13e,0xea087b6e},
+{0x0121f4db,0xf1f76dfd},{0x04e1f75d,0x49c3f646},{0x0321013b,0xdbcf773c},{0x024189f5,0x3533da9c},
+{0x01c102bf,0xec19e41d},{0x038029e3,0xeee3a56c},{0x03a001e4,0x79b41e60},{0x03c1d9fb,0xde978914},
+{0x02e02b45,0x4f043ced},{0x03016868,0xa4026693},{0x0381f766,0xf40f7138},{0x01e102af,0xb4613f16},
+{0x02e168de,0x54427690},{0x0300fbe6,0x0b76c83e},{0x03612391,0x1d4a34b1},{0x02c0192a,0x13b45fca},
+{0x02402d55,0xe28276b7},{0x0401bc71,0xf4535827},{0x00c022a5,0x107b30a5},{0x014026b1,0xc397d10f},
+{0x03e006fe,0xa1ce1d8c},{0x03002d50,0xc877fe76},{0x0381f773,0xf3b22198},{0x02802d84,0xb80c4337},
+{0x02600d6e,0x4cd2c69c},{0x02e144ca,0x09fe730f},{0x02201732,0x63014f0e},{0x0461d772,0xa299d340},
+{0x03e02e42,0x4472319e},{0x03401ba7,0x82b0da9b},{0x03c02971,0xddde9688},{0x01c0a30d,0x81f6972e},
+{0x03c120a3,0x815daaaa},{0x01e0a84e,0xb81cae10},{0x0221115e,0x0afad813},{0x01c0a336,0xd17cb236},
+{0x02001b2c,0x06be6b28},{0x0521f821,0x329e3b1e},{0x03a1250b,0x570b32fd},{0x02e0284f,0x8c930b01},
+{0x02010638,0x1c23e6ac},{0x03010a8e,0x7d80da99},{0x0321681f,0x098ba607},{0x02400d36,0xcbbcb892},
+{0x01811628,0x1c119003},{0x03411a91,0xe4341ca1},{0x018027cc,0x48af1ae4},{0x01c007a1,0x82a4dc59},
+{0x03c1ed15,0xda879f6f},{0x03410563,0xc15957b6},{0x02c1bc9c,0xc919bf9f},{0x02a16936,0x7cfd35b1},
+{0x03e1ec9b,0xac8abbba},{0x05202bb8,0x7f4d32bb},{0x03a011d6,0x5b7329c5},{0x02c0090e,0x52827572},
+{0x00e1f9fe,0x7de5b523},{0x04a1d760,0x559869d1},{0x0221017d,0xc0a5e25b},{0x02e120c9,0x53f087df},
+{0x02e11832,0xdde63e89},{0x0320ff64,0x1a94de7a},{0x01a0a1f2,0x6e1d01f5},{0x02000f6b,0x57f27bcb},
+{0x0180a4d0,0x86d8f263},{0x02200f23,0x2e33dfb1},{0x026019e4,0xcef994cd},{0x02210838,0xc5eb50fa},
+{0x02a10f15,0x641e73c4},{0x02600e35,0xdab273d1},{0x02611955,0x3704675f},{0x02601326,0xd6b14de1},
+{0x02201189,0xbfbede2a},{0x038115cf,0x67a95f0e},{0x02a01671,0xd80d390c},{0x04400170,0x8164f4e9},
+{0x0521f802,0xba311e27},{0x03a1ee2e,0xb80d3ef0},{0x0201232b,0x946a3493},{0x0140271d,0xb58dc727},
+{0x0461d608,0xd8a2de64},{0x036015d7,0x19d3ff2e},{0x0401d098,0xf224579c},{0x04a004a6,0x9f6d7745},
+{0x0460279f,0x459a03f7},{0x02c12172,0x7835bf59},{0x0161f5c4,0x4563fe81},{0x02a1002e,0xe48325e3},
+{0x03c12031,0x460d507b},{0x00e1f37f,0x9e3fc32a},{0x02200aef,0xc8c602fb},{0x02c115c8,0xb5fd8dfc},
+{0x03c0294c,0x29cc2ddc},{0x03a0faac,0xd66fff0f},{0x0481fa12,0xc6859a82},{0x02a1d1d7,0x90a184c0},
+{0x02801547,0x8d9d25e0},{0x02a16b30,0xe9c2363e},{0x0221081d,0xb1d19998},{0x01403310,0x3d39e47e},
+{0x02202f9d,0xd5ea18d1},{0x0441f167,0xf14f6474},{0x02e02144,0x0381fa52},{0x030010a7,0x0e30a2fc},
+{0x01e12328,0x8ad8e133},{0x0121f9f8,0xafb1dd17},{0x01a0a3ed,0x06293804},{0x04401b73,0x4f6ed81b},
+{0x0340a75d,0xd65dc2fd},{0x0381d6d0,0x078e5ae8},{0x032003a5,0xe8c99c51},{0x03202b65,0x729f36b0},
+{0x03212206,0x496a3866},{0x02e10c09,0x3656f53e},{0x0401d540,0x48897d9b},{0x02400d6a,0x768a9d79},
+{0x0261f4b4,0xea0f9400},{0x0361d5bb,0xc79c8c80},{0x01c0a2f4,0xa8c0e30a},{0x02c13034,0xf6134bfc},
+{0x01e112a3,0x457ba7bc},{0x02412227,0x55dbd89d},{0x02001a0a,0x8714e86c},{0x03c1f1e6,0xae24431c},
+{0x034025b7,0x0bc8b1de},{0x02a10008,0x3138b6e0},{0x02e003eb,0xbf40bd13},{0x020103b2,0xd6ba3e1a},
+{0x0121f3a7,0x69a38ad1},{0x02e16e63,0x6bd46075},{0x052027e2,0x3380efc5},{0x01c0a16e,0xa71ddee3},
+{0x0641d0d7,0x28183749},{0x03401ba4,0x5919e731},{0x03a01538,0x46f04cae},{0x03e18c16,0x87a24284},
+{0x03c01e10,0x2878e0b1},{0x06c01fa3,0xac955fb0},{0x03c1f1ea,0xaa243cd0},{0x02418966,0xb288b2c2},
+{0x02e0aa4d,0xe4d2e1e8},{0x0261b0d2,0xeafdb8ba},{0x0261b0c8,0xd6cbfc72},{0x01a11825,0xa24279df},
+{0x038002c3,0xb592f205},{0x0381d4ee,0xcdcfa257},{0x02c1d34a,0xd8055f3f},{0x01e013a0,0x05d56bec},
+{0x02a10acb,0xba445167},{0x03c1d80e,0x124d7fd0},{0x01e00e97,0xc23006ca},{0x02011194,0x85cc869b},
+{0x01e11c7d,0x995d81be},{0x03002502,0xcccabce9},{0x03011ca5,0xfee87c72},{0x01a0a127,0xb6fa0625},
+{0x028014e2,0xb21bc5ee},{0x03601d46,0xcd2c164b},{0x02c1307c,0x3d237014},{0x02e144c1,0x0d00b65f},
+{0x0220116d,0xd1c7f4dc},{0x02416ad7,0x2c553c9e},{0x02210f38,0x722bdadc},{0x04a1f731,0x5aef8eb4},
+{0x02411cb0,0x30e49a77},{0x03a01e47,0x9b97c252},{0x02011115,0x638fd04e},{0x03416e57,0xa4d7b5ea},
+{0x01e1f583,0x50938425},{0x0341e857,0xe5cdb588},{0x01a0a3dd,0xf638b662},{0x02a1eca1,0xb6dd759d},
+{0x05601428,0x86f50e5e},{0x01c0a6b0,0x7a41d455},{0x01800b07,0x60ee0da8},{0x02c124d3,0x474b3885},
+{0x02e003dd,0xfc19ee0a},{0x0360d7f3,0x8c8fd9a2},{0x02e13008,0xb1ecee04},{0x02e14419,0x217dbf55},
+{0x01a01bc9,0x1abfeab1},{0x0301f757,0x9a7e2ad9},{0x02c1004d,0x7a2800f0},{0x024031b3,0xed65f99f},
+{0x02e144bc,0x0a00b1a6},{0x03e01c94,0x994d259a},{0x034006be,0xdf852dd4},{0x04002784,0x686760f9},
+{0x02201b98,0x90c70846},{0x03000866,0x75212470},{0x03e0189b,0x7f86ded6},{0x01a0a0e5,0xb222d0ae},
+{0x0280266c,0x97f5fb56},{0x01a1f5ae,0x135d99a9},{0x01e1214b,0x491d9dd1},{0x01e0310f,0x7bf9f300},
+{0x03401ef9,0x3ae4cecb},{0x02418976,0xa28d16c0},{0x0260aac0,0x60ed41fd},{0x03200239,0xccd3afaa},
+{0x02603289,0xe5c092ed},{0x02e1456f,0x7043aaff},{0x0261b064,0x3034bea5},{0x04601e15,0xb996c91b},
+{0x0321d366,0x11e30a69},{0x03c00f05,0x5211d0c5},{0x03600da6,0xe7674223},{0x026008ec,0x43e35b10},
+{0x02c04de7,0x6b891a55},{0x02002f07,0x878fe8da},{0x0181f9b9,0x44ebf1cb},{0x02400f71,0xb2e540b8},
+{0x01e01c5b,0xd2824a51},{0x02800d86,0xa1e1c084},{0x0480a7a8,0x6dcc0567},{0x038011e2,0xe577b81d},
+{0x03a0fa70,0x343b81d4},{0x02c13342,0xd2ba25d5},{0x02a1143c,0xd61eb5cf},{0x05e1d0d6,0x682095ad},
+{0x022010da,0x64d24759},{0x0261b0d0,0xe8fdb594},{0x050001d9,0xd6833267},{0x01c0a461,0x86a980d1},
+{0x026100ad,0x5d4efb44},{0x01c026bc,0x46d3cb6a},{0x0201046f,0x72f4f570},{0x046109fa,0x454b9c25},
+{0x01a1170b,0xfd516ce2},{0x01e1163e,0xa0bb2278},{0x0401f124,0x152ffce6},{0x0301d371,0x0ebb0b2a},
+{0x01c1fae5,0xaa1cf356},{0x02802f1b,0x92118988},{0x0380fe99,0x2fc703d5},{0x03603169,0x47c4b03b},
+{0x01202588,0x1ed25d95},{0x0441d7ec,0xf71294e7},{0x01e1201c,0x910a8771},{0x020103a9,0x86cedae2},
+{0x01e0a580,0xe194b051},{0x03a1d676,0xd7587db5},{0x02400801,0x1eab13e8},{0x01c1092e,0xdb6d2730},
+{0x036023a8,0x6b6ed72c},{0x02e10c0d,0x3b56fd1d},{0x028022dd,0xdea797f4},{0x0361bc76,0x56b0fcfb},
+{0x0141f432,0xa3295d87},{0x030028f5,0xa63dac24},{0x03e0ffa3,0x87ebdb13},{0x0240ff14,0xf7ce0c4d},
+{0x03a006f7,0xe3cfec63},{0x02611aec,0x8734c4e8},{0x01c1fb2d,0xc2250ef0},{0x0400189f,0x5232d7ef},
+{0x038006f0,0x2d9b881c},{0x03c1d476,0xf523063b},{0x02001b29,0xa6f3426b},{0x02c133f8,0x17760d03},
+{0x02c13323,0x69127136},{0x01c0a331,0xc95a135c},{0x03600dd3,0x9295524a},{0x020122ad,0x5b1388e2},
+{0x01c11440,0x5fe8ed45},{0x0421d5de,0x4f36cad5},{0x0281696c,0x3f8984f7},{0x030020d7,0x02b16e1f},
+{0x03002e20,0x5a83d728},{0x02c00bf2,0xc0b13be9},{0x03410a74,0x95fe2859},{0x05c01f80,0x305cd9cc},
+{0x02401930,0x030e4d67},{0x03e0106a,0x0a11b1c8},{0x032002f8,0x2ca79237},{0x01c0a553,0xcbc3fe5f},
+{0x032028df,0x37ed0ff4},{0x05601ed5,0xcd15ff74},{0x040019b0,0xe8a99d6a},{0x02a0aa78,0x24242fc1},
+{0x01a1028c,0x01ee1384},{0x02201aa5,0x781a7a4d},{0x01600e94,0x1d4e42b2},{0x0260268e,0x9c0dbf2b},
+{0x01e02637,0xa6f0b2c8},{0x024169d8,0x096f5efa},{0x02c00318,0x839df9ba},{0x01c01c06,0x6c3cbe04},
+{0x03c1da86,0x76b620a2},{0x0421cfa3,0xbc47e883},{0x0201063e,0x1c21a815},{0x01802332,0x39177028},
+{0x0381d1be,0x65eec901},{0x01c0a1bc,0x902b34d1},{0x02010608,0x263300f4},{0x020111a8,0xdf62c85c},
+{0x02a0fe51,0xeec2fd6e},{0x03a1d688,0xc95867ab},{0x02411c5b,0x5e37825f},{0x03c1f236,0x4b090bc5},
+{0x0081f410,0x4bc190de},{0x01c0a465,0x5feb209b},{0x03816b60,0x0be7e271},{0x03804dc1,0xa8dce24b},
+{0x02c1fb83,0x2d4ea736},{0x0260303d,0x97918aa2},{0x03001119,0xd00ab2c1},{0x02418921,0x262484ca},
+{0x0220a982,0xdf0e9bfe},{0x01a00eb4,0x2a3705f4},{0x0421eeab,0x5b4e975a},{0x03e18b44,0x97c63bc4},
+{0x04a1166b,0xe2ca4892},{0x03a1d162,0x39b8f75d},{0x02c1316e,0x3bcb1f76},{0x02202f77,0x272a9ea8},
+{0x03011caa,0x42dc1b8b},{0x01c116c5,0xc3db0c8f},{0x0381cf28,0x63f33503},{0x02a01a98,0x0f435c4d},
+{0x0221e92e,0x03e35e1e},{0x06e01f9b,0x03cc3924},{0x03600286,0x9f3e4efe},{0x032122ca,0x9c7ffc60},
+{0x0340ff57,0xfee0d0aa},{0x04802bad,0x0d619ec8},{0x04a01e67,0xb8f6e041},{0x02a02894,0x218e7624},
+{0x0260134c,0xe80bfda8},{0x02802848,0x9c9559b1},{0x0201045d,0xa1cc515d},{0x02601293,0x5ccc7ff8},
+{0x04a000bb,0x9ec3d1fc},{0x02c1f07a,0xea80c484},{0x03202de9,0xfd9dedab},{0x01600652,0xb0b5f3cd},
+{0x0301d417,0xb04cf066},{0x0121faa6,0xce0d0290},{0x02e028d3,0x99480675},{0x04201e2c,0xc8ed4191},
+{0x02418813,0x66842193},{0x03003203,0x1755a585},{0x028168c9,0xf759da5f},{0x042008b9,0x2822f30e},
+{0x02812ff2,0xd54803a2},{0x03a1d678,0xd95880db},{0x02a017d0,0x29c8a071},{0x02e14535,0xfbae9329},
+{0x04002bcd,0x4761e677},{0x03e18ba5,0x0de851f6},{0x0301f01c,0x3cb144cd},{0x02211239,0x50e23042},
+{0x04e1d7ba,0x64c1f042},{0x0121f6b4,0x7bad64d1},{0x02e02857,0x8c954998},{0x01c16a7b,0x9df4e3b7},
+{0x02001769,0x490420af},{0x02e0090d,0xf79db09f},{0x02a1d318,0x9c266fd2},{0x03e1f4e9,0x97caacd2},
+{0x0500fd81,0x8ce957ff},{0x05e1d0e1,0x9a6213a8},{0x02a003df,0xeb4860b3},{0x04a1d66a,0x331b012a},
+{0x01c11210,0xdaf808e2},{0x02400f84,0x27f887d0},{0x03e1f700,0xb029cd08},{0x01600e9b,0x5d30925e},
+{0x0380fb8c,0x63ba6749},{0x024012f0,0xb8fe39df},{0x028014f6,0xcab572d1},{0x02c130dd,0x0ed04599},
+{0x02002a74,0xf21cc6e1},{0x018016ae,0x832533e7},{0x01e00995,0x872d7e45},{0x026124f7,0x513c3761},
+{0x01a1f6f3,0x405587c9},{0x0340fe72,0xc74014a7},{0x02e1330f,0xa0ebea9f},{0x03216b28,0x1842df69},
+{0x02816a07,0xcccd9bd6},{0x020103bc,0xb6e2ae2a},{0x03210b99,0x545182e7},{0x0221f6af,0x74d34805},
+{0x02c0227e,0x877a303e},{0x02810914,0x19d612bb},{0x01a0266d,0xbe5e1c16},{0x01c0190a,0x6aa7fbcc},
+{0x020122ba,0x57138296},{0x01e01a45,0x89a840df},{0x0540fdbc,0xe82744c9},{0x02e1f3d1,0xc942b61a},
+{0x03804dec,0xc2777aa0},{0x0361e862,0xb51d2417},{0x032012a7,0xb24f9d59},{0x02a16900,0x3c2c98ee},
+{0x02a01865,0x5c1cc50d},{0x02c0aaec,0x031246a5},{0x02002109,0x31560f17},{0x036018c7,0xf8e8c879},
+{0x0261089a,0x5ea9230e},{0x0220037e,0xb5be3042},{0x02c132ae,0x490707b1},{0x02c13176,0x3dcb229c},
+{0x0280a810,0xefc5860f},{0x01a0a04b,0xd5b01c8c},{0x0241191b,0xafcd507d},{0x02e144a1,0x9a08501b},
+{0x0560a711,0xf1654fb5},{0x01c0a568,0x5ac974a6},{0x03e18cc7,0x778788a9},{0x0341e84d,0x2e6a1428},
+{0x01e0a98e,0x38927635},{0x0220118d,0xcbbef10e},{0x0341da76,0x2175471f},{0x0341cf27,0x31158598},
+{0x026023bc,0x96630df3},{0x01e1050c,0x4d849992},{0x0421d63b,0x50b1f974},{0x00e02646,0xa1165492},
+{0x02012084,0x30c2ae43},{0x0121144b,0x4c288674},{0x038120b9,0xfb045f48},{0x03200f93,0xb014de29},
+{0x02a008ed,0xdc90ac57},{0x0081f5c8,0x971b3d3d},{0x04a0fc4a,0x39f77b23},{0x030168ba,0x8015544b},
+{0x00a1f999,0x6446a2b6},{0x01e10723,0x8b713314},{0x04601d13,0xd5fa22d8},{0x0101f6d7,0xc2176af7},
+{0x02010743,0x208201dd},{0x04201fb9,0x5612efe9},{0x0121fa83,0xe236b76b},{0x03c1d07c,0xcdc444a2},
+{0x03e1228e,0xb991c0ad},{0x01e11126,0x657cc282},{0x02c01d3e,0x96e7cba0},{0x02e01a73,0xca28f846},
+{0x03210af0,0x75438634},{0x06c01f83,0x0ffa4cbd},{0x0261d339,0x7c78cd01},{0x024001c9,0x167aa612},
+{0x02601244,0x5b2e014d},{0x0201bc3c,0x5fc289e9},{0x01c0a447,0x6203ac16},{0x0180a1d0,0x8a54dbd0},
+{0x02001c4e,0x80b7a93f},{0x0220078a,0x321ccd07},{0x0261b117,0xf11b95c1},{0x02003094,0x545dc813},
+{0x018016a1,0x6a250c8c},{0x02a0d7c5,0x7a9fdd9b},{0x0301d410,0xb94cfe91},{0x03612199,0x1a5d16cc},
+{0x02418852,0xe76b54c0},{0x02a0059e,0x482b6135},{0x03400475,0x534ea815},{0x04e01f15,0x76f8e002},
+{0x0260ab2a,0xf19d2227},{0x04002b6b,0xcd6bf0c2},{0x01e00bbf,0xe82f0b77},{0x01a017e1,0xf1451ce5},
+{0x03010858,0x9366234f},{0x01a0a46c,0xa65c14f8},{0x0221f618,0x660b25a5},{0x02c1328d,0xffb77d3e},
+{0x03000347,0x206fe70a},{0x02c1f069,0x6be95e59},{0x02803269,0xe7c2b135},{0x0340160f,0xf1568d04},
+{0x03a122cd,0xf0c402cd},{0x02001ab5,0x97d44e02},{0x02e01074,0xe312d400},{0x02000c9d,0x840656b0},
+{0x03c024b5,0x0a013ea2},{0x0441f166,0xe84f5649},{0x0160262b,0x1932c47a},{0x03a0234b,0xa2599b6e},
+{0x05a1d98a,0xa7b835a3},{0x0361e866,0xa0342a56},{0x024012f2,0xc0fe4677},{0x02e144c3,0x1300bfd1},
+{0x030017a6,0xa3d4eeee},{0x0161f614,0xa9b869ac},{0x0180a46d,0x4e729270},{0x026022fd,0x7082cb3b},
+{0x0601d98e,0x32a3469c},{0x01a0a5ff,0x37115fbb},{0x0300086a,0x68ac80f8},{0x0280258b,0x5cacb893},
+{0x02c1326b,0xf2b0ad02},{0x01e10502,0x1d9a1451},{0x02211c28,0x0c292197},{0x01c0a6d2,0x74b02579},
+{0x018118ff,0xc73a932c},{0x01003030,0x928791ac},{0x0281688d,0xd5241ad9},{0x02418887,0x8fe5751b},
+{0x01a0aa50,0x3dddca13},{0x04000fc0,0x8345d670},{0x02611912,0x54905604},{0x02411c17,0x94d94f86},
+{0x03010090,0x380039dc},{0x03a1f86a,0x4eb48326},{0x02211291,0x14ced828},{0x02600a42,0x75776997},
+{0x030111ba,0x5202882a},{0x02811da2,0xfec1fb6b},{0x01a0a0e3,0xaa22c416},{0x0381cf23,0xf02f3e25},
+{0x01811624,0x3be91ff3},{0x02e16f9a,0xf3230ed4},{0x04a02a7f,0x95984b2b},{0x01c10937,0xe5667b29},
+{0x03010a8b,0x044c069b},{0x020013d8,0xd018c21e},{0x02e12331,0xda2829a8},{0x0140003d,0xf0ef1075},
+{0x00c1fab2,0x0fcd2546},{0x01a0a0af,0xe0aa215b},{0x0160aa02,0x5dc2911f},{0x0381f768,0xfa0f7aaa},
+{0x0381daa8,0xb033cd62},{0x01e030f3,0xa83c3a23},{0x03002c92,0x3a65bb0d},{0x02a168c0,0xe07a9f4b},
+{0x02e0300f,0xfad37301},{0x0320115e,0x146ad2e9},{0x05c0fbed,0x4fc4210e},{0x02800a91,0x44b93831},
+{0x02a00575,0xaf90f523},{0x02c1d12e,0x12c2c643},{0x0180a3f2,0x8e45d792},{0x022031ad,0x012343f8},
+{0x020030d3,0x08edb1ca},{0x02c132f9,0x5c4588b1},{0x04a03032,0x9ee89d3b},{0x01e1e2f9,0x96f0a4e8},
+{0x02e14526,0xf9ac516c},{0x0301da83,0xd43d510c},{0x01a10292,0xfdee0d38},{0x0300166d,0xb9a21c9f},
+{0x02802b2e,0x15c20a5c},{0x03011c9c,0x46c41cf1},{0x03a0facf,0x116bdec2},{0x02a019da,0xdc5e8300},
+{0x03c024a4,0xf90123df},{0x04202346,0x18d4ae2c},{0x01a01901,0xcac4f30c},{0x0121f9a7,0xeb1b21ae},
+{0x020103bd,0xc2e2c10e},{0x01e03159,0x7c09dd13},{0x01e0062f,0x949859ba},{0x01c11c41,0x1922937e},
+{0x0601fa40,0xad74a72a},{0x01e1208d,0xab002303},{0x0360312e,0x6118f60d},{0x04201422,0xe18ad9a0},
+{0x0181f4c3,0x7cd7b4d4},{0x02602fd3,0x6816f0ba},{0x0300a9e7,0x06ccbefd},{0x0261f325,0xbfb9d835},
+{0x02a1f83b,0x609b419a},{0x03411a8a,0xd734082a},{0x02a013fc,0x3811914b},{0x03e02364,0x8e6a8ca3},
+{0x02601b07,0x253596dc},{0x02e028e6,0xbb9be624},{0x02800e0e,0x763dcde0},{0x050033f1,0x4c2e2c6a},
+{0x02c130f4,0x1dd29bcd},{0x03201057,0x4da5f531},{0x02600e4a,0x53998c20},{0x02e14566,0xef3c2427},
+{0x00c1f6bf,0x9c6b8bcb},{0x02418814,0x65842000},{0x0261f5f1,0x244d3b58},{0x0340164f,0xf16e91ea},
+{0x022009ee,0x919f5ecd},{0x02402fca,0xa022ee60},{0x0221230c,0xc03b207d},{0x02e14637,0xeac229a1},
+{0x02e1091f,0x0b997462},{0x01e0271a,0x751a1fc4},{0x0260317f,0xa4899841},{0x03002f66,0xe727599d},
+{0x016031c1,0x157d592f},{0x03201d28,0x30cad449},{0x028120fe,0x288f408a},{0x01e01002,0x50775374},
+{0x04402a17,0xb3e55383},{0x026121f9,0x54d8ec16},{0x02c16b37,0x1e7acab0},{0x01e106c1,0xc5b88dda},
+{0x01a00b71,0x539280e9},{0x0241899f,0x2dc82f3e},{0x04e12455,0x0580a8fb},{0x01c1148b,0x7d713a93},
+{0x02003060,0x543b35d1},{0x0300286f,0x1177b71b},{0x02c1da34,0xc4eaffef},{0x0240fe4c,0x36530e65},
+{0x03210ce0,0x729a9d27},{0x02c00891,0xb4b1a96b},{0x0681fb64,0x9806f82d},{0x02c028d2,0x4d251b76},
+{0x04000fc1,0xb09826f7},{0x02210828,0xb9d9f4f5},{0x02a1f4b7,0x7f0fc71e},{0x0361f7b3,0x97bdb6cc},
+{0x01e0099a,0xb741518d},{0x02a02caa,0x919ee260},{0x03411fca,0x72ce2040},{0x0441f165,0xe74f54b6},
+{0x03e18b29,0x90d53b49},{0x028019bc,0x51bd0975},{0x04a0fc24,0x64d01aca},{0x02e01875,0xe2120ec8},
+{0x0421680a,0x447e9221},{0x0280055b,0x6d2c6739},{0x02418ada,0x6a1e97b4},{0x0560fdb4,0x9d2c3801},
+{0x0081f514,0x6b88c578},{0x0240216a,0xf276fefd},{0x01e0a91d,0x46a4ae1e},{0x0381daa7,0xb133cef5},
+{0x0260a814,0x5757ffff},{0x02002077,0x685ba330},{0x01a0a06a,0x65066caa},{0x0501079f,0x5a739ec2},
+{0x03a01447,0x3efb76fb},{0x02e1232f,0x2933def8},{0x0421d22a,0xcc7a33f2},{0x02e1458c,0x6f32604b},
+{0x030111e3,0x5dd3460f},{0x0401085e,0x5f5909f1},{0x056122f1,0xc640bc94},{0x02003074,0x9459afa5},
+{0x0241889f,0xf7d94ce0},{0x028e0182,0x04659f8b},{0x02a02fb9,0xe397b142},{0x03012347,0xd880097c},
+{0x02ce0054,0x7b3c7c1b},{0x03602cbb,0x177c93bd},{0x0601d9a8,0xe987428f},{0x01e11a61,0x5471557d},
+{0x044002ea,0x4b33e943},{0x01803339,0x6060cbe3},{0x01a01749,0x00212892},{0x02e16e8c,0x8e5c72f9},
+{0x0380fee1,0xb8cbfd84},{0x03c1f598,0x83de900c},{0x04200fbc,0x8fd2a18e},{0x03a1099b,0x8596d66f},
+{0x03410539,0x7849a021},{0x0381d497,0xb41ffe11},{0x0321d367,0x6558b44f},{0x010020ab,0xfddb79b6},
+{0x05c01d94,0xddcc5f37},{0x02811c60,0x2af8ef98},{0x02210051,0xa2cd083a},{0x0240aa92,0x348db794},
+{0x02e00ae1,0x0d04f6ef},{0x03410f16,0x4a04d64e},{0x01802113,0x0d6f288f},{0x0240268d,0x483a3ed6},
+{0x024118e6,0x827d44af},{0x03e18bd1,0x15db929b},{0x0121f3d9,0xab1d04f4},{0x04801e09,0x597052fa},
+{0x02410395,0xccfbaacc},{0x0081faa8,0x776d7fb4},{0x02812fa7,0x23017ef4},{0x02812fb7,0x12f01ca3},
+{0x04801b6e,0x6c7c2a8c},{0x01c16ac6,0x861119f2},{0x01c0a024,0xfbf66f6d},{0x03e18bc8,0x16ecdd4f},
+{0x02000ca5,0xa74e7e0a},{0x0381d6f7,0x2f4ba9ba},{0x0261cf84,0x3c939aad},{0x04000da8,0xd0564e22},
+{0x0381d498,0xb31ffc7e},{0x02e028f2,0x2c0e1192},{0x0521d8cf,0x1bda0003},{0x02a1130c,0xc26019c5},
+{0x0261b09e,0x0b5080b3},{0x02003075,0x981d8bc9},{0x03a01e33,0x5301c76d},{0x0440049b,0x26e694c8},
+{0x02012290,0x151b8171},{0x020114d0,0xa00f3fef},{0x03e02378,0x1466c5ed},{0x0261e929,0xd11898d6},
+{0x02a00e4e,0xda02d3cf},{0x03402354,0x1a9dba1b},{0x03410d23,0xa64308d0},{0x02a11fd2,0xc201eeab},
+{0x02200079,0x2a576923},{0x02602db5,0x2cbf9fd3},{0x020030f8,0x00bc0866},{0x02e16931,0x13ed0b25},
+{0x0480a7a0,0x3d2244b3},{0x05e1d8d8,0x13697a2e},{0x03016b27,0x4786db03},{0x032022e4,0x96d0dc65},
+{0x01c0a5d4,0x75e1a7b9},{0x02610331,0xd3fd0d99},{0x03e01e91,0x84620ec0},{0x0320ff7a,0xf66e5c14},
+{0x02616b64,0xd4029f71},{0x01a0314f,0x5e0ea64b},{0x0301f834,0x66a0ad8d},{0x03c01cc3,0xa259527b},
+{0x01e11222,0xb70115b2},{0x04012467,0xd6b8e2ce},{0x0241f536,0xc7c2efae},{0x02a16879,0x35fc6956},
+{0x02000b3e,0x2a21b221},{0x02e144d7,0x1723585f},{0x0261212a,0xabdeb8a9},{0x03401429,0x848be964},
+{0x00a1f301,0x36d25443},{0x01a01c36,0xb04d0c16},{0x038015d9,0x1fa1906f},{0x01c0a082,0xce669400},
+{0x02811d6c,0x5e6b1ce8},{0x03416b61,0x3b2cac0a},{0x0260148d,0x329105f6},{0x0241889e,0x80e0e050},
+{0x0261086a,0x569445e4},{0x0261b088,0x74f41c98},{0x0121f47c,0xccd8dc46},{0x0241881d,0x80820bea},
+{0x0360a9b9,0x83f7090d},{0x028000c6,0x6f567f71},{0x02000f55,0x0e58fd49},{0x00c1f98e,0x2a177759},
+{0x0280131b,0x6ee635d4},{0x026014c7,0xd0701805},{0x026112cb,0x359e9bf6},{0x0240080d,0xcf5c716e},
+{0x01a0a021,0x7808c92a},{0x02e0a693,0x960a7bd1},{0x02e023e0,0x270288b1},{0x02e00b72,0x94f0e79f},
+{0x02800793,0xadfa2013},{0x0361055a,0xa715e711},{0x02e1687a,0x00d468e9},{0x02e028c7,0x079a8867},
+{0x02001925,0x4f1c3692},{0x0381e115,0x1288229e},{0x0100205d,0x0b2b96c5},{0x0381d502,0xd1cfa8a3},
+{0x026014c0,0xcc7011b9},{0x02202167,0x942200db},{0x02e13226,0xcf70faab},{0x03601da6,0x6d5a1c7c},
+{0x02a105bc,0x743f9138},{0x01e114a5,0x8b4b3649},{0x032018d5,0x213e57fb},{0x02a0ab26,0x95d81a1b},
+{0x03c0fbaf,0x2c282be4},{0x00c1fa7c,0x73d3d34a},{0x026027f6,0x961bdc7f},{0x0260a8af,0x5911be37},
+{0x01e02e9b,0xff112963},{0x0280fe59,0x26585f03},{0x04401fc8,0x97df06ec},{0x02010605,0x1d32f2c9},
+{0x02c1694f,0x00c42eb4},{0x02e1445f,0x9e8bfba6},{0x01c16a76,0xccbb4223},{0x01c00fbe,0xe640c04b},
+{0x02c1f324,0x585b1f6c},{0x01c0a529,0x04ae34bf},{0x03401d62,0x20cc18d4},{0x02418989,0x37927e7d},
+{0x02e14407,0xa87883ac},{0x02a11004,0xcc4e3e64},{0x04e01f54,0xe5b89421},{0x0580276f,0x7ea5e7b6},
+{0x02001b13,0x9ae1e666},{0x03c1ee67,0xe5a17f10},{0x02e1cf53,0x0b89415b},{0x0161f192,0xb6a8a093},
+{0x02810913,0xb50a3a4b},{0x0241b015,0xd103de42},{0x03201101,0x7bb33b04},{0x04a0fc4c,0xded683f6},
+{0x04202a6f,0x873384f4},{0x03c1d4d5,0x2ce96a8b},{0x02003129,0x837c53b2},{0x03014551,0x6ac2aae3},
+{0x02c0192b,0x57a7fee3},{0x036015c9,0xa90adaea},{0x01c0a086,0xda803eca},{0x03e18c4f,0x499b2525},
+{0x03a0a64f,0x9d3e4bca},{0x01e10707,0xfa675475},{0x02402d38,0x00a53833},{0x02c00196,0x179ed194},
+{0x01e0a84f,0xb00b5857},{0x0521f18a,0x6ce24a40},{0x03216e43,0x6e8557fc},{0x0921fbad,0x4fa39237},
+{0x0420021a,0xe9460131},{0x02816855,0x70829471},{0x0221d1b4,0xace035bb},{0x02a028c4,0x9d93b686},
+{0x01c0a24e,0xfe368866},{0x0401cf2d,0xb29c41ce},{0x01a0a6e5,0x4756c129},{0x02e0fe78,0x0d770d16},
+{0x02e10121,0x4049375f},{0x0261b0a3,0x10508892},{0x0361d69e,0x3b06e916},{0x03a0faa6,0x21707520},
+{0x02a1001f,0xea6aef62},{0x0320a9f8,0x7f50c77b},{0x03010a9c,0x725b11ce},{0x01a0a4b4,0x6d5ce462},
+{0x0381d4f6,0xc5cf95bf},{0x02a12102,0x0abdf011},{0x0441d78d,0x174cfb07},{0x0641d82c,0x77f1baf6},
+{0x03c1d55f,0xea2560ab},{0x02e16fe3,0x3dcc7261},{0x01c0a428,0x02e523b6},{0x04e0fdfa,0x58844894},
+{0x01e01731,0x728d1c4a},{0x02e0201c,0x2b566c38},{0x00a1f9d2,0x8fe4c6fd},{0x010033cf,0xa2b53ed9},
+{0x034107a0,0x245190f4},{0x0441d08f,0x1ce6beb1},{0x0340011b,0xda9f3e22},{0x02e145c9,0x78efe397},
+{0x03010c18,0xf1eb0cea},{0x01a1f384,0x4a5fcf37},{0x04c1f817,0x3415a5df},{0x01a0aa26,0xf2a3850d},
+{0x0180a27e,0x6a4a1c14},{0x0141f33d,0xe29df2d2},{0x01e0a586,0xc8a810cb},{0x05000c7a,0xf03fd8d1},
+{0x01a0a1e0,0xbd12f0f6},{0x02c1d9f7,0xcfb80d9f},{0x0260327b,0x54f1236c},{0x02418ab7,0xc397ae8c},
+{0x0480fcd7,0xd4aec380},{0x01c1f643,0x236bf57e},{0x03e10148,0x12f07457},{0x01c0a284,0x087cb204},
+{0x016031d3,0x0a72ba82},{0x01c02665,0xb3728c81},{0x01a0a15d,0xa765f0ea},{0x04602cb6,0x27fba857},
+{0x03411a8b,0xcb33f546},{0x01c0a3ab,0x5309ece5},{0x02011a71,0xa83e2c48},{0x02e144a6,0x960849cf},
+{0x0180a109,0xae689c34},{0x02e101de,0x0ccfe1df},{0x01c11438,0x75e90fe7},{0x03a1d58f,0xdb916a26},
+{0x0361e898,0xb7920e4f},{0x03c1f1f8,0xa0242d12},{0x02200069,0x1a574ff3},{0x01a0a2f6,0xd5301f5a},
+{0x02011232,0x5bfb1fbe},{0x0200304f,0x581ae872},{0x0261b017,0x5763bf3e},{0x02e103cc,0xc6829d3b},
+{0x01a0a03f,0x097ed19c},{0x01a0a20f,0x9f605ad5},{0x03e1099f,0x0b7e0cf7},{0x01e030a2,0xb53c4e9a},
+{0x05201ea6,0xe034ab1e},{0x06801f93,0xc87bd429},{0x0240ff19,0x842d987d},{0x0480fd27,0x90c62317},
+{0x032015c1,0x5416b069},{0x036015e1,0x3ce99f6f},{0x02602111,0x64f50fb7},{0x0600fc67,0xf9887f4e},
+{0x02c00370,0xaaaa4661},{0x02e14537,0xf9ae9003},{0x02c13203,0x017a77ed},{0x02e0201a,0xc7b6360f},
+{0x056033fb,0xdde4ed9d},{0x028022f6,0x072eb859},{0x0261088b,0x0d5a9fa5},{0x03410cce,0xe7368f25},
+{0x02200a9b,0x6bcbc4b8},{0x0341d712,0x4167d43e},{0x02c133a9,0x2abbe7fd},{0x03c01bef,0x4a19620b},
+{0x028e0169,0x776ad1c2},{0x0241da1d,0xc4a57062},{0x00e1f30b,0x259308dd},{0x0561d935,0xe474fdc3},
+{0x03a0faae,0xd46ffbe9},{0x034004d8,0x065159fa},{0x01811429,0x0458d532},{0x02c12189,0x514b4843},
+{0x02e1d875,0x46efdf81},{0x02418895,0x89e0ee7b},{0x0201bc14,0xa1d67987},{0x01e0a32e,0x69dd728d},
+{0x02002fcf,0xc0e43024},{0x0261088d,0x029204f2},{0x0221f694,0xe64acec5},{0x02c130a7,0xae2d1c53},
+{0x03e18ccf,0x46873b86},{0x032016ac,0xbfd7ed40},{0x0261d12c,0x2309b92f},{0x0240a805,0x13abc62f},
+{0x0321682b,0xf57a28b3},{0x02003054,0xae3984e8},{0x02c1301a,0xf4225360},{0x02003067,0x583b3c1d},
+{0x02800d92,0x1424107c},{0x02418ad7,0xdd1b7b26},{0x02e10588,0xb680b131},{0x03e017b1,0xd5d92ed6},
+{0x032011a2,0x0b788aa2},{0x01a0a382,0xe949eb0c},{0x00c02bda,0x08b777c4},{0x0480a7a2,0x6099eb5f},
+{0x02411c14,0x50bde02c},{0x0360fec9,0xc441dc9a},{0x03000274,0xf8b8b152},{0x0160002d,0x27b6ed1b},
+{0x0180297f,0xc62cffe9},{0x04216b72,0x144c66d4},{0x03402b61,0xdbaa6ec5},{0x0220205a,0x13ae83a4},
+{0x020005e8,0x10aaa374},{0x03c02940,0xf886cc9a},{0x03e1d032,0x0bc04313},{0x02e12294,0x64492d76},
+{0x04001f10,0xe765989f},{0x01c16ab5,0x88c0e745},{0x0641fb65,0x44dc61c7},{0x02418a89,0x59a1950a},
+{0x02402016,0x21527ec0},{0x02e14629,0xd2c44270},{0x02e12340,0x2b8b0cb0},{0x0401f7b4,0x4df02fdb},
+{0x01c0a39c,0x0aaf658a},{0x03e18b38,0x95d781bf},{0x04e1d76a,0xdbce752e},{0x00e1f489,0x240f8a76},
+{0x01e1e2cf,0x638c4b23},{0x03e18b90,0x21bec63d},{0x02002e9f,0xf1fc577e},{0x01a0a488,0x4215623f},
+{0x01202bd2,0xee0164e5},{0x0361da6d,0x136cb894},{0x03a029cf,0x8ccfe991},{0x02c02739,0x8cdb03da},
+{0x0381f86e,0xa3383c77},{0x0220182f,0xa4338fdc},{0x016020b3,0xa5197dca},{0x01c0a59c,0xb870e3b0},
+{0x034109c2,0xf0d5be67},{0x01c0268b,0x5e535988},{0x01e009e7,0x04eeba72},{0x0260a80c,0x777275dc},
+{0x0201fb33,0x32b02f4f},{0x04c1f8a9,0xcd33167e},{0x036124f3,0x9022abfe},{0x0201bc0e,0x7ef69619},
+{0x03e18c01,0x8aa485d4},{0x03010f0f,0x0119dbc0},{0x0061f511,0xaccae4cc},{0x028e01d2,0x97d2d2e4},
+{0x04c02902,0x1f013df5},{0x0200a98d,0x46949756},{0x03001d0b,0xf5b8ac99},{0x01c16a87,0x9bec91cc},
+{0x03e18b1a,0x00d21a02},{0x0381daa2,0xb633d6d4},{0x03a120ba,0xdff1d12e},{0x0641d985,0x0687ecd5},
+{0x02e11d8e,0xd0dec580},{0x02e1692b,0x68527744},{0x02c1f313,0x4ceec23a},{0x026122da,0xb04a4a0b},
+{0x03c0142a,0xdc597ef5},{0x01e0212e,0x304466bd},{0x01c0a505,0xb3da7b5f},{0x0521f80a,0x3e3afaaf},
+{0x01a0a30c,0xc37da299},{0x02a014e8,0x2ca95407},{0x02e1324c,0xd3776246},{0x03e18b58,0x91c870e9},
+{0x0461d61d,0xe7a2f601},{0x01e01c09,0x90d98a34},{0x02810a34,0xdcdb6d0f},{0x00e1f9a0,0x6443a73a},
+{0x02418ae4,0x620d41fb},{0x02e11a22,0x202cfea0},{0x02402f69,0x63090322},{0x02e00d7a,0xcbb3eb55},
+{0x03016e90,0x86dd66e0},{0x02601330,0xf62cceb3},{0x02810911,0xf5a4f3ec},{0x0341f737,0x80e444d9},
+{0x01e1bc47,0x006780b4},{0x03a00506,0xf4e9b40b},{0x020030af,0x18d671ab},{0x02200ab6,0x7c235b88},
+{0x01e1f66f,0xf3cd1fd0},{0x0300114d,0x53895de1},{0x03802df8,0x7751cb81},{0x03210c48,0x89c07573},
+{0x03c1d46b,0xee22fb36},{0x03a1cf60,0xa68b1eff},{0x0341d437,0x33b2ba49},{0x026e011a,0x2aa88c4a},
+{0x02a0ab93,0x3f31effb},{0x0241134b,0x4d54834c},{0x0180a0f6,0x4e8a9756},{0x0141f353,0xc9debc5c},
+{0x03401368,0x73af68b9},{0x0540fd17,0xfeaa1165},{0x03e018de,0xa1e3373d},{0x0300fea2,0x60e5d990},
+{0x01e1070e,0xf3650ad9},{0x01402388,0xfb387eed},{0x01c0a04e,0x34556056},{0x04a0fbac,0x7224ad3e},
+{0x02e0042e,0x7c29e6fa},{0x01a0a5bb,0xd01b4af2},{0x02a00954,0x1a7eae37},{0x02e1057c,0xaa460725},
+{0x01c16a7c,0xddc5ea42},{0x01e00c88,0x091fb8cd},{0x030122a6,0x31852aaf},{0x036001a0,0x0e91bcc5},
+{0x030168ac,0xa874b3ac},{0x03601658,0x7403a5e6},{0x04e1e13b,0x9473f540},{0x02c1308a,0xa82895b3},
+{0x04a032c1,0x319527a1},{0x04002511,0x8a67f534},{0x03c0a833,0x3fbdbec3},{0x0101f371,0x8e0e41b0},
+{0x024114b0,0x4fc0b60a},{0x034000e9,0x06ac4a6d},{0x03610cb2,0xca993109},{0x02c01b21,0x7f56e648},
+{0x034000f9,0xfca25e8c},{0x034015cc,0xbb6bfe51},{0x02e1457a,0x744172b4},{0x012000a8,0x39f0e02a},
+{0x01e106ff,0x33a1e1b5},{0x0641fa1b,0xef4e71c1},{0x02e1ee14,0x8ff4d866},{0x01c0a44d,0xfe841f83},
+{0x03a02279,0x75685306},{0x01003375,0xb0aac787},{0x04402e58,0xfe7ce94f},{0x00a1f96d,0x8c05c8f5},
+{0x01a0a45e,0x6634a0c8},{0x01e1033e,0x9d7caeec},{0x03e18c42,0xf59aa0e9},{0x0341e83c,0x92e9ac84},
+{0x01e01c05,0x5cddb586},{0x02c11638,0x2bbd2d1f},{0x03c1f65d,0xe1c64f1c},{0x0421d633,0x48b1ecdc},
+{0x0261088a,0x268eab31},{0x02602dd1,0xb6f9019a},{0x020025ab,0xc0a621c6},{0x0200ffe2,0xc2888198},
+{0x0461d75c,0xc1dd5c74},{0x02e12498,0x620ada09},{0x0361e863,0x1535cb65},{0x0321e7ed,0x037231e0},
+{0x01c16a73,0xd7dde5b6},{0x0241f555,0x962cd931},{0x026010f8,0xf1b575c0},{0x02a105a3,0x4c1232a2},
+{0x04a01b74,0x0acbf4a9},{0x0320157c,0x47acd7c5},{0x032011ff,0xf6b36fdb},{0x0280a76c,0x3142961f},
+{0x0240aadc,0x84719a00},{0x050033f2,0xc8334637},{0x0240183b,0x37f3444b},{0x02a02832,0xbbaaf9dd},
+{0x02816964,0x78e7aff7},{0x01403350,0x71a8fcbf},{0x03000f1b,0x85ff2bae},{0x02a118ef,0x2092eba4},
+{0x04202ab1,0xb236bb3b},{0x0381d48c,0xbf200f62},{0x034118b1,0x2efbd069},{0x030028bb,0x49a50aae},
+{0x03010083,0x7feac892},{0x03c1fb6e,0xf49a50cd},{0x0200312c,0x9a9f0a29},{0x036002c5,0xe7fa12ab},
+{0x038020d5,0x6bd29f6f},{0x0421eeb1,0x1cfb4300},{0x03a02278,0xa3a3d17e},{0x026100d6,0x9598917b},
+{0x0180a0cf,0x6a63b3fa},{0x03a02cd9,0x47e352c6},{0x02610a44,0x036d3a50},{0x0381ee96,0x70e9b133},
+{0x01e005d5,0x6b39dac3},{0x0241fbf9,0x34e0ccd0},{0x026169bb,0x2532af66},{0x05c004be,0x8b2de74b},
+{0x01c0aa58,0xa8372100},{0x01e106be,0x3cb57798},{0x0121f424,0x0c5a3b07},{0x02e1689d,0x23e8b4e2},
+{0x03c1244a,0xc4c7de71},{0x01e10e8b,0x6f17175e},{0x0320a966,0x3deef5c9},{0x0240fe03,0x686898fd},
+{0x024112d5,0x7c614a98},{0x0280a950,0xca8e03b8},{0x0340fb2b,0x19462ae3},{0x0340febb,0xb4e6fc23},
+{0x01e1f1a9,0x4eda660c},{0x03e02761,0x4c88a6b0},{0x01a0a386,0xf349faca},{0x01a0a482,0xf9f86ed3},
+{0x03010c26,0xa9c6738e},{0x0661fb4c,0x01bef496},{0x0341ec83,0x7884c5d6},{0x02e145ab,0x7236e232},
+{0x026100bd,0xd467bb7f},{0x02c028a3,0xa79c0c75},{0x02e0301b,0xe6e66963},{0x0360029a,0x66ef3cef},
+{0x02402f4f,0x6a064da1},{0x024189e3,0xa1deac29},{0x03201142,0xb4535482},{0x0161f486,0xa58be307},
+{0x050029c3,0xda214558},{0x0221103d,0xdc60b208},{0x01e10f33,0x186eb363},{0x02210054,0x24c108ed},
+{0x02a022f8,0xbbde83b5},{0x01c10291,0xd5da7345},{0x02e008aa,0xeec81f2a},{0x028e01a7,0x755bc412},
+{0x01c01797,0xfdbf9f13},{0x01c11744,0xb20fba17},{0x01a102a0,0xc2f0b25e},{0x01e106fa,0x309f9e65},
+{0x02c13183,0xb332e00e},{0x04c0a9e6,0xbf763c48},{0x0301f83f,0xf65d3abe},{0x02c1d173,0x1e175759},
+{0x0141f4e4,0x820adbb8},{0x02012295,0x84fc71b1},{0x020114ac,0x880683f2},{0x03816808,0xa7ad7a4a},
+{0x03a1d5a7,0x567bb62b},{0x0561d0c1,0x77e0f7d5},{0x03e18c7b,0x5392e61e},{0x02200abc,0xc8a83a58},
+{0x02610a39,0xd04c8807},{0x02202596,0xdfd1aff7},{0x0280132f,0x7750265f},{0x03e18b7e,0xb8cd2b7c},
+{0x0241880a,0xf57cb3eb},{0x01a01bd2,0x32ca9dd5},{0x02203142,0x182aa4bf},{0x03a0fa7b,0x063b396a},
+{0x02a1f0da,0x9af6e7fc},{0x0101f344,0x7ae16c77},{0x0180332f,0x58b12e74},{0x03a11073,0x1f3345fb},
+{0x02016ade,0xba93693d},{0x0261017e,0x7aca1c09},{0x02e1445b,0xa28c01f2},{0x02e0a747,0xfb381993},
+{0x0261b115,0xf72aa9bd},{0x0381ee24,0xf6b45f1c},{0x03a1d5b2,0x5f7bc456},{0x03c1d4e8,0x39e97f02},
+{0x02800e0c,0x6663ac6d},{0x03810780,0x11ef10cf},{0x0141f4ef,0x3397297f},{0x0180a4d9,0x36ebfc2b},
+{0x0380027c,0x2f657480},{0x04e01f6d,0x30d847be},{0x02801dc7,0x8b9f852d},{0x01e10517,0x1d70c64a},
+{0x02e12494,0x01e9ef3e},{0x04a00149,0x314a29dc},{0x02602f75,0x08f0c615},{0x01a16f92,0x8e24ff34},
+{0x04c1d939,0x361ae105},{0x02201826,0x541d4b9d},{0x01e111a5,0xd5439cdc},{0x02c133ef,0x19784ec0},
+{0x030010bb,0xa6daad5c},{0x048109ea,0xd036d3e7},{0x0380153d,0x3d5052e7},{0x01e111b1,0xe53cfa47},
+{0x028018cf,0xb98e609a},{0x042020da,0x06e39329},{0x01e1f7a2,0xa755849b},{0x0201fb37,0xd2ead18e},
+{0x03e18c3c,0x6c9d9ad5},{0x02402e94,0xde375bd8},{0x02a019c3,0x2b2cb007},{0x0260337b,0xce07a30e},
+{0x0361e842,0x4ed7215d},{0x01e00990,0xe33b86a3},{0x026112ea,0x81a98e22},{0x0541f806,0x317e8729},
+{0x024012de,0x1f0de4fb},{0x03c03297,0x496112c0},{0x01e01682,0x60a17758},{0x0661d858,0x41c51311},
+{0x02e13368,0x156ee812},{0x0321686d,0x67a43aad},{0x02e0261e,0x611fd702},{0x04a1d759,0x715c608a},
+{0x01810e60,0x2f061675},{0x03200291,0x242d95d4},{0x034168c7,0xbea8a551},{0x02a168e6,0x1ce9cd19},
+{0x03200439,0xae50c05e},{0x01e00a8f,0xfb8aff0d},{0x0380050a,0x7eb0c41b},{0x0281fb8d,0x705b60b0},
+{0x042002a5,0x03b939e1},{0x0341d6cb,0x250bde44},{0x02201837,0x9010de1e},{0x04001cba,0xff167733},
+{0x030028f9,0x9ec20ab5},{0x020108ea,0xdf00bdfb},{0x02c132dc,0xcc4ab62f},{0x0481cf8a,0x392747e6},
+{0x03810169,0xf361c5d5},{0x04001f69,0xd07e39fe},{0x01811622,0x681684d5},{0x03a00885,0xd570f3e8},
+{0x02e1458f,0x72326504},{0x04400200,0x9573c184},{0x0260142c,0x33776fa3},{0x03a027e5,0x1cd41589},
+{0x01e1046a,0x50bff186},{0x02211ada,0x36aece1b},{0x03e01abf,0xe5377742},{0x02000aec,0x6897d719},
+{0x026108ac,0x0d0f7e2f},{0x030025d1,0x5c42e50f},{0x02c02cb0,0x7062e152},{0x02c10049,0xb57fbeb0},
+{0x03a01e20,0x2bb5f542},{0x02200621,0x463c0b10},{0x02602036,0x2d29898d},{0x03a01eb9,0x5eae2547},
+{0x038102fb,0x978f95dd},{0x03c024b2,0x0f014681},{0x0421f63b,0x503700fe},{0x0520fc83,0x05f887c4},
+{0x02c132c6,0xec9b8c09},{0x034024ba,0x4c65e8fc},{0x022114c2,0x078da3c3},{0x02c0fb4e,0xa3026d69},
+{0x02c1334b,0xd3bc65ff},{0x02c13210,0x6d7511c3},{0x02e131ca,0x1f9163b2},{0x03c1f1f1,0xb3244afb},
+{0x0200a9ae,0x527ca554},{0x02c1d32d,0x752d70b5},{0x0220a907,0x0d5f9350},{0x024188ac,0xfadb9030},
+{0x03c1f7d0,0xb35dd83d},{0x01a1f3c1,0xc2ee1587},{0x03c01ce4,0x0e5e711f},{0x020013c5,0xdb09c8e5},
+{0x03600d3c,0xdc7c1dd2},{0x01a02028,0xcaa24442},{0x0440235a,0x23973300},{0x02a1f53a,0x5c78d611},
+{0x0240134d,0x090334fd},{0x0260ff03,0x89c280c8},{0x0241891f,0x9427708b},{0x0301d6d2,0xf322d42c},
+{0x01c0a145,0xb45c41cc},{0x02011a75,0x82814f17},{0x026014d2,0xd770230a},{0x04c1014c,0xdd10553b},
+{0x02c131e7,0x47ff0bab},{0x032005a9,0x41f0803a},{0x03410919,0x010ef8ba},{0x04012207,0xe3ef6a1a},
+{0x02a1fbbd,0xed65fdeb},{0x0340114a,0x7a6ee6ad},{0x03612502,0xe4effd70},{0x0501d97b,0xf3c23940},
+{0x02200d0a,0x5633bb02},{0x03a0fa9c,0xe74a1327},{0x032002bb,0xd23818c5},{0x03c1d74d,0x8791ca3f},
+{0x01e00847,0xaba1f7d5},{0x024118e2,0xb76dbb65},{0x0521d7ac,0x1a117530},{0x01e01685,0x2963b4bb},
+{0x0261250d,0xa16a508e},{0x06401fe7,0xf333b608},{0x01e11209,0xeea5fc7f},{0x03e18cc5,0x75878583},
+{0x0261b01b,0x5b63c58a},{0x02812fe6,0x3264e825},{0x040000c4,0xb1713c5b},{0x03e00dae,0x14f9eb32},
+{0x020030da,0x68ca23a8},{0x03e027bd,0x251b5b23},{0x02418832,0xed8734af},{0x0541d9d9,0x0be6d65f},
+{0x02801103,0x0b783438},{0x024189dd,0x2bc3aeea},{0x01c16ab1,0xf8c8535a},{0x02001020,0x0c1103b3},
+{0x03a0a65b,0xe1326dc6},{0x0181e296,0x3eb296ab},{0x02812fcb,0x1cf4a98f},{0x0241b00c,0x4a1ca1a3},
+{0x0281694b,0x9e9ea392},{0x02a00781,0x04f6eea6},{0x03e18c95,0x7a8ea655},{0x01a1f4fc,0x995012b0},
+{0x01002683,0x36dff8a4},{0x032011cd,0x9098215e},{0x02401265,0xe8fa0841},{0x02600918,0xd8c1a987},
+{0x03000e4b,0x4b3e9862},{0x034016da,0x514c1faf},{0x0561cfba,0x8b08d425},{0x03e18c6d,0x7b9563ad},
+{0x03010415,0xd63a893e},{0x0320206d,0xece050b8},{0x02a0a9a6,0x03747616},{0x03802aca,0xbbe6d845},
+{0x03602a76,0xcccbf2a8},{0x02802f7b,0x3a6d254c},{0x04812504,0x19d1e234},{0x03200f80,0xb7f2af63},
+{0x04610172,0x840b2bcf},{0x01c0a934,0x99387475},{0x02e14437,0x216eb4cb},{0x00a02648,0x00a8ba55},
+{0x0580fe47,0xc9cb031e},{0x030145af,0x0f942431},{0x02a04dcf,0x6df7081c},{0x02402620,0x1c0fd5a8},
+{0x01c1f9cd,0x96a1e6d0},{0x02a016b9,0x66898af0},{0x03c1d4db,0x26e96119},{0x02800dbb,0x24ba5471},
+{0x0341d71b,0x2f53306e},{0x032028fd,0x2cb9f768},{0x01e03042,0xc7811511},{0x02201171,0x93c31614},
+{0x02418867,0xffe86402},{0x02402be9,0x842d4adb},{0x0180a4d7,0x5aee736e},{0x0401d550,0x3889646b},
+{0x02c028e4,0xba2bf962},{0x01c11fde,0xfb509246},{0x02c132b6,0xf49dd738},{0x0381e86f,0x1918f0f6},
+{0x0101f5d6,0xb17767cf},{0x03a011d2,0x5e46f9cc},{0x01a0a10a,0xf2ae316c},{0x04a1d758,0x1fb4e4bd},
+{0x02811643,0x02af418f},{0x0261695b,0x2868e615},{0x01a0a425,0x152100dc},{0x02e0ffda,0x7b63b35b},
+{0x0360fb16,0xad457b36},{0x0341e7e8,0x9dd9f831},{0x036007ed,0xf1834109},{0x05a01fb4,0x0a34d43a},
+{0x01e106b3,0x3ab335db},{0x02201183,0xc7afe038},{0x0221080b,0x05c551e1},{0x02c16947,0xeacfc1a1},
+{0x01a017d4,0x3098f7f3},{0x01c1fb08,0x442ed5f2},{0x0361e831,0x82d95fc0},{0x01a102a8,0xd2f0cb8e},
+{0x02601507,0x2ab808ce},{0x02c1ed04,0xb4cbfd17},{0x02c1334e,0xd1bc62d9},{0x02418a60,0x4eae4fac},
+{0x028122a8,0x9204f91c},{0x0121f346,0xdc992cb9},{0x060006d7,0x622e7149},{0x0180a4d6,0x42e5534a},
+{0x04802b86,0x7d38ba28},{0x020010f6,0xd968e4ae},{0x038023a3,0x88bbbbc7},{0x04a0fc3c,0x84071e33},
+{0x04e0fd09,0xc5db7a87},{0x0601f81f,0x7ddabf41},{0x0340320b,0xa7eca3c1},{0x04e1cf03,0xa0af9259},
+{0x00802be2,0x7c59e3ec},{0x01a02258,0xa2240f04},{0x0261b10b,0x67345469},{0x01e11211,0x5f86ee52},
+{0x02410895,0x4125de23},{0x04c02348,0x97b9c7b0},{0x038001cf,0xb35a0005},{0x0361d5d2,0xe29cb701},
+{0x024188ec,0x110c5ed5},{0x01c006d5,0x67602ab7},{0x01e001bf,0xb0217269},{0x02602dc0,0x2ee89785},
+{0x02a168d3,0xecc14f66},{0x02e14448,0x1e732d40},{0x01c02ea3,0xd030f07d},{0x0200a905,0xbcbe60af},
+{0x02c10f23,0x163362d9},{0x01c1f496,0x7fd0999a},{0x01a1f978,0xf7281c4b},{0x0340a9bd,0x1f7e816b},
+{0x06c1d937,0xa4604bf2},{0x03012139,0xae85fa30},{0x02e11d31,0x7b05a362},{0x0360a799,0x08eff4ca},
+{0x0201131b,0x99c8dc3c},{0x0241f908,0x4141ab02},{0x0400a77e,0x135ab3ca},{0x01e1f58d,0x50f328a1},
+{0x0541d08e,0x0c138d9f},{0x03e18c67,0x88957824},{0x0220067f,0xc2be0a9f},{0x02610320,0xb99a61c4},
+{0x02e01bd5,0x13bf7617},{0x0341d43d,0x3db2ca07},{0x0261e944,0xd5333a5c},{0x02418a74,0xd2a90f4a},
+{0x032122cb,0x17580395},{0x02000854,0x69ce70d0},{0x02c1d41e,0xd897e464},{0x03c0fe5e,0x360f7a1f},
+{0x0181f914,0xb2644394},{0x024021ad,0xa72a72c8},{0x01e11435,0x4bb2121e},{0x03e1f59b,0x91a4a37d},
+{0x02401819,0x0c6d9628},{0x03001a7c,0x1dc02f50},{0x02e133aa,0x01cdccf4},{0x03002149,0xa410417b},
+{0x0241880d,0xf87cb8a4},{0x0141f35a,0x5235cb9d},{0x01a000b1,0x83ae041a},{0x0261b0e8,0xee7a0bf3},
+{0x034003d2,0x2d90b6d0},{0x01e01690,0xa6fdbc42},{0x0200a9b1,0x3a71f230},{0x0621d92d,0x9316a4a5},
+{0x03e18c02,0x8da48a8d},{0x02c02c3b,0x1f88469e},{0x034022e6,0xdb8b174a},{0x0601d965,0x9e5c3cde},
+{0x02e00393,0x7f385836},{0x02a168aa,0x62a3c614},{0x01e0a21e,0xaaaea15f},{0x0361e861,0x04c754b7},
+{0x0320a9f7,0x712da6fd},{0x0361ec8b,0xb704510e},{0x02418a1d,0xad3d91e0},{0x0260126c,0x57b53058},
+{0x01c1181a,0xafc4c387},{0x0141f529,0x6aaaaa9a},{0x01a0a927,0x0fc69482},{0x0180aa08,0x2376a8dc},
+{0x0121f6a4,0xd4be2afe},{0x0340d7ee,0xc45ca79d},{0x0321f667,0xbb79ba11},{0x02001971,0xad0a32cf},
+{0x0461d9df,0x08bf7b16},{0x020005b6,0x11b9039a},{0x01e16a8d,0x04940524},{0x0141f4c1,0xb712b927},
+{0x02c132dd,0xcb4ab49c},{0x0241898e,0x2a926a06},{0x0141f6b6,0xd41a8f3c},{0x02e14406,0xaf788eb1},
+{0x0061f967,0xeef812d5},{0x0221f0e5,0xc2f80b4c},{0x0620fe3d,0x3a28d8fd},{0x0360fea1,0x2b71ab4b},
+{0x01c1108c,0xc842cb59},{0x0421d625,0x36b1d086},{0x026100d9,0x9a98995a},{0x01c0a257,0x064e99e4},
+{0x02e14401,0xb278936a},{0x0101f549,0xf1174efd},{0x02e14569,0x7a43babd},{0x030010cd,0x9e292913},
+{0x0301084c,0x036b0a5d},{0x01a0a20e,0xa3606121},{0x04e03363,0x507c78c0},{0x022110b8,0x6ff2b697},
+{0x01c11814,0x67a7d01b},{0x03210cd1,0x917cb8e0},{0x02e145e4,0xe4f74960},{0x0241fa6c,0xf1a01562},
+{0x02c01d39,0xb3e7f947},{0x02a00663,0x81c317f9},{0x02c13377,0x2fc06d0a},{0x01a00b08,0x77bfd933},
+{0x02801386,0xb72e397d},{0x0220227d,0xdc6ef9b2},{0x03801e7c,0xc9ebb5e7},{0x02610915,0x798eac7f},
+{0x0381d70e,0x0f45055b},{0x03e18b09,0x14cffae7},{0x0481fa13,0x79afcf2e},{0x01e009b2,0xf734ea5a},
+{0x0380011e,0x57eb9242},{0x03e18ca3,0x038ce23b},{0x02211ac8,0x22cf024a},{0x02a00434,0x31e54b10},
+{0x0381f009,0x5dbb9146},{0x01e02622,0x3fdf7cc3},{0x01e16aa3,0xe61bab1d},{0x0301f040,0x4fce518c},
+{0x01c0a229,0x04a4732c},{0x038023a1,0x362ad40a},{0x03202292,0x853b93e2},{0x0200311d,0xe099682d},
+{0x0361d6ee,0xc26a6faa},{0x02211156,0xac910f86},{0x02400808,0xb6d7ab76},{0x0100303c,0xdd9f4522},
+{0x0221e935,0x09e36790},{0x04a0025d,0x96b6cf5a},{0x0261b0c4,0xd2cbf626},{0x03a0fa86,0x244cb1c5},
+{0x07e01f8f,0xb82991f2},{0x02e1463d,0x66bf1b3e},{0x0361d5c2,0xd29c9dd1},{0x04a0fcd4,0xe2c83f76},
+{0x02a16980,0xc3cf26f0},{0x02210389,0xc1eec418},{0x02001a04,0xb340ba4e},{0x03402e0d,0x317dafcc},
+{0x03610c8b,0x9cbff80f},{0x034029b4,0xd6d054b5},{0x0260213c,0x6bb0b430},{0x03402517,0x51bdda7c},
+{0x05410f17,0x80502bc2},{0x0380fb9c,0x6585e134},{0x0341f6c6,0x2e9b0194},{0x0360161e,0x0ab46cb3},
+{0x0401f129,0x20300e37},{0x03e18ca9,0xfd8cd8c9},{0x0381d488,0xc32015ae},{0x0320290d,0x97ff518e},
+{0x02c13179,0x44cb2da1},{0x02e0097a,0x8752c56c},{0x0160204e,0x08d55bad},{0x01e00843,0xcbb5b1ed},
+{0x02600059,0x59150766},{0x0181f479,0x5a2e2d91},{0x05801fe2,0x8d948f82},{0x01e01c66,0x1e9649ad},
+{0x0240168d,0x79bb4aff},{0x03210cd4,0x539171fe},{0x0240030a,0xdb1b88b8},{0x02e118c2,0x3453e16b},
+{0x03600111,0x24025230},{0x0241885b,0xe6691496},{0x04001d19,0xd51f54a4},{0x0360feb8,0x6139b974},
+{0x02410367,0x1b0be816},{0x03a0fe5d,0xead9c0c8},{0x02a02589,0x129d9f06},{0x02e0aaef,0xe0b2d460},
+{0x00a02236,0x28dbf764},{0x0380a657,0x8e44479f},{0x03c1f232,0xe93a9e2a},{0x01a102b7,0xd3f0cd21},
+{0x0320027d,0x89df08fc},{0x0381d482,0xc52018d4},{0x01e10ea7,0x5824a211},{0x0341d4a9,0xda7ca848},
+{0x0381d896,0xeca641a9},{0x01c0a223,0xc8969d2e},{0x042107b0,0xa9899aa8},{0x01c025ac,0x88226381},
+{0x04e1d654,0x0ce1b8af},{0x0401d73f,0x88a8e260},{0x02e16e6a,0x5ad445b2},{0x01e0a853,0x8c4bc701},
+{0x02801566,0xf8328773},{0x03e18b80,0x1bbc7e34},{0x02a02851,0x3e229fcf},{0x0360fb78,0x36e03d15},
+{0x01e0a988,0x2e926677},{0x01e121fb,0x9c115487},{0x034024c2,0x5465f594},{0x0440019f,0x42366bfd},
+{0x02c0227f,0xfea08bac},{0x04000767,0x406d01e8},{0x03a1f53e,0xb5011956},{0x03816b73,0x5b459ed8},
+{0x02a10a33,0x077e6dcf},{0x02e00539,0x40bea9f3},{0x0220aac1,0x9d2161ef},{0x02c1f07e,0xe680be38},
+{0x0561df16,0xd96ba9de},{0x01a007fe,0xd9020f3e},{0x0641fa1c,0xefa0155b},{0x02401a19,0x54832536},
+{0x0361ec86,0x83e06cc6},{0x01e1f7e6,0xdf0e7e57},{0x02a0043b,0x1ce2eb6a},{0x02e1009d,0xeda9df53},
+{0x0520a7c9,0x604f77c6},{0x02200f4d,0xfabe4545},{0x01801740,0xc4d23d64},{0x01a0a5e6,0xc6e0a59f},
+{0x0401d9fd,0x6d17f88f},{0x01e0a25f,0x36e7f856},{0x03c02b36,0xa68cc81e},{0x03c1f1f7,0xa1242ea5},
+{0x01a116c1,0x3774753d},{0x0441d72e,0x71b7f2b5},{0x0121fa82,0x708661fc},{0x04001c9a,0x3aa703c7},
+{0x022122d9,0x378ecf3c},{0x03c1f1f0,0xb82452da},{0x03a1f89b,0x817657da},{0x03812277,0xb9c80806},
+{0x0241017f,0xe34638b7},{0x01e023de,0xf82c745b},{0x0240a887,0x39c329c9},{0x02400983,0x14319ebd},
+{0x022013e0,0x28058336},{0x03e18c94,0x798ea4c2},{0x02a00607,0x5b2ab19e},{0x0221237d,0xcee09538},
+{0x03c1d4d9,0x28e9643f},{0x01e017cb,0x3482dcd2},{0x020031a8,0x7e7c4bd3},{0x01a0a0d7,0xe0e5f208},
+{0x02e11d90,0x00b801a0},{0x04202bf5,0xa21d6c39},{0x030028ee,0x3594730a},{0x038000d9,0x0b04868f},
+{0x01e0200f,0x4637c3e0},{0x01c005e4,0xa7f24529},{0x02a169c4,0xdfa006a3},{0x03202396,0x5bd13aaa},
+{0x03c026db,0x11aa74cb},{0x01c0a381,0x935d753c},{0x0260a89a,0x5a82e5f4},{0x02001b83,0x105c9bb6},
+{0x02210864,0x0729cb9b},{0x02e122c4,0xe317765b},{0x02a1f624,0x17a3d335},{0x0240fe73,0x1aaeb5f7},
+{0x032120a6,0x5c4d9bad},{0x01a11623,0x7b841101},{0x0261b0ac,0x1e642654},{0x02a105b9,0x283a9c66},
+{0x02401466,0xbc4c01e8},{0x03a01518,0x88de1d57},{0x0261b09f,0x0c508246},{0x0340fea3,0xd90aa180},
+{0x01403349,0x37c42b25},{0x01a02eb7,0x3893feb7},{0x02e00867,0x33d65156},{0x03811fce,0x3488834b},
+{0x03e18b15,0x0cd22ce6},{0x03e18be7,0x1bdddaa4},{0x02a01588,0x884c7b19},{0x034109c6,0x46f0003a},
+{0x028119c0,0xc87961c0},{0x0560a757,0x7d25b4f9},{0x01c0a3a6,0x02a65e96},{0x02202f19,0xceb29ffc},
+{0x0181f19e,0x1eca674f},{0x028e01c5,0x18d5dc8e},{0x0481246e,0xd1a8b69f},{0x01a0a129,0x7fc39596},
+{0x0280fb21,0x79549b1b},{0x0280280c,0x9b931987},{0x01a11428,0x6d03d401},{0x03601665,0x06d4dc36},
+{0x01c0a513,0x2ccfd3b1},{0x026119c4,0xcb83ff4c},{0x04202cb7,0xf27560bc},{0x028e0072,0x83c23d50},
+{0x02610355,0x4150d00a},{0x040021f7,0x4386aade},{0x02001b52,0x7ad638ab},{0x03202ad9,0xae3f9791},
+{0x01202445,0x28692989},{0x02802ec0,0xb6020cef},{0x02a01996,0x414f825f},{0x02c0273b,0xe25eb0f0},
+{0x03a0023b,0x643c74bc},{0x03c1f223,0x31813e2a},{0x02a011a1,0x729fd103},{0x03a016a6,0x0e1d011f},
+{0x02402ebe,0x24b2774b},{0x03012375,0x999dfb22},{0x02e131ae,0xf9b9851e},{0x0441f157,0xe14f4b44},
+{0x018022c6,0x95ad7219},{0x02602dc6,0x30e89aab},{0x02c1ee17,0xdc1e1857},{0x02a1d356,0x0352ea94},
+{0x03c11ab7,0x52e5438d},{0x024112dc,0x330b0509},{0x0301d40d,0xc24d0cbc},{0x0420fc81,0xead809ee},
+{0x0280043e,0x3084bad4},{0x0240a9c9,0x8e88eef4},{0x0541cf9e,0xbcc35767},{0x024188aa,0xfcdb9356},
+{0x02001c59,0x45b5c9c9},{0x0641fb44,0x7a58a7b0},{0x0381d10d,0x099a9126},{0x03a1d592,0xde916edf},
+{0x03400d43,0x3bec42a5},{0x04e1fa06,0x6cb46131},{0x02011127,0x06f0bd67},{0x02418a3b,0x473ab2b7},
+{0x03004df8,0xeabb051f},{0x02a00e09,0xda314e6f},{0x0440fc73,0x7e744013},{0x036001fd,0x6b0e7a42},
+{0x03000af0,0x5d92fcf7},{0x0261087d,0x593387e5},{0x0321d520,0x0da178ac},{0x04401d7b,0xa4b7d3f3},
+{0x03a0ab64,0x248c0043},{0x0401d21d,0x0241b6fc},{0x02602f2c,0x679447e4},{0x020030ae,0x3ce137b3},
+{0x03610ca6,0x8bbfdd4c},{0x05202a83,0x39905d2a},{0x03c1da57,0x7079d706},{0x03e18c7c,0x5492e7b1},
+{0x02c1314a,0x4cc0acdd},{0x02a02f36,0xa40e9029},{0x04e0278a,0x003d0fe0},{0x02c02d07,0xf0560e49},
+{0x0201d31c,0xfea89c19},{0x02c1f3e7,0xb8690376},{0x01c1e2da,0xbb554e78},{0x0260aaad,0xa4681ee4},
+{0x01402bd7,0x20d25fe1},{0x01c00b5c,0xc2054070},{0x0300ff74,0xd377265d},{0x02800d42,0x615de612},
+{0x0280a815,0xcf802f2b},{0x03e18cc1,0x79878bcf},{0x02401350,0x011cc04b},{0x0261b018,0x5663bdab},
+{0x02c13329,0x6f127aa8},{0x02e008bd,0xadf334c5},{0x032011ac,0x036bf77c},{0x04c01d93,0x095ec811},
+{0x02c1302a,0xf92499d6},{0x02802e37,0x6470c5c4},{0x042004fe,0xf3b9bc1b},{0x02e120ed,0x165d2eae},
+{0x03e03197,0xe8ab8e1d},{0x03211363,0x2d45a2ab},{0x02a029a6,0xbe125df0},{0x0420a835,0xb794d600},
+{0x03400831,0x1289d62a},{0x03200316,0xa88fcfe9},{0x02a168cf,0x614d8b73},{0x0301f033,0xad3ae7ef},
+{0x03e18c83,0x7c90e812},{0x02601a20,0xfe83d5ef},{0x02202ed1,0xf0180845},{0x02e13298,0x0aae5cf2},
+{0x01a0a3f7,0xc9fbb9f2},{0x046027a2,0x8a1c53cb},{0x024189c1,0x97be48c0},{0x02601339,0xbc7d4990},
+{0x0261b100,0x1ac29af3},{0x0221f213,0x94ad5aeb},{0x0360feb3,0x3bd26d84},{0x02418835,0xe8872cd0},
+{0x0341e836,0xb5288eec},{0x0201221d,0x794879fe},{0x02c12296,0xbc75c7c0},{0x026003f8,0x518feac6},
+{0x0421cf08,0xa4274be5},{0x046004e6,0x53bf1b46},{0x04a006ec,0x3db7ac3d},{0x03a1cf3a,0xa6c83b5b},
+{0x0421d23d,0xc168d980},{0x02210109,0x341e8d27},{0x0160330b,0x7cf85850},{0x02a01514,0xcbd6344d},
+{0x01a01959,0x51ef5521},{0x008026c6,0x86f58613},{0x0360fff9,0xb42f0b48},{0x02e00f3b,0xcd76a917},
+{0x03001d00,0xfbb8b60b},{0x02e133e8,0xa374edf2},{0x01c00b1e,0xc374ea67},{0x0360fb33,0x4e97821e},
+{0x02c1f067,0x69e95b33},{0x026014bd,0x316e7221},{0x0421171f,0x76da7baa},{0x04002c6b,0x43b25cb0},
+{0x01c0a33c,0x998b6498},{0x02418af6,0x5e0f7a46},{0x0181160d,0x1ff142a4},{0x04c1d0f0,0x9bd54429},
+{0x0281b098,0xf867a938},{0x0401e006,0xe31d4a33},{0x01e1e2c7,0x7d2ad3ee},{0x0441f156,0xd84f3d19},
+{0x03c1f1e8,0xb0244642},{0x03a0a7b8,0xfbefbb2a},{0x0201fa02,0xe125d31d},{0x02c02152,0xf0f397ff},
+{0x01e00e84,0xaafedb25},{0x034008db,0xc5f09829},{0x04c1d9dc,0x1bbdf120},{0x018026c7,0x8909fc19},
+{0x02e13389,0xf854a6e6},{0x02418a4e,0x2c4992c0},{0x0340030f,0x32e6276b},{0x03a02554,0x95ea2c7d},
+{0x02202fa1,0x90b9baac},{0x02418824,0x7b82040b},{0x03402500,0x3b1b7f47},{0x024106ac,0x7108ed92},
+{0x03610549,0xdfd8a542},{0x02a0156e,0xd6d7cbef},{0x01600980,0xf5e428d3},{0x01c11580,0x62226c38},
+{0x03011aee,0x8e3874b0},{0x02c13093,0xb028a24b},{0x02602bc1,0xfa90fcb5},{0x02a169c6,0xcdf51eff},
+{0x024122bb,0xb21a02fd},{0x02a028a2,0xaba424e8},{0x02e14643,0x68bf1e64},{0x02c01873,0x2bbc3468},
+{0x0340215c,0xc9067166},{0x02c130db,0x11ce0bbb},{0x00a1f411,0x7211fad4},{0x0200062c,0x8526f0ba},
+{0x0461d889,0xc59dd097},{0x04210158,0xbf2a65ae},{0x036107b2,0x5d5a034c},{0x0301f042,0x51ce54b2},
+{0x0240068d,0x9c41650d},{0x0341f141,0xfd010d4e},{0x026008e8,0x0c6f77d1},{0x01c0a57e,0x5094fc81},
+{0x02400715,0x87a75e2c},{0x02400d1f,0x9d3b7af7},{0x03616828,0x24a616fa},{0x02e1448d,0x0b0d7f2c},
+{0x02802812,0x0e8ffcf9},{0x01e0102a,0x00695dfa},{0x03002ecc,0x62c04902},{0x0301ed11,0x6c88eff5},
+{0x02a01b28,0xfcceab26},{0x03216e92,0x6b888775},{0x02211231,0x5f43a9df},{0x0200a511,0x2876464b},
+{0x03010eab,0x99a8b285},{0x02e1217b,0x5a00d737},{0x0201051e,0x15f1b698},{0x03e18b21,0x98d547e1},
+{0x028104d2,0x6cad5753},{0x01602254,0xde353005},{0x01603324,0x048c89a8},{0x0380143b,0x69cfbc04},
+{0x03012346,0x8ea84f6a},{0x02012337,0xf96ad392},{0x02812fde,0x9c0d7662},{0x02411062,0x56b350cd},
+{0x02816b11,0xbb4d8f25},{0x0361bc26,0xa11946b6},{0x028104c4,0xe8c61f6d},{0x03e18bd6,0x1adb9a7a},
+{0x02810884,0x8a8aefc0},{0x04c1d08b,0xba03dcef},{0x02c132c1,0xf89b9eed},{0x02010304,0x13811eb9},
+{0x02202fd0,0x1276face},{0x04a004db,0x6d3d8564},{0x01a0a02d,0x683a4cc6},{0x0320075b,0xa9a06828},
+{0x04402c5f,0x9e89e57d},{0x02801d57,0x6c8c8349},{0x020030d2,0x24ded354},{0x0161f984,0x2747032e},
+{0x016025a1,0x61346e75},{0x038001d1,0x2a31de63},{0x02418866,0xfae85c23},{0x03e00d9d,0x2a843503},
+{0x0221039d,0x613a50e0},{0x01e01727,0x8a963c6e},{0x02801474,0xe651d849},{0x02418a1a,0xb830d73e},
+{0x03800f15,0x462e9635},{0x03c1f225,0x0fbcb7bc},{0x0361ee4f,0x0084315a},{0x02011217,0x36db8db4},
+{0x02801d52,0x618c71f8},{0x03e1ed22,0x8969a30a},{0x0301d4c7,0x3ba11e7d},{0x04002523,0x0c45e717},
+{0x01402668,0x168393e6},{0x04a02a9c,0x4f7d49ba},{0x01c02b51,0x1e08e307},{0x02812fb1,0x16f26186},
+{0x03610551,0xd4b07a8f},{0x0241191f,0x538dab53},{0x02e11d41,0xa6a3e68e},{0x034015ed,0xf367d94b},
+{0x02c13085,0x3b212e57},{0x02a019a9,0xbf9eb4ae},{0x01e11116,0xcf838dde},{0x02a168d4,0xe953ad3c},
+{0x02e1079e,0x27f3fc0e},{0x0301f051,0x779fbf75},{0x02c111e6,0x3531900f},{0x02a12314,0xac1aa3c1},
+{0x02e12297,0x56761afe},{0x01a0a0e1,0xe4cc606e},{0x02c130f5,0x1ad4d5ab},{0x01c10b08,0x1dd8b6cc},
+{0x014026bd,0x8c89166f},{0x04c02561,0xd8a25090},{0x03602481,0x662960ac},{0x01a0a0b8,0x28970afb},
+{0x02e14502,0x86a2a207},{0x04001c96,0x9b5c0072},{0x03001114,0xa2908ca7},{0x02a0125c,0x2b6385b8},
+{0x0461da21,0xc26302bc},{0x0160a4b2,0x8fd4058e},{0x03c01ea3,0xd24cd1b5},{0x01e01c10,0xd25887bf},
+{0x02a1ee15,0x81460bce},{0x02816833,0x164d1f11},{0x0241886c,0x04e86be1},{0x02e14460,0x9f8bfd39},
+{0x03602a96,0xf0e742eb},{0x01e030aa,0xa73c3890},{0x024012ea,0xfd0b70de},{0x03000264,0xce97bd64},
+{0x04e0022b,0x16f51561},{0x02410353,0x38356770},{0x02011325,0x2da7a0c1},{0x0320089b,0xb9c7c450},
+{0x02c0fe5c,0x09bfc68d},{0x03402994,0x23630b8c},{0x02210fef,0x88ec9294},{0x0140237e,0xc087950c},
+{0x030100c9,0xa2e41667},{0x02600050,0x62151591},{0x03210c10,0xd46f0907},{0x0320ff8e,0x1670cd0b},
+{0x0361680b,0xe043e84b},{0x02c01cda,0x53a445e9},{0x0361f748,0x694db4f5},{0x0280033b,0x97e29263},
+{0x03416e5a,0x84d544f3},{0x028119be,0xb821caf0},{0x01e0a93b,0x915bbe66},{0x01c0a3b5,0x632c9857},
+{0x0381d1a3,0x9ff982fc},{0x030008dd,0x10c2f396},{0x03a12487,0x62330d1d},{0x02e02ac5,0x40685437},
+{0x0340034e,0x68fb4ecd},{0x02001c47,0x2b1ef19a},{0x01e0a842,0xac24e9f1},{0x01c1e2d6,0xd366bd61},
+{0x03010a8f,0x952e6e74},{0x0521f819,0xf3183717},{0x03a0fa97,0x334a8acb},{0x0241891d,0x92276d65},
+{0x0181e293,0x32a13aa6},{0x02600662,0x4df49963},{0x02ce0057,0x7c3c7dae},{0x01c0ff0c,0x7bd9c70b},
+{0x036015b0,0x4cea29b6},{0x04402cbc,0x85fe000b},{0x03010882,0x3d809563},{0x02600047,0x73153054},
+{0x01e0aabb,0x7412a7eb},{0x0220007d,0xae529066},{0x02e01bd3,0xfbf7a8e0},{0x0341d6be,0x2d306f20},
+{0x03e02b5a,0x42f4f2f6},{0x03e02ac4,0xf9e44335},{0x0200a847,0xbc044aaf},{0x02002d66,0xe457a9cb},
+{0x03e02cd2,0xc935da0e},{0x01a0a5d1,0x110ee552},{0x02e11a1e,0x03f8f729},{0x0261b06b,0x27ef8d89},
+{0x04002788,0x20080899},{0x020030db,0x22ded02e},{0x048124b8,0xb84d9038},{0x01e03118,0x86fa0451},
+{0x0301441b,0xdced29e7},{0x02ce004f,0x643c57e6},{0x03a1cf35,0xd6e9a918},{0x02202ce8,0xbf7c3918},
+{0x02c0261f,0x3062d724},{0x0381f706,0x54c4e5a9},{0x0361e8a1,0xa25373b9},{0x0341bc7a,0x9bf41437},
+{0x02e14520,0x87b3ecbb},{0x02a00f34,0x5d6e0a9b},{0x03e1e028,0xff44d591},{0x024029c7,0xece57629},
+{0x03e01fb0,0x64a67959},{0x04000205,0xaf51872b},{0x0301d454,0xadca0ba5},{0x0240a761,0xe1baf9f9},
+{0x01003381,0x79a8325b},{0x02c169a5,0xd07e69ec},{0x04c1d022,0x7574e79f},{0x01400023,0x8db90611},
+{0x0320fedc,0x0c9b413b},{0x02e145f5,0xf3f99f94},{0x03e18c45,0xf69aa27c},{0x02210465,0xfc2d9cf3},
+{0x03410cc5,0xf5255c0e},{0x03c1f212,0x3cf940b7},{0x0521da03,0xea2b8b41},{0x03e004c5,0x53799e4b},
+{0x0200a852,0x4d1ab3c2},{0x03a1d053,0x3921005f},{0x024019ea,0xc9ce20ec},{0x02401bae,0x1e8ffab3},
+{0x02a0316f,0x761317c9},{0x0380ff22,0x47eccc6c},{0x0260131e,0xeeded113},{0x0241f30e,0x201ae6b9},
+{0x02410f79,0xc6b89225},{0x0261b02f,0xcb4660c6},{0x02012308,0x84e4c646},{0x0360abe1,0xf3a3891a},
+{0x0461d6db,0x74405bf2},{0x0181e291,0x96b0e29c},{0x02c00811,0x344776f4},{0x034017f7,0x8251ce45},
+{0x0421d009,0x554a8fe2},{0x03e18ba8,0x1ae8666d},{0x03401424,0xa1f2b91e},{0x02a1f58a,0x7d769e37},
+{0x02a002ec,0xda7752ad},{0x0180a4b6,0x53c3be77},{0x02c168fe,0x17f94869},{0x02802803,0x098db683},
+{0x05000c79,0x417f8887},{0x0261b094,0xedd6c5ff},{0x022010d1,0xf26a1e9c},{0x02e0067c,0xeff80efc},
+{0x04a1d65b,0x421b18c7},{0x026e0124,0x22a6411b},{0x04c02568,0xe6d43f42},{0x02c0a7b4,0x499759b1},
+{0x01a116a2,0xc5f5c358},{0x03a1e144,0xb03fa638},{0x03e18cc8,0x808796d4},{0x0361e856,0xfcf4b7af},
+{0x03e18c1b,0x33a1be48},{0x016023fb,0xebc2c01e},{0x03202c50,0x6ae33950},{0x02e00649,0xdbd90903},
+{0x02c16f50,0x3d39673a},{0x02a02829,0x3f24dff9},{0x0381d495,0xb21ffaeb},{0x04001c95,0xa08291fa},
+{0x0361d066,0x02b23425},{0x02800c0c,0xecfbc3e6},{0x02c0056d,0xf86e24a6},{0x0580fd57,0x180edec7},
+{0x022006bb,0xa5b05a1f},{0x01a10926,0xa4bf70d1},{0x02c13283,0x85ab843d},{0x01a00b1c,0x6fc68860},
+{0x02e145e0,0x7af463eb},{0x01a01751,0xefe4e53a},{0x02400735,0xb1491343},{0x02e10577,0x8e662ebc},
+{0x02e13196,0x9a6ea669},{0x02c1f0d4,0xb2e1421b},{0x02201198,0x77a057be},{0x02a003a6,0x30284ae8},
+{0x03c120c0,0x3e3225d0},{0x02a12287,0x43b63e76},{0x0261d85a,0x0fa62faa},{0x02e11946,0x388f0edc},
+{0x00e1f6f4,0x39e3ee64},{0x05a0fcfb,0x20b48fac},{0x03e1df06,0x9eab7704},{0x02a1e907,0x996b22ef},
+{0x0300feea,0xae54a97c},{0x01a0a4dc,0x03216d0b},{0x01e10e6c,0x39116691},{0x0221080a,0x09c5582d},
+{0x03801462,0xd9f96eb4},{0x03e120e6,0x7ff93d95},{0x0360aaf5,0x64ab6ee0},{0x02c0ffc2,0x4f75be00},
+{0x0581d969,0x0146fd87},{0x04000f06,0xecb16589},{0x02e144ea,0x8aa72581},{0x03000426,0xf074ae78},
+{0x05802a12,0x837b538d},{0x02e1d904,0x6a1673a1},{0x04c1cfab,0xc9d19338},{0x01a1028e,0x05ee19d0},
+{0x02200f5c,0xd9f086eb},{0x01c0a5fa,0x6aec2018},{0x0300303f,0x6a61246e},{0x024115c3,0xa33de9b8},
+{0x0181170e,0x43f363fb},{0x0320d7e8,0xbf21ac2c},{0x0441d920,0xb6c66d0c},{0x0100301c,0x28673348},
+{0x03e1cf36,0xf600f66e},{0x02c0066b,0x776c143f},{0x02010626,0x2a2879e4},{0x01202610,0xb901da80},
+{0x02418812,0xed7ca753},{0x02e14646,0x61bcd4c8},{0x0240d7bb,0x589e22c1},{0x028e0195,0x8360574a},
+{0x0160aa00,0x69c2a403},{0x022111d7,0x8a7556d9},{0x02000a32,0xc5e7ea58},{0x0181f1a8,0xc732c43d},
+{0x01e11ee1,0x1ea27743},{0x03e1d716,0xc2c5f70d},{0x01600a72,0xa669b35f},{0x0221f7e8,0xd3dbe5d3},
+{0x02000cb6,0xf0ff9a23},{0x03a1f843,0x7aa078c7},{0x04a0fc34,0xe11e4271},{0x0401689e,0x1809a123},
+{0x04c00231,0x1492c644},{0x0461cf98,0xc2765212},{0x01e1e2e5,0x596ae91d},{0x02e11a28,0xe807d59f},
+{0x0481cf59,0x616d371b},{0x02210827,0xf1dc8bb4},{0x0381d8f6,0xe8707e97},{0x018031d8,0x8c8fbdfb},
+{0x0481d8a4,0x6b049cdc},{0x0321d7d7,0x73622637},{0x02602b09,0x4870a807},{0x02402f12,0x2657c9e2},
+{0x02c025fe,0x7ca20719},{0x03801e82,0x85f11968},{0x02c11a85,0xd564a901},{0x02e1d90b,0x267d57d6},
+{0x03802a3b,0xee87d449},{0x0381d489,0xbe200dcf},{0x0360fb71,0x5f925969},{0x02418a2b,0xb33fd9e9},
+{0x036015d6,0xffd3d640},{0x02418955,0x3785b28a},{0x01a0a004,0x77b4f397},{0x02418a59,0x59ae60fd},
+{0x024025b1,0x2525d3f5},{0x03c002ef,0x9d445dbd},{0x0400019b,0xb2940663},{0x01e122fe,0x7fd6914b},
+{0x01c0a376,0x338cc9ed},{0x0460fce6,0xc231d634},{0x0300a787,0x73176a6a},{0x03601453,0x2e63f4e2},
+{0x02a1d338,0x392e59dd},{0x02e1461e,0x6adc45d5},{0x0461d073,0x8c7a0824},{0x01c1f303,0x34222af6},
+{0x028018bd,0xdfe5f45e},{0x0341e848,0x08ebb5e7},{0x02412051,0xf6b20757},{0x01c0a6cb,0xfa838973},
+{0x028e01b8,0x01d7f6f0},{0x03e1d039,0x49e4bc16},{0x0261b036,0x4b6e39b6},{0x02c111e2,0x6a2399c5},
+{0x0281696d,0x4dfec2dc},{0x02e01b46,0x1d29ee5b},{0x02812fed,0x3a64f4bd},{0x038018f3,0x67505199},
+{0x02e02e02,0x83240f87},{0x02e00412,0x7c219835},{0x04c1bc77,0xc1bd6c9f},{0x02e002cd,0xc6f78730},
+{0x01800b09,0x4cedee2c},{0x00c1f9df,0x260bca9f},{0x02c1215f,0x741326cb},{0x02411340,0xaf64281c},
+{0x02e145d8,0x70f21596},{0x034001e9,0x78b3ba64},{0x03e00df3,0xb1d98bca},{0x0260ff13,0xc4490c3b},
+{0x03e02cdb,0xddaa9ba3},{0x02000f24,0x4ec18f87},{0x02401695,0x8be1b73a},{0x02a00d3d,0xb9ecd374},
+{0x01c1102c,0x669a84e0},{0x02a02706,0x705e5051},{0x0381d4f3,0xc2cf9106},{0x03800267,0xc8554a23},
+{0x01e10702,0x37a1e801},{0x01e0a064,0x94804a0d},{0x02c011be,0x8c726481},{0x02418861,0xec691e08},
+{0x04a1d66b,0x321aff97},{0x046109e5,0x8f51f2e2},{0x01e1068e,0x4c3a10cb},{0x03200f94,0xe5e62e71},
+{0x02201182,0xd1afeff6},{0x0581cf16,0xd27c49ab},{0x01600749,0xe9022873},{0x02410a2a,0x2de01ee5},
+{0x0641d9ed,0xf71a9937},{0x03610c98,0xa4c004a7},{0x03a1f76b,0xacb6efc8},{0x02e10425,0x791aaff1},
+{0x028168ef,0x4ce222a4},{0x01e1fb0c,0x9dae8765},{0x0241893c,0x247ed8dc},{0x0261b038,0x4b5f2f2c},
+{0x03211a24,0x175676cc},{0x0341d88a,0xb9eb3320},{0x0100203e,0x95e6362d},{0x0261b0c3,0xd3cbf7b9},
+{0x0141f961,0x8a643687},{0x02411c54,0x9e86e033},{0x0301f7bb,0xf9747486},{0x02418a1e,0xae3d9373},
+{0x02402321,0x22b0831b},{0x02604de8,0x0fd9cab5},{0x01e01026,0xf09ae196},{0x01e10481,0x752f720a},
+{0x0281b07d,0x0dcd53af},{0x02a1f481,0xe2a6cf2d},{0x040021be,0xd1c10606},{0x0520a78e,0xcfa013f0},
+{0x03210cc1,0x49916240},{0x02801a21,0x639abcef},{0x01602257,0x0864b6d0},{0x01a033d4,0x68dc19e0},
+{0x02403137,0xe6f69772},{0x01c0218a,0xeaa47d5e},{0x0281d329,0xb93b14ae},{0x01e10519,0x6975bb1c},
+{0x03a0fad2,0xa77c8105},{0x02e120cd,0xacf59128},{0x01c0a35c,0x09648b20},{0x010033bd,0x5fb05832},
+{0x02a101d8,0x74a93ed5},{0x03e18b2f,0xa9d562a4},{0x02c02477,0x4bafa7c2},{0x024112bd,0xe055dce2},
+{0x02418a63,0x4fac12a8},{0x01a0a0b5,0x2c971147},{0x02010453,0xd68f7c29},{0x038000d2,0xe13382e5},
+{0x02c0a82b,0xe1bce55a},{0x02e0aa4c,0xe9d2e9c7},{0x03e18c78,0x799321f0},{0x03a02dfe,0x383b4fa1},
+{0x02a02614,0x742d0a0f},{0x01c16aa4,0xe8e88dd5},{0x02204dd7,0x80e20363},{0x020111a6,0x2a869f32},
+{0x0561d837,0x6bcc0c2e},{0x0340a786,0xdfe73975},{0x0180a1f0,0x3a6129d3},{0x02411182,0xebada217},
+{0x0361d1e8,0xf97776a3},{0x01a0a3ef,0xfe292b6c},{0x0381d1db,0x05fbc707},{0x01c10e81,0x7887bf50},
+{0x0261b026,0x4c502635},{0x03216e59,0x61854385},{0x03402b54,0x1fd7954a},{0x02e0a97b,0xd8b5a94b},
+{0x0121f30a,0x6dbbdfd1},{0x02801343,0xc4714fd0},{0x030025c4,0x1585405c},{0x02c12008,0xca261c70},
+{0x07402968,0xb393315f},{0x04c0ab36,0x898d4a33},{0x02e14415,0x1d7db909},{0x03202ee8,0x27a92342},
+{0x03e1d72b,0x17f36281},{0x04400492,0xcfcd981e},{0x022032ea,0x0f055026},{0x02200a21,0x5857809a},
+{0x01e10e8c,0x72861bc8},{0x0401d8a1,0xe215b4b3},{0x02402fb3,0xca0cb0b8},{0x03a0fad6,0xa37c7ab9},
+{0x04c0fc1b,0xa830d573},{0x05001f52,0x34380143},{0x04c02567,0xb0448854},{0x02410f7a,0x526811ad},
+{0x0381d496,0xb11ff958},{0x02c132d9,0x4947a95f},{0x02c0031f,0xc559e7a9},{0x00c02649,0x954c58fd},
+{0x02401936,0x37088f15},{0x02001a09,0x6b23c6e2},{0x01816f00,0xdda7ee24},{0x026100ba,0x5d4cbcad},
+{0x03e18c0e,0x56a433f8},{0x0341f130,0xec00f28b},{0x0261f594,0x1e11437e},{0x01c0aaba,0x3a4bba24},
+{0x03001d02,0x69569a80},{0x02c02984,0x0d48005d},{0x02410a40,0xe8fb355f},{0x03e18b46,0x99c63eea},
+{0x02e13248,0x66747818},{0x0241f55c,0x33b572e8},{0x0400038f,0xa4d60103},{0x03e1d09c,0x339c7fb3},
+{0x02600048,0x6a152229},{0x028e017c,0x0a65a8fd},{0x02418a73,0xd3a910dd},{0x02c133b0,0x8d139b7c},
+{0x01a0a5d7,0x31115649},{0x04802a81,0x794b97d8},{0x01c016e1,0x74811108},{0x0121f4e5,0x30f9d677},
+{0x02c006a1,0xf9a0ff4c},{0x04202ac1,0xadad8c49},{0x0540fd84,0xba649ef4},{0x038107ba,0x3c3b74ce},
+{0x02001aa2,0x2641e1d0},{0x02c131e9,0xc602109c},{0x00e1f437,0x717792a6},{0x03e18ccc,0x4b874365},
+{0x026e0147,0x998b25f3},{0x01e16f85,0x13af21bb},{0x02c12286,0xb3dacbb8},{0x046025a8,0x2e9b9066},
+{0x046004d2,0x5494a210},{0x028e01b7,0x02d7f883},{0x02a02174,0x4a324991},{0x020030d4,0x64ca1d5c},
+{0x03a0a66b,0x86920479},{0x0440fdf4,0x3141cd55},{0x02e01d77,0x68798253},{0x02e122c7,0x5249b98c},
+{0x01c0a450,0xf1840b0c},{0x0201106d,0x5918f4c4},{0x010033ca,0x5db710d1},{0x0641fb63,0x0dca8cd4},
+{0x0341e838,0x680ad96e},{0x02c001f7,0x2c4efe7f},{0x03a02b0f,0xe8d2857a},{0x01c0a613,0x2f4045ee},
+{0x028169d6,0x87eaa5a9},{0x016031db,0xd8702d35},{0x02002b1b,0xbc9b2cfc},{0x03400367,0x341b750f},
+{0x03e18bfc,0xafe10237},{0x0260d7b0,0x132d2a0c},{0x02602f31,0x7a9bedf5},{0x01402640,0x044f92c8},
+{0x02401240,0x251f378e},{0x02e130b9,0xf67fa099},{0x01c0aa12,0x3070cbaf},{0x038006ff,0x34cc256f},
+{0x026033a8,0x8b8ac161},{0x01811425,0x381030f3},{0x03811af7,0x04456e9c},{0x0320a964,0x0e2cca13},
+{0x05601ce0,0x39a9a809},{0x0440a7a7,0xe1efc5ed},{0x050001db,0x6e3d38a1},{0x01c0a3b9,0x671499bd},
+{0x04e02543,0x47bfd4bb},{0x0341e83f,0xad9889ad},{0x02812211,0xfb54b269},{0x0321f10e,0xa010c20c},
+{0x0381d4f8,0xc7cf98e5},{0x03411660,0x5676a488},{0x0241885e,0xe969194f},{0x04202974,0x8a3e5008},
+{0x0181f403,0x9bed9b61},{0x02600b0c,0x37a48bb6},{0x02e109aa,0x79cab225},{0x026124f1,0xc4391ad3},
+{0x02c132c0,0xf79b9d5a},{0x01e12291,0x63e56fc1},{0x03002503,0xd5fd5672},{0x0461da73,0x0049e7c5},
+{0x01c1f315,0x2c3d7779},{0x03c10795,0xa2c91559},{0x03e02958,0x43381adc},{0x0261b02e,0xcc466259},
+{0x04c1f814,0xf43ade3a},{0x02400e48,0xc9860baf},{0x026e012d,0x1ba3f77f},{0x0260146f,0x127d4bde},
+{0x02401815,0x828285a8},{0x01a0a27d,0x9eaa8ba4},{0x0361da45,0x644855e8},{0x02410388,0x240df71d},
+{0x01a0a36b,0xcf4d58cd},{0x03602aed,0x9de6b30a},{0x02e14459,0xa08bfecc},{0x022023dd,0x5332910a},
+{0x02a0abbb,0x39209d68},{0x028110f0,0x50bfb166},{0x0300fed2,0x5c59a2de},{0x01c0a5cd,0x37664574},
+{0x02816958,0x68fef016},{0x02611918,0xd2fbb6dd},{0x03e00db7,0x61b6dfd8},{0x02e1448e,0x0c0d80bf},
+{0x03201138,0xa5a676df},{0x020121f8,0xda025b2d},{0x0300ab45,0x2d18a49b},{0x03e18bd2,0x16db942e},
+{0x0481d8d4,0xeca661e7},{0x02a0a8ff,0xe53316b3},{0x05401f1a,0x66bb79b8},{0x0381e887,0x07501ff3},
+{0x026007f7,0xae2b566d},{0x0321f017,0x38273362},{0x02a1f37d,0x2cdf9af5},{0x03a1d027,0xf6053a4c},
+{0x03c005f0,0xdd407ba7},{0x02812f95,0xa8fc41b8},{0x03c1f217,0x2b936c46},{0x01c0fe49,0x5f437914},
+{0x02212193,0xde2c21ef},{0x02c0a726,0x0ff7a5bb},{0x01e10188,0x72a4362b},{0x01c0a1b1,0xc04fd302},
+{0x03202723,0xdcc413dc},{0x04001d9f,0x290d6d84},{0x0200168a,0x17139414},{0x0081f362,0xec0d178d},
+{0x0341d70c,0xc514b2cf},{0x03a02768,0x8d1eef55},{0x02012074,0x31f44ca2},{0x0481d942,0x5127267d},
+{0x01e013a1,0x01d565a0},{0x03401156,0x5711712a},{0x0180a00b,0x615b570a},{0x01e1f472,0xc850d14c},
+{0x03612256,0x8b864b32},{0x03e18be2,0x18ddd5eb},{0x01a0a1b8,0x538ca954},{0x05e0a767,0xcf5098eb},
+{0x0641d0d3,0xb6dedbe5},{0x02c13122,0x680f3c41},{0x034011c6,0x1a58b9bb},{0x0361d86f,0x25de31fe},
+{0x0401d8f3,0xae8ad78b},{0x01c108f0,0xb7a97b24},{0x02802d90,0xa763f9a7},{0x0281059f,0x3c2f9be0},
+{0x01c016b6,0xe5d41352},{0x02c130d6,0x0dce056f},{0x0480fcf8,0xfb228aa7},{0x026110e7,0xb8500b62},
+{0x02810398,0x49e05b11},{0x02e0044b,0x1d0d5694},{0x06801f92,0x8df02818},{0x0360044c,0x790c122a},
+{0x02a168ca,0x82ba840a},{0x02a0a825,0x07757ab5},{0x01c0a3bd,0x673ba92d},{0x03612402,0x991ef903},
+{0x03a1211f,0x021945a5},{0x0241893f,0x29811f52},{0x01e10720,0x0469a2ca},{0x04001cc2,0x1e93734f},
+{0x03c1242a,0x23688ce6},{0x03216b1d,0x040bcbb3},{0x02812fe8,0x3064e4ff},{0x02a01519,0x05c307e3},
+{0x0201060d,0x9c2fe91f},{0x0241880e,0xf97cba37},{0x02801a46,0x1f0f7bd7},{0x0181fae1,0xc180fa3b},
+{0x00e1f6e2,0x9d16b25f},{0x03800157,0x90cb0d48},{0x04e1d01c,0xd5cc44da},{0x02212054,0xb69555b5},
+{0x0341cf22,0xce37d6e2},{0x01611131,0x64ce2bf4},{0x00a1f9e3,0x603973de},{0x00e02106,0x669924e0},
+{0x03e1d09e,0xfa8fa09e},{0x02c130de,0x0dd04406},{0x01e0172b,0xb680bb63},{0x03c0277b,0x9dbc2cb2},
+{0x020030ab,0x2cd69127},{0x01c031e1,0x93b36e2c},{0x01e1e2f4,0xf3c72484},{0x02816972,0xbfef7aff},
+{0x03014485,0x873aa3c5},{0x01a01696,0x3230b75a},{0x02010642,0x2e469544},{0x0260118f,0x60716636},
+{0x032020df,0xcb6b8f4b},{0x03a002e9,0xd5a24349},{0x022010f4,0xe0a97df2},{0x04601807,0x02e69a5e},
+{0x01a0a287,0x7c795e7b},{0x02210f36,0x9f3e28e7},{0x0340013e,0x7a88be93},{0x03e1d0eb,0xc3ab9698},
+{0x02e14611,0x7a012e4b},{0x01c1f106,0xa22e8efd},{0x028e0188,0xf067bea6},{0x03c02094,0xf1a9b229},
+{0x01e11581,0xf530c27b},{0x0481015e,0x0b5d8be8},{0x0421d62f,0x3cb1d9f8},{0x02e01c25,0x334ae3ba},
+{0x02e131d2,0x881e19df},{0x02c10421,0x99c0aa28},{0x01e0a942,0x42c14ae8},{0x01e16f65,0xf1a5f1d9},
+{0x0521d928,0x923b35b4},{0x02402e96,0x759ff5cd},{0x0201074e,0xd54a2404},{0x0421d80c,0x94fa60c2},
+{0x03410842,0xfab89266},{0x03402c40,0xfcf66368},{0x0220006f,0x20575965},{0x02c02a24,0x0bfaf32b},
+{0x0521d8fc,0x9c27f8c0},{0x0241893b,0x257eda6f},{0x038020e1,0x5753468c},{0x02a1ee0f,0xbd760643},
+{0x03401e81,0xb638797e},{0x0420a788,0xdc87a8ee},{0x01e1182d,0x647d82c3},{0x01e01c68,0x049620bf},
+{0x02e118d4,0x7c821df8},{0x028e01af,0x795e08f5},{0x028168bc,0xa0b6745f},{0x0141f6b3,0x6430b018},
+{0x02010493,0xd7c9128c},{0x02e0289e,0x9480d81c},{0x0261fb8c,0x039ea73b},{0x02403274,0xfffeba73},
+{0x03e18c0d,0x57a4358b},{0x01e03127,0x7cf9f493},{0x03e01427,0xbd2cd4cc},{0x03e0fdf5,0xb285e957},
+{0x03a00511,0x7472f924},{0x022007e0,0x025a367f},{0x01e0a264,0x2ee208a4},{0x03e0a668,0x5cf0706f},
+{0x01400027,0x812eac64},{0x03a1cf74,0x4cab2446},{0x05c03034,0xdc5bd4ec},{0x02202f88,0xdee36b37},
+{0x0280aa83,0x07cd36af},{0x0301229b,0xd1360d59},{0x01a1168f,0xc20dc1f2},{0x01c0a42c,0x08e52d28},
+{0x02200075,0x36577c07},{0x040001ab,0x8655cfae},{0x010033c3,0x719f2b67},{0x03601b0e,0x7c43021b},
+{0x02e1324b,0x647474f2},{0x03012482,0x40ed7a17},{0x01c02280,0xdc406fe5},{0x024189e0,0xa4deb0e2},
+{0x03011ae9,0x4f302f9d},{0x0341d210,0x104da54e},{0x0401d54a,0x32895af9},{0x02e14609,0x79feefb4},
+{0x0361d5c1,0xd19c9c3e},{0x0321d02f,0x04ad9ac5},{0x01c02bc9,0x995514be},{0x02e0a9e8,0x5bf284ee},
+{0x01a0a440,0xc1570f4e},{0x01a0a100,0xbe9a57d8},{0x02800371,0xdcfaf206},{0x0341e80a,0xe45c8c94},
+{0x02c13190,0x0d2c6bf4},{0x04000404,0x34ce4c54},{0x0340fbb7,0xcf95fcbc},{0x01c00b5d,0xa6141ee6},
+{0x05402936,0xd2167224},{0x02a02983,0xd92ce7ae},{0x0281f3d7,0xef1b57dc},{0x0221046b,0x2e709312},
+{0x02e13217,0xe95542ca},{0x0121f1a6,0x2e70040b},{0x02e13388,0xf954a879},{0x04a00522,0x36c09f61},
+{0x03200946,0xc33a9f4c},{0x03812438,0xa06840c5},{0x02c018e9,0xe6662862},{0x032011b1,0x32cf5796},
+{0x03000c44,0x49f430cc},{0x0401135f,0x67cbcb23},{0x02c0a92d,0x2e2a7c38},{0x020030d9,0xfced9ee6},
+{0x01c0a507,0x1c783ce1},{0x02a1f37e,0xfeb5d981},{0x030021fd,0xa3f734f5},{0x0381ed18,0xd36b59d7},
+{0x01c0a07e,0x126281de},{0x02c133bd,0x9715e9d1},{0x02c016a0,0x3030c393},{0x01e11097,0xbe4c6a46},
+{0x0241eca0,0xea3adf2e},{0x02a1e90f,0x3a69de1f},{0x01c029d6,0x272816b8},{0x0260092d,0x7b726790},
+{0x0260127b,0x4e864343},{0x02a01537,0x53acb89e},{0x0341f619,0x0b159501},{0x02211a69,0x15ddb0a6},
+{0x0621d99a,0xc3f27405},{0x01a0a60b,0xf91dca14},{0x0261b052,0x47e10eda},{0x01c017e4,0xd54545d3},
+{0x0241e93a,0x4dd9bc45},{0x01e02f21,0x4ec29127},{0x0640fda8,0xef438e83},{0x04802505,0x3a5cf9ac},
+{0x02418964,0xb488b5e8},{0x02810f09,0x9e57c25e},{0x0160333b,0xc5885c05},{0x0261e2a4,0xb4860104},
+{0x034001d4,0x202db252},{0x02e02cf9,0x1205ab16},{0x042025d4,0xc4b03e52},{0x03a1d593,0xdf917072},
+{0x0220248b,0x0de8c3ef},{0x02c1da1e,0xe1b68d68},{0x0320a9a3,0x4032b1ee},{0x038001d3,0x16565191},
+{0x022010db,0xf62cf899},{0x02000996,0xdcaebc51},{0x01c02262,0x47695a30},{0x028169c8,0xb5fb5731},
+{0x02001045,0xb18e0c4d},{0x032015ae,0x0d3b776f},{0x03600507,0x2fbfaec0},{0x04600ddc,0x7b26644f},
+{0x0380ab3d,0x6aacd860},{0x02a0a9b6,0xc3d41773},{0x02201832,0x741fbc94},{0x02c1313f,0x44c0a045},
+{0x02616e82,0xc2c54978},{0x02c1fa53,0x73c6a624},{0x02601455,0x14a69d0b},{0x0320a780,0xb2f649a7},
+{0x02611916,0xa050941d},{0x0381e141,0x3fcab998},{0x01a11134,0x5158a3d1},{0x0520fdb7,0x97dbcd16},
+{0x0180a1fa,0x7e437fcb},{0x02c168e1,0x2cfe2fb8},{0x0340feb4,0xff29d078},{0x03410542,0x5f382fa5},
+{0x022032e9,0x17055cbe},{0x01c11018,0x8a5a1636},{0x00e1f9ca,0xf2a506f5},{0x0301d1a7,0x8da3f056},
+{0x02802f20,0x5547c125},{0x02402eba,0xd829b5e5},{0x03011a0e,0x65ab5150},{0x03e02cc6,0xb4e74c58},
+{0x03200255,0x493cae1b},{0x02610a1e,0xb4fa82a7},{0x01a11fb0,0x37d7cf6e},{0x03000428,0x334be1e6},
+{0x02001011,0x68a564ef},{0x03802c14,0x51f56e67},{0x02010e70,0x4178bad1},{0x02e1234b,0x7babde4b},
+{0x01c10e96,0x4873ec08},{0x02e144ef,0x86a71f35},{0x02802387,0xd99e9fcf},{0x02c008d1,0x89f3ea19},
+{0x02812fb0,0x17f26319},{0x02812feb,0x2c64deb3},{0x0361e8a0,0x6c07f5fd},{0x01e11213,0x8ab16a35},
+{0x03a12266,0x7f56d976},{0x02812fc3,0x27f6f977},{0x034121ed,0xf1471383},{0x02a10440,0x91773e47},
+{0x02c0325b,0x63bd854a},{0x02e1448b,0x0e0d83e5},{0x04c001d8,0xcebd8673},{0x01e114af,0x6f5a14bf},
+{0x0121f40a,0x3114abab},{0x0421d22d,0xc97a2f39},{0x02c01995,0x33f9e310},{0x00e0262f,0x19c7d7d2},
+{0x0401014a,0xdc9f3de1},{0x0201f6b8,0x5b38404e},{0x0201149b,0xcb434b37},{0x04002b49,0x860ef1bb},
+{0x02802fa0,0x199f024b},{0x024112d0,0x5f7b8da4},{0x03c02c2c,0x07a23fac},{0x02602f8d,0x0429c515},
+{0x0240102e,0xf64c1986},{0x0361d5bd,0xcd9c95f2},{0x03a01e37,0x56753b90},{0x03010855,0xe35ca294},
+{0x01a0a0b1,0xd8aa14c3},{0x02210816,0xddcb2317},{0x02601210,0xef75a83b},{0x03a1e149,0xe37e878c},
+{0x02c1336f,0x99c3527f},{0x03416963,0x344c9e66},{0x04002619,0x562f257e},{0x01e106b9,0x31b327b0},
+{0x02e145ea,0xeaf752d2},{0x03c01d03,0xc2763a62},{0x02010316,0x238137e9},{0x02202fa3,0xbb59f7d8},
+{0x02c025cd,0x2d5c0f02},{0x03410cd5,0xfff74f46},{0x046033e9,0xad436dce},{0x04801ee3,0x950017c5},
+{0x02c1f672,0x94bd62fd},{0x026012ef,0xc408089f},{0x02c131d7,0x53fcdff8},{0x01c1fb02,0x3e2ecc80},
+{0x01e0a579,0xd597fdba},{0x00c1f36a,0x1b06113f},{0x0181f5be,0xe13a05d7},{0x01a0a2cf,0xf428c233},
+{0x02e104b6,0x3b4eac8f},{0x0240a8a6,0xe9cf77cc},{0x03e18be8,0x12ddcc79},{0x03c0fd42,0x1749d027},
+{0x04002789,0x5aad586c},{0x0240067a,0xbd0339d1},{0x0161f633,0x248ea0b5},{0x01c0a1df,0x52d0e1ea},
+{0x02602b08,0x162a5809},{0x02002e0e,0x544cac0b},{0x03801898,0x2bfa466d},{0x0181f355,0x908127fa},
+{0x0201051a,0x5d2b0c14},{0x0341d13f,0x8af81449},{0x0220aaae,0x01c184fe},{0x03e18c50,0x0d98881a},
+{0x04e1d08a,0x55f99ea1},{0x03c0ff6e,0xf506dabd},{0x0281f6a6,0xd39ed53c},{0x03e18c98,0x7d8eab0e},
+{0x0281e91a,0x5f00233d},{0x02201163,0xd7c7fe4e},{0x0421e881,0xbf88b3d1},{0x01a0a3ad,0xae7b42f3},
+{0x03803196,0x3adfdc39},{0x02011c84,0xd39762e8},{0x024189d4,0x20c5dc30},{0x02602dda,0x30a91eff},
+{0x01802309,0x45afc6a0},{0x0281f1a1,0x79db1ab1},{0x02e1461f,0x6bdc4768},{0x0480295d,0x3263eca5},
+{0x024012ae,0xdee8af62},{0x0360fef1,0xa4abf644},{0x02e1058e,0xd68b70ed},{0x01c0a2fc,0xa4b7e262},
+{0x030124b5,0x26ec776a},{0x0220ff0e,0x9fc9339d},{0x0260ab53,0xf8849436},{0x032121bd,0x4f800402},
+{0x03c01f70,0xe9791669},{0x03a0151a,0x7cde0a73},{0x0481fbb7,0xb8516c7a},{0x02e12493,0xf9e9e2a6},
+{0x01a0a11b,0xc7c8841c},{0x02611c1b,0x5c6e4ec1},{0x01e0a2d7,0x38a900db},{0x01e0332e,0x747d7b28},
+{0x0441d977,0xf95ef66b},{0x0221f5f6,0xc5ae4119},{0x03602c4d,0x639a0f70},{0x02c1da65,0x694c89bd},
+{0x02c1231a,0x93ba713a},{0x0621fb4f,0x77a86e9b},{0x03016b81,0xc8e480b9},{0x05801f67,0x2756fdb3},
+{0x0321df1e,0x0962068b},{0x04e0fcf4,0x9c49ed71},{0x02c13064,0x0f9bd54e},{0x030022fe,0xf2eba294},
+{0x02e001dd,0x6a798579},{0x018026e9,0xdb83a2ff},{0x03e1ed28,0x46a63953},{0x0380a8bd,0xda0a4bc2},
+{0x02201a61,0xd3c209d0},{0x03a1d5b6,0x637bcaa2},{0x01e11fd6,0xa19a5f73},{0x03601618,0x3a9d5ef4},
+{0x01e01a50,0xe9ad552d},{0x01e10680,0x4a37cf0e},{0x03a00227,0xf9933b6f},{0x01a0a3e1,0xca245c62},
+{0x0581fbaf,0x6cd98ee9},{0x02602a10,0xc2847854},{0x01616a66,0x58dbbc3c},{0x028e01e8,0x91e1d3fc},
+{0x0381ee8d,0x1e477e04},{0x02002f44,0xdd02f097},{0x01e11c72,0x8d65bd9f},{0x04200108,0x99357a3e},
+{0x03e18c44,0xf79aa40f},{0x02c13076,0x3b236cee},{0x01c11453,0x07536013},{0x020009ab,0xa141f7d8},
+{0x0441d775,0x6f84a109},{0x0480fcbe,0x212d00d6},{0x04a0fc0d,0x6563de7a},{0x0381f7bf,0x9c071d6b},
+{0x01e1065b,0x4d2d466b},{0x03a1d5b3,0x627bc90f},{0x01a02240,0x2a9cfa41},{0x01e11ee8,0x72b8c1ce},
+{0x02a01b01,0x2a1c0a9e},{0x02a01399,0x2419a32f},{0x02c16884,0xb0ddd358},{0x02418a69,0x49ac0936},
+{0x02612230,0xce7638de},{0x00a02207,0xc4d3b01d},{0x0460fcca,0xe0ebb867},{0x0421d0c9,0x6ab77169},
+{0x0641fb59,0x1e598f1b},{0x01e1bc06,0xf96775af},{0x02600925,0x05323222},{0x0160a49d,0x29d5a393},
+{0x032124a2,0xfee13873},{0x01c029e2,0x6f4ebb45},{0x02e130e6,0x51e07097},{0x02812fb8,0x13f01e36},
+{0x03600dd8,0xee7564e5},{0x0441affd,0xca524870},{0x02a0aa73,0x2670a923},{0x0220a94e,0x2e6ed358},
+{0x02e13157,0x9e0b6c33},{0x02c133e0,0xcebbc593},{0x0320a676,0x5a595b8e},{0x0101f981,0xfd19a8f6},
+{0x02e02c80,0x2ff1d419},{0x03801536,0x87e4a515},{0x03a1240c,0x3629fae2},{0x01e110a4,0xcbbd4166},
+{0x0540fd85,0xd7252c22},{0x028e01c1,0x1cd5e2da},{0x0341d20c,0x144dab9a},{0x03812458,0xd814df4d},
+{0x03a1d5a6,0x537bb172},{0x04201cd4,0xa7fe4d8d},{0x03c12537,0x9c6d1de8},{0x0221f18f,0x6a669399},
+{0x01e111ae,0x713587e6},{0x03e18cd1,0x718540a0},{0x01a0a5b3,0xeb03708d},{0x024104fa,0x229d4594},
+{0x018027c4,0x87bec9f0},{0x01c0a26d,0xb3efd345},{0x0641fb48,0x90472ee1},{0x03e01e6a,0x7d5a52a5},
+{0x02210752,0x84f7da54},{0x02002249,0xa576eccd},{0x02418ac6,0xde193e22},{0x03a00182,0xe8bf433b},
+{0x01802608,0xb1c01d52},{0x03e18b89,0x14bc732f},{0x028e01c9,0x14d5d642},{0x02410f80,0xc701da5c},
+{0x0260a898,0x477cf2e7},{0x02610f77,0xa79ee04c},{0x0261b05d,0xc1f9d3ce},{0x0181140d,0x503b37c2},
+{0x02600e33,0xfec63435},{0x01e116b2,0xb31be6a1},{0x026012af,0x0b4bb419},{0x020103ad,0x8ab54948},
+{0x01a1f5d9,0x75e60d32},{0x0241b003,0x50eb0fdc},{0x02000f49,0xabedb0aa},{0x0621fb60,0x7f703000},
+{0x04a1f887,0xb5c9756e},{0x02418a3a,0x483ab44a},{0x01e0aa29,0x05b97afe},{0x0401d77d,0xc2388a80},
+{0x02402a39,0x65185377},{0x044026a7,0xbd3ea3c4},{0x026119bf,0xe77520d6},{0x03c024f1,0x106fa54c},
+{0x03e18bf4,0x9ce0e44e},{0x05c1d989,0x23e70e3b},{0x02402d5a,0xe180368d},{0x02a1d15e,0x6465af18},
+{0x00e02002,0xb69475a4},{0x02002f0e,0x3403b3ac},{0x03c10b4d,0xad4401a6},{0x02c132a5,0xe45d1c5a},
+{0x028021d3,0xacfacb5e},{0x05e1cf09,0x7e2332b9},{0x01a1f526,0xba401598},{0x01c11029,0x66579ef3},
+{0x01c0a4c4,0xa4d4f89f},{0x05c01fb2,0x76baf1dc},{0x02e144b5,0x8d03be76},{0x0241030e,0x3a84c0a2},
+{0x0301011f,0xfcb371e2},{0x02e1452c,0xf7ac4e46},{0x02a11d18,0xf153411f},{0x01a02623,0xaa455100},
+{0x02c00455,0x30f24328},{0x01c0195a,0x87ac5215},{0x020030bd,0x02c2c751},{0x03e0a66a,0xf6351e32},
+{0x01c00b5f,0x25327536},{0x01c0a939,0x893f170a},{0x03210cd8,0x559a6f80},{0x02c1da7a,0xc920ed60},
+{0x0421d933,0x6b330777},{0x03e18b5a,0xe8c8f9de},{0x03011a2f,0xf2973a5f},{0x02c1309e,0x3d25aeab},
+{0x02211002,0x6be75778},{0x03810f27,0x2ba3d329},{0x04801e4c,0xef4e7b41},{0x03a00513,0x58e10991},
+{0x01c00985,0x2f21d0f8},{0x03e01cb7,0x7943f8de},{0x02e01bc8,0x2ff37d8e},{0x01c1e955,0xea0291b3},
+{0x01e01c4f,0xae5d039f},{0x02c1f085,0x3760b665},{0x02e1f54e,0x4503b793},{0x026019e5,0x034a21e9},
+{0x02a0184b,0x160db56e},{0x02418af3,0x690f8b97},{0x01c02209,0x812e5f62},{0x03010120,0xb5021858},
+{0x028018d1,0xb38e5728},{0x020030ec,0x1cc52ed6},{0x01c0a6a6,0x7641ce09},{0x01e16f97,0x7a986fe7},
+{0x02816a01,0xc5c9d395},{0x0281e945,0xe89bf9f7},{0x02201a6b,0xe1c21fda},{0x0201f948,0x70d259b7},
+{0x02801539,0xc2e5c30b},{0x02c13382,0x29c06398},{0x01a0a525,0x302aec9c},{0x024010df,0x56b6bf12},
+{0x02812fba,0x15f0215c},{0x01e01aac,0xac3d8972},{0x01a0a2be,0xc25e8d77},{0x02a006d2,0x9eb4ac96},
+{0x02812fd9,0x990fb040},{0x03002158,0x4e183282},{0x0281e924,0xf45d9da0},{0x02a11da0,0x9172b015},
+{0x034024cb,0x3f65d485},{0x02c02d20,0x135020e4},{0x038018e1,0xd62c7526},{0x04010b6e,0xfa7b1496},
+{0x04a021f5,0x2b99e09f},{0x034015f3,0x1350b25c},{0x01e11c78,0xb16834e2},{0x02c02839,0x24057ac2},
+{0x03402501,0xdd57da98},{0x03012161,0xd1cde564},{0x02c130d3,0x0ace00b6},{0x02400c02,0x5c139e0f},
+{0x01a01950,0x19b0943a},{0x0200265e,0xd3aec1b9},{0x02c13016,0x881f6ac5},{0x03801d26,0x2416c557},
+{0x03410840,0x20581614},{0x04001d80,0x3e30fc74},{0x02e16f9d,0xef230888},{0x0380a8f5,0x0ac4c189},
+{0x028012b3,0xa8f682b0},{0x03010a88,0xe4b03ff2},{0x0121fad3,0xcd544dfc},{0x02000ceb,0xb3c59868},
+{0x03c01ba2,0xadadda4e},{0x0260238a,0x164021a7},{0x02c16909,0xcfdebdfc},{0x01c0a371,0xef81d185},
+{0x00e1f508,0x7029f962},{0x0561d0e3,0x0d75634b},{0x028110f9,0xdf1eb7ac},{0x03a0a8e7,0x7267245d},
+{0x03a1e87a,0xb466ae1b},{0x0461d8c3,0x4c018c12},{0x028014a6,0x04db8945},{0x02002f78,0x48eafda6},
+{0x03e0a720,0xac822de1},{0x022009fe,0x7a804895},{0x00e1f414,0x9296623c},{0x03e18b69,0x98caba85},
+{0x02600d91,0xbc98641d},{0x022005b8,0x223b7cfd},{0x03c029ce,0x39e10bfb},{0x028169cc,0x2f4a53c5},
+{0x03e01e2b,0x731e2513},{0x02402b28,0x83edb07d},{0x03410f82,0x604ad442},{0x03a1d16c,0x0beeeee0},
+{0x028005dd,0xa054106b},{0x03e018df,0x8f91c8c7},{0x02c1339f,0x23bbdcf8},{0x024112c3,0x5517dcf8},
+{0x02801a94,0x9ea7b21a},{0x03811ab3,0x2206e236},{0x0480fc3b,0xa29913e5},{0x02011020,0x1b059e4d},
+{0x0520fd87,0x18a62b47},{0x034004d4,0x54290322},{0x0160226e,0x6dfd6aa4},{0x02c130f1,0x0fd285c3},
+{0x02a10007,0x81d43902},{0x02818d06,0xead15408},{0x03010c41,0x53968df7},{0x04202782,0x32dab9bf},
+{0x02c121a3,0xbcd4f0bb},{0x0660fe39,0xb8cd4068},{0x03e1fb9d,0x83501956},{0x0381daa6,0xb233d088},
+{0x02816930,0x48730109},{0x02c130bd,0xab2ad903},{0x01e110ad,0x900e1298},{0x014027d1,0x411e1649},
+{0x0540fda5,0x75c1f6f7},{0x02e16857,0xec38c463},{0x01a01bcb,0xeed6febc},{0x042109d8,0xfbe9ba22},
+{0x03401dda,0x261b5f05},{0x0380016c,0xe809da1c},{0x0280a80a,0x4fefd616},{0x02a0abd0,0xa2af850b},
+{0x0381d4ec,0xcbcf9f31},{0x04e004da,0xeba4d707},{0x0300054e,0xb6843560},{0x03c01e95,0xcbdf6b35},
+{0x02a102e7,0xa16deaa4},{0x02001c72,0xb3c1d893},{0x02601a40,0xea612431},{0x03e01e88,0xb56bb3f8},
+{0x02c1308c,0xaa2898d9},{0x04a1d659,0x441b1bed},{0x03e18c13,0x84a23dcb},{0x0180a4c1,0x7ea77c68},
+{0x0221f028,0x24afd513},{0x02602e4e,0x2f70a85d},{0x03a10165,0xaaf42159},{0x02a02a0b,0x31a64010},
+{0x0321fb7b,0x5e8287a0},{0x01e009ae,0xd3327317},{0x04002252,0x87f19117},{0x02212369,0x76002c51},
+{0x030026fc,0x4c51d3e9},{0x024009c8,0x5d51f5d1},{0x026023b8,0x76c14bd5},{0x01c03162,0x5323419e},
+{0x01a02301,0x9681f4c3},{0x0340209a,0x09cbf49f},{0x02a01496,0x2f599034},{0x02e14530,0x02ac5f97},
+{0x02a02854,0x188e67f9},{0x03e18c2e,0x0a9f3f26},{0x0301200b,0xdcc81f01},{0x0481016d,0xb102f204},
+{0x02c13116,0x69117c6b},{0x030024da,0x49b6a2ff},{0x01c0a261,0xb3e545e9},{0x03210cdc,0x57826dc0},
+{0x02e16b86,0xbd5a6a9a},{0x0280039c,0x509f6783},{0x02001c18,0x410e274e},{0x0321f905,0x09d6a0e9},
+{0x02210312,0x945b9f86},{0x02418982,0x34903b2d},{0x04c033eb,0x019861de},{0x04c029e9,0xdfbb5eed},
+{0x02602dc1,0x3ae8aa69},{0x05602a68,0xf7fc6cf9},{0x0921fbac,0x5e458e93},{0x03c120d3,0x8f77e9d2},
+{0x02602ad3,0x8e9c5381},{0x028169c5,0x290017f1},{0x01611604,0x10b70895},{0x0301d36c,0x9787b212},
+{0x034011fe,0xd7eb6099},{0x054033fc,0x8e2c0402},{0x01e10688,0x4237c276},{0x02c12024,0x97306546},
+{0x05e1fa36,0x20bbeb05},{0x02202f9e,0x087c0db3},{0x032016d9,0xca941764},{0x0261b0cf,0xe6b88dea},
+{0x06e029a8,0x1c6604c1},{0x02c1303c,0xf7158c26},{0x02e01b3e,0x368325a9},{0x02602798,0x2bdb9891},
+{0x01a01692,0xea70ed58},{0x0381098c,0x8e06d609},{0x02418a53,0x33499dc5},{0x03a11074,0x19333c89},
+{0x026008c9,0x7c38fd09},{0x01a02eb9,0x7603ddba},{0x05a121dd,0x84242077},{0x032018dd,0xd38b8caf},
+{0x02601303,0x626ee74c},{0x02c16872,0xd49b722b},{0x02211a67,0x3292e366},{0x0360ff3d,0x1483e9ff},
+{0x02016f6c,0x615a145f},{0x0261b065,0x2934b3a0},{0x02800d3e,0x658f892a},{0x0320fea4,0xdc380894},
+{0x042011d5,0x5af0781e},{0x01e106f0,0x40c4886e},{0x0281fb87,0x51926d82},{0x03c02a49,0x6d2a2996},
+{0x0481d812,0x2ccc8521},{0x0160a011,0x4b8451ec},{0x02812fca,0x1bf4a7fc},{0x034115dc,0x652381e2},
+{0x04002c60,0x61cb8ef1},{0x02e13403,0x9ce50074},{0x0260272b,0xf71c4021},{0x02e1441e,0x257dc5a1},
+{0x02403021,0xb0886225},{0x01c0aabe,0x4e1a3cd4},{0x03402414,0x43f64b27},{0x02e100b7,0x55c64a38},
+{0x03610792,0x735a25ee},{0x02c1329a,0x84ba8d34},{0x022032d6,0x3707cdb5},{0x02802ddb,0x085001e2},
+{0x02e1e901,0x3f5f5e07},{0x01a007c3,0x059af974},{0x01a0a3d4,0x4255b01a},{0x01c11224,0xeaefd34d},
+{0x01c0a076,0xde75b7ba},{0x00c1fa85,0x0a63ef20},{0x022022df,0x41af94ba},{0x02201b9b,0xb09e9836},
+{0x02e10c30,0x7852dff6},{0x0301d7d4,0xa42fd5c5},{0x01c0a527,0xf13414a6},{0x02601a24,0xc9542edb},
+{0x03c02b10,0x98d59390},{0x04016e94,0xc17f37c2},{0x0340036c,0x311b7056},{0x03c000ef,0xb83535e0},
+{0x02c1bc66,0x2228c17b},{0x020116ad,0xecf592c4},{0x02418a5f,0x4fae513f},{0x02e0283e,0x9a80e18e},
+{0x044032c3,0x56978d4d},{0x0300fe25,0x1fe1e07e},{0x03c02ccd,0x843135ad},{0x02418905,0xa6188257},
+{0x03e18b8c,0xaebbd29d},{0x02c12283,0xcac3969e},{0x050002a2,0xb5f86e98},{0x02800e02,0xf9640fdb},
+{0x03c024ac,0x110149a7},{0x0400277c,0x2d31d9ff},{0x02e14488,0x070d78e0},{0x02602ead,0xd3d4bc5e},
+{0x0260004a,0x68151f03},{0x02200bd7,0x4f20748b},{0x01a0a29e,0x8b56947c},{0x02418a5a,0x58ae5f6a},
+{0x022112dd,0xcc7e7e5d},{0x04e1d0a7,0xa9d7e269},{0x06c01fa2,0x16e18815},{0x026018b1,0xe88c144a},
+{0x02202d31,0x170a95cf},{0x01c0a459,0x02528903},{0x01a11085,0x5db0cf4e},{0x0141f463,0x075c60a5},
+{0x04e1d9d5,0x786970af},{0x016023cf,0xfff1098e},{0x02c13188,0x062c60ef},{0x022112b3,0xf83e1c4b},
+{0x02a10cfc,0xd4d6edf5},{0x03810378,0x2bb89496},{0x03412392,0x46c0bc1e},{0x02a04dcc,0x2ed3e4e4},
+{0x0540fdc0,0x2d044d2f},{0x01a0a6e3,0x6b47ef4b},{0x00c1f9aa,0xc7768255},{0x0261b066,0x2a34b533},
+{0x01e106bb,0x3fb57c51},{0x046027eb,0xf4d0d5f1},{0x0361d000,0x16ead112},{0x0481d730,0xc2be01d8},
+{0x00e02717,0x22c628e5},{0x03a12018,0x200b8d29},{0x02a01e9f,0x2c12a4ae},{0x036004cf,0xdb52b1ae},
+{0x02e1443b,0x1b70e9f0},{0x024104f7,0x367d1165},{0x05201ec4,0xfdaa2e01},{0x03002a5a,0xf2c282ad},
+{0x02600f7f,0x4117a0cf},{0x02a1ee12,0x63f5e453},{0x02c029f2,0x6be52ffe},{0x0201159e,0xe7836454},
+{0x02601417,0x04aed2a0},{0x02010643,0x314699fd},{0x02a168f1,0x72f8e56f},{0x0381d1ba,0xc210976f},
+{0x01811629,0x500bd1b1},{0x02e04deb,0x9fe7bd3c},{0x04e1d97e,0x01d562d6},{0x03c1e10d,0xc60e2a19},
+{0x026012f7,0xea576578},{0x0460fced,0x674c5c18},{0x01e1e2ea,0xc014a4e9},{0x02e118f0,0x08557afd},
+{0x0301229f,0x53d9bf3b},{0x03c1f1ff,0xa9243b3d},{0x01a02b1f,0x4d2943b0},{0x0200248d,0xc94d792f},
+{0x0241884d,0xf08bb696},{0x0381f738,0x08b55986},{0x03e1ed1e,0x7a07a06f},{0x0221010d,0x5b80e7fa},
+{0x03e02b3b,0x5b0fc4eb},{0x02401370,0xfeb39d58},{0x02e130ab,0x5725e214},{0x02c1d353,0x31d4d726},
+{0x03e10b4a,0x21b8c701},{0x03a01123,0x2be6e771},{0x038011e6,0xcf92ee3d},{0x02801d4d,0x598c6560},
+{0x02601237,0xffeb91f9},{0x01e10b28,0xb53b2cf3},{0x0161f617,0x48749de8},{0x02e145e1,0x77f45f32},
+{0x01e1fb17,0x1cba8845},{0x0221f202,0xd0d28a38},{0x02410362,0x33f5e86a},{0x02211ad2,0x3ec023d4},
+{0x026017d9,0x46a42dc3},{0x06c02b7a,0x20674d30},{0x022032fc,0x0f25a3d1},{0x02c1311c,0x631172f9},
+{0x03a12238,0x6804f790},{0x03c02c61,0x48963096},{0x0321e822,0x6b626b69},{0x0320a68e,0x68dad8d1},
+{0x02200e0b,0x7217e246},{0x01e12363,0x83f929d9},{0x0520fdad,0x44a8ee02},{0x0260081d,0xda7432a2},
+{0x02202f93,0xd1b8addc},{0x02c12282,0xd6c3a982},{0x01e1fb35,0x53041b56},{0x01c0a534,0x4838421e},
+{0x0681fb47,0x9d4a0fff},{0x0261f564,0x722c783c},{0x02c13359,0xdebeb5e7},{0x0361e865,0xc2baadbf},
+{0x0480fc33,0x2f47d3f8},{0x024189c0,0x24c1654e},{0x02a10ead,0xb56c0b2b},{0x01e01703,0x5c440054},
+{0x02e120eb,0xbe183e2d},{0x04e1d7c0,0xa045bb0b},{0x0380fb7c,0x0c070cdd},{0x026104e2,0x536e3641},
+{0x0360160b,0x254d4411},{0x02e1f5a7,0x5e5f36dc},{0x02a1002a,0xdb920eed},{0x026e0132,0x16a3efa0},
+{0x03012376,0xdc601af3},{0x01e106d7,0xb0bce9f9},{0x036118bd,0x683010c8},{0x03203213,0x0d737f76},
+{0x0421d7f2,0xd9c6e277},{0x02a1f3da,0x33736e19},{0x02c130e0,0x0bd040e0},{0x020030bb,0xf8c2b793},
+{0x038004a4,0x55a613f4},{0x02e1d134,0x6d3a4aed},{0x02418a62,0x52ac1761},{0x03610a73,0x46547f0b},
+{0x04a1d66c,0x311afe04},{0x01a0a2ff,0xc12fffde},{0x03410d24,0xd9a3f752},{0x02a00956,0xf164c663},
+{0x02a16a02,0xfc5f7f38},{0x03c0fd43,0x2b1852d7},{0x0401df04,0xb15ab0bd},{0x024188f1,0x161dafd5},
+{0x028e01c8,0x17d5dafb},{0x0361d6fd,0x8cd6e0e2},{0x020103b7,0x8ec698b5},{0x024029f6,0x9c1cbc63},
+{0x03e008fb,0x5908635e},{0x02c131f1,0xff7cb35e},{0x02610f1d,0xa8d57178},{0x02402636,0x991ed477},
+{0x02600827,0xca741972},{0x0081f512,0x2cfd7e02},{0x03e01f79,0x98ebe564},{0x03c11fc7,0x13aa29a6},
+{0x0301d354,0xb0206bda},{0x01816a4b,0x1d92f8eb},{0x03e18b6c,0x0ecb7447},{0x01c0a383,0x9b5d81d4},
+{0x01a0a289,0x747951e3},{0x03e1d575,0x5ff4f35f},{0x02c111c2,0x72089177},{0x02a0aa6f,0xde53b5b7},
+{0x02e10d0d,0x51d09ec6},{0x03a01f7d,0xb455a2c4},{0x0241895a,0x3485add1},{0x0400fd44,0x6e81c1d9},
+{0x0260082a,0xde7438ee},{0x01e0aa2b,0x5da4eace},{0x01c0a3f4,0xaaf6bec8},{0x01a0228f,0x13f2a4be},
+{0x020013ab,0x9bf39f69},{0x02e14476,0x0b0fbdc3},{0x02e131bf,0x858776e8},{0x030005aa,0x2247e062},
+{0x0201128f,0x0fb2ab79},{0x034015d4,0xf379226c},{0x0281fa4f,0x71f83192},{0x028e015a,0x846f6367},
+{0x03c1d89a,0xf26539c9},{0x020013d3,0xe7f1d876},{0x02418983,0x25902390},{0x03a1d5b9,0x687bd281},
+{0x02c10ad3,0x185f9691},{0x04c003d4,0x418fc376},{0x0381e125,0xd29489d1},{0x026025d6,0x619223ac},
+{0x01e11817,0x1216d2c3},{0x03803193,0xde3b59a8},{0x02c1306a,0x0e9e1252},{0x04a00882,0x03d7d69d},
+{0x02a105b1,0x442bbdf0},{0x0360fed0,0x2f801510},{0x00c1f4dc,0xbb3e382c},{0x02e10411,0xfee8154b},
+{0x03a0faa4,0x23707846},{0x02c1f674,0x15e76237},{0x04a02afa,0xd3bb0026},{0x03a0fab6,0x236e39af},
+{0x0321228c,0xa3565fce},{0x04a1d04e,0x47b38a8b},{0x0240a73d,0xe1871e96},{0x01a00b90,0x5525f0b2},
+{0x0421d23b,0x4f6bf7a1},{0x0421d0e7,0x4a3a205f},{0x0180a326,0x8e7e3023},{0x0261da88,0x0af2c9e9},
+{0x03e018a3,0x39d00197},{0x0061f468,0x2e59aecf},{0x024121a6,0x86066918},{0x02a11489,0x3e56092b},
+{0x03c01e5f,0x850e73cd},{0x024188ed,0x120c6068},{0x030028f6,0x176fcb7f},{0x032021f4,0xf3e01e35},
+{0x0261b11a,0xf21b9754},{0x03210402,0xa3bcca3c},{0x03210a83,0xda781653},{0x02c1f74a,0xee64181d},
+{0x02404dc6,0x9bb60951},{0x02410876,0x38048ac4},{0x02e13229,0xcc70f5f2},{0x03a1d6ea,0xa0c52c40},
+{0x028e01d3,0x8ed2c4b9},{0x03c1f23b,0x60c8ee0f},{0x02012362,0x345a551d},{0x01e0a862,0xa83ce88b},
+{0x02011a9d,0x5a7e8aa8},{0x03a00d76,0x1934ac62},{0x03812405,0x46c2baaa},{0x032025c0,0x9ef62793},
+{0x0280a8c1,0x2f3cc1ae},{0x0320d7f7,0x12c6d10c},{0x0260a773,0x2ed47f69},{0x032005c3,0x4c993078},
+{0x02c1b11e,0x9ef906d9},{0x02c00515,0x6160ecfa},{0x03c02e05,0x0bf8ba34},{0x038027e4,0xe17b9be6},
+{0x03a1d59b,0xf791963a},{0x032011f6,0xc2a23d36},{0x03e18c4e,0x469b206c},{0x028168b6,0x7d50e0c6},
+{0x0200100b,0x40600173},{0x0261039f,0x3d9466f4},{0x03412515,0x4ac39edd},{0x0321d915,0xd00dc921},
+{0x0321f0ce,0x32d667e4},{0x05e0fc64,0xa66900c9},{0x03802b38,0xa68acbf9},{0x03c0a69c,0xd80b6e35},
+{0x0100264f,0xb21ac631},{0x0381d19e,0xa4f98adb},{0x020121a4,0xb64cfdb8},{0x0261b03c,0xafd72536},
+{0x0321e7fa,0x65c4a0ee},{0x03a10b78,0x79f5c3e6},{0x04c1d8a5,0x3af32e7e},{0x0201115b,0x1a999225},
+{0x02e111e5,0xf1f6fa49},{0x01c0a120,0xca8c6a01},{0x02402031,0x1f4e2dfc},{0x01c016e0,0xc8c29c8a},
+{0x028110f5,0xbbec79fc},{0x020108e8,0xae1cd22c},{0x01c0a08c,0x129d1906},{0x03602eef,0xd4f3e490},
+{0x01c1113c,0xa0b18047},{0x03e01f39,0x3bbcc9dc},{0x04a0335c,0x3c559e65},{0x0321d198,0x59e7406f},
+{0x02203125,0x1b7086b4},{0x0321f658,0x66ec44e5},{0x01002be7,0xd58e2bf4},{0x0201e2f7,0x7ed20eed},
+{0x03a1e00d,0xc74da4a2},{0x02a0282c,0x999171a3},{0x020013be,0xe409d710},{0x02e13259,0xee8031fe},
+{0x02c1d426,0xd097d7cc},{0x0240118c,0xf88b3285},{0x0220ffe0,0x832c97d3},{0x02410381,0x9151a515},
+{0x02e14619,0x65dc3df6},{0x04001843,0x7b2d84b3},{0x0421d8c0,0xbfd6d81f},{0x05201ebe,0xb03c5d2b},
+{0x03c025ec,0xdddc3724},{0x028021e0,0x790ed5db},{0x02e1ed08,0x08f25d0e},{0x0101f998,0x18f8b9eb},
+{0x04a1d978,0x9a6188d5},{0x02410ff1,0x2ad7fa88},{0x01c0a03e,0x1bb41b35},{0x02418914,0xa1163be1},
+{0x01e11590,0xd93fa0f1},{0x02e124aa,0xbac375d0},{0x0541d883,0x813ce306},{0x04201de1,0xac329aba},
+{0x0461d921,0x8a1243ec},{0x0220a94c,0x3277d400},{0x01e00c1e,0x10a439f7},{0x03c00884,0xc9ce25ae},
+{0x028023b9,0x42bbf40e},{0x0340abdd,0x5ccd06d1},{0x01c1106c,0xb4b6dfb1},{0x03600345,0x2b274243},
+{0x02002f5d,0xd0603935},{0x03e1244c,0x2af17a7d},{0x02601a81,0xb748ed2c},{0x0301f031,0xaf3aeb15},
+{0x01a10923,0x9fbf68f2},{0x02211166,0x4397d25f},{0x03e18c74,0x859334d4},{0x0501f80b,0x6b22d83f},
+{0x02c13360,0xe1c0f937},{0x028168ec,0x1c1e7b4f},{0x02400e38,0x9d2b90de},{0x02c00748,0xdee58842},
+{0x03600ddf,0x3c8547af},{0x01c0a13e,0xb86b52a2},{0x02e11a1b,0x4c15ea95},{0x03001d20,0x10b8d71a},
+{0x0561d0ac,0x1f0d1ad0},{0x02602e1a,0x01670b3a},{0x03e02cb8,0x498a7dac},{0x00a02be1,0xe72f3bf2},
+{0x026023ba,0x9c631765},{0x04c1f72c,0x08769891},{0x0220237d,0x6cd4380d},{0x0241883a,0xf5874147},
+{0x02e16e68,0x68d45bbc},{0x0261d2ef,0x2a1bf306},{0x02616911,0x0877be3f},{0x012033ab,0xd58e0c56},
+{0x0260131a,0xf4deda85},{0x01816f27,0x2d93515c},{0x0461cf3b,0x38fbb8d9},{0x02212374,0x656e376d},
+{0x03a00166,0x60b09039},{0x01c16a9d,0x86d8e905},{0x0200299e,0xe0e9c199},{0x028e01e9,0x94df9a1e},
+{0x02c13281,0x7eab7938},{0x02a16940,0xac012771},{0x0201047f,0xf3d8193a},{0x0280aa91,0xc961dd91},
+{0x05412447,0xc71dc8ce},{0x0260abf2,0x541e5d84},{0x0421eeb0,0x340a756b},{0x02a11487,0x4c561f35},
+{0x02c13158,0x38bc1033},{0x02e12381,0x862063ae},{0x03602c1b,0x6b5a4f4c},{0x02e0aaed,0xfcb30074},
+{0x02c119db,0x065a32c5},{0x01e00a89,0xeb8ae5dd},{0x0260a8f9,0x90b4a2f3},{0x02c131c5,0x50fa9ca8},
+{0x0360018d,0xbd0c6640},{0x028e0065,0x7ac22f25},{0x0361235b,0x1e650c05},{0x0301f047,0xf33720e7},
+{0x03a023eb,0x2ab57536},{0x02200913,0x6e801574},{0x024188d2,0x1710e575},{0x0181f461,0x61219009},
+{0x04c0ab3e,0x18509a14},{0x04400207,0x33aae304},{0x02a019bf,0x90787cd8},{0x0281f425,0x7a4b885a},
+{0x01a0213b,0x5854b281},{0x02402f8a,0x29cfaea4},{0x02e1341d,0xaecf226b},{0x01c0315a,0x4b0b3020},
+{0x03c0a7fc,0x49588c11},{0x02e0055c,0x416ae75e},{0x02402f80,0x7a24141f},{0x01a0a408,0x62796585},
+{0x04000348,0x38804c9d},{0x01e0a252,0x0954d1e9},{0x03e18bd3,0x17db95c1},{0x034001f0,0xbadefcf5},
+{0x0201f5ef,0xf2d10e9e},{0x01a102c0,0xc4f0b584},{0x0381d6f9,0x0762c411},{0x034000f5,0xec4843a5},
+{0x02a019a8,0x80a18817},{0x02c1335b,0xe0beb90d},{0x04212272,0x0ae53c6d},{0x02c1f08f,0x8d7d8fe3},
+{0x02e130ff,0x76a670e3},{0x030002fc,0xcdeddb2d},{0x02e1449b,0x9a0a8eb2},{0x024111c6,0xcec7d762},
+{0x03201141,0x2f4f1c0c},{0x01202e33,0x19b42a80},{0x0280fe57,0x5b4f5690},{0x0121f3af,0x351cbd61},
+{0x02411c16,0x6b3470ef},{0x02a10011,0xd2fa2d83},{0x01a0a0c0,0x24af0995},{0x03a0a7ff,0x8e6593ef},
+{0x02c13106,0xdf16b35b},{0x024e003e,0xd69f5109},{0x01200034,0xde381cae},{0x00e1f68b,0xe5576c05},
+{0x0340fb75,0x90cdc35d},{0x04a001fe,0xbc7d2b0f},{0x0340fbd3,0x7c559227},{0x0260123d,0x13cb5dca},
+{0x01c1f63e,0xcec7e9a8},{0x03c1f3f8,0xb1aef730},{0x01800ed5,0x3da106d4},{0x03e18c27,0x789fec50},
+{0x01c00c2e,0x505237ff},{0x03600419,0xc7064df1},{0x02016f31,0xd831d1ec},{0x03a01e0b,0x7c16f5a8},
+{0x03c0167a,0x30e94e53},{0x0240326d,0x6d392225},{0x01e11298,0x758f7b04},{0x0300ff73,0xe3773f8d},
+{0x03216b5e,0xae7ca1d9},{0x01a1fb03,0x30a7ce8c},{0x02c133f6,0x19761029},{0x02e14586,0x7734ab7a},
+{0x03e18bce,0xe9ec9678},{0x02c133d5,0xf31bf07e},{0x02600fc8,0x2d6b92f6},{0x02000f43,0x3ac985e4},
+{0x03403232,0x408a43fe},{0x0221cfc3,0xc49e5f4e},{0x03400faa,0xa766b2b3},{0x040003cd,0x7a07c4bf},
+{0x03c0249c,0x01013077},{0x03400144,0x0cf5839a},{0x0240a611,0xfedcb3ad},{0x02e02bba,0xe78736a7},
+{0x02002e85,0x2053ef7c},{0x03401574,0x5fb8a019},{0x032119a6,0xac3c0bf0},{0x02a0a881,0x5e8a8b27},
+{0x0541d8e0,0xd5c56683},{0x02e0a685,0x3754d79d},{0x04802c57,0xd651a32b},{0x0381d4ea,0xc9cf9c0b},
+{0x010033b1,0x6ba81c51},{0x02a032b0,0xd7748f90},{0x0361e8be,0xc17a1e13},{0x02e1041f,0x904eaf89},
+{0x04e0fe84,0x862e1117},{0x02a1f0cf,0x8d547fc9},{0x02810f7d,0x8cbc3a5f},{0x0240ffe1,0x19438367},
+{0x014007cc,0xfd8f2d4a},{0x03610c99,0xa5c0063a},{0x0300a871,0x1b581f21},{0x02011a99,0x4158812e},
+{0x01a1f79c,0x2a816f6a},{0x018016ea,0x702515fe},{0x0101f982,0xbd346f68},{0x028e0158,0x866f668d},
+{0x0361e8bc,0xa2a985c1},{0x02c02853,0x189efcef},{0x0241884b,0xfa8bc654},{0x0460fc88,0x6ca9b37c},
+{0x03202acc,0xc7ec0dc4},{0x02e118c5,0x3a767d1f},{0x02000d09,0x4e36c263},{0x02a01110,0xc3f7326b},
+{0x02a01987,0x1758ef01},{0x032022f7,0x81ccbf34},{0x02210459,0xf070341b},{0x01e115a6,0xdd260f57},
+{0x026e013a,0x14a1ade3},{0x02c01568,0x059c4ac7},{0x0260a612,0x5fe6f6bc},{0x03e1d6a4,0x114acce9},
+{0x01c0a432,0x69db163e},{0x020122dd,0x35110e79},{0x01a0a0ff,0xf04a41b8},{0x03211fff,0x49463e33},
+{0x010033dd,0x4cbf44d3},{0x03800f07,0x713d0d0e},{0x0360a7b9,0xb4697d0f},{0x02211146,0xf2f09616},
+{0x03202518,0x343a54ca},{0x0301f3d3,0x6fbaf090},{0x02418844,0xf58dfd0c},{0x026104da,0x9b44ad33},
+{0x03e1d11c,0xc6122865},{0x03e02927,0x6195504e},{0x02600916,0x559a74b3},{0x06a107a7,0xfb12e772},
+{0x02a0093a,0xb52e4df5},{0x0180230e,0x977d4488},{0x0360161d,0x14b47c71},{0x026102e2,0x66b0ccf3},
+{0x02e021a1,0xf8dd8f16},{0x02e1462c,0xd7c44a4f},{0x02c1310e,0xee148c61},{0x01a00baf,0xad116082},
+{0x02e021ac,0xc6bf9fc3},{0x0341d4aa,0xdb7ca9db},{0x02601a25,0xa97c9eeb},{0x01e1f58e,0x1e6ba0f9},
+{0x01e16f0c,0x24d3fcd0},{0x02a02496,0x9c755a10},{0x04a0fcd0,0x36ab662c},{0x00c02314,0x4997550f},
+{0x02a02bea,0x5f6624a8},{0x02800e05,0xfe86a9fc},{0x01a00b15,0x4bc4111d},{0x02e0045f,0x7e57dc1e},
+{0x0160a4f3,0x86112227},{0x0401f92b,0x21f8a0c2},{0x03410aef,0x1f70a951},{0x02004dd5,0x488286f7},
+{0x01816f1f,0xf56e285b},{0x030024ff,0x1120a3f1},{0x01c10e9a,0x84563568},{0x02001a06,0x970cb2d7},
+{0x0261b08b,0x7bf4279d},{0x04e02c25,0x9bc16a68},{0x05603370,0xaddacfa4},{0x0280148c,0x1551b0cf},
+{0x0620fbec,0xc3cbe545},{0x028e01e4,0x95e1da48},{0x026100d4,0x0a957813},{0x01c03150,0x1f0f680a},
+{0x02001a53,0x390072fb},{0x02600283,0x73d1decc},{0x01c01904,0x4f7e1bee},{0x0380161f,0xd0078742},
+{0x02418954,0x3685b0f7},{0x0400a794,0xaee22db5},{0x02c02d0c,0x86250093},{0x01c0194b,0x025b5dc1},
+{0x01c0a303,0x988632b2},{0x026011a7,0x2d364d56},{0x02611175,0xcabc7e9a},{0x02012125,0x62fe54f2},
+{0x0280199f,0x49ebfb96},{0x03a0fe23,0x9c9714f5},{0x0461d81e,0xa16fac20},{0x03e1d5ff,0x8905e53b},
+{0x03a0113e,0x305f9041},{0x0261b042,0xb1d7285c},{0x03c0251a,0x03ce6beb},{0x02c0283a,0x6c79934d},
+{0x01e10760,0x7cff1a67},{0x022032e6,0x6714e538},{0x0180a319,0x847e2065},{0x02602f87,0xa5eb13e3},
+{0x02616b18,0x9a828bf2},{0x02c13083,0x39212b31},{0x02e13401,0x92e4f0b6},{0x02211102,0x4d785a5e},
+{0x02811d03,0x55905c52},{0x01c01c0c,0x642b684b},{0x0141faf4,0x85ab1639},{0x02a16837,0xd4e232a6},
+{0x0280a8be,0x253cb1f0},{0x03402093,0x11cc0137},{0x03a02a65,0xce184aa6},{0x04003249,0x69fbb4e2},
+{0x0061f4c0,0x3de59ec1},{0x0381d49a,0xad1ff30c},{0x02e13230,0xcd6eb8ee},{0x01a02122,0xd9c6912d},
+{0x02611950,0xc9844aa1},{0x0240318e,0x3387470f},{0x01e1101b,0xf10eeb83},{0x03212372,0x017be81e},
+{0x0200306c,0x64234a1b},{0x02402e39,0x332a061d},{0x0401e003,0x6de8b1f3},{0x01e11a5e,0x6c7c08a1},
+{0x0401e138,0x97a743d7},{0x0380feb7,0xb834b820},{0x02801373,0xba8ea4a4},{0x0281698b,0xa6ebab97},
+{0x0461d922,0x6205c344},{0x0361d5cc,0xd89ca743},{0x02610a32,0xb26c5e6d},{0x01a1182a,0x0a38903b},
+{0x03a0fa91,0x394a943d},{0x02c1ee0d,0x285b67b3},{0x02e111c7,0xd410890a},{0x02c131ee,0xc2020a50},
+{0x02e13424,0x25d69985},{0x02202a9d,0xfbc09eb5},{0x0280094b,0x3a0a4712},{0x03e18b77,0x0acdac92},
+{0x02210f43,0x0a2a0cbd},{0x0361ee4b,0xaec313f4},{0x0181f3bc,0xf8670ee1},{0x02e020d6,0x57d32f26},
+{0x03a0fd48,0x695633ca},{0x024025ff,0x76fea10c},{0x04a1ed39,0x4660a289},{0x0441f151,0xdb4f41d2},
+{0x02801558,0xd18861e4},{0x02e144fd,0x81a29a28},{0x03211ca6,0x9f5ab72b},{0x02811c67,0x2992b737},
+{0x0260abf1,0xe7eaad3e},{0x048004aa,0x7290c105},{0x02418ab4,0xc097a9d3},{0x01c0a521,0x27c2509c},
+{0x02600292,0xd9e845ad},{0x02e00319,0xe97b1271},{0x02e13194,0xbe711dac},{0x04c01e70,0x2e99361c},
+{0x0381d00f,0x3d6fe449},{0x0320fb40,0xfaddfd13},{0x0101f99f,0xbe8f4ea2},{0x02e14425,0x207ffc59},
+{0x02801c32,0x536bb9b2},{0x02e13243,0x6b747ff7},{0x01c1108d,0xc051c94b},{0x032029a5,0xd2c1aa6d},
+{0x01c0a51b,0x13add739},{0x02010b26,0xf5e2ebeb},{0x01e106de,0x33bff6c9},{0x03202dec,0x099e008f},
+{0x02e0109d,0xfdef0f81},{0x02211c56,0xe34253b5},{0x02c13137,0x6620823c},{0x02a02d08,0xe433c611},
+{0x03210a64,0x5ba80989},{0x0241086c,0xd4e8c4cd},{0x028020d8,0x953bf6f1},{0x01e10b0f,0xd54ee70b},
+{0x036121da,0x706d59e2},{0x03e02e07,0x0499fb57},{0x01e12137,0x8c1bc8b3},{0x02e1459f,0xe839da8b},
+{0x03802c3e,0x0855aafe},{0x02e1302e,0x05571a63},{0x0381f00e,0x6dc182f5},{0x03410408,0xc94da9be},
+{0x01c0aa53,0xbdfd43b3},{0x02c02d24,0x22503881},{0x02816a29,0x1f941af2},{0x0281e912,0x46e426f8},
+{0x02202264,0x392ea48b},{0x02418893,0x0bdde98a},{0x06001426,0x23a9f9ac},{0x02e16b2c,0x6f1b4af2},
+{0x03810a79,0x7db46077},{0x01e0a6b1,0x9e9bd201},{0x01a02667,0xd28be8bf},{0x0161f56d,0xf4e070c0},
+{0x0241074b,0xf19f784f},{0x032169a3,0xf53e6d0e},{0x02418821,0x7c82059e},{0x02e10d0b,0x31de36f6},
+{0x03c1d6e5,0xdee88edf},{0x04c1f882,0xdbd1527f},{0x0301d4be,0x40a1265c},{0x03e18b3e,0xc8d7d208},
+{0x02602ca3,0x0bdcd415},{0x0260091b,0xbe8c80eb},{0x03a0a96a,0xa352396e},{0x02e02adb,0x0c04d22f},
+{0x0260211c,0x6df51de2},{0x02c1303b,0xf8158db9},{0x03601d08,0x1ee32f39},{0x03e1d6d3,0x7cd20e96},
+{0x03e1166a,0x4d858553},{0x028e0074,0x89c246c2},{0x010e003a,0xefd902ee},{0x02601336,0x042ce4bd},
+{0x038018e2,0xcc09d326},{0x0280125d,0x48e6d62d},{0x02602da1,0x53e188d9},{0x036006cf,0xfa17b44a},
+{0x0201048a,0x3c0f5df6},{0x0081f48a,0xcb969322},{0x02e1341c,0xadcf20d8},{0x04400672,0x6ed9002a},
+{0x02e145eb,0xedf7578b},{0x02816985,0x4e185ac2},{0x02200f7c,0xc81f1ee7},{0x026124eb,0xd5b61f10},
+{0x02202b2a,0xc9ea0717},{0x042021c3,0x8fc184fa},{0x024016ba,0xc07f31ff},{0x02c13095,0x4225b68a},
+{0x02c1319e,0xcf882cca},{0x02e1f0dd,0x50e95b4b},{0x02418917,0x8c2763f3},{0x0441d01a,0xc58854ad},
+{0x02e145bf,0xf328a2bb},{0x01a03343,0x6d993fa8},{0x02c13206,0x70775513},{0x0180a4f1,0x7aea28a0},
+{0x02e144eb,0x87a720c8},{0x05201ed2,0xcd4b2ce8},{0x030004d5,0x72504a73},{0x038015b5,0xe772b78b},
+{0x0141f5c1,0xf9576be9},{0x01800ed4,0xced10090},{0x026101da,0x63169a4e},{0x05211a45,0xe7e46bb0},
+{0x02e109a9,0x75caabd9},{0x04002345,0xc9927b67},{0x02e13316,0xa053b7ce},{0x02200aa3,0x67448915},
+{0x03c10b71,0x621508bf},{0x0320a746,0x094e2412},{0x03610c8f,0x9fbffcc8},{0x0320a9f3,0xb5fb1c80},
+{0x01e0a24b,0xcb38028b},{0x03a1d055,0x25decbbc},{0x02e13409,0xa0de4afb},{0x02816924,0x77f6b8ee},
+{0x01c16a7f,0xdbc5e71c},{0x02a01516,0xd1f8d001},{0x0281f3bd,0x257f892f},{0x0381ecab,0xf6fe5e43},
+{0x02a018ce,0x2a04b589},{0x030028cf,0x847aaabb},{0x020103b8,0x82c685d1},{0x022122ea,0x08171ecd},
+{0x02a1d913,0xd7eb75af},{0x0380298a,0x4f44ec54},{0x03810160,0xb79a97ef},{0x056027ad,0xd57a3e49},
+{0x030021ff,0x2915d326},{0x0381daa1,0xb733d867},{0x04e02b41,0x19a8ba1b},{0x03003005,0x2eab75ce},
+{0x02e120c3,0xb4eee1fb},{0x01c1e2ff,0xea4c7dea},{0x02e1460b,0x6ffedff6},{0x04400f02,0x1b42698a},
+{0x0301f0b3,0x009fd69d},{0x028014e6,0xac1bbc7c},{0x040025f0,0x1e3d11aa},{0x01c0a300,0xac8f4c8a},
+{0x0580fc0f,0xff74bbd2},{0x02c1300a,0x821d22bc},{0x01a11685,0x09e113ac},{0x0340d7fa,0x2002d2b1},
+{0x03c1d566,0xf3256ed6},{0x03202754,0xf3e813e7},{0x0160a4a8,0x2fcef140},{0x034011b0,0x6e0c2ec7},
+{0x03210144,0x1a2d94b6},{0x0301690a,0x4bc9ee31},{0x026e0107,0xa99a49ad},{0x0321d914,0x25b7331c},
+{0x02201816,0x22c14380},{0x038000c9,0x4e30b6d2},{0x03e0ffb3,0x821ed7a4},{0x02416b6f,0xf41d2656},
+{0x018e0026,0xbd175132},{0x02a1699f,0x0c2e1f3a},{0x01c0a22f,0xc67d0222},{0x02e144c8,0x07fe6fe9},
+{0x0261b01d,0x5963c264},{0x0081f525,0xcbfd4bd9},{0x04a1d0dd,0xd432a32b},{0x024188c4,0x0efe41ee},
+{0x00c0264b,0x40fa9f85},{0x02601335,0xfa2cd4ff},{0x0261b103,0x21d1b082},{0x03002e09,0x408713c3},
+{0x0201063d,0x1b21a682},{0x02602da9,0x868b1899},{0x044021c2,0xaacb86db},{0x01e11a70,0x4c47fade},
+{0x02801591,0x8a676454},{0x01e0a0a7,0xdde3a6f9},{0x0321cf8d,0x8d72c2aa},{0x01c116b7,0x78872bb4},
+{0x034001f5,0x4f8fe08f},{0x022110b0,0x7bf2c97b},{0x0221d197,0x6ef5efb2},{0x04010b51,0xff057268},
+{0x03603175,0x5d5b02cb},{0x030002e0,0xf8b57c5c},{0x01e10687,0x4d37d3c7},{0x02c10a0e,0x15d1d042},
+{0x02400acd,0x34e30971},{0x0341f70a,0xd7b0aa6f},{0x0180a4a5,0xf7c87d00},{0x02600e28,0xa4d84c5b},
+{0x03a1d675,0xd6587c22},{0x0361e886,0xbc83c477},{0x0301f7a7,0x82638db3},{0x01a1f6a1,0xde9c9452},
+{0x0401f118,0x313028fa},{0x04c0fc1e,0x2078ad74},{0x0081f9ad,0x96405c60},{0x02e10844,0xfe44294b},
+{0x02600933,0x73df6ef6},{0x028110de,0x0c224dec},{0x0340ab69,0x1a518136},{0x02a1ee05,0xd9286946},
+{0x02a0ff5c,0xe7f22a60},{0x02c133c7,0x8c15d880},{0x05010781,0xbb3540b8},{0x03a0fa8d,0x124c956f},
+{0x05c1f677,0xd66ee3b1},{0x02c02d1c,0x28aea4e2},{0x04402910,0x3a0de6e6},{0x02c02855,0xbacf14f8},
+{0x02c1685a,0xbba0c239},{0x04c1e13d,0x653ab0e7},{0x042121ee,0xaaa9a0c2},{0x01a0a20d,0xa737c4fd},
+{0x05a0135d,0x65cfd840},{0x02c1f0db,0x493f4a3e},{0x0360a79a,0x2782fcff},{0x02a0aba1,0x35299178},
+{0x03c0ff6d,0xfb06e42f},{0x04200685,0xaf18464b},{0x01e0200e,0x390cb794},{0x01811133,0x7392c0ee},
+{0x02a0aa6d,0x4261caad},{0x02c028f0,0x5660f1f4},{0x01811731,0x9686834b},{0x0280199e,0x262c6a40},
+{0x02a104ca,0x2ba15aae},{0x02c002f7,0xc9895074},{0x02418849,0xfc8bc97a},{0x01a0a0de,0xe8cc66ba},
+{0x02211ef7,0x95d62732},{0x01a02211,0xdffaa36c},{0x02e14439,0x1d70ed16},{0x07a02b82,0xcb7dd89a},
+{0x02a0a991,0x288624a3},{0x0381d19d,0xa9f992ba},{0x022122e0,0xdcf7a1bd},{0x03000f97,0x1a9938dc},
+{0x02e131aa,0x5b13352a},{0x0341e829,0x7bd3ed71},{0x0320fb38,0xd3ca7f67},{0x01e01c7c,0x69b3eabb},
+{0x02e1318d,0x4dd311c6},{0x04000386,0xb0f3651e},{0x0201065d,0x5c407f4c},{0x03003258,0x239e2a56},
+{0x028026cb,0xb83fd7ea},{0x03a01a57,0x245ec1b0},{0x0281bc15,0x9b60099e},{0x02611ef8,0x379b82d0},
+{0x036015cd,0x1f00f97c},{0x05401e68,0xf65cd1b9},{0x0300208d,0xafb25d41},{0x0360fb7d,0x1c22053b},
+{0x02c131b7,0xc5f78340},{0x02816b0c,0x449c4431},{0x0520fd1b,0xe14f6da7},{0x026100a2,0xcb4759a9},
+{0x0381d487,0xc4201741},{0x0341e84a,0x93c7182e},{0x03e10c8a,0xac4d91c2},{0x02c13156,0x37bc0ea0},
+{0x02410197,0x53faaaba},{0x0420235c,0xbd5798ca},{0x03a1e123,0xad79466a},{0x0481d720,0x12ed1248},
+{0x0260fe0b,0xa99c8844},{0x02e13245,0x69747cd1},{0x02a1ed01,0x82435701},{0x0301f048,0xf437227a},
+{0x02812fdd,0x9b0d74cf},{0x01c0a1d2,0x886e86da},{0x0261d176,0x15dd512c},{0x0481d8c9,0xc02c1626},
+{0x03e0fbfe,0x705e632a},{0x01a00c12,0x650ba64a},{0x03401650,0xe76e822c},{0x01a16a67,0xe01611e9},
+{0x02211164,0x33403b8f},{0x02802985,0x0ba3e003},{0x020030b9,0x08c2d0c3},{0x022005d3,0x68aa408e},
+{0x01a0a159,0x9965dae0},{0x0480063e,0xb3a4a207},{0x03802390,0xc6e5ff4b},{0x02600a4c,0x65a8ed33},
+{0x02c13078,0x392369c8},{0x02e01888,0x511726f5},{0x02e1443f,0x1f70f03c},{0x02801d9c,0x5d8c6bac},
+{0x0261009e,0xd049a01f},{0x02602473,0xbd0ed27b},{0x02600dca,0xef040b53},{0x03012350,0x0e296c04},
+{0x02202286,0x2ad011b0},{0x02c13345,0xcfba211c},{0x02e133fe,0x91e4ef23},{0x02c132f5,0x60458efd},
+{0x036015e2,0x28a45b6f},{0x058003b0,0xd5f27a6e},{0x02401ab4,0x60762e18},{0x042121dc,0xd4908d92},
+{0x024189e8,0xacdebd7a},{0x03e18bca,0xedec9cc4},{0x01c0a092,0x60092695},{0x0100203f,0xca80aa89},
+{0x03e18c75,0x86933667},{0x01c0a09d,0x08ec1b8c},{0x04c0088a,0x546276fd},{0x02e14507,0x7aa28f23},
+{0x02c115c7,0xb6fd8f8f},{0x036109ca,0x2b7b7144},{0x02418880,0x88e32b7f},{0x02e02018,0x3fd609a7},
+{0x0260142f,0x28b149e3},{0x03c1bc73,0xf00a22d9},{0x01816f42,0xd596986b},{0x036015dc,0x28e97ff3},
+{0x01c02420,0xfc5f47ea},{0x02e145e5,0xe7f74e19},{0x02e144be,0x0800ae80},{0x03e18b3c,0xced7db7a},
+{0x02e13412,0x31d22f3b},{0x0480a650,0x600efce0},{0x03200cc4,0x8c1e8342},{0x03001148,0xd3d4ba6f},
+{0x01c0a931,0x7135f6e6},{0x03812396,0x9c85ea89},{0x03001d0f,0xf9b8b2e5},{0x01c0a54f,0xe49a7aa7},
+{0x01a0a6a3,0x4356badd},{0x0460fcb5,0xa4a741bc},{0x0460fce3,0x5d9f6e23},{0x00a1f9de,0x3f0a28e3},
+{0x046109ec,0x39121d04},{0x0301d90d,0xdfc7640e},{0x02418916,0x9b16326f},{0x03600dda,0xd3666f5d},
+{0x03c0a7fb,0x5b58a867},{0x02a0ab8d,0x292f8ec2},{0x02e1450f,0x88a4e3c4},{0x0380fee5,0x89ea73da},
+{0x02c00517,0x61425c40},{0x0161f19d,0x03aee46d},{0x02e1459a,0xe439d43f},{0x0520075f,0xbaaca9e7},
+{0x0321202c,0x8954e021},{0x018e0039,0xb1b7cc74},{0x03012489,0x36bc5a50},{0x02e1697c,0x7bbd190d},
+{0x01e11595,0xb52391c8},{0x02c002d6,0x8f4dbdc1},{0x030121b9,0xfecaf57a},{0x0341f13f,0xfb010a28},
+{0x02c131e5,0x45ff0885},{0x0240ff06,0xa377558f},{0x02801846,0x4e8609fc},{0x03a0fa74,0x303b7b88},
+{0x03202eea,0x11dfecd6},{0x02e1f7af,0x0bae2b53},{0x03c00daf,0xbb5b6a02},{0x0480fe14,0x513a5a21},
+{0x02c1f006,0x1385d2c9},{0x01a16f4a,0x45711ee4},{0x02801a22,0x0373165f},{0x024119ac,0x9a0bc7fe},
+{0x016110c0,0xfb7b6839},{0x02804de4,0x6ecaeaa8},{0x01e106e0,0x31bff3a3},{0x0241899c,0x32c8371d},
+{0x01e0a944,0xd54f5d7f},{0x00c026ea,0x7d6d4fa2},{0x04a0ab5d,0x05b77c4b},{0x0221d2e7,0xa782bffa},
+{0x03010cdb,0x421f730f},{0x0621d94c,0xed16d7bf},{0x040109e0,0x61aa1a69},{0x010026bb,0x70b59d0a},
+{0x074029ba,0x71ccc92a},{0x012022a6,0x2abede6f},{0x01e1f49e,0xa464a0be},{0x02e1d33d,0x425207a6},
+{0x02a02c76,0x1e6f313b},{0x0620fd96,0xb48eba81},{0x0260337c,0x344af8cf},{0x03c1d469,0xf022fe5c},
+{0x02001926,0x59344b36},{0x0421d23a,0x486bec9c},{0x02a0abbd,0x25207dec},{0x03c002f1,0xbaa3900e},
+{0x01c0a6d5,0x41be1ee9},{0x01e00ca4,0x0d190354},{0x028e0171,0x7b6d16a5},{0x0361e12a,0x30e6ef7e},
+{0x020114d4,0xd1cf8ed9},{0x02a1001a,0x303aace3},{0x04401e9a,0xdf8a9650},{0x024016c7,0x938855cb},
+{0x028168ee,0x4ceb1d00},{0x04a032ca,0x4bc1e409},{0x032011e7,0xd57aa190},{0x03801ac5,0xd9b6ae8c},
+{0x02c1fa22,0xb9c5e691},{0x0580fc09,0x132d1de8},{0x0361e80b,0x8c03bfbc},{0x02401831,0xe0960363},
+{0x0341e85b,0x08847263},{0x02418aaa,0x489abe82},{0x03a0fabe,0xb46d8af2},{0x024188c3,0x0ffe4381},
+{0x01e16f62,0xfba60197},{0x03402c44,0x221ad0ce},{0x02001001,0x633436e6},{0x01402060,0x376fcf4a},
+{0x02e14413,0xad7aca22},{0x0161f518,0x8eedbc90},{0x0300a7af,0x0bb8cf3b},{0x02401b57,0x38d96c3c},
+{0x04e01ed1,0x36f9e70c},{0x03a12019,0x7991f4f6},{0x0301446b,0xbf24f9c3},{0x00c1f9a1,0x82264efe},
+{0x030120c6,0x44f062cf},{0x04010b6b,0x801b522e},{0x02202fad,0xa514c4b1},{0x02a168a6,0xefbe531f},
+{0x0300a9ec,0x6757eacc},{0x01c0a53a,0x66ec19cc},{0x0281e7e5,0x63fbfb02},{0x0281f979,0x15f2864d},
+{0x01a0a4ba,0xf9185f6f},{0x01c017d2,0x9ca338fb},{0x04212463,0xc33aa0bd},{0x02e1460f,0x800137bd},
+{0x0381f86d,0xaf1c31a5},{0x0201039a,0x58472a9a},{0x01e114a2,0xa355e96d},{0x01c0a152,0x336ad760},
+{0x02e1322a,0xcf6ebc14},{0x02e133c6,0x6b66af16},{0x0480fcc8,0xf3bb36b8},{0x02a11fcf,0xbb178d3b},
+{0x01a1e956,0xdc1ccf11},{0x0440a7c4,0xf4c4eab2},{0x02200a3c,0x8ab56b13},{0x01a0a0d2,0x1ce0404e},
+{0x0560088d,0x772bd96a},{0x02e032bd,0xc8132549},{0x00a1f9a6,0x4e02f489},{0x01403314,0x84864775},
+{0x02a0213f,0xb8cc3d5f},{0x01a0258c,0x8efd466e},{0x02a11d54,0x0365b281},{0x02e11a1d,0x3024c90b},
+{0x04a0fc52,0x926bf5d4},{0x04a1ee7e,0x805624e6},{0x01c10e99,0x647d1278},{0x010022b8,0x3695889c},
+{0x0361e872,0x2442e269},{0x00c026b2,0x980d5d3e},{0x02c01a5c,0x38de517b},{0x0341d879,0x8819be4a},
+{0x03e18b39,0x94d7802c},{0x0121f4f0,0x701536e8},{0x04e0fd0b,0x950445d2},{0x016007c6,0x60cdf66c},
+{0x02e01c35,0x2418315b},{0x04e1d652,0x12e1c221},{0x03c0a64b,0xe96a9724},{0x0200100d,0x321d3cd3},
+{0x02601581,0xd2b30118},{0x02a01bd7,0xc1aa9ee1},{0x0481d00b,0xf8ed31a0},{0x0361d6a2,0x4706fbfa},
+{0x020103ba,0x9ed7fb06},{0x03012320,0x342247a7},{0x0400029b,0x3a17dab6},{0x02410111,0x44275704},
+{0x02a019be,0xc51430de},{0x03a0fab4,0x256e3cd5},{0x01e11a79,0x68391c68},{0x03c01cc0,0x39d28f8b},
+{0x01c02083,0x114928fa},{0x02e144fe,0x82a29bbb},{0x0301f0bd,0x8f9c74ab},{0x032115b5,0x639cc174},
+{0x03c1f59c,0x304b9f8f},{0x04e01b76,0x3e77c7f5},{0x01a0a12d,0xbfd171e0},{0x026e011f,0x21a87e1f},
+{0x0201111c,0x803a00ca},{0x02418af1,0x6b0f8ebd},{0x0381d493,0xb820045d},{0x03c01e01,0xc0d9fdb2},
+{0x0161f3b0,0x62466dfa},{0x01a0aa17,0xa70184a8},{0x0501d97f,0xfcc81dc8},{0x02a02f89,0x53e32f95},
+{0x0441d0c7,0xa81d147a},{0x01c16f1a,0x91c7ea04},{0x06e1d9ac,0x4102e321},{0x01811fd5,0xb56cb148},
+{0x04002569,0xd0ccbeb2},{0x02418af0,0x640f83b8},{0x04e1014e,0x90538189},{0x02600057,0x63151724},
+{0x02e10ad4,0xcfa292b1},{0x030010ff,0xe917cf29},{0x02a16859,0x8db7c758},{0x03600738,0x8a2e7813},
+{0x01e11186,0x792d45b9},{0x01c16a74,0xd5bb504e},{0x02010644,0x2a468ef8},{0x01003013,0xa1f5a77b},
+{0x0320fee2,0x2161518d},{0x04801d9a,0x841a970b},{0x02e02c82,0xbfcd3a07},{0x02010651,0x3998af08},
+{0x036168ff,0xb0c362b2},{0x06a1cfbd,0xe2ffa86f},{0x0561d8b6,0x9881f90e},{0x02418894,0x0cddeb1d},
+{0x0320046b,0x95a3fece},{0x02e01887,0x5917338d},{0x02418a0c,0xb02e8c0f},{0x02601078,0x5f8e8d38},
+{0x02600a03,0xf3ed341f},{0x028e006b,0x7cc2324b},{0x024189a6,0xa2cfa332},{0x00e1f50b,0xeef6e76e},
+{0x0360150a,0x0c1e87a8},{0x03602a7a,0x3312e966},{0x02a11d7f,0x64de6d71},{0x06c1d832,0xb251f353},
+{0x01a0a101,0xba9a518c},{0x0501cf19,0x7e9b5f70},{0x03202c23,0x5d52feaa},{0x0260291a,0x193c8727},
+{0x01c02197,0x1dcc739a},{0x00a1f9a8,0x1ea2b575},{0x0361d1d0,0x1da41424},{0x0361e023,0xf714a662},
+{0x0301f055,0x951a3ad1},{0x02211ef4,0x123318e0},{0x0281693a,0x16816362},{0x03812176,0x4901dcac},
+{0x050001e0,0xbbdc8179},{0x02c01c79,0xe963aabf},{0x038025b4,0x6f1bf4f2},{0x0421d624,0x39b1d53f},
+{0x020110b9,0xc141c4a4},{0x03c1d152,0xceaa2b53},{0x0401244b,0x62ab17af},{0x01c11305,0xa4dc3c25},
+{0x02011163,0xf6da00cf},{0x03a10b44,0xabca1936},{0x03e002f4,0x0a4e6074},{0x03001d5f,0xb5d10acf},
+{0x01c0a15b,0x4379fb1a},{0x01e00cb8,0x0507ad9b},{0x02e11d44,0xc8c82fee},{0x02c1d42e,0xe897fd94},
+{0x02600d46,0xe1ef2de3},{0x04a1d081,0xbb564473},{0x02a01463,0xbeb3961f},{0x01c00306,0x4bef81ed},
+{0x01a0a56d,0x230845e3},{0x03e02417,0xbd76c501},{0x01e0a91f,0x36c4e899},{0x0341f60b,0x39bb14a1},
+{0x0240085e,0x305cd218},{0x020013ea,0xec1b2cc9},{0x01c0a479,0x474a3b82},{0x03e018a2,0xe5dfb681},
+{0x05a1d99f,0x6e2a31e5},{0x0260061d,0x497809b9},{0x02c02e29,0xc66790dc},{0x02e1342c,0x1dd44e56},
+{0x0260314a,0xbde9ae07},{0x0361e816,0xe05553bf},{0x02e1d9f9,0xe2b1e3b0},{0x02600f39,0xe008d531},
+{0x0261b0fb,0x9fea7bc2},{0x030168b8,0x579dcddb},{0x022010eb,0x1bb38f62},{0x01c016dd,0x898370ae},
+{0x0361e8ae,0xe5893f1f},{0x01e10e9d,0xf0105ea5},{0x0260097f,0x7f5a68f6},{0x01e16f6b,0xf3d791cb},
+{0x02c1143d,0x9557bd39},{0x02600052,0x6015126b},{0x03810785,0x60c43710},{0x0300feda,0xc937b0a9},
+{0x032118df,0x82bdd66e},{0x03a1242b,0x9e201d01},{0x01c01902,0xd5214cc2},{0x02600e29,0x843d7ef9},
+{0x04a11a37,0xe1d71588},{0x01a01bc7,0xe6c5a903},{0x02c133bf,0x9915ecf7},{0x02012366,0x5c3c7f01},
+{0x0321e7f7,0x3a88dbea},{0x02e1da3a,0x8a4969e3},{0x03c000fc,0xc13bfe04},{0x03602513,0x1b973c20},
+{0x0281f46d,0xcdc5d946},{0x0180a4bb,0x0f704c5b},{0x028019b9,0x45bcf691},{0x03a1ee9b,0x7fcae3db},
+{0x01c0a0b4,0xb89e2c14},{0x0361eca4,0xe05ef543},{0x0381cf24,0xf635cea8},{0x03602bf9,0x9bfa869a},
+{0x03c1e83d,0xbb980289},{0x03e0106f,0xdd43358e},{0x04801eb0,0x377796c6},{0x02812fa2,0x18016da3},
+{0x01203388,0x934b0002},{0x01c0a584,0x42b7f16d},{0x02a1f317,0x6e6be522},{0x05a1f242,0xbb37f3f2},
+{0x01a0a1a6,0x8d9927c0},{0x02201028,0x7724676d},{0x02e0219e,0xdeba86b9},{0x02e0039b,0x5063e88e},
+{0x01e10699,0xbb3270c3},{0x02a0328e,0x8bfa81ed},{0x0241d86d,0x410f2ebf},{0x0180a629,0xa015ace4},
+{0x0181e299,0x9285fb49},{0x02802f50,0x8d526cb0},{0x0380fb90,0x4d6b2fdc},{0x020030c8,0x62c11fda},
+{0x01e00648,0x1a18a8f2},{0x02800133,0x71ffb4b6},{0x0281695d,0x2f445e6e},{0x03a1da3b,0xa6864f12},
+{0x02011299,0xc9cce81a},{0x03c1d55d,0xec2563d1},{0x02c0aa6e,0x17dc26f9},{0x02c168ab,0xa229ee85},
+{0x02418828,0xf1897992},{0x01a0a56a,0xeb2602cf},{0x048025ee,0x4732d67c},{0x01c0a585,0xf772aca7},
+{0x01c0a1ab,0xd05a798e},{0x00c1f983,0x75f820cf},{0x02001974,0xa80a2af0},{0x028028a0,0x119a8f0e},
+{0x036011ca,0x5ea8da90},{0x032011b6,0x1326fce6},{0x0161f9af,0x52851457},{0x0141f4d5,0x112fc438},
+{0x02e14627,0x6bde85ff},{0x02e144f6,0xf6aa0e1c},{0x02a1e911,0x602e4cf0},{0x0160064f,0x18590223},
+{0x02210192,0xf1faa49c},{0x0261f19c,0x717097ae},{0x01c0a251,0x02368eb2},{0x01e1f4d0,0x6f7cb0b0},
+{0x0201e2df,0xe72bad98},{0x02c13177,0x3ecb242f},{0x052023cc,0x9ed79da4},{0x04001ee6,0x87d89376},
+{0x02e13247,0x677479ab},{0x024012c8,0x092e1604},{0x02c0a880,0x9c3f4a4d},{0x0361e803,0x74a81c02},
+{0x01a0aa0c,0xea5d43f6},{0x02600c82,0xa1512b61},{0x03802a4d,0xaee226f2},{0x02e16e7d,0x63d453dd},
+{0x01a0a946,0xf9699e75},{0x0221237b,0x48930230},{0x01802a33,0x58cdfe86},{0x016031d6,0xe5ac6bd4},
+{0x0241fbb2,0x23ff4e94},{0x02e024fb,0xb808dd86},{0x0341d215,0x83460b92},{0x030100c6,0x292b9e3c},
+{0x00c1f483,0x223bd9aa},{0x01e11c7c,0xb54ea348},{0x0101f323,0x8d976b60},{0x01a0190b,0xd2ee4dab},
+{0x04401eb5,0x8eb63a1a},{0x020031a2,0xbf7ef0bd},{0x01a0330c,0x54c35794},{0x05401f26,0xe6125eeb},
+{0x0300285f,0x11757884},{0x02e1f0a9,0xb6fd37f0},{0x012023e6,0xf1ae5eb2},{0x0241894e,0x32836c14},
+{0x0360032f,0x8f105c3b},{0x01c0a5b9,0xaea52809},{0x01c1f302,0xc80e7de5},{0x01c0a345,0xd796538e},
+{0x02c0249a,0x4a1ae3d1},{0x034011cb,0x12d8170d},{0x0181170a,0x28024271},{0x04c0fc16,0x23bf2652},
+{0x02c0a998,0x22292e2b},{0x0180aa20,0x07858752},{0x02802830,0x9d9799db},{0x0480fcb2,0x94165114},
+{0x0241880c,0xf77cb711},{0x0261b0c5,0xd5cbfadf},{0x02e145b8,0xf42ae2e5},{0x0301d400,0xc94d17c1},
+{0x05c02b9b,0x9fc4f092},{0x03010c45,0xe6eafb99},{0x0481f815,0x97a1080a},{0x0301d909,0xb70da827},
+{0x02c0282d,0xb9ccd4ce},{0x01a01916,0x36fdf5a1},{0x02e133b9,0xf2f8a064},{0x028e0166,0x7e71988c},
+{0x028168f3,0xf91a540f},{0x0321f0ac,0x5c7f9829},{0x0121f191,0x4d5a6e89},{0x0361eca3,0xfaf79ca9},
+{0x02210491,0x6861987e},{0x02c008e3,0x5b74c822},{0x02810fc8,0xfe2b61ef},{0x04400499,0x71208fb3},
+{0x0321223c,0x628c9af3},{0x02a019ec,0x868158f4},{0x02c108e3,0x220844a9},{0x0141f1ac,0x4088fd6b},
+{0x02001c2a,0xf7e5367b},{0x00a1f6de,0xe692a25c},{0x02e0ffd7,0x7b955027},{0x02400976,0xe86ae3b5},
+{0x03e01e86,0x15005888},{0x02801100,0x7116a14a},{0x01e1f6ad,0xe7c7e310},{0x02c017f0,0x21b6fccf},
+{0x01c1f5f8,0xd6bfdcb4},{0x0101f995,0x6ba5c66e},{0x0421cf93,0x32442ca3},{0x02001b1a,0xf6dea5a3},
+{0x02e1329f,0x9d7b3fe7},{0x0221bc60,0x322570f8},{0x0321f65b,0x5df81fa5},{0x02c133c8,0x830f0e90},
+{0x01c0a6d6,0x7cd8c2f3},{0x0300abe4,0x60d5cf59},{0x01a1142d,0x7e989f51},{0x05c02b9a,0xe7680bfe},
+{0x02c13098,0x4025b364},{0x02e1042a,0xa597c725},{0x0281691d,0x8a516a48},{0x01e00c93,0x43249149},
+{0x0241191d,0xcfa6736d},{0x0641d0a9,0xcabb8345},{0x028021af,0xa7a7ddc1},{0x0361f892,0xd42e0db3},
+{0x03e10b62,0xfa7ba547},{0x0580fe41,0x3dddcc04},{0x02200a19,0xf210a897},{0x03c024b3,0x08013b7c},
+{0x020013ad,0xb00f9562},{0x01c16a80,0xd5ced806},{0x04810cf1,0xec9fb6ed},{0x0200207b,0x4ef9dbe5},
+{0x02a1b166,0x8543461c},{0x02600666,0x02c2e001},{0x02c1d1d9,0x54a14d58},{0x0360083c,0xa2292ad6},
+{0x02e1009b,0x9097a184},{0x0481d846,0x92a199d1},{0x00a1f9c5,0x19e6aab6},{0x038022da,0x1f7244fe},
+{0x054002af,0x25b2c82a},{0x02e131af,0xf8b9838b},{0x0221048f,0xd8816864},{0x0421d235,0xce77f881},
+{0x026119c1,0xe38eb270},{0x00e02313,0x3ba3fac6},{0x0220a94d,0x426ef2d4},{0x04e1d64f,0x0fe1bd68},
+{0x0381cf87,0x6688ffcd},{0x04200870,0x1642285d},{0x02e1449f,0xa008598d},{0x03e18b91,0x20bec4aa},
+{0x0381d806,0x4c175a32},{0x02c13276,0x80a93dc7},{0x0401f127,0x2230115d},{0x02801a90,0xc627bb98},
+{0x04601eea,0x4412c5fd},{0x0180232d,0x0efba112},{0x01a00b94,0x6926102e},{0x03610560,0x8e7fd2fe},
+{0x01a0a3db,0xfe38c2fa},{0x02601406,0xf2728c22},{0x0161f4ae,0x315953e5},{0x0261b0dc,0xe7bd0cab},
+{0x02e16f9f,0xec2303cf},{0x022032df,0x5f23e32a},{0x05a01ea8,0x0868fe87},{0x0461d61f,0xe1a2ec8f},
+{0x02e14644,0x5fbf1039},{0x03e1d5f2,0x7e05d3ea},{0x01e01c56,0x0bc9648f},{0x0361d690,0x2906ccc0},
+{0x026006c1,0xbc5d4d41},{0x0240d7b6,0x1c645bc1},{0x01811414,0x083f4398},{0x0321f0c4,0xdceb47b7},
+{0x03e12219,0x4b7ade51},{0x03602c1f,0x045bca37},{0x0401d54f,0x378962d8},{0x01e0a07a,0xdb2b4c9f},
+{0x02c1327b,0x74a92ae3},{0x01811452,0x57c57379},{0x03c1d4e0,0x41e98b9a},{0x03802c17,0x2512eee8},
+{0x01e11ef0,0x5684ba57},{0x03010a6c,0x66d8fe06},{0x02a023e3,0x2bf93374},{0x02c120ea,0xbd9d997b},
+{0x01c01b5b,0x3747c528},{0x02e144fa,0xf8aa1142},{0x02210a00,0x9a73a083},{0x01c01a4d,0xc2fe8cb6},
+{0x01a0a028,0x33f95394},{0x02418ae5,0x630d438e},{0x0261b10e,0x7920e907},{0x02418919,0x8e276719},
+{0x0241f16f,0x550d260c},{0x03a04dfd,0x2e7aeb2a},{0x022013c0,0x537dff88},{0x0340a9b7,0xbdad9cbf},
+{0x02e13369,0x166ee9a5},{0x02e13413,0x30d22da8},{0x04e01b7b,0xae0497f0},{0x0361e811,0xd61b484d},
+{0x02c132c5,0xeb9b8a76},{0x03802484,0x7ec79395},{0x03602c21,0x82489025},{0x0121f9eb,0x3a931953},
+{0x04c0fe8a,0xe06cc3b9},{0x0421d5d4,0x5536d447},{0x01c16a85,0xb6ecbc4d},{0x034026a8,0x27829ba3},
+{0x03a10994,0xfdd64e32},{0x040003f6,0xd2132ffa},{0x03a1cfb1,0x9616f858},{0x01a0a02b,0x3012e52e},
+{0x03a11ab6,0x71ad5a16},{0x02010664,0xcada680c},{0x02a00435,0x25ed86f1},{0x05612304,0x6ea0b4a8},
+{0x04001d8a,0x46527c05},{0x05200879,0xdd415f19},{0x02210831,0xb5e0aa6e},{0x02c13304,0xca3de716},
+{0x02000655,0x12a0f5f5},{0x03a1d682,0xc3585e39},{0x0240ff1b,0x0391c3b5},{0x0181f35c,0xcc5fa9e5},
+{0x03e1d5f9,0x7705c8e5},{0x038001e8,0xdc6afedf},{0x0501d946,0x9d87412a},{0x04e11666,0xc3b30110},
+{0x02e11d93,0xeac6e988},{0x02a02a07,0x4f05f111},{0x01203393,0x8a8a44c1},{0x01c1faf1,0x80d03bf1},
+{0x02202e10,0x8eb7faa8},{0x03001d79,0x82178207},{0x01c0a464,0x8aa9871d},{0x03a10176,0x234dbc4b},
+{0x01e114a7,0x7b536bde},{0x03010b88,0x647ec18b},{0x00c1f5c0,0x22e29bdd},{0x04c1d93f,0x0d6b7a92},
+{0x0260a809,0x177c6c18},{0x0301da85,0x5315a55e},{0x04e021fb,0x2b7e9a56},{0x0280131c,0x5adb88fc},
+{0x030016ec,0xfcd3b4b6},{0x0361e849,0x0f15f0e1},{0x0741d9c0,0x44ca45fb},{0x03e18b13,0x0ed2300c},
+{0x01c0220a,0xe6e125e5},{0x02603024,0xac2a8013},{0x03c01e99,0x990c5902},{0x02011ee2,0x73dda8ef},
+{0x0381e000,0xc3ef68c2},{0x03801d59,0x51a14b47},{0x01a1e2d5,0xbf9e647c},{0x0180a1cc,0x7a54c2a0},
+{0x02010b1d,0x73a610cc},{0x0200307e,0x4829d9cc},{0x00a1f944,0xd6c33616},{0x02e12204,0x501aa9b5},
+{0x02418915,0x9a1630dc},{0x03a1d596,0xf2918e5b},{0x0380217f,0x10c888dd},{0x030024d5,0x4cb6a7b8},
+{0x0181f4aa,0xfeb98b73},{0x020030cd,0x3ccfee92},{0x04a1d657,0x3e1b127b},{0x01e114aa,0x5750f49b},
+{0x03210400,0xabbcd6d4},{0x02601196,0x14f06efc},{0x0200073d,0xf54df674},{0x06e1fb5c,0x0c86e7cd},
+{0x03e1d8cc,0x86cdeff6},{0x02003000,0x7668daf2},{0x024188a5,0xfdd95652},{0x028015a4,0xf3f75cfb},
+{0x02200804,0xfc241e1f},{0x03c1d80a,0x3f2b61fc},{0x03c1d023,0x1bf98a10},{0x010033c4,0x83a18654},
+{0x03602c09,0xa9c9ac3c},{0x0220a9c3,0xfbb7b984},{0x0180aa04,0xc768a07e},{0x02c01db4,0x9e361005},
+{0x03610a03,0x50fb1671},{0x02a1f9b0,0xdbaed287},{0x02c023e7,0xc0a7035e},{0x038109cf,0x16810c09},
+{0x01a00b17,0x33baf0f9},{0x0220314e,0x19603a1f},{0x0321009a,0x37edd0fd},{0x0301680f,0x4358117b},
+{0x02e02bd0,0x7eea8092},{0x01c0a09f,0x200444a7},{0x03e1d8a3,0x2fec4520},{0x05201f1c,0x0f046bb4},
+{0x02a04dfb,0x5f67c7b5},{0x0180237b,0xbb5ed3f3},{0x0280abd6,0xce8e3cc8},{0x02a1692c,0x7716f0d5},
+{0x024012f1,0xc4fe4cc3},{0x02e1327e,0xd0f6dc10},{0x01a0a234,0xe39b1b8a},{0x0280a9e3,0x5b0807a7},
+{0x01e1fb0a,0x97ac3f5c},{0x01c0a6e8,0x254bdbe2},{0x01811ef2,0x7f9db3e9},{0x0280ab0e,0xcac88935},
+{0x01002307,0xb45409fa},{0x00e00ec6,0x31ff6b0e},{0x03e12179,0xba32e71e},{0x03216b7d,0x460a6509},
+{0x0260130c,0x34dac217},{0x02418a35,0x41386aae},{0x0521d74f,0x3af87cee},{0x02210fe7,0xba58906a},
+{0x03412400,0x512d7e47},{0x024189c8,0x9ebe53c5},{0x024008cd,0x4135c943},{0x0421d5df,0x4836bfd0},
+{0x0180a4c3,0xee15f887},{0x0081f443,0x570e0c8a},{0x02e1338b,0xfa54aa0c},{0x0261b0ca,0xe3b88931},
+{0x0300ff9d,0xc877150c},{0x04c00881,0xf70aa81e},{0x01a11801,0xfe273436},{0x02a1043a,0x74efdcdc},
+{0x034015d2,0xf77928b8},{0x02801333,0x7a89c6f6},{0x03010c3c,0xe8eafebf},{0x0380149d,0x45ac149d},
+{0x0320fb35,0x33091387},{0x024001a3,0x15816044},{0x03000449,0x601777de},{0x05200c7c,0xad1fdcb0},
+{0x02001c5d,0x592978cc},{0x0361225a,0x8d72ec70},{0x026124da,0x24b4a4ca},{0x04002dfc,0x2aa1ba2e},
+{0x01a0332d,0x748ec456},{0x03216e54,0x6985501d},{0x01a11746,0x761a6667},{0x038006f9,0x7a30e65e},
+{0x01c00e58,0x06ae2e07},{0x03801e54,0x69e66593},{0x02e032b4,0x5278a10a},{0x0360fed9,0x7e8d77d8},
+{0x02802db3,0x1bb2e5fa},{0x01c0a2f7,0xa4c0dcbe},{0x0380a8e9,0x4a0c45f8},{0x0260ff18,0x1323bed8},
+{0x03c1d4d8,0x29e965d2},{0x03800df4,0xdcbb0fef},{0x02200a99,0x3b5b9d20},{0x03c011f4,0xd7771ceb},
+{0x03801dac,0xe0c34eb5},{0x01e10495,0x6d1e1c51},{0x02e1453d,0x7b93862c},{0x03014474,0x4fd6fb9c},
+{0x022026aa,0x958ee97b},{0x0220102d,0xa2830c6b},{0x03c02c2b,0xbc10cc0c},{0x02a1d326,0xd901ff86},
+{0x0121f51f,0x094138bb},{0x0180a00d,0x648cf88f},{0x010026f8,0xb252a752},{0x026120fd,0xd755f4e0},
+{0x02c1308f,0xab289a6c},{0x020005e9,0x2413b1b2},{0x01a0a42f,0x0320e486},{0x02e144b4,0x9003c32f},
+{0x046109eb,0x1922e979},{0x02a16a25,0x358535da},{0x018023ce,0x99921877},{0x01c0a565,0x94267204},
+{0x0240092e,0xf4a720c1},{0x01c03334,0xa36f40ce},{0x020007a2,0xda468829},{0x01a0a18d,0x684b4a40},
+{0x03010a9d,0xf29e96aa},{0x02e1463e,0x65bf19ab},{0x02010619,0xac2dc3b8},{0x0200a8fd,0xeef59cd1},
+{0x04602b87,0xd8010538},{0x0220fe64,0xf4f49ad7},{0x03401640,0xfb58db59},{0x0341053e,0xe05a4954},
+{0x02602bde,0xd5ac37bf},{0x02c0217c,0x115785a5},{0x0340030b,0x05369922},{0x026e0135,0x17a1b29c},
+{0x01a0a17a,0xe39e2c50},{0x04e1d822,0xdee6c513},{0x0340065a,0x48d84869},{0x02c13100,0xd916a9e9},
+{0x0260aa87,0x048909af},{0x016007d4,0x877a32dc},{0x03c10b67,0x357037b8},{0x0341f138,0xe400e5f3},
+{0x01c11022,0x2a8eed79},{0x0300ff72,0xc7771379},{0x04a01e14,0x5d44288a},{0x01c0a3ae,0x4f09e699},
+{0x03000427,0x2479e862},{0x02c0272e,0x612c9225},{0x02212085,0x32789a50},{0x024112c5,0x2238892f},
+{0x03a0ab34,0x7c2c2233},{0x0280a8d7,0xdf390969},{0x0241d10b,0xdfdf1c2d},{0x02002f46,0x41308e46},
+{0x03402df2,0xa173ca8e},{0x02c1304b,0x781895d0},{0x0281d32e,0x899c3b98},{0x01a1017c,0x79dff140},
+{0x03e18c5c,0x1c989fb7},{0x030118ca,0x97e22179},{0x01e0a57a,0x09c1c802},{0x01e0a307,0xc132b0c8},
+{0x03a02751,0xdaf8ed7d},{0x0581df1c,0xf1be8143},{0x02016adf,0xb0a4a2a0},{0x05a1fa3e,0x094b4b92},
+{0x030118d0,0xe9f58172},{0x02810f02,0x4c5559f0},{0x01e00bed,0x37082112},{0x01c02584,0x17b912d8},
+{0x02603280,0x1d959506},{0x0201f6a0,0x976543d6},{0x0461d617,0xe9a2f927},{0x02000f52,0x9b895f45},
+{0x028002b7,0x698c7e90},{0x03e0015d,0xba347dfb},{0x01c02132,0xf1fa2eed},{0x0460a722,0xbb7d1b30},
+{0x024022d2,0x64f9a6dd},{0x02a0aa63,0xf65cd5db},{0x0221219b,0xf342094d},{0x03202e0c,0x15824fab},
+{0x02418948,0x32812d7d},{0x026124e3,0xf1da2b34},{0x0121f688,0x5a8eee37},{0x03e0021b,0x0a19b21c},
+{0x0501d72d,0xc976fe56},{0x03200395,0x67504fe1},{0x0261b0b0,0x23329167},{0x0181f4d1,0x6e22b1a9},
+{0x01a11612,0x28c92168},{0x02010472,0x3771b06e},{0x020030b5,0xfcc2bddf},{0x01a01955,0x45ddf91c},
+{0x0201238e,0xc9212e4b},{0x0520076b,0x2c1a3ec4},{0x020120f5,0x75ccd60f},{0x0421d224,0x5b72c64a},
+{0x0340fe97,0x71d48410},{0x0381ee1f,0x41aa11d7},{0x020030f0,0x5cb8c7a3},{0x038000da,0x285a6042},
+{0x01e16ab3,0x260f43ea},{0x02e13408,0x9fde4968},{0x02402f8e,0x96acd1db},{0x0540fd76,0x76ebdebe},
+{0x02c028aa,0xdc71f4d8},{0x0480fd31,0xd5dcaa62},{0x02001a10,0x5f2a6fc3},{0x030109c0,0xb4d3da33},
+{0x04a10c9d,0xb6c825f9},{0x01c0a128,0x80982a2f},{0x01a0178a,0x28f80eb5},{0x0561d842,0x731a5248},
+{0x0260060d,0x754e11fc},{0x02003120,0xd390595a},{0x01e0a858,0x98451e20},{0x02c03176,0x5cd0707e},
+{0x014023f2,0x275b4d9c},{0x02e0283b,0xf5cbaf62},{0x028e01df,0x9ae1e227},{0x01a0a309,0xc77da8e5},
+{0x0280246e,0x14c3b487},{0x02c131f6,0xf67ca533},{0x044121e7,0x744261d0},{0x02c0216d,0xb2d7d930},
+{0x02810001,0x2ba565e6},{0x02c13140,0x41c09b8c},{0x04200176,0x1d0959d0},{0x0480fcb7,0xe44c5d65},
+{0x024032bf,0x0583f8b0},{0x01c11485,0x8d7153c3},{0x0200a841,0x46206991},{0x02e169d2,0x74faa766},
+{0x028019a5,0x5e0ead54},{0x02012118,0xc2feec12},{0x01e0a5c8,0xf7c8bbaf},{0x01c0a2fe,0xa48f3ff2},
+{0x02601a1b,0x1d7dea45},{0x0181142b,0x0c2744fe},{0x038015b4,0xe372b13f},{0x02e14616,0x7501266c},
+{0x03401645,0x0f58fad5},{0x016031d5,0xcaac4153},{0x02c131fe,0xf27a6050},{0x0241886d,0x01eaa5bf},
+{0x0360fead,0x4fd878a1},{0x05801f91,0xc4c84649},{0x04a1d30f,0x21761035},{0x024012dd,0x190ddb89},
+{0x05c022fb,0x74f5275e},{0x02210614,0xc517e82e},{0x0441f17e,0x7445caba},{0x02216add,0x1365dbbc},
+{0x02811fd9,0xea840e65},{0x032011dc,0x446c3874},{0x032100df,0xcb67f2be},{0x01a0a446,0xbd570902},
+{0x03c1e113,0xce1f7fd2},{0x0201f537,0x759ac994},{0x02e1103e,0x7d8d1117},{0x0180a0d6,0x6463aa88},
+{0x02210057,0x28c58c67},{0x03e0fba6,0x971d8020},{0x03802c05,0xb7b28728},{0x05200d58,0x3d800335},
+{0x02611302,0x55607a90},{0x024189d6,0x24c3a3e5},{0x020010d4,0xfa6b5738},{0x02212323,0xd3156ef0},
+{0x0381e12b,0x368a99e1},{0x0281682d,0xd0c4c004},{0x028017cd,0x114a5eb9},{0x01c10516,0xfc0bcb02},
+{0x04c0fc1c,0x9693e5a1},{0x01c0a334,0xc55a0d10},{0x02000a2c,0xc1ffe8f2},{0x01c0a19c,0xd128de55},
+{0x03c1d74c,0xe5c2a2ed},{0x02000c4d,0x1cf8b02a},{0x02a169a8,0xe51266a0},{0x0101f4bd,0x08b65197},
+{0x0360a7aa,0xc91a7ae2},{0x01816a5c,0xf78e3217},{0x01a0a019,0x67f52842},{0x01e106f9,0x2f9f9cd2},
+{0x01c16a81,0xeeceff61},{0x0140260d,0x2b2b6175},{0x0441d725,0x294ba3d9},{0x02e02d3e,0xc2266f88},
+{0x02010511,0x9cf696d4},{0x01c0a387,0x9775806e},{0x01e0a918,0x4ecf9bbd},{0x05203366,0x0f151fe1},
+{0x02c01d61,0xb2ca78bf},{0x01a0a0d0,0x24f3d49e},{0x02816b43,0xe670e728},{0x02e0a687,0x0b3f4662},
+{0x036017f6,0x162c2817},{0x02e14475,0x100fc5a2},{0x01c0a0a3,0x23ec460d},{0x01c0a13d,0xbc6b58ee},
+{0x02011230,0x51fb1000},{0x03410f83,0x69c64cda},{0x03602e55,0x82175c65},{0x0601d9e3,0x2a24f188},
+{0x03e1d0ef,0xc7bce605},{0x01e03044,0xbf810879},{0x02a169ef,0xf53e26fb},{0x01202707,0x97fd6ed7},
+{0x01e10703,0xf6674e29},{0x00e00edd,0x9cf36c6e},{0x0441bc72,0xf6262c47},{0x02e132bc,0xccef315d},
+{0x01e11445,0xb7766972},{0x03e18c92,0x738e9b50},{0x0221f5fe,0x52d8b786},{0x03410407,0xcd4db00a},
+{0x02e100a0,0xc3950882},{0x04e1d945,0x129eaf48},{0x06e02b3d,0x3e128bd8},{0x01a0a487,0x4615688b},
+{0x0380ff35,0x56ece409},{0x0501f808,0xfe684472},{0x03e11aea,0x233a2413},{0x02e13201,0xdbc7ec81},
+{0x0121f12d,0x714172c8},{0x01e1131c,0xaabf789f},{0x0240fe4a,0x676304a4},{0x03001cf9,0x27401130},
+{0x04e1d643,0xfbe19dec},{0x0300fb05,0xbc1cb5e0},{0x036001eb,0xeda5cac2},{0x02e1f7b6,0xee670a62},
+{0x0221fb34,0x942735a6},{0x01a10e69,0x2dca3ffe},{0x01e11096,0x4b778361},{0x02c13181,0xb532e334},
+{0x02418873,0xffeaa299},{0x03c1d569,0x0025834d},{0x04800610,0xb90e5595},{0x024188b8,0x10fc067d},
+{0x0540fd6f,0xc5b12a3b},{0x00c1fa72,0x2da28ac4},{0x03a1e018,0x4ed39306},{0x02201b8b,0x58a1df45},
+{0x02c16908,0x74655597},{0x02c16b8e,0x843b4c35},{0x02c02e59,0xf279a494},{0x02611d00,0x6ae5ba87},
+{0x0300fb1d,0xccd651eb},{0x02418ad4,0xea1b8f9d},{0x03212013,0xccc59ce8},{0x01c16f0d,0xcd416f9a},
+{0x0441cfad,0x9aa758e3},{0x0301457d,0xfa07fad5},{0x03c1d7ca,0x2ad7066e},{0x03610981,0x207a063b},
+{0x02c0289a,0x5e797d43},{0x0680fe3a,0x900a5b7f},{0x02201b94,0x58e4c532},{0x02a01562,0x919f63e6},
+{0x03210a66,0x40732bc1},{0x03002a56,0x5b7fc7f0},{0x04a0fca8,0x9e5f870f},{0x03c1f1fa,0x9a2423a0},
+{0x0380ff33,0x58ece72f},{0x02601546,0xf0b56ee9},{0x032001b1,0x54cdaaeb},{0x02a00e04,0x06abaca0},
+{0x01403389,0x67eecf31},{0x02810fb9,0x53b60b05},{0x01a1e298,0xf51ecd89},{0x02602d82,0xb2b09996},
+{0x02c12398,0xcd7647be},{0x02810ae1,0xcabbcd2e},{0x01811401,0x3c3b1846},{0x02c0284d,0xbaccd661},
+{0x030028d7,0xef02e6e0},{0x01c0a22b,0xcc7d0b94},{0x02c028cc,0x54f38ef8},{0x020013b5,0x9004d5a6},
+{0x01c0a091,0x64092ce1},{0x02003073,0x682c4ac3},{0x0201f79d,0x402ede60},{0x01a1f4cf,0xa4e45871},
+{0x02602f86,0xd3f52b59},{0x01e1fb1a,0xcfc76827},{0x01c0a6ca,0xdb0fe611},{0x02a00569,0xb58a42d0},
+{0x03411a05,0xf68dbc7a},{0x03c11a88,0x259a3aab},{0x01c0265f,0x35288ada},{0x0421f752,0xcc3d4676},
+{0x01c11027,0x928503d5},{0x03a01064,0x0e324bcd},{0x026100c8,0x1da6df1d},{0x03a0a798,0xca948d6f},
+{0x01a11426,0xff8e043b},{0x03e18cb0,0x7e89d245},{0x03e18c17,0x88a24417},{0x03c1f974,0x7f71a2a2},
+{0x0261090f,0x4adc5f45},{0x02010394,0x4e51a838},{0x0160060c,0x5bd67aec},{0x02812fae,0x9dfe6efe},
+{0x026124d8,0x19b0164b},{0x03601655,0x7603a90c},{0x01a1142f,0xe0c9a06f},{0x02002662,0xb655c253},
+{0x01a0a6dc,0x874a59f6},{0x02602dcd,0xcb15355f},{0x03e18c6b,0x75955a3b},{0x02602ca1,0xd1e288f5},
+{0x0180a4b1,0x93e31eca},{0x0341d43c,0x3eb2cb9a},{0x028014a8,0x5ee09421},{0x0301f5e3,0x3f870fd8},
+{0x0180a04c,0x8a86789c},{0x02410396,0x2690fd74},{0x036011c8,0x58f73632},{0x01c0a173,0x6a09f724},
+{0x0281100d,0x8cd97f01},{0x0361d5c3,0xcf9c9918},{0x0460fca5,0x87bc3980},{0x02811d51,0x6473c793},
+{0x03401575,0x6bb8b2fd},{0x02418993,0xb1cb3da1},{0x03202e2c,0xfa0581f7},{0x02812fab,0x9afe6a45},
+{0x028121b1,0x5ce74c29},{0x03e01fda,0xb09a5819},{0x026104e0,0x06945eaf},{0x0261b059,0xc5f9da1a},
+{0x0641d83d,0xee3306e8},{0x03e18c71,0x8293301b},{0x02a01033,0xf7fd3458},{0x012000b5,0xcfed18e6},
+{0x03a0fb9a,0xed999087},{0x0341f142,0xfe010ee1},{0x0281f5f5,0x953055a9},{0x0421d786,0xfa1b409b},
+{0x03e1d57c,0x78f51aba},{0x022112d4,0x10588590},{0x03811ab5,0x17e44036},{0x02e1454c,0x8695d614},
+{0x03616887,0x27873b41},{0x04602521,0xb02e2982},{0x024189fb,0x3f33ea5a},{0x034000e3,0x92394163},
+{0x01e1106b,0x77e39993},{0x02c16b34,0x5abee98d},{0x02418a58,0x56ae5c44},{0x0320ff8b,0x1c70d67d},
+{0x02c16938,0xedc3a1a3},{0x02402d4a,0x2c9672ed},{0x02c1d430,0xea9800ba},{0x04e01df4,0x7ef95e5c},
+{0x02418a15,0xb530d285},{0x0281683a,0xfa78f4a3},{0x0241d15c,0x18188eed},{0x01e0a6c7,0x6fc0abc1},
+{0x01200035,0x9791d076},{0x02a0151d,0x0bc31155},{0x020008e6,0x70ba5f3a},{0x03e18ca0,0x048ce3ce},
+{0x0300a67d,0x36745f73},{0x02c00902,0x8c979539},{0x038018c9,0x06732390},{0x0201bc39,0x7acd41c6},
+{0x02c1bc21,0xf8c78efb},{0x02800222,0x7b4787cb},{0x01e10727,0x86712b35},{0x0321f664,0x468db38d},
+{0x0200aa45,0xdac582a4},{0x02c1319a,0x062e9f86},{0x01c0a455,0x46890e09},{0x02c1f08b,0xd7c98107},
+{0x02200d28,0x3a2245cd},{0x02a0a811,0xd3ea3a5b},{0x034111f2,0x0088a6c6},{0x0361e813,0x04ea6d47},
+{0x02812fe0,0x970d6e83},{0x03c02c7b,0x7f0412f9},{0x0421d229,0x5272b81f},{0x0300fb44,0x6a6ff4e9},
+{0x03010845,0x58ce9c95},{0x01a1f19b,0xcc87c0e6},{0x01803338,0xd7c7178b},{0x010026f2,0xee42b5b5},
+{0x0261b0c1,0x16732446},{0x02e001f6,0x4e75a53e},{0x02a02cfd,0xa7106aae},{0x02600923,0x8a33f09e},
+{0x0281e7e2,0x67fc014e},{0x0200a9ca,0xe6321dc1},{0x0320ff93,0xd67d343e},{0x034011c3,0x384c876f},
+{0x02e10894,0x6f43c23f},{0x02e0a4ff,0x940c379b},{0x01e16f7e,0xd9a38d7a},{0x02c13371,0x9bc355a5},
+{0x0241089e,0xaadb91ce},{0x02a104b2,0xac43d722},{0x03e004cd,0x6b961ed4},{0x02c16955,0xfa3d0543},
+{0x01c0179e,0xd0962231},{0x02a0a824,0xfb7567d1},{0x028e01b4,0x745e0116},{0x04c004f8,0x15d7d564},
+{0x04001d89,0xc80bd744},{0x01c10499,0x211cb908},{0x0361d68d,0x2c06d179},{0x02e10c11,0x3856f864},
+{0x0600fce0,0x23bfbacd},{0x028104b3,0x75f04b6b},{0x0600fc66,0x8e27dd48},{0x01a0a29b,0x87568e30},
+{0x034010fb,0xb1d0173a},{0x02010748,0x7566b12f},{0x03a001fc,0xccb76533},{0x02202f63,0x3286fa63},
+{0x03212234,0x01864ac1},{0x02201838,0x841919ff},{0x04c01f2b,0x4c73049b},{0x02e145f3,0xe9f98fd6},
+{0x02410a30,0x5df3f22d},{0x02a12136,0xf67e1cbe},{0x0281d2f2,0x69817524},{0x01403328,0xc104d9c0},
+{0x0320329d,0xc47970a4},{0x0381d19b,0xa7f98f94},{0x04800873,0xc402d0cb},{0x0301237f,0x430300e3},
+{0x02200d6c,0x82adaf6f},{0x01a00b2c,0x3fb2b518},{0x03a120d4,0x4d1a4cfc},{0x03000462,0x23c4871e},
+{0x01e00b69,0x11ec8072},{0x0200a948,0x7edd3cd9},{0x02e1ed0e,0x042a0223},{0x01a11730,0x624fce8f},
+{0x01a11454,0xcc265075},{0x0280326b,0x63124aeb},{0x01e0a594,0x33e4ce4c},{0x03410857,0xa554f81e},
+{0x0421eea1,0x50f6312f},{0x0421d225,0x5c72c7dd},{0x05002565,0x531684e9},{0x01e1fac5,0x43fd05a3},
+{0x0341d6bb,0x4a1f044c},{0x01e11332,0xdeb9ba4d},{0x02c1315f,0x3ebc19a5},{0x04610cec,0xcb675c64},
+{0x0421d634,0x49b1ee6f},{0x02812f9e,0xa8fa0321},{0x02c16b74,0xe22d4b9e},{0x01a02084,0x65827e2a},
+{0x0321f7cb,0x9e851580},{0x0460fcec,0x2bb962bc},{0x02a031fd,0x6b49d8f3},{0x02800d47,0x5184dc52},
+{0x02610526,0xbfb8b21a},{0x03002c41,0xf0063471},{0x02401261,0xd8f9ef11},{0x01c10ea5,0x7a8e7e3b},
+{0x0421f867,0xb7f4447f},{0x00c1f93a,0xc68674ac},{0x04402361,0x2302feae},{0x0361d5cb,0xd79ca5b0},
+{0x02c13028,0xf72496b0},{0x01a1f5c6,0x0c91a931},{0x05212425,0x2198763e},{0x0261ec76,0x89686e4e},
+{0x0221bc59,0xa745ae2d},{0x024009cc,0x695208b5},{0x0321252a,0xd2f1c859},{0x0180a6a2,0x50d1a860},
+{0x02810ad0,0x234c211c},{0x01e10110,0x9cdbb808},{0x02e145d7,0x71f21729},{0x03e01679,0xfd54d164},
+{0x026012eb,0xc7ee7705},{0x02418ad5,0xe71b8ae4},{0x02c111e1,0x75af836b},{0x03a1d587,0xe39176be},
+{0x03a10b6d,0x28335dd0},{0x01a007ac,0xebb9c69a},{0x02210898,0xe13defdd},{0x02400eb1,0xbdd71644},
+{0x02418ac9,0xdb193969},{0x0381da2e,0xfc0885dd},{0x01a01966,0x06bf80db},{0x01c0a39e,0x02af58f2},
+{0x03e18c65,0x8a957b4a},{0x0360088b,0x64f4ae96},{0x0260a89c,0xfee32022},{0x02c1f56c,0x27602ad2},
+{0x026021a5,0xe245e175},{0x02011290,0x92078b7e},{0x01e0099c,0xab2ff588},{0x0401f10b,0xb55a5f7f},
+{0x02400d33,0x5757b1e7},{0x03a01d12,0xdf243ec8},{0x028168f0,0x1ba6542e},{0x01e02ee4,0xe84ea794},
+{0x040025a9,0x0dde9506},{0x07001f8d,0x4bb87afa},{0x01a0a0c9,0xdc830b9f},{0x0240aa80,0x14add8df},
+{0x0261b07b,0xbe2f8e01},{0x01c16f6a,0xc4f331a8},{0x02418aff,0x6511c3e2},{0x02800e3a,0xee345474},
+{0x04e0255e,0xd63938cb},{0x02a0186f,0x703f76cb},{0x02a03167,0x7218cc71},{0x0481d00e,0xe5eea0ca},
+{0x04a1d16d,0x10602580},{0x03e18b5d,0xedc901bd},{0x03a1d718,0xd125ec20},{0x05e0fc69,0x748b977e},
+{0x02c1f30d,0x626bb8f0},{0x06800773,0xec96645f},{0x0421d5e7,0x4036b338},{0x02010618,0xad2dc54b},
+{0x01e0170d,0x68555c59},{0x0181f16b,0xf1627fb5},{0x026012cc,0x24832b47},{0x01e01a52,0xafbc0469},
+{0x0300112f,0x6360524a},{0x03e1d919,0x455a9dd3},{0x02601bb7,0xfd473825},{0x0261091a,0x30ac4cb8},
+{0x044008c6,0x0973a887},{0x01a102bc,0xb8f0a2a0},{0x01c0a3a2,0x4288ae42},{0x03a0faa1,0x28708025},
+{0x024008d5,0x2e0ff3e0},{0x0300313f,0xc73652d6},{0x0300028f,0x03b8c2a3},{0x03600d9f,0xb2732200},
+{0x01c00bf4,0x6d4ac95f},{0x02c10c03,0x3f92e830},{0x02c0284e,0xa27a4bf2},{0x04a0fc2a,0x70f9f3f1},
+{0x04802bab,0x1c8a79b6},{0x01e1bc01,0xe5675633},{0x020108f4,0xfd6e48e7},{0x02a0044e,0x35c4fdb1},
+{0x02418810,0xfb7cbd5d},{0x01a02bfc,0x054fabe0},{0x03014481,0x11c9ce0f},{0x02c1f5f9,0xd820a3fd},
+{0x04a12393,0xafc422ec},{0x02e145a3,0x7b36f05d},{0x01a02107,0x8f148292},{0x02e130f3,0xda892fa1},
+{0x0641d94f,0x2ff9e439},{0x03c00454,0x35f86995},{0x036012d5,0xd07cb9a8},{0x03001108,0xb297f897},
+{0x0401d057,0x51c4cdd4},{0x02012300,0x45c64e05},{0x0260091e,0xaa67fe61},{0x02611c44,0x19369a0b},
+{0x07201faa,0xbd00cf58},{0x02a02472,0xb1fa619e},{0x01e121f7,0x80112873},{0x03603238,0x14466ba6},
+{0x02812fcd,0x1af4a669},{0x02e1442d,0x1a6ea9c6},{0x01a0a272,0x969ff1b0},{0x0361f0cc,0xf6efd3d6},
+{0x03e18b9b,0xcfbe4527},{0x0381232d,0x98d2f52f},{0x03c004ef,0x7de3ed34},{0x01e0222e,0x34c5edd1},
+{0x0041f402,0x76e4a092},{0x0261d1b8,0x648bc1ae},{0x0480fca7,0xedcddd6a},{0x03c0fe2e,0x02755540},
+{0x034109bf,0xc4406c74},{0x02c1320b,0x74775b5f},{0x02c131c6,0x57faa7ad},{0x0201f9ef,0x841578f2},
+{0x0340a973,0x895c5cb4},{0x0640fd5e,0xfd34354e},{0x03e00175,0x82a09ecf},{0x0280133f,0xd64028d5},
+{0x03610cae,0x8dbfe072},{0x01a10282,0x14ee316d},{0x02400e14,0xe82f2fb5},{0x02e16f9e,0xf2230d41},
+{0x04200124,0x17722e83},{0x02200905,0x648005b6},{0x02c1f0d9,0xabf2f9b7},{0x02a02ad1,0x3aaa87fb},
+{0x022104a3,0x6abbbb44},{0x0321fb76,0x63828f7f},{0x01e00c97,0xfd393dcf},{0x02e0a683,0x5e3d6641},
+{0x02000a1c,0x11ecdf2a},{0x02210058,0x25c587ae},{0x0261d317,0xfa963eee},{0x0241f3e3,0x48f0740c},
+{0x03c1d7eb,0xc491fea4},{0x01e0a3a3,0xdb259c0c},{0x02a014a4,0x693a8bd4},{0x02418890,0x00ddd839},
+{0x03e1da68,0xa9e40135},{0x0881f502,0xf085e5a3},{0x01e11439,0x4fe3b536},{0x026118e4,0xce8aa9b9},
+{0x032120d5,0x55016a6b},{0x01a0a074,0x690672f6},{0x02002b0d,0x88b7a34c},{0x02000a5b,0x31c46f1a},
+{0x02e1200d,0x65782a75},{0x028018b4,0xc530a168},{0x01a16f0f,0xa661de8a},{0x02211adb,0x7ecbc187},
+{0x01c102b8,0x260b34e1},{0x04a1f886,0x0df6f7f0},{0x02a1fa1f,0xb729bd2e},{0x0420fb50,0x83d0eae2},
+{0x04e0fc2b,0x5a97b26b},{0x02c132ac,0x4707048b},{0x0241f94b,0x86d516d9},{0x04e1d651,0x11e1c08e},
+{0x04e1df0c,0x23cf648d},{0x03c0a721,0xceff03c5},{0x0261b0cc,0xe5b88c57},{0x02e145ef,0xedf99622},
+{0x02e14417,0x1b7db5e3},{0x0180a02a,0x4e58fa8a},{0x024189c6,0x9cbe509f},{0x04a1d65d,0x381b0909},
+{0x02e1684d,0xa06e7309},{0x02601345,0xc08e98fd},{0x0380013c,0xa378667a},{0x04a0fc21,0xcb0a76c5},
+{0x0221219a,0xed41ffdb},{0x01a01798,0x0b0f38ca},{0x02c0034a,0xfbad0d4d},{0x01002652,0x3649b0d0},
+{0x03e18bb3,0x17eaa04b},{0x02a16a16,0x9b73dd0c},{0x02410a2c,0x45ead209},{0x02c10045,0x48d250fa},
+{0x0280129b,0x57b83f63},{0x03e18cc0,0x78878a3c},{0x03000611,0xab701bba},{0x018031ca,0x142a5e05},
+{0x04816809,0x5effbbbe},{0x0200a6ee,0x4a40a28d},{0x05001f0b,0x87e048cf},{0x03e18c08,0x83a47acf},
+{0x02c02587,0x60516fa8},{0x02400596,0x35300e0b},{0x02202d40,0x210aa58d},{0x04201ac3,0x17bddcd4},
+{0x03600242,0xd6fbcd81},{0x03a1d594,0xe0917205},{0x02c16b89,0x5c194d2a},{0x024189f2,0xa8dc7897},
+{0x0420011c,0x94f611e2},{0x010000a2,0xca4c422a},{0x02600606,0x66936707},{0x028110e3,0x0e0df72b},
+{0x01c10e90,0x2c9acf64},{0x0421d5e2,0x4b36c489},{0x04e1d647,0xf7e197a0},{0x02e13251,0xf5918624},
+{0x02011a64,0x1c03f8b6},{0x0361e8b4,0xa1f6d6a3},{0x0300202c,0x6455e5f7},{0x0361e8ac,0x582a081d},
+{0x01c10e62,0x7c1d5e55},{0x01a1028d,0x06ee1b63},{0x0381d242,0x4ff66a6e},{0x0380267d,0xf9917918},
+{0x0241881b,0x6e842e2b},{0x01e10b14,0xd92c5b15},{0x01a0174c,0x2c0a1487},{0x0301d6c8,0x626bde03},
+{0x02a0ab8b,0x1d2f7bde},{0x00c1fad6,0x034f74f8},{0x02c02725,0x5fdf1385},{0x028019a4,0x79ffcede},
+{0x02e1459e,0xe539d5d2},{0x0641d9ee,0xfe6cd932},{0x01e0310a,0x97fa1f14},{0x03802382,0x149fbc94},
+{0x02e14590,0x73326697},{0x02811d7b,0x22a0d86e},{0x02202f9c,0xb08b1175},{0x0380ff31,0x5aecea55},
+{0x03a1d59a,0xf69194a7},{0x03816874,0xe43664b2},{0x04002356,0xd58bac94},{0x0340d7cf,0x82fa77ab},
+{0x03e0fb9f,0xd53ba6b0},{0x02002e80,0x51766f36},{0x02000a67,0x4cd84088},{0x03210fb7,0xd924eeb6},
+{0x0261b084,0x69e0838f},{0x04a004f6,0xbc1030e7},{0x03a03018,0x7a4533c8},{0x04602535,0xce9323f9},
+{0x02c12281,0x83c6f870},{0x02c01858,0xee8a790a},{0x01c0a069,0xfb1d80f6},{0x032111ef,0x70c51e44},
+{0x05e01dec,0xf30279fa},{0x01c0a245,0x6d49c874},{0x0181f38f,0x89a5a848},{0x02e1204e,0x19a6b895},
+{0x0541df12,0x64be7d18},{0x06a1d1cb,0x69a6fe8c},{0x02000798,0x26d6d404},{0x0401f116,0x233012f0},
+{0x02c10d11,0xcf0f20fb},{0x026003c6,0xc58b81fd},{0x01a1f378,0x747f3989},{0x02c1d31e,0xb819a6fa},
+{0x03e0324b,0x341681f5},{0x02402b25,0x4e54f7a9},{0x02a1d2f1,0x1eec9d92},{0x03e018a4,0x59ad1b2d},
+{0x0420a8f7,0xd470c04c},{0x01e0271b,0x04badaba},{0x00c1f3dc,0xbcc4057c},{0x02c1313d,0x671e4538},
+{0x03c01e28,0x7c1e16f5},{0x03a1d1a5,0x12dd20bf},{0x01e1010c,0x88e56517},{0x04800212,0xe91a4ee8},
+{0x01e009af,0x9b503003},{0x024188d7,0x1010da70},{0x0461d773,0x4b0d7f4b},{0x03804df5,0xef6c0cbf},
+{0x0341d434,0x36b2bf02},{0x0480fc54,0x0cecc9d4},{0x03c1f1f3,0xb5244e21},{0x040003ad,0xf25898cf},
+{0x02802805,0x088db4f0},{0x02010e6a,0x297bfdca},{0x02812001,0x56fe2082},{0x02200a2d,0xecf265d4},
+{0x00c1f9fa,0xb030fa93},{0x03c10ce3,0xfdf3eb7b},{0x02e0ffe9,0x941dfcb5},{0x02c1d912,0xc3cb83e1},
+{0x02010300,0x17812505},{0x0201103c,0x42b5ea8d},{0x02c0261a,0xc14f09d5},{0x01c0a25e,0xfed23442},
+{0x026012b0,0xdb37e0d1},{0x028018c5,0x5db1f508},{0x024189bc,0x20c15f02},{0x0321f729,0x59b6c952},
+{0x02802c9e,0x38d49b6e},{0x0181f6f5,0x55956ae1},{0x02003187,0xd0645992},{0x02210f3d,0xc6ef6dcd},
+{0x02210373,0x8a4364ea},{0x0180a953,0xf9de39ec},{0x02200078,0x29576790},{0x01c11633,0x34ddd38d},
+{0x042009f0,0x9eb9b2c2},{0x01e1102a,0xda002e3b},{0x028003b9,0xaf27fdbd},{0x02e003e2,0x6638ea48},
+{0x02600fc4,0xf783e084},{0x01e0a19d,0x485581df},{0x0181f3f1,0xf2b6245e},{0x01e1222c,0xa013996a},
+{0x03610c8d,0x9ebffb35},{0x0161fad0,0xc8e0f5ef},{0x01e11c76,0xdd5120d7},{0x03a1e140,0xd3e18346},
+{0x02a11716,0xf9edf85a},{0x06600778,0xd47cd942},{0x0301f03e,0xc965afd8},{0x02c13265,0xecb0a390},
+{0x01c16aac,0xf4e051f4},{0x03610540,0x52453645},{0x02201b8a,0x9cd8644b},{0x01e1f6e0,0xf024d249},
+{0x020030c2,0x3ce7f378},{0x03e01e44,0x96022273},{0x0280fb00,0x4ffd4099},{0x0321d111,0xa0bcd850},
+{0x02e13241,0x6c74818a},{0x02816b31,0xecb5e405},{0x02410a26,0x0e088ef5},{0x02418a5b,0x53ae578b},
+{0x02a01554,0x7b36c957},{0x01e009a6,0xa747f422},{0x02011215,0x1a265af4},{0x00e1f427,0x80255a9f},
+{0x02c133bc,0x9415e518},{0x02411d45,0xa235c3fe},{0x020010d8,0xba89078c},{0x03e1d860,0xd9df7e37},
+{0x0361d5c0,0xcc9c945f},{0x03c11ab9,0x8cea1c09},{0x01a0a1cf,0x4b959718},{0x06202b3c,0xb9923165},
+{0x04a0335d,0xbba17f55},{0x01803333,0x04def7ba},{0x03201a5a,0xdf60f966},{0x0200272a,0x44d9c570},
+{0x0381d1b9,0x5a61a029},{0x02e0285e,0x9b80e321},{0x046109e6,0xf62e2ae7},{0x01c02219,0xfecb7721},
+{0x04c02c27,0x1f34896e},{0x0260105d,0x842a3141},{0x02812fb9,0x14f01fc9},{0x02c0186e,0x543dafe6},
+{0x03c00122,0x71e43182},{0x010033be,0x9fb53a20},{0x02418aca,0xda1937d6},{0x0421d22c,0xc67a2a80},
+{0x03602c64,0x76114209},{0x0360157a,0x1fad8aac},{0x02c019eb,0xd9e81676},{0x04e02942,0xa7aae2ad},
+{0x02400d1d,0xb8b53285},{0x00c02022,0x7943edf9},{0x01a0a1bf,0x9777f9a8},{0x03010a8a,0x972e719a},
+{0x02c1336c,0x97c34f59},{0x02800d96,0x89293508},{0x02ce0055,0x7a3c7a88},{0x03e18cb2,0x7c89cf1f},
+{0x02c1d41f,0xdb97e91d},{0x0260014b,0x9b05f794},{0x0380fb88,0x1a2eb4b1},{0x04001f50,0xf289b98f},
+{0x02c132e5,0xc94ab176},{0x02802ad7,0x9d02e0dc},{0x03800179,0x83d24349},{0x02802a08,0xebccb545},
+{0x04c00755,0x9c9ff1ff},{0x02c11a00,0xb460a455},{0x01a11087,0x49b0afd2},{0x03202a21,0x8236e849},
+{0x01e11eee,0x3ebe8020},{0x008023db,0x35f0ae10},{0x0380153a,0x89e4a83b},{0x02c00447,0x16c6e717},
+{0x02c13338,0x4eb71772},{0x0320287f,0x2eef4060},{0x01e1e2e0,0x11c9d951},{0x02a11003,0x88beffe8},
+{0x020121f4,0x7916dd32},{0x03c10b5c,0x9bcf0f07},{0x0241f0eb,0xd1702c23},{0x03c1d4e5,0x3ce983bb},
+{0x02401200,0xf0e07cf3},{0x00e1f308,0xa7546109},{0x03801ebc,0xd84f0390},{0x01c0a214,0xc087860c},
+{0x03001892,0x075ba2d1},{0x02000e98,0xca507aca},{0x02e1313b,0xc0ae04c9},{0x02e02c53,0x6eae8101},
+{0x04e02369,0x736dd5fb},{0x02602aec,0x7210a274},{0x02012335,0x0d6af30e},{0x0520fda1,0x0e1d7f3f},
+{0x028e01d7,0x92d08c6e},{0x03600338,0x7a581836},{0x03a01e05,0x85b6b776},{0x0341f6e6,0xf47aa14b},
+{0x02003123,0xda995ebb},{0x03212302,0x8c0661a3},{0x01c01c0a,0x8402f83b},{0x02418a31,0x453870fa},
+{0x036001e5,0xbe4dc659},{0x05e02ff7,0x0761eaba},{0x032118da,0x384e7943},{0x0340ff49,0x00e0d3d0},
+{0x0361d874,0x258261ed},{0x02c12170,0x38288ea6},{0x02404de0,0xbb457a1c},{0x03c03240,0x2b17b7c8},
+{0x0401ed27,0xe1577c49},{0x0281ed2e,0xcb0ec7b2},{0x02800d8a,0xf453e9d4},{0x05a1fbb6,0x04b8eb96},
+{0x0361d512,0x10bc516d},{0x02c13001,0x8c1d327a},{0x0260aaf0,0x1be3cc38},{0x02a121a2,0x4dd36d7d},
+{0x01003397,0x9899589e},{0x02400809,0xa88c8a3d},{0x01c1e2d4,0xcb4eabe3},{0x04801f22,0xc862d0e5},
+{0x0241890d,0xa2163d74},{0x01611400,0x72e24a23},{0x024108ad,0x45e0e466},{0x03e02bf4,0x60255749},
+{0x02200d68,0xb5255025},{0x028e0163,0x8571a391},{0x02e16e7f,0x6dd4639b},{0x02c130ee,0x10d28756},
+{0x03c01520,0xad98f49e},{0x036011e0,0x591a5cb8},{0x034014bc,0x5b474663},{0x03216e5b,0x67854cf7},
+{0x0361d6f1,0xaa3d2a44},{0x02202faf,0x7e4a5ce8},{0x02e14408,0xa978853f},{0x028e01c3,0x1ad5dfb4},
+{0x02410fe0,0x5a647eaf},{0x02a0aba8,0x39184ea3},{0x03e02340,0x125f7164},{0x02a1ecac,0x1163af8c},
+{0x040004a8,0xc469f16b},{0x038014ad,0x691829db},{0x04c02bc7,0xcd70fb35},{0x02002710,0xb79886b2},
+{0x01a0a3cd,0xfe644f98},{0x038004a1,0xd7a4c03d},{0x0121f42d,0xfbc42895},{0x02a03095,0x4944e395},
+{0x0681d9d4,0x0ceb784e},{0x02c16968,0x271092ad},{0x034124f2,0xcd8d8313},{0x02802419,0x71d8ce53},
+{0x03801882,0x624d01a2},{0x02602700,0xc198e511},{0x02c1fb8b,0xc7ace0c9},{0x0241192d,0xb79bc049},
+{0x02801440,0x9af43522},{0x0580fc3d,0xe41491a7},{0x0221f5d3,0x7095a5ff},{0x01c017cc,0xa1f8e3b3},
+{0x0341d440,0x3ab2c54e},{0x0301f6a8,0x3e1e3fac},{0x03a02977,0xe20df1f7},{0x03011a13,0x43fcb2c6},
+{0x0341d44c,0x2eb2b26a},{0x04c032c8,0x1a431f0e},{0x02c0a806,0x9e7fb099},{0x02e1339e,0x223d8fb5},
+{0x02c005c7,0x37e0b75a},{0x02a006c9,0xf469bd77},{0x03610c92,0xa1bfffee},{0x02e14523,0x88b3ee4e},
+{0x0460a754,0xb3258480},{0x02c131fa,0xf67a669c},{0x01e1da30,0xa5769ddd},{0x02a0098b,0xf0e9424c},
+{0x020122f0,0x97b34763},{0x0180a1d6,0x9654eeb4},{0x024010e8,0x3e179a53},{0x03411fe9,0x73cf00d1},
+{0x03611af0,0x576132d7},{0x03e18cb8,0x8689dedd},{0x02c11360,0x9c7574eb},{0x03a0fdfb,0x55cdf52e},
+{0x02a01848,0x56014e3b},{0x01a0191c,0xdabcbd77},{0x03410a7c,0xa48f2ff0},{0x03e18c68,0x7f9569f9},
+{0x02e13264,0x8d145620},{0x03800d04,0x2ca9b2dc},{0x03a1d870,0xaf4cf388},{0x01e00637,0xa36a533e},
+{0x0541f727,0x62d8c3f8},{0x02812f9d,0xa6f9fffb},{0x0200a913,0xe429a4f9},{0x02601b34,0x9724c05b},
+{0x0441d987,0x94d76a71},{0x0241d122,0x1ad1f455},{0x01e11721,0x367091aa},{0x00a1fab8,0xd5670332},
+{0x02202fa2,0x7653a6f6},{0x020013b3,0x9804e23e},{0x0260129d,0x30b8b2fc},{0x02210480,0x8a3345e1},
+{0x02801845,0x4c8606d6},{0x04002c7e,0xfa9d369c},{0x0181f796,0x9dedddd7},{0x01c10b0c,0x21d8bd18},
+{0x02201039,0xb737ed5f},{0x020030ca,0x38cfe846},{0x0640fc04,0xb8f94b55},{0x01a0a0eb,0xea0e0e1e},
+{0x068022f4,0xa1b595eb},{0x01e0a359,0x50d755e6},{0x01c1d305,0xb7f095f8},{0x0240a9c8,0x793013b8},
+{0x03810b6f,0x12fc810c},{0x028169c9,0x86013df3},{0x0220a9d0,0x1207643b},{0x02a10029,0xc70e92f6},
+{0x02600d85,0x1bacec89},{0x02c13350,0xcfbc5fb3},{0x03e1cf71,0x85603269},{0x05002547,0x87b72174},
+{0x01a1f531,0xcfe8f2b5},{0x02602f43,0xd09ec8c5},{0x0641da07,0x9b5c4cc8},{0x04601b6c,0x4bba2816},
+{0x0201f5e8,0x05848440},{0x0361da52,0x92adee5d},{0x020031b8,0x9c9f0d4f},{0x01e16a8a,0x80d8458c},
+{0x02800b61,0x92085a8e},{0x0621fa42,0x73c9f027},{0x0621cf9f,0x6385e986},{0x02010b03,0xae9e2294},
+{0x0261e90b,0x8d9d5f39},{0x04c12066,0xf49747b4},{0x0260d7ba,0x0ef0658a},{0x0420015c,0x3e5ed36e},
+{0x034006c3,0x43d3487b},{0x01a0a5ca,0xf0e32654},{0x0401fb9a,0x71422ec2},{0x044120a8,0xbb5c67f6},
+{0x04601e73,0xda0ca0b1},{0x02c133be,0x9615e83e},{0x03c01dea,0x910aafea},{0x02c02cc1,0x0893b3d6},
+{0x0281fbc9,0x91d61142},{0x03c1078a,0x4c2f6eff},{0x020103ae,0x82b53cb0},{0x028110dc,0x88e82f23},
+{0x0420fd22,0x9bf7d7c0},{0x0261f7a6,0xca070728},{0x02ce0043,0x703c6aca},{0x030006ea,0x08c9ef75},
+{0x03a0fab3,0x1e6e31d0},{0x02c13385,0x28c06205},{0x02003061,0xac62cfc9},{0x01c0a589,0x8a151925},
+{0x03016e9a,0xd092f0ad},{0x01c0a01a,0xcabed277},{0x0421d62e,0x3fb1deb1},{0x04c001da,0x91fa66cc},
+{0x02e14548,0x8595d481},{0x0400016e,0x7659bb45},{0x0261d31a,0x6d8262d8},{0x0201f4b1,0xc8e4fa27},
+{0x02016f74,0x5e436662},{0x02010665,0xcbda699f},{0x02010b1a,0x73747400},{0x03a0d7e1,0x3cc9aa26},
+{0x01c0a574,0xe3bd0b56},{0x026124db,0x89b78260},{0x04c0fcbc,0xd601c260},{0x02200d2a,0x363bd767},
+{0x038015df,0xfdbc7b92},{0x0221030c,0xa843ba1c},{0x02e13416,0x2fd22c15},{0x02c01d2c,0xa7e7e663},
+{0x03e0a765,0xab1fa081},{0x03a0fa7e,0x013b318b},{0x0260d7b4,0xadc5ccfc},{0x02e10d08,0x5aba3a43},
+{0x02610a1c,0x8d39ab0b},{0x02802d93,0x6afe346e},{0x0201112c,0x02f0b71b},{0x030120a5,0x2dc9f02d},
+{0x02012104,0xbcb9be1c},{0x01e115a7,0xa543cc43},{0x03c1f22f,0x19bd9b77},{0x020108e7,0x31ef3970},
+{0x05a02572,0x6d87fa31},{0x05202a77,0xd7243db8},{0x02e10c47,0x7c52e642},{0x02610fc4,0x360c20aa},
+{0x02200d14,0x6615bf1e},{0x03e018ee,0x6cf96ba5},{0x02a101f0,0xd8b5c35c},{0x03c1d092,0xd9cbc38c},
+{0x034000fd,0x8848f139},{0x03000550,0x22495e11},{0x020030ef,0x64b8d43b},{0x03e18c93,0x748e9ce3},
+{0x03c1d70a,0x109d8a87},{0x028102e5,0x970919b3},{0x01e02070,0xecb84a71},{0x02a024f6,0x419571f1},
+{0x0321e131,0x08b08c7e},{0x02210830,0x9be08180},{0x01e02ce4,0xa51c043a},{0x0240a88e,0x2df4b3b1},
+{0x0561d767,0x168a2ad4},{0x03601628,0x2a7537b7},{0x0540fd3d,0xda212efc},{0x04402b9c,0xc208f612},
+{0x03000262,0x01b8bf7d},{0x02811c3e,0x090cb56c},{0x04012059,0xab3021a3},{0x030008d4,0xee928bf4},
+{0x01400033,0x86f61bb6},{0x0601d99c,0xf52cc19e},{0x01e16f98,0x79986e54},{0x02800f88,0xa9f6199f},
+{0x02c13032,0xf5134a69},{0x02a023d0,0x375acbfe},{0x0181f50c,0xb721eee6},{0x0480fd28,0x37f0aab9},
+{0x01a1f3a2,0x278abada},{0x03402ac9,0xb5c7fc3e},{0x0441f877,0x8c924550},{0x0381f708,0x712c2dc4},
+{0x0180a102,0xa6688f9c},{0x028169ff,0xacc922c7},{0x02c11180,0xdf1834a1},{0x03a1d138,0xe545e6ab},
+{0x0320fe98,0xa8eaaee4},{0x032100f1,0x496af7af},{0x0540fe87,0x85fdfef6},{0x02a02afd,0xe80055d7},
+{0x0121f916,0xedbdb9b6},{0x02011a73,0x749e6e1e},{0x0441d71e,0xd0faf24f},{0x0421d5ec,0x3d36ae7f},
+{0x0401d220,0xfe41b0b0},{0x024188bd,0x11fe46a7},{0x04c12257,0xe0874106},{0x02418ade,0x661e9168},
+{0x01c0a080,0x0a627546},{0x0201fb39,0x27e8d2c3},{0x02001016,0x8e20ef33},{0x01a0a058,0x590659c6},
+{0x030027c6,0xa535dea2},{0x01e00603,0x3a12712d},{0x02a1cf6d,0xd39f4c67},{0x0341f7c5,0x2a2d7540},
+{0x0521d7b4,0x68044c6c},{0x01a0a325,0xcba651a1},{0x020032d1,0x35a99db8},{0x0141f6c9,0xd9ad0c72},
+{0x0441affa,0xcd524d29},{0x02003052,0xa8397b76},{0x01e0a44e,0x8adddb88},{0x03a02337,0x8573779f},
+{0x02c114ba,0xc23d22f1},{0x01c11fdd,0xf005e4dc},{0x036011c9,0x4a3fbcfe},{0x01e00794,0x2f11ff17},
+{0x0541cf0b,0x4392099b},{0x01c10299,0x33f0cd8e},{0x0241d306,0xab073ad8},{0x0120274c,0x7ad27ace},
+{0x02202ec2,0x836176b7},{0x02e0fbdc,0x9214b817},{0x03a02389,0xc297595a},{0x02002b7e,0x05be550f},
+{0x0361d513,0xf1bc20a0},{0x02c00586,0x48f838a8},{0x016025ef,0x4e62a3c8},{0x01603308,0x5c2be09f},
+{0x04016b5f,0xde034e15},{0x03801384,0x42e3b42f},{0x04c02771,0x37fc0561},{0x03a004ce,0xd5d449cf},
+{0x02c03185,0x46bd5345},{0x0321da43,0xfdc9b121},{0x0381079a,0x5207d0aa},{0x028031b6,0x08982151},
+{0x0480fce7,0x43872e49},{0x0461d613,0xcda2cd13},{0x02a12280,0x37b62b92},{0x02e016c6,0x618c2fed},
+{0x04a01e52,0xc596a0a9},{0x02a1688b,0xc54e102e},{0x0121f3b7,0xb886eb30},{0x01c00bb3,0xf73cce77},
+{0x0460063c,0x84e17afb},{0x01c006d4,0x486d6e08},{0x0640fe44,0x838b1baa},{0x022013e8,0xcf08c8b2},
+{0x0241f46c,0x989ed4f4},{0x03602c6e,0xd9a320e9},{0x0361d5cd,0xdd9caf22},{0x02a0a94f,0xdc904a6d},
+{0x03e18c35,0xf69ce113},{0x01e16a8f,0x0f941675},{0x02000c5a,0x34b9b7d8},{0x0301f039,0xd065badd},
+{0x00e1f413,0x5743f50b},{0x01c11481,0x817140df},{0x024112be,0xc039d405},{0x02c04df1,0x98aa9b0a},
+{0x0241b016,0xd203dfd5},{0x0201bc3b,0x5cc28530},{0x02c1333d,0x51b71c2b},{0x02c133ad,0x2dcd35d7},
+{0x0360273d,0x70195c11},{0x0381e122,0xee85ab5b},{0x02c1041d,0x9ac0abbb},{0x04613435,0x0b56466f},
+{0x03216e40,0x68854e8a},{0x03003207,0xcee638d6},{0x024111b5,0x9afb4f77},{0x022010fa,0x4168effd},
+{0x042006a0,0x857cde26},{0x0241035b,0xa4b6646e},{0x0441fa0f,0x5e7e473c},{0x03202acd,0x080373a0},
+{0x01a0a12c,0x83c39be2},{0x02818d03,0xefd15be7},{0x01a1f379,0xa0d0687d},{0x01c1e2f1,0x1582acfc},
+{0x01a00b95,0x593dfbe4},{0x04600763,0xb5168957},{0x02c0ff02,0x7c54db13},{0x042006a5,0x2e81b819},
+{0x02418a92,0x52a18a05},{0x01a0a1f5,0x6a1cfba9},{0x048004f9,0xc71a589d},{0x022115ba,0xe9ff1f28},
+{0x042008b6,0x8d1a352c},{0x02a0329e,0x528d1f39},{0x024188ff,0x901a9e4c},{0x02210f44,0x880798cc},
+{0x0180a3e2,0xa245f70e},{0x06a1d9b8,0x7186a507},{0x0261b0ef,0xa2b8e3af},{0x0181f39b,0xc9347103},
+{0x00a1f4df,0x7ff371ec},{0x03e01e8a,0xd2cb55f1},{0x02000c69,0xd8d62582},{0x04e0296a,0xba7b5d7d},
+{0x01c10191,0xf8b25e65},{0x02210616,0xa11570eb},{0x038027b4,0x0776576f},{0x07401f97,0xf3ba5107},
+{0x01e10763,0x7dff1bfa},{0x02210f37,0x8956d204},{0x02c16f78,0x05614f85},{0x02a01a87,0xcbd30edd},
+{0x01a01be1,0xf6a56e88},{0x02012197,0x6e601418},{0x0260128d,0x52f3e700},{0x0281214a,0xb34d6706},
+{0x0180a000,0x4d47afd6},{0x01c1102b,0x9e7cc7f4},{0x0161e2ad,0x995a9f7c},{0x02016f75,0xab8d35a4},
+{0x0180a12b,0x848f6986},{0x0100227b,0x3358d980},{0x01a0a2ef,0xcd3012c2},{0x02e1456e,0x7543b2de},
+{0x02800e10,0x8a69265c},{0x020013f5,0xe903232a},{0x0480a7a4,0x574845de},{0x0301d4bf,0x43a12b15},
+{0x06200771,0x1e88f9c9},{0x0160a4c6,0x8fa92487},{0x01c16aab,0x84d8e5df},{0x0300239d,0xfa30ea86},
+{0x01c102a6,0x08e1b933},{0x01a0a023,0x7b3a6aaf},{0x03601d60,0xd0cdea8c},{0x03602b57,0x728234d4},
+{0x03e18c5f,0x179897d8},{0x02e13313,0xa4d25905},{0x02201c53,0x665e6e8f},{0x0321d533,0x1aa18d23},
+{0x03a120cf,0x0f80bd0f},{0x03a1d67f,0xc0585980},{0x02c1332c,0x000f8d54},{0x0581d9e2,0x620949f5},
+{0x02e10087,0x9cc7fb7a},{0x01c02088,0x6beedfdd},{0x0301212f,0x2cdc67d1},{0x02c12152,0x49f5976b},
+{0x01e112a5,0x8d55b53b},{0x02418820,0x7f820a57},{0x0381d48f,0xbc200aa9},{0x03e18c8c,0x2c906a22},
+{0x03c107a4,0x2da93dea},{0x024009c2,0x69206be9},{0x01e11328,0x12b58efb},{0x01e02127,0x2ac4a8cb},
+{0x03e0a705,0x285f0590},{0x022019d6,0x9ba0f672},{0x01e00f56,0x2578323b},{0x028e01c2,0x1dd5e46d},
+{0x0340144a,0x56473e84},{0x03401623,0xf1363959},{0x03202157,0x118779f6},{0x0400273e,0x284ed5ae},
+{0x05e00477,0x64138977},{0x028e0073,0x84c23ee3},{0x02a0ab80,0xff360869},{0x02a12f9b,0x5299f448},
+{0x02811d2c,0x398df1a7},{0x01a003d6,0xd91cde14},{0x04a1f78a,0x95069e4c},{0x01400ad0,0x1b816d12},
+{0x0440254e,0xc907b400},{0x01c01023,0x3b1a4173},{0x026e0113,0x25973b4a},{0x03802a22,0xee50bcc0},
+{0x03a0fa75,0x313b7d1b},{0x02401197,0xfac1c859},{0x01e106c5,0xc2b88921},{0x0361d6ad,0x48f15eb0},
+{0x0281f562,0x2bd45011},{0x0181f16c,0xe19ec22b},{0x02610f7e,0x49cbe2be},{0x014031d1,0x5e3974e6},
+{0x0301042d,0xd7f3044c},{0x0161f6be,0x7b2b1700},{0x02c11064,0x67c4cf77},{0x030027a4,0x4b06b55c},
+{0x03e18bc9,0x15ecdbbc},{0x0300ff08,0xde299b57},{0x01c0a030,0xe5d5f920},{0x03c01b20,0x079b199b},
+{0x02601184,0xbb94463a},{0x01c0fe46,0x8d39249f},{0x04601151,0x313f068a},{0x06c1d932,0x3bda7c37},
+{0x0180212f,0x146f3394},{0x02c0aa6a,0x7da634dd},{0x02c130d9,0x10ce0a28},{0x03402eee,0x127941e6},
+{0x02200790,0x40c2f390},{0x03e1cf7e,0xe8c8de54},{0x02002f64,0x3ead3188},{0x024021e1,0xaa5f336b},
+{0x0261b051,0xc0b92ae5},{0x01e1108e,0xf6a9f9b3},{0x01c1172b,0x2e56b84a},{0x04016899,0xc7555f4d},
+{0x02c1314e,0xcbc3b361},{0x00e020c0,0x0665d3fb},{0x02c13160,0x3fbc1b38},{0x026e0134,0x24a405aa},
+{0x03c00372,0xfa9e1cb0},{0x0261b028,0x4a50230f},{0x01401fef,0xf209a436},{0x0421d8f2,0x03ed85f8},
+{0x01c16aa7,0xc0e61046},{0x02200077,0x38577f2d},{0x0201235c,0xc97e0fba},{0x02010b1c,0x03ccd450},
+{0x01e0a58a,0x836c542b},{0x0261b072,0x2a16a01f},{0x01c000ae,0xfa2fb650},{0x020005b5,0xb7e80ca1},
+{0x0181141f,0x501ae417},{0x02001a4a,0xf90cda2e},{0x0341d217,0x7d460220},{0x03601f75,0x6e607303},
+{0x0261b04f,0xc2b92e0b},{0x02604dc5,0x8437828b},{0x04a0fc2f,0xdfad32e4},{0x02c01a5e,0xcd0039b9},
+{0x02611d02,0x62e5adef},{0x0301f05c,0x1482d180},{0x038120d6,0x600f38de},{0x03e12278,0xf2d5af93},
+{0x0520fd9e,0x4bc33a11},{0x04800295,0x9aa0552f},{0x03404ddd,0x51eaf1ab},{0x02e11d35,0xb72283ea},
+{0x0300070d,0xffe5b478},{0x044004ad,0x413a4df9},{0x020030d6,0x0cedb816},{0x01e022d6,0x11ab3086},
+{0x02c13198,0x082ea2ac},{0x0540068f,0xaadb8132},{0x050109f5,0xe192d661},{0x01a0174e,0xd7dbc516},
+{0x0440fc85,0x007a4734},{0x0421201f,0xf45d990c},{0x01202606,0x45a1ded6},{0x02010b15,0x64ce009e},
+{0x02e021dd,0x686f3e38},{0x01e0a508,0xcf7fef62},{0x00a1f9a5,0x34d8f57b},{0x02e00394,0x8335b815},
+{0x03a02051,0x556d226f},{0x03202143,0xea9474f1},{0x05200616,0x516f8693},{0x02a1f4c8,0x84fb5374},
+{0x02603290,0x2bd3b6a8},{0x0301f05f,0x1982d95f},{0x0681d9c1,0xc84a6ad7},{0x04201ddf,0xab329927},
+{0x026019b7,0x9643a4a0},{0x03400f9b,0xddb4cd1a},{0x02e14618,0x64dc3c63},{0x0240a8aa,0x3dff5a3d},
+{0x01c0a22a,0xc07cf8b0},{0x01c003f3,0x8dd34e51},{0x02c1209d,0xcb124d8c},{0x03010126,0x277f76bf},
+{0x01e16ab9,0x9f7777ac},{0x02401a3c,0x1bfecd32},{0x02e02b56,0x7f48415c},{0x024188a9,0xfddb94e9},
+{0x06002901,0x80196f09},{0x02e145cc,0x6befcf20},{0x0380fd41,0xf577e675},{0x04402365,0x4e20e982},
+{0x0221048b,0xd178179c},{0x0180aa28,0xcb79efeb},{0x0620fbf4,0xb396dc1d},{0x02a02479,0x6700ca32},
+{0x05a1d819,0x9ab8f578},{0x0241074c,0x4e82ce6f},{0x032014d9,0x9015303a},{0x01a007c8,0x186539df},
+{0x0261b081,0x6ae08522},{0x01816f08,0xf9990fae},{0x01c0a29a,0xbd7fdc25},{0x02010663,0xcdda6cc5},
+{0x028e01dc,0x97d0944d},{0x02616f13,0x8b2ff7cf},{0x04202cdc,0x1235d98b},{0x03010a90,0x2a6693be},
+{0x02a1f522,0x570e8158},{0x0320148f,0xdd1d4bd7},{0x01e1069b,0xbd3273e9},{0x02601255,0x37138524},
+{0x020030b2,0x48e14a97},{0x02e019e6,0xfb88cd0b},{0x03601620,0x16b47f97},{0x02e0070c,0xcfb6991a},
+{0x0281fa49,0xec1e28ce},{0x00c1fad4,0xf69d57c3},{0x0201112e,0xfcf0ada9},{0x03801635,0x515291bd},
+{0x0420063b,0xcb4f262d},{0x00e1f45c,0x12422ee6},{0x02e008ac,0xf152090e},{0x04c0ab38,0x44f37602},
+{0x01c02ed7,0xe9efa23f},{0x030007ec,0x31b7189b},{0x02a04dcb,0xa8420c83},{0x03e1d600,0x8805e3a8},
+{0x0280a4fa,0x686ae012},{0x0300090c,0x334bc5b8},{0x03610141,0xd7256ec5},{0x030000aa,0xbd5a7b50},
+{0x0520fd23,0xc4ee4247},{0x036015e7,0x14a43bf3},{0x04801cec,0xbfed0be7},{0x02c1336e,0x96c34dc6},
+{0x0161f9ff,0x070e4dc3},{0x02811d85,0x6a7c78ed},{0x0180a1e4,0x3e61301f},{0x01a0a3ff,0x6288700f},
+{0x01c11280,0x0ffc834e},{0x01e10501,0x499c982c},{0x0240ab50,0xd9b8aeca},{0x04e023be,0xf314c4fd},
+{0x01a0a2c0,0xba5e80df},{0x03c000e5,0xa706388a},{0x0101f4b0,0x7172883f},{0x03a1098b,0x47ccf625},
+{0x0481cfbe,0x462e53db},{0x02c13355,0xd9beae08},{0x02812fdb,0xa70fc64a},{0x02401a71,0xf3751bdb},
+{0x048120f3,0xc9f3dc3c},{0x02c00a8b,0x423d27e7},{0x05c0fcf9,0x0a4f7d26},{0x0281e904,0x26c9b11b},
+{0x02a02ad6,0xd77e26ec},{0x01a0a353,0xd854cf1c},{0x02c1337f,0x2ec06b77},{0x0280ab71,0xc1ef03bb},
+{0x04602324,0x5ed61c67},{0x02a00e18,0x0a1b8e67},{0x02a1f7b7,0x011acbe2},{0x01e00c95,0x351b80e3},
+{0x01e0a25d,0x3ee804ee},{0x036018cb,0xfae8cb9f},{0x02c02d1e,0xfdf88235},{0x01c01946,0x90cc1ed7},
+{0x04001155,0x593fee22},{0x06801fb7,0xe9f547d2},{0x01a0a005,0x6bb4e0b3},{0x04e01ec1,0x3eeccab7},
+{0x0501cf67,0x4169be77},{0x02801da0,0x5a8c66f3},{0x02202491,0xcf7b5e92},{0x03e00da3,0x9cf41be0},
+{0x034015aa,0xf49c8760},{0x02011a6e,0x726c9e34},{0x02c1fa4a,0xa79b5902},{0x0540fd66,0x0b9ce87a},
+{0x0520253d,0x3141019c},{0x0381e8a2,0x10862497},{0x03412413,0x406d1a53},{0x0401d0ea,0xde13009a},
+{0x0201159c,0xb4e77210},{0x02000332,0x34f25c43},{0x02e124d2,0x0b59264f},{0x03a03248,0x224bc2dc},
+{0x04801fb6,0x1d5b364f},{0x0340012d,0xbb39eac3},{0x04e01f6c,0xcdc07bbd},{0x02211cb1,0x1ef52ee4},
+{0x01e0222f,0xa5e3f530},{0x01e16f5e,0x10af1d02},{0x0401f721,0x4860aa2c},{0x02c131c9,0x55faa487},
+{0x0361e85f,0xb465cd09},{0x00e1f3ba,0xc7c49ee6},{0x02c019ef,0x131b93a8},{0x024031ae,0xc7a8a9e2},
+{0x01602303,0xea674277},{0x02c10044,0x082b4979},{0x02e14577,0x71416dfb},{0x02000ca7,0x947c7e3a},
+{0x028110d4,0x98f99f48},{0x0100223f,0xa8d4dab9},{0x03a0060a,0xf61ec1b7},{0x01811715,0x03e63348},
+{0x03a1d013,0xd78e088e},{0x01e16f68,0x07a6147b},{0x01a0a207,0x9b5149ff},{0x0461d614,0xcca2cb80},
+{0x02810fc3,0x50b54ad2},{0x0361d68c,0x2d06d30c},{0x0521226c,0x39a294aa},{0x01602e32,0x70f4065a},
+{0x02a1f6b1,0x403e0faa},{0x02402a0d,0x54639813},{0x02c13207,0x6f775380},{0x0161f6fb,0xcdf67fa8},
+{0x01c1f7a1,0xfdab7406},{0x0300029c,0xf2b8a7e0},{0x0260219d,0x599b912a},{0x01a0a0bd,0x20af0349},
+{0x02c10fb4,0x9feae952},{0x0341da12,0x645facd8},{0x03c1f1f6,0x9e2429ec},{0x03210c42,0x3fe5587c},
+{0x03216e5c,0x6b855343},{0x02c019f9,0x7cc6a99e},{0x020003de,0x8c6a1ab8},{0x03411a92,0xce33f9ff},
+{0x02a00e4d,0xcaa0aa48},{0x03c1d7fb,0xea388d85},{0x02600d3f,0xedef40c7},{0x02011321,0x771eaf25},
+{0x03010a89,0x169ff884},{0x0580fcff,0x1afbd442},{0x04002c7f,0x38dcf44d},{0x02c132ef,0x584343ce},
+{0x03016910,0x1fdd9d47},{0x0241f310,0x76d79092},{0x01e1f3e1,0x93cc0186},{0x03a124de,0xdd12d986},
+{0x03011c3c,0x9578655a},{0x03610784,0x785a2dcd},{0x02c02176,0x6b6e527a},{0x0561d830,0x7bbb34c5},
+{0x0260abc5,0x2a192d98},{0x03a0147d,0xf2edcacc},{0x04401fc6,0x9df503e3},{0x020013f1,0xf434d147},
+{0x028006cc,0x8d5c8e38},{0x02c1307a,0x3f23733a},{0x01e01c0f,0xba4f679b},{0x01e16aec,0xe260ed33},
+{0x0400a714,0xe92e3c2f},{0x02c1040e,0x8ce327f3},{0x024188a2,0xfad95199},{0x03a0233c,0x396352ba},
+{0x02010369,0x8434323d},{0x0141f68e,0xe2f7c338},{0x0221d343,0x17735fef},{0x01c1161b,0x0d2d874d},
+{0x02c13019,0xf7225819},{0x01a0a12f,0xc7d17e78},{0x03800163,0x58e566e2},{0x02412110,0xd0f4e25c},
+{0x03410a55,0x35531ec7},{0x028e0079,0x8ec24ea1},{0x02811d05,0x297394fa},{0x026014f4,0x1cb7f2c4},
+{0x028012ff,0x04edb55c},{0x02e1f019,0x496bbf9b},{0x03a1d5ac,0x597bbae4},{0x03e18c8a,0x2a9066fc},
+{0x02c13066,0x0d9e10bf},{0x03e18b27,0x9ad54b07},{0x01a00b1a,0x9bb10755},{0x0221048e,0x6c0da8ba},
+{0x0360162e,0x045e713b},{0x0561d793,0x9323ec3a},{0x0260a838,0x645fe537},{0x018016a4,0x71251791},
+{0x01c0a61b,0x35e067c0},{0x030010b0,0x1b641737},{0x02200f27,0x73ef9c8c},{0x0221064d,0xafa6a677},
+{0x02418816,0x67842326},{0x02c02c7d,0x9ce7d512},{0x02012038,0x92bdc934},{0x04001f40,0xf0822314},
+{0x02e1f7b2,0xc38a27f8},{0x02e01bdf,0x37c1ed5a},{0x02a1ec73,0xfe859496},{0x03014576,0xe1fd47b1},
+{0x03a0fac1,0x9c6b2693},{0x04e1d060,0xde9cc910},{0x02a1684e,0xcc785d8b},{0x03a02ae9,0x2f88a26d},
+{0x02c1236c,0x404a73f5},{0x03a00121,0x7df0e4c5},{0x03003205,0xecb18433},{0x03a1d07d,0x097c51b9},
+{0x0320a74d,0x88d50e47},{0x024106af,0x05cd30ad},{0x01c0a924,0xe23d7a75},{0x0421bc70,0x6ef175fe},
+{0x02002327,0xa080913d},{0x0261b07f,0x64e07bb0},{0x0441df1b,0x818fc2e3},{0x02e118d7,0x5487ef2e},
+{0x03a0fa9a,0xe94a164d},{0x0161140a,0x76e2506f},{0x02801bf0,0xf4bfedff},{0x05c0fcfd,0x66f29e7a},
+{0x0201bc43,0x33e059b9},{0x02002fb7,0x56a1cb79},{0x01816f43,0xd07cf8a6},{0x02e132e1,0xef927c06},
+{0x03e18c9f,0x078df14c},{0x0321e828,0x873d3305},{0x01e10ff0,0xbe1430de},{0x03c1d8ca,0x1e3f7495},
+{0x01202053,0x58abb435},{0x00c1f3eb,0x7d4112c9},{0x0561d831,0x8d394cd5},{0x02c10fbf,0x5ddac427},
+{0x0380150e,0xfd0ff3cb},{0x01e1066c,0x4628be38},{0x02a0aa72,0xd68545eb},{0x02e130ca,0x35776d0d},
+{0x02418a95,0x519f49db},{0x01e0334a,0x1af94abe},{0x02600de7,0x11aa5da9},{0x03a01ce9,0x7331cff6},
+{0x0660069c,0x3924a789},{0x0261e2ac,0x749923fc},{0x036002a4,0x2aa1c522},{0x02c02d12,0xec5607fd},
+{0x0260135a,0x8415ed98},{0x02802e3c,0xc9d561f7},{0x04610f59,0xc82b3738},{0x03010a80,0x5af07560},
+{0x0281b020,0xa005c30a},{0x03c11a3f,0x9d544bc1},{0x01e02671,0x0a4cb587},{0x038024ef,0x7e89569c},
+{0x0420fc91,0xd803ed35},{0x03a1d674,0xd5587a8f},{0x03c1d6e4,0x8079628c},{0x0261b04b,0xc6b93457},
+{0x02c0abd1,0x878a4f75},{0x02a02815,0x3c13921f},{0x03012119,0xf54d92e1},{0x0501f895,0xb4d82a05},
+{0x02a104d1,0xd1148334},{0x03c00145,0xa6f562ff},{0x02011055,0x61259baf},{0x01a00b6c,0xd1b7d182},
+{0x0460fcef,0x90934d85},{0x0321d6b7,0xd831d415},{0x02c12021,0x9e41b96c},{0x034015a8,0xfa9c90d2},
+{0x0240a62b,0xb0d0fff0},{0x02e14498,0x9d0a936b},{0x0501cf78,0x58561bce},{0x02418907,0xa4187f31},
+{0x02812f9f,0xa2f9f9af},{0x02e11fe5,0x4d208fda},{0x046004f5,0x85c5d414},{0x02e0a691,0x95c44752},
+{0x0381d10e,0x089a8f93},{0x02e0240d,0x6fee84bc},{0x0321d159,0xb7120e7a},{0x03012354,0x2ccd5b9c},
+{0x02402d39,0x0ca54b17},{0x036000be,0xf58ecf95},{0x01c1f44e,0xe33d969d},{0x01c0a3eb,0xf13e9015},
+{0x0301248b,0xb91e7cd1},{0x02e04dda,0xa99c8382},{0x01416a46,0x640919e2},{0x01e115aa,0xdd68f544},
+{0x0121f629,0xdf9e9c1c},{0x02600e36,0x0694a401},{0x03602c01,0x8cbd06cd},{0x02c10e7c,0x2041e4a8},
+{0x02c13184,0xb232de7b},{0x03801e29,0x48a936e6},{0x02ce0053,0x803c83fa},{0x0301da35,0x1e879ac0},
+{0x01a0a496,0x3198af7e},{0x02c133c9,0x840f1023},{0x02200d2f,0x0a515872},{0x01e01bee,0x01005877},
+{0x0480fcb4,0x4e069f6c},{0x02e13135,0x263c493d},{0x0141f3aa,0x7ff45363},{0x0341015c,0xe38c74cd},
+{0x02816a17,0xf44be722},{0x022120f7,0x947757b0},{0x040109d6,0x68c2ebff},{0x03a12526,0xfe748435},
+{0x03202af3,0xbdb8f0c8},{0x010033d3,0xacacffd2},{0x0381d49b,0xb01ff7c5},{0x02a028d0,0xf2a4f850},
+{0x02601a35,0x873043ea},{0x02a110f7,0xc3cc7521},{0x03e1da5b,0x31e9aec9},{0x01e0262a,0xd7a3d41d},
+{0x02401231,0x0523825c},{0x01ce002d,0x6e175c89},{0x0280aae4,0xc71167a4},{0x03601dfe,0xb9ebc494},
+{0x03e1d5ef,0x7905cc0b},{0x030017a9,0xd01a58b6},{0x054020ed,0xa7b98c4e},{0x056021b9,0x4bf81950},
+{0x03a1d046,0x467aef40},{0x01811732,0x8afa99a5},{0x01c0a137,0xf8582faa},{0x0441d7e0,0x9cbefe60},
+{0x01a0a609,0xfb1dcd3a},{0x026100d7,0x94988fe8},{0x02e144d1,0x2123681d},{0x02c02925,0x13d79fbf},
+{0x01a0a2a8,0x9b793fee},{0x03003168,0x55052814},{0x0381d4ef,0xcecfa3ea},{0x0361240b,0xe0a28743},
+{0x0421d22f,0xd27a3d64},{0x02a0abcc,0x7b7172d4},{0x02412127,0x07f5f331},{0x0161f7ab,0xe1f283b4},
+{0x03002f34,0x55e20595},{0x02602f98,0x3812dcb2},{0x03a0fac3,0x9e6b29b9},{0x03e18b9a,0xd0be46ba},
+{0x01a0a47b,0x0ef88fe2},{0x02e16f9c,0xf0230a1b},{0x02c1ec9f,0xb5504d19},{0x03a003af,0x0745cec4},
+{0x05e1d0a5,0xe5050ae7},{0x01e0a451,0x8edde1d4},{0x02c02394,0x5c9856ec},{0x03811039,0x8a567ed0},
+{0x01e1131a,0x1ead531a},{0x0321f76d,0xa30d9191},{0x00a1f405,0x7cd0a158},{0x02c132af,0xf89ddd84},
+{0x02611c19,0xc951fd61},{0x0261b0d9,0xeabd1164},{0x03e18b0d,0xd7cf9ae0},{0x03000825,0x19735106},
+{0x04e10af2,0xe1527a56},{0x03a02c08,0x694f8d65},{0x03a0025a,0xe6b3dc99},{0x0481cf44,0xc8e93233},
+{0x02a030f6,0x8f11b90e},{0x0220182b,0x5c169c70},{0x03000298,0xd2d85e79},{0x04e029bc,0x8df505ce},
+{0x01c11219,0xbf06e758},{0x00a1f456,0x65e08a04},{0x02000f25,0x84d2ec2b},{0x02016f90,0xea3ca16c},
+{0x03a1f507,0x5c886535},{0x02601091,0x66325c0f},{0x03c00228,0xf335edfc},{0x034101d1,0x5cce2943},
+{0x02a0a8b9,0x0364328f},{0x02c130ec,0x12d28a7c},{0x02c0aaee,0xc32ff6f9},{0x02c13343,0xd1ba2442},
+{0x02002163,0x28b46514},{0x02e1041b,0x4e5b1396},{0x0320fe9a,0x8f88f0fe},{0x02e14625,0x6dde8925},
+{0x02c1d41c,0xd697e13e},{0x04e1cf12,0xf0740d2c},{0x03c000ff,0x1607e490},{0x02410879,0xd41a841f},
+{0x03200225,0x5b1632ed},{0x01a0a060,0x6106665e},{0x02c01d37,0xb1e7f621},{0x02801459,0x088013ec},
+{0x0340fb7b,0x6be05ca9},{0x03c0015e,0x7f70577e},{0x0360fb5d,0x7f915fab},{0x02816a0b,0x10aff1ce},
+{0x02e10baa,0x26d25180},{0x0381d6ff,0xc8aaca26},{0x03002e03,0x50b4892c},{0x02001018,0x9d825799},
+{0x0140270a,0x68d07517},{0x02616b51,0x7f8d8d6a},{0x04201c9f,0x3c5ff9c8},{0x0440237c,0x4bb7fe14},
+{0x02e131e2,0x356e66ec},{0x02401935,0x4301e634},{0x03402e51,0x9c4cd5c3},{0x03a006f8,0x0d822e11},
+{0x02400928,0xcca4a332},{0x02c133f1,0x1c785379},{0x02c00b62,0xd3921194},{0x0421eea8,0x2cb213f9},
+{0x02a01851,0xfa1c93e4},{0x02400afb,0x3a43c43e},{0x01600ea1,0x1d5f8bd3},{0x02000ae7,0x8eb950c1},
+{0x038011fd,0x55a434a9},{0x03602c20,0x085bd083},{0x03600dc3,0xd89737b7},{0x02a1143a,0xcc1ea611},
+{0x02a04de1,0x5e898ca3},{0x0261b0f2,0xb1cc8304},{0x02c0281d,0xb8ccd33b},{0x02c10fca,0x38cd20a6},
+{0x042006c2,0x166ad5d5},{0x0261b07c,0xbb2f8948},{0x028e0153,0x816f5eae},{0x0260032c,0x62f34391},
+{0x03211c9b,0xafd0deb5},{0x02410341,0x198fa6b0},{0x01e112a1,0x2947a045},{0x02c133b8,0x9813accd},
+{0x03a1e87c,0xaf7c663c},{0x01c0260f,0x81032a5e},{0x02a00482,0x3ae46d1a},{0x01a0334c,0xf7644ca5},
+{0x02e122f2,0xbfbe9858},{0x0261f642,0xd44f4179},{0x02a019a1,0xb53eefda},{0x04a01cd6,0x87ebbf82},
+{0x042008b3,0x8590cb56},{0x020023b4,0x8e2cfde5},{0x02a105a7,0x94172128},{0x02602ddd,0x34a9254b},
+{0x01e0a070,0x7e5fd3c0},{0x01e1f547,0x312e0452},{0x0321d6e0,0x77032499},{0x02400599,0x5a619de7},
+{0x02a119e0,0x5f818676},{0x02411922,0x9baa9ebf},{0x02a1e91b,0x98931af7},{0x0100222b,0xa963d4cd},
+{0x01e11ee0,0x66c0fdaf},{0x038000c3,0x2f04da0c},{0x0201074d,0x8c4befb0},{0x024189b7,0x1dc15a49},
+{0x0321237a,0x3d049d1a},{0x03010098,0x58e247e6},{0x0261d34f,0x0202e1a4},{0x026016d6,0x89a800a9},
+{0x0541d7c5,0x8ad539ac},{0x01602e34,0x5dfd4918},{0x03a0a7f9,0x8495f74a},{0x01e017d8,0x5de739b9},
+{0x0341e84b,0x1f0d5179},{0x02601297,0x48a9ce3a},{0x03013240,0xaa6ac9d4},{0x03001ce5,0x8e3fb36a},
+{0x02e145c2,0xee289adc},{0x01e0a438,0x0004867f},{0x024008d6,0x6febf23c},{0x020013ec,0xf21b363b},
+{0x0401f11b,0x2e302441},{0x0321d51f,0x0ea17a3f},{0x03412412,0x603b404d},{0x0301f058,0x981a3f8a},
+{0x0520fc6e,0xa62b7259},{0x02202d54,0x070a7c9f},{0x0360165b,0x28b5a490},{0x01e0a422,0x86974bbd},
+{0x024112c4,0x0912e826},{0x040006e1,0x42e85bd3},{0x02a00458,0x05eb15fa},{0x02418abc,0xda16f93f},
+{0x01c0a26b,0xbbefdfdd},{0x03c1f5a1,0x2897291d},{0x04e109f2,0x66d53f5f},{0x02602b59,0x03a7e3f2},
+{0x01c0a3bb,0x5f3b9c95},{0x02201b54,0x8a79ef57},{0x02a10e7e,0x43dcdbd8},{0x03a1da06,0x84b5b0ff},
+{0x0341f751,0xc3812e65},{0x02212153,0x59a38781},{0x0261e932,0xaabc8806},{0x0521d953,0xdfeb4cfc},
+{0x0520fd21,0x850da04e},{0x03603243,0xde1dabe3},{0x02c00446,0x36c0e725},{0x03e0319a,0x0bfeae04},
+{0x02a03278,0x91d7860c},{0x01c1e2c9,0x875b0cca},{0x02e145ff,0xeafbd000},{0x0381d500,0xdfcfbead},
+{0x03a0151e,0x82de13e5},{0x0301f037,0xa93ae1a3},{0x02611409,0x6fac6621},{0x02a02813,0xc016a082},
+{0x0740fc03,0x6bf19be7},{0x03202753,0x97534f89},{0x022026a2,0x5588413d},{0x00c1f34c,0xd6cff7d0},
+{0x0261b0d3,0xe5fdb0db},{0x03802df3,0xa2a188f3},{0x02e120dd,0x84db0eb3},{0x03001d4b,0x23a3c0ea},
+{0x03e1d0e9,0x0b873717},{0x0421d5dd,0x4e36c942},{0x03600821,0xafbf577a},{0x03c1d564,0xf52571fc},
+{0x01e0aa31,0x19b99a7a},{0x01e1066e,0x4828c15e},{0x03a1d894,0x81abfec8},{0x0400ff9e,0x34cf449e},
+{0x0280ab09,0xc0c87977},{0x0301d401,0xc64d1308},{0x01c02ed8,0x5a050009},{0x0161019c,0xc5cc063c},
+{0x0280109e,0x6fa87d20},{0x02616b03,0xe6920e20},{0x0441f15e,0xe04f49b1},{0x03800587,0xe67dd73b},
+{0x028e0154,0x826f6041},{0x04201edb,0xe2c06da3},{0x0300237a,0x2e72af9f},{0x020103aa,0x8ecee77a},
+{0x01c0a1e6,0xf68f49d0},{0x030016df,0x8e0e3aea},{0x05a1f240,0x18812b40},{0x02e11a19,0xebee4405},
+{0x01e10b2e,0xd93da436},{0x01e1e957,0x4025d2a4},{0x02e118c6,0x989e2089},{0x01e10704,0xf5674c96},
+{0x01e01a1e,0x9eb3c8ad},{0x02c0281b,0x16a13860},{0x04a1f70e,0x5738901a},{0x034100aa,0xa6a32679},
+{0x0220116a,0x8bc3097c},{0x02611921,0xa4f70595},{0x03816e44,0xdbd6ef68},{0x03211cac,0x734f5b18},
+{0x0121f52d,0x864689b3},{0x02e10c16,0x3d570043},{0x022010e2,0xdb07169e},{0x0200176e,0x20bebd33},
+{0x01a02224,0x1a92d57c},{0x01a02692,0xcba4c189},{0x01a0a035,0x281bd2f2},{0x02c132e8,0xd34ac134},
+{0x01a0a153,0xa165e778},{0x03810c95,0x711c23b3},{0x05c01f6f,0x0d356510},{0x02616a91,0xe9b12e2b},
+{0x0241d336,0x7ef514b1},{0x02616853,0x805fb570},{0x03000535,0x0bc361ba},{0x0460046c,0xf806486e},
+{0x01a1f107,0x27d0ab35},{0x028e0067,0x78c22bff},{0x02a02ca5,0x298d75d0},{0x02601377,0xa0f43640},
+{0x02200063,0x24575fb1},{0x02a11d0f,0x42d40cfe},{0x02401271,0x0525c0f3},{0x03611ab4,0x672938f3},
+{0x026124ef,0xce95c060},{0x01e10714,0xf965144b},{0x0421f866,0xac36ae49},{0x04001c93,0xb68a235e},
+{0x0480fccc,0x722451e4},{0x0421d71d,0x20a5f854},{0x02a169a1,0x8c083bee},{0x03c024ad,0x12014b3a},
+{0x026103d3,0x39f2c05e},{0x02c132da,0x4e47b13e},{0x02e120a2,0x097c5f71},{0x03601508,0x3eea13ac},
+{0x01e16f7a,0x0baf1523},{0x02200b82,0x1f148486},{0x0320fb95,0x1d986adf},{0x0380081e,0xe53651e1},
+{0x03212200,0xf113fda5},{0x0281f662,0xe100fb12},{0x02e028e3,0x9daa5590},{0x01e108fb,0x1221781e},
+{0x02a10ac0,0xb7407f4c},{0x0621d966,0x0ae10640},{0x02e03254,0xea0e213f},{0x0261bc55,0x9051e1e6},
+{0x0360163b,0x22e07c25},{0x0140270b,0x81dd2120},{0x02600e49,0x597ffdac},{0x02a01bd6,0x9c63aceb},
+{0x0340febf,0x78647978},{0x04201067,0x5026817f},{0x02c131dd,0x3efefd80},{0x02a00705,0x94fbea13},
+{0x01e0a5ce,0x50fc8aea},{0x02a0a60c,0xe5757ebf},{0x0340fed3,0x1e0c7d22},{0x0541d92f,0xc325f7ea},
+{0x03202d8a,0x823bca11},{0x02c1d422,0xcc97d180},{0x01c02196,0x54144428},{0x050023b0,0x44c7b938},
+{0x03a0ff6b,0xaf6cc6c2},{0x02c11301,0x3a0946aa},{0x02c1300f,0x8d1f72a4},{0x0180aa23,0x0742a165},
+{0x01e106c4,0xc1b8878e},{0x0201017b,0xf67abd94},{0x03c0167c,0x3ee9645d},{0x036006a7,0xe834cd4b},
+{0x02e1b121,0x2817d74c},{0x0440fbbd,0x61364345},{0x0261b029,0x4950217c},{0x02a023d3,0x67da2572},
+{0x02210e88,0x38d40ff4},{0x050023c3,0x22e86915},{0x02602af6,0x92905f1c},{0x01c0a860,0x7a59a584},
+{0x02416a11,0x2571c9a5},{0x04400203,0x709fa448},{0x01e016e3,0x11d996e7},{0x00a1fad8,0xbeb0ea5c},
+{0x02400325,0x5b3892e8},{0x00e1f6c3,0x886ce287},{0x00a1f480,0xfba6fb8a},{0x02e144c7,0x06fe6e56},
+{0x020030e9,0x20c53522},{0x02c11d58,0x75eff084},{0x020017ca,0x647d6d39},{0x024189dc,0x1ec39a73},
+{0x01c01790,0x9162e5f1},{0x03a1d59c,0xf89197cd},{0x00e00bd0,0xe6996a3c},{0x0341681c,0xabf3be34},
+{0x0261b107,0x1dd1aa36},{0x03e1d585,0x6ff50c8f},{0x02401209,0x14eb42fb},{0x022005ef,0xea093c8e},
+{0x00c002db,0xfb992086},{0x024112c1,0x43629bd9},{0x0240121d,0x28eda10e},{0x03203225,0xf21cba50},
+{0x01c0a243,0x6f49cb9a},{0x03610c93,0xa2c00181},{0x0321228d,0x684ac9fa},{0x02c1306c,0x089e08e0},
+{0x02ce0048,0x673c5c9f},{0x028168dd,0xc8348f91},{0x01c00b3c,0x1369da89},{0x0381f762,0xfba5d0c6},
+{0x01c1e2f2,0x4e3722c2},{0x03c1d00c,0xf799307f},{0x01c0a118,0x7e363572},{0x02801402,0x57976d31},
+{0x0460291f,0xf788e3b5},{0x020032d0,0x2da99120},{0x0361d1ab,0x797d1174},{0x02201174,0xcfc7f1b6},
+{0x016031c7,0xd4ac5111},{0x01e1f7f0,0xd9873a40},{0x02e1452d,0xf8ac4fd9},{0x02203134,0x11fa1a8f},
+{0x03a1d58d,0xd9916700},{0x020114ad,0x9fce5129},{0x040124a0,0x3dd4a544},{0x03c00da0,0x5e0b9c3f},
+{0x02000a68,0x0a99b50e},{0x02000f5b,0xafac1103},{0x03202de8,0xfe9def3e},{0x03e18b02,0x0dcfefe2},
+{0x028187f2,0xe489cf93},{0x03210c40,0x853872b0},{0x03603222,0xed96c1c0},{0x01e0a143,0x4202c1bd},
+{0x03e18b82,0x1dbc815a},{0x0380147f,0x0e27f6a5},{0x03a11aba,0x79ad66ae},{0x03c1d561,0xf82576b5},
+{0x03e18bb6,0x1aeaa504},{0x03411a8f,0xd4340371},{0x028e0159,0x836f61d4},{0x022103c2,0xc8d35594},
+{0x0261688c,0x29343378},{0x02011c7b,0x5761b456},{0x028e0173,0x796d137f},{0x0381d1b3,0x46f4f155},
+{0x02e145e7,0xe9f7513f},{0x0201bc48,0x53d1818f},{0x0261ec7a,0x15869ef5},{0x01c02194,0xfa0eb49f},
+{0x02c132a1,0xd85d0976},{0x04a1205c,0x750448dd},{0x026e012a,0x1ca637a9},{0x04400204,0x6dd268a8},
+{0x0300a96d,0x91a4d09a},{0x03412258,0x4ed211d7},{0x01c0a068,0x0703fbf4},{0x01c02796,0x02622959},
+{0x0400fef0,0xdb4cc373},{0x02402f53,0x4b5ed7bf},{0x01a0a5cb,0x30e80842},{0x03a0fad9,0xac7c88e4},
+{0x0320ff66,0x16b3b2f8},{0x01c0a941,0xe15567e1},{0x02601a38,0xde4fc82c},{0x0301d4bb,0x47a13161},
+{0x03c10149,0x15cebcd6},{0x0260225d,0x83bd250e},{0x01c10b0a,0x27d8c68a},{0x02c00392,0xd93dab93},
+{0x03a1da42,0x70269b65},{0x03001d05,0xfeb8bac4},{0x02c0ab99,0xeda302cb},{0x02c00703,0x77862a6f},
+{0x0220136d,0x444f725d},{0x02e1bc56,0x26978b11},{0x02a022e0,0x2997985c},{0x03a02cf3,0xb3d1f45c},
+{0x0360ff63,0x7039b22d},{0x0361055f,0x305d1e39},{0x022110c1,0x9641194e},{0x0380109f,0x9a32aae5},
+{0x0121f19a,0xee75af79},{0x0340ff47,0x0ee0e9da},{0x0300035a,0x61f5ac57},{0x03e01c81,0x3dad0236},
+{0x02c00f82,0x6844c069},{0x02e1310c,0xb65e54b2},{0x03e121d9,0x5937343e},{0x0381f446,0xdf9639bd},
+{0x050115d3,0x276dc67e},{0x02c1d31b,0x2326f90a},{0x0500278d,0x3b57ae80},{0x02a02891,0x4322a7ae},
+{0x022016a8,0x26644134},{0x01e1228f,0x5be56329},{0x0620fda0,0x73af8800},{0x01a0a2a3,0x8f7032ae},
+{0x024189eb,0xa1dc6d92},{0x0320157b,0xbb8b9366},{0x02a11080,0x02141c05},{0x034118ad,0xb74c16e2},
+{0x01e10455,0x51f18fe5},{0x02c132d0,0x7498908a},{0x01800bf3,0xc063edb3},{0x0300fbb4,0x44734a32},
+{0x0341d4b3,0xd07c988a},{0x02e01d09,0x7679985d},{0x0360164c,0x72abc309},{0x0280326a,0xb8695905},
+{0x030029ec,0xddfb5faf},{0x01c0a391,0x8f800132},{0x0420fe32,0x34cdd393},{0x0121f693,0x0a162a9b},
+{0x03601134,0x63cdad58},{0x0460295e,0xc72d4620},{0x01a10920,0x9cbf6439},{0x0280145d,0x068010c6},
+{0x0261b074,0x2c16a345},{0x030101fa,0x7f3d6f90},{0x02601375,0x74461093},{0x02202f27,0xf0668853},
+{0x02212395,0xb6338cbf},{0x02802e8a,0x9ebcb790},{0x0261f553,0x1a78e7fd},{0x03801e3e,0x97c496ca},
+{0x022112c0,0xec560e4d},{0x01c110aa,0xc8631f04},{0x03e18b2a,0xa8d56111},{0x02001c60,0xbd4a69e3},
+{0x02c118c8,0x8cde03d6},{0x032014a9,0xdcecef05},{0x02c1f675,0xaf2b572c},{0x02610ae4,0x9eca8bac},
+{0x02e12383,0x70e12360},{0x04a1d715,0xbd337483},{0x00c1f9c8,0xe06f495f},{0x04202742,0x3c03639a},
+{0x01c01720,0x6d0bd394},{0x01a0a1ff,0x932eab25},{0x01c0a5fc,0x7be1b12b},{0x03401551,0x584741aa},
+{0x042000c2,0x5cb58eb8},{0x02c131a8,0x575859c2},{0x03a00dc5,0x29ae7bee},{0x030100a7,0xe188b1cd},
+{0x02e0a9f6,0x8f741d10},{0x02418850,0xe96b57e6},{0x03600187,0x3f6cac5f},{0x02c028e8,0xea96f1c9},
+{0x0401f11a,0x2f3025d4},{0x02010f52,0x581ce06c},{0x02401d6b,0xcdb89be6},{0x01e11218,0x9a912fba},
+{0x024189f6,0x3633dc2f},{0x040022fa,0x711875ce},{0x01c0a3a4,0x4088ab1c},{0x0260a8a9,0x83266e8c},
+{0x0301d364,0x02978df4},{0x026005e3,0x5369321d},{0x02601264,0xc59a9e4c},{0x03810997,0x51f9aba2},
+{0x02200728,0x82432033},{0x03802c10,0x8dd732f9},{0x03e10145,0x3db991dc},{0x03001d16,0x24d403db},
+{0x02e14410,0xb07acedb},{0x0141faa5,0x0af28f23},{0x032114b6,0xf474ef75},{0x02c16845,0x63319cb2},
+{0x0201f5b9,0x08e0dc0b},{0x02011c0a,0x13d789c9},{0x02e1691f,0x645270f8},{0x0121f33b,0x55efa65a},
+{0x02c0ffdc,0x5775ca98},{0x0521cf76,0xa7cf3898},{0x02c1699d,0x5936b63b},{0x036124b6,0x967b5292},
+{0x01c03307,0xfba956c5},{0x02c1320d,0x7a7764d1},{0x03c011d4,0x87285091},{0x02003072,0x941d857d},
+{0x00e1f4cc,0xb73b2f7c},{0x02e1456c,0x7343afb8},{0x02411c12,0xc8d52434},{0x01e007ab,0xc41cbb5e},
+{0x03e0294f,0xecef68e9},{0x02418836,0xe9872e63},{0x01a1f5ad,0xcc711b56},{0x02a01853,0xe5f9e226},
+{0x02c01854,0x5eabbad1},{0x04c0075a,0xb448e8ad},{0x01c01913,0xaf47c6e5},{0x01c1168e,0xab056b9c},
+{0x0481d034,0x70af5bae},{0x02403026,0xe9899ed5},{0x02e144f8,0xf9aa12d5},{0x02001a00,0x4b07be05},
+{0x01203003,0xc5c011c6},{0x02410a12,0x4a14265c},{0x02a12115,0x1d0d36ad},{0x020110bd,0x50093853},
+{0x02000cad,0x1b144a78},{0x028e0167,0x756ace9c},{0x0180a4b0,0x61bf3183},{0x01e1120c,0xfbd594fb},
+{0x014031cf,0x7b39a28d},{0x02e1450b,0x84a4dd78},{0x03011041,0xdc21241f},{0x06601f95,0x0f580d95},
+{0x04a02a97,0x52b50a83},{0x02c13341,0xcbba1ad0},{0x06002ba0,0x2f199195},{0x04a1f66b,0x7265c08b},
+{0x0261fbf7,0xfb6d7b85},{0x0520037d,0xcedb5ea8},{0x03e18c10,0x85a23f5e},{0x030168ae,0x63c34c3e},
+{0x032010bf,0x6a69c410},{0x0281f004,0x279b4e47},{0x02c1309c,0x3f25b1d1},{0x0460fbab,0xb29f840a},
+{0x03601625,0xb86ac58a},{0x02e16824,0x93d51c86},{0x03a0fa7c,0x073b3afd},{0x01a0a5df,0xf11dbd7c},
+{0x04a1d8f8,0x12a49967},{0x01c11821,0xa4f10351},{0x03802ac8,0x07ac5304},{0x02a003b4,0x15466e78},
+{0x0401f113,0x263017a9},{0x01e106d3,0xb1bceb8c},{0x02a169e6,0x167d3c8e},{0x00e1f33c,0xef7e3326},
+{0x0321d203,0x5b73c62e},{0x01a10933,0xaabf7a43},{0x0341e844,0xf16de861},{0x04002379,0xd0e96df3},
+{0x01a0a54c,0xdb2ca564},{0x02601715,0xcfde5987},{0x01402591,0x2ea6c07c},{0x01a116a0,0x1e0c142f},
+{0x03c1d048,0x670477b5},{0x01a02121,0x6f131c72},{0x03801445,0x65cfb5b8},{0x02e0a9f1,0x5742024c},
+{0x01e00c33,0x605cac20},{0x05001eb2,0xf9afc51f},{0x01c03356,0xd75e3bc8},{0x02800d4b,0x579e7daa},
+{0x010033a9,0x8dcae419},{0x01c11088,0x88245185},{0x02600d4d,0x19e1db23},{0x02a030f5,0x9311bf5a},
+{0x01800950,0xa23f3b6f},{0x04c1d7b7,0xb2671fb0},{0x04401e4d,0xd777a5b2},{0x0360fe9b,0x77123e42},
+{0x0361d6de,0xcb93b941},{0x0301253c,0xb8ca41b2},{0x03e1d605,0x8305dbc9},{0x01c0a2ba,0x9c29a4f0},
+{0x03802a60,0x6bf28963},{0x0380fb52,0xc2058048},{0x01e1bc08,0x01678247},{0x02200a18,0xd4487873},
+{0x0260abeb,0x3aecf761},{0x01a00e50,0x94319eb6},{0x02812fe1,0x980d7016},{0x01a0a4d5,0xff56521d},
+{0x01a0a2ad,0x9d794314},{0x03e109d3,0x3d3351eb},{0x0300fef2,0xc7caa34d},{0x02c1f078,0xec80c7aa},
+{0x02c133ac,0x1cbbd1f3},{0x0641fb4a,0xbc031a86},{0x02c131ce,0x4afa9336},{0x04e1d847,0xd8063d55},
+{0x032124c8,0xa73c5959},{0x0341e854,0x34952e99},{0x02610392,0x9e584952},{0x03c004d7,0xa4ad6215},
+{0x0501d97d,0x458c68f8},{0x0320a686,0x26e98085},{0x0300a969,0xb5b41a3a},{0x02c011c1,0xfaec0dcf},
+{0x0261191a,0x8a2487d1},{0x02602dd6,0x9cf8d8ac},{0x02e14570,0x6f43a96c},{0x020005e2,0x7959369f},
+{0x0240155d,0xae4bebde},{0x03e02679,0x08da2c70},{0x0101f359,0xdcc3b6f5},{0x02e03166,0x42f83cf5},
+{0x02a1e8cb,0x53a5b728},{0x0361da84,0x65536046},{0x02e12353,0xcbbbe726},{0x01403331,0x2f9756c6},
+{0x01a11699,0xf1deaf4d},{0x02e14560,0xe93c1ab5},{0x03600d63,0x62191a15},{0x0241f0f0,0xd6703402},
+{0x02210114,0x016a1b25},{0x02001a60,0x282d019c},{0x03600db1,0xd9202bac},{0x0580fdba,0x1fc9047d},
+{0x02c13111,0xe9148482},{0x01c0a395,0x42ba4b0e},{0x02e145f4,0xeaf99169},{0x0580fc31,0x36a7231c},
+{0x04801e3d,0x6d5f38a7},{0x02410a15,0x320b0638},{0x0360158b,0xdb2cb859},{0x01a0a3c7,0xfe735a22},
+{0x04e01eb6,0xce4dfcc1},{0x02c13315,0xf70b01fb},{0x04a1f8a8,0xadb28675},{0x02e1f010,0xe6eb9a67},
+{0x03802cc3,0xc329b922},{0x04a0fce9,0x2cb3c4eb},{0x01e1067f,0x432af816},{0x02e1450c,0x8ba4e87d},
+{0x0401f11f,0x1a3004c5},{0x04812466,0x3589e2ca},{0x01c0a346,0xc577a7cc},{0x0440a703,0xff581063},
+{0x04400673,0x5da955d2},{0x03201c84,0xe6c7070f},{0x0361e820,0x54e1dfdc},{0x022120a1,0xb2c8967c},
+{0x04c01e12,0x09b30aec},{0x0300a9f0,0xa6027bda},{0x028017b5,0xb236f4da},{0x028014d6,0x8ff8fe26},
+{0x0441f17b,0x7345c927},{0x0081f695,0xd3df43e9},{0x0321f57b,0x53dbee66},{0x0440038c,0x4bef7fef},
+{0x02c0151b,0xbc05109e},{0x0241e93c,0x99ff04c2},{0x0560a71e,0x9dacf143},{0x030027c9,0x0f77cff0},
+{0x02801d48,0x5c8c6a19},{0x02600e0d,0x4a6569ff},{0x02c0abb1,0xa34ab72b},{0x01e1158d,0xe930af97},
+{0x02a0fe79,0x507f9169},{0x0221231c,0xb2addf45},{0x0220fe4e,0x1967c014},{0x05c02b3a,0xf94c712d},
+{0x01e1130f,0xd6a86494},{0x02200907,0x6c80124e},{0x0401226e,0x460c0beb},{0x024019f5,0xf002e70e},
+{0x02202231,0x84938d3d},{0x0161f52e,0xa7cbcc48},{0x0280149c,0x21382bcd},{0x01a11459,0x7efb28a5},
+{0x024188e2,0x110e9d6c},{0x02e16b7e,0x49fbaf46},{0x0180aa52,0x69d3a519},{0x01c02aea,0x26339ba1},
+{0x02402e88,0x5c11c006},{0x028169d3,0xb5e3524b},{0x02c133c1,0x9815eb64},{0x01e0a98c,0x3e927fa7},
+{0x0240244a,0xd7e3f526},{0x02e1313c,0xbfae0336},{0x03402cff,0xef1b54d4},{0x03e10b47,0x4cc0c50a},
+{0x030120b2,0xd6be2e45},{0x02418986,0x3292769e},{0x0321da1b,0x256e9c17},{0x03012385,0x131b69e0},
+{0x04c1cf3e,0x2947d52f},{0x02c01dbe,0xb8478214},{0x03e18bbd,0xccea2a3a},{0x01a1f103,0x063ace17},
+{0x01c0a41b,0x02efb112},{0x0201116f,0x42def5a1},{0x01c1fbb9,0x89596ff9},{0x0320ff81,0x34b620c9},
+{0x0301f670,0x4eeacfde},{0x032100e6,0xce67f777},{0x01c01025,0x571a6d87},{0x02412070,0x0118c90f},
+{0x024104d9,0x5aaa69af},{0x02c1b000,0x75ef6bc5},{0x0240aaa4,0x34d09d81},{0x032011ee,0x87560d7e},
+{0x03a014b5,0x24fa9bd2},{0x03c0fb51,0x94be5c87},{0x03e0ffa5,0x0a9de7ab},{0x03c0fb82,0x109f756c},
+{0x03410fcb,0x0e465bb7},{0x01e005db,0xda0ead88},{0x0340209c,0x05cbee53},{0x02c13285,0x83ab8117},
+{0x03002e16,0x6b82a4be},{0x0340030d,0x1c76542e},{0x046004ec,0x57f89dfc},{0x03e18c40,0xf39a9dc3},
+{0x02402063,0x687c81f7},{0x0280ab02,0xd7e407a3},{0x0441d075,0x41fa2b7c},{0x026119a5,0x179a3d3f},
+{0x03a01efb,0x3c825b24},{0x04001e48,0xe1845a12},{0x02e130cb,0x32776854},{0x01c0a168,0x961dc420},
+{0x02011316,0xf26351a4},{0x03e18b03,0x0ecff175},{0x03e023ea,0x60cacd6a},{0x022013c8,0x4daa0206},
+{0x01a1140f,0x1fe3b37e},{0x022116ab,0xe0dfc168},{0x0440fc80,0x0eb7189a},{0x02c01ab1,0x27cd6f98},
+{0x01e111ab,0x893ea80a},{0x012033ac,0xdf4ea068},{0x0180a4ae,0x9e5fd683},{0x0301136c,0xdf167dbd},
+{0x02601220,0x3bf72960},{0x02210056,0x25c34917},{0x0220aa44,0x0b117c2b},{0x012032cd,0xaf210542},
+{0x03a02cb3,0x296f70de},{0x02816b04,0x823bc679},{0x01c016b3,0x80a27634},{0x038001ef,0x067a5330},
+{0x00a1f469,0x54a4d6b5},{0x03002147,0xa1103cc2},{0x00c026eb,0x786ce1d9},{0x03601643,0xa9095d24},
+{0x0260aa81,0xc46a8fdb},{0x0081f980,0xce307a23},{0x02e0a67c,0x38399f75},{0x0440295c,0xbacd3b80},
+{0x03612484,0x0b26fc1b},{0x02c02a00,0xdaaa8bda},{0x01a1142a,0x1eed8514},{0x01816a69,0x175af364},
+{0x0360a8ef,0xc5de0b2e},{0x020030f2,0x62b8d115},{0x03401d64,0x04cbecc0},{0x02418a7f,0xbfa47433},
+{0x018016c2,0x7d252a75},{0x0141f9c2,0x10525ea9},{0x0341d1dd,0x5680a7d9},{0x02e145f0,0xeef997b5},
+{0x026023bd,0xa46323fd},{0x0361d5c8,0xd49ca0f7},{0x01816a54,0x3b27d71f},{0x02e1440b,0xb57ad6ba},
+{0x02418aac,0x429ab510},{0x01e1173d,0xb7cb3fe4},{0x02200c03,0xeba96bc5},{0x02c1303f,0xfc159405},
+{0x0180a0e0,0x5a639aca},{0x02816b55,0x092069fa},{0x00e1f97d,0x8e53b197},{0x03a1d598,0xf4919181},
+{0x02a10018,0x127e65bd},{0x01a0a2af,0xfe4fe161},{0x020013ed,0xdc1b1399},{0x032100f6,0xbe636119},
+{0x04601e51,0x31765065},{0x04602cfb,0x15b2e27c},{0x03e18b73,0x06cda646},{0x03a0aaf4,0xb84dd233},
+{0x0280aae6,0xd5542c44},{0x0380ff23,0x48eccdff},{0x028e0155,0x7f6f5b88},{0x04c124cb,0x92c021e3},
+{0x02e1220d,0x880e35ea},{0x03014433,0x3b3f92a9},{0x02418afe,0x6811c89b},{0x02c03299,0x17249ac6},
+{0x02211c83,0x4182a7a9},{0x02418a9d,0x4d9d04f8},{0x01603344,0xf4dc763a},{0x01e10730,0x806ee32c},
+{0x05c1d926,0xc3e7db7d},{0x0200308d,0x4e54c445},{0x026104e6,0xbbe2e788},{0x03e00da9,0x5f1dae02},
+{0x01c1e2e7,0xd871529c},{0x0241f9d6,0xbb50b0ef},{0x03002c96,0x0bec1da2},{0x04400208,0x7467b7dc},
+{0x02a16956,0xefd560aa},{0x0561d836,0x4a405c24},{0x01e16a95,0x059d0113},{0x0301213d,0xb8b7a6ba},
+{0x02c1311e,0x650f3788},{0x03411fc9,0x75ce24f9},{0x01801be5,0xdc66286f},{0x0461d788,0x572b44ba},
+{0x03a0fa9f,0xe24a0b48},{0x01c0a5c0,0xe4bd0ce9},{0x02601243,0x3f24dadd},{0x02c13014,0x891f6c58},
+{0x01a16f8f,0xb6d7bea3},{0x02810750,0xd49184e1},{0x02c025e3,0x9333a628},{0x03c1ee69,0x6d87d6c3},
+{0x03e01f7b,0xfcbd1d11},{0x02401a3f,0x1bbbe745},{0x04a00872,0xaa601b8a},{0x03200836,0x5dc1f5d4},
+{0x0201da8a,0x2b4bcc1f},{0x048003cb,0x52067056},{0x03c02777,0xa95b7840},{0x03a0fa95,0x354a8df1},
+{0x0240d7c3,0xec7d70b9},{0x02e01bdc,0xdbdd3303},{0x02402f0f,0xc81fe45b},{0x028104ed,0xd0e07c0b},
+{0x0381f973,0x4d121907},{0x024019f4,0xbb14feaa},{0x02a02585,0x4127f825},{0x02c01871,0xa001a3e0},
+{0x01e02ec1,0x792d114c},{0x03c1ec97,0x6c53cbe4},{0x01a0a046,0x1da1835a},{0x02c0093b,0xcbf32a86},
+{0x0341d4a2,0xd37c9d43},{0x020009a5,0x7d03a214},{0x038014ba,0x1ed5ad83},{0x02e01900,0xee1743ab},
+{0x03c1d560,0xe9255f18},{0x05801cd7,0x9e442e49},{0x02003057,0x6c573216},{0x0201110f,0x2912efd4},
+{0x03e1d035,0x4df8624a},{0x0320320f,0x26305d66},{0x02e022f0,0xa6e3967a},{0x0360299c,0x784f49ce},
+{0x0381d11f,0xe86515ed},{0x02c10427,0x9ec0b207},{0x038169dd,0x7107a463},{0x02c13152,0xcfc3b9ad},
+{0x03011a1c,0xa69207c1},{0x02e1305c,0xa5386803},{0x030012a2,0x5d3bd298},{0x01e1109c,0x2cd98360},
+{0x04412543,0xe07db300},{0x02411c0f,0xa9585594},{0x02c0114c,0x79af48d1},{0x0361f625,0x8cdb8db9},
+{0x044109e1,0x5b38af1c},{0x03416e53,0xa8f80fe1},{0x028169d9,0xb9906983},{0x05202934,0xc044a462},
+{0x02004dca,0xa074ad69},{0x02400d1e,0xffb8cb0c},{0x01c0a241,0x6749bf02},{0x03402098,0x1ccc1288},
+{0x01c00c0a,0x6c65ebcb},{0x04802504,0x5dde1467},{0x03402483,0xf63fe858},{0x01e00c94,0x3d339261},
+{0x02a0204d,0x28604365},{0x02e14436,0x206eb338},{0x03e18c26,0x799fede3},{0x02e13311,0xc8d4d048},
+{0x03a02ccb,0x2a3c76a8},{0x036015ad,0x478b6ab1},{0x01c01c1f,0x5008b68d},{0x02812fcc,0x19f4a4d6},
+{0x02a104c3,0x5eb4d934},{0x02402ebf,0x19268da5},{0x02e01d3d,0x94320c28},{0x01e020ba,0x0d75bc38},
+{0x02801470,0xac3df543},{0x0240a890,0xeffa6245},{0x02c0093d,0x806e693b},{0x01a0a21c,0xc4f965a8},
+{0x03e1d754,0x3322fc25},{0x00c1f347,0x017ba119},{0x0241896b,0xa58adce2},{0x02e1440d,0xb37ad394},
+{0x04e0fe8c,0x680f1feb},{0x02e03132,0xa434ff2a},{0x02010336,0x8558ce4c},{0x01e02418,0x90bfc076},
+{0x02e133bb,0x9b7a825e},{0x02e1f76e,0x203a772d},{0x03e0d7d9,0x1d7b8f4c},{0x01c00c35,0x706caddc},
+{0x03a0fe80,0xb38f8755},{0x01e106e9,0x43c48d27},{0x02010ac8,0xdb594ea4},{0x02016a98,0xb327379c},
+{0x02200a9d,0x9699ec4b},{0x032103c9,0x54a43e3c},{0x028e0194,0x826055b7},{0x0360a72c,0x02e4e4ec},
+{0x02c1329b,0xdc5d0fc2},{0x02c132d1,0x4747a639},{0x01c01919,0xd95c773a},{0x03e01eca,0xffe7e27e},
+{0x01e16aea,0xf2610663},{0x0361d86a,0x1eedbc62},{0x0120338c,0xc696437e},{0x01a0a216,0xbcf95910},
+{0x01a0a59b,0xd6f207f0},{0x02c1217e,0x703c6e86},{0x02202bb4,0x37dfe14a},{0x01a11807,0x062740ce},
+{0x01e0a0ac,0x31f9a5dd},{0x0300053b,0x4e72f508},{0x0461e8d6,0xba2292c3},{0x01a102a3,0xbff0ada5},
+{0x036015e3,0x22a451fd},{0x02c13114,0x6a117dfe},{0x0580fc59,0x0b61b23b},{0x02a00397,0x907b104b},
+{0x02810340,0x7d171d16},{0x0561d799,0x483a7497},{0x02000737,0x9c4829c4},{0x02c13018,0xf6225686},
+{0x0201bc1d,0x5cdc1d16},{0x020026c0,0xb4d3f3f0},{0x02a1bc86,0xf5209e17},{0x02602dca,0xcf153bab},
+{0x03016e73,0xb3591d4a},{0x02402f6f,0x04baa44e},{0x03c01de7,0x64d36ef4},{0x02e145f1,0xe7f98cb0},
+{0x03c01aa6,0x87964459},{0x01e12220,0xac13ac4e},{0x02400d2d,0xa1a8083d},{0x03402095,0x21cc1a67},
+{0x02202d3d,0x1e0aa0d4},{0x03002c84,0x01e3e75a},{0x02612128,0xa34989fe},{0x02002f7c,0xa45a9022},
+{0x032022b4,0x3c14add0},{0x02e14468,0x218f0876},{0x03e18b9e,0xccbe406e},{0x0360297a,0xcd84186f},
+{0x03a0facc,0x0e6bda09},{0x01e1017a,0xb49c78a4},{0x01c0a93c,0xa91839fa},{0x0201119a,0x95e659d5},
+{0x02e11a10,0x3c1e202a},{0x02c131ac,0x5c5861a1},{0x02412359,0xb7efbc58},{0x0261cfa7,0x6246f220},
+{0x02c130e1,0x12d04be5},{0x0200275a,0x869e1aeb},{0x0081f48d,0xf54c2f6b},{0x01e16ac5,0x0b14344a},
+{0x0280abc2,0x2a123d9d},{0x03e023f4,0xff99d3b0},{0x0381d17d,0x69ea825e},{0x03e18bc4,0x1aece39b},
+{0x0140223b,0xba08a7fd},{0x0201062e,0x1d2626d6},{0x03e01060,0xa9b49529},{0x0361f70c,0xe71c2ed4},
+{0x02e028ea,0xf1624dc7},{0x022020b6,0xa9f2ad1d},{0x03e1d729,0x38071c99},{0x0180aa22,0x0f53f71e},
+{0x0421f864,0xf326c009},{0x01a0a11a,0xcbc88a68},{0x022111be,0xa4c8b61e},{0x01c0a38d,0xd59cf178},
+{0x056122bc,0xa6bb33ee},{0x02c1320c,0x737759cc},{0x03401626,0xf3363c7f},{0x0100211f,0xc85f77de},
+{0x0420fc6f,0x3843080b},{0x04a01f2c,0x916e5406},{0x0540ab66,0x1a3594f5},{0x0541d0aa,0xa46ea2d5},
+{0x02c1f0aa,0x19084f5d},{0x04211665,0x911425e9},{0x01802bfa,0x52084dfe},{0x026100b2,0x544cae82},
+{0x02c133ab,0x1bbbd060},{0x02602d81,0xc0fb5dc3},{0x032028bf,0x3def57fd},{0x03e18b31,0x9cd78cc4},
+{0x0201046c,0x4262873d},{0x00e02643,0xfb3548e6},{0x0261b0fe,0x1cc29e19},{0x02e1453b,0x7d938952},
+{0x020026c2,0x14922402},{0x02c1311d,0x62117166},{0x03c1d243,0x0f688c83},{0x01c11657,0x4b40ddc4},
+{0x01e16f95,0x7c98730d},{0x02418ac2,0xd816f619},{0x01c1e2d8,0xaf5d8a59},{0x0701d9c8,0xbe8318ec},
+{0x03a01122,0xc96eb02b},{0x02602f70,0x7fd3c35c},{0x03401b69,0xf6dcf60d},{0x0361e833,0xff8279a7},
+{0x02801324,0xa1053a92},{0x02a168b4,0xd849051d},{0x01a0a5da,0xd103479f},{0x02c10426,0x88a88a7f},
+{0x0281f343,0x165c94c2},{0x0581d96b,0xd37fb328},{0x01c0a379,0x2f8cc3a1},{0x0321f6ae,0xe5b0db88},
+{0x02c13362,0x94c34aa0},{0x02a1e7ea,0xed368b97},{0x03211344,0x4372e4eb},{0x04402df9,0x36f4ff19},
+{0x0161f389,0xfc6dee99},{0x02c132cc,0x68987da6},{0x0280070b,0xda49bca0},{0x01c0a377,0x278cb709},
+{0x01c00b6a,0x73edeaf2},{0x03c10142,0x66a3e5d0},{0x02001a01,0x93264471},{0x0301d1a8,0x1cd693dc},
+{0x01c0a304,0x9c8638fe},{0x02402701,0xf9433640},{0x02c1d199,0x2ac43f47},{0x03c005f2,0xa06458de},
+{0x02011c0c,0x19d7933b},{0x0161f3c7,0x54a80bcc},{0x02c131d0,0x5afceafd},{0x0440fc82,0x243f5a08},
+{0x024010e5,0x5733d9f7},{0x01e11437,0x239e4b6e},{0x0261b04a,0xc7b935ea},{0x0081fa99,0xcf9ed64c},
+{0x03c027e0,0xaad34563},{0x03a01e43,0x81ccbd5f},{0x01c0a225,0xc0969096},{0x01e16aa8,0x21e5ef97},
+{0x01600060,0xd60a1224},{0x022007a4,0xfa5438fa},{0x03812415,0xb7f1a496},{0x030145b2,0xc38f2f5f},
+{0x02418ad0,0xe61b8951},{0x02c130c3,0x3f327dc4},{0x03a0fa78,0x2c3b753c},{0x010033b5,0x6ea8210a},
+{0x042000ca,0x3eea04ac},{0x044027b8,0xf7277edf},{0x03601d17,0x98cd1f93},{0x04a1d774,0xf0c1a80b},
+{0x05a01ec2,0x82fe6c33},{0x01802bbf,0xce5aa608},{0x02400309,0xebfb15f3},{0x01e0a255,0x0d54d835},
+{0x0201bc18,0x98c5223b},{0x0381681e,0x78515e53},{0x06a01f85,0x026aacb1},{0x02a00ded,0x1d5b3e74},
+{0x02e1321a,0x355a379c},{0x0261b02b,0xcf466712},{0x01802e12,0xd2b07992},{0x03a018a9,0xeb46b3f7},
+{0x02e0302f,0xfa72ab61},{0x02c16b8a,0x5d4b1b81},{0x01e11019,0x16e6de60},{0x02201b8c,0x84cdb127},
+{0x03c1d76f,0xc2a19706},{0x0441f158,0xe24f4cd7},{0x0340160e,0xfb569cc2},{0x01e10686,0x4c37d234},
+{0x01a02626,0x0f072b5c},{0x03c1fb6f,0x0ce33180},{0x020103b6,0x96c6a54d},{0x0500fda9,0x9b3e4cdd},
+{0x02000645,0xb0bd5975},{0x0261b03d,0xaed723a3},{0x02010630,0x1b2623b0},{0x02610fc5,0xa176dd79},
+{0x028e01aa,0x745bc27f},{0x02816a2e,0x59e13302},{0x03600dc1,0x67b1cdd8},{0x0281687d,0x2093a1f9},
+{0x0620fd5b,0xec4f1887},{0x01c02612,0xd64421e0},{0x02210b33,0x62efa714},{0x03e1d5fd,0x8b05e861},
+{0x02c1302c,0x0324a994},{0x028e006f,0x80c23897},{0x03410544,0xd66d007d},{0x03a0023a,0x01aea886},
+{0x03e18c12,0x83a23c38},{0x03001116,0x073c6350},{0x02010634,0x1b23e519},{0x03c1f220,0x1a4c47e3},
+{0x01a031ce,0x55b764e3},{0x02600687,0xc6c85544},{0x04000281,0xce1a8f0d},{0x02418aa7,0x479abcef},
+{0x02418a38,0x3c3862cf},{0x0301011b,0x9ec18a21},{0x0381cf45,0x4ee56eb3},{0x03c002ee,0xc50ff8cc},
+{0x02601bf1,0xf7d0cbb0},{0x01e02e81,0x3e444755},{0x0340fb2f,0x6314e20d},{0x01c110ae,0xb01585f3},
+{0x0360108c,0x79a5f6fd},{0x02418848,0xf78bc19b},{0x02e122a2,0x379abb0a},{0x02802dc3,0x9c26e98c},
+{0x03201b63,0x5531b064},{0x01e12399,0x8fd8e912},{0x02418ad6,0xe81b8c77},{0x01c11010,0x4e5fc7f0},
+{0x03c0a661,0x21dc5ebb},{0x03600d44,0x4bed6ad5},{0x01a1f960,0x61fc9424},{0x02a1b151,0x353bc9bd},
+{0x04801ef1,0x9df075ff},{0x05a0fe19,0x0ca4730f},{0x02402eb3,0x76e3f714},{0x034004a5,0xca2fb6ad},
+{0x03200234,0x4f7f97de},{0x022019f3,0x91176882},{0x01a0a194,0x843c6bca},{0x01c16a75,0xbebb2c19},
+{0x03002dea,0xb6f44955},{0x032168c1,0x63bbb448},{0x01e10187,0x61355b98},{0x01c0a059,0xbaff0722},
+{0x05a1fa38,0x5d72c6e8},{0x02a01850,0x19f5b6d4},{0x02a1b152,0x2b3bb9ff},{0x030011b3,0x15ba82e9},
+{0x01c02e9d,0xf8bff424},{0x03210a99,0xda96a2ee},{0x0601d0cb,0x61f01824},{0x0261d349,0x22a0f7b6},
+{0x00a1f991,0xed9ecad9},{0x0361d5bc,0xc89c8e13},{0x02c13211,0x6e751356},{0x02a12284,0x33b62546},
+{0x024188c9,0x1e132f11},{0x020010e3,0xda923448},{0x01c00b23,0xbb49fcc8},{0x0501d08c,0xac85263b},
+{0x04c03360,0xf553a5d0},{0x01e116c8,0x3c25314a},{0x01c0a554,0xb6acb137},{0x0601fb6a,0x474279f0},
+{0x024114b2,0x87d495ea},{0x03e18b88,0x13bc719c},{0x02c13306,0xc83de3f0},{0x02811abd,0xc6bdbb4a},
+{0x03e00177,0x87937bb1},{0x02418815,0x688424b9},{0x02a0abc8,0xad7a84c2},{0x02000a0a,0xddd0b6d1},
+{0x01602999,0x0fb5ba7e},{0x02400967,0x39b0ecc4},{0x0441f181,0x5945a039},{0x02401022,0x5cf25d83},
+{0x0241f0ef,0xd570326f},{0x02a0ab95,0x2631c8a0},{0x02000aae,0x97bb47dc},{0x01403305,0x3091704a},
+{0x02e00545,0x62b823b4},{0x0421eea3,0xc3835095},{0x0260117c,0xb66c696e},{0x02c028ac,0x5af5d701},
+{0x02c0abb4,0xe335559c},{0x0280a8b8,0x153c98c0},{0x020030c7,0x38e7ed2c},{0x0201064f,0xdaa71fad},
+{0x03402c37,0x08ceb829},{0x01a0a39d,0x814322d6},{0x01202690,0x63c914e8},{0x044003d3,0x0f42a029},
+{0x02c0ab90,0xf2977b27},{0x018016f1,0x7f252d9b},{0x0341e802,0xcea6052f},{0x02602db1,0x3cbfb903},
+{0x02a168e8,0x519ce1b8},{0x024189ea,0xa0dc6bff},{0x028102e4,0xe0f6f38f},{0x03c1d47c,0xdf22e399},
+{0x02816b15,0x3024bab9},{0x01e106eb,0x45c4904d},{0x01c1f47a,0x2bd23919},{0x0201033f,0x7c7c9998},
+{0x02600974,0x0c1c732c},{0x03e18b5e,0xecc9002a},{0x01c02190,0x99f50780},{0x0280a7b5,0xf7e79eca},
+{0x01a00eb6,0x1a36ecc4},{0x04001d84,0xe190526d},{0x032011e5,0x85d434c4},{0x01c0a144,0xb85c4818},
+{0x02202f52,0x49061659},{0x0481d016,0xee740b50},{0x02a031f7,0x2f136085},{0x030020ef,0xb7d13cd3},
+{0x03600694,0xf2a88f40},{0x0341f00c,0x6156c90e},{0x03401563,0x6720370f},{0x04c025d5,0xc96d3213},
+{0x0380291d,0x94a9e674},{0x02a1e921,0xbf7fccf8},{0x0181fa90,0x18b1ea18},{0x032011e1,0xa32039b4},
+{0x0361f735,0xd5df217e},{0x01e1f535,0xe4f7789c},{0x0240d7b2,0xdac61327},{0x01c11138,0xb34ffe0d},
+{0x02200789,0xc23178dd},{0x01c0a308,0x92862940},{0x0320feec,0x291605f0},{0x0301d1b1,0xfc23a56c},
+{0x02e133dc,0x5ba189ba},{0x038001e6,0xb196c56b},{0x0261192a,0x4438bf34},{0x01802397,0x99d10033},
+{0x0321d206,0x5a73c49b},{0x02a0313d,0xf98f0e67},{0x05e1fa37,0x1e99c701},{0x0560fd52,0x4218536d},
+{0x03c01e3b,0xb95ace3b},{0x0181f927,0x7e59c021},{0x0281bc61,0xa9573bc7},{0x02000a14,0xde02539d},
+{0x02e1325d,0xf280384a},{0x03e1d7e9,0x1f041729},{0x0200ff0f,0xa5582e57},{0x02600cbd,0x922f1803},
+{0x02011108,0x23d04db9},{0x02801a39,0x38ae04a2},{0x03c0089d,0xa555d9df},{0x02e1f0b4,0x195f7d3b},
+{0x02e03255,0x40bf1403},{0x02000a86,0x2fc53180},{0x020111a1,0xd0015ff6},{0x0121f62b,0x4df4c00c},
+{0x02401229,0xd920fe81},{0x02201176,0xd18d5db4},{0x02202f91,0x49898cc2},{0x00e1f951,0x4e0a07be},
+{0x02c0ab96,0xeba2ffa5},{0x026014d5,0x0c6bf94b},{0x02a02a6d,0x014f1962},{0x042000db,0xb3a2945c},
+{0x0621fb3f,0x3276c131},{0x01e11236,0xfe8537fb},{0x02802dcb,0xb8597e16},{0x02e1d351,0x00ef2c96},
+{0x020102d0,0xb8f90f71},{0x0321d871,0xe4ab08f4},{0x01a0a566,0x3b116607},{0x0260d7b5,0x0d20f3fe},
+{0x0401d05c,0x4b20da56},{0x00e1f9db,0x69b5b48d},{0x0461d051,0x7ab05ec1},{0x02a0246d,0xd3de3c76},
+{0x01a0a5b4,0xd725e353},{0x0360162c,0x2e753e03},{0x02c028c3,0xa199c46c},{0x02418862,0xed691f9b},
+{0x02a11588,0xfef6182e},{0x02e1325b,0xf0803524},{0x02201b90,0x60b334fe},{0x02a021a4,0x882ece25},
+{0x02e1fa2b,0xcaf5a670},{0x03e18b8a,0xacbbcf77},{0x01e16f7c,0xbba11fa9},{0x0580fdc3,0xe97a7700},
+{0x02402bb5,0x19dbaa5d},{0x0441f17c,0x7245c794},{0x0260d7b3,0xc7d08346},{0x0400a644,0xf23f2e43},
+{0x02801b36,0x203a94ca},{0x020030de,0x60d265d5},{0x03002a79,0x61198beb},{0x0381f5a0,0xf6bb98e6},
+{0x04a0fd2e,0x453d2494},{0x046001ff,0x5591ce76},{0x02401814,0x5271c9c4},{0x02401242,0x1d1f2af6},
+{0x0520fd74,0xc671102d},{0x0260d7b7,0x56685c1c},{0x0280a9e2,0x94a643a9},{0x0340188d,0xa3bc1419},
+{0x04201cc1,0xe0f467bb},{0x02202a1a,0x0553b988},{0x02a01994,0x7d5cacc6},{0x0421d22b,0xc77a2c13},
+{0x02602801,0xc41c4d63},{0x02400910,0x3489706d},{0x05a10788,0xda8f381e},{0x0361d086,0x16734f2f},
+{0x02e109b4,0x79b11a3f},{0x0341f135,0xf100fa6a},{0x05011668,0x2f43b752},{0x01e10e9f,0xf402b609},
+{0x02e0041b,0xa546a999},{0x01a01912,0xd6d64f11},{0x02c131dc,0x3ffeff13},{0x036001af,0x077a8a2b},
+{0x01a0a1ad,0xa79950ae},{0x02400e2b,0xe1883410},{0x02011237,0xd4f2c897},{0x022114bc,0x8020e9c1},
+{0x018025c7,0xa2292316},{0x03401de8,0x211b5726},{0x0300236c,0xcf4bcbbf},{0x02801cd8,0xed3fef70},
+{0x02a1cf55,0xe5dbabd9},{0x02e14554,0xea3e5adf},{0x04a0fd04,0x2ca62b55},{0x02c1bc6a,0x953c8f31},
+{0x02802a2f,0xd021bb24},{0x02c1326f,0x7ba935e8},{0x040000dc,0x2b54bfd7},{0x0361d1c4,0xb5b3c8ca},
+{0x0181f6c4,0x50f86197},{0x03000fbf,0xbf565a93},{0x02412046,0x05633a97},{0x03612510,0x976a96a3},
+{0x01c00717,0xb18e8ab7},{0x0380207f,0x86240708},{0x028015a2,0xf1f759d5},{0x028002d4,0x178903a4},
+{0x0280a760,0x7b363eaa},{0x01e01c5e,0xda8256e9},{0x03202e06,0x9453882f},{0x02801847,0x4886008a},
+{0x0480fc5a,0xa784b6e9},{0x0260138f,0x0a78ce78},{0x0361d5ca,0xda9caa69},{0x03203296,0xdcd2fb69},
+{0x04a0251d,0xf236bf0b},{0x02e1b122,0x4c09056e},{0x02001924,0x553444ea},{0x03200ac3,0x9408bf5f},
+{0x042021c6,0xb81896b8},{0x046023ca,0x46bbdac3},{0x03801667,0xf0b6b414},{0x03a12436,0xa6c63053},
+{0x0261b0c2,0xd0cbf300},{0x03c01b1e,0x72c57b0b},{0x01c03153,0x351a1808},{0x01e1227f,0x87df983f},
+{0x03402b33,0xb50ff15f},{0x02200e2d,0x81545cd1},{0x0300aa7c,0xeda6c54c},{0x02a1698e,0x2398d1e7},
+{0x02e1451c,0x8bb3f307},{0x02418926,0x23248011},{0x02c13186,0xb132dce8},{0x02e14510,0x7fa4d599},
+{0x02418800,0x797fc24e},{0x02c1f074,0x4817f6bc},{0x02003115,0x74bce36b},{0x02400840,0xf4dfb03f},
+{0x03e0040d,0x56366cb0},{0x01a02e4c,0xd5026c4d},{0x0100002e,0x3dbb31d4},{0x0201bc0c,0x3ec0175f},
+{0x0521d7a3,0xfb0ea27a},{0x04e0fe88,0xb40cbbf3},{0x01800b89,0x145fe413},{0x02e14633,0xeec22fed},
+{0x034002bf,0xbed6c2fa},{0x03610157,0x5a3bb030},{0x01c0a1fc,0x4f956e96},{0x0201f7ad,0x613dfca6},
+{0x01a10281,0x0dee2668},{0x0261f558,0xa1187739},{0x0320d7d0,0xb8e5884e},{0x02816b59,0xc8d8fa6a},
+{0x03001d04,0xfdb8b931},{0x01c0a5e0,0xa4a5184b},{0x03c0235b,0x5f1fd111},{0x00c02be3,0xe717ebcb},
+{0x0340fb79,0x2714e023},{0x04202ea6,0x9b6c176c},{0x02e00573,0x6d932f5f},{0x0301229c,0xd621bb51},
+{0x02c13332,0xfc0f8708},{0x0200099f,0x950e5538},{0x022013c9,0x4faa052c},{0x02a0fe77,0xfdec5091},
+{0x020017c2,0x2cade070},{0x0661d9b3,0xfc0c1f6f},{0x0181e29c,0x7a7cdb25},{0x02203188,0xe4f96d75},
+{0x0261b0b6,0x9e5a6278},{0x02c13309,0xf90d43b8},{0x03402b4f,0x8e8349b9},{0x0241891b,0x90276a3f},
+{0x022006a9,0x8d43bb3e},{0x03c1f1fb,0x9d242859},{0x02011113,0x412a464a},{0x03e02952,0xa253dd88},
+{0x03c1f1fe,0xa6243684},{0x0381d4fa,0xd9cfb53b},{0x02e1686e,0xafdc80f9},{0x0381e146,0xa6c7c184},
+{0x02816a35,0x5735ea5b},{0x0321136b,0x50f29e7f},{0x01002642,0x182130e1},{0x030118a8,0x04aa28db},
+{0x02e028ce,0x90854efe},{0x02e1f857,0x3b20f2d8},{0x0200a849,0xe6754f54},{0x02601a2b,0x408a92b3},
+{0x02a03083,0x1d1911b3},{0x03216e42,0x6f85598f},{0x03812423,0xbe8c4575},{0x0400fbfc,0x3816f30d},
+{0x05200456,0x4c9ffb7c},{0x03c1d480,0xeb22f67d},{0x01e01c49,0x18daf851},{0x03e18baf,0x9ce7a013},
+{0x02a00f30,0xa4f3c98b},{0x0341085a,0x0e1f28a3},{0x02211fe0,0x7069e1f6},{0x02801a95,0x36224862},
+{0x02616a0a,0xb21e5aa9},{0x03c12273,0xf93b5394},{0x02201a07,0x9b22516f},{0x02c01870,0xc6b2ca66},
+{0x03c1220e,0xb55541e5},{0x01a00b86,0x5d25fd4a},{0x02a16918,0x12cc1d67},{0x0421cfac,0xbcf7d6a6},
+{0x02e029d5,0x8c7918c3},{0x03c02b44,0x37cda7fb},{0x02a031f5,0x3b137369},{0x026e014c,0x9a88e8ef},
+{0x03a1da4a,0xbeb12a88},{0x0321e7f0,0x800ed2e4},{0x0381ee2a,0x76bd6227},{0x0281d135,0xdec30212},
+{0x03c1f22c,0x3bc43457},{0x00a1f9e0,0x527677d3},{0x02c02c8a,0xae994896},{0x0420fdfe,0xfd00f563},
+{0x01a0a6cf,0x634e9e78},{0x02418825,0x7881ff52},{0x032122f8,0xa3cee0b4},{0x0220006d,0x1e57563f},
+{0x0180a28f,0x826cd41e},{0x02401167,0xd0df9b4f},{0x02610912,0xa476191b},{0x04001f11,0x4910ac52},
+{0x0260a774,0x7697a5d8},{0x0200232e,0xb6b77aa6},{0x01e0a1b5,0x139aa5d8},{0x0261b118,0xf01b942e},
+{0x026003fb,0x1079be24},{0x0401d54d,0x35895fb2},{0x02012077,0x30f44b0f},{0x01e01c51,0x4c4757eb},
+{0x01c11015,0xa264c95a},{0x02611959,0x52e50bcf},{0x01c1e2e6,0xd857bab6},{0x02000f4a,0x73271551},
+{0x01a0a471,0x463e0afb},{0x02418a25,0xb53fdd0f},{0x01e00bc1,0xec2f11c3},{0x0241888c,0x04ddde85},
+{0x02e1f0a5,0xf84e8440},{0x01616a56,0x054a3b75},{0x038015bb,0x13b1658e},{0x02e02f35,0x574feb4a},
+{0x01a16f46,0x385b5c1a},{0x0461016b,0x8a75f131},{0x02a02807,0xba169710},{0x02a01bbe,0x4c44c1f6},
+{0x01203394,0x051845e0},{0x0580fd77,0x21b21702},{0x01c1f4c2,0x7b44ec5b},{0x03202184,0x56dc65e7},
+{0x0160a002,0x49844ec6},{0x0320a831,0x306ed788},{0x01611047,0x3916a202},{0x026101ed,0x5e88b0ba},
+{0x03e18c60,0x87957691},{0x0380fb41,0x99988a23},{0x02810364,0x2543133b},{0x0561d792,0xd58cac8d},
+{0x022005bb,0xbb063fe6},{0x02e1444f,0xaa76483b},{0x0201061d,0xad2b86b4},{0x02603271,0x33209fb6},
+{0x04a0a672,0xe8a820d2},{0x0260096f,0x003cf730},{0x0580076e,0xe1589863},{0x03c1f5a3,0x56704a10},
+{0x02810003,0x7074020e},{0x01c00c89,0xfd37520a},{0x02200d67,0xc0b139cb},{0x03a0faba,0xb06d84a6},
+{0x03812401,0x9297df91},{0x030016cc,0x4527329a},{0x02e13228,0xcd70f785},{0x036001b3,0x9ac0871d},
+{0x02e003a3,0xb81f8bf8},{0x0201fb30,0x302a159b},{0x04002737,0x859c77d8},{0x02801b16,0xb6ca0d35},
+{0x03400b74,0x8e2bc014},{0x01e0a44f,0x86ddd53c},{0x0221f510,0xd0de5f75},{0x02800c0b,0x06fbecd4},
+{0x01c0a5e9,0xa870ca80},{0x0260ff07,0xb9e8bf91},{0x02016ac3,0xbe7831e2},{0x0121f4d7,0x5d8d5d71},
+{0x02c1312a,0x5e0f2c83},{0x0340035f,0x1ae72c73},{0x0301d4c8,0x3aa11cea},{0x0481211a,0x249e0439},
+{0x03e18c72,0x839331ae},{0x02402f26,0xb71fccf1},{0x02a021f6,0x687be9b4},{0x02a01052,0x9f729d71},
+{0x01a11655,0xabf1ac93},{0x01c0a16b,0x9a1dca6c},{0x02200e21,0xde45df28},{0x02e120c7,0x55f08b05},
+{0x0261b0bd,0x2273372a},{0x0261b0c9,0xe0b88478},{0x0261b069,0x25ef8a63},{0x04c01f3c,0x7f4d7837},
+{0x0460fcf0,0x0b5c22b8},{0x03c1235f,0x06be4f9a},{0x01a0a277,0xcd823331},{0x03801efd,0x5b12e76e},
+{0x02201b50,0xc1170355},{0x01a0a552,0xdf14a6ca},{0x02810a01,0x1c285c73},{0x04001e34,0x860a6def},
+{0x0360302d,0x7e04113f},{0x02a02ca0,0x7d7c30a2},{0x02a02d27,0x445b6ca1},{0x02a00e2e,0x0effa4d3},
+{0x02411c18,0x210e22f5},{0x02a00965,0x17818c4e},{0x0300053d,0xd8f4fd97},{0x02e01da5,0x70ed9690},
+{0x02801c2e,0x666bd79b},{0x02604ddf,0xc8738f99},{0x0200267f,0x11aa3115},{0x02e14628,0x6ade846c},
+{0x0400a73f,0x84efdfea},{0x04002b8a,0xb147b443},{0x024012ad,0xe4e8b8d4},{0x02e0ff3c,0xeaa2bfad},
+{0x0540fd65,0xa6dbc850},{0x02e133a0,0xf9bc773b},{0x02e1445a,0xa18c005f},{0x01c0a5e5,0x113ed462},
+{0x03400f81,0xbd09bf1e},{0x0540a65d,0x38eec243},{0x0300316c,0xb0e9bb3a},{0x01e01c71,0xd8795967},
+{0x0261b105,0x1bd1a710},{0x03c02c71,0x934e9f4b},{0x02802f10,0x93784bca},{0x03a0fa8f,0x144c9895},
+{0x01c01691,0xf66add98},{0x03e18bcb,0xf0eca17d},{0x01a02215,0x4f16cc2b},{0x05e023ed,0x71c0f6b0},
+{0x02a00431,0xd5d742b2},{0x0260a777,0x36567e1a},{0x05c1d902,0x678d8241},{0x03603183,0xed2a4fe0},
+{0x02602202,0xe74dea57},{0x02011170,0xced78340},{0x042120f1,0x35a30d14},{0x0520fe85,0x74ab33af},
+{0x04001cb4,0x94039f00},{0x034027d0,0x84cd76b2},{0x038021b0,0x79aecc1b},{0x0381e103,0xbeb4be00},
+{0x034015ce,0xb76bf805},{0x02a0a9ac,0x8786e23b},{0x04c1d996,0x183b6750},{0x02016ad3,0x78977e85},
+{0x024188b3,0x0bfbfe9e},{0x01c0a08e,0x1a9d259e},{0x03000fad,0x2e7904ad},{0x0141f1a7,0xb16272a8},
+{0x03012344,0x3db7aca0},{0x0081f9e5,0x198bc312},{0x04e02b42,0x1b1e5960},{0x0241f261,0x1ce0fece},
+{0x02e10850,0x0e7ed9a3},{0x0361d68a,0x2f06d632},{0x02402e43,0x7494bef6},{0x02a0abbc,0x3f20a6da},
+{0x022026ab,0x85c6f235},{0x02c0ab97,0xe7a2f959},{0x0281f4a6,0x7f6aadbe},{0x02001705,0x7f80b3ce},
+{0x01c0a17b,0x51ff4400},{0x028011c2,0x19535661},{0x02a00d02,0x8f18ecd6},{0x05201f4d,0x068e0762},
+{0x0380ab43,0x0f695bc8},{0x026124fc,0x5731b377},{0x016007e6,0x938b8ee1},{0x05c1cfa0,0x72321de2},
+{0x0420324e,0x43441493},{0x01c11008,0x8e73b468},{0x0381e129,0xcc71ee1d},{0x01e106e4,0x41c24b6a},
+{0x00e1f6b2,0xa2f2d03a},{0x0300a870,0x5f8eab21},{0x028e0181,0x03659df8},{0x04800469,0xaf29cf93},
+{0x02010b21,0x0f3be552},{0x01e1049b,0x9d31ef99},{0x01e0a866,0x5c1feed3},{0x03202140,0xc6151cdf},
+{0x03a0045d,0x4abadd33},{0x0481d0f3,0xcc7b6a05},{0x02001b32,0xeacd499e},{0x02c02993,0x3751846e},
+{0x0241887e,0x8ee334f1},{0x04002916,0xa7337b34},{0x03a0a7f6,0x9d5906d9},{0x03801415,0xd5a6d2cf},
+{0x01c01be6,0x0075ae34},{0x01a0fe62,0x68c25f9d},{0x02e1f702,0xfffcd9df},{0x01a00ec0,0x1e36f310},
+{0x0241896a,0xa08ad503},{0x0280a736,0x7f5698a1},{0x02e13289,0x99fc95a9},{0x03e18cbb,0x6c89b5ef},
+{0x0140221c,0xdadf1f79},{0x020008d0,0x253a93ea},{0x02c13074,0x9e96a63d},{0x02e16e62,0x6ad45ee2},
+{0x022013de,0x2e058ca8},{0x01c16a77,0xd3bb4d28},{0x01c110a8,0xac2f178d},{0x01e11c8d,0xbd7990e7},
+{0x01c0196c,0xee079fa7},{0x022111bc,0x9ac8a660},{0x03e03033,0x584284fd},{0x0441d872,0xc1585806},
+{0x03c000c7,0xf9a3444e},{0x020017c0,0x5cc1b3b8},{0x0221122e,0x9f579657},{0x03e18b42,0x95c6389e},
+{0x01c02bd4,0x2435f8cd},{0x02a0186b,0x780de697},{0x03c1d873,0x57d0da1a},{0x02e0241d,0x607677e2},
+{0x0301233a,0x574a6815},{0x020120f0,0x7ccce114},{0x0361e8a3,0x38e9433d},{0x03002ee0,0x2a289a32},
+{0x036005c6,0xe10bd9e9},{0x0180a620,0x9235fd2e},{0x0300115d,0xef31aea0},{0x03210f4f,0xe4ec0ba5},
+{0x02016ae5,0xa4c4e367},{0x02402bfe,0x9dbb19be},{0x0261f1a0,0x5d12616c},{0x03a0fa79,0x2d3b76cf},
+{0x026100db,0x98989634},{0x01a0a2b1,0xf64fd4c9},{0x0540fd58,0x644e2d9a},{0x02e13005,0x8cea752e},
+{0x02a0154e,0xc60ea579},{0x02011292,0x61d6d1be},{0x0321d805,0x75e85ea4},{0x01e11ee7,0x0eaaacd8},
+{0x020031b9,0x7a83014c},{0x03801125,0x0c500943},{0x020108e6,0xf507d321},{0x01a0a11f,0xbcc872cb},
+{0x02002ef1,0xaabf1a8b},{0x02210fe9,0xdffc0a95},{0x02811d76,0x3aab8b92},{0x0380141e,0xd8f7712d},
+{0x01a1e2ec,0x9ae6ed98},{0x02200ced,0x2b576bed},{0x02e10591,0x82866f83},{0x03a00626,0x7a9e1b19},
+{0x03602391,0xdf492e88},{0x01e108f5,0x55200931},{0x01e1121a,0xc4cc7056},{0x03002a86,0x463b9223},
+{0x01e11c70,0x14be661c},{0x01e01c6d,0xc5a04aee},{0x01a1f473,0x28195fa7},{0x0301d341,0xd1c45a10},
+{0x0280abd2,0x12d45d08},{0x02401933,0x2af73310},{0x032010fc,0x561ae6bb},{0x02e111dd,0x294f9b91},
+{0x0261b08f,0x6faef035},{0x0381f86b,0xf7786416},{0x0261b0bb,0x1c732db8},{0x02616998,0x2f19273e},
+{0x0181f3ac,0xe6f0a0e2},{0x044008a7,0xf795dde8},{0x04001d88,0x586b8892},{0x0320054b,0x6d25e659},
+{0x0320ff76,0xec6e4c56},{0x02c10aee,0x7ade2fe0},{0x040002a1,0x0fa9f78a},{0x03201b39,0x893628be},
+{0x03812406,0x91796a54},{0x02e0fb4c,0xe428f191},{0x0281b0e2,0xbafce879},{0x020030f1,0x68b8da87},
+{0x024188e1,0x120e9eff},{0x02e13007,0xb4ecf2bd},{0x02601239,0x23cb76fa},{0x0421d5db,0x4c36c61c},
+{0x024027f7,0x5af3e1f1},{0x01c0a246,0x4e4a8e0e},{0x03e18b10,0x11d234c5},{0x01c0a37b,0x2d8cc07b},
+{0x0201110d,0x358aa691},{0x0461d770,0x4515cadd},{0x02c169b1,0x14e3bf29},{0x0280211a,0x35da665f},
+{0x02c130aa,0xbc2d325d},{0x020013a7,0xd81212f1},{0x01c0a2e1,0xca1f593e},{0x0260a76f,0xb990fcfc},
+{0x0481216a,0xf0a3bafa},{0x02616e86,0x76fe89ba},{0x03e18bfe,0xade0ff11},{0x01a11820,0xa62a7b45},
+{0x02a0057c,0x77856408},{0x0260207a,0x3af4babe},{0x018000a4,0xeaf4f8c3},{0x03a0faa3,0x26707cff},
+{0x020030b7,0x04c2ca77},{0x03602a5e,0x6807f2bf},{0x0301f603,0x93961990},{0x02e1450a,0x85a4df0b},
+{0x01c0191e,0xff4e01fd},{0x03e18ca1,0x058ce561},{0x03e18c61,0x869574fe},{0x020013b4,0x9c04e88a},
+{0x02200066,0x2757646a},{0x02e132f1,0x7de35564},{0x02402f1f,0x7e81009b},{0x050001d7,0xf8e4dc5c},
+{0x0481d0e2,0x8f9a80c3},{0x0180333d,0xcd475235},{0x04c021fc,0x8608ae9c},{0x03612450,0xf8daa434},
+{0x02a00785,0xd35228b7},{0x0361055c,0x37830e47},{0x02a0ab89,0x152f6f46},{0x01616a50,0xe12e2c4c},
+{0x02e109b2,0x81c26ff8},{0x034018f1,0xb70a1692},{0x02e14435,0x1f6eb1a5},{0x02c1004c,0x6cd874af},
+{0x03400351,0x6d80ab2c},{0x02c00579,0xf596e481},{0x0221f3cf,0xe36da009},{0x038025dc,0x2fa2dc6d},
+{0x02c10e79,0x24631b4a},{0x01a0fe4d,0x001256c4},{0x03a12061,0x2c9ab193},{0x02c10aca,0x38ff820b},
+{0x00c1f345,0xcad47a83},{0x0201f02a,0x4ab7877c},{0x02e016cf,0x1d8d5f81},{0x02001c62,0xc34a7355},
+{0x02418957,0x3185a918},{0x0301452e,0x0f414c48},{0x0301f0a7,0xee132b2f},{0x03e1ee6c,0x2ac6b997},
+{0x02c133f4,0x257861a4},{0x02c1317e,0x3dcd6133},{0x0441d765,0x2f267db7},{0x01c16f15,0xf0b95034},
+{0x02010649,0xaca01fd6},{0x02a00940,0xd51f75cb},{0x034015cb,0xb16bee93},{0x03c02c6a,0xf3481c7e},
+{0x02e0042f,0x6829c77e},{0x02418a99,0x559f5027},{0x04a0a716,0x4727e215},{0x02e14532,0xfeae97e2},
+{0x0480fcc9,0x0479e2bd},{0x026022cd,0x82b5b3ae},{0x01c16a72,0xe0ddf3e1},{0x02a0ab7c,0x28479215},
+{0x02e00186,0x7641c3b8},{0x0381f59e,0x3c6b60c8},{0x02e14462,0xa98c0cf7},{0x02c168f8,0x1e9dd667},
+{0x0441f186,0x5c45a4f2},{0x028110db,0x03006aa4},{0x0281f7c6,0x1c2fe387},{0x030002e7,0x18891013},
+{0x02201b8f,0xc0dadb8e},{0x02010645,0x2d4693b1},{0x04e023b6,0x8e56df95},{0x03401599,0xc32e252e},
+{0x028e0189,0xf367c35f},{0x0260aa90,0xd82b31b5},{0x05a02b98,0x418eb27d},{0x03e18b3a,0xccd7d854},
+{0x036011f1,0xf32c17f3},{0x04202385,0x4f35160a},{0x02816852,0x4b55f7b9},{0x02c1301c,0xfa225cd2},
+{0x0481d077,0xe72e73b9},{0x0500296c,0x09851a72},{0x02e14411,0xaf7acd48},{0x02418a9c,0x4a9f3ed6},
+{0x02401245,0x291f3dda},{0x03002a27,0x2f1657b1},{0x02202f3f,0x1395393c},{0x01e0a857,0x78291543},
+{0x032002ed,0x049f0d2e},{0x03e01e5a,0x35b1a743},{0x01c01909,0x16fc9e9d},{0x01a10921,0x99bf5f80},
+{0x03601cf0,0x213597a6},{0x07e00753,0x9fea9d4f},{0x03a0aa77,0x4c42286c},{0x0341d7d6,0xb92d3962},
+{0x01c0a93a,0x9550730f},{0x02e028da,0xb2600fa6},{0x01a0a2bd,0xb65e7a93},{0x0261b0ed,0xa4b8e6d5},
+{0x0401f110,0x29301c62},{0x028e01ad,0x775e05cf},{0x02802aff,0xb4d9d521},{0x028115c9,0x5610ddc9},
+{0x0520fdbe,0xd9b2cff4},{0x01a0a067,0x5b065cec},{0x02a00667,0x66e7a694},{0x01a0a29c,0x9356a114},
+{0x04000491,0xb5f27e9d},{0x01a1f3bf,0x7104804c},{0x0301f784,0xb50ad64f},{0x02a01980,0x595a3583},
+{0x028169e5,0x310edfb9},{0x02418967,0xa18ad696},{0x0441da10,0x7f0ea62c},{0x02c119d3,0x6645af2d},
+{0x0581d7c4,0x706aaefe},{0x05802a8b,0xe2652adb},{0x02011197,0x227ce1b7},{0x02c1fbc7,0xf96df008},
+{0x02e00279,0x7b79a03c},{0x02e145a2,0x7a36eeca},{0x070029af,0x433a0459},{0x03c1d4e4,0x3de9854e},
+{0x0200312d,0x987c74c1},{0x03e01e92,0xe277f51b},{0x0361d170,0x2320716c},{0x03011c96,0x06b6ec3e},
+{0x0460fcb8,0xe351e720},{0x0620fda2,0xe04011fd},{0x02e0a689,0x6a352a60},{0x02610feb,0x90969bb8},
+{0x0241e93e,0x52031098},{0x03e12014,0xe951fdc0},{0x0301f013,0x28833bad},{0x02012047,0xf2496871},
+{0x03a1f901,0x2bb6586d},{0x02c169b6,0x616daf48},{0x028e01d6,0x91d08adb},{0x02e14591,0x7432682a},
+{0x02e1f0b5,0xb3fcf2ff},{0x01e02617,0x6c8d86ee},{0x04e0a7c8,0x0f84487a},{0x06a00779,0x632ae28c},
+{0x0361d172,0x21206e46},{0x0441da0f,0xc5841982},{0x02a0a875,0xd2b179f7},{0x03602689,0xab06d143},
+{0x0261b068,0x2c34b859},{0x030012a0,0x553bc600},{0x02401449,0xc04c0834},{0x01e02715,0x65627971},
+{0x02016e97,0xffcf056c},{0x038107a3,0x11d578e9},{0x01a0a271,0xa2a00494},{0x044002d2,0x0e50bd6e},
+{0x0320161a,0x98129e47},{0x04010b7d,0x0f9e4593},{0x0200312f,0xd8881274},{0x0240ff10,0xc718fcdb},
+{0x02c00727,0xada16ce5},{0x05402599,0xd9c678a7},{0x03a01063,0x39f372e6},{0x01c11724,0xbe713a33},
+{0x0341d101,0xa83f38a7},{0x01c00eb3,0xed8a15c3},{0x02201827,0xb444f22d},{0x0580fd07,0x3c1a61a2},
+{0x01e0a986,0x32926cc3},{0x0300054d,0x952a530a},{0x03a119d7,0xce3768f8},{0x03a1d7e4,0xe5b0d7a6},
+{0x028014f5,0xba92c75f},{0x02810a05,0x28286f57},{0x04812057,0x4710599e},{0x024112c8,0x975dd0b8},
+{0x01202651,0x917b5a98},{0x03e18c2f,0x099f3d93},{0x04c1d897,0x949dfbf8},{0x02c16b82,0x8200b1e7},
+{0x0401d748,0xa8cb149c},{0x04602b84,0x67729cc3},{0x04e1d7b0,0xf9a4c211},{0x0361df07,0x117af2ae},
+{0x0341012c,0x3619e0a2},{0x02401218,0x2ceda75a},{0x04404df3,0x9743a79c},{0x03a1d8b0,0x4fd0997d},
+{0x024188f4,0x0f1da4d0},{0x01e00a87,0xef8aec29},{0x03c01fca,0xb1ff5546},{0x04202a23,0x0947126d},
+{0x02802e54,0x8a7467c7},{0x03e1d8b1,0xb664d34b},{0x0260ab2e,0xef9d1f01},{0x0480254c,0x454577d6},
+{0x0281ec75,0xa00ab616},{0x072029aa,0x4b629b3c},{0x02802fb0,0xd1d5c91a},{0x02e1d36e,0xb175df62},
+{0x02000a1a,0x1dfe3b2f},{0x02c132ff,0x574580d2},{0x030024e3,0x5eb6c40e},{0x0481d8d1,0x1efa31fb},
+{0x012033b6,0xd6965cae},{0x02402ea1,0x314a94b8},{0x01c01c22,0x740b2dd0},{0x01e12096,0x88ffed7d},
+{0x05802a8c,0x3c47181f},{0x01e1bc46,0xf4676dd0},{0x01e0a41f,0xef74749b},{0x03e023f7,0x6c1817f1},
+{0x03801dbd,0xb2817cdd},{0x036012d2,0xcc7cb35c},{0x02e12105,0xda15e006},{0x02400195,0x1a701f02},
+{0x02e1340c,0x9bde431c},{0x0481d957,0x227d9983},{0x03000299,0xfcb8b79e},{0x03211fc8,0x6d9801ae},
+{0x0521d03e,0x5a5737c1},{0x01e030a4,0xad3c4202},{0x02802dcc,0xcc6297ee},{0x02e10086,0x34baa922},
+{0x01e11093,0x5f9c05eb},{0x028021da,0x678000b4},{0x01e106fd,0x2ea1d9d6},{0x00e0263f,0xeb4cc3ee},
+{0x05a107b9,0xff7b05b7},{0x03012533,0x51d3e299},{0x01c1141b,0xa21f66f3},{0x02e029b5,0xef71a4be},
+{0x03e0256d,0xd3b2abf0},{0x0181f964,0x1304bade},{0x02e131c3,0x89877d34},{0x03811fc5,0xf5289b86},
+{0x02e1086d,0xf986391d},{0x02c01674,0x9fcb790b},{0x04e027ac,0xf6b8778e},{0x01816a4a,0xf4bdb163},
+{0x01c00bef,0x79488b79},{0x0360fb91,0xea423240},{0x036122c9,0x1658b41c},{0x04001d6d,0x497ebc85},
+{0x02c028e2,0x0d63c497},{0x04a1d0bc,0x4430325c},{0x01e11124,0xc36f2113},{0x03e18bf5,0x9de0e5e1},
+{0x01c16f7d,0xaff31099},{0x02e133e7,0xa474ef85},{0x01c0a198,0xc428c9de},{0x02a00375,0x56af0927},
+{0x04401fea,0xa2c5ddbc},{0x01e16abc,0xb249777c},{0x0261b02a,0x50502c81},{0x01a0a3c2,0xc67b68bb},
+{0x0580fbb1,0x36047178},{0x00c11449,0x076d8380},{0x03c00623,0x1793838f},{0x01a0a56f,0xf71dc6ee},
+{0x024106a5,0xbd7ce2ea},{0x01c0a39f,0x3e88a7f6},{0x024188ca,0x1d132d7e},{0x0460ab54,0xc04a1ed0},
+{0x02a11d14,0x8b8efaad},{0x03c01e35,0x3eb0377c},{0x02a10010,0xa8520ad0},{0x03e1d5fb,0x7505c5bf},
+{0x03400148,0xadf34bc9},{0x0781fba7,0x5011951e},{0x0361f673,0xa8502f48},{0x02a10ac3,0x3ed237ce},
+{0x030024d6,0x4db6a94b},{0x03801465,0xbf79e676},{0x01e00c1b,0xc53ee6b1},{0x02e145c1,0xf528a5e1},
+{0x02e13400,0x93e4f249},{0x04201ee1,0x4431d2d9},{0x04e02b5d,0x2413e19f},{0x0441f154,0xd64f39f3},
+{0x02211048,0x2a7fc4a5},{0x03a1d120,0x6579967f},{0x0320155f,0xab4558a8},{0x01e106f4,0x2a9f94f3},
+{0x02e1688a,0x9adffd03},{0x026e0145,0xa78b3bfd},{0x02402f29,0x85f91858},{0x02601a68,0x0494c55a},
+{0x01e11053,0x7c57df53},{0x0160a498,0x67b7f019},{0x01c110ab,0xec22b05a},{0x0441015d,0x9fa718a8},
+{0x03a1e10c,0xc81455e3},{0x042121c7,0x3fe0b7db},{0x02400975,0x16894133},{0x03810ca5,0x4f072659},
+{0x030114b5,0x36b40f85},{0x02402ea2,0x0b93257e},{0x0360fba3,0x354956dd},{0x0480293e,0x352632e4},
+{0x0221f845,0x5792627b},{0x03200869,0xf77469e4},{0x02c1334d,0xd0bc6146},{0x02c0109a,0xc23bd242},
+{0x03c1d4d7,0x2ae96765},{0x02e10580,0x6241189f},{0x020026f1,0x6ed539cb},{0x04001e0e,0x6d294670},
+{0x02402fba,0xa29ed84a},{0x04001ce6,0x80e3f988},{0x02e144bf,0x0f00b985},{0x0461cf8e,0x0655674c},
+{0x01a03351,0xf4e03499},{0x02601322,0xd8b15107},{0x0101f36f,0xcae65f27},{0x02c168cb,0xdc6d32da},
+{0x01e033ce,0xc7e41606},{0x0500aa70,0xa0c9fb02},{0x01a0a47e,0x3e2ef3d9},{0x03801152,0xa607aeb4},
+{0x01e03152,0x8b6cd879},{0x03e121bc,0xd0bf1f3b},{0x026168cd,0x5e54c296},{0x02a0282a,0xa9a89ef0},
+{0x01c0a147,0xbc5c4e64},{0x0641fb53,0x7927fc0c},{0x03c1d557,0xe2255413},{0x01e11486,0x3f669522},
+{0x01a0a23e,0xdf9b153e},{0x04c0276c,0xe44e4dd8},{0x0741d9b9,0x94d8d547},{0x0260ab12,0x06736809},
+{0x03e18bed,0x0eddc62d},{0x01c0a5d6,0x8a266246},{0x03e1e015,0x2739e03a},{0x0361d1c6,0x99abbe24},
+{0x02e1448a,0x0d0d8252},{0x0620fe43,0xbd1e3c09},{0x02c13280,0x7fab7acb},{0x02211ac5,0x0eac508c},
+{0x034004b5,0x0f79733b},{0x036026e2,0xdac80e82},{0x01801940,0xf7fb19c9},{0x02402ed6,0x00fcd15c},
+{0x02e13275,0x6c6a2c2f},{0x012022a2,0xa443221c},{0x0300a785,0x6e17628b},{0x02a169df,0x0c206300},
+{0x02400935,0x3c69295a},{0x0341053c,0xeac9cdc4},{0x03e0105f,0xcdb70c6c},{0x0280a76a,0x7e5f916a},
+{0x04802c2f,0x21b70350},{0x02c017dc,0xc654954a},{0x0340ff42,0x0be0e521},{0x01a01917,0xc2b39d53},
+{0x02000cb3,0x66a1d54e},{0x030109ae,0x98b5488b},{0x02418808,0x717fb5b6},{0x0201cf82,0xfeaca767},
+{0x03c1e013,0xc5d1ad1b},{0x030121f5,0x9ae7529a},{0x02c13030,0xf41348d6},{0x024189c5,0x9bbe4f0c},
+{0x04a02990,0x26dd3206},{0x02211902,0xd4dcd205},{0x0380fb5c,0x6a442a8d},{0x0581079d,0xe0b3f5d1},
+{0x02211ace,0x5ab1455e},{0x0421da27,0x6b06bbb3},{0x0201f958,0x4461cf4b},{0x0420fd2c,0xe6a81eb6},
+{0x0341d4b4,0xd17c9a1d},{0x0340fb48,0x23f61888},{0x02e13422,0x23d6965f},{0x036169c0,0x958351a7},
+{0x024106a0,0x124e6b8b},{0x0361d188,0x2f18045b},{0x03e0d7ce,0x5baddd41},{0x0260a983,0x990a871c},
+{0x03002e1c,0x070b3d87},{0x04c1d8c2,0x48a413c6},{0x03600dbd,0xfa9d6f82},{0x02601079,0x8b77792d},
+{0x02210b23,0xea2a1bb0},{0x0321d144,0x3290f943},{0x0241f602,0xd8d5bbc2},{0x02c0fd3f,0xe7c7999c},
+{0x0200231e,0xe2d2303e},{0x01e00718,0xf6c61601},{0x0241890c,0x9f187752},{0x0340113c,0x048bfbd2},
+{0x03013232,0xb84ffc40},{0x032168a2,0x6c5b214b},{0x0361e89a,0xfc53c166},{0x02411347,0x7345b494},
+{0x030010a3,0xfb3c10ea},{0x02211900,0xdcdcde9d},{0x028e0180,0x0665a2b1},{0x02a16e99,0xcdeddfe6},
+{0x0561d96a,0x65f82772},{0x0301216c,0xadda1e69},{0x02e0045b,0x85b2e501},{0x02e1d112,0x8776548a},
+{0x02001b60,0xc9bd4c55},{0x02410a21,0x5a0d83c7},{0x01a0a5bf,0xd0e0b55d},{0x01e1f949,0x2b1484f0},
+{0x0340ffa9,0xe19ebb56},{0x02401193,0x0ab7542d},{0x03c1d4e1,0x40e98a07},{0x01a0a042,0x057ecb50},
+{0x0341e00b,0xb36aabd3},{0x02418864,0xfce85f49},{0x02c132e7,0xd44ac2c7},{0x01c0a222,0xc49696e2},
+{0x01811605,0x1022c640},{0x01602255,0x4b9527df},{0x0201f37b,0x274454a8},{0x0321f763,0xdab600c4},
+{0x01e03336,0x763eb3d0},{0x01803312,0x43c13ebf},{0x0101f5d5,0xe3e5703d},{0x01002282,0xcc3cfe36},
+{0x02011171,0xce949d53},{0x04801e78,0x8a92b7d7},{0x02e130d1,0x2c775ee2},{0x0381e8ab,0x7e3869c9},
+{0x010033d0,0xb9ad1449},{0x02e133a2,0x9dbfb7fe},{0x01e00c21,0xb9127500},{0x06c01f9d,0x0d9c18f6},
+{0x02800f2d,0xa37c59de},{0x03e0189e,0x1f99082f},{0x0360ffe8,0x916667af},{0x0480fcb3,0x8bd1dc72},
+{0x0201bc52,0x83efe233},{0x02a019c1,0x132c8a3f},{0x0381f5a2,0x38cf817b},{0x0581cfbc,0x32b6ebfa},
+{0x032168b7,0x39033e50},{0x03e01d1f,0xa723ee64},{0x0221f5c2,0xe6f3bacf},{0x03c0294a,0x2a6feb4e},
+{0x0180a048,0x84866f2a},{0x0541d798,0x770976b7},{0x024188f8,0x1b1db7b4},{0x048032c9,0x7e6433dd},
+{0x02c1321d,0x7686690f},{0x02a1202e,0x0087a67a},{0x04800495,0x3cedad99},{0x0361ee51,0x8f35b666},
+{0x03e1d059,0x103aae78},{0x0361ee87,0xfa7dcef7},{0x02c13153,0xcec3b81a},{0x034022e9,0x2d3c23f1},
+{0x03400368,0x221b58b9},{0x0361ee9a,0xeb1c6691},{0x01a0a5f1,0xcb09f9f2},{0x010033d7,0x94caef1e},
+{0x03410092,0xc85471af},{0x02810881,0x3861425a},{0x01e017e7,0xd3408688},{0x01c0a3ba,0x633ba2e1},
+{0x0361da4e,0xb5dbb81a},{0x024119a2,0x9c0bcb24},{0x0120338d,0xc7964511},{0x036015eb,0x4a855796},
+{0x028012b4,0xbd012f88},{0x036002a7,0x09b20505},{0x0281fa23,0x63c6e8e2},{0x0341135e,0x88d6c4d2},
+{0x02e11a42,0x1119031d},{0x01c0a48b,0x6ac1e6bf},{0x01c0a557,0xf0081b95},{0x03e1d058,0x9dae5b91},
+{0x00e1f373,0xe2a313d7},{0x02c10d31,0xa3f35734},{0x02e1453c,0x7e938ae5},{0x02601233,0x3bb44373},
+{0x02812fee,0x37672e9b},{0x0360fb92,0x2ee21b14},{0x03202ee5,0xecf6fe12},{0x02c132ba,0xf09dd0ec},
+{0x01e1f4f8,0xbe0b98f0},{0x02c00fcf,0x5b6cbf2e},{0x03202a2e,0x4649655a},{0x01e11090,0x79d12e87},
+{0x0401fbc1,0x0f14c286},{0x03216b45,0x364aa85d},{0x02a16a28,0xbf24ca39},{0x040004ee,0xee4af391},
+{0x02404dce,0x5c767e18},{0x04e12453,0xa10cb72b},{0x026122fd,0x5e02e35a},{0x0181170f,0xfc17c37c},
+{0x02a003c3,0x9650718d},{0x02a0093e,0xfd333c7b},{0x0200307a,0x9859b5f1},{0x022013c7,0x59aa14ea},
+{0x042006a8,0x231e97a6},{0x01a02795,0x64cb0271},{0x07e01f8e,0xe8cbd64d},{0x04401d0c,0x334189d8},
+{0x01a0a258,0xad67bd54},{0x01002681,0x34dff57e},{0x02c0a7f3,0xace7ee42},{0x0180a018,0x4258e7a6},
+{0x02a0a86f,0x12f557a8},{0x02a0a7b3,0x43507dab},{0x0581d9a0,0xfa8f4b6b},{0x02a0abf3,0x9c5bbc16},
+{0x03a0010b,0xefca2409},{0x02200d10,0x7215d202},{0x0261b047,0xc4eacdfd},{0x02a16984,0xcd28f216},
+{0x02801560,0x0032940b},{0x03400165,0xdbf795cb},{0x03a0017c,0x90033c3e},{0x02a02a4c,0xed8ec9ce},
+{0x01a11432,0x5346532d},{0x02e1305d,0xa6386996},{0x03010a7d,0x7cb8754c},{0x01e1148e,0x4f48993e},
+{0x02a1f79e,0xfcf9b993},{0x00c1fad5,0x0121c91e},{0x0381f756,0x65db71d4},{0x0281bc84,0x6cb9adf0},
+{0x026124df,0x1bbf23fb},{0x0161f31f,0x10bec024},{0x03000518,0x34c4a1e1},{0x02e02756,0x43b48897},
+{0x01802024,0xb86175ff},{0x0121f372,0x5722b941},{0x0121f196,0x5261322d},{0x02200597,0xfe9a7e5f},
+{0x01e1072b,0x8b6ef47d},{0x0421d5e4,0x4536bb17},{0x01c0a0a6,0x1fec3fc1},{0x0541f82f,0xac51d5a9},
+{0x03400369,0x231b5a4c},{0x026119c8,0x2baba5dc},{0x038120ac,0x7b1ee3b1},{0x02e1696f,0xd08a5ac0},
+{0x01e111a4,0xc120eb1e},{0x06c029ad,0x72286bcc},{0x07c1d9ca,0xe3bdda95},{0x022009c1,0x42473a46},
+{0x02402b26,0x9324657f},{0x03e10b4f,0x0fec6ab4},{0x02a12321,0xd773dbb7},{0x03210b86,0x70b3cf82},
+{0x0441f188,0x5e45a818},{0x02a02e52,0xccd9be1f},{0x01c0a32f,0xea6dcf07},{0x01e0101b,0xf492991d},
+{0x01e114a8,0x7384fc12},{0x05e1d824,0xbe319f3b},{0x01a02017,0x359be208},{0x03e10b70,0xad62185e},
+{0x0460025e,0xb0ae9e61},{0x02e0034f,0x0cb182f3},{0x0481d05f,0x4e9d258d},{0x04e01df2,0x898e21c0},
+{0x0161f5c3,0x622e9b1e},{0x01a0179b,0x4b0bcbf3},{0x0300a86d,0xda192bf3},{0x03a00141,0x6de5d411},
+{0x02200d0f,0x660cc4c2},{0x02400d19,0x2be49cee},{0x0561e8d5,0x82d727fd},{0x01a0a12a,0x8bc3a87a},
+{0x02401403,0xa94be3ff},{0x02e017ad,0xbc3cb032},{0x02a02826,0x3bb0408b},{0x02600a40,0x41952ccf},
+{0x03c1f70f,0x3f4ad4eb},{0x02a1bc12,0x8a209d6c},{0x03e00484,0xf67a4f0b},{0x02a1003c,0xa9817c05},
+{0x03e18b92,0x1fbec317},{0x0260126f,0xaf889b42},{0x02212361,0x39876544},{0x01e0a5a0,0xca0ad41a},
+{0x0261b096,0xebd6c2d9},{0x0101f97f,0xcba5ef25},{0x03801393,0x5aa87261},{0x02202fbc,0x666693ba},
+{0x0121f93c,0x783c54a4},{0x03202de5,0xf65afcb9},{0x02c131a0,0xcd8829a4},{0x06e00880,0x6d1aacb4},
+{0x02600049,0x69152096},{0x03a1240d,0xff67c8d0},{0x03e0106e,0x5575cd0e},{0x026124d7,0x10adc989},
+{0x0361cf92,0xa0230dfd},{0x02a11d7d,0x1dbbdce1},{0x0321e7f3,0xf452ad39},{0x04a0fcd1,0xfad7effa},
+{0x0360161c,0x1ab485e3},{0x02a02dbc,0x7bf844d8},{0x01e0172f,0xd271dced},{0x01e0a34a,0x4e946cd3},
+{0x0381e879,0x50ce262f},{0x0561d92e,0x519cc98f},{0x0321d9fa,0x5c09f0cc},{0x04e01e66,0x630a113c},
+{0x020017c4,0x76b2d21c},{0x03a0fba0,0x3ae9dd82},{0x04002376,0x8950aea4},{0x026104eb,0x28ad0071},
+{0x03211ca4,0xd6c59043},{0x04e1d95b,0xe00b3479},{0x028031b7,0x05981c98},{0x03c0a97c,0x310bcf6b},
+{0x03616b38,0xda182937},{0x03002449,0xd560324b},{0x02c16876,0x3b040608},{0x03416e64,0x5d2dd7e3},
+{0x030168c6,0x70611271},{0x0260141c,0xf88c2d7a},{0x0521d900,0xf0cb8513},{0x0281696a,0xc63ae91b},
+{0x01a0a1cb,0x8b6eec68},{0x01a0a06e,0x750685da},{0x01e02e87,0xd3b1cee3},{0x01e10107,0x86df2bf3},
+{0x0240aaac,0x74ac3168},{0x02418a1b,0xaf3d9506},{0x0141f52c,0xf2b03971},{0x02e1322c,0xd16ebf3a},
+{0x024119aa,0x900bb840},{0x03200487,0xe3317583},{0x04001ef6,0xbd7c9522},{0x02012122,0x74fe7148},
+{0x02a01992,0x8dcee878},{0x0441d18a,0xb8beb5ac},{0x01c0a614,0xd1a8c31d},{0x02c1312f,0x6b208a1b},
+{0x04a1d93a,0xd0cd87a9},{0x038120ff,0xa6a6dfc2},{0x022013c6,0x55aa0e9e},{0x0241cf5c,0x7e9a5d32},
+{0x01a0a6da,0x27116a45},{0x02c00cf1,0x47660a9b},{0x03e02c79,0x37dedd66},{0x0301042f,0x6ac5fa4d},
+{0x04c0fd0d,0x482f8d75},{0x01e0311c,0x88fa0777},{0x036169ad,0xbe02ad79},{0x02402250,0x822d609f},
+{0x02c10d03,0x8733807c},{0x0441cf11,0x815b63ce},{0x03e0252b,0x31d999ea},{0x04400217,0x3e241d74},
+{0x02602fc8,0x2a649d6d},{0x046032c7,0x74e81452},{0x02800890,0x453e7a4d},{0x0200007b,0x5cb5036f},
+{0x02c169b5,0x3ba59964},{0x03a0154f,0x59b0c449},{0x034121c2,0x2fda2596},{0x02e14501,0x85a2a074},
+{0x02801a33,0x5e298ee6},{0x03012039,0x7a86f13c},{0x0301457b,0xf807f7af},{0x0181160b,0x23f148f0},
+{0x03012022,0x3a4bba15},{0x01e0a2f3,0x909a6d4f},{0x0220a6f7,0xbba30998},{0x032168b9,0x83a25ebb},
+{0x01e0a452,0x48dbcc52},{0x02c11d83,0x2efec1b5},{0x036011df,0x81cc0092},{0x02c1f089,0xd5c97de1},
+{0x054029e4,0xaaa48033},{0x03a1252c,0x9120f29b},{0x02600044,0x7615350d},{0x03a02e04,0xfb404f97},
+{0x02400d70,0x9110f5bc},{0x0221005c,0x23b679fe},{0x03401dc1,0x0ffe2d69},{0x026124d9,0x25b4a65d},
+{0x02e00d0b,0x33303895},{0x03e01e0c,0xc24fc3d9},{0x01e106ba,0x32b32943},{0x012033bc,0xd7965e41},
+{0x038002f0,0x45a664fe},{0x04c121f0,0xc0ae4360},{0x03010b87,0x140178e4},{0x0081f996,0x62f2849e},
+{0x04e1d93b,0x487f4ebb},{0x0601cf0c,0xb11d839f},{0x02c1308e,0xac289bff},{0x0301d87b,0xec22fc1c},
+{0x0580fd5c,0xaba5b737},{0x04c0fc4e,0x6604387b},{0x0301f03d,0xcc65b491},{0x02202467,0x5432b3a3},
+{0x02e144b7,0x8b03bb50},{0x022025f8,0x76bf8c6e},{0x01a0195c,0x0db8d01b},{0x0261b0aa,0x1c64232e},
+{0x02e13353,0x0badbbb4},{0x02418acf,0xe51b87be},{0x0401ed34,0xdbdd91f2},{0x02000c55,0x4275110c},
+{0x0441fa0e,0x8666dec7},{0x03a0014c,0x50b255ba},{0x04c01d97,0x7236a50b},{0x02010337,0x2780cfbf},
+{0x03411c34,0xb5b3d04b},{0x02412148,0xd13337f6},{0x0421d785,0xf3621966},{0x0360207e,0x44321c2d},
+{0x03210431,0x129f8eeb},{0x028e01cd,0x94d2ce2b},{0x00c022c8,0xda46616b},{0x0261d10a,0x3a3fef8b},
+{0x02e144cb,0x0afe74a2},{0x02810004,0xad74c5b8},{0x02c133d0,0xf61bf537},{0x01e0a05b,0xd74963b3},
+{0x03a01ee5,0xcc1abef7},{0x02010fe5,0x6ae6c466},{0x02411406,0x7f9ea329},{0x03012367,0x7e6df4c2},
+{0x01c01786,0x5a59c14c},{0x01e00c18,0x4217b1dd},{0x0301f928,0x655437fb},{0x04002c69,0x7f1049c9},
+{0x0321aff6,0x98342262},{0x05601ea9,0x87e5cb22},{0x0440027a,0x82892a6e},{0x02a0a76e,0x4a61d1d1},
+{0x0381e878,0xf43501c8},{0x02e13220,0xd471028a},{0x03a1f709,0x1e8c5a42},{0x0420ab56,0xf0359f92},
+{0x0561d154,0x095db17a},{0x030109c1,0xa928acdd},{0x02a0fb25,0xb38ea480},{0x03a024f2,0x8f6b8f72},
+{0x03210a71,0xf0aacfbb},{0x04a1d8a8,0xedcd10c5},{0x02e12341,0x478d775b},{0x02c132f4,0x53433bef},
+{0x02211a51,0x2198170a},{0x0280155a,0xdbab03e4},{0x03e10b9a,0xb2f10129},{0x0301008b,0xa6bc1cec},
+{0x02611910,0x7e132bcc},{0x02c1da7c,0xcb20f086},{0x02e1f30f,0x631d725c},{0x026114c4,0xb1066714},
+{0x01a16f28,0xa2539fe3},{0x0140220e,0xae8f7563},{0x03a11d36,0x8b36e04d},{0x02c00584,0x507412db},
+{0x032027f9,0x8a91bd1c},{0x02c01d51,0xbf15f04d},{0x0201129f,0xd0657dd8},{0x02601315,0x18b803c1},
+{0x01a0a3d3,0xfe7de77e},{0x01e10725,0x89712fee},{0x02c11d57,0x14c1c21a},{0x00e02be4,0x6536a2ac},
+{0x034169e8,0xe0fcef56},{0x0241890f,0xa416409a},{0x0300a680,0x8d49847c},{0x01a022bf,0x3d482185},
+{0x05610167,0x372e5f2e},{0x01e11310,0xf2b31e04},{0x026124fd,0x5631b1e4},{0x02011120,0x101d9408},
+{0x034015ea,0xf767df97},{0x024010e6,0x147a9d8f},{0x02402d45,0xe6bad594},{0x01c1181c,0xc296c357},
+{0x0161f39a,0xefaed5b4},{0x032010b5,0x969a4301},{0x0240130e,0x1f059636},{0x02a01111,0x0d14a6a3},
+{0x03010143,0x31285718},{0x03002148,0xa510430e},{0x02e00f3a,0x70670c26},{0x028e01ee,0x99dfa1fd},
+{0x0501fbbe,0x4512cfd7},{0x03c1d74b,0x87d4b02c},{0x01e106cd,0xafbaa9cf},{0x02010fec,0x252a3abe},
+{0x022005a3,0x38598991},{0x03c0256e,0x7000879f},{0x0201f31d,0x5a933eb8},{0x01e0265b,0x7c297616},
+{0x02402058,0xd20633c0},{0x04c004b1,0x44aaf4e8},{0x022114b9,0x7620da03},{0x01a1f956,0xaab4273c},
+{0x0340036d,0x331b737c},{0x0301f5ab,0x78c78b00},{0x0200061c,0x46735c8c},{0x02602f85,0x90bbf290},
+{0x0180196b,0xd0a130d1},{0x034101d0,0xb8155887},{0x01e1e2eb,0xe74ef3af},{0x02c1f83d,0x7d3080a3},
+{0x01a0a606,0x27084c2f},{0x0180a0b7,0x5a5251a9},{0x02600927,0xf4da9b52},{0x022114d3,0x2012730f},
+{0x02810f0a,0x302aa359},{0x03a01cea,0xc5e7b0a0},{0x0481da70,0xc24d9f74},{0x042124cd,0x2466fc9f},
+{0x02401585,0xc14c09c7},{0x01c02654,0xf85e3c49},{0x026110f6,0x010c9be4},{0x01a01bc2,0x36b10c3b},
+{0x02c10d01,0xc2fdc4f6},{0x02202f3e,0x3e8d994d},{0x02600617,0x12a9d4da},{0x0340ff53,0xfae0ca5e},
+{0x0361d50f,0x0dbc4cb4},{0x0180a10f,0xa4688c76},{0x02418a49,0x41477538},{0x0360236b,0x9b5a8068},
+{0x020013b1,0x9c0f75e6},{0x0261d877,0x057eb8a5},{0x01e0062d,0x9f05206a},{0x0260092b,0x2aadbc66},
+{0x020030d8,0x18dec070},{0x02800d8c,0x5b3b9e9c},{0x00e1f9c1,0x5c8698bb},{0x01c00eb5,0x319e0887},
+{0x0281b0d6,0xc5655903},{0x01602b58,0xe332d244},{0x02a0ab7a,0x1f4783ea},{0x02400a22,0xe0ae7cbc},
+{0x01a0a27a,0xda9bdf8e},{0x01a10288,0xfcee0ba5},{0x04e109ed,0x765b8ff3},{0x02c13273,0x7ea93aa1},
+{0x02e145d0,0x78f2222e},{0x02c017f3,0xfff49507},{0x02611d62,0x53e83969},{0x0601fb69,0xd13f083c},
+{0x0200a995,0x1a9a6240},{0x0181f374,0x1ccda133},{0x02816815,0x79d890f6},{0x02e1d32f,0x5a296d91},
+{0x03802e2b,0x20a77a3a},{0x0481d887,0x36953118},{0x0641d7c3,0x6c6c9574},{0x03e18b36,0x9bd78b31},
+{0x02412037,0xfe5460f1},{0x0241896d,0xa38ad9bc},{0x03810985,0x85f58050},{0x03601651,0xbbf74b4b},
+{0x01a10293,0x02ee1517},{0x00e1f690,0x58b3771c},{0x02e14543,0x859395ea},{0x020030b0,0x58e163c7},
+{0x0280a808,0x751f945a},{0x02418a3c,0x463ab124},{0x0540fdb1,0x10423324},{0x0200a92c,0x0a745a04},
+{0x0400255c,0xb150691b},{0x0321e7f2,0x740ec000},{0x0261191c,0xa81f03e9},{0x01c0a35b,0x15649e04},
+{0x03202dee,0xf2748e53},{0x03a120cb,0x32016816},{0x03e021b3,0x4dc3b89b},{0x0200176b,0x44c13476},
+{0x02000cb7,0xb0f3fc70},{0x0241888d,0x01ddd9cc},{0x034027cb,0x86885690},{0x030006bc,0x78205871},
+{0x04a0fc37,0x85714b59},{0x02c131cd,0x4bfa94c9},{0x028169dc,0xd3ef9a7b},{0x03410530,0x7ec336a0},
+{0x028e015e,0x8671a524},{0x0480fc2e,0x295fb6c9},{0x01c11fed,0x723c852b},{0x03e18b3f,0xcbd7d6c1},
+{0x034015ac,0x029c9d6a},{0x0480fcdd,0xce142bc4},{0x02c019a7,0x66f9c1e2},{0x02418958,0x3285aaab},
+{0x02200f7a,0xc21f1575},{0x03210a98,0xc75f32fd},{0x03402a62,0xb69531ab},{0x03e18cb6,0x7889c8d3},
+{0x02c01b45,0x6a4f98e1},{0x01c1d18e,0xc746d935},{0x03402e5c,0xfdd8f1a5},{0x022005dc,0x07f4ba45},
+{0x03001d53,0x19a3b12c},{0x0260091d,0x928124d8},{0x02016ae1,0x9aba464d},{0x01a11450,0xb18674b3},
+{0x02c04dc8,0x64c78902},{0x0241884e,0xf18bb829},{0x03e1f449,0x58bbbdf4},{0x022013dc,0x44d792c4},
+{0x03e008a3,0x0c4bbe2d},{0x01800e51,0xdde8e728},{0x04e01ed7,0x189eda56},{0x02211ac1,0x4ad17fd9},
+{0x0481da24,0xf67fbe72},{0x00a1f45d,0xf102ec84},{0x0361e8a8,0x4c303d2b},{0x03e1d5fc,0x7405c42c},
+{0x03010a63,0xe21528fe},{0x02000729,0xc77dfe4e},{0x02a01b7e,0x6eea4f8b},{0x03e02928,0x6fa93fb2},
+{0x03e1d73b,0x0a3c9347},{0x02602f04,0x326da7a9},{0x02e028ab,0x79d33af3},{0x01c01cd1,0x42948faf},
+{0x0081f9b6,0x6aa28f99},{0x0561d7a8,0xb314d7af},{0x03001cdc,0x8134327f},{0x03a003f9,0x40a4bd23},
+{0x0420fc7d,0xce7d7767},{0x02a1f566,0xa77c30e9},{0x04401cb8,0x2ee710ee},{0x02e017f5,0xc8d97631},
+{0x0421d09d,0xcb90d0ce},{0x0480fd08,0x74d82270},{0x01c11694,0x315a51ed},{0x0401ee74,0x84b0e270},
+{0x02a0a8bf,0x538bbfef},{0x02e109a8,0x4dc82e4a},{0x04a1d662,0x3b1b0dc2},{0x04a0fcaf,0xd1f3e211},
+{0x02e00b44,0x14b1b81c},{0x0421d234,0xcd77f6ee},{0x02418802,0x777fbf28},{0x02210833,0xd5e31b65},
+{0x026121a8,0xb6f997f2},{0x030120e0,0xda85aae5},{0x0381d4f7,0xc6cf9752},{0x04a01f33,0x2b22274d},
+{0x02c0a681,0xc4d2d879},{0x020121af,0x697e214d},{0x0241892f,0xa17bcc0c},{0x02801cf5,0x07e67cda},
+{0x02e16b24,0x43d131eb},{0x05c1fb4b,0xdd69790f},{0x03010d37,0x2d461255},{0x02811d27,0x2184d183},
+{0x01c1100a,0x3a914540},{0x00a02333,0x3fe20128},{0x01603322,0xf605c9df},{0x022111d8,0xd085b3df},
+{0x0301d459,0xb2ca1384},{0x03200fa0,0x7f85be88},{0x01c16f2b,0x833f85f0},{0x0161f610,0x96e40119},
+{0x0221080f,0xf9cd8dc2},{0x0260327e,0xd37c00f7},{0x02e02ab6,0x2e05dcf7},{0x01a0a26e,0xd28cc86c},
+{0x01a0aa21,0x91857247},{0x02212336,0x5c5ce907},{0x0380ab32,0x74ace81e},{0x03e18c3d,0x659d8fd0},
+{0x01a01796,0x6ada6187},{0x0260156a,0x0ba68ee0},{0x028017c9,0xf6e70b56},{0x02e14473,0x110fc735},
+{0x05a02571,0x9e63d9d9},{0x01a0a295,0x973ea27a},{0x01a00b9a,0xa92af21c},{0x01e1069c,0xc6328214},
+{0x01c0a548,0xaaa521bd},{0x034118be,0xc37ec52f},{0x020017c7,0x5a98d8a6},{0x02c01bc1,0x8d4ea1f8},
+{0x01c01be0,0xbc31e198},{0x0621d859,0xb837ddcf},{0x02804dd8,0xf6ad56ad},{0x02202d4d,0x1d0a9f41},
+{0x01c0a0e9,0x28b2c177},{0x02c1f835,0x146a837d},{0x036018ef,0xb51c36ef},{0x01a0195e,0x41b311c9},
+{0x0141f430,0xcd92707c},{0x010e0020,0xd30d3f9f},{0x0181e29f,0x36893c0c},{0x07401f96,0x0576cdde},
+{0x02e1443a,0x1c70eb83},{0x02e028ba,0x3863212f},{0x02c1301b,0xf52254f3},{0x02202316,0xe79e816f},
+{0x02e14621,0x69de82d9},{0x03e02b71,0x60160e61},{0x01a0203b,0x1acfccf3},{0x02202f5b,0x10295c13},
+{0x02200a25,0x80b9ca8e},{0x03402097,0x1dcc141b},{0x03216b6d,0x522593ef},{0x01a0a1c2,0x9b77fff4},
+{0x02210e6f,0x7a38b637},{0x01e16f12,0x045afa88},{0x02c016eb,0xda111a02},{0x01802acf,0x8f4458f3},
+{0x01c1f90c,0x3f037804},{0x01c0a0a2,0x1c043e5b},{0x01e114a9,0x6b73a659},{0x02c13301,0xcf3deef5},
+{0x02400ebc,0x736df06e},{0x02418a82,0xc0a475c6},{0x0280aae2,0xc9b8bc75},{0x0201010f,0x6c1e36f1},
+{0x01e1f942,0x86df5e62},{0x0361e83b,0xd45d0d57},{0x02201bba,0x4e4c6422},{0x01e1e958,0xb5204466},
+{0x03800fd9,0x263391dd},{0x00e1f945,0x25a27af9},{0x01e16a8b,0x89d853b7},{0x02616e98,0x8a158188},
+{0x01c0aa0d,0x7be8ad20},{0x02601250,0x33137ed8},{0x0200a9d1,0xdbcb2017},{0x0341d7d1,0x6cbc95b5},
+{0x034028ff,0x3aa24a88},{0x0241883f,0xfa8e04eb},{0x0301f044,0x4bce4b40},{0x02601298,0x2cb8acb0},
+{0x0481fa0d,0xbdc45070},{0x03c1ee3b,0x25d880fc},{0x02e0ab6b,0x76676a8f},{0x03600322,0x8b7ac8ec},
+{0x0580fd95,0x37a3f027},{0x01e10676,0x4c2b0641},{0x02e02ab5,0xf8ebb039},{0x02601204,0xf76ef90e},
+{0x03211a26,0x567d5abf},{0x0180a1c1,0x7e54c8ec},{0x03a1d588,0xe4917851},{0x0320ff90,0xd87d3764},
+{0x01e00642,0xadb089a7},{0x028169b7,0x2f716335},{0x0381ee35,0xc833d808},{0x0121f969,0x1af68249},
+{0x0260326f,0x5caf4eac},{0x04801e13,0x4a5a86cf},{0x02c1d427,0xd397dc85},{0x04016ff0,0x062eaf2d},
+{0x024122be,0x45fa984e},{0x0360165c,0x22b59b1e},{0x02e0ffd5,0x9f910ba5},{0x03c0323f,0xe35a7f79},
+{0x01a16f44,0x4193c682},{0x03e02515,0x3ce2e9c8},{0x03812439,0x5349e735},{0x024016ca,0xc7309416},
+{0x036006b6,0x37d06d4d},{0x02c005c0,0x78951ba4},{0x02a16b63,0xde52d7f7},{0x02418884,0x92e579d4},
+{0x0220a9c5,0x61422f3e},{0x0421d233,0xc877ef0f},{0x02400c84,0x8c105f14},{0x044004b3,0x674e6179},
+{0x0200a9a5,0x4a6b4f9b},{0x0241133e,0x8750616c},{0x02c10b84,0x7fcfaf78},{0x02802d96,0x6efe3aba},
+{0x02c02687,0xced2be24},{0x03e18bbb,0xc6ea20c8},{0x01e1111b,0x4c5ac60a},{0x0160334f,0xccd4a926},
+{0x02c1b11d,0x9bf90220},{0x01c02eca,0xc78d901d},{0x0301447f,0x13c9d135},{0x0460251f,0x66590af0},
+{0x02010639,0x2223f01e},{0x0081fab5,0x871c4da8},{0x022104a8,0xe05e6fcf},{0x0581fb91,0x60d1e2fc},
+{0x02a02c9a,0x51b39858},{0x02801432,0x8134b38a},{0x0341f51a,0xdb8d4100},{0x01a0a2bb,0xcf469d08},
+{0x0201fb32,0x8abcc5ec},{0x03211c9f,0x35740f89},{0x02c1d42d,0xe997ff27},{0x01c0a176,0x6a1901ae},
+{0x02c130fe,0xd616a530},{0x034000f2,0xbf915626},{0x02e028cd,0x69756e1b},{0x0721d835,0xdefd73e9},
+{0x03416e5e,0x94bd593d},{0x03e01ea0,0xa2354b86},{0x0281694d,0x18fa32c4},{0x03400161,0x1e2e737c},
+{0x02e028ec,0xefefc58c},{0x0521d150,0xec849f89},{0x02e1322d,0xd26ec0cd},{0x03e01e62,0xce8c1494},
+{0x0301f04d,0x739fb929},{0x01e00ede,0x965b8cc8},{0x0321d527,0x16a186d7},{0x02e1323e,0x6072300f},
+{0x0280115f,0x8cf327c4},{0x02a101e5,0xe92426f3},{0x028e016d,0x736acb76},{0x04001070,0xedcb69c0},
+{0x02410a23,0x56258261},{0x01a0a191,0x803c657e},{0x01e00994,0xdf3b8057},{0x01e10711,0xf6650f92},
+{0x0521d0b6,0x50d0db8c},{0x02c16b33,0xc80256f7},{0x03801dd9,0xf9ee71db},{0x0461fa10,0x2ab54ea5},
+{0x02e1454d,0x8995dacd},{0x028018b7,0xd449a816},{0x01c11229,0xe70964e7},{0x032111bb,0x7ffcb892},
+{0x02011128,0xfef0b0cf},{0x02c0073c,0x32e8dbbc},{0x03e18cb4,0x7a89cbf9},{0x02602061,0x19fcd991},
+{0x02418a14,0xae30c780},{0x022010f0,0xeba98f43},{0x02c00f7e,0x4fecff38},{0x02418842,0xfb8e067e},
+{0x026e0104,0xa49a41ce},{0x030114b7,0x48b42bdb},{0x06a02ff9,0x1def3725},{0x06201f88,0x6e5bfbbf},
+{0x0481da02,0x9b27939c},{0x02c01d2e,0xa8e7e7f6},{0x03a0fa77,0x333b8041},{0x0300a643,0x9d42d919},
+{0x024005a5,0xddfd02da},{0x03001d14,0xbd5b9bea},{0x02c1303e,0xf5158900},{0x02a01545,0xbfe8eb2b},
+{0x042006b7,0x12c96898},{0x0241fa04,0x794cf095},{0x02e028ae,0x16886087},{0x03401d06,0x0e64e363},
+{0x020030b8,0x68b21ec2},{0x01a00a71,0xc8e8b6c2},{0x028003b6,0xff631644},{0x024189b1,0x9fcd5fe2},
+{0x020016b2,0x585e4e34},{0x030021a0,0x529a58e6},{0x03002416,0x20dcb23f},{0x00a0264d,0xa6e47844},
+{0x036015de,0x38e99923},{0x03200838,0xdba475c3},{0x02a0066d,0x88c21c0c},{0x03e18bf0,0xa0e0ea9a},
+{0x01e111aa,0xe154f8e1},{0x0320ff8a,0x1470c9e5},{0x0161f6d5,0x54946fd6},{0x02e12134,0xf4c82d04},
+{0x01c0a256,0xfa4e8700},{0x028e019d,0x076365ad},{0x0320a667,0x906d7549},{0x03010f75,0x6af0904f},
+{0x02c00340,0x62e27b5b},{0x02602b0a,0x87f06dc7},{0x04c1d00d,0xe523980e},{0x02c0220c,0x18847059},
+{0x02200a6a,0x0c3b2dc8},{0x04010b40,0x7de7bb0f},{0x032008fa,0x428b53c1},{0x01a0a27f,0x96aa7f0c},
+{0x01a031cc,0xa2f51b2f},{0x0320ff97,0xd8a8186b},{0x0300fb87,0x13d9a97c},{0x04e033ef,0x265fcec1},
+{0x0281e936,0x3ac404e6},{0x03e01069,0x0d11b681},{0x02a1683f,0x26562820},{0x02e11065,0x36e71af7},
+{0x0260133a,0xb87d4344},{0x01c02e98,0xc422bce4},{0x02a1171a,0xbde0cdf3},{0x0360fb5f,0x29cf52d1},
+{0x0661fb52,0x31faf4dd},{0x0161140c,0x80e2602d},{0x03801d6a,0xd5788063},{0x03411ca3,0xaed8c9c8},
+{0x01a11741,0xbbfe2f77},{0x0361d511,0x0fbc4fda},{0x02e1685e,0x23fbad35},{0x026012ba,0xf317b2ee},
+{0x01c11282,0x03fc706a},{0x02202f76,0xd126fa74},{0x03401652,0xeb6e8878},{0x02a1f55a,0xdfdf0dbc},
+{0x02e133e9,0x9e74e613},{0x02a0317d,0xd25cbdd5},{0x02e028f8,0x979a50f8},{0x02418a6e,0xc8a8ff8c},
+{0x02a0ab85,0xf92d049b},{0x030003f5,0x1f2720bc},{0x02e02a29,0x15051282},{0x03a1d67c,0xdd588727},
+{0x02c1e8cd,0x0254bead},{0x03401c87,0x5bf7e152},{0x01e026b8,0xde756c91},{0x01600e81,0x7d64a021},
+{0x022114b1,0x8220ece7},{0x028119cc,0xfb776fc6},{0x01a0a53d,0x3700169a},{0x02202d3c,0x130a8f83},
+{0x01c1183a,0x41abaf62},{0x0081f48f,0x87aed7b7},{0x030010c4,0x8c378dd4},{0x02212076,0x339486b0},
+{0x02e104cb,0x22875a25},{0x0201f3c8,0x720b744a},{0x02411c20,0xf76ea481},{0x0380014e,0x80fcee9a},
+{0x03802c5c,0xddf3d1dd},{0x032100e3,0xcf67f90a},{0x01e005bf,0x85d6c954},{0x0441f162,0xec4f5c95},
+{0x0300feca,0x13b8476f},{0x02201713,0x1b7066d3},{0x01c1f911,0x580d56cf},{0x03402b19,0x4811c268},
+{0x05e0fbef,0xa3e04e73},{0x0341f4a0,0x2d088582},{0x0320fee6,0x5352feaf},{0x0381ec8a,0x1c7e4c37},
+{0x0361e126,0x2ce6e932},{0x02e0a7b6,0x011c314a},{0x0480fcd8,0x51537fb1},{0x03601578,0xe5b33f8c},
+{0x02401272,0x2125ed07},{0x03202412,0x96808c5b},{0x032001b0,0x31805b9e},{0x0341e85c,0x63b0a63e},
+{0x02e1440c,0xb47ad527},{0x0381d4f4,0xc3cf9299},{0x030009e2,0x3c400d8c},{0x03000461,0x79b4f572},
+{0x026100d5,0x9698930e},{0x020013f0,0xe834be63},{0x0341d49c,0xd97ca6b5},{0x02a1ec77,0xd3dca5db},
+{0x03a01497,0x61d10fa4},{0x0320fb6d,0x1a8a80fe},{0x05400356,0x92e68ca8},{0x02610f1a,0x3cfff0bf},
+{0x01e1039c,0x313fb1de},{0x02816850,0x014270a6},{0x02c00fc6,0x6581bb01},{0x0261b06c,0x28ef8f1c},
+{0x0481d0a1,0x78f66356},{0x02e124a6,0x61ceafe1},{0x03a1d1df,0xcf6f4187},{0x02402982,0x4841f2f6},
+{0x04e01cbf,0xfa078337},{0x01e02670,0x6f9aff7d},{0x0381d703,0x670cccf4},{0x02600591,0x8aec80fb},
+{0x020029b0,0x1113ff70},{0x0280abc3,0xd244fadd},{0x01c02abb,0x3686d0ff},{0x028002e1,0x648c76b1},
+{0x02c133c3,0x9a15ee8a},{0x02c008de,0x9941797c},{0x01e11a72,0xf8749640},{0x01e00b4d,0x356f4f1a},
+{0x0220070a,0x69fcbe1c},{0x0220318d,0x89ec0250},{0x01a0a0c6,0xe078848f},{0x02c1339b,0x21be1869},
+{0x01c1f3d8,0xed375df4},{0x0361d882,0x5336a9a1},{0x01c16a71,0xceddd78b},{0x07a1d9eb,0x38ccb258},
+{0x01a00ba4,0x40f1f5d3},{0x0180aa25,0x1f4d5489},{0x06212267,0x585340ce},{0x04002b4a,0xbdf5c828},
+{0x0661d834,0xc62f6dc8},{0x0260122b,0xc6d34b54},{0x02604dc9,0x2d62d7bd},{0x02a10034,0x7650321d},
+{0x02401a66,0x1388d5f3},{0x0281bc64,0x95571c4b},{0x024112f4,0xc6aafb5a},{0x05e1d9d3,0xb237c83e},
+{0x03202a55,0x5bcde9e2},{0x0521f12a,0xafdbeaac},{0x0380d7dd,0x5a1fa98b},{0x03c0319e,0x5e2ec5b6},
+{0x0520fdb2,0x56725170},{0x02200d1a,0x461b9cec},{0x04a01f64,0xa9811470},{0x032100de,0xe3d8360d},
+{0x0261f560,0x646b75ac},{0x02c16a0d,0xa23f7351},{0x01e0a42b,0x70c68750},{0x0220216c,0x0909b8b6},
+{0x02e1252e,0x3b73b1e6},{0x02616b08,0xc2afea88},{0x030024e6,0x5db6c27b},{0x03a02573,0xa427e958},
+{0x0460fd3b,0x366b83a1},{0x01a03157,0x5c0ea325},{0x02202139,0x58fc2288},{0x03416914,0x71c4280e},
+{0x03c1ec9c,0x3416bcc6},{0x02210825,0xd5dc5fa0},{0x05a1d931,0x150ffefd},{0x03012298,0xd7ec15f4},
+{0x03e011d9,0x3802849a},{0x03801668,0xdab69172},{0x02c1317b,0x40cd65ec},{0x02e1218b,0x626726ce},
+{0x03e0a64e,0xdda5cd45},{0x0541d7c6,0x8e50e8f7},{0x026104f2,0x35ca84d3},{0x01c10522,0xe60ba860},
+{0x02a02471,0xde42a1f7},{0x0301d45c,0xb5ca183d},{0x03c1d473,0xf62307ce},{0x02a1e7e4,0xacac90c5},
+{0x0381d087,0x9e242097},{0x01e01a3e,0x85c1d279},{0x0580fd70,0x883d2a83},{0x04001d0e,0xd91f5af0},
+{0x03401c82,0x2cb3ac71},{0x02418968,0xa28ad829},{0x03a10a54,0x17bddede},{0x02e144d4,0x1a235d18},
+{0x01c0a239,0x170a2cbc},{0x0441f159,0xe34f4e6a},{0x0301251c,0x4580e9f4},{0x02e145ae,0xfb2aedea},
+{0x02000a88,0x77b21b20},{0x02802809,0x0f8dbff5},{0x02211ac6,0x26b570b0},{0x01c0231d,0x35656a0f},
+{0x03e18b0c,0xdecfa5e5},{0x02000600,0x91c21755},{0x024189cd,0x2bc5ed81},{0x04011664,0xcf98e4b1},
+{0x02e14430,0x1d6eae7f},{0x0441016e,0xee7b338f},{0x01c02ebc,0xa02ced7e},{0x02c1e8c9,0x211b4a70},
+{0x02000c96,0x485cdb0b},{0x0180a49a,0x4449905a},{0x0301f0a3,0x0f608916},{0x024188cc,0x1f1330a4},
+{0x04a002f6,0x03d6eeaa},{0x02816e8a,0xe9c63fe3},{0x02a013f9,0x4511a5c2},{0x02e14582,0x7334a52e},
+{0x00a1f35e,0x9a2ccec5},{0x032111b9,0x4200d426},{0x028104c1,0xe4de1e07},{0x0561d7ae,0xcd3c48fb},
+{0x01a029bf,0x449a654f},{0x02a1e8ca,0x2394fb44},{0x020031bc,0x919efbfe},{0x01c0a071,0xc1443518},
+{0x0561166c,0x1e4cc4ac},{0x0201116e,0xe69dbd77},{0x02a0aba0,0x3f29a136},{0x00e1fab6,0x80901808},
+{0x03a16840,0x8afdddb1},{0x02e14605,0x75fee968},{0x02410a41,0x90712299},{0x03a014b9,0x23143092},
+{0x0261d309,0x4f2161aa},{0x0240102c,0xce3852d6},{0x02e109b5,0x75b113f3},{0x02e109a7,0x61a7fa1b},
+{0x03200899,0xbfc101ea},{0x0341e884,0xbbc8a8e7},{0x0481f605,0x878e3a4d},{0x02802bce,0x84f2664a},
+{0x0440025f,0x524ff1bc},{0x04801e71,0x6e1e205f},{0x038100c4,0xebc32b11},{0x02c133f5,0x18760e96},
+{0x0340ffb1,0xf2edc81c},{0x02012195,0x75601f1d},{0x01402242,0x98a37757},{0x0660fef9,0xd1e4659d},
+{0x02418a78,0xc8a6c0f5},{0x02010468,0xdb7fb8ad},{0x0220006a,0x1b575186},{0x02c13004,0x871d2a9b},
+{0x0160aa01,0x71c2b09b},{0x01c0a349,0xc177a180},{0x03812459,0x60a88c8b},{0x04611fd4,0xfeec49e9},
+{0x0261b045,0xbeeac48b},{0x02203148,0xa7d6813f},{0x03211a06,0x0a39859b},{0x02a10891,0x1bf769f3},
+{0x0101f94e,0xbaf05714},{0x02616b6a,0xdf40967c},{0x03c1099e,0x7a4775bf},{0x02e1da15,0x5955b236},
+{0x0240121e,0x1eed9150},{0x0220a882,0xf7bfd062},{0x00a1f9b7,0xedb73015},{0x036120d9,0x573187ff},
+{0x0320a690,0x88e5988d},{0x038022e3,0x0f919377},{0x01c116a7,0x159100a4},{0x02418a36,0x42386c41},
+{0x01e1113f,0xd7fefa41},{0x0560275d,0x67fe994d},{0x00c02000,0x1290c5b9},{0x01c0a2ea,0xc1da2822},
+{0x02e16b3d,0xabd106a7},{0x01c0179d,0xeab2219c},{0x02e13425,0x24d697f2},{0x0381ec89,0x51ed95b5},
+{0x03801f21,0x9f030e40},{0x02418ae9,0x670d49da},{0x03e02cf2,0x01cf619f},{0x03c02c68,0x5e627a19},
+{0x01e10708,0xf867514f},{0x0181f3dd,0x147bc201},{0x02401309,0x15058678},{0x03801d2b,0xbcfd6d4c},
+{0x02c10594,0xc6d841e9},{0x0261b078,0xbf2f8f94},{0x02601221,0x4ff748dc},{0x030025c5,0x55a66af2},
+{0x01a11625,0x0e0e413b},{0x02a018e3,0xa9c21bf0},{0x01e1bc02,0xed6762cb},{0x0141e947,0xb0cbcf89},
+{0x0260120c,0x4c326a8a},{0x02000589,0xb26aad53},{0x06e1219e,0x689f9900},{0x01c0a1e9,0xfa8f501c},
+{0x03e10b41,0xbe36c2dc},{0x03610843,0x3096312c},{0x03c1ed19,0x0a03a0e0},{0x05a0fbf7,0xf289e1f9},
+{0x032100f4,0xc16365d2},{0x02000a6c,0xf5c049f4},{0x02012334,0x9a6a3e05},{0x034000f1,0x4c921ab8},
+{0x0241881f,0x7e8208c4},{0x02e144a7,0x97060ccb},{0x020022b2,0x6b6a7196},{0x0341e860,0x87050715},
+{0x02e13282,0xe0f0397b},{0x01c0210b,0xc8875466},{0x02c01ac8,0xe7056525},{0x01a0a0b6,0x2096fe63},
+{0x04001bac,0x08c8e848},{0x07e01faf,0x5d4c13c9},{0x022032dd,0x6b1ba749},{0x03610c9c,0x86d96d53},
+{0x0581fb92,0x9e1d5782},{0x01c02005,0xb6783854},{0x02a1da50,0x2662e70e},{0x02003079,0x742c5da7},
+{0x02601360,0x590c3b2a},{0x03a0fad4,0xa17c7793},{0x04c0063f,0xe3e27d4d},{0x04a0fc18,0x0992ad10},
+{0x0281bc97,0x4360f100},{0x01e01010,0x40978def},{0x02e16830,0x22a44c37},{0x02811c42,0x5f859c29},
+{0x01a00bb5,0x8cf6eaa5},{0x03210c46,0xc56ef16a},{0x0320ff8d,0x1070c399},{0x02e10417,0x8a8d649e},
+{0x04e1d0cd,0xcf741a12},{0x02e017db,0x7464c945},{0x0561f813,0x947ff0b6},{0x02418ab9,0xc997b7fe},
+{0x0180a208,0x8443893d},{0x03212377,0x4a988a86},{0x02a105a0,0x53fa3a54},{0x02011836,0xd7a8330a},
+{0x02c1ec7c,0x207751b2},{0x02418960,0xb888bc34},{0x03e00f18,0xb6faea7c},{0x0101f5ce,0x35170554},
+{0x01e1fb14,0xac61a0e3},{0x02e1d361,0xc54d28e6},{0x01e026a3,0x6790f198},{0x01e11484,0x9b5c989a},
+{0x026022ea,0x5a8df7c1},{0x01e1159f,0xb13d2362},{0x0261b03e,0xadd72210},{0x03801475,0x0a27f059},
+{0x0341f132,0xee00f5b1},{0x03e1085d,0x06daf879},{0x04a01da9,0x849b9a27},{0x03010c28,0x9cc65f17},
+{0x01c02ad0,0xd33e18dc},{0x02a10033,0x2a0a9aa3},{0x01003386,0x6cb06ca9},{0x0361d91b,0x74da41fe},
+{0x0381d4f1,0xc0cf8de0},{0x032002df,0xe3be4fc6},{0x0321fb99,0x57d4db27},{0x0241d191,0x8a91fed3},
+{0x02e13407,0xa6de546d},{0x02c0abac,0xa6f33fd7},{0x02c1332e,0x010f8ee7},{0x02602128,0x75f52a7a},
+{0x02c109a3,0xcd97b1b5},{0x02e10096,0x6c3c0370},{0x02a10e75,0x4f3d5e1d},{0x0440fc7b,0x05536ea1},
+{0x0220227c,0xf4b4d650},{0x03c00835,0xbf5aca6f},{0x01e01c76,0xc0913885},{0x02a02c95,0x46404e59},
+{0x0281f556,0xc7a850f4},{0x022026a5,0x6f6a35e4},{0x01a0a5a2,0xdb0a1322},{0x04e1d8fe,0x0fcc4d89},
+{0x02c0273a,0xe91473d6},{0x02c1f088,0xd4c97c4e},{0x03e0fb7e,0x0db2d3b9},{0x02011056,0x98742cd3},
+{0x01a0a1fd,0x5241cc8a},{0x04c1fa18,0x38dd931e},{0x0580fd54,0x8e640cf3},{0x0441d028,0xb1ba9c25},
+{0x03e18c9b,0x038deb00},{0x01a0a2a5,0x87702616},{0x02c01ce3,0xa9dcabdd},{0x02e145a7,0x7636e87e},
+{0x02601a3d,0xecfa51ce},{0x0221f0e7,0xc4f80e72},{0x04810f58,0xba0f5d5b},{0x02c13042,0xf9158f4c},
+{0x02c132be,0xf19b93e8},{0x01e006af,0x1983f865},{0x02212108,0xb5737fec},{0x03200714,0x0260fc63},
+{0x01a0a4a6,0x5c584bd9},{0x0321fbc6,0xc07a3050},{0x04e1cf1a,0x2778575e},{0x01a0a28e,0x97522a32},
+{0x02c10d12,0xb7046dd7},{0x03800765,0xc4acd7fd},{0x04a022ed,0xfc7019c8},{0x0081f339,0x4d944d06},
+{0x0241fa61,0x15081bd3},{0x01c0a36d,0xf3aa7a41},{0x016e0036,0x0f28d12c},{0x02e1341a,0xb3cf2a4a},
+{0x01e03048,0xcb811b5d},{0x02600fc5,0xe9e14800},{0x02601389,0x882f8bca},{0x04e1d649,0xf9e19ac6},
+{0x0181e290,0x6a837dba},{0x0241f3e4,0xa1fd1c7e},{0x01e1bc07,0xff677f21},{0x01a016b0,0x1c90530b},
+{0x02e101d3,0x5beb8560},{0x0281691e,0x5f4a82ce},{0x028101ea,0xcdf7d082},{0x02a02a18,0x47611dd0},
+{0x02a003a8,0xf034b21b},{0x042008b0,0xeafce1b0},{0x0441f87a,0x1125760b},{0x01e16aed,0xee610017},
+{0x04010ca3,0xfb2d2276},{0x02418801,0x787fc0bb},{0x02e1012b,0x2fea14be},{0x01a0a40b,0x5e795f39},
+{0x0261fbf3,0x9d443de8},{0x02612252,0x8aafe6e8},{0x03001dbf,0xccb23af9},{0x02418903,0xa818857d},
+{0x03a0fb6e,0xbf7b1516},{0x0400a715,0x519d9577},{0x01a0a0d4,0x14e033b6},{0x02811d7a,0x66947787},
+{0x02e10d04,0xbee49096},{0x03e18c34,0xf59cdf80},{0x0401f11e,0x2b301f88},{0x0381ee4d,0xf169d9dc},
+{0x02600330,0x1b34f136},{0x0341d216,0x84460d25},{0x03003214,0x233f9ef5},{0x02c1148a,0x8870cd25},
+{0x0341d4b5,0xce7c9564},{0x0241107f,0x61b40928},{0x02200b3d,0xac062005},{0x04201ee9,0x094e8ee5},
+{0x04002c3a,0xdb95fecd},{0x0360034c,0x5a047b15},{0x03202deb,0x626ab147},{0x0341d447,0x23b2a119},
+{0x02c0a98a,0x7e65f9ba},{0x01a0196a,0xe1e7e90c},{0x030109c9,0xc8546a48},{0x026100d0,0x16958af7},
+{0x03c1f7d4,0x49ea114e},{0x028e0172,0x7a6d1512},{0x04a0fc0e,0xffc87120},{0x01a0a0e8,0xa722bf5d},
+{0x01e00644,0x0e637145},{0x0201fb1c,0x2fadebff},{0x02210f31,0x133a0491},{0x0260ab16,0x08736b2f},
+{0x03203212,0x114539be},{0x01a02638,0xb3c65458},{0x05a01f3e,0x0ec7d07f},{0x02402d5f,0x1c7cc1d7},
+{0x0301f929,0x258b9d62},{0x0281fa24,0x2b528ff5},{0x020013d6,0xcc18bbd2},{0x026e0105,0xa39a403b},
+{0x032118db,0x3368094a},{0x010020ac,0x30cc6389},{0x02601216,0xed75a515},{0x03c10f85,0x4643c00d},
+{0x02016ad2,0x90cb7fb0},{0x01803380,0xe63a020a},{0x0221d33b,0xbe07cd88},{0x04a0fc50,0x9f4009ad},
+{0x02a16e88,0x06ab029d},{0x02c1f087,0xd3c97abb},{0x03e18b7a,0xb4cd2530},{0x0361d194,0x3a242014},
+{0x01c00c1a,0x5438a665},{0x02a0a8b5,0x67966cc7},{0x03e0a82c,0xa6cfd215},{0x03011a21,0xc574fc47},
+{0x02401206,0xfee092fd},{0x01a0a1e3,0x79feffc5},{0x02400d1b,0xde8eb862},{0x026e010a,0xa69a44f4},
+{0x02400a6e,0x9815eee7},{0x02802171,0x233a2e1d},{0x036121df,0x513b50a3},{0x02a0043f,0x41b3c774},
+{0x02200787,0x58ff9cf7},{0x04a10b5e,0x5e5aeff0},{0x01e11eed,0x7a87319a},{0x02401938,0xdb0bcfd8},
+{0x05401f4a,0xb348fbb3},{0x02c13199,0x072ea119},{0x02a0a9c1,0xb65b6c84},{0x0381e87d,0xdc211e86},
+{0x02802860,0x0c9a872f},{0x02c1305a,0x089bca49},{0x02a16939,0x84db4682},{0x02810356,0xe8ef015e},
+{0x0421f87f,0xf2f375b2},{0x024112d3,0x70e65098},{0x03c1ee72,0x02c76431},{0x022029a4,0xd8aa59ef},
+{0x01c16f5c,0xc6f334ce},{0x0240a6d3,0xab580240},{0x0161f94a,0xc9e9f5c7},{0x0340052a,0x3efc17cf},
+{0x05a1d8e9,0xfec947e7},{0x0321d87e,0xfd2afec3},{0x01c02b7f,0x1aed0949},{0x05001e5c,0x0f448bba},
+{0x02410112,0xa7fd31c9},{0x03616816,0xf2f14c0c},{0x01e10186,0xe2abb4a7},{0x02a11189,0x3371bbbe},
+{0x0280202a,0x950fff8e},{0x01c0a6bb,0x8ab0481b},{0x00e1f305,0x38ae4fa4},{0x0361d5c7,0xd39c9f64},
+{0x02c1312c,0x6e208ed4},{0x0180a5ba,0x05e6a8c8},{0x0261b09d,0xf7e5e047},{0x04e145cf,0x397439c0},
+{0x03a01479,0x54fd6f9c},{0x02200733,0xa53b0cfc},{0x02000aa4,0x43a4fd51},{0x02000a13,0xe3dfcacd},
+{0x03203220,0xb9ea9f8c},{0x0180a4a0,0xa6f79d38},{0x032007eb,0xad83b3cf},{0x02601277,0x98741688},
+{0x0300a9f5,0x36d419f8},{0x01e1bc1b,0xf7677289},{0x06200476,0x9a13ef40},{0x02003114,0x9494735b},
+{0x03201893,0x512b67a5},{0x02e14455,0xb07651ad},{0x0401ed2c,0xb5a98d5b},{0x04402246,0xb19085f4},
+{0x028014de,0xb41bc914},{0x02e144f2,0xf2aa07d0},{0x03202c6f,0xa5f63530},{0x01c1f907,0x6f7c2c9d},
+{0x02ce0044,0x6b3c62eb},{0x02e14504,0x88a2a52d},{0x02a1688e,0x6a582299},{0x026e0115,0x17972540},
+{0x0301084d,0xb0a7a2a5},{0x02e144a4,0x9c085341},{0x03a12068,0x81a80355},{0x01e106ec,0x44c48eba},
+{0x02e14588,0x7534a854},{0x02c133f7,0x16760b70},{0x02a0aa5c,0x815c8db1},{0x0480052e,0xb60d6ffe},
+{0x02810ace,0xaba5253b},{0x02e109a6,0x8dd3cbfd},{0x0161f31e,0x64b9a9ec},{0x03012490,0x822ed239},
+{0x02210490,0x5e8cc427},{0x0381d4f2,0xc1cf8f73},{0x03c02a05,0x14e24dd3},{0x02c0abad,0xb74ad6a7},
+{0x03602486,0x5ef08c30},{0x018007c0,0x3d09483e},{0x02e1450e,0x89a4e557},{0x02602dd0,0xa2f8e21e},
+{0x0301f4e2,0x4cd6b541},{0x06a0fbe8,0xabc19613},{0x0400a790,0x19614964},{0x03001552,0x2cd63422},
+{0x0260a8a2,0x16edd346},{0x04a124bf,0x11f1922b},{0x0480fcc0,0xbb9cf801},{0x01a1160f,0xe34019a8},
+{0x0301f056,0x921a3618},{0x03612259,0x8dda23eb},{0x0261b024,0x46501cc3},{0x022010de,0x57dfe1ca},
+{0x022010d7,0xe7072982},{0x02402597,0x50dad008},{0x02a01a30,0xbcd20799},{0x02601341,0xd08eb22d},
+{0x02e01b3a,0x12e15a05},{0x020008c8,0x6894bc47},{0x03212035,0x45a9b16a},{0x0321f665,0xea423383},
+{0x03c12209,0xb7de9e58},{0x05e1fa44,0x092ab4f6},{0x0220182e,0x80311899},{0x02e14519,0x08b0e637},
+{0x02e00275,0xb2ebb4c1},{0x03202e11,0xc3fc8a16},{0x0261d19a,0x3101f9af},{0x02e00e31,0xef6a62ff},
+{0x01a0a40f,0x5aba0043},{0x0220240c,0x239c3b7a},{0x02c032ba,0x2dacc906},{0x03e1d096,0x9dd2c914},
+{0x04000178,0xe5617523},{0x05801eac,0xf5869259},{0x01e106e3,0x3cc2438b},{0x0460fd3a,0x3cbc416f},
+{0x02003088,0x8e485d12},{0x0261b0f5,0xb0cc8171},{0x0181e292,0x527a5d96},{0x038000d3,0x68d35510},
+{0x01e16abd,0x57bd0751},{0x0061f9dd,0xdd3f5d46},{0x04001ffa,0xd01a917f},{0x00e1f5b7,0x66eb5051},
+{0x01e106e8,0x36c23a19},{0x03c10f18,0x76e92f8a},{0x01c0a45a,0x0e529be7},{0x0241f0f5,0xe1770118},
+{0x04202b73,0x1b717862},{0x02418845,0xf88bc32e},{0x0301d4cb,0x37a11831},{0x0460ab55,0xeb5de5f2},
+{0x024005c5,0xa174354b},{0x0580fd55,0xefe56f7c},{0x0241887b,0x8be33038},{0x0180a11c,0x868f6cac},
+{0x02e14444,0x2273338c},{0x0440a7a1,0xeff96904},{0x0440279e,0x8c58734b},{0x01a0a087,0x716bac16},
+{0x028e0177,0x756d0d33},{0x01a0a01e,0x7408c2de},{0x03c1f215,0x0b95787d},{0x02202f3b,0xc81f454b},
+{0x02a0327a,0x712a4746},{0x03610a47,0x812a23e5},{0x02c13038,0xf91350b5},{0x02210113,0x50ba0633},
+{0x03012011,0x083c4186},{0x02801571,0x045d7b5e},{0x03210a77,0xba45438e},{0x03a1d1a4,0x11dd1f2c},
+{0x0380ffbd,0xd16f999e},{0x03010a65,0x2a4a88a6},{0x0201051c,0x04533a65},{0x00c1f9f2,0xabc6567f},
+{0x02010740,0x2879bfb0},{0x02210821,0x9bd78724},{0x02010515,0x5837aa58},{0x0421221f,0x6f614b1c},
+{0x02418a97,0x579f534d},{0x03c0a70a,0x9f8757cf},{0x03a1098d,0xcfc33ee1},{0x02418ac0,0xd616f2f3},
+{0x02211c1d,0xc0242cc5},{0x0141f93f,0x016009d8},{0x03e18b68,0x97cab8f2},{0x03c1d7e7,0x2637bab4},
+{0x01e0a439,0x45ddf991},{0x02200a2b,0x1d6a25aa},{0x02e16f76,0x4f30af75},{0x02c028a9,0x280c3cd3},
+{0x024189b4,0x9ecd5e4f},{0x02010469,0xb49fcef3},{0x0341e809,0x83f97cad},{0x02e03173,0xe10a0805},
+{0x00c1f4f7,0x4497d1ce},{0x01a0a5c1,0xd0f1fe7e},{0x032100e8,0xc467e7b9},{0x02c101f9,0x6323ba45},
+{0x04a02b14,0x8bacb259},{0x0600087f,0x22267e88},{0x02c021a6,0xe01a39be},{0x03010c3b,0xfbe4326b},
+{0x01a01793,0x0b06ea05},{0x0301d30e,0x86c2826f},{0x0341248d,0x60d8c98d},{0x01c00bf0,0x65d90d4c},
+{0x04400490,0x95a8df5c},{0x0381d029,0x502728cd},{0x03600314,0x97fde62b},{0x02c118eb,0x46aba0f0},
+{0x03000e4c,0x733cbc32},{0x0121f434,0x9fa4d2ef},{0x030010c2,0xcb22d649},{0x02016f69,0xd638d193},
+{0x02a1e91e,0xacbe3d9e},{0x0581da08,0x50bd63f6},{0x01c00ba3,0xf8f16cf3},{0x03e10b53,0x5aa9b5e3},
+{0x028e01a2,0xfa635136},{0x0621fb58,0x0219a357},{0x04402af9,0xce9cbfd1},{0x03e02cb2,0xc28e56e9},
+{0x03c1210b,0x9caaed45},{0x0361d69c,0x3d06ec3c},{0x01a00b10,0x57ac1f1b},{0x01e12140,0x441d95f2},
+{0x02611461,0x38bef6b2},{0x0361e815,0x441c657a},{0x0380ff21,0x4aecd125},{0x0401bc7c,0xcbc58f15},
+{0x0460a743,0xfce605fe},{0x01a0a5f8,0xfaec306e},{0x02e00425,0xa44ef6cb},{0x03c1d55a,0xef25688a},
+{0x030120b3,0x49fbb90d},{0x030004d9,0xf3660fa7},{0x01a11089,0x59b0c902},{0x01a11822,0xc644f122},
+{0x034000e8,0x9c481ffc},{0x0220240e,0xb1291e64},{0x02a0ab79,0x19477a78},{0x02e144b3,0x8f03c19c},
+{0x02812fa5,0x19016f36},{0x02418938,0x207ed290},{0x0621d9c4,0xc3046927},{0x03a02ab9,0xb508e8ab},
+{0x01c0a2c8,0xa9fa5cc5},{0x046023c6,0x1cc468eb},{0x02002f6c,0x95b5b65e},{0x04010151,0x956eb778},
+{0x04a0fd0e,0xdde539c3},{0x01e10494,0x714903a4},{0x034024c5,0x3965cb13},{0x01c0a06f,0xc344383e},
+{0x02e145cb,0x7aefe6bd},{0x04402377,0xf5142f96},{0x024188d3,0x1410e0bc},{0x01a02400,0x97bd1781},
+{0x032015ee,0xe64c7c28},{0x02e144dd,0x1d21233a},{0x02818d02,0xeed15a54},{0x0340a7bc,0x8911667b},
+{0x0341d189,0x9ac2078a},{0x03e02cdd,0x4fa49690},{0x02000cef,0x2463f3e8},{0x01a11819,0xd2564d27},
+{0x01c0a21d,0x0c9b8568},{0x03010a92,0x4ef6fc1d},{0x01c0a3bf,0x653ba607},{0x03e01486,0x6b807841},
+{0x020104a9,0x62bdef64},{0x02000627,0x54b536d7},{0x030024e0,0x63b6cbed},{0x028025d7,0x7cf9d43f},
+{0x0320ff88,0xdc7681eb},{0x03e1d881,0x6e571681},{0x01c006cb,0x874903c8},{0x01402201,0x550e4f9d},
+{0x02a0288c,0xa79187ad},{0x00e022ad,0xc1d09076},{0x0361f39c,0x946c1c34},{0x01c026dd,0x5d5fff64},
+{0x028169f8,0xcdb31b41},{0x01e11188,0x8537e5f9},{0x0381e8c3,0x747c1055},{0x02200810,0x2435a638},
+{0x02c01a2e,0x57bc8b65},{0x04c02aa0,0x4e7ac97d},{0x03c02ae4,0xa42098ac},{0x0241e938,0x6df43222},
+{0x0321f736,0x8dbb5351},{0x05e023c5,0x1b400417},{0x02a0146c,0xca433cba},{0x01c0a15e,0x3f79f4ce},
+{0x024189a8,0x9ccf99c0},{0x02a10014,0x564af286},{0x01a03347,0x727dfb6f},{0x01c0a6e1,0xe89f696a},
+{0x0580fd89,0xf36805f8},{0x036006f2,0xe161e50c},{0x0340fb5b,0x2295dd79},{0x036023a5,0xa4c8ec6f},
+{0x032018dc,0x4d09bbf9},{0x02211322,0xf55f7671},{0x0320abe6,0x622d092c},{0x0181e2a8,0x9c9fa2ed},
+{0x02c0ab24,0x5d22a384},{0x0381d17b,0xd1479f37},{0x01a02ea8,0x8f3786fd},{0x0321d205,0x5973c308},
+{0x04003004,0x93eb3078},{0x03e01e75,0x9a0971e4},{0x0521243b,0x77eaa8cb},{0x0320fbd7,0xaa7a0719},
+{0x02211ef6,0x2c3341ce},{0x02a16944,0xb507c9e1},{0x02ce0056,0x7d3c7f41},{0x02a003b3,0x51f7c3c7},
+{0x02c1309f,0x3a25a9f2},{0x03a01e23,0xfcd26754},{0x04600376,0xc8c55dd8},{0x06400764,0x6ace139d},
+{0x02818d05,0xedd158c1},{0x0220248c,0x6423b387},{0x01a0a542,0xcf034479},{0x02c0119f,0xfdb36178},
+{0x0361d5c5,0xd59ca28a},{0x020103ac,0x7eddd8d4},{0x02400e23,0xe4380103},{0x02418aad,0x459ab9c9},
+{0x0201065e,0x5f408405},{0x034024c7,0x3b65ce39},{0x0380ff29,0x52ecddbd},{0x05e01b70,0x6833818d},
+{0x0340014f,0xe31be979},{0x0201f5a9,0x79309b57},{0x0340a8ea,0x0f70e4fe},{0x02200f72,0xc61f1bc1},
+{0x024032ff,0x8a9f9029},{0x026102e6,0x3b312711},{0x028110e8,0xa1e23200},{0x02c017d6,0x7572f80f},
+{0x03a0fac7,0xa26b3005},{0x03610541,0xdea1f075},{0x0161f321,0x8269b307},{0x02c12002,0x353522ea},
+{0x03600105,0x1ce9f118},{0x0361e8b6,0x5751c851},{0x05a1d794,0x3c99de2e},{0x04c1d993,0x0fd7e520},
+{0x0300a9fc,0x40e7c51e},{0x01e1072f,0x876eee31},{0x01c01784,0xc5f68c96},{0x02e00c43,0x9c1fbbd6},
+{0x03e0077f,0x8e4eb432},{0x03c1d468,0xf3230315},{0x0261b0a9,0x1b64219b},{0x01a1f327,0xa1fac8a8},
+{0x028012fb,0xc0b73056},{0x0201065f,0x5e408272},{0x0321da2f,0xeb6aeb4a},{0x0301d40a,0xbf4d0803},
+{0x034121c0,0x1fa6aca2},{0x03c0061e,0x1bcd9de5},{0x02016f6f,0x8664dbfa},{0x02a0ff1f,0xf95308ed},
+{0x0361054b,0x3a5d2df7},{0x02811958,0x5315c27a},{0x038000c8,0x29150b9f},{0x0300a649,0x8a479318},
+{0x02a10783,0x011217b5},{0x00802625,0x945a828d},{0x0261145b,0x166ea0c0},{0x0620a766,0x8b6375ee},
+{0x02800d87,0xf714c4f8},{0x02c131a4,0x525851e3},{0x0521d0a2,0x1712773d},{0x034029e0,0xa7613151},
+{0x0381e888,0x8a30aac5},{0x07001f8c,0x1781748f},{0x02c13349,0xd5bc6925},{0x0321bc79,0xc00df1cb},
+{0x0441eeac,0x42663ed8},{0x010020a4,0x1eab8ec2},{0x03010576,0x8af6ef99},{0x0201237c,0x4fb91285},
+{0x02001c43,0x0280f547},{0x03e1ed29,0x2b32c1ad},{0x01802284,0x74d33b0a},{0x02402fd2,0xaddf7479},
+{0x0381f753,0x0b0de076},{0x048033e3,0xb7a16623},{0x0361d6b0,0x6bafec89},{0x03a03235,0xddc981a3},
+{0x0300071c,0xb5098c9e},{0x0421eeba,0xaee4ad63},{0x01c0a444,0x6603b262},{0x0381da49,0x820bf8c8},
+{0x02e13224,0xd070fc3e},{0x034009fc,0x5f374943},{0x04e0fe82,0xf192ba5d},{0x020111b0,0x50dbaf34},
+{0x02e0082c,0xb440a88f},{0x0200a845,0xdd2e5d59},{0x01e10673,0x4d28c93d},{0x02c02865,0xaad13a5f},
+{0x02a024fa,0x2becc943},{0x010033d1,0xb6ad0f90},{0x03410c9b,0x34433d0e},{0x0660fef5,0x597a8f77},
+{0x02802a25,0xe3bae448},{0x02c16999,0x8339af01},{0x0241886e,0x00eaa42c},{0x028026d1,0x199337eb},
+{0x02c132b5,0xf59dd8cb},{0x02a0abda,0x42bb21f5},{0x00e1f5d7,0x6f4697e8},{0x0401d736,0x7c5b64d3},
+{0x02010641,0x2f4696d7},{0x02e133c4,0x5b86e991},{0x0321f250,0x4bb15d6b},{0x0341f137,0xe300e460},
+{0x01e00c9a,0xe52e8aab},{0x01c0a233,0x1f2ccb96},{0x028e01bb,0x06d7fecf},{0x026104f5,0x25b5d3f0},
+{0x02e14522,0x89b3efe1},{0x054023bf,0x03dd8bf1},{0x02418997,0xadcb3755},{0x03010cea,0x3c1f699d},
+{0x02a104de,0xf3bde68e},{0x02c12316,0x442b4c83},{0x02a1001d,0x08e64353},{0x026169ed,0x354acd7c},
+{0x01c0a2e4,0x09f8ae8e},{0x01e10709,0xfe675ac1},{0x02e1326e,0x9b25b54b},{0x00e1f69c,0x9f7ef318},
+{0x04401d7e,0x922e8fdf},{0x02e16e6b,0x5dd44a6b},{0x026e0138,0x1aa1b755},{0x03e18b86,0x19bc7b0e},
+{0x0220239a,0x7da23036},{0x03000546,0x5239693e},{0x0381da54,0x5e952300},{0x03e029c2,0x0fdbcbb2},
+{0x01c02ea9,0x2abe22d3},{0x0061f6cf,0x9563634c},{0x02610900,0x40e30b4c},{0x01c0a06c,0xc7443e8a},
+{0x02c1331b,0xfc0b09da},{0x04601f25,0x0296288c},{0x0201fb2b,0x30aded92},{0x0321201a,0xe8eec51c},
+{0x0260132e,0x9c9c845c},{0x02a11adf,0x4cc87ae6},{0x01e1163c,0x0102c70c},{0x02a10035,0xa0a1f436},
+{0x02400a75,0x14865bf7},{0x0200308f,0x8c605ed2},{0x0221f4a1,0x7c9d8ae1},{0x01816a65,0x7b7b1874},
+{0x038124be,0x056f311e},{0x01a0a049,0x19a17d0e},{0x0320fbd5,0xd5fdd394},{0x02c1ee00,0x56b7009b},
+{0x01e10520,0x797ecea8},{0x032109c4,0x44dbea51},{0x0381e8a9,0x3c700f69},{0x03200312,0x6d9ad0d3},
+{0x02e16b85,0xc2c29441},{0x0280ff40,0x71f926c3},{0x02a10031,0x2e666ce9},{0x02011a80,0x110f5b62},
+{0x026112c7,0x32361e36},{0x02801986,0x421d8bca},{0x02e12233,0x506be218},{0x06a1d9b7,0x887d49cf},
+{0x03603231,0x63982606},{0x04e1d650,0x10e1befb},{0x02402d32,0xcca96385},{0x020121ad,0x667e1c94},
+{0x05a02b8d,0x4f715954},{0x03c1cf7f,0x4b320567},{0x0200a9d2,0xe1d401c1},{0x01c02130,0xd58768dd},
+{0x0380235d,0xc7477aec},{0x02000998,0xee1b1245},{0x01c102a7,0x4ce8e004},{0x024026a6,0x25df30e5},
+{0x02c1300c,0x901f775d},{0x01a01b5c,0x7f1c708b},{0x01e11198,0xd92b9e42},{0x0421da7f,0x223ca78b},
+{0x03600f8e,0x3324ecb3},{0x038014e3,0xd5f1ddfe},{0x03c1d03a,0xfae96cb6},{0x01a0a52c,0xd7149a32},
+{0x03402988,0xe7ad63b0},{0x02a1059c,0x87f47c02},{0x02210464,0xed861a6e},{0x02c01d5c,0x4a85b65d},
+{0x01a0a0fa,0xf64a4b2a},{0x01e16aaf,0x562a71a4},{0x02e1463b,0xe6c22355},{0x01c10ea6,0x6a766025},
+{0x02002f08,0xd2997143},{0x02e0a647,0x171b726c},{0x0421d241,0xc568dfcc},{0x010e002c,0xc1fcf7c2},
+{0x02e02acb,0x601beb99},{0x02a169c3,0x4be5337f},{0x03601dfd,0xcc028759},{0x01c00eb2,0xf98a28a7},
+{0x03602480,0xed21c5fb},{0x02e16832,0xb3549064},{0x01e00638,0x9d2ace20},{0x02003084,0x90486038},
+{0x03c1d038,0x5dc46f71},{0x0300a783,0x6d1760f8},{0x01811740,0x1bf0e66c},{0x0420fc70,0x44ca8b46},
+{0x01e00328,0x38f3822e},{0x020010f3,0x118e0daf},{0x0160230f,0x882b3e8f},{0x03a004fd,0x0446c057},
+{0x036015fc,0x617af21b},{0x01c16f20,0x6d7646dd},{0x01c1108a,0xe442f76d},{0x0341250a,0x43c28d49},
+{0x022032d8,0x3b07d401},{0x04a1d668,0x2d1af7b8},{0x02801a54,0xdf2a1f30},{0x01a0a472,0x423e04af},
+{0x02802e44,0xc073bc74},{0x02e1f8ac,0x33724939},{0x0421d5d5,0x5636d5da},
+};
+// clang-format on
+// NOLINTEND
@@ -1,5 +1,7 @@
 #include <algorithm>
 #include <array>
+#include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <string_view>
 
@@ -32,16 +34,60 @@ constexpr Character_Reference references[] {
 
 static_assert(std::ranges::is_sorted(references, {}, &Character_Reference::name_as_string));
 
-const Character_Reference* character_reference_by_name(std::u8string_view name) noexcept
+/// @brief An entry in the minimal perfect hash table over the names in `references`.
+/// Each entry acts both as a bucket (via `displacement`) and as a slot (via `index`).
+/// See `generate_html_entities_cpp.py` for details on how the table is built.
+struct Hash_Entry {
+    std::int16_t displacement;
+    std::uint16_t index;
+};
+
+constexpr Hash_Entry hash_table[] {
+#include "html_entities_hash_autogenerated.cpp" // NOLINT
+};
+
+constexpr std::size_t max_name_length = std::size(Character_Reference {}.name);
+
+[[nodiscard]]
+constexpr std::uint32_t fnv1a(std::u8string_view name, std::uint32_t seed) noexcept
 {
-    const auto* const it
-        = std::ranges::lower_bound(references, name, {}, &Character_Reference::name_as_string);
-    if (it == std::end(references) || it->name_as_string() != name) {
+    std::uint32_t hash = 2166136261u ^ seed;
+    for (const char8_t c : name) {
+        hash ^= std::uint32_t(c);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+[[nodiscard]]
+constexpr const Character_Reference* character_reference_by_name(std::u8string_view name) noexcept
+{
+    if (name.empty() || name.length() > max_name_length) {
         return nullptr;
     }
-    return &*it;
+    const Hash_Entry& bucket = hash_table[fnv1a(name, 0) % std::size(hash_table)];
+    const std::size_t slot = bucket.displacement < 0
+        ? std::size_t(-(bucket.displacement + 1))
+        : fnv1a(name, std::uint32_t(bucket.displacement)) % std::size(hash_table);
+    const Character_Reference& result = references[hash_table[slot].index];
+    return result.name_as_string() == name ? &result : nullptr;
 }
 
+// Every name must be found in the hash table,
+// and for duplicate names, the lookup must yield the first reference with that name,
+// just like a binary search over the sorted references would.
+static_assert([] {
+    for (const Character_Reference& ref : references) {
+        const auto* const first = std::ranges::lower_bound(
+            references, ref.name_as_string(), {}, &Character_Reference::name_as_string
+        );
+        if (character_reference_by_name(ref.name_as_string()) != &*first) {
+            return false;
+        }
+    }
+    return true;
+}());
+
 } // namespace
 
 // We cannot use auto here because:
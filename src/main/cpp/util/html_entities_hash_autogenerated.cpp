@@ -0,0 +1,2226 @@
+// NOLINTBEGIN
+// clang-format off
+{1,2188},
+{-2219,537},
+{2,845},
+{-2218,2039},
+{0,1079},
+{2,2174},
+{1,95},
+{0,12},
+{0,2176},
+{1,1647},
+{2,1516},
+{-2217,2179},
+{1,2219},
+{0,546},
+{0,1494},
+{-2213,1037},
+{1,624},
+{0,1448},
+{0,1973},
+{0,1102},
+{0,1134},
+{0,1924},
+{2,1740},
+{0,561},
+{-2211,43},
+{4,1947},
+{0,1016},
+{0,540},
+{0,1998},
+{-2210,2118},
+{-2209,335},
+{-2206,288},
+{-2198,1762},
+{-2197,1291},
+{1,1495},
+{1,1969},
+{-2191,322},
+{-2190,1963},
+{-2189,806},
+{-2186,1296},
+{0,2169},
+{1,1712},
+{-2184,1774},
+{1,2198},
+{0,1995},
+{0,701},
+{0,1007},
+{-2182,1564},
+{0,640},
+{3,1119},
+{0,1977},
+{-2181,1335},
+{0,1660},
+{1,1643},
+{0,1136},
+{-2178,1437},
+{1,1791},
+{-2175,1854},
+{0,827},
+{0,1606},
+{-2172,1100},
+{0,731},
+{-2170,1730},
+{0,165},
+{0,722},
+{0,1334},
+{1,231},
+{0,1160},
+{-2165,753},
+{-2161,1103},
+{2,567},
+{0,1463},
+{1,126},
+{0,1419},
+{-2159,1121},
+{-2157,2035},
+{0,341},
+{-2150,556},
+{0,1018},
+{0,2201},
+{-2148,700},
+{0,900},
+{1,2026},
+{0,343},
+{1,87},
+{4,458},
+{0,596},
+{1,1475},
+{-2145,1428},
+{1,1101},
+{0,416},
+{0,685},
+{0,411},
+{0,409},
+{1,1467},
+{-2142,505},
+{-2138,191},
+{0,1431},
+{-2134,830},
+{6,2132},
+{-2132,1480},
+{-2130,863},
+{-2129,839},
+{0,2075},
+{0,1287},
+{2,445},
+{0,1319},
+{0,1436},
+{0,1477},
+{0,642},
+{-2127,587},
+{0,990},
+{1,256},
+{-2126,859},
+{1,935},
+{0,1556},
+{0,552},
+{0,675},
+{0,2100},
+{0,1140},
+{-2125,919},
+{0,590},
+{0,592},
+{1,137},
+{-2122,160},
+{0,238},
+{-2118,65},
+{-2116,1859},
+{-2114,451},
+{0,299},
+{-2112,1508},
+{-2110,976},
+{0,2143},
+{-2108,253},
+{3,1959},
+{1,2126},
+{0,334},
+{1,1290},
+{1,227},
+{1,1246},
+{-2107,1227},
+{-2101,1960},
+{2,1415},
+{0,146},
+{-2096,1152},
+{0,1178},
+{-2093,1127},
+{0,1662},
+{1,1212},
+{1,1684},
+{-2092,243},
+{1,1650},
+{-2091,2037},
+{-2082,1669},
+{0,874},
+{0,1794},
+{2,1430},
+{0,551},
+{-2081,167},
+{2,163},
+{0,1022},
+{-2077,345},
+{4,317},
+{1,1479},
+{-2076,1476},
+{1,1571},
+{-2074,2076},
+{-2071,240},
+{4,2127},
+{-2069,1607},
+{-2067,745},
+{8,600},
+{-2057,2228},
+{-2054,91},
+{-2052,1118},
+{-2051,438},
+{0,1706},
+{1,1474},
+{-2050,2150},
+{4,2202},
+{0,1241},
+{2,622},
+{-2048,916},
+{-2044,1648},
+{0,2036},
+{0,667},
+{1,639},
+{0,487},
+{0,681},
+{1,2006},
+{-2041,1251},
+{0,1128},
+{2,2196},
+{1,1821},
+{2,1292},
+{-2038,1914},
+{0,808},
+{-2037,1967},
+{0,634},
+{2,453},
+{0,331},
+{1,2},
+{5,1438},
+{0,655},
+{1,1714},
+{-2030,1366},
+{-2029,790},
+{6,1038},
+{3,2156},
+{4,312},
+{-2027,223},
+{-2020,1468},
+{2,1131},
+{0,1923},
+{-2019,114},
+{1,2052},
+{-2018,476},
+{-2015,2081},
+{0,1286},
+{0,980},
+{3,2124},
+{2,645},
+{4,1596},
+{-2011,391},
+{0,88},
+{0,279},
+{-2006,1847},
+{0,742},
+{0,933},
+{2,1936},
+{-2001,75},
+{0,1979},
+{-2000,1110},
+{-1997,1618},
+{-1991,1921},
+{-1990,1167},
+{2,1544},
+{0,1857},
+{1,177},
+{0,1274},
+{3,1920},
+{-1984,2082},
+{0,355},
+{-1983,1891},
+{0,81},
+{0,687},
+{0,1886},
+{0,1315},
+{0,249},
+{-1982,2187},
+{-1981,358},
+{-1979,1876},
+{1,1536},
+{-1978,1980},
+{2,975},
+{-1977,1406},
+{-1976,1354},
+{0,1081},
+{-1973,1230},
+{0,936},
+{-1972,205},
+{0,1531},
+{0,1098},
+{1,1771},
+{0,1185},
+{1,1179},
+{-1964,2034},
+{0,21},
+{-1959,166},
+{0,381},
+{3,1640},
+{-1957,1347},
+{-1956,1810},
+{1,1511},
+{0,2165},
+{1,1842},
+{-1955,1416},
+{2,1163},
+{1,1312},
+{-1953,581},
+{0,443},
+{0,112},
+{-1952,1172},
+{0,1089},
+{1,881},
+{1,1126},
+{1,1364},
+{0,1605},
+{1,2199},
+{0,1908},
+{2,1478},
+{0,1644},
+{0,672},
+{1,2135},
+{0,258},
+{-1951,2072},
+{-1948,1170},
+{0,643},
+{1,2206},
+{-1947,342},
+{-1944,1559},
+{0,263},
+{-1943,1154},
+{0,1697},
+{-1941,576},
+{0,1743},
+{-1939,100},
+{-1938,1675},
+{0,718},
+{0,2112},
+{-1934,1561},
+{0,909},
+{-1932,1952},
+{1,973},
+{-1930,978},
+{1,2145},
+{-1929,270},
+{-1927,1482},
+{-1925,815},
+{2,273},
+{0,1584},
+{0,327},
+{1,14},
+{1,241},
+{-1924,2032},
+{0,1373},
+{0,1203},
+{-1923,1670},
+{4,787},
+{0,1911},
+{-1919,455},
+{0,1900},
+{-1918,1143},
+{0,1615},
+{1,1566},
+{3,300},
+{6,511},
+{-1917,40},
+{0,2136},
+{0,905},
+{2,1135},
+{0,2021},
+{1,1308},
+{0,738},
+{1,1375},
+{0,2151},
+{1,2129},
+{0,1753},
+{-1916,304},
+{-1912,962},
+{-1910,1142},
+{2,1527},
+{0,254},
+{-1908,1724},
+{-1907,2214},
+{-1899,315},
+{0,421},
+{1,450},
+{2,383},
+{1,1327},
+{-1897,893},
+{-1892,1211},
+{-1888,2098},
+{1,1875},
+{0,483},
+{0,1462},
+{0,1951},
+{-1887,1852},
+{0,1052},
+{1,617},
+{-1884,364},
+{-1883,1988},
+{0,82},
+{0,1725},
+{0,512},
+{0,1735},
+{2,1811},
+{0,363},
+{-1881,699},
+{1,1955},
+{-1873,609},
+{-1871,480},
+{-1869,786},
+{-1865,1797},
+{-1863,1833},
+{1,2022},
+{0,974},
+{-1860,1297},
+{1,1563},
+{-1857,846},
+{-1854,2055},
+{8,763},
+{0,1433},
+{-1846,724},
+{0,108},
+{0,1907},
+{0,357},
+{-1844,471},
+{0,61},
+{-1843,824},
+{2,1021},
+{0,380},
+{-1836,568},
+{4,711},
+{-1832,1671},
+{0,1935},
+{-1830,1777},
+{0,809},
+{-1827,1514},
+{0,281},
+{0,2178},
+{0,623},
+{0,2085},
+{1,56},
+{-1826,924},
+{-1824,1688},
+{-1819,1090},
+{2,524},
+{1,510},
+{0,1490},
+{-1818,1787},
+{-1817,1723},
+{1,1802},
+{-1813,2128},
+{5,657},
+{-1807,723},
+{0,796},
+{-1805,1124},
+{0,2168},
+{0,498},
+{1,869},
+{0,864},
+{-1801,1769},
+{0,2155},
+{-1799,848},
+{-1796,504},
+{0,1273},
+{-1792,1199},
+{3,1240},
+{-1791,93},
+{3,387},
+{-1790,1489},
+{0,394},
+{-1789,1681},
+{-1788,875},
+{1,2016},
+{0,1813},
+{0,857},
+{-1786,1298},
+{0,837},
+{2,1200},
+{1,754},
+{0,885},
+{-1778,1526},
+{-1777,1161},
+{1,1579},
+{0,2146},
+{0,1608},
+{-1776,957},
+{2,1820},
+{1,1840},
+{7,607},
+{0,293},
+{0,1238},
+{0,2105},
+{0,1505},
+{0,1729},
+{0,762},
+{0,1216},
+{-1771,1782},
+{0,1636},
+{0,1727},
+{0,2113},
+{-1767,2160},
+{0,1523},
+{0,1357},
+{0,583},
+{-1760,1565},
+{-1759,120},
+{1,321},
+{0,2152},
+{-1757,1831},
+{-1756,1547},
+{-1755,1581},
+{1,1637},
+{1,1235},
+{0,814},
+{1,1888},
+{-1754,775},
+{-1748,1752},
+{-1744,1217},
+{1,1717},
+{3,2053},
+{0,1659},
+{2,7},
+{0,1075},
+{1,1696},
+{0,1219},
+{1,1583},
+{2,2224},
+{-1743,689},
+{-1742,1213},
+{0,647},
+{0,440},
+{-1739,28},
+{1,1878},
+{-1737,1805},
+{2,819},
+{-1734,591},
+{0,1610},
+{0,586},
+{-1731,608},
+{0,1713},
+{2,1881},
+{3,285},
+{0,1685},
+{0,1755},
+{-1727,1799},
+{-1726,2225},
+{1,523},
+{-1725,1001},
+{-1724,1201},
+{-1717,284},
+{-1715,115},
+{-1713,1258},
+{-1712,999},
+{2,413},
+{0,83},
+{0,1770},
+{4,1402},
+{0,60},
+{4,152},
+{-1710,1887},
+{1,1575},
+{1,202},
+{-1707,883},
+{0,474},
+{0,666},
+{0,626},
+{0,1497},
+{1,128},
+{1,597},
+{0,142},
+{0,816},
+{1,399},
+{-1705,1123},
+{0,420},
+{0,1332},
+{0,2054},
+{0,1058},
+{-1704,1721},
+{-1700,1040},
+{0,522},
+{-1692,1668},
+{-1690,1750},
+{0,485},
+{0,1609},
+{-1685,1841},
+{-1684,1945},
+{0,98},
+{4,1825},
+{4,1768},
+{0,926},
+{2,1384},
+{-1681,877},
+{1,1804},
+{0,2164},
+{0,662},
+{0,477},
+{0,1194},
+{3,1773},
+{-1670,392},
+{0,1229},
+{1,1991},
+{-1667,1253},
+{-1660,229},
+{1,328},
+{0,1929},
+{-1658,1879},
+{1,1045},
+{-1657,2059},
+{0,1839},
+{0,1904},
+{5,594},
+{-1652,1265},
+{0,508},
+{-1645,1177},
+{-1642,677},
+{0,963},
+{4,462},
+{1,1176},
+{0,744},
+{0,644},
+{-1637,1146},
+{0,1943},
+{20,2095},
+{3,533},
+{0,470},
+{0,2092},
+{0,1149},
+{-1635,615},
+{-1633,1293},
+{-1631,1722},
+{1,1150},
+{0,785},
+{0,2070},
+{-1628,674},
+{0,635},
+{-1625,1795},
+{1,611},
+{-1620,1464},
+{-1616,123},
+{-1615,107},
+{0,721},
+{0,1202},
+{-1612,1557},
+{-1608,680},
+{-1604,31},
+{1,141},
+{0,946},
+{0,1344},
+{1,1363},
+{0,1492},
+{1,1057},
+{-1603,247},
+{0,860},
+{0,1677},
+{-1602,1268},
+{-1597,1461},
+{-1594,2005},
+{0,2011},
+{0,456},
+{-1590,2013},
+{0,194},
+{0,1968},
+{-1589,492},
+{-1588,1679},
+{0,1410},
+{-1587,2000},
+{0,35},
+{-1585,176},
+{-1581,26},
+{0,1587},
+{-1580,1445},
+{-1577,1731},
+{0,1192},
+{0,1812},
+{0,1702},
+{4,489},
+{-1575,2023},
+{0,2186},
+{2,1014},
+{1,2003},
+{1,208},
+{3,1905},
+{-1569,1326},
+{0,18},
+{0,1429},
+{0,245},
+{0,720},
+{-1568,1091},
+{5,1793},
+{0,2154},
+{-1567,1600},
+{-1565,1338},
+{-1562,2216},
+{1,1884},
+{0,1189},
+{2,1418},
+{0,2001},
+{0,1356},
+{-1556,2063},
+{2,1978},
+{0,1818},
+{-1551,726},
+{-1550,1005},
+{0,1393},
+{0,573},
+{1,1591},
+{1,907},
+{-1547,1191},
+{0,697},
+{0,1775},
+{4,2120},
+{1,1652},
+{-1546,606},
+{3,1672},
+{-1544,965},
+{-1543,220},
+{2,1989},
+{-1542,197},
+{2,1329},
+{-1540,1379},
+{0,1266},
+{-1538,1807},
+{0,332},
+{8,1538},
+{-1537,1012},
+{2,1096},
+{-1536,1646},
+{1,847},
+{0,434},
+{1,1865},
+{0,2019},
+{0,1720},
+{0,66},
+{-1535,169},
+{0,2031},
+{1,1084},
+{0,1577},
+{0,747},
+{-1534,1147},
+{0,784},
+{-1532,1499},
+{-1531,1233},
+{2,1641},
+{0,2210},
+{0,1870},
+{-1527,732},
+{-1523,572},
+{0,415},
+{0,105},
+{-1522,143},
+{-1520,44},
+{0,1485},
+{-1516,1934},
+{-1514,1031},
+{-1512,1206},
+{0,186},
+{-1509,1214},
+{-1508,1262},
+{-1506,939},
+{-1505,1077},
+{2,1822},
+{3,1525},
+{3,460},
+{6,1144},
+{0,2090},
+{0,418},
+{1,969},
+{1,912},
+{1,679},
+{-1503,1759},
+{-1499,959},
+{-1497,760},
+{-1493,1498},
+{-1488,20},
+{-1486,516},
+{1,59},
+{2,46},
+{1,2119},
+{-1483,604},
+{0,468},
+{-1479,1845},
+{0,1105},
+{0,1272},
+{0,430},
+{0,1627},
+{1,1183},
+{-1475,1153},
+{0,1493},
+{1,396},
+{0,1013},
+{-1473,410},
+{4,1065},
+{0,1383},
+{-1472,1589},
+{5,1880},
+{0,365},
+{0,569},
+{1,407},
+{-1470,2058},
+{-1463,1139},
+{-1462,1651},
+{0,2190},
+{0,1388},
+{-1461,768},
+{0,449},
+{1,799},
+{0,1667},
+{2,1169},
+{0,1313},
+{-1460,2195},
+{3,127},
+{-1459,1622},
+{6,85},
+{0,971},
+{-1456,149},
+{1,1620},
+{0,733},
+{-1455,1486},
+{0,1748},
+{-1453,1553},
+{0,86},
+{-1452,1639},
+{11,1528},
+{2,495},
+{1,45},
+{0,757},
+{1,2077},
+{0,1295},
+{0,463},
+{0,1830},
+{-1448,2044},
+{-1447,1188},
+{-1446,1112},
+{0,2079},
+{-1445,2139},
+{0,260},
+{0,1151},
+{-1444,1590},
+{-1439,386},
+{1,1450},
+{-1438,1894},
+{0,1059},
+{-1437,1796},
+{2,1208},
+{0,1056},
+{-1436,1066},
+{0,817},
+{0,2171},
+{1,67},
+{0,1404},
+{1,283},
+{0,942},
+{0,1330},
+{-1435,1539},
+{0,627},
+{-1434,447},
+{-1429,925},
+{0,2086},
+{0,941},
+{1,204},
+{-1427,922},
+{-1417,1558},
+{0,2029},
+{0,1343},
+{1,1550},
+{0,684},
+{-1412,2030},
+{1,2130},
+{-1410,491},
+{0,1680},
+{-1409,1718},
+{3,1569},
+{-1407,2020},
+{-1405,577},
+{2,1522},
+{-1398,178},
+{-1397,1800},
+{-1395,1954},
+{-1393,1574},
+{1,1867},
+{1,1871},
+{0,866},
+{0,1447},
+{0,507},
+{0,74},
+{0,812},
+{-1391,1400},
+{0,1815},
+{-1383,193},
+{0,1011},
+{-1380,927},
+{14,1004},
+{0,871},
+{-1379,1157},
+{1,707},
+{2,124},
+{0,719},
+{0,589},
+{1,931},
+{4,389},
+{0,135},
+{-1378,1629},
+{5,1376},
+{3,1346},
+{1,1060},
+{4,192},
+{0,2047},
+{2,154},
+{-1377,1913},
+{3,427},
+{-1376,1693},
+{-1374,1785},
+{-1371,884},
+{0,11},
+{0,651},
+{-1368,216},
+{0,2010},
+{0,292},
+{-1367,695},
+{-1366,793},
+{0,1719},
+{-1365,1746},
+{1,580},
+{0,618},
+{2,1874},
+{4,1226},
+{-1364,1925},
+{1,307},
+{5,1631},
+{3,908},
+{-1360,2042},
+{-1357,938},
+{2,237},
+{0,1747},
+{0,336},
+{3,1987},
+{-1354,1434},
+{-1351,73},
+{2,435},
+{-1350,690},
+{0,1323},
+{-1346,519},
+{-1345,362},
+{0,64},
+{-1344,1305},
+{-1340,1549},
+{0,1506},
+{0,239},
+{-1339,1076},
+{2,1529},
+{5,1210},
+{-1334,1586},
+{2,2213},
+{-1318,705},
+{-1317,1441},
+{0,1080},
+{0,1488},
+{0,1832},
+{0,1711},
+{0,715},
+{1,99},
+{-1312,1892},
+{0,574},
+{-1307,1162},
+{0,1473},
+{0,921},
+{3,1912},
+{-1306,50},
+{1,1502},
+{1,895},
+{-1305,872},
+{-1303,1282},
+{-1301,1916},
+{2,159},
+{2,2181},
+{-1300,1971},
+{2,668},
+{2,805},
+{0,1808},
+{0,133},
+{-1299,1628},
+{4,1328},
+{1,369},
+{1,1458},
+{0,1207},
+{2,346},
+{10,2207},
+{2,614},
+{4,1673},
+{0,1801},
+{5,659},
+{1,850},
+{-1295,1790},
+{-1294,452},
+{0,151},
+{-1289,2051},
+{1,310},
+{1,297},
+{0,535},
+{0,1252},
+{0,209},
+{0,1270},
+{0,686},
+{0,2040},
+{2,566},
+{-1288,911},
+{-1283,1612},
+{1,2015},
+{-1282,1851},
+{0,526},
+{-1280,506},
+{0,277},
+{2,79},
+{0,1423},
+{0,525},
+{0,1588},
+{0,1234},
+{1,1300},
+{0,619},
+{0,890},
+{1,994},
+{0,541},
+{-1277,425},
+{7,1027},
+{0,1148},
+{-1275,1306},
+{0,985},
+{0,1993},
+{-1274,1168},
+{-1271,2014},
+{0,402},
+{-1270,140},
+{1,1749},
+{3,1425},
+{-1269,915},
+{0,1},
+{-1264,1255},
+{-1263,2189},
+{-1260,1732},
+{1,855},
+{0,1708},
+{1,1339},
+{0,1484},
+{-1259,92},
+{1,692},
+{0,2180},
+{1,876},
+{-1254,16},
+{0,232},
+{-1253,1889},
+{-1252,199},
+{0,183},
+{2,1853},
+{4,1017},
+{-1251,1284},
+{-1249,1510},
+{0,1902},
+{1,1010},
+{2,834},
+{3,1256},
+{0,1909},
+{2,728},
+{0,1703},
+{0,952},
+{0,951},
+{0,1309},
+{-1248,303},
+{3,1215},
+{-1244,853},
+{0,1457},
+{-1242,136},
+{5,1180},
+{-1241,865},
+{0,777},
+{0,673},
+{0,1826},
+{1,1061},
+{-1240,646},
+{2,417},
+{0,116},
+{1,2197},
+{-1238,32},
+{0,2110},
+{0,1788},
+{30,1983},
+{-1236,1843},
+{0,1705},
+{0,613},
+{6,531},
+{0,807},
+{-1234,751},
+{-1232,271},
+{-1230,564},
+{0,2217},
+{0,1352},
+{0,110},
+{0,236},
+{-1228,1532},
+{0,84},
+{-1226,1638},
+{0,2121},
+{-1225,664},
+{0,1560},
+{3,424},
+{-1224,1409},
+{0,578},
+{0,843},
+{2,1427},
+{0,2144},
+{-1223,1687},
+{0,1316},
+{-1222,1224},
+{-1220,761},
+{1,599},
+{-1219,1195},
+{-1218,1524},
+{1,493},
+{-1217,1205},
+{3,1603},
+{1,1844},
+{7,749},
+{7,1197},
+{0,1922},
+{-1216,1754},
+{4,2083},
+{2,993},
+{-1210,1582},
+{-1209,311},
+{3,953},
+{4,1451},
+{1,986},
+{0,454},
+{0,2117},
+{0,1254},
+{-1207,36},
+{-1205,200},
+{0,1837},
+{-1204,466},
+{0,929},
+{-1199,982},
+{0,15},
+{0,934},
+{0,960},
+{0,1209},
+{10,1236},
+{0,836},
+{-1198,2193},
+{1,1020},
+{8,1942},
+{9,314},
+{-1196,119},
+{0,1781},
+{0,280},
+{-1195,1507},
+{0,408},
+{0,746},
+{2,956},
+{-1189,1469},
+{0,970},
+{-1188,2148},
+{-1184,403},
+{-1179,1568},
+{-1173,1970},
+{0,1190},
+{-1170,1946},
+{1,1513},
+{0,1440},
+{-1169,2212},
+{-1168,306},
+{-1166,1097},
+{0,147},
+{-1163,121},
+{-1161,412},
+{1,528},
+{-1158,250},
+{-1156,1104},
+{2,1093},
+{-1153,2056},
+{0,125},
+{-1150,1193},
+{0,2131},
+{0,164},
+{-1148,2123},
+{0,1931},
+{0,2093},
+{-1146,1369},
+{1,1848},
+{-1145,2104},
+{-1144,179},
+{-1140,1259},
+{3,102},
+{-1138,1846},
+{-1137,670},
+{0,1992},
+{1,255},
+{-1136,156},
+{-1129,325},
+{-1128,944},
+{0,2183},
+{0,1836},
+{0,779},
+{-1127,1435},
+{-1121,2088},
+{-1120,1171},
+{-1119,222},
+{0,532},
+{1,585},
+{-1117,1449},
+{0,1156},
+{-1114,1198},
+{-1113,382},
+{0,295},
+{-1112,1278},
+{0,1392},
+{0,2078},
+{4,521},
+{-1110,69},
+{1,1869},
+{1,1000},
+{0,2223},
+{-1109,172},
+{0,782},
+{-1108,966},
+{2,350},
+{0,547},
+{5,385},
+{0,101},
+{1,1614},
+{0,2067},
+{-1105,538},
+{0,870},
+{0,783},
+{0,2097},
+{-1100,1518},
+{11,1414},
+{0,298},
+{1,829},
+{0,1325},
+{-1099,211},
+{3,372},
+{-1098,1111},
+{0,654},
+{0,2057},
+{4,730},
+{0,482},
+{0,1692},
+{4,1918},
+{0,1244},
+{0,648},
+{-1097,582},
+{-1095,949},
+{0,275},
+{0,579},
+{8,1285},
+{-1094,1509},
+{1,55},
+{0,988},
+{-1093,1317},
+{0,1350},
+{2,631},
+{-1088,1928},
+{-1087,354},
+{8,1819},
+{2,1611},
+{11,1623},
+{-1075,1861},
+{-1074,1054},
+{-1073,1976},
+{-1072,603},
+{3,972},
+{-1070,1138},
+{0,1228},
+{0,1039},
+{-1067,219},
+{0,1632},
+{0,2221},
+{-1066,1351},
+{-1057,1453},
+{0,27},
+{0,1744},
+{1,795},
+{-1056,214},
+{-1048,740},
+{-1047,792},
+{-1044,174},
+{-1039,42},
+{-1038,1580},
+{1,1341},
+{0,2064},
+{0,1534},
+{-1035,2192},
+{0,750},
+{-1034,2045},
+{0,513},
+{0,1694},
+{0,560},
+{0,636},
+{0,1700},
+{1,1424},
+{0,148},
+{-1032,1965},
+{4,571},
+{0,2069},
+{-1031,1053},
+{-1030,1948},
+{0,917},
+{0,68},
+{-1029,536},
+{0,981},
+{0,1763},
+{-1025,1088},
+{0,2071},
+{1,1401},
+{0,858},
+{2,206},
+{1,1686},
+{-1022,34},
+{-1020,867},
+{0,1961},
+{1,338},
+{-1015,1562},
+{-1014,373},
+{1,2138},
+{0,628},
+{0,1387},
+{0,1598},
+{1,1613},
+{-1011,90},
+{0,1320},
+{-1010,1863},
+{2,2084},
+{-1005,1483},
+{-1003,558},
+{-1001,1073},
+{0,2074},
+{3,1237},
+{-1000,1426},
+{-998,1023},
+{0,1109},
+{-996,2017},
+{1,892},
+{1,22},
+{0,841},
+{-995,1173},
+{0,1944},
+{0,2091},
+{4,1736},
+{-994,928},
+{0,117},
+{0,2114},
+{0,2229},
+{-991,1519},
+{0,2170},
+{-989,1674},
+{-987,1174},
+{3,559},
+{-983,162},
+{0,593},
+{0,1276},
+{1,437},
+{0,838},
+{0,550},
+{-982,1232},
+{0,157},
+{8,903},
+{-979,246},
+{-977,217},
+{0,852},
+{2,734},
+{-975,1926},
+{-973,1656},
+{4,97},
+{-972,1085},
+{1,76},
+{-970,1626},
+{-967,1624},
+{1,879},
+{2,1898},
+{2,2184},
+{0,29},
+{-966,201},
+{0,794},
+{0,1877},
+{-962,998},
+{-958,2226},
+{13,1621},
+{-957,737},
+{-956,1145},
+{-955,1780},
+{-953,765},
+{-952,1761},
+{0,1594},
+{0,1083},
+{-951,882},
+{2,268},
+{-950,1742},
+{1,2159},
+{-946,1239},
+{-944,501},
+{2,1885},
+{0,1521},
+{-943,923},
+{-935,1281},
+{0,38},
+{-933,96},
+{0,1578},
+{0,989},
+{2,880},
+{2,1113},
+{-931,898},
+{1,2157},
+{0,457},
+{-930,2161},
+{-927,467},
+{0,1377},
+{0,641},
+{0,248},
+{0,52},
+{-923,964},
+{1,48},
+{0,1957},
+{0,780},
+{-917,1041},
+{-914,650},
+{0,1758},
+{0,1465},
+{-913,500},
+{1,1665},
+{0,323},
+{1,2106},
+{5,1917},
+{-910,1263},
+{3,612},
+{-909,1358},
+{4,1006},
+{1,854},
+{0,832},
+{0,1421},
+{0,1897},
+{-908,663},
+{-907,62},
+{9,710},
+{4,1245},
+{-904,891},
+{7,570},
+{0,1573},
+{0,1069},
+{0,1047},
+{-895,1838},
+{-894,2062},
+{0,2041},
+{0,1698},
+{-892,947},
+{-887,326},
+{0,514},
+{10,1247},
+{0,2191},
+{-883,2218},
+{1,1792},
+{32,1184},
+{0,302},
+{-882,1372},
+{-880,1733},
+{0,1682},
+{1,888},
+{-876,1903},
+{2,825},
+{1,1649},
+{0,261},
+{0,1340},
+{0,2172},
+{0,305},
+{0,1515},
+{0,1422},
+{0,432},
+{1,778},
+{0,2149},
+{-875,1491},
+{1,1602},
+{0,361},
+{0,2109},
+{-874,1657},
+{0,1304},
+{-873,404},
+{0,1218},
+{-870,1420},
+{1,1289},
+{5,1997},
+{0,1055},
+{5,1106},
+{-868,479},
+{-861,1336},
+{-859,1442},
+{-856,330},
+{0,1371},
+{-852,352},
+{3,301},
+{1,954},
+{-842,1783},
+{1,661},
+{-840,1710},
+{-832,914},
+{0,2008},
+{3,235},
+{-828,2018},
+{0,203},
+{-826,145},
+{0,3},
+{0,153},
+{5,554},
+{-825,835},
+{0,910},
+{-822,1092},
+{-817,1599},
+{2,72},
+{3,1186},
+{0,1939},
+{2,1658},
+{-813,78},
+{0,359},
+{-812,1242},
+{-810,2211},
+{-809,637},
+{0,771},
+{-808,1530},
+{-803,708},
+{-801,1709},
+{0,1386},
+{0,439},
+{0,344},
+{-800,1009},
+{1,1542},
+{0,1789},
+{0,70},
+{7,1454},
+{-795,767},
+{1,294},
+{5,584},
+{0,652},
+{0,132},
+{2,188},
+{-792,1741},
+{12,503},
+{3,694},
+{4,2142},
+{1,2116},
+{0,995},
+{1,1895},
+{-790,588},
+{-781,290},
+{5,1868},
+{0,616},
+{1,1129},
+{0,1501},
+{0,632},
+{1,633},
+{2,932},
+{0,1653},
+{6,1633},
+{0,1456},
+{0,30},
+{-779,130},
+{0,486},
+{-778,58},
+{-776,1883},
+{-771,384},
+{-767,1554},
+{0,1407},
+{1,225},
+{0,1095},
+{0,1593},
+{7,2220},
+{-765,534},
+{2,601},
+{15,1809},
+{0,1757},
+{-757,267},
+{-747,1028},
+{-741,2024},
+{0,1779},
+{4,638},
+{3,1699},
+{4,360},
+{4,696},
+{0,265},
+{0,1974},
+{-740,1382},
+{-739,1512},
+{0,669},
+{2,1413},
+{-737,894},
+{1,1981},
+{0,1032},
+{0,822},
+{3,1520},
+{-736,4},
+{0,1764},
+{-734,1411},
+{0,429},
+{-731,2209},
+{-728,1504},
+{0,2140},
+{-719,595},
+{0,333},
+{0,2208},
+{-718,1803},
+{0,196},
+{-715,945},
+{0,691},
+{-713,575},
+{-710,80},
+{0,1378},
+{-705,1816},
+{-702,1117},
+{0,230},
+{0,448},
+{0,1279},
+{0,1737},
+{0,1690},
+{4,1537},
+{0,1683},
+{2,1294},
+{-701,400},
+{0,1130},
+{5,1459},
+{-697,465},
+{3,1367},
+{-687,2134},
+{0,2061},
+{1,1786},
+{1,296},
+{1,520},
+{-675,1927},
+{9,693},
+{0,727},
+{0,2215},
+{-671,1645},
+{0,2185},
+{-670,2175},
+{-668,630},
+{-663,337},
+{4,2177},
+{0,272},
+{0,823},
+{-661,1223},
+{0,1872},
+{-659,155},
+{4,1745},
+{0,665},
+{0,395},
+{-657,1008},
+{0,649},
+{4,1866},
+{-656,118},
+{-655,918},
+{0,187},
+{-653,913},
+{-651,106},
+{0,426},
+{0,739},
+{5,703},
+{-650,499},
+{-649,129},
+{0,2173},
+{1,2050},
+{0,414},
+{3,716},
+{-647,1835},
+{1,1634},
+{7,442},
+{0,1990},
+{12,1396},
+{-646,502},
+{5,820},
+{-644,810},
+{-642,472},
+{-641,51},
+{0,497},
+{1,1187},
+{0,873},
+{0,1181},
+{-640,2049},
+{0,1361},
+{-639,977},
+{-638,555},
+{0,984},
+{-635,1035},
+{-633,496},
+{1,49},
+{-632,185},
+{0,276},
+{0,1500},
+{-629,788},
+{-626,717},
+{-623,1333},
+{0,682},
+{-618,33},
+{-617,1860},
+{-612,772},
+{3,826},
+{0,1175},
+{71,10},
+{-611,473},
+{-610,621},
+{4,1257},
+{-608,1277},
+{2,660},
+{0,1964},
+{1,170},
+{2,741},
+{0,565},
+{-606,37},
+{-601,752},
+{0,563},
+{-600,958},
+{2,184},
+{-598,2162},
+{9,1689},
+{0,488},
+{0,401},
+{-595,368},
+{-593,9},
+{-586,818},
+{5,390},
+{-585,1078},
+{-584,698},
+{-581,1132},
+{0,842},
+{0,1828},
+{2,557},
+{-579,287},
+{-569,278},
+{4,1535},
+{-568,1814},
+{0,428},
+{-567,464},
+{0,1806},
+{2,1994},
+{-564,1114},
+{-560,887},
+{4,1403},
+{-558,1359},
+{2,813},
+{-556,688},
+{-555,226},
+{0,2182},
+{-554,773},
+{0,313},
+{1,494},
+{3,1269},
+{0,234},
+{-550,1503},
+{-549,388},
+{0,2204},
+{-545,1063},
+{10,1405},
+{0,1314},
+{0,602},
+{-543,1196},
+{-542,1625},
+{3,1062},
+{-541,198},
+{8,543},
+{1,1567},
+{-534,1120},
+{-529,1321},
+{3,1617},
+{-523,71},
+{-520,1933},
+{20,1691},
+{0,1695},
+{-518,2028},
+{1,1975},
+{0,831},
+{-515,2043},
+{-511,1026},
+{6,605},
+{-497,257},
+{0,527},
+{-496,1044},
+{0,658},
+{-495,878},
+{-494,789},
+{3,2087},
+{-491,1231},
+{-489,94},
+{-482,374},
+{-478,324},
+{0,906},
+{-477,545},
+{3,490},
+{-473,353},
+{0,213},
+{9,1601},
+{0,629},
+{0,800},
+{6,1394},
+{-472,1996},
+{0,377},
+{1,2194},
+{-471,1938},
+{-468,802},
+{-467,168},
+{0,1873},
+{0,1776},
+{2,393},
+{0,1552},
+{1,1540},
+{-465,1310},
+{-464,1250},
+{0,2141},
+{4,406},
+{-460,1064},
+{-459,1019},
+{0,1444},
+{0,1856},
+{2,1661},
+{-454,671},
+{0,992},
+{-453,171},
+{1,1164},
+{-444,1087},
+{0,1391},
+{0,889},
+{20,242},
+{0,1029},
+{0,282},
+{-442,683},
+{-440,1766},
+{-432,1125},
+{0,19},
+{0,2066},
+{0,1086},
+{-430,1432},
+{-429,264},
+{0,371},
+{0,459},
+{-427,1726},
+{-422,1322},
+{6,366},
+{-419,1701},
+{-418,23},
+{3,2137},
+{5,706},
+{0,1002},
+{0,113},
+{1,1953},
+{-417,340},
+{-416,2089},
+{10,379},
+{-413,2094},
+{-412,1390},
+{0,712},
+{-411,5},
+{-410,2046},
+{10,1397},
+{0,2166},
+{0,729},
+{3,940},
+{0,1630},
+{-409,348},
+{2,53},
+{-408,478},
+{-407,1137},
+{-406,2125},
+{-405,856},
+{0,25},
+{-404,1472},
+{0,150},
+{-402,1751},
+{0,1715},
+{0,1930},
+{0,1572},
+{0,1030},
+{-400,2115},
+{0,1116},
+{-398,518},
+{0,1370},
+{-394,1466},
+{-390,899},
+{0,948},
+{0,1033},
+{-389,274},
+{10,269},
+{-384,1915},
+{-383,748},
+{12,1417},
+{-382,1264},
+{-378,821},
+{-374,189},
+{0,1446},
+{-371,811},
+{-369,1099},
+{0,1496},
+{1,329},
+{2,2147},
+{0,950},
+{0,1858},
+{-367,1756},
+{0,620},
+{0,376},
+{0,221},
+{-366,844},
+{1,1389},
+{-364,1849},
+{-362,1133},
+{0,2122},
+{-361,1728},
+{13,1353},
+{0,2002},
+{0,1962},
+{0,766},
+{4,1159},
+{0,215},
+{0,901},
+{12,996},
+{-358,1452},
+{-357,1166},
+{0,897},
+{-355,2102},
+{-354,1036},
+{-347,375},
+{2,212},
+{1,759},
+{0,1049},
+{0,1592},
+{0,1043},
+{0,2009},
+{28,161},
+{2,1042},
+{0,349},
+{-345,122},
+{0,1107},
+{-341,1899},
+{1,886},
+{-340,1455},
+{-339,804},
+{0,1072},
+{-338,356},
+{0,441},
+{-335,1050},
+{0,530},
+{-334,286},
+{0,1576},
+{-330,1374},
+{1,1408},
+{0,1249},
+{19,175},
+{1,422},
+{0,1738},
+{1,987},
+{-327,2007},
+{0,419},
+{0,598},
+{8,405},
+{-326,397},
+{0,2004},
+{0,968},
+{0,2227},
+{16,1604},
+{2,781},
+{0,1307},
+{-325,798},
+{3,725},
+{0,1533},
+{0,544},
+{0,158},
+{0,509},
+{0,308},
+{4,1890},
+{5,1664},
+{0,1784},
+{-322,774},
+{2,1972},
+{16,1906},
+{-315,1635},
+{3,1365},
+{-311,2033},
+{-310,1597},
+{1,861},
+{0,1882},
+{-308,339},
+{0,1311},
+{-306,1487},
+{-294,224},
+{-293,475},
+{-290,63},
+{-287,1439},
+{0,2073},
+{1,736},
+{0,41},
+{-286,709},
+{0,444},
+{0,1025},
+{-285,1716},
+{0,2065},
+{2,1275},
+{0,1896},
+{-283,1368},
+{1,1243},
+{0,1204},
+{5,138},
+{-282,902},
+{2,1666},
+{-280,104},
+{0,764},
+{-279,111},
+{-278,291},
+{0,1068},
+{-277,1331},
+{23,266},
+{-275,755},
+{-273,1348},
+{54,2103},
+{-269,1982},
+{0,398},
+{0,1355},
+{0,1919},
+{0,1003},
+{-268,218},
+{1,1381},
+{-266,1765},
+{0,735},
+{0,1074},
+{27,1678},
+{-265,1551},
+{3,1471},
+{0,446},
+{-263,833},
+{2,2096},
+{1,262},
+{-261,57},
+{0,1220},
+{-260,1324},
+{4,1360},
+{-257,1546},
+{0,1829},
+{-254,318},
+{-252,461},
+{9,436},
+{0,1345},
+{5,1288},
+{9,228},
+{13,1824},
+{-251,1046},
+{10,1772},
+{41,2027},
+{0,803},
+{0,553},
+{0,2222},
+{7,548},
+{-250,0},
+{-246,1141},
+{0,195},
+{2,89},
+{0,1380},
+{3,2158},
+{0,1817},
+{-240,1595},
+{0,1739},
+{0,1165},
+{0,1932},
+{2,1182},
+{0,2038},
+{-237,1067},
+{0,370},
+{-235,1481},
+{0,1222},
+{0,1048},
+{1,1248},
+{-230,1225},
+{9,1385},
+{0,515},
+{1,1548},
+{1,702},
+{-225,1221},
+{-220,797},
+{-219,481},
+{0,1399},
+{-218,2099},
+{-217,423},
+{0,920},
+{0,252},
+{0,1545},
+{0,1555},
+{0,182},
+{0,849},
+{-210,517},
+{0,367},
+{-207,433},
+{0,1760},
+{-206,251},
+{-204,1094},
+{20,378},
+{-196,1958},
+{-195,1024},
+{0,1283},
+{19,979},
+{-186,1778},
+{1,769},
+{0,562},
+{0,678},
+{0,983},
+{-185,2060},
+{-180,930},
+{4,1122},
+{0,134},
+{1,2108},
+{0,1585},
+{-177,1966},
+{-174,2111},
+{0,173},
+{23,1541},
+{-171,2080},
+{0,109},
+{-169,17},
+{-168,1864},
+{10,6},
+{11,259},
+{-166,1570},
+{1,1115},
+{-161,1349},
+{6,2048},
+{-159,1642},
+{0,2230},
+{-155,1443},
+{-151,233},
+{2,207},
+{-149,961},
+{2,47},
+{-148,1956},
+{31,1704},
+{12,1412},
+{0,1707},
+{-146,904},
+{2,2133},
+{2,1940},
+{-143,1082},
+{-142,2167},
+{0,351},
+{0,1734},
+{0,1337},
+{-141,896},
+{28,244},
+{0,776},
+{-134,316},
+{0,743},
+{0,1517},
+{-129,309},
+{0,1395},
+{1,2025},
+{4,1071},
+{0,289},
+{0,1910},
+{17,539},
+{0,1901},
+{8,791},
+{-128,1342},
+{-118,756},
+{0,2153},
+{4,2200},
+{0,1260},
+{0,1398},
+{0,1999},
+{0,529},
+{5,967},
+{0,1271},
+{43,937},
+{-116,625},
+{-112,1261},
+{0,676},
+{26,1616},
+{-109,1155},
+{0,955},
+{-107,131},
+{12,190},
+{-105,77},
+{0,1108},
+{-103,54},
+{-102,320},
+{0,469},
+{-101,1301},
+{-99,1862},
+{-97,1302},
+{0,13},
+{-93,1460},
+{-92,549},
+{0,653},
+{0,1949},
+{0,851},
+{7,431},
+{-88,943},
+{-85,139},
+{0,144},
+{0,758},
+{0,347},
+{3,2012},
+{-84,1015},
+{1,39},
+{-77,1798},
+{0,828},
+{0,997},
+{0,1937},
+{-73,1767},
+{1,704},
+{-70,542},
+{0,713},
+{-69,770},
+{3,1543},
+{5,1034},
+{2,1267},
+{-68,181},
+{9,484},
+{0,1303},
+{0,1280},
+{9,714},
+{4,2101},
+{-63,1362},
+{0,610},
+{-59,1470},
+{-58,868},
+{-57,180},
+{0,1663},
+{-49,1850},
+{3,1158},
+{-48,319},
+{-45,2107},
+{1,1893},
+{-39,1834},
+{-34,1950},
+{-32,210},
+{-30,2068},
+{4,1823},
+{0,8},
+{-29,1941},
+{0,1318},
+{0,2203},
+{-22,862},
+{0,801},
+{0,1827},
+{1,2205},
+{0,1299},
+{9,103},
+{10,2163},
+{8,840},
+{-15,656},
+{-11,24},
+{0,1051},
+{-3,1855},
+// clang-format on
+// NOLINTEND
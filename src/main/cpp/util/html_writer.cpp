@@ -1,8 +1,17 @@
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <string_view>
 #include <vector>
 
+#if !defined(COWEL_DISABLE_ARCH_INTRINSICS) && (defined(__SSE2__) || defined(_M_X64))
+#define COWEL_HTML_ESCAPE_SSE2
+#include <emmintrin.h>
+#endif
+
 #include "cowel/util/assert.hpp"
 #include "cowel/util/chars.hpp"
 #include "cowel/util/html_writer.hpp"
@@ -14,17 +23,22 @@ namespace cowel {
 
 namespace {
 
+// The HTML entities of the characters which are escaped, indexed by the character.
+constexpr auto html_entity_table = [] {
+    std::array<std::u8string_view, 128> result {};
+    result[u8'&'] = u8"&amp;";
+    result[u8'<'] = u8"&lt;";
+    result[u8'>'] = u8"&gt;";
+    result[u8'\''] = u8"&apos;";
+    result[u8'"'] = u8"&quot;";
+    return result;
+}();
+
 [[nodiscard]]
 std::u8string_view html_entity_of(char8_t c)
 {
-    switch (c) {
-    case u8'&': return u8"&amp;";
-    case u8'<': return u8"&lt;";
-    case u8'>': return u8"&gt;";
-    case u8'\'': return u8"&apos;";
-    case u8'"': return u8"&quot;";
-    default: COWEL_ASSERT_UNREACHABLE(u8"We only support a handful of characters.");
-    }
+    COWEL_ASSERT(c < html_entity_table.size() && !html_entity_table[c].empty());
+    return html_entity_table[c];
 }
 
 [[nodiscard]]
@@ -34,6 +48,68 @@ std::u8string_view html_entity_of(char32_t c)
     return html_entity_of(char8_t(c));
 }
 
+/// @brief Returns the index of the first character in `text` which is one of `escaped`,
+/// or `text.size()` if there is none.
+/// Blocks of characters are classified at once, which matters because most text consists of
+/// long runs of characters that don't need escaping.
+template <char8_t... escaped>
+[[nodiscard]]
+std::size_t find_first_escaped(std::u8string_view text)
+{
+    std::size_t i = 0;
+#ifdef COWEL_HTML_ESCAPE_SSE2
+    for (; i + 16 <= text.size(); i += 16) {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text.data() + i));
+        __m128i matches = _mm_setzero_si128();
+        ((matches = _mm_or_si128(matches, _mm_cmpeq_epi8(block, _mm_set1_epi8(char(escaped))))),
+         ...);
+        if (const auto mask = unsigned(_mm_movemask_epi8(matches))) {
+            return i + std::size_t(std::countr_zero(mask));
+        }
+    }
+#else
+    if constexpr (std::endian::native == std::endian::little) {
+        // Bytes which equal an escaped character become zero after XOR,
+        // and the lowest zero byte in a word is found exactly by the well-known
+        // "has zero byte" trick (only bytes above it can be false positives).
+        constexpr std::uint64_t ones = 0x0101'0101'0101'0101;
+        constexpr std::uint64_t highs = 0x8080'8080'8080'8080;
+        const auto zero_bytes = [](std::uint64_t x) { return (x - ones) & ~x & highs; };
+        for (; i + 8 <= text.size(); i += 8) {
+            std::uint64_t block;
+            std::memcpy(&block, text.data() + i, sizeof(block));
+            const std::uint64_t matches = (zero_bytes(block ^ (ones * escaped)) | ...);
+            if (matches != 0) {
+                return i + std::size_t(std::countr_zero(matches) / 8);
+            }
+        }
+    }
+#endif
+    for (; i < text.size(); ++i) {
+        if (((text[i] == escaped) || ...)) {
+            return i;
+        }
+    }
+    return text.size();
+}
+
+template <char8_t... escaped>
+void append_html_escaped_with(std::pmr::vector<char8_t>& out, std::u8string_view text)
+{
+    // Usually, little to no escaping takes place,
+    // so this is almost always the right amount of memory.
+    out.reserve(out.size() + text.size());
+    while (!text.empty()) {
+        const std::size_t pos = find_first_escaped<escaped...>(text);
+        append(out, text.substr(0, pos));
+        if (pos == text.size()) {
+            break;
+        }
+        append(out, html_entity_table[text[pos]]);
+        text.remove_prefix(pos + 1);
+    }
+}
+
 } // namespace
 
 void append(std::pmr::vector<char8_t>& out, std::u8string_view text)
@@ -47,6 +123,19 @@ void append_html_escaped(
     std::u8string_view charset
 )
 {
+    // The charsets used for inner text, attribute values, and comments have fast paths.
+    if (charset == u8"&<>") {
+        append_html_escaped_with<u8'&', u8'<', u8'>'>(out, text);
+        return;
+    }
+    if (charset == u8"\"'") {
+        append_html_escaped_with<u8'"', u8'\''>(out, text);
+        return;
+    }
+    if (charset == u8"<>") {
+        append_html_escaped_with<u8'<', u8'>'>(out, text);
+        return;
+    }
     while (!text.empty()) {
         const std::size_t bracket_pos = text.find_first_of(charset);
         const auto snippet = text.substr(0, std::min(text.length(), bracket_pos));
@@ -89,8 +178,17 @@ void HTML_Writer::write_inner_text(char32_t c)
 void HTML_Writer::write_inner_text(std::u32string_view text)
 {
     COWEL_ASSERT(!m_in_attributes);
-    for (const char32_t c : text) {
-        write_inner_text(c);
+    while (!text.empty()) {
+        const auto escaped = std::ranges::find_if_not(text, [](char32_t c) {
+            return is_html_min_raw_passthrough_character(c);
+        });
+        const auto pos = std::size_t(escaped - text.begin());
+        utf8::append_encoded8(m_out, text.substr(0, pos));
+        if (pos == text.size()) {
+            break;
+        }
+        append(m_out, html_entity_of(text[pos]));
+        text.remove_prefix(pos + 1);
     }
 }
 
@@ -110,9 +208,7 @@ void HTML_Writer::write_inner_html(std::u8string_view text)
 void HTML_Writer::write_inner_html(std::u32string_view text)
 {
     COWEL_ASSERT(!m_in_attributes);
-    for (const char32_t c : text) {
-        write_inner_html(c);
-    }
+    utf8::append_encoded8(m_out, text);
 }
 
 HTML_Writer& HTML_Writer::write_preamble()
@@ -228,9 +324,7 @@ HTML_Writer& HTML_Writer::write_attribute(
                 break;
             }
             case Attribute_Encoding::url: {
-                url_encode_ascii_if(std::back_inserter(m_out), part, [](char8_t c) {
-                    return is_url_always_encoded(c);
-                });
+                append_url_encoded(m_out, part);
                 break;
             }
             }
@@ -245,11 +339,9 @@ HTML_Writer& HTML_Writer::write_attribute(
                 break;
             }
             case Attribute_Encoding::url: {
-                url_encode_ascii_if(std::back_inserter(m_out), part, [](char8_t c) {
-                    static_assert(is_url_always_encoded(u8'"'));
-                    static_assert(!is_url_always_encoded(u8'\''));
-                    return c == u8'\'' || is_url_always_encoded(c);
-                });
+                static_assert(is_url_always_encoded(u8'"'));
+                static_assert(!is_url_always_encoded(u8'\''));
+                append_url_encoded(m_out, part, URL_Encoded_Set::always_and_apostrophe);
                 break;
             }
             }
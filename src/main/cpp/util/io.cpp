@@ -1,5 +1,12 @@
 #ifndef COWEL_EMSCRIPTEN
 
+#ifdef __unix__
+#include <cerrno>
+#include <stdio.h> // NOLINT for fileno
+#include <sys/uio.h>
+#endif
+
+#include <algorithm>
 #include <bit>
 #include <cstddef>
 #include <cstdio>
@@ -50,6 +57,67 @@ Result<void, IO_Error_Code> file_to_bytes_chunked(
     return {};
 }
 
+Result<void, IO_Error_Code>
+write_to_file(std::FILE* file, std::span<const std::u8string_view> pieces)
+{
+#ifdef __unix__
+    if (std::fflush(file) != 0) {
+        return IO_Error_Code::write_error;
+    }
+    const int fd = fileno(file);
+
+    // Most systems support at least 1024 buffers per call,
+    // and POSIX guarantees at least 16.
+    constexpr std::size_t max_buffers = 64;
+    iovec buffers[max_buffers];
+
+    while (!pieces.empty()) {
+        const std::size_t count = std::min(pieces.size(), max_buffers);
+        for (std::size_t i = 0; i < count; ++i) {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+            buffers[i].iov_base = const_cast<char8_t*>(pieces[i].data());
+            buffers[i].iov_len = pieces[i].size();
+        }
+
+        // writev may write fewer bytes than requested,
+        // in which case we advance through the buffers and try again.
+        std::span<iovec> remaining { buffers, count };
+        while (!remaining.empty()) {
+            const auto written = ::writev(fd, remaining.data(), int(remaining.size()));
+            if (written < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                return IO_Error_Code::write_error;
+            }
+            auto left = std::size_t(written);
+            while (!remaining.empty() && left >= remaining.front().iov_len) {
+                left -= remaining.front().iov_len;
+                remaining = remaining.subspan(1);
+            }
+            if (left != 0) {
+                remaining.front().iov_base = static_cast<char*>(remaining.front().iov_base) + left;
+                remaining.front().iov_len -= left;
+            }
+            else if (written == 0 && !remaining.empty()) {
+                // Nothing was written even though data remains,
+                // so trying again would likely never make progress.
+                return IO_Error_Code::write_error;
+            }
+        }
+        pieces = pieces.subspan(count);
+    }
+    return {};
+#else
+    for (const std::u8string_view piece : pieces) {
+        if (std::fwrite(piece.data(), 1, piece.size(), file) != piece.size()) {
+            return IO_Error_Code::write_error;
+        }
+    }
+    return {};
+#endif
+}
+
 Result<void, IO_Error_Code> load_utf8_file(std::pmr::vector<char8_t>& out, std::u8string_view path)
 {
     const std::size_t initial_size = out.size();
@@ -0,0 +1,89 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <string_view>
+#include <vector>
+
+#if !defined(COWEL_DISABLE_ARCH_INTRINSICS) && (defined(__SSE2__) || defined(_M_X64))
+#define COWEL_UTF32_SSE2
+#include <emmintrin.h>
+#endif
+
+#include "cowel/util/assert.hpp"
+#include "cowel/util/chars.hpp"
+#include "cowel/util/unicode.hpp"
+
+namespace cowel::utf8 {
+
+namespace {
+
+/// @brief Encodes the longest prefix of `text` which consists only of ASCII characters,
+/// in blocks of multiple characters where possible.
+/// @returns The amount of code points encoded.
+/// Each of these has been written to `out` as a single code unit.
+[[nodiscard]]
+std::size_t encode8_ascii_prefix(std::u32string_view text, char8_t* out) noexcept
+{
+    std::size_t i = 0;
+#ifdef COWEL_UTF32_SSE2
+    const __m128i non_ascii_bits = _mm_set1_epi32(~0x7f);
+    for (; i + 8 <= text.size(); i += 8) {
+        const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text.data() + i));
+        const __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text.data() + i + 4));
+        const __m128i non_ascii = _mm_and_si128(_mm_or_si128(lo, hi), non_ascii_bits);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(non_ascii, _mm_setzero_si128())) != 0xffff) {
+            break;
+        }
+        // All values are below 128, so saturation never kicks in while narrowing,
+        // and the low 8 bytes of the result are the eight code units.
+        const __m128i narrow16 = _mm_packs_epi32(lo, hi);
+        const __m128i narrow8 = _mm_packus_epi16(narrow16, narrow16);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(out + i), narrow8);
+    }
+#endif
+    for (; i < text.size() && is_ascii(text[i]); ++i) {
+        out[i] = char8_t(text[i]);
+    }
+    return i;
+}
+
+} // namespace
+
+std::size_t encoded_length8(std::u32string_view text) noexcept
+{
+    // This is branchless so that it can be vectorized.
+    std::size_t result = 0;
+    for (const char32_t c : text) {
+        result += 1 + std::size_t(c >= 0x80) + std::size_t(c >= 0x800) + std::size_t(c >= 0x10000);
+    }
+    return result;
+}
+
+char8_t* encode8_unchecked(std::u32string_view text, char8_t* out) noexcept
+{
+    while (!text.empty()) {
+        const std::size_t ascii_length = encode8_ascii_prefix(text, out);
+        out += ascii_length;
+        text.remove_prefix(ascii_length);
+
+        // Non-ASCII characters tend to come in runs (e.g. in non-Latin text),
+        // so we don't go back to looking for ASCII blocks after every character.
+        for (; !text.empty() && !is_ascii(text.front()); text.remove_prefix(1)) {
+            COWEL_DEBUG_ASSERT(is_scalar_value(text.front()));
+            const Code_Units_And_Length encoded = encode8_unchecked(text.front());
+            out = std::ranges::copy(encoded.as_string(), out).out;
+        }
+    }
+    return out;
+}
+
+void append_encoded8(std::pmr::vector<char8_t>& out, std::u32string_view text)
+{
+    const std::size_t old_size = out.size();
+    out.resize(old_size + encoded_length8(text));
+    [[maybe_unused]] char8_t* const end = encode8_unchecked(text, out.data() + old_size);
+    COWEL_DEBUG_ASSERT(end == out.data() + out.size());
+}
+
+} // namespace cowel::utf8
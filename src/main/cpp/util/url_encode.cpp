@@ -0,0 +1,213 @@
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <memory_resource>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#if !defined(COWEL_DISABLE_ARCH_INTRINSICS) && (defined(__SSE2__) || defined(_M_X64))
+#define COWEL_URL_ENCODE_SSE2
+#include <emmintrin.h>
+#endif
+
+#include "cowel/util/assert.hpp"
+#include "cowel/util/chars.hpp"
+#include "cowel/util/html_writer.hpp"
+#include "cowel/util/url_encode.hpp"
+
+#include "cowel/fwd.hpp"
+
+namespace cowel {
+namespace {
+
+/// @brief For each code unit, `true` if it is percent-encoded.
+/// Like in `url_encode_ascii_if`, non-ASCII code units are never encoded.
+using URL_Encoded_Table = std::array<bool, 256>;
+
+[[nodiscard]]
+consteval URL_Encoded_Table make_url_encoded_table(bool encode_apostrophe)
+{
+    URL_Encoded_Table result {};
+    for (std::size_t c = 0; c < 128; ++c) {
+        result[c] = is_url_always_encoded(char8_t(c)) || (encode_apostrophe && c == u8'\'');
+    }
+    return result;
+}
+
+constexpr URL_Encoded_Table url_encoded_tables[] {
+    make_url_encoded_table(false),
+    make_url_encoded_table(true),
+};
+
+#ifdef COWEL_URL_ENCODE_SSE2
+// Blocks are classified as follows:
+// ASCII control characters and space are matched by a range comparison,
+// and each of the few other encoded characters is matched individually.
+// These are obtained from the table, so the two cannot get out of sync.
+
+constexpr char8_t first_printable = u8'!';
+constexpr char8_t delete_character = 0x7f;
+
+[[nodiscard]]
+consteval bool is_url_encoded_table_classifiable(const URL_Encoded_Table& table)
+{
+    for (std::size_t c = 0; c < 256; ++c) {
+        const bool expected = c < first_printable || c == delete_character;
+        if (c >= 128 ? table[c] : (expected && !table[c])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(is_url_encoded_table_classifiable(url_encoded_tables[0]));
+static_assert(is_url_encoded_table_classifiable(url_encoded_tables[1]));
+
+constexpr std::size_t max_encoded_printable = 32;
+
+/// @brief The encoded printable characters in a table, excluding space and DEL.
+struct Encoded_Printable {
+    std::array<char8_t, max_encoded_printable> characters;
+    std::size_t size;
+};
+
+[[nodiscard]]
+consteval Encoded_Printable make_encoded_printable(const URL_Encoded_Table& table)
+{
+    Encoded_Printable result {};
+    for (std::size_t c = first_printable; c < delete_character; ++c) {
+        if (table[c]) {
+            // If this fails, max_encoded_printable needs to be increased.
+            COWEL_ASSERT(result.size < max_encoded_printable);
+            result.characters[result.size++] = char8_t(c);
+        }
+    }
+    return result;
+}
+
+constexpr Encoded_Printable encoded_printables[] {
+    make_encoded_printable(url_encoded_tables[0]),
+    make_encoded_printable(url_encoded_tables[1]),
+};
+#endif
+
+#ifdef COWEL_URL_ENCODE_SSE2
+/// @brief Compares `block` against each of the encoded printable characters at once.
+/// The comparisons are expanded at compile time because each needs its own constant.
+template <URL_Encoded_Set encoded, std::size_t... indices>
+[[nodiscard]]
+__m128i match_encoded_printable(__m128i block, std::index_sequence<indices...>)
+{
+    constexpr Encoded_Printable printable = encoded_printables[std::size_t(encoded)];
+    __m128i matches = _mm_setzero_si128();
+    ((matches = _mm_or_si128(
+          matches, _mm_cmpeq_epi8(block, _mm_set1_epi8(char(printable.characters[indices])))
+      )),
+     ...);
+    return matches;
+}
+
+/// @brief Returns a mask with one bit set for each of the 16 code units in `block`
+/// that are percent-encoded according to `encoded`.
+template <URL_Encoded_Set encoded>
+[[nodiscard]]
+unsigned classify_url_encoded_block(__m128i block)
+{
+    // Comparisons are signed, so non-ASCII code units are negative,
+    // and they have to be excluded from the range of control characters.
+    const __m128i is_control = _mm_andnot_si128(
+        _mm_cmplt_epi8(block, _mm_setzero_si128()),
+        _mm_cmplt_epi8(block, _mm_set1_epi8(char(first_printable)))
+    );
+    const __m128i is_delete = _mm_cmpeq_epi8(block, _mm_set1_epi8(char(delete_character)));
+    constexpr std::size_t printable_count = encoded_printables[std::size_t(encoded)].size;
+    const __m128i is_printable
+        = match_encoded_printable<encoded>(block, std::make_index_sequence<printable_count> {});
+    const __m128i matches = _mm_or_si128(_mm_or_si128(is_control, is_delete), is_printable);
+    return unsigned(_mm_movemask_epi8(matches));
+}
+#endif
+
+template <URL_Encoded_Set encoded>
+void append_url_encoded_with(std::pmr::vector<char8_t>& out, std::u8string_view str)
+{
+    constexpr const URL_Encoded_Table& table = url_encoded_tables[std::size_t(encoded)];
+
+    // We make room for the worst case, where every code unit is percent-encoded,
+    // so that we can write without checking capacity, and shrink to the actual size later.
+    const std::size_t old_size = out.size();
+    out.resize(old_size + (str.size() * 3));
+    char8_t* const begin = out.data() + old_size;
+    char8_t* dest = begin;
+
+    const auto percent_encode = [&](char8_t c) {
+        dest[0] = u8'%';
+        dest[1] = detail::to_ascii_digit((c >> 4) & 0xf);
+        dest[2] = detail::to_ascii_digit((c >> 0) & 0xf);
+        dest += 3;
+    };
+    const auto copy = [&](std::u8string_view run) {
+        std::memcpy(dest, run.data(), run.size());
+        dest += run.size();
+    };
+
+    std::size_t i = 0;
+#ifdef COWEL_URL_ENCODE_SSE2
+    for (; i + 16 <= str.size(); i += 16) {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str.data() + i));
+        unsigned mask = classify_url_encoded_block<encoded>(block);
+        if (mask == 0) {
+            // Since at least i code units have been written so far,
+            // there is always room for 16 more.
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dest), block);
+            dest += 16;
+            continue;
+        }
+        // Only the code units marked in the mask are encoded,
+        // and the runs between them are copied as a whole.
+        std::size_t run_begin = i;
+        for (; mask != 0; mask &= mask - 1) {
+            const std::size_t pos = i + std::size_t(std::countr_zero(mask));
+            copy(str.substr(run_begin, pos - run_begin));
+            percent_encode(str[pos]);
+            run_begin = pos + 1;
+        }
+        copy(str.substr(run_begin, i + 16 - run_begin));
+    }
+#endif
+    for (; i < str.size(); ++i) {
+        if (table[str[i]]) {
+            percent_encode(str[i]);
+        }
+        else {
+            *dest++ = str[i];
+        }
+    }
+
+    out.resize(old_size + std::size_t(dest - begin));
+}
+
+} // namespace
+
+void append_url_encoded(
+    std::pmr::vector<char8_t>& out,
+    std::u8string_view str,
+    URL_Encoded_Set encoded
+)
+{
+    switch (encoded) {
+    case URL_Encoded_Set::always: {
+        append_url_encoded_with<URL_Encoded_Set::always>(out, str);
+        return;
+    }
+    case URL_Encoded_Set::always_and_apostrophe: {
+        append_url_encoded_with<URL_Encoded_Set::always_and_apostrophe>(out, str);
+        return;
+    }
+    }
+    COWEL_ASSERT_UNREACHABLE(u8"Invalid URL_Encoded_Set.");
+}
+
+} // namespace cowel
@@ -0,0 +1,113 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <memory_resource>
+#include <vector>
+
+#include "cowel/util/arena.hpp"
+
+namespace cowel {
+namespace {
+
+TEST(Arena, alignment)
+{
+    Arena_Memory_Resource arena;
+    for (const std::size_t alignment : { 1uz, 2uz, 4uz, 8uz, 16uz, 64uz }) {
+        void* const p = arena.allocate(3, alignment);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(p) % alignment, 0uz);
+    }
+}
+
+TEST(Arena, rewind_reuses_memory)
+{
+    Arena_Memory_Resource arena { std::pmr::get_default_resource(), 256 };
+    const Arena_Memory_Resource::Marker marker = arena.mark();
+
+    void* const first = arena.allocate(16);
+    // Allocations larger than the block size require additional blocks.
+    [[maybe_unused]] void* const large = arena.allocate(1024);
+    arena.rewind(marker);
+
+    void* const second = arena.allocate(16);
+    EXPECT_EQ(first, second);
+}
+
+TEST(Arena, rewind_reuses_any_large_enough_block)
+{
+    Arena_Memory_Resource arena { std::pmr::get_default_resource(), 256 };
+    const Arena_Memory_Resource::Marker marker = arena.mark();
+
+    [[maybe_unused]] void* const small = arena.allocate(16);
+    [[maybe_unused]] void* const medium = arena.allocate(1024);
+    void* const large = arena.allocate(4096);
+    arena.rewind(marker);
+
+    [[maybe_unused]] void* const small_again = arena.allocate(16);
+    // The block that was obtained for the medium allocation is too small,
+    // but the one obtained for the large allocation is reused.
+    void* const large_again = arena.allocate(2048);
+    EXPECT_EQ(large, large_again);
+}
+
+struct Max_Size_Tracking_Resource final : std::pmr::memory_resource {
+    std::size_t max_size = 0;
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        max_size = std::max(max_size, bytes);
+        return std::pmr::get_default_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+    {
+        std::pmr::get_default_resource()->deallocate(p, bytes, alignment);
+    }
+
+    [[nodiscard]]
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+TEST(Arena, block_size_is_bounded)
+{
+    Max_Size_Tracking_Resource upstream;
+    {
+        Arena_Memory_Resource arena { &upstream };
+        for (int i = 0; i < 256; ++i) {
+            [[maybe_unused]] void* const p = arena.allocate(1024 * 1024);
+        }
+    }
+    EXPECT_LE(upstream.max_size, Arena_Memory_Resource::max_block_size);
+}
+
+TEST(Arena, deallocate_top)
+{
+    Arena_Memory_Resource arena;
+    void* const first = arena.allocate(32);
+    arena.deallocate(first, 32);
+    void* const second = arena.allocate(32);
+    EXPECT_EQ(first, second);
+}
+
+TEST(Arena, pmr_container)
+{
+    Arena_Memory_Resource arena { std::pmr::get_default_resource(), 64 };
+    const Arena_Memory_Resource::Marker marker = arena.mark();
+    {
+        std::pmr::vector<int> v { &arena };
+        for (int i = 0; i < 1000; ++i) {
+            v.push_back(i);
+        }
+        EXPECT_EQ(v[999], 999);
+    }
+    arena.rewind(marker);
+    EXPECT_EQ(arena.mark().block, marker.block);
+    EXPECT_EQ(arena.mark().offset, marker.offset);
+}
+
+} // namespace
+} // namespace cowel
@@ -276,6 +276,7 @@ TEST(Parse_Utils, find_blank_line_sequence)
     EXPECT_EQ(find_blank_line_sequence(u8"\nawoo"), (Blank_Line { 0, 1 }));
     EXPECT_EQ(find_blank_line_sequence(u8"awoo\n  \n"), (Blank_Line { 5, 3 }));
     EXPECT_EQ(find_blank_line_sequence(u8"aw\n\noo"), (Blank_Line { 3, 1 }));
+    EXPECT_EQ(find_blank_line_sequence(u8"awoo awoo\nawoo awoo \n \n\n"), (Blank_Line { 21, 3 }));
 }
 
 } // namespace
@@ -0,0 +1,130 @@
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include "ulight/impl/platform.h"
+
+ULIGHT_DIAGNOSTIC_PUSH()
+ULIGHT_DIAGNOSTIC_IGNORED("-Wsign-conversion")
+ULIGHT_DIAGNOSTIC_IGNORED("-Wshorten-64-to-32")
+#include "cowel/cedilla/name_to_cp.hpp"
+ULIGHT_DIAGNOSTIC_POP()
+
+#include "cowel/util/chars.hpp"
+#include "cowel/util/code_point_names.hpp"
+#include "cowel/util/strings.hpp"
+
+namespace cowel {
+namespace {
+
+TEST(Code_Point_Names, exact)
+{
+    EXPECT_EQ(code_point_by_name(u8"LATIN SMALL LETTER A"), U'a');
+    EXPECT_EQ(code_point_by_name(u8"NO-BREAK SPACE"), U' ');
+    EXPECT_EQ(code_point_by_name(u8"SNOWMAN"), U'☃');
+    EXPECT_EQ(code_point_by_name(u8"PILE OF POO"), U'\U0001F4A9');
+    EXPECT_EQ(code_point_by_name(u8"TIBETAN LETTER -A"), U'འ');
+}
+
+TEST(Code_Point_Names, loose_matching)
+{
+    EXPECT_EQ(code_point_by_name(u8"latin small letter a"), U'a');
+    EXPECT_EQ(code_point_by_name(u8"LatinSmallLetterA"), U'a');
+    EXPECT_EQ(code_point_by_name(u8"NO BREAK SPACE"), U' ');
+    EXPECT_EQ(code_point_by_name(u8"HANGUL JUNGSEONG OE"), U'ᅬ');
+    EXPECT_EQ(code_point_by_name(u8"HANGUL JUNGSEONG O-E"), U'ᆀ');
+}
+
+TEST(Code_Point_Names, derived)
+{
+    EXPECT_EQ(code_point_by_name(u8"HANGUL SYLLABLE GA"), U'가');
+    EXPECT_EQ(code_point_by_name(u8"CJK UNIFIED IDEOGRAPH-4E00"), U'一');
+}
+
+TEST(Code_Point_Names, missing)
+{
+    EXPECT_EQ(code_point_by_name(u8""), char32_t(-1));
+    EXPECT_EQ(code_point_by_name(u8"LATIN SMALL LETTER"), char32_t(-1));
+    EXPECT_EQ(code_point_by_name(u8"LATIN SMALL LETTER QQQ"), char32_t(-1));
+    EXPECT_EQ(code_point_by_name(u8"SNOWMAN "), char32_t(-1));
+    EXPECT_EQ(code_point_by_name(u8"NOT A CHARACTER NAME"), char32_t(-1));
+}
+
+[[nodiscard]]
+char32_t cedilla_code_point_by_name(std::string_view name)
+{
+    const char32_t result = uni::cp_from_name(name);
+    return result > code_point_max ? char32_t(-1) : result;
+}
+
+/// @brief Checks that `code_point_by_name` agrees with a lookup in the cedilla name tree
+/// for `name` and for a few variants of it that should or should not match.
+void expect_same_as_cedilla(std::string name)
+{
+    const auto expect_same = [](const std::string& n) {
+        EXPECT_EQ(code_point_by_name(as_u8string_view(n)), cedilla_code_point_by_name(n))
+            << "name: \"" << n << '"';
+    };
+    expect_same(name);
+    expect_same(name.substr(0, name.length() - 1));
+    expect_same(name + "X");
+    expect_same(name + " ");
+    expect_same(" " + name);
+    for (char& c : name) {
+        c = char(to_ascii_lower(char8_t(c)));
+    }
+    expect_same(name);
+}
+
+/// @brief Visits the node at `offset` in the cedilla name tree, its siblings,
+/// and all their descendants,
+/// and checks every name found this way using `expect_same_as_cedilla`.
+/// @returns The number of names that were checked.
+std::size_t expect_same_as_cedilla_in_tree(std::uint32_t offset, const std::string& prefix)
+{
+    std::size_t result = 0;
+    while (true) {
+        const uni::details::node node = uni::details::read_node(offset);
+        if (!node.is_valid()) {
+            break;
+        }
+        const std::string name = prefix + std::string(node.name);
+        if (node.value != 0xFFFFFF) {
+            // Names in the tree have spaces removed, so we insert a space before each hyphen
+            // to keep it from being treated as a medial hyphen.
+            std::string spaced;
+            for (const char c : name) {
+                if (c == '-') {
+                    spaced += ' ';
+                }
+                spaced += c;
+            }
+            expect_same_as_cedilla(std::move(spaced));
+            ++result;
+        }
+        if (node.has_children()) {
+            result += expect_same_as_cedilla_in_tree(node.children_offset, name);
+        }
+        if (!node.has_sibling) {
+            break;
+        }
+        offset += node.size;
+    }
+    return result;
+}
+
+TEST(Code_Point_Names, all_names)
+{
+    // The hash table only verifies a fingerprint and the length of the name,
+    // so the only way to be sure that there are no false positives among
+    // names that are similar to existing ones is to check them all.
+    const std::size_t count = expect_same_as_cedilla_in_tree(0, "");
+    EXPECT_GT(count, 30'000u);
+}
+
+} // namespace
+} // namespace cowel
@@ -0,0 +1,130 @@
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <string_view>
+#include <vector>
+
+#ifdef COWEL_GZIP
+#include <zlib.h>
+#endif
+#ifdef COWEL_ZSTD
+#include <zstd.h>
+#endif
+
+#include <gtest/gtest.h>
+
+#include "cowel/compression.hpp"
+#include "cowel/services.hpp"
+
+namespace cowel {
+namespace {
+
+#if defined(COWEL_GZIP) || defined(COWEL_ZSTD)
+/// @brief Returns text which is large enough to require multiple output buffers,
+/// and repetitive enough to be compressed.
+[[nodiscard]]
+std::pmr::vector<char8_t> make_uncompressed(std::pmr::memory_resource* memory)
+{
+    std::pmr::vector<char8_t> result { memory };
+    for (std::size_t i = 0; i < 100'000; ++i) {
+        constexpr std::u8string_view words[] { u8"<p>", u8"cowel ", u8"text\n", u8"</p>" };
+        const std::u8string_view word = words[(i * i) % std::size(words)];
+        result.insert(result.end(), word.begin(), word.end());
+        result.push_back(char8_t(u8'a' + (i % 26)));
+    }
+    return result;
+}
+
+/// @brief Compresses `text` using `compression`,
+/// writing it to the compressing sink in pieces of varying size.
+[[nodiscard]]
+bool compress(
+    std::pmr::vector<char8_t>& out,
+    std::u8string_view text,
+    Compression compression,
+    std::pmr::memory_resource* memory
+)
+{
+    Vector_Output_Sink out_sink { out };
+    const std::unique_ptr<Compressing_Output_Sink> sink
+        = make_compressing_output_sink(compression, out_sink, memory);
+    if (!sink) {
+        return false;
+    }
+    for (std::size_t piece_size = 1; !text.empty(); piece_size = piece_size * 3 % 10'007) {
+        const std::u8string_view piece = text.substr(0, piece_size);
+        (*sink)(piece);
+        text.remove_prefix(piece.size());
+    }
+    return sink->finish();
+}
+#endif
+
+#ifdef COWEL_GZIP
+TEST(Compression, gzip_round_trip)
+{
+    std::pmr::monotonic_buffer_resource memory;
+    const std::pmr::vector<char8_t> expected = make_uncompressed(&memory);
+    const std::u8string_view expected_string { expected.data(), expected.size() };
+
+    ASSERT_TRUE(is_compression_supported(Compression::gzip));
+    std::pmr::vector<char8_t> compressed { &memory };
+    ASSERT_TRUE(compress(compressed, expected_string, Compression::gzip, &memory));
+    EXPECT_LT(compressed.size(), expected.size());
+
+    // One additional byte of capacity tells us that nothing is left beyond the expected size.
+    std::pmr::vector<char8_t> actual(expected.size() + 1, &memory);
+    z_stream stream {};
+    ASSERT_EQ(inflateInit2(&stream, 15 + 16), Z_OK);
+    stream.next_in = reinterpret_cast<Bytef*>(compressed.data());
+    stream.avail_in = uInt(compressed.size());
+    stream.next_out = reinterpret_cast<Bytef*>(actual.data());
+    stream.avail_out = uInt(actual.size());
+    const int result = inflate(&stream, Z_FINISH);
+    inflateEnd(&stream);
+    ASSERT_EQ(result, Z_STREAM_END);
+    actual.resize(actual.size() - stream.avail_out);
+
+    EXPECT_TRUE(expected == actual);
+}
+#endif
+
+#ifdef COWEL_ZSTD
+TEST(Compression, zstd_round_trip)
+{
+    std::pmr::monotonic_buffer_resource memory;
+    const std::pmr::vector<char8_t> expected = make_uncompressed(&memory);
+    const std::u8string_view expected_string { expected.data(), expected.size() };
+
+    ASSERT_TRUE(is_compression_supported(Compression::zstd));
+    std::pmr::vector<char8_t> compressed { &memory };
+    ASSERT_TRUE(compress(compressed, expected_string, Compression::zstd, &memory));
+    EXPECT_LT(compressed.size(), expected.size());
+
+    // One additional byte of capacity tells us that nothing is left beyond the expected size.
+    std::pmr::vector<char8_t> actual(expected.size() + 1, &memory);
+    const std::size_t size
+        = ZSTD_decompress(actual.data(), actual.size(), compressed.data(), compressed.size());
+    ASSERT_FALSE(ZSTD_isError(size));
+    actual.resize(size);
+
+    EXPECT_TRUE(expected == actual);
+}
+#endif
+
+TEST(Compression, sink_iff_supported)
+{
+    std::pmr::monotonic_buffer_resource memory;
+    std::pmr::vector<char8_t> out { &memory };
+    Vector_Output_Sink out_sink { out };
+    for (const Compression compression : { Compression::gzip, Compression::zstd }) {
+        const bool supported = is_compression_supported(compression);
+        const std::unique_ptr<Compressing_Output_Sink> sink
+            = make_compressing_output_sink(compression, out_sink, &memory);
+        EXPECT_EQ(supported, sink != nullptr);
+    }
+}
+
+} // namespace
+} // namespace cowel
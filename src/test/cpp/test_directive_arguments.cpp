@@ -0,0 +1,98 @@
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <memory_resource>
+#include <string_view>
+#include <vector>
+
+#include "cowel/ast.hpp"
+#include "cowel/directive_arguments.hpp"
+
+namespace cowel {
+namespace {
+
+[[nodiscard]]
+ast::Argument named(std::u8string_view name, std::pmr::memory_resource* memory)
+{
+    const File_Source_Span8 span { Source_Position {}, name.length(), u8"" };
+    return { span, name, span, name, std::pmr::vector<ast::Content> { memory } };
+}
+
+[[nodiscard]]
+ast::Argument positional(std::pmr::memory_resource* memory)
+{
+    const File_Source_Span8 span { Source_Position {}, 0, u8"" };
+    return { span, {}, std::pmr::vector<ast::Content> { memory } };
+}
+
+constexpr std::u8string_view bibliography_parameters[] {
+    u8"id",   u8"title",      u8"date",       u8"publisher",
+    u8"link", u8"long-link", u8"issue-link", u8"author",
+};
+
+TEST(Parameter_Schema, index_of)
+{
+    static constexpr Parameter_Schema schema { bibliography_parameters };
+    static_assert(schema.index_of(u8"publisher") == 3);
+
+    for (std::size_t i = 0; i < std::size(bibliography_parameters); ++i) {
+        EXPECT_EQ(schema.index_of(bibliography_parameters[i]), int(i));
+    }
+    EXPECT_EQ(schema.index_of(u8""), -1);
+    EXPECT_EQ(schema.index_of(u8"titles"), -1);
+    EXPECT_EQ(schema.index_of(u8"ID"), -1);
+}
+
+TEST(Parameter_Schema, empty)
+{
+    static constexpr Parameter_Schema schema { std::span<const std::u8string_view> {} };
+    EXPECT_EQ(schema.size(), 0u);
+    EXPECT_EQ(schema.index_of(u8"id"), -1);
+}
+
+TEST(Argument_Matcher, named_and_positional)
+{
+    static constexpr std::u8string_view parameters[] { u8"x", u8"y" };
+    static constexpr Parameter_Schema schema { parameters };
+
+    std::pmr::monotonic_buffer_resource memory;
+    const std::pmr::vector<ast::Argument> arguments {
+        { named(u8"y", &memory), positional(&memory), named(u8"z", &memory),
+          named(u8"y", &memory) },
+        &memory,
+    };
+
+    Argument_Matcher args { schema };
+    args.match(arguments);
+
+    EXPECT_EQ(args.get_argument_index(u8"x"), 1);
+    EXPECT_EQ(args.get_argument_index(u8"y"), 0);
+
+    ASSERT_EQ(args.argument_count(), 4u);
+    EXPECT_EQ(args.argument_status(0), Argument_Status::ok);
+    EXPECT_EQ(args.argument_status(1), Argument_Status::ok);
+    EXPECT_EQ(args.argument_status(2), Argument_Status::unmatched);
+    EXPECT_EQ(args.argument_status(3), Argument_Status::duplicate_named);
+}
+
+TEST(Argument_Matcher, only_named)
+{
+    static constexpr std::u8string_view parameters[] { u8"id", u8"listed" };
+    static constexpr Parameter_Schema schema { parameters };
+
+    std::pmr::monotonic_buffer_resource memory;
+    const std::pmr::vector<ast::Argument> arguments {
+        { positional(&memory), named(u8"listed", &memory) },
+        &memory,
+    };
+
+    Argument_Matcher args { schema };
+    args.match(arguments, Parameter_Match_Mode::only_named);
+
+    EXPECT_EQ(args.get_argument_index(u8"id"), -1);
+    EXPECT_EQ(args.get_argument_index(u8"listed"), 1);
+    EXPECT_EQ(args.argument_status(0), Argument_Status::unmatched);
+    EXPECT_EQ(args.argument_status(1), Argument_Status::ok);
+}
+
+} // namespace
+} // namespace cowel
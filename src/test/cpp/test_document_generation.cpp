@@ -1,6 +1,8 @@
+#include <cstddef>
 #include <filesystem>
 #include <initializer_list>
 #include <memory_resource>
+#include <optional>
 #include <span>
 #include <string>
 #include <string_view>
@@ -13,6 +15,8 @@
 #include "cowel/document_content_behavior.hpp"
 #include "cowel/util/annotated_string.hpp"
 #include "cowel/util/assert.hpp"
+#include "cowel/util/counting_memory_resource.hpp"
+#include "cowel/util/strings.hpp"
 
 #include "cowel/builtin_directive_set.hpp"
 #include "cowel/content_behavior.hpp"
@@ -21,7 +25,11 @@
 #include "cowel/directive_processing.hpp"
 #include "cowel/document_generation.hpp"
 #include "cowel/fwd.hpp"
+#include "cowel/macro_profile.hpp"
+#include "cowel/memory_profile.hpp"
 #include "cowel/parse.hpp"
+#include "cowel/plaintext_memo.hpp"
+#include "cowel/services.hpp"
 
 #include "collecting_logger.hpp"
 #include "diff.hpp"
@@ -77,6 +85,75 @@ struct Empty_Head_Behavior final : Head_Body_Content_Behavior {
     }
 };
 
+/// @brief Like `Trivial_Content_Behavior`, but also resolves macros defined via `\\macro`,
+/// similar to `Document_Content_Behavior`.
+struct Macro_Content_Behavior final : Content_Behavior {
+    Directive_Behavior& m_macro_behavior;
+
+    explicit Macro_Content_Behavior(Directive_Behavior& macro_behavior)
+        : m_macro_behavior { macro_behavior }
+    {
+    }
+
+    void generate_plaintext(std::pmr::vector<char8_t>&, std::span<const ast::Content>, Context&)
+        const final
+    {
+        COWEL_ASSERT_UNREACHABLE(u8"Unimplemented, not needed.");
+    }
+
+    void generate_html(HTML_Writer& out, std::span<const ast::Content> content, Context& context)
+        const final
+    {
+        struct Macro_Name_Resolver final : Name_Resolver {
+            Context& m_context;
+            Directive_Behavior& m_macro_behavior;
+
+            Macro_Name_Resolver(Context& context, Directive_Behavior& macro_behavior)
+                : m_context { context }
+                , m_macro_behavior { macro_behavior }
+            {
+            }
+
+            Distant<std::u8string_view>
+            fuzzy_lookup_name(std::u8string_view, std::pmr::memory_resource*) const final
+            {
+                COWEL_ASSERT_UNREACHABLE(u8"Unimplemented.");
+            }
+
+            [[nodiscard]]
+            Directive_Behavior* operator()(std::u8string_view name) const final
+            {
+                return m_context.find_macro(name) ? &m_macro_behavior : nullptr;
+            }
+
+        } macro_name_resolver { context, m_macro_behavior };
+        context.add_resolver(macro_name_resolver);
+
+        to_html(out, content, context);
+    }
+};
+
+/// @brief Loads a single file with the given `path` and `source`.
+struct Single_File_Loader final : File_Loader {
+    std::u8string_view path;
+    std::u8string_view source;
+
+    [[nodiscard]]
+    std::optional<File_Entry> load(std::u8string_view p) final
+    {
+        return find(p);
+    }
+
+    [[nodiscard]]
+    std::optional<File_Entry> find(std::u8string_view p) const final
+    {
+        if (p != path) {
+            return {};
+        }
+        return File_Entry { .source = source, .name = path };
+    }
+};
+
 constinit Trivial_Content_Behavior trivial_behavior {};
 constinit Paragraphs_Behavior paragraphs_behavior {};
 constinit Empty_Head_Behavior empty_head_behavior {};
@@ -93,6 +170,15 @@ struct Doc_Gen_Test : testing::Test {
     std::pmr::vector<ast::Content> content { &memory };
 
     Collecting_Logger logger { &memory };
+    File_Loader* file_loader = &always_failing_file_loader;
+
+    Macro_Budget macro_budget {};
+    Macro_Profile* macro_profile = nullptr;
+    bool fold_constants = false;
+    Plaintext_Memo_Statistics* plaintext_memo_statistics = nullptr;
+    Memory_Profile* memory_profile = nullptr;
+    Output_Sink* output_sink = nullptr;
+    std::pmr::memory_resource* transient_memory = nullptr;
 
     Doc_Gen_Test()
     {
@@ -141,9 +227,17 @@ struct Doc_Gen_Test : testing::Test {
                                            .builtin_behavior = builtin_directives,
                                            .error_behavior = &error_behavior,
                                            .highlight_theme_source = theme_source_string,
+                                           .file_loader = *file_loader,
                                            .logger = logger,
                                            .highlighter = test_highlighter,
-                                           .memory = &memory };
+                                           .macro_budget = macro_budget,
+                                           .macro_profile = macro_profile,
+                                           .fold_constants = fold_constants,
+                                           .plaintext_memo_statistics = plaintext_memo_statistics,
+                                           .memory_profile = memory_profile,
+                                           .output_sink = output_sink,
+                                           .memory = &memory,
+                                           .transient_memory = transient_memory };
         generate_document(options);
         return { out.data(), out.size() };
     }
@@ -196,6 +290,246 @@ a paragraph.
     EXPECT_EQ(expected, actual);
 }
 
+TEST_F(Doc_Gen_Test, macro_profile)
+{
+    Macro_Content_Behavior behavior { builtin_directives.get_macro_behavior() };
+    Macro_Profile profile { &memory };
+    macro_profile = &profile;
+
+    constexpr std::u8string_view expected = u8"[xx][xx]";
+    load_source(u8"\\macro[\\inner]{x}\\macro[\\outer]{[\\inner\\inner]}\\outer\\outer");
+    const std::u8string_view actual = generate(behavior);
+    EXPECT_EQ(expected, actual);
+    EXPECT_TRUE(logger.diagnostics.empty());
+
+    const Macro_Statistics& outer = profile[u8"outer"];
+    EXPECT_EQ(outer.expansions, 2u);
+    EXPECT_EQ(outer.expanded_nodes, 8u);
+    EXPECT_EQ(outer.max_depth, 1u);
+
+    const Macro_Statistics& inner = profile[u8"inner"];
+    EXPECT_EQ(inner.expansions, 4u);
+    EXPECT_EQ(inner.max_depth, 2u);
+}
+
+TEST_F(Doc_Gen_Test, memory_profile)
+{
+    Macro_Content_Behavior behavior { builtin_directives.get_macro_behavior() };
+    Counting_Memory_Resource transient_counter { &memory };
+    Memory_Profile profile { &memory };
+    profile.add_resource(u8"transient", transient_counter);
+    memory_profile = &profile;
+    transient_memory = &transient_counter;
+
+    load_source(u8"\\macro[\\m]{x}\\m");
+    const std::u8string_view actual = generate(behavior);
+    EXPECT_EQ(u8"x", actual);
+    EXPECT_EQ(profile.get_phase(), Memory_Phase::generation);
+    profile.end_phase();
+
+    const Memory_Statistics& generation
+        = profile.get_resources()[0].phases[std::size_t(Memory_Phase::generation)];
+    EXPECT_NE(generation.allocations, 0u);
+    EXPECT_LE(generation.live_bytes, generation.peak_bytes);
+    EXPECT_LE(generation.peak_bytes, generation.allocated_bytes);
+
+    const Memory_Statistics& parse
+        = profile.get_resources()[0].phases[std::size_t(Memory_Phase::parse)];
+    EXPECT_EQ(parse, Memory_Statistics {});
+}
+
+TEST_F(Doc_Gen_Test, output_sink)
+{
+    struct Collecting_Output_Sink final : Output_Sink {
+        std::pmr::vector<char8_t> text;
+        std::size_t writes = 0;
+
+        explicit Collecting_Output_Sink(std::pmr::memory_resource* memory)
+            : text { memory }
+        {
+        }
+
+        void operator()(std::u8string_view piece) final
+        {
+            text.insert(text.end(), piece.begin(), piece.end());
+            ++writes;
+        }
+    };
+
+    load_source(u8"First paragraph.\n\nSecond paragraph.\n");
+    const std::u8string_view expected_string = generate(empty_head_behavior);
+    ASSERT_FALSE(expected_string.empty());
+    const std::pmr::vector<char8_t> expected_text { expected_string.begin(),
+                                                    expected_string.end(), &memory };
+
+    out.clear();
+    Collecting_Output_Sink sink { &memory };
+    output_sink = &sink;
+    const std::u8string_view actual = generate(empty_head_behavior);
+    EXPECT_TRUE(actual.empty());
+    EXPECT_EQ(as_u8string_view(expected_text), as_u8string_view(sink.text));
+    // The document is written in pieces, separated by references to the head and body sections.
+    EXPECT_GT(sink.writes, 1u);
+}
+
+TEST_F(Doc_Gen_Test, section_references)
+{
+    // References written directly into the body are recorded alongside the section text.
+    load_source(u8"\\there[s]{X}\\b{\\here[s]\\here[s]}\n");
+    const std::u8string_view recorded = generate(empty_head_behavior);
+    EXPECT_NE(recorded.find(u8"<b>XX</b>"), std::u8string_view::npos);
+    EXPECT_TRUE(logger.diagnostics.empty());
+
+    // The content of headings is written to a separate section (a fragment),
+    // so references within them are recorded there.
+    clear();
+    load_source(u8"\\there[s]{X}\\h2[id=h,listed=no]{\\here[s]}\n");
+    const std::u8string_view encoded = generate(empty_head_behavior);
+    EXPECT_NE(encoded.find(u8"<a class=para href=#h></a>X</h2>"), std::u8string_view::npos);
+    EXPECT_TRUE(logger.diagnostics.empty());
+
+    // Recorded references to sections which are never created are diagnosed.
+    clear();
+    load_source(u8"\\b{\\here[missing]}\n");
+    generate(empty_head_behavior);
+    EXPECT_TRUE(logger.was_logged(diagnostic::section_ref_not_found));
+}
+
+TEST_F(Doc_Gen_Test, heading_fragments)
+{
+    // The content of a heading is generated once,
+    // but appears in the heading, in the table of contents, and in references to the heading.
+    load_source(u8"\\make-contents\\h2[id=h]{X\\here[s]}\\ref[to=#h]\\there[s]{Y}\n");
+    std::u8string_view actual = generate(empty_head_behavior);
+    std::size_t occurrences = 0;
+    for (std::size_t pos; (pos = actual.find(u8"XY")) != std::u8string_view::npos;) {
+        ++occurrences;
+        actual.remove_prefix(pos + 2);
+    }
+    EXPECT_EQ(occurrences, 3u);
+    EXPECT_TRUE(logger.diagnostics.empty());
+}
+
+TEST_F(Doc_Gen_Test, heading_fragments_reserved)
+{
+    // Sections that hold the content of headings cannot be written to or referenced,
+    // neither before nor after the heading creates them.
+    load_source(
+        u8"\\there[std.fragment.0]{A}\\h2[id=h]{X}\\there[std.fragment.0]{B}"
+        u8"\\b{\\here[std.fragment.0]}\n"
+    );
+    const std::u8string_view actual = generate(empty_head_behavior);
+    EXPECT_NE(actual.find(u8"X</h2>"), std::u8string_view::npos);
+    EXPECT_EQ(actual.find(u8"XA"), std::u8string_view::npos);
+    EXPECT_EQ(actual.find(u8"XB"), std::u8string_view::npos);
+    EXPECT_NE(actual.find(u8"<b></b>"), std::u8string_view::npos);
+    EXPECT_TRUE(logger.was_logged(diagnostic::section_reserved));
+}
+
+TEST_F(Doc_Gen_Test, macro_budget_depth)
+{
+    Macro_Content_Behavior behavior { builtin_directives.get_macro_behavior() };
+    macro_budget.max_depth = 16;
+
+    constexpr std::u8string_view expected;
+    load_source(u8"\\macro[\\m]{\\m}\\m");
+    const std::u8string_view actual = generate(behavior);
+    EXPECT_EQ(expected, actual);
+    EXPECT_TRUE(logger.was_logged(diagnostic::macro::budget_depth));
+}
+
+TEST_F(Doc_Gen_Test, macro_budget_nodes)
+{
+    Macro_Content_Behavior behavior { builtin_directives.get_macro_behavior() };
+    macro_budget.max_expanded_nodes = 20;
+
+    // Expanding \me produces 2 + 4 + 8 + 16 = 30 nodes, not counting \ma,
+    // which is memoized after its first expansion.
+    load_source(
+        u8"\\macro[\\ma]{xx}\\macro[\\mb]{\\ma\\ma}\\macro[\\mc]{\\mb\\mb}"
+        u8"\\macro[\\md]{\\mc\\mc}\\macro[\\me]{\\md\\md}\\me"
+    );
+    generate(behavior);
+    EXPECT_TRUE(logger.was_logged(diagnostic::macro::budget_nodes));
+}
+
+TEST_F(Doc_Gen_Test, plaintext_memo)
+{
+    Macro_Content_Behavior behavior { builtin_directives.get_macro_behavior() };
+    Plaintext_Memo_Statistics statistics;
+    plaintext_memo_statistics = &statistics;
+
+    // Every instantiation of \\m shares the arguments of \\code with the definition,
+    // so the language argument is only converted to plaintext once.
+    constexpr std::u8string_view expected = u8"<code><h- data-h=kw>xxx</h-></code>"
+                                            u8"<code><h- data-h=kw>xxx</h-></code>";
+    load_source(u8"\\macro[\\m]{\\code[\\U{78}]{xxx}}\\m\\m");
+    const std::u8string_view actual = generate(behavior);
+    EXPECT_EQ(expected, actual);
+    EXPECT_TRUE(logger.diagnostics.empty());
+    EXPECT_EQ(statistics.lookups, 2u);
+    EXPECT_EQ(statistics.hits, 1u);
+
+    // The language argument is rebuilt by every instantiation,
+    // so it is never looked up again, and not memoized.
+    clear();
+    statistics = {};
+    load_source(u8"\\macro[\\m]{\\code[\\put]{xxx}}\\m{\\U{78}}\\m{\\U{78}}");
+    const std::u8string_view rebuilt = generate(behavior);
+    EXPECT_EQ(expected, rebuilt);
+    EXPECT_TRUE(logger.diagnostics.empty());
+    EXPECT_EQ(statistics.lookups, 0u);
+}
+
+TEST_F(Doc_Gen_Test, fold_constants)
+{
+    load_source(
+        u8"\\U{41}\\b{\\Cadd{1}{2}}\\c{#x42}\\U{zz}\\U{20}\\literally{\\U{41}}"
+        u8"\\macro[\\N]{m}\\N{LATIN CAPITAL LETTER A}"
+    );
+    Macro_Content_Behavior behavior { builtin_directives.get_macro_behavior() };
+
+    const std::pmr::u8string expected { generate(behavior), &memory };
+    const std::size_t expected_diagnostics = logger.diagnostics.size();
+    out.clear();
+    logger.diagnostics.clear();
+
+    fold_constants = true;
+    const std::u8string_view actual = generate(behavior);
+    EXPECT_EQ(expected, actual);
+    EXPECT_EQ(expected_diagnostics, logger.diagnostics.size());
+}
+
+TEST_F(Doc_Gen_Test, macro_memo_invalidated)
+{
+    // The HTML of the first \m is memoized,
+    // but defining \U changes what \m expands to afterwards.
+    load_source(u8"\\macro[\\m]{\\U{41}}\\m\\macro[\\U]{B}\\m");
+    Macro_Content_Behavior behavior { builtin_directives.get_macro_behavior() };
+    constexpr std::u8string_view expected = u8"AB";
+    const std::u8string_view actual = generate(behavior);
+    EXPECT_EQ(expected, actual);
+    EXPECT_TRUE(logger.diagnostics.empty());
+}
+
+TEST_F(Doc_Gen_Test, fold_constants_imported_macro)
+{
+    // The macro shadows the builtin \U directive,
+    // but this is only known once the imported document is processed.
+    Single_File_Loader loader;
+    loader.path = u8"macros.cow";
+    loader.source = u8"\\macro[\\U]{m}";
+    file_loader = &loader;
+
+    load_source(u8"\\import{macros.cow}\\U{41}");
+    Macro_Content_Behavior behavior { builtin_directives.get_macro_behavior() };
+    fold_constants = true;
+    constexpr std::u8string_view expected = u8"m";
+    const std::u8string_view actual = generate(behavior);
+    EXPECT_EQ(expected, actual);
+    EXPECT_TRUE(logger.diagnostics.empty());
+}
+
 struct Path {
     std::u8string_view value;
 };
@@ -247,6 +581,20 @@ constexpr Basic_Test basic_tests[] {
       Source { u8"<error->\\U{D800}</error->\n" },
       { diagnostic::U::nonscalar } },
 
+    { Source { u8"\\Cadd{1}{2}\\Cmul{\\Csub{5}{2}}{4}\n" },
+      Source { u8"312\n" } },
+    { Source { u8"\\Cdiv{1}{\\Csub{2}{2}}\n" },
+      Source { u8"\n" },
+      { diagnostic::arithmetic_div_by_zero } },
+    { Source { u8"\\Cadd{1}{x}\n" },
+      Source { u8"\n" },
+      { diagnostic::arithmetic_parse } },
+    { Source { u8"\\Vset{i}{1}\\Vset{i}{\\Cadd{\\Vget{i}}{1}}"
+               u8"\\Vset{i}{\\Cmul{\\Vget{i}}{3}}\\Vget{i}\n" },
+      Source { u8"6\n" } },
+    { Source { u8"\\Vset{i}{007}\\Vget{i} \\Cadd{\\Vget{i}}{1}\n" },
+      Source { u8"007 8\n" } },
+
     { Source { u8"\\h1{Heading}\n" },
       Source { u8"<h1 id=heading><a class=para href=#heading></a>Heading</h1>\n" } },
     { Source { u8"\\h2[listed=no]{ }\n" },
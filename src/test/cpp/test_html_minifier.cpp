@@ -0,0 +1,87 @@
+#include <cstddef>
+#include <memory_resource>
+#include <string_view>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "cowel/util/strings.hpp"
+
+#include "cowel/html_minifier.hpp"
+#include "cowel/services.hpp"
+
+namespace cowel {
+namespace {
+
+struct HTML_Minifier_Test : testing::Test {
+    std::pmr::monotonic_buffer_resource memory;
+    std::pmr::vector<char8_t> out { &memory };
+    Vector_Output_Sink sink { out };
+
+    /// @brief Minifies `html` once as a whole,
+    /// and once split into pieces of one code unit each,
+    /// and returns the former result.
+    /// Both results are expected to be equal.
+    [[nodiscard]]
+    std::u8string_view minify(std::u8string_view html)
+    {
+        out.clear();
+        std::pmr::vector<char8_t> piecewise_out { &memory };
+        Vector_Output_Sink piecewise_sink { piecewise_out };
+        HTML_Minifier piecewise { piecewise_sink, &memory, 1 };
+        for (std::size_t i = 0; i < html.length(); ++i) {
+            piecewise(html.substr(i, 1));
+        }
+        piecewise.flush();
+
+        HTML_Minifier minifier { sink, &memory };
+        minifier(html);
+        minifier.flush();
+
+        EXPECT_EQ(as_u8string_view(out), as_u8string_view(piecewise_out));
+        return as_u8string_view(out);
+    }
+};
+
+TEST_F(HTML_Minifier_Test, empty)
+{
+    EXPECT_EQ(u8"", minify(u8""));
+}
+
+TEST_F(HTML_Minifier_Test, whitespace)
+{
+    EXPECT_EQ(u8"a b\nc\n", minify(u8"a  \t b \n  c\n\n"));
+    EXPECT_EQ(u8"<p>\n<b>x</b> y\n</p>", minify(u8"<p>\n  <b>x</b>   y\n</p>"));
+}
+
+TEST_F(HTML_Minifier_Test, tags_unchanged)
+{
+    constexpr std::u8string_view html = u8"<!DOCTYPE html><a href=\"x  y\" title='a > b'>z</a>";
+    EXPECT_EQ(html, minify(html));
+}
+
+TEST_F(HTML_Minifier_Test, comments)
+{
+    EXPECT_EQ(u8"a b", minify(u8"a <!-- x -- > y --> b"));
+    EXPECT_EQ(u8"<!-x>", minify(u8"<!-x>"));
+}
+
+TEST_F(HTML_Minifier_Test, whitespace_preserved)
+{
+    constexpr std::u8string_view html
+        = u8"<pre>  a\n\n b</pre><code-block>  x  </code-block><textarea>\n \n</textarea>";
+    EXPECT_EQ(html, minify(html));
+    EXPECT_EQ(u8"<pre><pre> </pre> </pre> ", minify(u8"<pre><pre> </pre> </pre>  "));
+}
+
+TEST_F(HTML_Minifier_Test, raw_text)
+{
+    constexpr std::u8string_view html
+        = u8"<script>let x = 1 <  2;  <!-- y --> </scrip </script>"
+          u8"<style>a  {  }</STYLE>";
+    EXPECT_EQ(html, minify(html));
+    EXPECT_EQ(u8"<script>  </script> x", minify(u8"<script>  </script>  x"));
+}
+
+} // namespace
+} // namespace cowel
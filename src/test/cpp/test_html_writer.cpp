@@ -1,7 +1,9 @@
 #include <array>
 #include <cstddef>
+#include <iterator>
 #include <memory_resource>
 #include <span>
+#include <string>
 #include <string_view>
 #include <vector>
 
@@ -9,6 +11,7 @@
 
 #include "cowel/util/html_entities.hpp"
 #include "cowel/util/html_writer.hpp"
+#include "cowel/util/url_encode.hpp"
 
 namespace cowel {
 namespace {
@@ -49,6 +52,74 @@ TEST_F(HTML_Writer_Test, inner_text)
     EXPECT_EQ(expected, as_view(out));
 }
 
+TEST_F(HTML_Writer_Test, inner_text_long)
+{
+    // Long enough to be processed in blocks, with special characters at the block boundaries.
+    constexpr std::u8string_view expected
+        = u8"abcdefghijklmno&lt;abcdefghijklmn&gt;&amp;abcdefghijklmnopqrstuvwxyz&lt;";
+
+    writer.write_inner_text(u8"abcdefghijklmno<abcdefghijklmn>&abcdefghijklmnopqrstuvwxyz<");
+
+    EXPECT_EQ(expected, as_view(out));
+}
+
+TEST_F(HTML_Writer_Test, inner_html_utf32)
+{
+    // Long enough to be transcoded in blocks, with non-ASCII characters at the block boundaries.
+    constexpr std::u8string_view expected
+        = u8"abcdefg\u00e4abcdefgh\u20ac\U0001F600abcdefghijklmnopqrstuvwxyz\u00df";
+
+    writer.write_inner_html(
+        U"abcdefg\u00e4abcdefgh\u20ac\U0001F600abcdefghijklmnopqrstuvwxyz\u00df"
+    );
+
+    EXPECT_EQ(expected, as_view(out));
+}
+
+TEST_F(HTML_Writer_Test, inner_text_utf32)
+{
+    constexpr std::u8string_view expected = u8"&lt;abcdefghijk\u00e4&amp;";
+
+    writer.write_inner_text(U"<abcdefghijk\u00e4&");
+
+    EXPECT_EQ(expected, as_view(out));
+}
+
+TEST_F(HTML_Writer_Test, escaped_attribute_charset)
+{
+    constexpr std::u8string_view expected
+        = u8"<a&>&quot;abcdefghijklmnopqrstuvwxyz&apos;abcdefghijklmnopqrstuvwxyz&quot;";
+
+    append_html_escaped(
+        out, u8"<a&>\"abcdefghijklmnopqrstuvwxyz'abcdefghijklmnopqrstuvwxyz\"", u8"\"'"
+    );
+
+    EXPECT_EQ(expected, as_view(out));
+}
+
+TEST_F(HTML_Writer_Test, url_encoded)
+{
+    // Every code unit, with long runs in between so that blocks are processed too.
+    std::pmr::u8string text { &memory };
+    for (std::size_t c = 0; c < 256; ++c) {
+        text += u8"abcdefghijklmnopqrstuvwxyz";
+        text += char8_t(c);
+    }
+
+    for (const URL_Encoded_Set encoded :
+         { URL_Encoded_Set::always, URL_Encoded_Set::always_and_apostrophe }) {
+        std::pmr::vector<char8_t> expected { &memory };
+        url_encode_ascii_if(std::back_inserter(expected), text, [&](char8_t c) {
+            return is_url_always_encoded(c)
+                || (encoded == URL_Encoded_Set::always_and_apostrophe && c == u8'\'');
+        });
+
+        out.clear();
+        append_url_encoded(out, text, encoded);
+        EXPECT_EQ(as_view(expected), as_view(out));
+    }
+}
+
 TEST_F(HTML_Writer_Test, tag)
 {
     constexpr std::u8string_view expected = u8"<b>Hello, world!</b>";
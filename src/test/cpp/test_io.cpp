@@ -0,0 +1,123 @@
+#ifndef COWEL_EMSCRIPTEN
+
+#ifdef __unix__
+#include <stdio.h> // NOLINT for fdopen
+#include <thread>
+#include <unistd.h>
+#endif
+
+#include <cstddef>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "cowel/util/io.hpp"
+#include "cowel/util/result.hpp"
+
+namespace cowel {
+namespace {
+
+struct File_Deleter {
+    void operator()(std::FILE* file) const noexcept
+    {
+        std::fclose(file);
+    }
+};
+
+using Unique_Test_File = std::unique_ptr<std::FILE, File_Deleter>;
+
+/// @brief Returns many pieces of different lengths, including empty ones,
+/// which take several calls to `writev` to write.
+[[nodiscard]]
+std::vector<std::u8string> make_pieces(std::size_t count)
+{
+    std::vector<std::u8string> result;
+    result.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        result.emplace_back(i % 7, char8_t(u8'a' + (i % 26)));
+    }
+    return result;
+}
+
+[[nodiscard]]
+std::u8string read_all(std::FILE* file)
+{
+    std::u8string result;
+    char8_t buffer[BUFSIZ];
+    std::size_t read_size;
+    while ((read_size = std::fread(buffer, 1, sizeof(buffer), file)) != 0) {
+        result.append(buffer, read_size);
+    }
+    return result;
+}
+
+TEST(IO, write_to_file_many_pieces)
+{
+    const std::vector<std::u8string> pieces = make_pieces(1000);
+    const std::vector<std::u8string_view> views { pieces.begin(), pieces.end() };
+    std::u8string expected;
+    for (const std::u8string& piece : pieces) {
+        expected += piece;
+    }
+
+    const Unique_Test_File file { std::tmpfile() };
+    ASSERT_TRUE(file);
+    // Anything buffered in the file has to be written before the pieces.
+    std::fputs("prefix", file.get());
+    ASSERT_TRUE(write_to_file(file.get(), views));
+
+    std::rewind(file.get());
+    EXPECT_TRUE(u8"prefix" + expected == read_all(file.get()));
+}
+
+TEST(IO, write_to_file_empty_pieces)
+{
+    const std::u8string_view pieces[] { u8"", u8"", u8"" };
+
+    const Unique_Test_File file { std::tmpfile() };
+    ASSERT_TRUE(file);
+    ASSERT_TRUE(write_to_file(file.get(), pieces));
+
+    std::rewind(file.get());
+    EXPECT_TRUE(read_all(file.get()).empty());
+}
+
+#ifdef __unix__
+TEST(IO, write_to_file_pipe)
+{
+    // A pipe holds much less than the total size at once,
+    // so the pieces are only written as the reader catches up.
+    const std::vector<std::u8string> pieces = make_pieces(256 * 1024);
+    const std::vector<std::u8string_view> views { pieces.begin(), pieces.end() };
+    std::u8string expected;
+    for (const std::u8string& piece : pieces) {
+        expected += piece;
+    }
+
+    int fds[2];
+    ASSERT_EQ(::pipe(fds), 0);
+    const Unique_Test_File read_end { ::fdopen(fds[0], "rb") };
+    Unique_Test_File write_end { ::fdopen(fds[1], "wb") };
+    ASSERT_TRUE(read_end);
+    ASSERT_TRUE(write_end);
+
+    std::u8string actual;
+    std::thread reader { [&] { actual = read_all(read_end.get()); } };
+    const bool success = bool(write_to_file(write_end.get(), views));
+    // Closing the write end lets the reader see the end of the file.
+    write_end.reset();
+    reader.join();
+
+    EXPECT_TRUE(success);
+    EXPECT_TRUE(expected == actual);
+}
+#endif
+
+} // namespace
+} // namespace cowel
+
+#endif
@@ -391,6 +391,51 @@ TEST(Parse, empty)
     ASSERT_TRUE(run_parse_test(u8"empty.cow", expected));
 }
 
+TEST(Parse, text_needs_html_escaping)
+{
+    std::pmr::monotonic_buffer_resource memory;
+    std::pmr::vector<AST_Instruction> actual { &memory };
+    parse(actual, u8"a < b\\x{c & d}e");
+
+    static constexpr AST_Instruction expected[] {
+        { AST_Instruction_Type::push_document, 3 },
+        { AST_Instruction_Type::text, 5, true },
+        { AST_Instruction_Type::push_directive, 2 },
+        { AST_Instruction_Type::push_block, 1 },
+        { AST_Instruction_Type::text, 5, true },
+        { AST_Instruction_Type::pop_block },
+        { AST_Instruction_Type::pop_directive },
+        { AST_Instruction_Type::text, 1, false },
+        { AST_Instruction_Type::pop_document },
+    };
+    ASSERT_TRUE(std::ranges::equal(expected, actual));
+}
+
+TEST(Parse, text_contains_blank_line)
+{
+    std::pmr::monotonic_buffer_resource memory;
+    std::pmr::vector<AST_Instruction> actual { &memory };
+    parse(actual, u8"a\n \nb\\x{c\nd}\n\\y{} \t\n");
+
+    static constexpr AST_Instruction expected[] {
+        { AST_Instruction_Type::push_document, 5 },
+        { .type = AST_Instruction_Type::text, .n = 5, .contains_blank_line = true },
+        { AST_Instruction_Type::push_directive, 2 },
+        { AST_Instruction_Type::push_block, 1 },
+        { AST_Instruction_Type::text, 3 },
+        { AST_Instruction_Type::pop_block },
+        { AST_Instruction_Type::pop_directive },
+        { .type = AST_Instruction_Type::text, .n = 1, .contains_blank_line = true },
+        { AST_Instruction_Type::push_directive, 2 },
+        { AST_Instruction_Type::push_block, 0 },
+        { AST_Instruction_Type::pop_block },
+        { AST_Instruction_Type::pop_directive },
+        { .type = AST_Instruction_Type::text, .n = 3, .contains_blank_line = true },
+        { AST_Instruction_Type::pop_document },
+    };
+    ASSERT_TRUE(std::ranges::equal(expected, actual));
+}
+
 TEST(Parse_And_Build, empty)
 {
     static std::pmr::monotonic_buffer_resource memory;
@@ -412,7 +457,7 @@ TEST(Parse, directive_brace_escape_2)
         { AST_Instruction_Type::text, 1 },
         { AST_Instruction_Type::pop_block },
         { AST_Instruction_Type::pop_directive },
-        { AST_Instruction_Type::text, 1 },
+        { .type = AST_Instruction_Type::text, .n = 1, .contains_blank_line = true },
         { AST_Instruction_Type::pop_document },
     };
     // clang-format on
@@ -429,7 +474,7 @@ TEST(Parse, hello_code)
         { AST_Instruction_Type::text, 10 },
         { AST_Instruction_Type::pop_block },
         { AST_Instruction_Type::pop_directive },
-        { AST_Instruction_Type::text, 1 },
+        { .type = AST_Instruction_Type::text, .n = 1, .contains_blank_line = true },
         { AST_Instruction_Type::pop_document, 0 },
     };
     // clang-format on
@@ -483,7 +528,7 @@ TEST(Parse, hello_directive)
         { AST_Instruction_Type::text, 4 },          // "test"
         { AST_Instruction_Type::pop_block },        // }
         { AST_Instruction_Type::pop_directive },
-        { AST_Instruction_Type::text, 1 },          // \n
+        { .type = AST_Instruction_Type::text, .n = 1, .contains_blank_line = true }, // \n
         { AST_Instruction_Type::pop_document },
     };
     // clang-format on
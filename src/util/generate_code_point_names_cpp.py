@@ -0,0 +1,148 @@
+#!/bin/python
+# Usage:
+#   generate_code_point_names_cpp.py < name_to_cp.hpp > code_point_names_autogenerated.cpp
+#
+# Walks the name tree in the cedilla name_to_cp.hpp header
+# and prints a minimal perfect hash table over all names in that tree,
+# built using the "hash, displace, and compress" (CHD) scheme.
+#
+# Names are stored in their "loosely matched" form, i.e. as they are stored in the tree:
+# in upper case, and without spaces or medial hyphens.
+# The names themselves are not stored; instead, each slot holds the name length
+# and a 32-bit fingerprint of the name for verification.
+# Algorithmically derived names (Hangul syllables, CJK ideographs, etc.) are not in the tree,
+# so they are not in the table either.
+#
+# The hash function must match `fnv1a` in code_point_names.cpp.
+import re
+import sys
+
+text = sys.stdin.read()
+
+def parse_dictionary() -> str:
+    start = text.index("constexpr const char* dict =")
+    source = text[start:text.index(";", start)]
+    return "".join(re.findall(r'"((?:[^"\\]|\\.)*)"', source))
+
+def parse_index() -> list[int]:
+    start = text.index("constexpr const uint8_t index[] =")
+    source = text[text.index("{", start) + 1:text.index("}", start)]
+    return [int(x, 0) for x in source.split(",") if x.strip()]
+
+dictionary = parse_dictionary()
+index = parse_index()
+
+# See uni::details::read_node in name_to_cp.hpp.
+def read_node(offset: int):
+    origin = offset
+    name_length = index[offset]
+    offset += 1
+    if offset + 6 >= len(index):
+        return None
+
+    long_name = name_length & 0x40
+    has_value = name_length & 0x80
+    name_length &= ~0xC0
+    if long_name:
+        name_offset = (index[offset] << 8) | index[offset + 1]
+        offset += 2
+        name = dictionary[name_offset:name_offset + name_length]
+    else:
+        name = dictionary[name_length]
+
+    value = None
+    children = 0
+    if has_value:
+        h, m, l = index[offset:offset + 3]
+        offset += 3
+        value = ((h << 16) | (m << 8) | l) >> 3
+        has_sibling = bool(l & 0x01)
+        if l & 0x02:
+            children = (index[offset] << 16) | (index[offset + 1] << 8) | index[offset + 2]
+            offset += 3
+    else:
+        h = index[offset]
+        offset += 1
+        has_sibling = bool(h & 0x80)
+        if h & 0x40:
+            children = ((h & ~0xC0) << 16) | (index[offset] << 8) | index[offset + 1]
+            offset += 2
+
+    return name, value, children, has_sibling, offset - origin
+
+def collect_names() -> dict[str, int]:
+    result = {}
+    stack = [(0, "")]
+    while stack:
+        offset, prefix = stack.pop()
+        while True:
+            node = read_node(offset)
+            if node is None or not node[0]:
+                break
+            name, value, children, has_sibling, size = node
+            if value is not None:
+                result.setdefault(prefix + name, value)
+            if children:
+                stack.append((children, prefix + name))
+            if not has_sibling:
+                break
+            offset += size
+    return result
+
+def fnv1a(name: str, seed: int) -> int:
+    h = 0x811C9DC5 ^ seed
+    for c in name.encode("ascii"):
+        h ^= c
+        h = (h * 0x01000193) & 0xFFFFFFFF
+    return h
+
+names = collect_names()
+keys = sorted(names)
+size = len(keys)
+bucket_count = size // 4
+
+buckets = [[] for _ in range(bucket_count)]
+for key in keys:
+    buckets[fnv1a(key, 0) % bucket_count].append(key)
+
+displacements = [0] * bucket_count
+slots = [None] * size
+# Place the largest buckets first, while there is still plenty of room.
+for b in sorted(range(bucket_count), key=lambda b: len(buckets[b]), reverse=True):
+    bucket = buckets[b]
+    if not bucket:
+        break
+    displacement = 1
+    while True:
+        candidates = [fnv1a(key, displacement) % size for key in bucket]
+        if len(set(candidates)) == len(candidates) and all(slots[s] is None for s in candidates):
+            break
+        displacement += 1
+    assert displacement <= 0xFFFF
+    for key, slot in zip(bucket, candidates):
+        slots[slot] = key
+    displacements[b] = displacement
+
+max_name_length = max(len(key) for key in keys)
+assert max(names.values()) < (1 << 21)
+assert max_name_length < (1 << 11)
+
+def format_rows(values: list[str], per_row: int) -> str:
+    rows = []
+    for i in range(0, len(values), per_row):
+        rows.append(",".join(values[i:i + per_row]) + ",")
+    return "\n".join(rows)
+
+print("// NOLINTBEGIN")
+print("// clang-format off")
+print(f"constexpr std::size_t code_point_name_max_length = {max_name_length};")
+print(f"constexpr std::uint16_t code_point_name_displacements[{bucket_count}] {{")
+print(format_rows([str(d) for d in displacements], 20))
+print("};")
+print(f"constexpr Code_Point_Name_Slot code_point_name_slots[{size}] {{")
+print(format_rows([
+    f"{{0x{names[key] | (len(key) << 21):08x},0x{fnv1a(key, 0):08x}}}" for key in slots
+], 4))
+print("};")
+print("// clang-format on")
+print("// NOLINTEND")
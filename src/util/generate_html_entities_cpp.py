@@ -1,4 +1,12 @@
 #!/bin/python
+# Usage:
+#   generate_html_entities_cpp.py < html_entities.json > html_entities_autogenerated.cpp
+#   generate_html_entities_cpp.py --hash < html_entities.json > html_entities_hash_autogenerated.cpp
+#
+# The first form prints the lexicographically sorted character references.
+# The second form prints a minimal perfect hash table over the same references,
+# built using the "hash, displace, and compress" (CHD) scheme.
+# The hash function must match `fnv1a` in html_entities.cpp.
 import json
 import sys
 
@@ -13,14 +21,78 @@ def format_code_points(code_points) -> str:
             formatted_code_points.append(f"U'\\u{code_point:04X}'")
     return ",".join(formatted_code_points)
 
-output = []
+def fnv1a(name: str, seed: int) -> int:
+    h = 0x811C9DC5 ^ seed
+    for c in name.encode("utf-8"):
+        h ^= c
+        h = (h * 0x01000193) & 0xFFFFFFFF
+    return h
 
+def build_hash_table(names: list[str]) -> list[tuple[int, int]]:
+    """
+    Returns a list of (displacement, index) pairs, one per slot.
+    The bucket of a name is `fnv1a(name, 0) % size`.
+    If the displacement of that bucket is negative, the name is in slot `-displacement - 1`;
+    otherwise, it is in slot `fnv1a(name, displacement) % size`.
+    The index of a slot is the index of the name in the sorted list of references.
+    Some names appear more than once (e.g. "&sup1" and "&sup;" both end up as "sup" after cropping);
+    only the first occurrence is placed in the table.
+    """
+    first_indices = {}
+    for index, name in enumerate(names):
+        first_indices.setdefault(name, index)
+
+    size = len(first_indices)
+    buckets = [[] for _ in range(size)]
+    for name, index in first_indices.items():
+        buckets[fnv1a(name, 0) % size].append(index)
+
+    displacements = [0] * size
+    indices = [None] * size
+    # Place the largest buckets first, while there is still plenty of room.
+    order = sorted(range(size), key=lambda b: len(buckets[b]), reverse=True)
+    position = 0
+    while position < size and len(buckets[order[position]]) > 1:
+        bucket = buckets[order[position]]
+        displacement = 1
+        while True:
+            slots = [fnv1a(names[i], displacement) % size for i in bucket]
+            if len(set(slots)) == len(slots) and all(indices[s] is None for s in slots):
+                break
+            displacement += 1
+        for i, slot in zip(bucket, slots):
+            indices[slot] = i
+        displacements[order[position]] = displacement
+        position += 1
+
+    # Buckets with a single name are placed directly into the remaining free slots.
+    free_slots = [s for s in range(size) if indices[s] is None]
+    for b in order[position:]:
+        if not buckets[b]:
+            continue
+        slot = free_slots.pop()
+        indices[slot] = buckets[b][0]
+        displacements[b] = -slot - 1
+
+    return list(zip(displacements, indices))
+
+references = []
 for name, entry in data.items():
     name_cropped = name[1:-1]
     code_points_formatted = format_code_points(entry["codepoints"])
-    output.append(f'{{u8"{name_cropped}",{len(name_cropped)},{{{code_points_formatted}}}}},')
+    line = f'{{u8"{name_cropped}",{len(name_cropped)},{{{code_points_formatted}}}}},'
+    references.append((line, name_cropped))
+
+# The order of references determines the indices in the hash table,
+# so it is important that both outputs sort the same way.
+references.sort()
+
+if "--hash" in sys.argv[1:]:
+    table = build_hash_table([name for _, name in references])
+    output = [f"{{{d},{i}}}," for d, i in table]
+else:
+    output = [line for line, _ in references]
 
-output.sort()
 print("// NOLINTBEGIN")
 print("// clang-format off")
 print("\n".join(output))